@@ -25,6 +25,11 @@
 
 
 namespace Poco {
+
+
+class ThreadPool;
+
+
 namespace CppParser {
 
 
@@ -46,6 +51,18 @@ public:
 	static void parseDir(const std::vector <std::string>& includePattern, const std::vector <std::string>& excludePattern, NameSpace::SymbolTable& st, const std::string& exec, const std::string& options, const std::string& path);
 		/// Preprocesses and parses all files specified by the include pattern (e.g.: p:/poco/Foundation/include/*/*.h) minus the ones defined in the exclude pattern
 
+	static void parseDir(const std::vector <std::string>& includePattern, const std::vector <std::string>& excludePattern, NameSpace::SymbolTable& st, const std::string& exec, const std::string& options, const std::string& path, Poco::ThreadPool& pool, const std::string& cacheDir = std::string());
+		/// Same as parseDir(), but runs the preprocessor for independent headers
+		/// concurrently on the given thread pool; the calling thread claims
+		/// files as well, so progress is guaranteed even if no pool thread is
+		/// available. Parsing proper attaches all symbols to the shared root
+		/// NameSpace and therefore stays on the calling thread; the external
+		/// preprocessor runs dominate the runtime by far.
+		///
+		/// If cacheDir is given, preprocessed output is kept there, keyed by a
+		/// digest of the header's content and the preprocessor invocation, and
+		/// is reused on subsequent runs for headers that have not changed.
+
 	static void fixup(NameSpace::SymbolTable& st);
 		/// Fixes all base pointers in the symbol table
 
@@ -67,6 +84,8 @@ protected:
 	static void buildFileList(std::set<std::string>& files, const std::vector<std::string>& includePattern, const std::vector<std::string>& excludePattern);
 		/// Searches all files that match the defined patterns and inserts them into files.
 private:
+	friend class ParallelPreprocessor;
+
 	Utility();
 	~Utility();
 	Utility(const Utility&);
@@ -23,6 +23,14 @@
 #include "Poco/Environment.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Exception.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/MD5Engine.h"
+#include "Poco/DigestStream.h"
+#include "Poco/FileStream.h"
+#include "Poco/StreamCopier.h"
 #include <fstream>
 #include <cstddef>
 
@@ -42,6 +50,188 @@ namespace Poco {
 namespace CppParser {
 
 
+class ParallelPreprocessor: public Poco::Runnable
+	/// Distributes preprocessing of a list of header files over a thread
+	/// pool, optionally keeping the preprocessed output in a cache
+	/// directory, so unchanged headers need not be preprocessed again
+	/// on a later run.
+	///
+	/// Parsing proper attaches all symbols to the shared root NameSpace
+	/// and therefore remains on the calling thread; see parseAll().
+{
+public:
+	struct Item
+	{
+		Item():
+			cached(false)
+		{
+		}
+
+		std::string file;     /// header to preprocess
+		std::string prepFile; /// preprocessed output (or cached copy)
+		bool        cached;   /// prepFile lives in the cache and must be kept
+		std::string error;    /// preprocessing error, if any
+	};
+
+	ParallelPreprocessor(std::vector<Item>& items, const std::string& exec, const std::string& options, const std::string& cacheDir):
+		_items(items),
+		_exec(exec),
+		_options(options),
+		_cacheDir(cacheDir),
+		_next(0),
+		_activeWorkers(0)
+	{
+	}
+
+	void process(Poco::ThreadPool& pool)
+		/// Preprocesses all items, distributing them over the given pool.
+		/// The calling thread claims items as well, so progress is
+		/// guaranteed even if no pool thread is available.
+	{
+		std::size_t maxWorkers = _items.size();
+		for (std::size_t i = 1; i < maxWorkers; ++i)
+		{
+			try
+			{
+				{
+					Poco::FastMutex::ScopedLock lock(_mutex);
+					++_activeWorkers;
+				}
+				pool.start(*this);
+			}
+			catch (Poco::NoThreadAvailableException&)
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				--_activeWorkers;
+				break;
+			}
+		}
+		workLoop();
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		while (_activeWorkers > 0)
+			_workersDone.wait(_mutex);
+	}
+
+	void run()
+		/// Claims and preprocesses items until the work list is drained.
+	{
+		workLoop();
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_activeWorkers > 0 && --_activeWorkers == 0)
+			_workersDone.signal();
+	}
+
+	void parseAll(NameSpace::SymbolTable& st)
+		/// Parses the preprocessed files into the given symbol table.
+		/// The first recorded preprocessing error is rethrown.
+	{
+		std::vector<Item>::iterator it = _items.begin();
+		try
+		{
+			for (; it != _items.end(); ++it)
+			{
+				if (!it->error.empty())
+					throw Poco::RuntimeException("Failed to preprocess file " + it->file, it->error);
+				Utility::parseOnly(it->file, st, it->prepFile, !it->cached);
+			}
+		}
+		catch (Exception&)
+		{
+			for (; it != _items.end(); ++it)
+			{
+				if (!it->cached && !it->prepFile.empty())
+					Utility::removeFile(it->prepFile);
+			}
+			throw;
+		}
+	}
+
+protected:
+	void workLoop()
+	{
+		for (;;)
+		{
+			std::size_t index;
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				if (_next >= _items.size()) break;
+				index = _next++;
+			}
+			Item& item = _items[index];
+			try
+			{
+				preprocessItem(item);
+			}
+			catch (Exception& exc)
+			{
+				item.error = exc.displayText();
+			}
+			catch (std::exception& exc)
+			{
+				item.error = exc.what();
+			}
+		}
+	}
+
+	void preprocessItem(Item& item)
+	{
+		std::string cachePath;
+		if (!_cacheDir.empty())
+		{
+			Path p(_cacheDir);
+			p.makeDirectory();
+			p.setFileName(cacheKey(item.file) + ".i");
+			cachePath = p.toString();
+			if (File(cachePath).exists())
+			{
+				item.prepFile = cachePath;
+				item.cached = true;
+				return;
+			}
+		}
+		item.prepFile = Utility::preprocessFile(item.file, _exec, _options, std::string());
+		if (!cachePath.empty())
+		{
+			try
+			{
+				File(item.prepFile).moveTo(cachePath);
+				item.prepFile = cachePath;
+				item.cached = true;
+			}
+			catch (Exception&)
+			{
+				// failing to populate the cache is not fatal
+			}
+		}
+	}
+
+	std::string cacheKey(const std::string& file) const
+		/// Returns a digest over the preprocessor invocation and the
+		/// header's content, so a change to either invalidates the
+		/// cached output.
+	{
+		Poco::MD5Engine md5;
+		md5.update(_exec);
+		md5.update(_options);
+		Poco::FileInputStream istr(file);
+		Poco::DigestOutputStream dstr(md5);
+		Poco::StreamCopier::copyStream(istr, dstr);
+		dstr.close();
+		return Poco::DigestEngine::digestToHex(md5.digest());
+	}
+
+private:
+	std::vector<Item>& _items;
+	std::string        _exec;
+	std::string        _options;
+	std::string        _cacheDir;
+	std::size_t        _next;
+	int                _activeWorkers;
+	Poco::FastMutex    _mutex;
+	Poco::Condition    _workersDone;
+};
+
+
 void Utility::parseDir(const std::vector <std::string>& includePattern, const std::vector <std::string>& excludePattern, NameSpace::SymbolTable& st, const std::string& exec, const std::string& options, const std::string& path)
 {
 	std::set<std::string> files;
@@ -54,6 +244,50 @@ void Utility::parseDir(const std::vector <std::string>& includePattern, const st
 }
 
 
+void Utility::parseDir(const std::vector <std::string>& includePattern, const std::vector <std::string>& excludePattern, NameSpace::SymbolTable& st, const std::string& exec, const std::string& options, const std::string& path, Poco::ThreadPool& pool, const std::string& cacheDir)
+{
+	std::set<std::string> files;
+	Utility::buildFileList(files, includePattern, excludePattern);
+
+	if (!path.empty())
+	{
+		std::string newPath(Environment::get("PATH"));
+		newPath += Path::pathSeparator();
+		newPath += path;
+		Environment::set("PATH", newPath);
+	}
+	if (!cacheDir.empty())
+	{
+		File(cacheDir).createDirectories();
+	}
+
+	// The preprocessed file is named after the header's base name, so
+	// equally named headers from different directories must not be
+	// preprocessed concurrently.
+	std::vector<ParallelPreprocessor::Item> items;
+	std::vector<ParallelPreprocessor::Item> duplicateItems;
+	std::set<std::string> baseNames;
+	for (std::set<std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		ParallelPreprocessor::Item item;
+		item.file = *it;
+		if (baseNames.insert(Path(*it).getBaseName()).second)
+			items.push_back(item);
+		else
+			duplicateItems.push_back(item);
+	}
+
+	ParallelPreprocessor preprocessor(items, exec, options, cacheDir);
+	preprocessor.process(pool);
+	ParallelPreprocessor duplicatePreprocessor(duplicateItems, exec, options, cacheDir);
+	duplicatePreprocessor.run();
+
+	preprocessor.parseAll(st);
+	duplicatePreprocessor.parseAll(st);
+	Utility::fixup(st);
+}
+
+
 void Utility::parse(const std::string& file, NameSpace::SymbolTable& st, const std::string& exec, const std::string& options, const std::string& path)
 {
 	std::string prepFile = Utility::preprocessFile(file, exec, options, path);
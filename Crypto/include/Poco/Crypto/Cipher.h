@@ -122,6 +122,34 @@ public:
 	virtual void decrypt(std::istream& source, std::ostream& sink, Encoding encoding = ENC_NONE);
 		/// Directly decrypt an input stream that is encoded with the given encoding.
 
+	virtual std::size_t encrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength);
+		/// Encrypts inputLength bytes from the input buffer into the
+		/// caller-supplied output buffer, passing the whole buffer to the
+		/// underlying cipher in a single call. In contrast to
+		/// encryptString(), no intermediate copies of the data are made,
+		/// which makes this the preferred method for bulk encryption of
+		/// large in-memory buffers.
+		///
+		/// The output buffer must provide room for at least
+		///   inputLength + 2*blockSize
+		/// bytes of the cipher's block size. Returns the number of bytes
+		/// written to the output buffer.
+		///
+		/// To reuse the cipher context across many buffers, or to obtain
+		/// the authentication tag when using an AEAD cipher such as
+		/// AES-GCM, use createEncryptor() and CryptoTransform::reset()
+		/// directly instead.
+
+	virtual std::size_t decrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength);
+		/// Decrypts inputLength bytes from the input buffer into the
+		/// caller-supplied output buffer, passing the whole buffer to the
+		/// underlying cipher in a single call.
+		///
+		/// The output buffer must provide room for at least
+		///   inputLength + 2*blockSize
+		/// bytes of the cipher's block size. Returns the number of bytes
+		/// written to the output buffer.
+
 protected:
 	Cipher();
 		/// Creates a new Cipher object.
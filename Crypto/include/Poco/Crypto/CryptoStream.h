@@ -38,8 +38,16 @@ class Crypto_API CryptoStreamBuf: public Poco::BufferedStreamBuf
 	/// going through it.
 {
 public:
-	CryptoStreamBuf(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
-	CryptoStreamBuf(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
+	enum
+	{
+		DEFAULT_BUFFER_SIZE = 32768
+			/// Default size of the stream buffer, in bytes. A larger
+			/// buffer amortizes the per-call overhead of the underlying
+			/// cryptographic transformation over more data.
+	};
+
+	CryptoStreamBuf(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = DEFAULT_BUFFER_SIZE);
+	CryptoStreamBuf(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = DEFAULT_BUFFER_SIZE);
 
 	virtual ~CryptoStreamBuf();
 
@@ -70,8 +78,8 @@ class Crypto_API CryptoIOS: public virtual std::ios
 	/// stream buffer and base classes.
 {
 public:
-	CryptoIOS(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
-	CryptoIOS(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
+	CryptoIOS(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
+	CryptoIOS(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 	~CryptoIOS();
 	CryptoStreamBuf* rdbuf();
 
@@ -89,11 +97,11 @@ class Crypto_API CryptoInputStream: public CryptoIOS, public std::istream
 	/// respectively.
 {
 public:
-	CryptoInputStream(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
+	CryptoInputStream(std::istream& istr, CryptoTransform* pTransform, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new CryptoInputStream object. The CryptoInputStream takes the
 		/// ownership of the given CryptoTransform object.
 
-	CryptoInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	CryptoInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new encrypting CryptoInputStream object using the given cipher.
 
 	~CryptoInputStream();
@@ -113,11 +121,11 @@ class Crypto_API CryptoOutputStream: public CryptoIOS, public std::ostream
 	/// to ensure completion of cryptographic transformation.
 {
 public:
-	CryptoOutputStream(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = 8192);
+	CryptoOutputStream(std::ostream& ostr, CryptoTransform* pTransform, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new CryptoOutputStream object. The CryptoOutputStream takes the
 		/// ownership of the given CryptoTransform object.
 
-	CryptoOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	CryptoOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new decrypting CryptoOutputStream object using the given cipher.
 
 	~CryptoOutputStream();
@@ -133,7 +141,7 @@ class Crypto_API DecryptingInputStream: public CryptoIOS, public std::istream
 	/// Cipher.
 {
 public:
-	DecryptingInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	DecryptingInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new DecryptingInputStream object using the given cipher.
 
 	~DecryptingInputStream();
@@ -146,7 +154,7 @@ class Crypto_API DecryptingOutputStream: public CryptoIOS, public std::ostream
 	/// Cipher.
 {
 public:
-	DecryptingOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	DecryptingOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new DecryptingOutputStream object using the given cipher.
 
 	~DecryptingOutputStream();
@@ -162,7 +170,7 @@ class Crypto_API EncryptingInputStream: public CryptoIOS, public std::istream
 	/// Cipher.
 {
 public:
-	EncryptingInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	EncryptingInputStream(std::istream& istr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new EncryptingInputStream object using the given cipher.
 
 	~EncryptingInputStream();
@@ -175,7 +183,7 @@ class Crypto_API EncryptingOutputStream: public CryptoIOS, public std::ostream
 	/// Cipher.
 {
 public:
-	EncryptingOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = 8192);
+	EncryptingOutputStream(std::ostream& ostr, Cipher& cipher, std::streamsize bufferSize = CryptoStreamBuf::DEFAULT_BUFFER_SIZE);
 		/// Create a new EncryptingOutputStream object using the given cipher.
 
 	~EncryptingOutputStream();
@@ -20,6 +20,7 @@
 
 #include "Poco/Crypto/Crypto.h"
 #include <ios>
+#include <vector>
 
 
 namespace Poco {
@@ -78,6 +79,27 @@ public:
 		///   length >= 2*blockSize()
 		/// must be true.  Returns the number of bytes written to the output
 		/// buffer.
+
+	virtual void reset();
+		/// Re-initializes the transform for a new message after finalize(),
+		/// reusing the underlying cipher context as well as the original key
+		/// and initialization vector. This avoids a context allocation and
+		/// key schedule setup for every message when many messages are
+		/// transformed with the same cipher.
+		///
+		/// Note that encrypting two messages with the same key and IV leaks
+		/// information about the plaintexts with most cipher modes and
+		/// breaks the security of GCM entirely; use reset(iv) with a fresh
+		/// IV whenever the transform is used for encryption.
+		///
+		/// The default implementation throws a NotImplementedException.
+
+	virtual void reset(const std::vector<unsigned char>& iv);
+		/// Re-initializes the transform for a new message with a new
+		/// initialization vector, reusing the underlying cipher context and
+		/// the original key.
+		///
+		/// The default implementation throws a NotImplementedException.
 };
 
 
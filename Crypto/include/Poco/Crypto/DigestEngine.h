@@ -31,6 +31,17 @@ namespace Crypto {
 class Crypto_API DigestEngine: public Poco::DigestEngine
 	/// This class implements a Poco::DigestEngine for all
 	/// digest algorithms supported by OpenSSL.
+	///
+	/// In contrast to the portable digest engines in Foundation
+	/// (e.g., Poco::MD5Engine and Poco::SHA1Engine), OpenSSL
+	/// dispatches at runtime to hardware-accelerated implementations
+	/// (SHA extensions on x86, the ARMv8 cryptography extensions)
+	/// where the processor supports them, making this class the
+	/// preferred choice for bulk checksumming.
+	///
+	/// The underlying digest context is created once and reused
+	/// across reset() calls, so a single engine can hash many
+	/// messages without per-message allocations.
 {
 public:
 	DigestEngine(const std::string& name);
@@ -49,6 +60,16 @@ public:
 	int nid() const;
 		/// Returns the NID (OpenSSL object identifier) of the digest algorithm.
 
+	static Poco::DigestEngine::Digest digest(const std::string& algorithm, const void* data, std::size_t length);
+		/// Computes the digest of the given buffer in a single call,
+		/// using the digest with the given name.
+		///
+		/// This is cheaper than constructing a DigestEngine for a
+		/// one-shot digest computation.
+		///
+		/// Throws a Poco::NotFoundException if no algorithm with the
+		/// given name exists.
+
 	// DigestEngine
 	std::size_t digestLength() const;
 	void reset();
@@ -59,6 +80,7 @@ protected:
 	
 private:
 	std::string _name;
+	const EVP_MD* _pMD;
 	EVP_MD_CTX* _pContext;
 	Poco::DigestEngine::Digest _digest;
 	OpenSSLInitializer _openSSLInitializer;
@@ -102,6 +102,54 @@ void Cipher::encrypt(std::istream& source, std::ostream& sink, Encoding encoding
 }
 
 
+std::size_t Cipher::encrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength)
+{
+	CryptoTransform* pTransform = createEncryptor();
+	try
+	{
+		std::streamsize n = pTransform->transform(
+			reinterpret_cast<const unsigned char*>(input),
+			static_cast<std::streamsize>(inputLength),
+			reinterpret_cast<unsigned char*>(output),
+			static_cast<std::streamsize>(outputLength));
+		n += pTransform->finalize(
+			reinterpret_cast<unsigned char*>(output) + n,
+			static_cast<std::streamsize>(outputLength) - n);
+		delete pTransform;
+		return static_cast<std::size_t>(n);
+	}
+	catch (...)
+	{
+		delete pTransform;
+		throw;
+	}
+}
+
+
+std::size_t Cipher::decrypt(const void* input, std::size_t inputLength, void* output, std::size_t outputLength)
+{
+	CryptoTransform* pTransform = createDecryptor();
+	try
+	{
+		std::streamsize n = pTransform->transform(
+			reinterpret_cast<const unsigned char*>(input),
+			static_cast<std::streamsize>(inputLength),
+			reinterpret_cast<unsigned char*>(output),
+			static_cast<std::streamsize>(outputLength));
+		n += pTransform->finalize(
+			reinterpret_cast<unsigned char*>(output) + n,
+			static_cast<std::streamsize>(outputLength) - n);
+		delete pTransform;
+		return static_cast<std::size_t>(n);
+	}
+	catch (...)
+	{
+		delete pTransform;
+		throw;
+	}
+}
+
+
 void Cipher::decrypt(std::istream& source, std::ostream& sink, Encoding encoding)
 {
 	CryptoOutputStream decryptor(sink, createDecryptor());
@@ -75,7 +75,12 @@ namespace
 			unsigned char*  output,
 			std::streamsize length);
 
+		void reset();
+		void reset(const std::vector<unsigned char>& iv);
+
 	private:
+		void initContext();
+
 		const EVP_CIPHER* _pCipher;
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
 		EVP_CIPHER_CTX*   _pContext;
@@ -84,6 +89,7 @@ namespace
 #endif
 		ByteVec           _key;
 		ByteVec           _iv;
+		Direction         _dir;
 	};
 
 
@@ -94,23 +100,32 @@ namespace
 		Direction         dir):
 		_pCipher(pCipher),
 		_key(key),
-		_iv(iv)
+		_iv(iv),
+		_dir(dir)
 	{
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
 		_pContext = EVP_CIPHER_CTX_new();
+#endif
+		initContext();
+	}
+
+
+	void CryptoTransformImpl::initContext()
+	{
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
 		EVP_CipherInit(
 			_pContext,
 			_pCipher,
 			&_key[0],
 			_iv.empty() ? 0 : &_iv[0],
-			(dir == DIR_ENCRYPT) ? 1 : 0);
+			(_dir == DIR_ENCRYPT) ? 1 : 0);
 #else
 		EVP_CipherInit(
 			&_context,
 			_pCipher,
 			&_key[0],
 			_iv.empty() ? 0 : &_iv[0],
-			(dir == DIR_ENCRYPT) ? 1 : 0);
+			(_dir == DIR_ENCRYPT) ? 1 : 0);
 #endif
 
 #if OPENSSL_VERSION_NUMBER >= 0x10001000L
@@ -241,6 +256,19 @@ namespace
 
 		return static_cast<std::streamsize>(len);
 	}
+
+
+	void CryptoTransformImpl::reset()
+	{
+		initContext();
+	}
+
+
+	void CryptoTransformImpl::reset(const std::vector<unsigned char>& iv)
+	{
+		_iv = iv;
+		initContext();
+	}
 }
 
 
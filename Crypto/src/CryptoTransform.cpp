@@ -13,6 +13,7 @@
 
 
 #include "Poco/Crypto/CryptoTransform.h"
+#include "Poco/Exception.h"
 
 
 namespace Poco {
@@ -35,4 +36,16 @@ int CryptoTransform::setPadding(int padding)
 }
 
 
+void CryptoTransform::reset()
+{
+	throw Poco::NotImplementedException("reset() is not supported by this CryptoTransform");
+}
+
+
+void CryptoTransform::reset(const std::vector<unsigned char>& iv)
+{
+	throw Poco::NotImplementedException("reset() is not supported by this CryptoTransform");
+}
+
+
 } } // namespace Poco::Crypto
@@ -22,11 +22,12 @@ namespace Crypto {
 
 DigestEngine::DigestEngine(const std::string& name):
 	_name(name),
-	_pContext(EVP_MD_CTX_create())
+	_pMD(EVP_get_digestbyname(name.c_str())),
+	_pContext(0)
 {
-	const EVP_MD* md = EVP_get_digestbyname(_name.c_str());
-	if (!md) throw Poco::NotFoundException(_name);
-	EVP_DigestInit_ex(_pContext, md, NULL);	
+	if (!_pMD) throw Poco::NotFoundException(_name);
+	_pContext = EVP_MD_CTX_create();
+	EVP_DigestInit_ex(_pContext, _pMD, NULL);
 }
 
 	
@@ -48,15 +49,26 @@ std::size_t DigestEngine::digestLength() const
 
 void DigestEngine::reset()
 {
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L
-	EVP_MD_CTX_free(_pContext);
-	_pContext = EVP_MD_CTX_create();
-#else
+	// EVP_DigestInit_ex() re-initializes the existing context in place,
+	// so the context (and its digest-specific state allocation) is
+	// reused rather than recreated for every message.
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
 	EVP_MD_CTX_cleanup(_pContext);
 #endif
-	const EVP_MD* md = EVP_get_digestbyname(_name.c_str());
-	if (!md) throw Poco::NotFoundException(_name);
-	EVP_DigestInit_ex(_pContext, md, NULL);
+	EVP_DigestInit_ex(_pContext, _pMD, NULL);
+}
+
+
+Poco::DigestEngine::Digest DigestEngine::digest(const std::string& algorithm, const void* data, std::size_t length)
+{
+	OpenSSLInitializer initializer;
+	const EVP_MD* md = EVP_get_digestbyname(algorithm.c_str());
+	if (!md) throw Poco::NotFoundException(algorithm);
+	unsigned char buffer[EVP_MAX_MD_SIZE];
+	unsigned len = 0;
+	if (EVP_Digest(data, length, buffer, &len, md, NULL) == 0)
+		throw Poco::IOException("cannot compute digest", algorithm);
+	return Poco::DigestEngine::Digest(buffer, buffer + len);
 }
 
 
@@ -221,6 +221,71 @@ void CryptoTest::testEncryptDecryptGCM()
 }
 
 
+void CryptoTest::testEncryptDecryptBuffer()
+{
+	Cipher::Ptr pCipher = CipherFactory::defaultFactory().createCipher(CipherKey("aes256"));
+
+	for (std::size_t n = 1; n < MAX_DATA_SIZE; n += 97)
+	{
+		std::string in(n, 'x');
+		std::vector<unsigned char> encrypted(n + 64);
+		std::size_t encryptedSize = pCipher->encrypt(in.data(), in.size(), &encrypted[0], encrypted.size());
+		assert (encryptedSize > 0);
+
+		std::vector<unsigned char> decrypted(encryptedSize + 64);
+		std::size_t decryptedSize = pCipher->decrypt(&encrypted[0], encryptedSize, &decrypted[0], decrypted.size());
+		assert (decryptedSize == in.size());
+		assert (std::string(reinterpret_cast<char*>(&decrypted[0]), decryptedSize) == in);
+	}
+}
+
+
+void CryptoTest::testTransformReset()
+{
+	CipherKey key("aes-256-gcm");
+	CipherKey::ByteVec iv(12, 213);
+	key.setIV(iv);
+
+	Cipher::Ptr pCipher = CipherFactory::defaultFactory().createCipher(key);
+
+	CryptoTransform* pEncryptor = pCipher->createEncryptor();
+	CryptoTransform* pDecryptor = pCipher->createDecryptor();
+	for (int i = 0; i < 4; i++)
+	{
+		if (i > 0)
+		{
+			CipherKey::ByteVec newIV(12, static_cast<unsigned char>(i));
+			pEncryptor->reset(newIV);
+			pDecryptor->reset(newIV);
+		}
+
+		std::string in(100 + i, 'x');
+		std::vector<unsigned char> encrypted(in.size() + 32);
+		std::streamsize n = pEncryptor->transform(
+			reinterpret_cast<const unsigned char*>(in.data()),
+			static_cast<std::streamsize>(in.size()),
+			&encrypted[0],
+			static_cast<std::streamsize>(encrypted.size()));
+		n += pEncryptor->finalize(&encrypted[0] + n, static_cast<std::streamsize>(encrypted.size()) - n);
+		std::string tag = pEncryptor->getTag();
+
+		std::vector<unsigned char> decrypted(static_cast<std::size_t>(n) + 32);
+		std::streamsize m = pDecryptor->transform(
+			&encrypted[0],
+			n,
+			&decrypted[0],
+			static_cast<std::streamsize>(decrypted.size()));
+		pDecryptor->setTag(tag);
+		m += pDecryptor->finalize(&decrypted[0] + m, static_cast<std::streamsize>(decrypted.size()) - m);
+
+		assert (static_cast<std::size_t>(m) == in.size());
+		assert (std::string(reinterpret_cast<char*>(&decrypted[0]), static_cast<std::size_t>(m)) == in);
+	}
+	delete pEncryptor;
+	delete pDecryptor;
+}
+
+
 void CryptoTest::testPassword()
 {
 	CipherKey key("aes256", "password", "salt");
@@ -365,6 +430,8 @@ CppUnit::Test* CryptoTest::suite()
 	CppUnit_addTest(pSuite, CryptoTest, testEncryptDecryptWithSaltSha1);
 	CppUnit_addTest(pSuite, CryptoTest, testEncryptDecryptDESECB);
 	CppUnit_addTest(pSuite, CryptoTest, testEncryptDecryptGCM);
+	CppUnit_addTest(pSuite, CryptoTest, testEncryptDecryptBuffer);
+	CppUnit_addTest(pSuite, CryptoTest, testTransformReset);
 	CppUnit_addTest(pSuite, CryptoTest, testPassword);
 	CppUnit_addTest(pSuite, CryptoTest, testPasswordSha1);
 	CppUnit_addTest(pSuite, CryptoTest, testEncryptInterop);
@@ -34,6 +34,8 @@ public:
 	void testEncryptDecryptWithSaltSha1();
 	void testEncryptDecryptDESECB();
 	void testEncryptDecryptGCM();
+	void testEncryptDecryptBuffer();
+	void testTransformReset();
 	void testStreams();
 	void testPassword();
 	void testPasswordSha1();
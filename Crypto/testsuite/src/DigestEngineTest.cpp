@@ -12,6 +12,7 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/Crypto/DigestEngine.h"
+#include "Poco/Exception.h"
 
 
 using Poco::Crypto::DigestEngine;
@@ -73,6 +74,25 @@ void DigestEngineTest::testSHA1()
 	assert (DigestEngine::digestToHex(engine.digest()) == "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
 }
 
+void DigestEngineTest::testOneShot()
+{
+	std::string data("abc");
+	assert (DigestEngine::digestToHex(DigestEngine::digest("SHA1", data.data(), data.size()))
+		== "a9993e364706816aba3e25717850c26c9cd0d89d");
+	assert (DigestEngine::digestToHex(DigestEngine::digest("MD5", data.data(), data.size()))
+		== "900150983cd24fb0d6963f7d28e17f72");
+
+	try
+	{
+		DigestEngine::digest("NoSuchDigest", data.data(), data.size());
+		fail ("unknown digest - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+}
+
+
 void DigestEngineTest::setUp()
 {
 }
@@ -89,6 +109,7 @@ CppUnit::Test* DigestEngineTest::suite()
 
 	CppUnit_addTest(pSuite, DigestEngineTest, testMD5);
 	CppUnit_addTest(pSuite, DigestEngineTest, testSHA1);
+	CppUnit_addTest(pSuite, DigestEngineTest, testOneShot);
 
 	return pSuite;
 }
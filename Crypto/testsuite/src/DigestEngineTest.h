@@ -26,6 +26,7 @@ public:
 
 	void testMD5();
 	void testSHA1();
+	void testOneShot();
 
 	void setUp();
 	void tearDown();
@@ -231,6 +231,21 @@ public:
 	//void updateDates();
 		/// Update linked times
 
+	std::size_t bulkSize() const;
+		/// Returns the number of rows in the bulk bound containers.
+		/// All bulk bound containers must have the same number of rows,
+		/// otherwise a BindingException is thrown.
+
+	bool isBulk() const;
+		/// Returns true if columns have been bound in bulk mode.
+
+	void bindBulkRow(std::size_t row);
+		/// Binds the values of the specified row from all bulk bound
+		/// containers.
+
+	virtual void reset();
+		/// Releases the bulk bound containers.
+
 private:
 	Binder(const Binder&);
 		/// Don't copy the binder
@@ -245,10 +260,68 @@ private:
 	void realBind(std::size_t pos, enum_field_types type, const void* buffer, int length, bool isUnsigned = false);
 		/// Common bind implementation
 
+	class BulkSlot
+		/// Interface to a bulk bound container, allowing its values
+		/// to be bound one row at a time.
+	{
+	public:
+		BulkSlot(std::size_t pos): _pos(pos)
+		{
+		}
+
+		virtual ~BulkSlot()
+		{
+		}
+
+		virtual void bindRow(Binder& rBinder, std::size_t row) const = 0;
+		virtual std::size_t size() const = 0;
+
+		std::size_t pos() const
+		{
+			return _pos;
+		}
+
+	private:
+		std::size_t _pos;
+	};
+
+	template <typename T>
+	class BulkSlotImpl: public BulkSlot
+	{
+	public:
+		BulkSlotImpl(std::size_t pos, const std::vector<T>& rData):
+			BulkSlot(pos),
+			_rData(rData)
+		{
+		}
+
+		void bindRow(Binder& rBinder, std::size_t row) const
+		{
+			const T& val = _rData.at(row);
+			rBinder.bind(pos(), val, PD_IN);
+		}
+
+		std::size_t size() const
+		{
+			return _rData.size();
+		}
+
+	private:
+		const std::vector<T>& _rData;
+	};
+
+	template <typename T>
+	void bindBulk(std::size_t pos, const std::vector<T>& val)
+	{
+		_bulkSlots.push_back(new BulkSlotImpl<T>(pos, val));
+	}
+
 private:
+	typedef std::vector<Poco::SharedPtr<BulkSlot> > BulkSlotVec;
 
 	std::vector<MYSQL_BIND> _bindArray;
 	std::vector<MYSQL_TIME*> _dates;
+	BulkSlotVec _bulkSlots;
 };
 
 
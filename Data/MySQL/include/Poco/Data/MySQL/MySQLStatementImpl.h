@@ -73,7 +73,14 @@ protected:
 		
 	virtual void bindImpl();
 		/// Binds parameters
-		
+
+	void bindBulk();
+		/// Executes the statement in bulk binding mode: the prepared
+		/// statement is executed once per row of the bulk bound
+		/// containers, rebinding the parameters for each row, inside
+		/// a wrapping transaction when none is active. Only statements
+		/// returning no data can be executed in bulk mode.
+
 	virtual Poco::Data::AbstractExtractor::Ptr extractor();
 		/// Returns the concrete extractor used by the statement.
 		
@@ -93,6 +100,7 @@ private:
 	Binder::Ptr       _pBinder;
 	Extractor::Ptr    _pExtractor;
 	int               _hasNext;
+	int               _bulkRowCount;
 	};
 
 
@@ -50,8 +50,9 @@ public:
 	void options(mysql_option opt, unsigned int i);
 		/// Set connection options
 
-	void connect(const char* host, const char* user, const char* password, const char* db, unsigned int port);
-		/// Connect to server
+	void connect(const char* host, const char* user, const char* password, const char* db, unsigned int port, unsigned long clientFlag = 0);
+		/// Connect to server. The clientFlag argument is passed on to
+		/// mysql_real_connect() (e.g. CLIENT_MULTI_RESULTS).
 
 	void close();
 		/// Close connection
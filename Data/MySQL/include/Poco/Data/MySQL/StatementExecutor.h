@@ -62,6 +62,12 @@ public:
 	bool fetchColumn(std::size_t n, MYSQL_BIND *bind);
 		/// Fetches the column.
 
+	bool nextResult();
+		/// Advances to the next result set of a statement returning
+		/// multiple result sets (e.g. a stored procedure call executed
+		/// over a connection with CLIENT_MULTI_RESULTS enabled).
+		/// Returns true if another result set is available.
+
 	int getAffectedRowCount() const;
 		
 	operator MYSQL_STMT* ();
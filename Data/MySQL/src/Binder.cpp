@@ -295,7 +295,7 @@ void Binder::realBind(std::size_t pos, enum_field_types type, const void* buffer
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Int8>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -313,7 +313,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Int8>& val, Direction d
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::UInt8>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -331,7 +331,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::UInt8>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Int16>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -349,7 +349,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Int16>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::UInt16>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -367,7 +367,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::UInt16>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Int32>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -385,7 +385,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Int32>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::UInt32>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -403,7 +403,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::UInt32>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Int64>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -421,7 +421,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Int64>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::UInt64>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -439,7 +439,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::UInt64>& val, Direction
 
 void Binder::bind(std::size_t pos, const std::vector<bool>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -457,7 +457,7 @@ void Binder::bind(std::size_t pos, const std::list<bool>& val, Direction dir)
 
 void Binder::bind(std::size_t pos, const std::vector<float>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -475,7 +475,7 @@ void Binder::bind(std::size_t pos, const std::list<float>& val, Direction dir)
 
 void Binder::bind(std::size_t pos, const std::vector<double>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -493,7 +493,7 @@ void Binder::bind(std::size_t pos, const std::list<double>& val, Direction dir)
 
 void Binder::bind(std::size_t pos, const std::vector<char>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -511,7 +511,7 @@ void Binder::bind(std::size_t pos, const std::list<char>& val, Direction dir)
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Data::BLOB>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -529,7 +529,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Data::BLOB>& val, Direc
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Data::CLOB>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -547,7 +547,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Data::CLOB>& val, Direc
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::DateTime>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -565,7 +565,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::DateTime>& val, Directi
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Data::Date>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -583,7 +583,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Data::Date>& val, Direc
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Data::Time>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -601,7 +601,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Data::Time>& val, Direc
 
 void Binder::bind(std::size_t pos, const std::vector<Poco::Data::NullData>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -619,7 +619,7 @@ void Binder::bind(std::size_t pos, const std::list<Poco::Data::NullData>& val, D
 
 void Binder::bind(std::size_t pos, const std::vector<std::string>& val, Direction dir) 
 {
-	throw NotImplementedException();
+	bindBulk(pos, val);
 }
 
 
@@ -629,10 +629,50 @@ void Binder::bind(std::size_t pos, const std::deque<std::string>& val, Direction
 }
 
 
-void Binder::bind(std::size_t pos, const std::list<std::string>& val, Direction dir) 
+void Binder::bind(std::size_t pos, const std::list<std::string>& val, Direction dir)
 {
 	throw NotImplementedException();
 }
 
 
+std::size_t Binder::bulkSize() const
+{
+	if (_bulkSlots.empty()) return 0;
+
+	std::size_t size = _bulkSlots.front()->size();
+	BulkSlotVec::const_iterator it = _bulkSlots.begin();
+	BulkSlotVec::const_iterator itEnd = _bulkSlots.end();
+	for (; it != itEnd; ++it)
+	{
+		if ((*it)->size() != size)
+			throw Poco::Data::BindingException("Size mismatch in Bindings. All Bindings MUST have the same size");
+	}
+
+	return size;
+}
+
+
+bool Binder::isBulk() const
+{
+	return !_bulkSlots.empty();
+}
+
+
+void Binder::bindBulkRow(std::size_t row)
+{
+	BulkSlotVec::const_iterator it = _bulkSlots.begin();
+	BulkSlotVec::const_iterator itEnd = _bulkSlots.end();
+	for (; it != itEnd; ++it)
+	{
+		(*it)->bindRow(*this, row);
+	}
+}
+
+
+void Binder::reset()
+{
+	BulkSlotVec().swap(_bulkSlots);
+}
+
+
 } } } // namespace Poco::Data::MySQL
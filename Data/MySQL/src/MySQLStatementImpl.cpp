@@ -24,7 +24,8 @@ MySQLStatementImpl::MySQLStatementImpl(SessionImpl& h) :
 	_stmt(h.handle()), 
 	_pBinder(new Binder),
 	_pExtractor(new Extractor(_stmt, _metadata)), 
-	_hasNext(NEXT_DONTKNOW)
+	_hasNext(NEXT_DONTKNOW),
+	_bulkRowCount(-1)
 {
 }
 
@@ -42,6 +43,7 @@ std::size_t MySQLStatementImpl::columnsReturned() const
 
 int MySQLStatementImpl::affectedRowCount() const
 {
+	if (_bulkRowCount >= 0) return _bulkRowCount;
 	return _stmt.getAffectedRowCount();
 }
 
@@ -56,15 +58,25 @@ bool MySQLStatementImpl::hasNext()
 {
 	if (_hasNext == NEXT_DONTKNOW)
 	{
-		if (_metadata.columnsReturned() == 0)
+		for (;;)
 		{
-			return false;
-		}
-
-		if (_stmt.fetch())
-		{
-			_hasNext = NEXT_TRUE;
-			return true;
+			if (_metadata.columnsReturned() > 0 && _stmt.fetch())
+			{
+				_hasNext = NEXT_TRUE;
+				return true;
+			}
+
+			// the current result set is exhausted; advance to the next
+			// one if the statement produced more and another data set
+			// has been requested
+			if (!hasMoreDataSets() || !_stmt.nextResult())
+				break;
+
+			activateNextDataSet();
+			_metadata.reset();
+			_metadata.init(_stmt);
+			if (_metadata.columnsReturned() > 0)
+				_stmt.bindResult(_metadata.row());
 		}
 
 		_hasNext = NEXT_FALSE;
@@ -130,6 +142,14 @@ void MySQLStatementImpl::compileImpl()
 void MySQLStatementImpl::bindImpl()
 {
 	Poco::Data::AbstractBindingVec& binds = bindings();
+
+	_bulkRowCount = -1;
+	if (!binds.empty() && binds.front()->isBulk())
+	{
+		bindBulk();
+		return;
+	}
+
 	std::size_t pos = 0;
 	Poco::Data::AbstractBindingVec::iterator it = binds.begin();
 	Poco::Data::AbstractBindingVec::iterator itEnd = binds.end();
@@ -145,6 +165,54 @@ void MySQLStatementImpl::bindImpl()
 }
 
 
+void MySQLStatementImpl::bindBulk()
+{
+	if (_metadata.columnsReturned() > 0)
+		throw Poco::InvalidAccessException("Bulk binding is only supported for statements returning no data");
+
+	Poco::Data::AbstractBindingVec& binds = bindings();
+	std::size_t pos = 0;
+	Poco::Data::AbstractBindingVec::iterator it = binds.begin();
+	Poco::Data::AbstractBindingVec::iterator itEnd = binds.end();
+
+	_pBinder->reset();
+	for (; it != itEnd; ++it)
+	{
+		(*it)->bind(pos);
+		pos += (*it)->numOfColumnsHandled();
+	}
+
+	std::size_t rows = _pBinder->bulkSize();
+
+	Poco::Data::SessionImpl& rSession = session();
+	bool wrapTransaction = !rSession.isTransaction();
+	if (wrapTransaction) rSession.begin();
+
+	_bulkRowCount = 0;
+	try
+	{
+		for (std::size_t row = 0; row < rows; ++row)
+		{
+			_pBinder->bindBulkRow(row);
+			_stmt.bindParams(_pBinder->getBindArray(), _pBinder->size());
+			_stmt.execute();
+			_bulkRowCount += _stmt.getAffectedRowCount();
+		}
+	}
+	catch (...)
+	{
+		_pBinder->reset();
+		if (wrapTransaction) rSession.rollback();
+		throw;
+	}
+	_pBinder->reset();
+
+	if (wrapTransaction) rSession.commit();
+
+	_hasNext = NEXT_FALSE;
+}
+
+
 Poco::Data::AbstractExtractor::Ptr MySQLStatementImpl::extractor()
 {
 	return _pExtractor;
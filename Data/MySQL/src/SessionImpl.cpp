@@ -86,6 +86,7 @@ void SessionImpl::open(const std::string& connect)
 	options["auto-reconnect"] = "";
 	options["secure-auth"] = "";
 	options["character-set"] = "utf8";
+	options["multi-results"] = "";
 
 	const std::string& connString = connectionString();
 	for (std::string::const_iterator start = connString.begin();;) 
@@ -138,17 +139,28 @@ void SessionImpl::open(const std::string& connect)
 	if (!options["character-set"].empty())
 		_handle.options(MYSQL_SET_CHARSET_NAME, options["character-set"].c_str());
 
+	unsigned long clientFlag = 0;
+	if (options["multi-results"] == "true")
+		clientFlag |= CLIENT_MULTI_RESULTS;
+	else if (options["multi-results"] == "false")
+		;
+	else if (!options["multi-results"].empty())
+		throw MySQLException("create session: specify correct multi-results option (true or false) or skip it");
+
 	// Real connect
-	_handle.connect(options["host"].c_str(), 
-			options["user"].c_str(), 
-			options["password"].c_str(), 
-			db, 
-			port);
-
-	addFeature("autoCommit", 
-		&SessionImpl::autoCommit, 
+	_handle.connect(options["host"].c_str(),
+			options["user"].c_str(),
+			options["password"].c_str(),
+			db,
+			port,
+			clientFlag);
+
+	addFeature("autoCommit",
+		&SessionImpl::autoCommit,
 		&SessionImpl::isAutoCommit);
 
+	setFeature("bulk", true);
+
 	_connected = true;
 }
 	
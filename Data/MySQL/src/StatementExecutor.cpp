@@ -139,6 +139,29 @@ bool StatementExecutor::fetchColumn(std::size_t n, MYSQL_BIND *bind)
 	return (res == 0);
 }
 
+bool StatementExecutor::nextResult()
+{
+	if (_state < STMT_EXECUTED)
+		throw StatementException("Statement is not executed yet");
+
+#if defined(MYSQL_VERSION_ID) && (MYSQL_VERSION_ID >= 50503)
+	int res = mysql_stmt_next_result(_pHandle);
+
+	if (res > 0)
+		throw StatementException("mysql_stmt_next_result error", _pHandle, _query);
+
+	if (res == 0)
+	{
+		my_ulonglong affectedRows = mysql_affected_rows(_pSessionHandle);
+		if (affectedRows != ((my_ulonglong) - 1))
+			_affectedRowCount = static_cast<std::size_t>(affectedRows);
+		return true;
+	}
+#endif
+	return false;
+}
+
+
 int StatementExecutor::getAffectedRowCount() const
 {
 	return _affectedRowCount;
@@ -147,6 +147,19 @@ public:
 	int maxStatementLength();
 		/// Returns maximum length of SQL statement allowed by driver.
 
+	void setFetchRowArraySize(const std::string&, const Poco::Any& value);
+		/// Sets the number of rows fetched per SQLFetch call (block cursor
+		/// rowset size) for statements without explicit extraction storage.
+		/// Value must be of type std::size_t; a value greater than one
+		/// turns on internal bulk extraction, fetching the result set in
+		/// rowsets of the given size. The default is one (row by row fetch).
+
+	Poco::Any getFetchRowArraySize(const std::string& name="");
+		/// Returns the rowset size used for block fetching.
+
+	std::size_t fetchRowArraySize() const;
+		/// Returns the rowset size used for block fetching.
+
 	void setQueryTimeout(const std::string&, const Poco::Any& value);
 		/// Sets the timeout (in seconds) for queries.
 		/// Value must be of type int.
@@ -186,6 +199,7 @@ private:
 	char                   _canTransact;
 	bool                   _inTransaction;
 	int                    _queryTimeout;
+	std::size_t            _fetchRowArraySize;
 	Poco::FastMutex        _mutex;
 };
 
@@ -266,6 +280,27 @@ inline bool SessionImpl::isTransactionIsolation(Poco::UInt32 ti)
 }
 
 
+inline void SessionImpl::setFetchRowArraySize(const std::string&, const Poco::Any& value)
+{
+	std::size_t size = Poco::AnyCast<std::size_t>(value);
+	if (0 == size)
+		throw InvalidArgumentException("Rowset size must be at least one row.");
+	_fetchRowArraySize = size;
+}
+
+
+inline Poco::Any SessionImpl::getFetchRowArraySize(const std::string& name)
+{
+	return _fetchRowArraySize;
+}
+
+
+inline std::size_t SessionImpl::fetchRowArraySize() const
+{
+	return _fetchRowArraySize;
+}
+
+
 inline void SessionImpl::setQueryTimeout(const std::string&, const Poco::Any& value)
 {
 	_queryTimeout = Poco::AnyCast<int>(value);
@@ -109,12 +109,24 @@ void ODBCStatementImpl::compileImpl()
 
 void ODBCStatementImpl::makeInternalExtractors()
 {
-	if (hasData() && !extractions().size()) 
+	if (hasData() && !extractions().size())
 	{
+		// block fetch: when the session is configured with a rowset size
+		// greater than one, fetch internal extractions in rowsets via
+		// SQL_ATTR_ROW_ARRAY_SIZE instead of row by row
+		std::size_t rowArraySize =
+			AnyCast<std::size_t>(session().getProperty("fetchRowArraySize"));
+		if (rowArraySize > 1 && bulkExtractionAllowed() &&
+			Limit::LIMIT_UNLIMITED == getExtractionLimit() &&
+			!isStoredProcedure())
+		{
+			setBulkExtraction(Bulk(static_cast<Poco::UInt32>(rowArraySize)));
+		}
+
 		try
 		{
 			fillColumns();
-		} 
+		}
 		catch (DataFormatException&)
 		{
 			if (isStoredProcedure()) return;
@@ -39,7 +39,8 @@ SessionImpl::SessionImpl(const std::string& connect,
 		_autoExtract(autoExtract),
 		_canTransact(ODBC_TXN_CAPABILITY_UNKNOWN),
 		_inTransaction(false),
-		_queryTimeout(-1)
+		_queryTimeout(-1),
+		_fetchRowArraySize(1)
 {
 	setFeature("bulk", true);
 	open();
@@ -58,7 +59,8 @@ SessionImpl::SessionImpl(const std::string& connect,
 		_autoExtract(autoExtract),
 		_canTransact(ODBC_TXN_CAPABILITY_UNKNOWN),
 		_inTransaction(false),
-		_queryTimeout(-1)
+		_queryTimeout(-1),
+		_fetchRowArraySize(1)
 {
 	setFeature("bulk", true);
 	open();
@@ -158,6 +160,10 @@ void SessionImpl::open(const std::string& connect)
 		&SessionImpl::setQueryTimeout,
 		&SessionImpl::getQueryTimeout);
 
+	addProperty("fetchRowArraySize",
+		&SessionImpl::setFetchRowArraySize,
+		&SessionImpl::getFetchRowArraySize);
+
 	Poco::Data::ODBC::SQLSetConnectAttr(_db, SQL_ATTR_QUIET_MODE, 0, 0);
 
 	if (!canTransact()) autoCommit("", true);
@@ -23,7 +23,9 @@
 #include "Poco/Data/LOB.h"
 #include "Poco/Any.h"
 #include "Poco/DynamicAny.h"
+#include "Poco/SharedPtr.h"
 #include "sqlite3.h"
+#include <vector>
 
 
 namespace Poco {
@@ -109,7 +111,102 @@ public:
 	void bind(std::size_t pos, const NullData& val, Direction dir);
 		/// Binds a null.
 
+	void bind(std::size_t pos, const std::vector<Poco::Int8>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::UInt8>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::Int16>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::UInt16>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::Int32>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::UInt32>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::Int64>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Poco::UInt64>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<bool>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<float>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<double>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<char>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<std::string>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<BLOB>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<CLOB>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Date>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<Time>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<DateTime>& val, Direction dir);
+	void bind(std::size_t pos, const std::vector<NullData>& val, Direction dir);
+		/// Binds a column of values in bulk mode. The container is not
+		/// copied; a reference to it is kept and the value for each row
+		/// is bound by bindBulkRow() while the statement is stepped
+		/// through the batch.
+
+	std::size_t bulkSize() const;
+		/// Returns the number of rows in the bulk bound containers.
+		/// All bulk bound containers must have the same number of rows,
+		/// otherwise a BindingException is thrown.
+
+	bool isBulk() const;
+		/// Returns true if columns have been bound in bulk mode.
+
+	void bindBulkRow(std::size_t row);
+		/// Binds the values of the specified row from all bulk bound
+		/// containers.
+
+	void reset();
+		/// Releases the bulk bound containers.
+
 private:
+	class BulkSlot
+		/// Interface to a bulk bound container, allowing its values
+		/// to be bound one row at a time.
+	{
+	public:
+		BulkSlot(std::size_t pos): _pos(pos)
+		{
+		}
+
+		virtual ~BulkSlot()
+		{
+		}
+
+		virtual void bindRow(Binder& rBinder, std::size_t row) const = 0;
+		virtual std::size_t size() const = 0;
+
+		std::size_t pos() const
+		{
+			return _pos;
+		}
+
+	private:
+		std::size_t _pos;
+	};
+
+	template <typename T>
+	class BulkSlotImpl: public BulkSlot
+	{
+	public:
+		BulkSlotImpl(std::size_t pos, const std::vector<T>& rData):
+			BulkSlot(pos),
+			_rData(rData)
+		{
+		}
+
+		void bindRow(Binder& rBinder, std::size_t row) const
+		{
+			const T& val = _rData.at(row);
+			rBinder.bind(pos(), val, PD_IN);
+		}
+
+		std::size_t size() const
+		{
+			return _rData.size();
+		}
+
+	private:
+		const std::vector<T>& _rData;
+	};
+
+	template <typename T>
+	void bindBulk(std::size_t pos, const std::vector<T>& val)
+	{
+		_bulkSlots.push_back(new BulkSlotImpl<T>(pos, val));
+	}
+
 	void checkReturn(int rc);
 		/// Checks the SQLite return code and throws an appropriate exception
 		/// if error has occurred.
@@ -125,7 +222,10 @@ private:
 		checkReturn(rc);
 	}
 
+	typedef std::vector<Poco::SharedPtr<BulkSlot> > BulkSlotVec;
+
 	sqlite3_stmt* _pStmt;
+	BulkSlotVec   _bulkSlots;
 };
 
 
@@ -0,0 +1,166 @@
+//
+// BlobStream.h
+//
+// Library: Data/SQLite
+// Package: SQLite
+// Module:  BlobStream
+//
+// Definition of the BlobStream classes.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_SQLite_BlobStream_INCLUDED
+#define Data_SQLite_BlobStream_INCLUDED
+
+
+#include "Poco/Data/SQLite/SQLite.h"
+#include "Poco/Data/Session.h"
+#include "Poco/BufferedStreamBuf.h"
+#include <istream>
+#include <ostream>
+
+
+extern "C"
+{
+	typedef struct sqlite3 sqlite3;
+	typedef struct sqlite3_blob sqlite3_blob;
+}
+
+
+namespace Poco {
+namespace Data {
+namespace SQLite {
+
+
+class SQLite_API BlobStreamBuf: public Poco::BufferedStreamBuf
+	/// Stream buffer for reading and writing BLOB values incrementally,
+	/// using the SQLite incremental blob I/O API. The BLOB is addressed
+	/// by table, column and row id and is transferred in fixed size
+	/// chunks, so the full value is never materialized in memory.
+{
+public:
+	BlobStreamBuf(const Session& session,
+		const std::string& table,
+		const std::string& column,
+		Poco::Int64 rowID,
+		std::ios::openmode mode,
+		const std::string& database = "main");
+		/// Creates the BlobStreamBuf and opens the addressed BLOB.
+		///
+		/// Incremental I/O can not change the size of a BLOB; for
+		/// writing, the BLOB must already have its final size (e.g.
+		/// inserted through the zeroblob() SQL function).
+
+	~BlobStreamBuf();
+		/// Destroys the BlobStreamBuf and closes the BLOB handle.
+
+	std::size_t size() const;
+		/// Returns the size of the opened BLOB in bytes.
+
+protected:
+	int readFromDevice(char* buffer, std::streamsize length);
+	int writeToDevice(const char* buffer, std::streamsize length);
+
+private:
+	enum
+	{
+		STREAM_BUFFER_SIZE = 8192
+	};
+
+	sqlite3*      _pDB;
+	sqlite3_blob* _pBlob;
+	int           _size;
+	int           _readPos;
+	int           _writePos;
+};
+
+
+class SQLite_API BlobIOS: public virtual std::ios
+	/// The base class for BlobInputStream and BlobOutputStream.
+	///
+	/// This class is needed to ensure the correct initialization
+	/// order of the stream buffer and base classes.
+{
+public:
+	BlobIOS(const Session& session,
+		const std::string& table,
+		const std::string& column,
+		Poco::Int64 rowID,
+		std::ios::openmode mode,
+		const std::string& database);
+		/// Creates the BlobIOS and opens the addressed BLOB.
+
+	~BlobIOS();
+		/// Destroys the BlobIOS.
+
+	BlobStreamBuf* rdbuf();
+		/// Returns a pointer to the underlying stream buffer.
+
+protected:
+	BlobStreamBuf _buf;
+};
+
+
+class SQLite_API BlobInputStream: public BlobIOS, public std::istream
+	/// An input stream for reading a BLOB value in fixed size chunks,
+	/// at constant memory usage.
+{
+public:
+	BlobInputStream(const Session& session,
+		const std::string& table,
+		const std::string& column,
+		Poco::Int64 rowID,
+		const std::string& database = "main");
+		/// Creates the BlobInputStream for the BLOB stored in the
+		/// given row and column.
+
+	~BlobInputStream();
+		/// Destroys the BlobInputStream.
+};
+
+
+class SQLite_API BlobOutputStream: public BlobIOS, public std::ostream
+	/// An output stream for writing a BLOB value in fixed size chunks.
+	///
+	/// The BLOB must already have its final size (e.g. inserted
+	/// through the zeroblob() SQL function); writing past the end
+	/// of the BLOB puts the stream into the bad state.
+{
+public:
+	BlobOutputStream(const Session& session,
+		const std::string& table,
+		const std::string& column,
+		Poco::Int64 rowID,
+		const std::string& database = "main");
+		/// Creates the BlobOutputStream for the BLOB stored in the
+		/// given row and column.
+
+	~BlobOutputStream();
+		/// Destroys the BlobOutputStream.
+};
+
+
+//
+// inlines
+//
+inline std::size_t BlobStreamBuf::size() const
+{
+	return static_cast<std::size_t>(_size);
+}
+
+
+inline BlobStreamBuf* BlobIOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+} } } // namespace Poco::Data::SQLite
+
+
+#endif // Data_SQLite_BlobStream_INCLUDED
@@ -74,6 +74,17 @@ protected:
 	bool canCompile() const;
 		/// Returns true if statement can compile.
 
+	bool canReuse() const;
+		/// Returns true if the statement was fully compiled into a single
+		/// prepared statement, which can then be kept in the session's
+		/// statement cache and re-executed without another prepare.
+		/// Batches of statements are not reusable.
+
+	void reuseImpl();
+		/// Re-initializes per-execution state after the statement has been
+		/// fetched from the statement cache and new bindings have been
+		/// adopted.
+
 	void compileImpl();
 		/// Compiles the statement, doesn't bind yet.
 		/// Returns true if the statement was succesfully compiled.
@@ -85,6 +96,13 @@ protected:
 	void bindImpl();
 		/// Binds parameters
 
+	void bindBulk();
+		/// Executes the statement in bulk binding mode: the whole batch
+		/// is stepped through on a single prepared statement, rebinding
+		/// one row of the bulk bound containers per step, inside a
+		/// wrapping transaction when none is active. Only statements
+		/// returning no data can be executed in bulk mode.
+
 	AbstractExtraction::ExtractorPtr extractor();
 		/// Returns the concrete extractor used by the statement.
 
@@ -117,11 +117,85 @@ public:
 	const std::string& connectorName() const;
 		/// Returns the name of the connector.
 
+	void setJournalMode(const std::string& mode);
+		/// Sets the journal mode for the database ("delete", "truncate",
+		/// "persist", "memory", "wal" or "off"). Throws an
+		/// InvalidArgumentException if the database refuses the
+		/// requested mode. Also available as string property
+		/// "journalMode".
+
+	std::string getJournalMode();
+		/// Returns the current journal mode.
+
+	void setSynchronousLevel(const std::string& level);
+		/// Sets the synchronous level for the connection ("off",
+		/// "normal", "full" or "extra"). Also available as string
+		/// property "synchronous".
+
+	std::string getSynchronousLevel();
+		/// Returns the current synchronous level.
+
+	void setMMapSize(Poco::Int64 size);
+		/// Sets the maximum number of bytes accessed using memory-mapped
+		/// I/O (zero disables memory mapping). Also available as Int64
+		/// property "mmapSize".
+
+	Poco::Int64 getMMapSize();
+		/// Returns the memory-mapped I/O limit in bytes.
+
+	void setCacheSize(int size);
+		/// Sets the page cache size; a positive value is a number of
+		/// pages, a negative value a size in KiB. Also available as
+		/// int property "cacheSize".
+
+	int getCacheSize();
+		/// Returns the page cache size.
+
+	void setWALAutoCheckpoint(int pages);
+		/// Sets the number of WAL frames after which an automatic
+		/// checkpoint is run (zero disables automatic checkpoints).
+		/// Also available as int property "walAutoCheckpoint".
+
+	int getWALAutoCheckpoint();
+		/// Returns the WAL auto-checkpoint interval.
+
+	void setSnapshotRead(const std::string&, bool enable);
+		/// Enables multi-reader snapshot mode on the session ("snapshotRead"
+		/// feature): the database is switched to WAL journal mode and the
+		/// connection is made read-only (query_only), so any number of
+		/// snapshot-read sessions can read a consistent snapshot of the
+		/// database concurrently with a single writer.
+
+	bool getSnapshotRead(const std::string& name = "");
+		/// Returns true if the session is in multi-reader snapshot mode.
+
 protected:
 	void setConnectionTimeout(const std::string& prop, const Poco::Any& value);
 	Poco::Any getConnectionTimeout(const std::string& prop);
 
+	void setJournalMode(const std::string& prop, const Poco::Any& value);
+	Poco::Any getJournalMode(const std::string& prop);
+	void setSynchronousLevel(const std::string& prop, const Poco::Any& value);
+	Poco::Any getSynchronousLevel(const std::string& prop);
+	void setMMapSize(const std::string& prop, const Poco::Any& value);
+	Poco::Any getMMapSize(const std::string& prop);
+	void setCacheSize(const std::string& prop, const Poco::Any& value);
+	Poco::Any getCacheSize(const std::string& prop);
+	void setWALAutoCheckpoint(const std::string& prop, const Poco::Any& value);
+	Poco::Any getWALAutoCheckpoint(const std::string& prop);
+
 private:
+	void execPragma(const std::string& pragma);
+		/// Executes a PRAGMA statement, discarding any result rows.
+
+	std::string pragmaText(const std::string& pragma);
+		/// Returns the first column of the first result row of a PRAGMA
+		/// statement as text.
+
+	Poco::Int64 pragmaValue(const std::string& pragma);
+		/// Returns the first column of the first result row of a PRAGMA
+		/// statement as integer.
+
 	std::string _connector;
 	sqlite3*    _pDB;
 	bool        _connected;
@@ -14,6 +14,7 @@
 
 #include "Poco/Data/SQLite/Binder.h"
 #include "Poco/Data/SQLite/Utility.h"
+#include "Poco/Data/DataException.h"
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
 #include "Poco/Exception.h"
@@ -117,6 +118,160 @@ void Binder::bind(std::size_t pos, const NullData&, Direction)
 }
 
 
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int8>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt8>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int16>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt16>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int32>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt32>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int64>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt64>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<bool>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<float>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<double>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<char>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<std::string>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<BLOB>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<CLOB>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Date>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<Time>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<DateTime>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+void Binder::bind(std::size_t pos, const std::vector<NullData>& val, Direction dir)
+{
+	bindBulk(pos, val);
+}
+
+
+std::size_t Binder::bulkSize() const
+{
+	if (_bulkSlots.empty()) return 0;
+
+	std::size_t size = _bulkSlots.front()->size();
+	BulkSlotVec::const_iterator it = _bulkSlots.begin();
+	BulkSlotVec::const_iterator itEnd = _bulkSlots.end();
+	for (; it != itEnd; ++it)
+	{
+		if ((*it)->size() != size)
+			throw BindingException("Size mismatch in Bindings. All Bindings MUST have the same size");
+	}
+
+	return size;
+}
+
+
+bool Binder::isBulk() const
+{
+	return !_bulkSlots.empty();
+}
+
+
+void Binder::bindBulkRow(std::size_t row)
+{
+	BulkSlotVec::const_iterator it = _bulkSlots.begin();
+	BulkSlotVec::const_iterator itEnd = _bulkSlots.end();
+	for (; it != itEnd; ++it)
+	{
+		(*it)->bindRow(*this, row);
+	}
+}
+
+
+void Binder::reset()
+{
+	BulkSlotVec().swap(_bulkSlots);
+}
+
+
 void Binder::checkReturn(int rc)
 {
 	if (rc != SQLITE_OK)
@@ -0,0 +1,151 @@
+//
+// BlobStream.cpp
+//
+// Library: Data/SQLite
+// Package: SQLite
+// Module:  BlobStream
+//
+// Implementation of the BlobStream classes.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/SQLite/BlobStream.h"
+#include "Poco/Data/SQLite/Utility.h"
+#include "Poco/StreamUtil.h"
+#include "Poco/Exception.h"
+#if defined(POCO_UNBUNDLED)
+#include <sqlite3.h>
+#else
+#include "sqlite3.h"
+#endif
+
+
+namespace Poco {
+namespace Data {
+namespace SQLite {
+
+
+BlobStreamBuf::BlobStreamBuf(const Session& session,
+	const std::string& table,
+	const std::string& column,
+	Poco::Int64 rowID,
+	std::ios::openmode mode,
+	const std::string& database):
+	Poco::BufferedStreamBuf(STREAM_BUFFER_SIZE, mode),
+	_pDB(Utility::dbHandle(session)),
+	_pBlob(0),
+	_size(0),
+	_readPos(0),
+	_writePos(0)
+{
+	int rc = sqlite3_blob_open(_pDB, database.c_str(), table.c_str(), column.c_str(),
+		rowID, (mode & std::ios::out) ? 1 : 0, &_pBlob);
+	if (rc != SQLITE_OK)
+	{
+		_pBlob = 0;
+		Utility::throwException(_pDB, rc);
+	}
+
+	_size = sqlite3_blob_bytes(_pBlob);
+}
+
+
+BlobStreamBuf::~BlobStreamBuf()
+{
+	try
+	{
+		sync();
+	}
+	catch (...)
+	{
+	}
+
+	if (_pBlob) sqlite3_blob_close(_pBlob);
+}
+
+
+int BlobStreamBuf::readFromDevice(char* buffer, std::streamsize length)
+{
+	if (_readPos >= _size) return -1;
+
+	int n = static_cast<int>(length);
+	if (n > _size - _readPos) n = _size - _readPos;
+
+	int rc = sqlite3_blob_read(_pBlob, buffer, n, _readPos);
+	if (rc != SQLITE_OK) Utility::throwException(_pDB, rc);
+
+	_readPos += n;
+	return n;
+}
+
+
+int BlobStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
+{
+	int n = static_cast<int>(length);
+	if (n > _size - _writePos)
+		throw Poco::InvalidAccessException(
+			"BLOB size exceeded; incremental I/O can not change the size of a BLOB");
+
+	int rc = sqlite3_blob_write(_pBlob, buffer, n, _writePos);
+	if (rc != SQLITE_OK) Utility::throwException(_pDB, rc);
+
+	_writePos += n;
+	return n;
+}
+
+
+BlobIOS::BlobIOS(const Session& session,
+	const std::string& table,
+	const std::string& column,
+	Poco::Int64 rowID,
+	std::ios::openmode mode,
+	const std::string& database):
+	_buf(session, table, column, rowID, mode, database)
+{
+	poco_ios_init(&_buf);
+}
+
+
+BlobIOS::~BlobIOS()
+{
+}
+
+
+BlobInputStream::BlobInputStream(const Session& session,
+	const std::string& table,
+	const std::string& column,
+	Poco::Int64 rowID,
+	const std::string& database):
+	BlobIOS(session, table, column, rowID, std::ios::in, database),
+	std::istream(&_buf)
+{
+}
+
+
+BlobInputStream::~BlobInputStream()
+{
+}
+
+
+BlobOutputStream::BlobOutputStream(const Session& session,
+	const std::string& table,
+	const std::string& column,
+	Poco::Int64 rowID,
+	const std::string& database):
+	BlobIOS(session, table, column, rowID, std::ios::out, database),
+	std::ostream(&_buf)
+{
+}
+
+
+BlobOutputStream::~BlobOutputStream()
+{
+}
+
+
+} } } // namespace Poco::Data::SQLite
@@ -149,6 +149,23 @@ void SQLiteStatementImpl::compileImpl()
 }
 
 
+bool SQLiteStatementImpl::canReuse() const
+{
+	return _pStmt != 0 && _pLeftover.isNull() && !_canCompile && 1 == dataSetCount();
+}
+
+
+void SQLiteStatementImpl::reuseImpl()
+{
+	_bindBegin = bindings().begin();
+	_stepCalled = false;
+	_nextResponse = 0;
+	_canBind = false;
+	_isExtracted = false;
+	_affectedRowCount = POCO_SQLITE_INV_ROW_CNT;
+}
+
+
 void SQLiteStatementImpl::bindImpl()
 {
 	_stepCalled = false;
@@ -157,6 +174,12 @@ void SQLiteStatementImpl::bindImpl()
 
 	sqlite3_reset(_pStmt);
 
+	if (!bindings().empty() && bindings().front()->isBulk())
+	{
+		bindBulk();
+		return;
+	}
+
 	int paramCount = sqlite3_bind_parameter_count(_pStmt);
 	if (0 == paramCount)
 	{
@@ -227,6 +250,70 @@ void SQLiteStatementImpl::clear()
 }
 
 
+void SQLiteStatementImpl::bindBulk()
+{
+	_canBind = false;
+
+	Bindings& binds = bindings();
+	int paramCount = sqlite3_bind_parameter_count(_pStmt);
+	std::size_t availableCount = 0;
+	for (BindIt it = binds.begin(); it != binds.end(); ++it)
+		availableCount += (*it)->numOfColumnsHandled();
+
+	if (availableCount != static_cast<std::size_t>(paramCount))
+		throw ParameterCountMismatchException();
+
+	_pBinder->reset();
+	std::size_t pos = 1;
+	for (BindIt it = binds.begin(); it != binds.end(); ++it)
+	{
+		(*it)->bind(pos);
+		pos += (*it)->numOfColumnsHandled();
+	}
+
+	std::size_t rows = _pBinder->bulkSize();
+
+	bool autoCommit = (0 != sqlite3_get_autocommit(_pDB));
+	if (autoCommit)
+	{
+		int rc = sqlite3_exec(_pDB, "BEGIN", NULL, NULL, NULL);
+		if (rc != SQLITE_OK) Utility::throwException(_pDB, rc);
+	}
+
+	if (_affectedRowCount == POCO_SQLITE_INV_ROW_CNT) _affectedRowCount = 0;
+	try
+	{
+		for (std::size_t row = 0; row < rows; ++row)
+		{
+			_pBinder->bindBulkRow(row);
+			int rc = sqlite3_step(_pStmt);
+			if (SQLITE_ROW == rc)
+				throw Poco::InvalidAccessException("Bulk binding is only supported for statements returning no data");
+			if (rc != SQLITE_DONE)
+				Utility::throwException(_pDB, rc);
+			_affectedRowCount += sqlite3_changes(_pDB);
+			sqlite3_reset(_pStmt);
+		}
+	}
+	catch (...)
+	{
+		_pBinder->reset();
+		if (autoCommit) sqlite3_exec(_pDB, "ROLLBACK", NULL, NULL, NULL);
+		throw;
+	}
+	_pBinder->reset();
+
+	if (autoCommit)
+	{
+		int rc = sqlite3_exec(_pDB, "COMMIT", NULL, NULL, NULL);
+		if (rc != SQLITE_OK) Utility::throwException(_pDB, rc);
+	}
+
+	_stepCalled = true;
+	_nextResponse = SQLITE_DONE;
+}
+
+
 bool SQLiteStatementImpl::hasNext()
 {
 	if (_stepCalled)
@@ -19,6 +19,7 @@
 #include "Poco/Data/Session.h"
 #include "Poco/Stopwatch.h"
 #include "Poco/String.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/Mutex.h"
 #include "Poco/Data/DataException.h"
 #if defined(POCO_UNBUNDLED)
@@ -54,10 +55,17 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 	open();
 	setConnectionTimeout(loginTimeout);
 	setProperty("handle", _pDB);
-	addFeature("autoCommit", 
+	setFeature("bulk", true);
+	addFeature("autoCommit",
 		&SessionImpl::autoCommit, 
 		&SessionImpl::isAutoCommit);
 	addProperty("connectionTimeout", &SessionImpl::setConnectionTimeout, &SessionImpl::getConnectionTimeout);
+	addProperty("journalMode", &SessionImpl::setJournalMode, &SessionImpl::getJournalMode);
+	addProperty("synchronous", &SessionImpl::setSynchronousLevel, &SessionImpl::getSynchronousLevel);
+	addProperty("mmapSize", &SessionImpl::setMMapSize, &SessionImpl::getMMapSize);
+	addProperty("cacheSize", &SessionImpl::setCacheSize, &SessionImpl::getCacheSize);
+	addProperty("walAutoCheckpoint", &SessionImpl::setWALAutoCheckpoint, &SessionImpl::getWALAutoCheckpoint);
+	addFeature("snapshotRead", &SessionImpl::setSnapshotRead, &SessionImpl::getSnapshotRead);
 }
 
 
@@ -182,6 +190,7 @@ void SessionImpl::close()
 {
 	if (_pDB)
 	{
+		statementCache().clear();
 		sqlite3_close(_pDB);
 		_pDB = 0;
 	}
@@ -217,6 +226,210 @@ Poco::Any SessionImpl::getConnectionTimeout(const std::string& prop)
 }
 
 
+void SessionImpl::execPragma(const std::string& pragma)
+{
+	poco_check_ptr (_pDB);
+	char* pErrMsg = 0;
+	int rc = sqlite3_exec(_pDB, pragma.c_str(), 0, 0, &pErrMsg);
+	if (rc != SQLITE_OK)
+	{
+		std::string errMsg = pErrMsg ? pErrMsg : std::string();
+		if (pErrMsg) sqlite3_free(pErrMsg);
+		Utility::throwException(_pDB, rc, errMsg);
+	}
+}
+
+
+std::string SessionImpl::pragmaText(const std::string& pragma)
+{
+	poco_check_ptr (_pDB);
+	sqlite3_stmt* pStmt = 0;
+	int rc = sqlite3_prepare_v2(_pDB, pragma.c_str(), -1, &pStmt, 0);
+	if (rc != SQLITE_OK)
+	{
+		if (pStmt) sqlite3_finalize(pStmt);
+		Utility::throwException(_pDB, rc);
+	}
+
+	std::string result;
+	if (SQLITE_ROW == sqlite3_step(pStmt))
+	{
+		const char* pText = reinterpret_cast<const char*>(sqlite3_column_text(pStmt, 0));
+		if (pText) result = pText;
+	}
+	sqlite3_finalize(pStmt);
+	return result;
+}
+
+
+Poco::Int64 SessionImpl::pragmaValue(const std::string& pragma)
+{
+	poco_check_ptr (_pDB);
+	sqlite3_stmt* pStmt = 0;
+	int rc = sqlite3_prepare_v2(_pDB, pragma.c_str(), -1, &pStmt, 0);
+	if (rc != SQLITE_OK)
+	{
+		if (pStmt) sqlite3_finalize(pStmt);
+		Utility::throwException(_pDB, rc);
+	}
+
+	Poco::Int64 result = 0;
+	if (SQLITE_ROW == sqlite3_step(pStmt))
+		result = sqlite3_column_int64(pStmt, 0);
+	sqlite3_finalize(pStmt);
+	return result;
+}
+
+
+void SessionImpl::setJournalMode(const std::string& mode)
+{
+	std::string result = pragmaText("PRAGMA journal_mode=" + mode);
+	if (0 != icompare(result, mode))
+		throw InvalidArgumentException("setJournalMode(): database refused journal mode " + mode);
+}
+
+
+std::string SessionImpl::getJournalMode()
+{
+	return pragmaText("PRAGMA journal_mode");
+}
+
+
+void SessionImpl::setSynchronousLevel(const std::string& level)
+{
+	if (0 != icompare(level, "off") &&
+		0 != icompare(level, "normal") &&
+		0 != icompare(level, "full") &&
+		0 != icompare(level, "extra"))
+		throw InvalidArgumentException("setSynchronousLevel(): unknown level " + level);
+
+	execPragma("PRAGMA synchronous=" + level);
+}
+
+
+std::string SessionImpl::getSynchronousLevel()
+{
+	static const char* levels[] = { "off", "normal", "full", "extra" };
+	Poco::Int64 level = pragmaValue("PRAGMA synchronous");
+	poco_assert (level >= 0 && level < 4);
+	return levels[level];
+}
+
+
+void SessionImpl::setMMapSize(Poco::Int64 size)
+{
+	execPragma("PRAGMA mmap_size=" + Poco::NumberFormatter::format(size));
+}
+
+
+Poco::Int64 SessionImpl::getMMapSize()
+{
+	return pragmaValue("PRAGMA mmap_size");
+}
+
+
+void SessionImpl::setCacheSize(int size)
+{
+	execPragma("PRAGMA cache_size=" + Poco::NumberFormatter::format(size));
+}
+
+
+int SessionImpl::getCacheSize()
+{
+	return static_cast<int>(pragmaValue("PRAGMA cache_size"));
+}
+
+
+void SessionImpl::setWALAutoCheckpoint(int pages)
+{
+	execPragma("PRAGMA wal_autocheckpoint=" + Poco::NumberFormatter::format(pages));
+}
+
+
+int SessionImpl::getWALAutoCheckpoint()
+{
+	return static_cast<int>(pragmaValue("PRAGMA wal_autocheckpoint"));
+}
+
+
+void SessionImpl::setSnapshotRead(const std::string&, bool enable)
+{
+	if (enable)
+	{
+		setJournalMode("wal");
+		execPragma("PRAGMA query_only=1");
+	}
+	else execPragma("PRAGMA query_only=0");
+}
+
+
+bool SessionImpl::getSnapshotRead(const std::string&)
+{
+	return 0 != pragmaValue("PRAGMA query_only") &&
+		0 == icompare(getJournalMode(), "wal");
+}
+
+
+void SessionImpl::setJournalMode(const std::string&, const Poco::Any& value)
+{
+	setJournalMode(Poco::RefAnyCast<std::string>(value));
+}
+
+
+Poco::Any SessionImpl::getJournalMode(const std::string&)
+{
+	return Poco::Any(getJournalMode());
+}
+
+
+void SessionImpl::setSynchronousLevel(const std::string&, const Poco::Any& value)
+{
+	setSynchronousLevel(Poco::RefAnyCast<std::string>(value));
+}
+
+
+Poco::Any SessionImpl::getSynchronousLevel(const std::string&)
+{
+	return Poco::Any(getSynchronousLevel());
+}
+
+
+void SessionImpl::setMMapSize(const std::string&, const Poco::Any& value)
+{
+	setMMapSize(Poco::RefAnyCast<Poco::Int64>(value));
+}
+
+
+Poco::Any SessionImpl::getMMapSize(const std::string&)
+{
+	return Poco::Any(getMMapSize());
+}
+
+
+void SessionImpl::setCacheSize(const std::string&, const Poco::Any& value)
+{
+	setCacheSize(Poco::RefAnyCast<int>(value));
+}
+
+
+Poco::Any SessionImpl::getCacheSize(const std::string&)
+{
+	return Poco::Any(getCacheSize());
+}
+
+
+void SessionImpl::setWALAutoCheckpoint(const std::string&, const Poco::Any& value)
+{
+	setWALAutoCheckpoint(Poco::RefAnyCast<int>(value));
+}
+
+
+Poco::Any SessionImpl::getWALAutoCheckpoint(const std::string&)
+{
+	return Poco::Any(getWALAutoCheckpoint());
+}
+
+
 void SessionImpl::autoCommit(const std::string&, bool)
 {
 	// The problem here is to decide whether to call commit or rollback
@@ -15,11 +15,14 @@
 #include "Poco/Data/Time.h"
 #include "Poco/Data/LOB.h"
 #include "Poco/Data/Statement.h"
+#include "Poco/Data/StatementCache.h"
 #include "Poco/Data/RecordSet.h"
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/SQLite/Connector.h"
+#include "Poco/Data/BulkBinding.h"
 #include "Poco/Data/SQLite/Utility.h"
+#include "Poco/Data/SQLite/BlobStream.h"
 #include "Poco/Data/SQLite/Notifier.h"
 #include "Poco/Data/SQLite/Connector.h"
 #include "Poco/Dynamic/Var.h"
@@ -28,6 +31,7 @@
 #include "Poco/Data/Transaction.h"
 #include "Poco/Data/DataException.h"
 #include "Poco/Data/SQLite/SQLiteException.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/Tuple.h"
 #include "Poco/Any.h"
 #include "Poco/SharedPtr.h"
@@ -40,6 +44,7 @@
 #include "Poco/Exception.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/Stopwatch.h"
+#include "Poco/StreamCopier.h"
 #include "Poco/Delegate.h"
 #include <iostream>
 
@@ -59,6 +64,7 @@ using Poco::Data::Transaction;
 using Poco::Data::AbstractExtractionVec;
 using Poco::Data::AbstractExtractionVecVec;
 using Poco::Data::AbstractBindingVec;
+using Poco::Data::BindingException;
 using Poco::Data::NotConnectedException;
 using Poco::Data::SQLite::Notifier;
 using Poco::Nullable;
@@ -73,6 +79,7 @@ using Poco::AutoPtr;
 using Poco::Thread;
 using Poco::format;
 using Poco::InvalidAccessException;
+using Poco::IllegalStateException;
 using Poco::RangeException;
 using Poco::BadCastException;
 using Poco::NotFoundException;
@@ -81,6 +88,8 @@ using Poco::TimeoutException;
 using Poco::NotImplementedException;
 using Poco::Data::SQLite::ConstraintViolationException;
 using Poco::Data::SQLite::ParameterCountMismatchException;
+using Poco::Data::SQLite::ReadOnlyException;
+using Poco::InvalidArgumentException;
 using Poco::Int32;
 using Poco::Int64;
 using Poco::Dynamic::Var;
@@ -341,6 +350,54 @@ void SQLiteTest::testSimpleAccess()
 }
 
 
+void SQLiteTest::testStatementCache()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	Poco::Data::StatementCache& cache = tmp.impl()->statementCache();
+
+	tmp << "DROP TABLE IF EXISTS Person", now;
+	tmp << "CREATE TABLE IF NOT EXISTS Person (LastName VARCHAR(30), FirstName VARCHAR, Address VARCHAR, Age INTEGER(3))", now;
+
+	tmp.setProperty("statementCacheSize", std::size_t(10));
+
+	std::string lastName("lastname");
+	std::string firstName("firstname");
+	std::string address("Address");
+	for (int i = 0; i < 10; ++i)
+	{
+		tmp << "INSERT INTO PERSON VALUES(:ln, :fn, :ad, :age)",
+			use(lastName), use(firstName), use(address), use(i), now;
+	}
+	assert (9 == cache.hits());
+
+	int count = 0;
+	tmp << "SELECT COUNT(*) FROM PERSON", into(count), now;
+	assert (10 == count);
+
+	int age = -1;
+	for (int i = 0; i < 10; ++i)
+	{
+		tmp << "SELECT Age FROM PERSON WHERE Age = ?", use(i), into(age), now;
+		assert (age == i);
+	}
+	assert (18 == cache.hits());
+
+	// internal extraction (RecordSet) over a cached statement
+	for (int i = 0; i < 2; ++i)
+	{
+		Statement stmt = (tmp << "SELECT * FROM PERSON", now);
+		RecordSet rset(stmt);
+		assert (4 == rset.columnCount());
+		assert (10 == rset.rowCount());
+	}
+
+	tmp.setProperty("statementCacheSize", std::size_t(0));
+	assert (0 == cache.size());
+	tmp.close();
+	assert (!tmp.isConnected());
+}
+
+
 void SQLiteTest::testInMemory()
 {
 	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -1417,6 +1474,52 @@ void SQLiteTest::testCLOB()
 }
 
 
+void SQLiteTest::testBlobStream()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS BlobStreamTest", now;
+	tmp << "CREATE TABLE BlobStreamTest (idx INTEGER, Image BLOB)", now;
+
+	std::string data;
+	data.reserve(100000);
+	for (int i = 0; i < 100000; ++i)
+		data += (char) (0x20 + (i % 0x5F));
+
+	// the BLOB must have its final size up front; incremental I/O
+	// can not grow it
+	int idx = 1;
+	int size = (int) data.size();
+	tmp << "INSERT INTO BlobStreamTest VALUES (?, zeroblob(?))", use(idx), use(size), now;
+	Poco::Int64 rowID = 0;
+	tmp << "SELECT last_insert_rowid()", into(rowID), now;
+
+	{
+		Poco::Data::SQLite::BlobOutputStream bos(tmp, "BlobStreamTest", "Image", rowID);
+		assert (bos.rdbuf()->size() == data.size());
+		bos.write(data.data(), (std::streamsize) data.size());
+		assert (bos.good());
+	}
+
+	Poco::Data::SQLite::BlobInputStream bis(tmp, "BlobStreamTest", "Image", rowID);
+	assert (bis.rdbuf()->size() == data.size());
+	std::string read;
+	Poco::StreamCopier::copyToString(bis, read);
+	assert (read == data);
+
+	Poco::Data::BLOB img;
+	tmp << "SELECT Image FROM BlobStreamTest WHERE idx = ?", use(idx), into(img), now;
+	assert (img.size() == data.size());
+	assert (std::string(img.begin(), img.end()) == data);
+
+	// writing past the end of the BLOB puts the stream into the bad state
+	Poco::Data::SQLite::BlobOutputStream bos(tmp, "BlobStreamTest", "Image", rowID);
+	std::string tooBig(data.size() + 1, 'x');
+	bos.write(tooBig.data(), (std::streamsize) tooBig.size());
+	bos.flush();
+	assert (!bos.good());
+}
+
+
 void SQLiteTest::testTuple10()
 {
 	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -1981,6 +2084,209 @@ void SQLiteTest::testInternalExtraction()
 }
 
 
+void SQLiteTest::testColumnarAccess()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS Vectors", now;
+	tmp << "CREATE TABLE Vectors (int0 INTEGER, flt0 REAL, str0 VARCHAR)", now;
+
+	std::vector<Tuple<int, double, std::string> > v;
+	v.push_back(Tuple<int, double, std::string>(1, 1.5, "3"));
+	v.push_back(Tuple<int, double, std::string>(2, 2.5, "4"));
+	v.push_back(Tuple<int, double, std::string>(3, 3.5, "5"));
+
+	tmp << "INSERT INTO Vectors VALUES (?,?,?)", use(v), now;
+
+	Statement stmt = (tmp << "SELECT * FROM Vectors");
+	stmt.setStorage("vector");
+	stmt.execute();
+	RecordSet rset(stmt);
+	assert (3 == rset.columnCount());
+	assert (3 == rset.rowCount());
+
+	const std::vector<Int64>& ints = rset.columnData<Int64>(0);
+	assert (3 == ints.size());
+	assert (1 == ints[0] && 2 == ints[1] && 3 == ints[2]);
+
+	const std::vector<double>& flts = rset.columnData<double>("flt0");
+	assert (3 == flts.size());
+	assert (1.5 == flts[0] && 2.5 == flts[1] && 3.5 == flts[2]);
+
+	std::vector<std::string> strings;
+	rset.moveColumn(2, strings);
+	assert (3 == strings.size());
+	assert ("3" == strings[0] && "4" == strings[1] && "5" == strings[2]);
+	assert (0 == rset.columnData<std::string>(2).size());
+
+	// columnar access requires vector storage
+	Statement stmt2 = (tmp << "SELECT * FROM Vectors", now);
+	RecordSet rset2(stmt2);
+	try { rset2.columnData<Int64>(0); fail ("must fail"); }
+	catch (IllegalStateException&) { }
+}
+
+
+void SQLiteTest::testBulkBinding()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	assert (tmp.getFeature("bulk"));
+
+	tmp << "DROP TABLE IF EXISTS BulkTest", now;
+	tmp << "CREATE TABLE BulkTest (int0 INTEGER, flt0 REAL, str0 VARCHAR)", now;
+
+	const int size = 1000;
+	std::vector<int> ints(size, 0);
+	std::vector<double> floats(size, 0.0);
+	std::vector<std::string> strings(size);
+	for (int i = 0; i < size; ++i)
+	{
+		ints[i] = i;
+		floats[i] = i + .5;
+		strings[i] = Poco::NumberFormatter::format(i);
+	}
+
+	Statement stmt = (tmp << "INSERT INTO BulkTest VALUES (?,?,?)",
+		use(ints, bulk), use(floats, bulk), use(strings, bulk));
+	std::size_t rows = stmt.execute();
+	assert (size == rows);
+
+	int count = 0;
+	tmp << "SELECT COUNT(*) FROM BulkTest", into(count), now;
+	assert (size == count);
+
+	std::vector<Int64> intsOut;
+	std::vector<double> floatsOut;
+	tmp << "SELECT int0, flt0 FROM BulkTest ORDER BY int0", into(intsOut), into(floatsOut), now;
+	assert (size == intsOut.size());
+	for (int i = 0; i < size; ++i)
+	{
+		assert (i == intsOut[i]);
+		assert (i + .5 == floatsOut[i]);
+	}
+
+	std::string str;
+	tmp << "SELECT str0 FROM BulkTest WHERE int0 = 123", into(str), now;
+	assert ("123" == str);
+
+	// all bulk bound containers must have the same size
+	std::vector<int> shortInts(size - 1, 0);
+	try
+	{
+		tmp << "INSERT INTO BulkTest VALUES (?,?,?)",
+			use(shortInts, bulk), use(floats, bulk), use(strings, bulk), now;
+		fail ("must fail");
+	}
+	catch (BindingException&) { }
+
+	tmp << "SELECT COUNT(*) FROM BulkTest", into(count), now;
+	assert (size == count);
+}
+
+
+void SQLiteTest::testBatchFetching()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS BatchTest", now;
+	tmp << "CREATE TABLE BatchTest (int0 INTEGER)", now;
+
+	const int size = 100;
+	std::vector<int> ints(size, 0);
+	for (int i = 0; i < size; ++i) ints[i] = i;
+	tmp << "INSERT INTO BatchTest VALUES (?)", use(ints), now;
+
+	// synchronous batch fetching
+	Statement stmt = (tmp << "SELECT int0 FROM BatchTest ORDER BY int0", limit(25));
+	std::size_t total = stmt.execute();
+	RecordSet rset(stmt);
+	int batches = 1;
+	while (rset.hasMoreBatches())
+	{
+		std::size_t rows = rset.fetchNextBatch();
+		total += rows;
+		if (rows) ++batches;
+	}
+	assert (4 == batches);
+	assert (size == total);
+	assert (0 == rset.fetchNextBatch());
+
+	// pipelined batch fetching: the next batch is fetched while the
+	// previous one, moved out of the record set, is being processed
+	Statement stmt2 = (tmp << "SELECT int0 FROM BatchTest ORDER BY int0", limit(25));
+	stmt2.setStorage("vector");
+	stmt2.execute();
+	RecordSet rset2(stmt2);
+	std::vector<Int64> batch;
+	int next = 0;
+	for (;;)
+	{
+		rset2.moveColumn(0, batch);
+		bool more = rset2.prefetchNextBatch();
+		for (std::size_t i = 0; i < batch.size(); ++i)
+			assert (next++ == batch[i]);
+		if (!more) break;
+		rset2.waitForNextBatch();
+	}
+	assert (size == next);
+}
+
+
+void SQLiteTest::testTuning()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+
+	tmp.setProperty("journalMode", std::string("wal"));
+	assert ("wal" == AnyCast<std::string>(tmp.getProperty("journalMode")));
+
+	tmp.setProperty("synchronous", std::string("normal"));
+	assert ("normal" == AnyCast<std::string>(tmp.getProperty("synchronous")));
+
+	tmp.setProperty("mmapSize", Poco::Int64(1048576));
+	assert (1048576 == AnyCast<Poco::Int64>(tmp.getProperty("mmapSize")));
+
+	tmp.setProperty("cacheSize", -2000);
+	assert (-2000 == AnyCast<int>(tmp.getProperty("cacheSize")));
+
+	tmp.setProperty("walAutoCheckpoint", 512);
+	assert (512 == AnyCast<int>(tmp.getProperty("walAutoCheckpoint")));
+
+	try { tmp.setProperty("journalMode", std::string("bogus")); fail ("must fail"); }
+	catch (InvalidArgumentException&) { }
+
+	try { tmp.setProperty("synchronous", std::string("bogus")); fail ("must fail"); }
+	catch (InvalidArgumentException&) { }
+
+	tmp << "DROP TABLE IF EXISTS SnapshotTest", now;
+	tmp << "CREATE TABLE SnapshotTest (int0 INTEGER)", now;
+	tmp << "INSERT INTO SnapshotTest VALUES (42)", now;
+
+	{
+		Session reader (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+		reader.setFeature("snapshotRead", true);
+		assert (reader.getFeature("snapshotRead"));
+
+		int i = 0;
+		reader << "SELECT int0 FROM SnapshotTest", into(i), now;
+		assert (42 == i);
+
+		// snapshot-read sessions are read-only
+		try { reader << "INSERT INTO SnapshotTest VALUES (43)", now; fail ("must fail"); }
+		catch (ReadOnlyException&) { }
+
+		reader.setFeature("snapshotRead", false);
+		assert (!reader.getFeature("snapshotRead"));
+		reader << "INSERT INTO SnapshotTest VALUES (43)", now;
+	}
+
+	int count = 0;
+	tmp << "SELECT COUNT(*) FROM SnapshotTest", into(count), now;
+	assert (2 == count);
+
+	// restore the default journal mode for the remaining tests
+	tmp.setProperty("journalMode", std::string("delete"));
+	assert ("delete" == AnyCast<std::string>(tmp.getProperty("journalMode")));
+}
+
+
 void SQLiteTest::testPrimaryKeyConstraint()
 {
 	Session ses (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -2423,6 +2729,59 @@ void SQLiteTest::testSQLChannel()
 }
 
 
+void SQLiteTest::testSQLChannelBatch()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS T_POCO_LOG", now;
+	tmp << "CREATE TABLE T_POCO_LOG (Source VARCHAR,"
+		"Name VARCHAR,"
+		"ProcessId INTEGER,"
+		"Thread VARCHAR, "
+		"ThreadId INTEGER,"
+		"Priority INTEGER,"
+		"Text VARCHAR,"
+		"DateTime DATE)", now;
+
+	AutoPtr<SQLChannel> pChannel = new SQLChannel(Poco::Data::SQLite::Connector::KEY, "dummy.db", "TestSQLChannelBatch");
+	pChannel->setProperty("batch", "4");
+	pChannel->setProperty("flush", "0");
+
+	for (int i = 0; i < 4; ++i)
+	{
+		Message msg("BatchSource", "batch message " + Poco::NumberFormatter::format(i), Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+	}
+
+	int count = 0;
+	for (int i = 0; i < 100 && count < 4; ++i)
+	{
+		tmp << "SELECT COUNT(*) FROM T_POCO_LOG", into(count), now;
+		if (count < 4) Thread::sleep(100);
+	}
+	assert (4 == count);
+
+	// a partial batch is flushed when batching is turned off
+	Message msgPart("BatchSource", "partial batch message", Message::PRIO_INFORMATION);
+	pChannel->log(msgPart);
+	pChannel->setProperty("batch", "0");
+	tmp << "SELECT COUNT(*) FROM T_POCO_LOG", into(count), now;
+	assert (5 == count);
+	assert (0 == pChannel->dropped());
+
+	// messages beyond maxQueue are dropped and counted
+	pChannel->setProperty("maxQueue", "2");
+	pChannel->setProperty("batch", "10");
+	for (int i = 0; i < 5; ++i)
+	{
+		Message msg("BatchSource", "overflow message", Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+	}
+	assert (3 == pChannel->dropped());
+	assert ("3" == pChannel->getProperty("dropped"));
+	pChannel->setProperty("batch", "0");
+}
+
+
 void SQLiteTest::testSQLLogger()
 {
 	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -3379,6 +3738,7 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testBinding);
 	CppUnit_addTest(pSuite, SQLiteTest, testZeroRows);
 	CppUnit_addTest(pSuite, SQLiteTest, testSimpleAccess);
+	CppUnit_addTest(pSuite, SQLiteTest, testStatementCache);
 	CppUnit_addTest(pSuite, SQLiteTest, testInMemory);
 	CppUnit_addTest(pSuite, SQLiteTest, testNullCharPointer);
 	CppUnit_addTest(pSuite, SQLiteTest, testInsertCharPointer);
@@ -3417,6 +3777,7 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testSingleSelect);
 	CppUnit_addTest(pSuite, SQLiteTest, testEmptyDB);
 	CppUnit_addTest(pSuite, SQLiteTest, testCLOB);
+	CppUnit_addTest(pSuite, SQLiteTest, testBlobStream);
 	CppUnit_addTest(pSuite, SQLiteTest, testTuple10);
 	CppUnit_addTest(pSuite, SQLiteTest, testTupleVector10);
 	CppUnit_addTest(pSuite, SQLiteTest, testTuple9);
@@ -3439,6 +3800,10 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testTupleVector1);
 	CppUnit_addTest(pSuite, SQLiteTest, testDateTime);
 	CppUnit_addTest(pSuite, SQLiteTest, testInternalExtraction);
+	CppUnit_addTest(pSuite, SQLiteTest, testColumnarAccess);
+	CppUnit_addTest(pSuite, SQLiteTest, testBulkBinding);
+	CppUnit_addTest(pSuite, SQLiteTest, testBatchFetching);
+	CppUnit_addTest(pSuite, SQLiteTest, testTuning);
 	CppUnit_addTest(pSuite, SQLiteTest, testPrimaryKeyConstraint);
 	CppUnit_addTest(pSuite, SQLiteTest, testNullable);
 	CppUnit_addTest(pSuite, SQLiteTest, testNulls);
@@ -3447,6 +3812,7 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testAny);
 	CppUnit_addTest(pSuite, SQLiteTest, testDynamicAny);
 	CppUnit_addTest(pSuite, SQLiteTest, testSQLChannel);
+	CppUnit_addTest(pSuite, SQLiteTest, testSQLChannelBatch);
 	CppUnit_addTest(pSuite, SQLiteTest, testSQLLogger);
 	CppUnit_addTest(pSuite, SQLiteTest, testExternalBindingAndExtraction);
 	CppUnit_addTest(pSuite, SQLiteTest, testBindingCount);
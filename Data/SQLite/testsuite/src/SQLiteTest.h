@@ -35,6 +35,7 @@ public:
 	void testBinding();
 	void testZeroRows();
 	void testSimpleAccess();
+	void testStatementCache();
 	void testInMemory();
 	void testNullCharPointer();
 	void testInsertCharPointer();
@@ -76,6 +77,7 @@ public:
 	void testEmptyDB();
 
 	void testCLOB();
+	void testBlobStream();
 
 	void testTuple1();
 	void testTupleVector1();
@@ -101,6 +103,10 @@ public:
 	void testDateTime();
 
 	void testInternalExtraction();
+	void testColumnarAccess();
+	void testBulkBinding();
+	void testBatchFetching();
+	void testTuning();
 	void testPrimaryKeyConstraint();
 	void testNullable();
 	void testNulls();
@@ -112,6 +118,7 @@ public:
 	void testPair();
 
 	void testSQLChannel();
+	void testSQLChannelBatch();
 	void testSQLLogger();
 
 	void testExternalBindingAndExtraction();
@@ -0,0 +1,46 @@
+//
+// Benchmark.h
+//
+// Definition of the Benchmark class.
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Benchmark_INCLUDED
+#define Benchmark_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+
+
+class Benchmark
+	/// The timing harness for the Data benchmarks.
+	///
+	/// A benchmark is a function performing a given number of
+	/// database operations (rows inserted, rows extracted,
+	/// statements executed, sessions checked out). The harness
+	/// times the function and reports operations per second,
+	/// together with the heap allocations per operation (counted
+	/// via the overridden global operator new; approximate if
+	/// other threads allocate concurrently).
+{
+public:
+	typedef void (*Function)(int iterations);
+
+	static void run(const std::string& name, Function function, int iterations);
+		/// Runs the given benchmark function with the given number
+		/// of operations and prints name, operations per second
+		/// and heap allocations per operation.
+
+	static Poco::Int64 allocations();
+		/// Returns the number of heap allocations made by the
+		/// process so far.
+};
+
+
+#endif // Benchmark_INCLUDED
@@ -0,0 +1,39 @@
+//
+// BenchmarkDriver.cpp
+//
+// Console application entry point for the Data benchmarks.
+//
+// All benchmarks run against the SQLite in-memory backend, so the
+// numbers measure binding, extraction and statement dispatch overhead
+// without any network or disk I/O.
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Poco/Data/SQLite/Connector.h"
+#include <iostream>
+
+
+int main(int argc, char** argv)
+{
+	Poco::Data::SQLite::Connector::registerConnector();
+	try
+	{
+		benchmarkInsert();
+		benchmarkExtraction();
+		benchmarkStatementReuse();
+		benchmarkSessionPool();
+	}
+	catch (std::exception& exc)
+	{
+		std::cerr << exc.what() << std::endl;
+		return 1;
+	}
+	Poco::Data::SQLite::Connector::unregisterConnector();
+	return 0;
+}
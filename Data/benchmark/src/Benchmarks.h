@@ -0,0 +1,23 @@
+//
+// Benchmarks.h
+//
+// Declarations of the individual benchmark groups.
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Benchmarks_INCLUDED
+#define Benchmarks_INCLUDED
+
+
+void benchmarkInsert();
+void benchmarkExtraction();
+void benchmarkStatementReuse();
+void benchmarkSessionPool();
+
+
+#endif // Benchmarks_INCLUDED
@@ -0,0 +1,91 @@
+//
+// ExtractionBenchmark.cpp
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/Statement.h"
+#include "Poco/Data/RecordSet.h"
+#include <vector>
+
+
+using namespace Poco::Data::Keywords;
+using Poco::Data::Session;
+using Poco::Data::Statement;
+using Poco::Data::RecordSet;
+
+
+namespace
+{
+	enum
+	{
+		ROWS = 1000
+	};
+
+	Session* pSession(0);
+
+	void recordSetIteration(int iterations)
+	{
+		int passes = iterations/ROWS;
+		double total = 0;
+		for (int pass = 0; pass < passes; pass++)
+		{
+			Statement select(*pSession);
+			select << "SELECT Name, Age, Score FROM Person", now;
+			RecordSet rs(select);
+			bool more = rs.moveFirst();
+			while (more)
+			{
+				std::string name = rs[0].convert<std::string>();
+				total += rs[1].convert<int>();
+				total += rs[2].convert<double>();
+				more = rs.moveNext();
+			}
+		}
+		poco_assert_dbg (total != 1);
+	}
+
+	void columnarExtraction(int iterations)
+	{
+		int passes = iterations/ROWS;
+		double total = 0;
+		for (int pass = 0; pass < passes; pass++)
+		{
+			std::vector<std::string> names;
+			std::vector<int> ages;
+			std::vector<double> scores;
+			*pSession << "SELECT Name, Age, Score FROM Person",
+				into(names), into(ages), into(scores), now;
+			for (std::size_t i = 0; i < ages.size(); i++)
+			{
+				total += ages[i];
+				total += scores[i];
+			}
+		}
+		poco_assert_dbg (total != 1);
+	}
+}
+
+
+void benchmarkExtraction()
+{
+	Session session("SQLite", ":memory:");
+	pSession = &session;
+
+	session << "CREATE TABLE Person (Name VARCHAR(30), Age INTEGER, Score REAL)", now;
+	std::vector<std::string> names(ROWS, "Jane Doe");
+	std::vector<int> ages(ROWS, 42);
+	std::vector<double> scores(ROWS, 1.5);
+	session << "INSERT INTO Person VALUES (?, ?, ?)", use(names), use(ages), use(scores), now;
+
+	Benchmark::run("extract (RecordSet iteration)", recordSetIteration, 500000);
+	Benchmark::run("extract (columnar, into vectors)", columnarExtraction, 500000);
+	pSession = 0;
+}
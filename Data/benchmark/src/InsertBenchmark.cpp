@@ -0,0 +1,63 @@
+//
+// InsertBenchmark.cpp
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Data/Session.h"
+#include <vector>
+
+
+using namespace Poco::Data::Keywords;
+using Poco::Data::Session;
+
+
+namespace
+{
+	Session* pSession(0);
+
+	void recreateTable()
+	{
+		*pSession << "DROP TABLE IF EXISTS Person", now;
+		*pSession << "CREATE TABLE Person (Name VARCHAR(30), Age INTEGER, Score REAL)", now;
+	}
+
+	void singleRowInsert(int iterations)
+	{
+		recreateTable();
+		std::string name("Jane Doe");
+		int age = 42;
+		double score = 1.5;
+		for (int i = 0; i < iterations; i++)
+		{
+			*pSession << "INSERT INTO Person VALUES (?, ?, ?)",
+				use(name), use(age), use(score), now;
+		}
+	}
+
+	void bulkInsert(int iterations)
+	{
+		recreateTable();
+		std::vector<std::string> names(iterations, "Jane Doe");
+		std::vector<int> ages(iterations, 42);
+		std::vector<double> scores(iterations, 1.5);
+		*pSession << "INSERT INTO Person VALUES (?, ?, ?)",
+			use(names), use(ages), use(scores), now;
+	}
+}
+
+
+void benchmarkInsert()
+{
+	Session session("SQLite", ":memory:");
+	pSession = &session;
+	Benchmark::run("insert (single row)", singleRowInsert, 20000);
+	Benchmark::run("insert (bulk, vector binding)", bulkInsert, 200000);
+	pSession = 0;
+}
@@ -0,0 +1,84 @@
+//
+// SessionPoolBenchmark.cpp
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Data/SessionPool.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+
+
+using Poco::Data::Session;
+using Poco::Data::SessionPool;
+using Poco::Thread;
+using Poco::Runnable;
+using Poco::SharedPtr;
+
+
+namespace
+{
+	enum
+	{
+		THREADS = 4
+	};
+
+	class CheckoutWorker: public Runnable
+		/// Repeatedly checks a session out of the shared pool and
+		/// returns it right away, so the pool mutex is contended
+		/// by all workers.
+	{
+	public:
+		CheckoutWorker(SessionPool& pool, int checkouts):
+			_pool(pool),
+			_checkouts(checkouts)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _checkouts; i++)
+			{
+				Session session = _pool.get();
+			}
+		}
+
+	private:
+		SessionPool& _pool;
+		int _checkouts;
+	};
+
+	void contendedCheckout(int iterations)
+	{
+		SessionPool pool("SQLite", ":memory:", 1, THREADS);
+		std::vector<SharedPtr<CheckoutWorker> > workers;
+		std::vector<SharedPtr<Thread> > threads;
+		for (int i = 0; i < THREADS; i++)
+		{
+			workers.push_back(new CheckoutWorker(pool, iterations/THREADS));
+			threads.push_back(new Thread);
+		}
+		for (int i = 0; i < THREADS; i++)
+		{
+			threads[i]->start(*workers[i]);
+		}
+		for (int i = 0; i < THREADS; i++)
+		{
+			threads[i]->join();
+		}
+	}
+}
+
+
+void benchmarkSessionPool()
+{
+	Benchmark::run("session pool checkout (4 threads)", contendedCheckout, 100000);
+}
@@ -0,0 +1,70 @@
+//
+// StatementBenchmark.cpp
+//
+// Copyright (c) 2006-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/Statement.h"
+#include <vector>
+
+
+using namespace Poco::Data::Keywords;
+using Poco::Data::Session;
+using Poco::Data::Statement;
+
+
+namespace
+{
+	Session* pSession(0);
+
+	void rePrepare(int iterations)
+	{
+		int count = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			int age = i % 100;
+			*pSession << "SELECT COUNT(*) FROM Person WHERE Age = ?",
+				use(age), into(count), now;
+		}
+		poco_assert_dbg (count >= 0);
+	}
+
+	void reuse(int iterations)
+	{
+		int age = 0;
+		int count = 0;
+		Statement select(*pSession);
+		select << "SELECT COUNT(*) FROM Person WHERE Age = ?",
+			use(age), into(count);
+		for (int i = 0; i < iterations; i++)
+		{
+			age = i % 100;
+			select.execute();
+		}
+		poco_assert_dbg (count >= 0);
+	}
+}
+
+
+void benchmarkStatementReuse()
+{
+	Session session("SQLite", ":memory:");
+	pSession = &session;
+
+	session << "CREATE TABLE Person (Name VARCHAR(30), Age INTEGER, Score REAL)", now;
+	std::vector<std::string> names(100, "Jane Doe");
+	std::vector<int> ages(100, 42);
+	std::vector<double> scores(100, 1.5);
+	session << "INSERT INTO Person VALUES (?, ?, ?)", use(names), use(ages), use(scores), now;
+
+	Benchmark::run("statement (re-prepare per query)", rePrepare, 20000);
+	Benchmark::run("statement (prepared once, reused)", reuse, 100000);
+	pSession = 0;
+}
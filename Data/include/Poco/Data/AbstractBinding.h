@@ -56,7 +56,7 @@ public:
 	void setBinder(BinderPtr pBinder);
 		/// Sets the object used for binding; object does NOT take ownership of the pointer.
 
-	BinderPtr getBinder() const;
+	const BinderPtr& getBinder() const;
 		/// Returns the AbstractBinder used for binding data.
 
 	virtual std::size_t numOfColumnsHandled() const = 0;
@@ -108,7 +108,7 @@ typedef std::list<AbstractBinding::Ptr>   AbstractBindingLst;
 //
 // inlines
 //
-inline AbstractBinder::Ptr AbstractBinding::getBinder() const
+inline const AbstractBinder::Ptr& AbstractBinding::getBinder() const
 {
 	return _pBinder;
 }
@@ -59,7 +59,7 @@ public:
 	void setExtractor(ExtractorPtr pExtractor);
 		/// Sets the class used for extracting the data. Does not take ownership of the pointer.
 
-	ExtractorPtr getExtractor() const;
+	const ExtractorPtr& getExtractor() const;
 		/// Retrieves the extractor object
 
 	Poco::UInt32 position() const;
@@ -189,7 +189,7 @@ inline void AbstractExtraction::setExtractor(ExtractorPtr pExtractor)
 }
 
 
-inline AbstractExtraction::ExtractorPtr AbstractExtraction::getExtractor() const
+inline const AbstractExtraction::ExtractorPtr& AbstractExtraction::getExtractor() const
 {
 	return _pExtractor;
 }
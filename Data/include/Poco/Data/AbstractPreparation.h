@@ -49,7 +49,7 @@ protected:
 	AbstractPreparation(const AbstractPreparation&);
 	AbstractPreparation& operator = (const AbstractPreparation&);
 
-	PreparatorPtr preparation();
+	PreparatorPtr& preparation();
 		/// Returns the preparation object
 
 	PreparatorPtr _pPreparator;
@@ -59,7 +59,7 @@ protected:
 //
 // inlines
 //
-inline AbstractPreparation::PreparatorPtr AbstractPreparation::preparation()
+inline AbstractPreparation::PreparatorPtr& AbstractPreparation::preparation()
 {
 	return _pPreparator;
 }
@@ -88,6 +88,12 @@ public:
 		/// While these features can not both be true at the same time, they can both be false,
 		/// resulting in default underlying database behavior.
 		///
+		/// Adds "statementCacheSize" property and sets it to zero (caching disabled).
+		/// Setting this property to a nonzero value enables the session's prepared
+		/// statement cache with the given capacity; statements whose implementation
+		/// supports reuse are then transparently reused for repeated executions of
+		/// the same SQL text. See StatementCache for details.
+		///
 	{
 		addProperty("storage", 
 			&AbstractSessionImpl<C>::setStorage, 
@@ -105,9 +111,13 @@ public:
 			&AbstractSessionImpl<C>::setEmptyStringIsNull,
 			&AbstractSessionImpl<C>::getEmptyStringIsNull);
 
-		addFeature("forceEmptyString", 
+		addFeature("forceEmptyString",
 			&AbstractSessionImpl<C>::setForceEmptyString,
 			&AbstractSessionImpl<C>::getForceEmptyString);
+
+		addProperty("statementCacheSize",
+			&AbstractSessionImpl<C>::setStatementCacheSize,
+			&AbstractSessionImpl<C>::getStatementCacheSize);
 	}
 
 	~AbstractSessionImpl()
@@ -258,6 +268,19 @@ public:
 		return _forceEmptyString;
 	}
 
+	void setStatementCacheSize(const std::string& name, const Poco::Any& value)
+		/// Sets the capacity of the session's prepared statement cache.
+		/// A capacity of zero (the default) disables statement caching.
+	{
+		statementCache().setCapacity(Poco::AnyCast<std::size_t>(value));
+	}
+
+	Poco::Any getStatementCacheSize(const std::string& name="")
+		/// Returns the capacity of the session's prepared statement cache.
+	{
+		return statementCache().getCapacity();
+	}
+
 protected:
 	void addFeature(const std::string& name, FeatureSetter setter, FeatureGetter getter)
 		/// Adds a feature to the map of supported features.
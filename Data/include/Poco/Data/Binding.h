@@ -90,7 +90,8 @@ public:
 	void bind(std::size_t pos)
 	{
 		poco_assert_dbg(!getBinder().isNull());
-		TypeHandler<T>::bind(pos, _val, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, _val, pBinder, getDirection());
 		_bound = true;
 	}
 
@@ -160,7 +161,8 @@ public:
 	void bind(std::size_t pos)
 	{
 		poco_assert_dbg(!getBinder().isNull());
-		TypeHandler<T>::bind(pos, *_pVal, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_pVal, pBinder, getDirection());
 		_bound = true;
 	}
 
@@ -222,7 +224,8 @@ public:
 	void bind(std::size_t pos)
 	{
 		poco_assert_dbg(!getBinder().isNull());
-		TypeHandler<std::string>::bind(pos, _val, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<std::string>::bind(pos, _val, pBinder, getDirection());
 		_bound = true;
 	}
 
@@ -284,7 +287,8 @@ public:
 	void bind(std::size_t pos)
 	{
 		poco_assert_dbg(!getBinder().isNull());
-		TypeHandler<std::string>::bind(pos, _val, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<std::string>::bind(pos, _val, pBinder, getDirection());
 		_bound = true;
 	}
 
@@ -351,7 +355,8 @@ public:
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
 		
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -418,7 +423,8 @@ public:
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
 		
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -498,7 +504,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<bool>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<bool>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 
 	}
@@ -580,7 +587,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<bool>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<bool>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -645,7 +653,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -710,7 +719,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -775,7 +785,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -840,7 +851,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -905,7 +917,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -970,7 +983,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1035,7 +1049,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1100,7 +1115,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<T>::bind(pos, *_begin, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, *_begin, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1165,7 +1181,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<V>::bind(pos, _begin->second, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<V>::bind(pos, _begin->second, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1230,7 +1247,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<V>::bind(pos, _begin->second, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<V>::bind(pos, _begin->second, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1295,7 +1313,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<V>::bind(pos, _begin->second, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<V>::bind(pos, _begin->second, pBinder, getDirection());
 		++_begin;
 	}
 
@@ -1360,7 +1379,8 @@ public:
 	{
 		poco_assert_dbg(!getBinder().isNull());
 		poco_assert_dbg(canBind());
-		TypeHandler<V>::bind(pos, _begin->second, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<V>::bind(pos, _begin->second, pBinder, getDirection());
 		++_begin;
 	}
 
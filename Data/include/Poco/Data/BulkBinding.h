@@ -72,14 +72,16 @@ public:
 	void bind(std::size_t pos)
 	{
 		poco_assert_dbg(!getBinder().isNull());
-		TypeHandler<T>::bind(pos, _val, getBinder(), getDirection());
+		AbstractBinder::Ptr pBinder = getBinder();
+		TypeHandler<T>::bind(pos, _val, pBinder, getDirection());
 		_bound = true;
 	}
 
 	void reset ()
 	{
 		_bound = false;
-		getBinder()->reset();
+		AbstractBinder::Ptr pBinder = getBinder();
+		pBinder->reset();
 	}
 
 private:
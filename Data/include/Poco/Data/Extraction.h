@@ -609,7 +609,8 @@ public:
 	std::size_t extract(std::size_t pos)
 	{
 		T tmp;
-		TypeHandler<T>::extract(pos, tmp, _default, getExtractor());
+		AbstractExtractor::Ptr pExt = getExtractor();
+		TypeHandler<T>::extract(pos, tmp, _default, pExt);
 		_rResult.insert(tmp);
 		return 1u;
 	}
@@ -673,7 +674,8 @@ public:
 	std::size_t extract(std::size_t pos)
 	{
 		T tmp;
-		TypeHandler<T>::extract(pos, tmp, _default, getExtractor());
+		AbstractExtractor::Ptr pExt = getExtractor();
+		TypeHandler<T>::extract(pos, tmp, _default, pExt);
 		_rResult.insert(tmp);
 		return 1u;
 	}
@@ -737,7 +739,8 @@ public:
 	std::size_t extract(std::size_t pos)
 	{
 		V tmp;
-		TypeHandler<V>::extract(pos, tmp, _default, getExtractor());
+		AbstractExtractor::Ptr pExt = getExtractor();
+		TypeHandler<V>::extract(pos, tmp, _default, pExt);
 		_rResult.insert(std::make_pair(tmp(), tmp));
 		return 1u;
 	}
@@ -801,7 +804,8 @@ public:
 	std::size_t extract(std::size_t pos)
 	{
 		V tmp;
-		TypeHandler<V>::extract(pos, tmp, _default, getExtractor());
+		AbstractExtractor::Ptr pExt = getExtractor();
+		TypeHandler<V>::extract(pos, tmp, _default, pExt);
 		_rResult.insert(std::make_pair(tmp(), tmp));
 		return 1u;
 	}
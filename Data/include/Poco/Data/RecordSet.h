@@ -185,6 +185,67 @@ public:
 		}
 	}
 
+	template <typename T>
+	const std::vector<T>& columnData(std::size_t pos) const
+		/// Returns a direct reference to the internal storage vector of the
+		/// column at the specified position, providing zero-copy columnar
+		/// access to the result set without per-value conversions.
+		///
+		/// The internal storage type must be std::vector (see setStorage()
+		/// and the "storage" session property), otherwise an
+		/// IllegalStateException is thrown. Row filtering is not applied;
+		/// the vector contains all extracted rows. The reference is
+		/// invalidated by the next statement execution.
+	{
+		if (STORAGE_VECTOR != storage())
+			throw IllegalStateException("Columnar access requires vector storage.");
+
+		return column<std::vector<T> >(pos).data();
+	}
+
+	template <typename T>
+	const std::vector<T>& columnData(const std::string& name) const
+		/// Returns a direct reference to the internal storage vector of the
+		/// first column with the specified name.
+		/// See columnData(std::size_t) for details.
+	{
+		if (STORAGE_VECTOR != storage())
+			throw IllegalStateException("Columnar access requires vector storage.");
+
+		return column<std::vector<T> >(name).data();
+	}
+
+	template <typename T>
+	void moveColumn(std::size_t pos, std::vector<T>& values)
+		/// Moves the internal storage vector of the column at the specified
+		/// position into values (by swapping), avoiding a copy of the column
+		/// data. The previous content of values is discarded and the column
+		/// in the record set is left empty until the next statement
+		/// execution.
+		///
+		/// The internal storage type must be std::vector, otherwise an
+		/// IllegalStateException is thrown. Row filtering is not applied.
+	{
+		if (STORAGE_VECTOR != storage())
+			throw IllegalStateException("Columnar access requires vector storage.");
+
+		typedef std::vector<T> C;
+		values.swap(const_cast<Column<C>&>(column<C>(pos)).data());
+	}
+
+	template <typename T>
+	void moveColumn(const std::string& name, std::vector<T>& values)
+		/// Moves the internal storage vector of the first column with the
+		/// specified name into values (by swapping).
+		/// See moveColumn(std::size_t, std::vector<T>&) for details.
+	{
+		if (STORAGE_VECTOR != storage())
+			throw IllegalStateException("Columnar access requires vector storage.");
+
+		typedef std::vector<T> C;
+		values.swap(const_cast<Column<C>&>(column<C>(name)).data());
+	}
+
 	Row& row(std::size_t pos);
 		/// Returns reference to row at position pos.
 		/// Rows are lazy-created and cached.
@@ -314,6 +375,34 @@ public:
 		/// Returns true if there is at least one row in the RecordSet,
 		/// false otherwise.
 
+	bool hasMoreBatches();
+		/// Returns true if the statement was paused by a limit clause
+		/// and another batch of rows can be fetched.
+
+	std::size_t fetchNextBatch();
+		/// Fetches the next batch of rows for a statement paused by a
+		/// limit clause, replacing the currently held rows, and moves
+		/// the row cursor to the first row of the new batch.
+		///
+		/// Returns the number of rows fetched, or 0 if there are no
+		/// more batches.
+
+	bool prefetchNextBatch();
+		/// Starts fetching the next batch asynchronously on the shared
+		/// statement thread pool and returns immediately, so that the
+		/// server-side fetch of the next batch overlaps client-side
+		/// processing of the current one. The current batch must be
+		/// moved out of the record set (see moveColumn()) or copied
+		/// before calling this function, and the record set must not
+		/// be accessed until waitForNextBatch() returns.
+		///
+		/// Returns false if there are no more batches to fetch.
+
+	std::size_t waitForNextBatch();
+		/// Waits for completion of a batch fetch started with
+		/// prefetchNextBatch(), moves the row cursor to the first row
+		/// of the new batch and returns the number of rows fetched.
+
 	using Statement::reset;
 		/// Don't hide base class method.
 
@@ -400,6 +489,10 @@ public:
 private:
 	RecordSet();
 
+	void rewind();
+		/// Moves the row cursor to the first row and discards cached
+		/// rows after a new batch of rows has been fetched.
+
 	template<class C, class E>
 	std::size_t columnPosition(const std::string& name) const
 		/// Returns the position of the column with specified name.
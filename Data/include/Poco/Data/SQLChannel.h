@@ -27,6 +27,11 @@
 #include "Poco/Message.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/String.h"
+#include "Poco/Thread.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include <vector>
 
 
 namespace Poco {
@@ -117,9 +122,33 @@ public:
 		///                  Setting this property to false may result in log entries being lost.
 		///                  True values are (case insensitive) "true", "t", "yes", "y".
 		///                  Anything else yields false.
-		
+		///
+		///     * batch:     Number of messages to buffer and insert with a single
+		///                  multi-row statement, executed on an internal worker thread.
+		///                  "0" (default) disables batching and messages are inserted
+		///                  one by one as described above. When batching is enabled,
+		///                  the async, timeout and throw properties do not apply.
+		///
+		///     * flush:     Maximum time (ms) a buffered message may wait before a
+		///                  partial batch is flushed. "0" disables time-based flushing
+		///                  (partial batches are then only flushed when the channel is
+		///                  closed). Defaults to 1000. Only valid when batching is
+		///                  enabled, otherwise ignored.
+		///
+		///     * maxQueue:  Maximum number of buffered messages awaiting insertion.
+		///                  When the buffer is full, new messages are dropped and
+		///                  counted (see the read-only dropped property). Defaults
+		///                  to 1000. Only valid when batching is enabled.
+
 	std::string getProperty(const std::string& name) const;
 		/// Returns the value of the property with the given name.
+		/// The read-only "dropped" property returns the number of log
+		/// messages dropped due to buffer overflow or failed batch
+		/// insertion.
+
+	std::size_t dropped() const;
+		/// Returns the number of log messages dropped due to buffer
+		/// overflow or failed batch insertion.
 
 	std::size_t wait();
 		/// Waits for the completion of the previous operation and returns
@@ -137,6 +166,10 @@ public:
 	static const std::string PROP_ASYNC;
 	static const std::string PROP_TIMEOUT;
 	static const std::string PROP_THROW;
+	static const std::string PROP_BATCH;
+	static const std::string PROP_FLUSH;
+	static const std::string PROP_MAX_QUEUE;
+	static const std::string PROP_DROPPED;
 
 protected:
 	~SQLChannel();
@@ -162,6 +195,24 @@ private:
 	void logSync(const Message& msg);
 		/// Inserts the message in the target database.
 
+	void logBatch(const Message& msg);
+		/// Appends the message to the batch buffer and signals the
+		/// worker thread when the batch size threshold is reached.
+		/// When the buffer holds maxQueue messages, the message is
+		/// dropped and counted.
+
+	void runBatch();
+		/// Worker thread entry point; flushes the batch buffer
+		/// whenever signalled or the flush interval expires.
+
+	void flushBatch();
+		/// Inserts all buffered messages with a single multi-row
+		/// statement. Messages of a failed insertion are counted
+		/// as dropped.
+
+	void stopBatch();
+		/// Stops the worker thread, flushing any buffered messages.
+
 	bool isTrue(const std::string& value) const;
 		/// Returns true is value is "true", "t", "yes" or "y".
 		/// Case insensitive.
@@ -185,6 +236,28 @@ private:
 	std::string _text;
 	DateTime    _dateTime;
 
+	// members for batched mode
+	std::size_t  _batchSize;
+	int          _flushInterval;
+	std::size_t  _maxQueue;
+	std::size_t  _dropped;
+	bool         _stopBatchThread;
+	Poco::Thread _batchThread;
+	Poco::RunnableAdapter<SQLChannel> _batchRunnable;
+	Poco::Event  _batchEvent;
+	mutable
+	Poco::FastMutex _batchMutex;
+
+	// batch buffer (one vector per column)
+	std::vector<std::string> _sources;
+	std::vector<std::string> _names;
+	std::vector<long>        _pids;
+	std::vector<std::string> _threads;
+	std::vector<long>        _tids;
+	std::vector<int>         _priorities;
+	std::vector<std::string> _texts;
+	std::vector<DateTime>    _dateTimes;
+
 	StrategyPtr _pArchiveStrategy;
 };
 
@@ -202,6 +275,13 @@ inline std::size_t SQLChannel::wait()
 }
 
 
+inline std::size_t SQLChannel::dropped() const
+{
+	Poco::FastMutex::ScopedLock l(_batchMutex);
+	return _dropped;
+}
+
+
 inline bool SQLChannel::isTrue(const std::string& value) const
 {
 	return ((0 == icompare(value, "true")) ||
@@ -19,6 +19,7 @@
 
 
 #include "Poco/Data/Data.h"
+#include "Poco/Data/StatementCache.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/String.h"
 #include "Poco/Format.h"
@@ -165,6 +166,14 @@ public:
 		/// Throws a NotSupportedException if the requested property is
 		/// not supported by the underlying implementation.
 
+	StatementCache& statementCache();
+		/// Returns the session's prepared statement cache.
+		///
+		/// The cache is disabled by default; it is enabled by setting
+		/// the "statementCacheSize" session property to a nonzero
+		/// capacity. Session implementations that cache statements
+		/// must clear the cache before closing the connection.
+
 protected:
 	void setConnectionString(const std::string& connectionString);
 		/// Sets the connection string. Should only be called on
@@ -176,8 +185,9 @@ private:
 	SessionImpl(const SessionImpl&);
 	SessionImpl& operator = (const SessionImpl&);
 
-	std::string _connectionString;
-	std::size_t _loginTimeout;
+	std::string    _connectionString;
+	std::size_t    _loginTimeout;
+	StatementCache _statementCache;
 };
 
 
@@ -190,6 +200,12 @@ inline const std::string& SessionImpl::connectionString() const
 }
 
 
+inline StatementCache& SessionImpl::statementCache()
+{
+	return _statementCache;
+}
+
+
 inline void SessionImpl::setLoginTimeout(std::size_t timeout)
 {
 	_loginTimeout = timeout;
@@ -25,11 +25,20 @@
 #include "Poco/HashMap.h"
 #include "Poco/Any.h"
 #include "Poco/Timer.h"
+#include "Poco/Thread.h"
+#include "Poco/RunnableAdapter.h"
 #include "Poco/Mutex.h"
 #include <list>
 
 
 namespace Poco {
+
+namespace Metrics {
+
+class Gauge;
+
+}
+
 namespace Data {
 
 
@@ -151,6 +160,16 @@ public:
 	Poco::Any getProperty(const std::string& name);
 		/// Returns the requested property.
 
+	void prewarm();
+		/// Starts creating sessions on a background thread until the
+		/// pool holds minSessions sessions, so that subsequent get()
+		/// calls do not pay connection setup latency.
+		///
+		/// Should be called after all pool features and properties
+		/// have been configured. Once prewarming has been requested,
+		/// the janitor replenishes the pool back to minSessions
+		/// whenever dead sessions have been purged.
+
 	void shutdown();
 		/// Shuts down the session pool.
 
@@ -172,6 +191,7 @@ protected:
 
 	void purgeDeadSessions();
 	int deadImpl(SessionList& rSessions);
+	void updateMetrics();
 	void applySettings(SessionImpl* pImpl);
 	void putBack(PooledSessionHolderPtr pHolder);
 	void onJanitorTimer(Poco::Timer&);
@@ -186,7 +206,10 @@ private:
 	SessionPool& operator = (const SessionPool&);
 		
 	void closeAll(SessionList& sessionList);
+	void runPrewarm();
 
+	Poco::Metrics::Gauge* _pUsedGauge;
+	Poco::Metrics::Gauge* _pIdleGauge;
 	std::string    _connector;
 	std::string    _connectionString;
 	int            _minSessions;
@@ -199,6 +222,9 @@ private:
 	FeatureMap     _featureMap;
 	PropertyMap    _propertyMap;
 	bool           _shutdown;
+	bool           _prewarmEnabled;
+	Poco::Thread   _prewarmThread;
+	Poco::RunnableAdapter<SessionPool> _prewarmRunnable;
 	AddPropertyMap _addPropertyMap;
 	AddFeatureMap  _addFeatureMap;
 	mutable
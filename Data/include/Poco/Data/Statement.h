@@ -43,6 +43,25 @@ class Session;
 class Limit;
 
 
+class Data_API AsyncExecStarter
+	/// Starter policy for asynchronous statement execution. Statements
+	/// are executed on a shared, bounded thread pool instead of the
+	/// default thread pool, so the number of threads consumed by
+	/// in-flight statements has a fixed upper bound. If no thread is
+	/// available, the statement is executed in the calling thread.
+{
+public:
+	static void start(StatementImpl* pOwner, Poco::ActiveRunnableBase::Ptr pRunnable);
+		/// Starts the statement execution on the shared thread pool,
+		/// or in the calling thread if the pool is exhausted.
+
+	static Poco::ThreadPool& pool();
+		/// Returns the shared thread pool used for asynchronous
+		/// statement execution. The pool capacity can be increased
+		/// by calling addCapacity() on the returned pool.
+};
+
+
 class Data_API Statement
 	/// A Statement is used to execute SQL statements.
 	/// It does not contain code of its own.
@@ -76,7 +95,7 @@ public:
 
 	typedef ActiveResult<std::size_t>                      Result;
 	typedef SharedPtr<Result>                              ResultPtr;
-	typedef ActiveMethod<std::size_t, bool, StatementImpl> AsyncExecMethod;
+	typedef ActiveMethod<std::size_t, bool, StatementImpl, AsyncExecStarter> AsyncExecMethod;
 	typedef SharedPtr<AsyncExecMethod>                     AsyncExecMethodPtr;
 
 	static const int WAIT_FOREVER = -1;
@@ -410,6 +429,11 @@ private:
 	const Result& doAsyncExec(bool reset = true);
 		/// Asynchronously executes the statement.
 
+	void swapWithCached();
+		/// If the session's statement cache holds a compiled statement
+		/// for this statement's SQL text, adopts it in place of the
+		/// current (not yet compiled) implementation.
+
 	template <typename T>
 	Statement& commaPODImpl(const T& val)
 	{
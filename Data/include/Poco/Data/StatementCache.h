@@ -0,0 +1,141 @@
+//
+// StatementCache.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  StatementCache
+//
+// Definition of the StatementCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_StatementCache_INCLUDED
+#define Data_StatementCache_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/SharedPtr.h"
+#include <list>
+#include <map>
+#include <string>
+
+
+namespace Poco {
+namespace Data {
+
+
+class StatementImpl;
+
+
+class Data_API StatementCache
+	/// A least-recently-used cache of prepared StatementImpl objects,
+	/// keyed by SQL statement text.
+	///
+	/// Every SessionImpl owns a StatementCache. The cache is disabled
+	/// by default (capacity zero); it is enabled by setting the
+	/// "statementCacheSize" session property to a nonzero capacity.
+	/// When enabled, Statement transparently places statement
+	/// implementations that support reuse (see StatementImpl::canReuse())
+	/// into the cache upon destruction and fetches them back when the
+	/// same SQL is executed again, avoiding a server round trip for
+	/// parsing and preparing the statement.
+	///
+	/// A cached statement is checked out of the cache while in use,
+	/// so a StatementImpl is never shared between Statements.
+{
+public:
+	typedef Poco::SharedPtr<StatementImpl> StatementPtr;
+
+	StatementCache(std::size_t capacity = 0);
+		/// Creates the StatementCache with the given capacity.
+		/// A capacity of zero disables caching.
+
+	~StatementCache();
+		/// Destroys the StatementCache.
+
+	void setCapacity(std::size_t capacity);
+		/// Sets the maximum number of cached statements.
+		/// If the new capacity is smaller than the current size,
+		/// the least recently used statements are evicted.
+		/// Setting the capacity to zero disables caching and
+		/// clears the cache.
+
+	std::size_t getCapacity() const;
+		/// Returns the maximum number of cached statements.
+
+	StatementPtr get(const std::string& sql);
+		/// Returns the cached statement for the given SQL text, or a
+		/// null pointer if there is none. A returned statement is
+		/// removed (checked out) from the cache; it is returned to the
+		/// cache with put() when its Statement is done with it.
+
+	void put(const std::string& sql, StatementPtr pStatement);
+		/// Places a statement into the cache, making it the most
+		/// recently used entry. If the cache is full, the least
+		/// recently used statement is evicted. If a statement with the
+		/// same SQL text is already cached, it is replaced.
+		/// Does nothing if the cache is disabled.
+
+	void clear();
+		/// Removes all cached statements.
+
+	std::size_t size() const;
+		/// Returns the number of cached statements.
+
+	Poco::UInt64 hits() const;
+		/// Returns the number of get() calls that found a cached statement.
+
+	Poco::UInt64 misses() const;
+		/// Returns the number of get() calls that found no cached statement.
+
+private:
+	typedef std::list<std::pair<std::string, StatementPtr> > LRUList;
+	typedef std::map<std::string, LRUList::iterator>         IndexMap;
+
+	StatementCache(const StatementCache&);
+	StatementCache& operator = (const StatementCache&);
+
+	std::size_t  _capacity;
+	LRUList      _lru;
+	IndexMap     _index;
+	Poco::UInt64 _hits;
+	Poco::UInt64 _misses;
+};
+
+
+//
+// inlines
+//
+inline std::size_t StatementCache::getCapacity() const
+{
+	return _capacity;
+}
+
+
+inline std::size_t StatementCache::size() const
+{
+	return _index.size();
+}
+
+
+inline Poco::UInt64 StatementCache::hits() const
+{
+	return _hits;
+}
+
+
+inline Poco::UInt64 StatementCache::misses() const
+{
+	return _misses;
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_StatementCache_INCLUDED
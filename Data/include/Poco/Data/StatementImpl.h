@@ -193,6 +193,23 @@ protected:
 	virtual bool canCompile() const = 0;
 		/// Returns true if another compile is possible.
 
+	virtual bool canReuse() const;
+		/// Returns true if the statement implementation keeps its compiled
+		/// (prepared) statement across executions and can therefore be placed
+		/// in the session's statement cache and reused for repeated executions
+		/// of the same SQL text.
+		///
+		/// At the Data framework level, this function always returns false.
+		/// Connectors supporting cheap re-execution of an already compiled
+		/// statement should override it.
+
+	virtual void reuseImpl();
+		/// Re-initializes connector-specific per-execution state after the
+		/// statement has been fetched from the statement cache and new
+		/// bindings have been adopted. Called by reuse().
+		///
+		/// The default implementation does nothing.
+
 	virtual void compileImpl() = 0;
 		/// Compiles the statement, doesn't bind yet.
 
@@ -296,10 +313,31 @@ protected:
 	bool hasMoreDataSets() const;
 		/// Returns true if there are data sets not activated yet.
 
+	void setBulkExtraction(const Bulk& l);
+		/// Sets the bulk extraction flag and extraction limit.
+
+	bool bulkExtractionAllowed() const;
+		/// Returns true if statement can be set to extract data in bulk.
+		/// Once bulk extraction is set for a statement, it can be
+		/// neither altered nor mixed with non-bulk mode extraction.
+
 private:
 	void compile();
 		/// Compiles the statement.
 
+	void reuse(StatementImpl& stmt);
+		/// Adopts the bindings, extractions and limits of the given freshly
+		/// created (not yet compiled) statement, so that this already compiled
+		/// statement can be executed in its place without another prepare
+		/// round trip. Called by Statement when a cached statement is found
+		/// for the SQL text about to be executed.
+
+	void unbind();
+		/// Releases all bindings and extractions (which reference
+		/// caller-owned storage) while keeping the compiled statement,
+		/// so that this statement can be safely kept in the session's
+		/// statement cache until it is reused.
+
 	void bind();
 		/// Binds the statement, if not yet bound.
 
@@ -397,9 +435,6 @@ private:
 	void setBulkBinding();
 		/// Sets the bulk binding flag.
 
-	void setBulkExtraction(const Bulk& l);
-		/// Sets the bulk extraction flag and extraction limit.
-	
 	void resetBulk();
 		/// Resets the bulk extraction and binding flag.
 
@@ -408,11 +443,6 @@ private:
 		/// Once bulk binding is set for a statement, it can be
 		/// neither altered nor mixed with non-bulk mode binding.
 
-	bool bulkExtractionAllowed() const;
-		/// Returns true if statement can be set to extract data in bulk.
-		/// Once bulk extraction is set for a statement, it can be
-		/// neither altered nor mixed with non-bulk mode extraction.
-
 	bool isBulkBinding() const;
 		/// Returns true if statement is set to bind data in bulk.
 
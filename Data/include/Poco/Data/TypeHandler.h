@@ -74,7 +74,7 @@ class TypeHandler: public AbstractTypeHandler
 	///			return 3; // lastName + firstname + age occupy three columns
 	///		}
 	///	
-	///		static void bind(std::size_t pos, const Person& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	///		static void bind(std::size_t pos, const Person& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	///		{
 	///			// the table is defined as Person (LastName VARCHAR(30), FirstName VARCHAR, Age INTEGER(3))
 	///			// Note that we advance pos by the number of columns the datatype uses! For string/int this is one.
@@ -84,7 +84,7 @@ class TypeHandler: public AbstractTypeHandler
 	///			TypeHandler<int>::bind(pos++, obj.getAge(), pBinder, dir);
 	///		}
 	///	
-	///		static void prepare(std::size_t pos, const Person& obj, AbstractPreparator::Ptr pPreparator)
+	///		static void prepare(std::size_t pos, const Person& obj, AbstractPreparator::Ptr& pPreparator)
 	///		{
 	///			// the table is defined as Person (LastName VARCHAR(30), FirstName VARCHAR, Age INTEGER(3))
 	///			poco_assert_dbg (!pPreparator.isNull());
@@ -93,7 +93,7 @@ class TypeHandler: public AbstractTypeHandler
 	///			TypeHandler<int>::prepare(pos++, obj.getAge(), pPreparator);
 	///		}
 	///	
-	///		static void extract(std::size_t pos, Person& obj, const Person& defVal, AbstractExtractor::Ptr pExt)
+	///		static void extract(std::size_t pos, Person& obj, const Person& defVal, AbstractExtractor::Ptr& pExt)
 	///		{
 	///			// defVal is the default person we should use if we encunter NULL entries, so we take the individual fields
 	///			// as defaults. You can do more complex checking, ie return defVal if only one single entry of the fields is null etc...
@@ -115,7 +115,7 @@ class TypeHandler: public AbstractTypeHandler
 	/// Apart from that no further work is needed. One can now use Person with into and use clauses.
 {
 public:
-	static void bind(std::size_t pos, const T& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const T& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		pBinder->bind(pos, obj, dir);
@@ -126,13 +126,13 @@ public:
 		return 1u;
 	}
 
-	static void extract(std::size_t pos, T& obj, const T& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, T& obj, const T& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		if (!pExt->extract(pos, obj)) obj = defVal;
 	}
 
-	static void prepare(std::size_t pos, const T& obj, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const T& obj, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		pPreparator->prepare(pos, obj);
@@ -149,7 +149,7 @@ class TypeHandler<std::deque<T> >: public AbstractTypeHandler
 	/// Specialization of type handler for std::deque.
 {
 public:
-	static void bind(std::size_t pos, const std::deque<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const std::deque<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		pBinder->bind(pos, obj, dir);
@@ -160,14 +160,14 @@ public:
 		return 1u;
 	}
 
-	static void extract(std::size_t pos, std::deque<T>& obj, const T& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, std::deque<T>& obj, const T& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		if (!pExt->extract(pos, obj))
 			obj.assign(obj.size(), defVal);
 	}
 
-	static void prepare(std::size_t pos, const std::deque<T>& obj, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const std::deque<T>& obj, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		pPreparator->prepare(pos, obj);
@@ -184,7 +184,7 @@ class TypeHandler<std::vector<T> >: public AbstractTypeHandler
 	/// Specialization of type handler for std::vector.
 {
 public:
-	static void bind(std::size_t pos, const std::vector<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const std::vector<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		pBinder->bind(pos, obj, dir);
@@ -195,14 +195,14 @@ public:
 		return 1u;
 	}
 
-	static void extract(std::size_t pos, std::vector<T>& obj, const T& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, std::vector<T>& obj, const T& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		if (!pExt->extract(pos, obj))
 			obj.assign(obj.size(), defVal);
 	}
 
-	static void prepare(std::size_t pos, const std::vector<T>& obj, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const std::vector<T>& obj, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		pPreparator->prepare(pos, obj);
@@ -219,7 +219,7 @@ class TypeHandler<std::list<T> >: public AbstractTypeHandler
 	/// Specialization of type handler for std::list.
 {
 public:
-	static void bind(std::size_t pos, const std::list<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const std::list<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		pBinder->bind(pos, obj, dir);
@@ -230,14 +230,14 @@ public:
 		return 1u;
 	}
 
-	static void extract(std::size_t pos, std::list<T>& obj, const T& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, std::list<T>& obj, const T& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		if (!pExt->extract(pos, obj))
 			obj.assign(obj.size(), defVal);
 	}
 
-	static void prepare(std::size_t pos, const std::list<T>& obj, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const std::list<T>& obj, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		pPreparator->prepare(pos, obj);
@@ -254,7 +254,7 @@ class TypeHandler<Nullable<T> >
 {
 public:
 
-	static void bind(std::size_t pos, const Nullable<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir) 
+	static void bind(std::size_t pos, const Nullable<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir) 
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		if (obj.isNull()) 
@@ -267,7 +267,7 @@ public:
 		}
 	}
 	
-	static void prepare(std::size_t pos, const Nullable<T>& obj, AbstractPreparator::Ptr pPreparator) 
+	static void prepare(std::size_t pos, const Nullable<T>& obj, AbstractPreparator::Ptr& pPreparator) 
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		if (obj.isNull()) 
@@ -285,7 +285,7 @@ public:
 		return 1u;
 	}
 
-	static void extract(std::size_t pos, Nullable<T>& obj, const Nullable<T>& , AbstractExtractor::Ptr pExt) 
+	static void extract(std::size_t pos, Nullable<T>& obj, const Nullable<T>& , AbstractExtractor::Ptr& pExt) 
 	{
 		poco_assert_dbg (!pExt.isNull());
 		T val;
@@ -317,7 +317,7 @@ private:
 
 template <typename TupleType, typename Type, int N>
 POCO_TUPLE_TYPE_HANDLER_INLINE
-void tupleBind(std::size_t& pos, TupleType tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+void tupleBind(std::size_t& pos, TupleType tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 {
 	TypeHandler<Type>::bind(pos, tuple.template get<N>(), pBinder, dir);
 	pos += TypeHandler<Type>::size();
@@ -326,7 +326,7 @@ void tupleBind(std::size_t& pos, TupleType tuple, AbstractBinder::Ptr pBinder, A
 
 template <typename TupleType, typename Type, int N>
 POCO_TUPLE_TYPE_HANDLER_INLINE
-void tuplePrepare(std::size_t& pos, TupleType tuple, AbstractPreparator::Ptr pPreparator)
+void tuplePrepare(std::size_t& pos, TupleType tuple, AbstractPreparator::Ptr& pPreparator)
 {
 	TypeHandler<Type>::prepare(pos, tuple.template get<N>(), pPreparator);
 	pos += TypeHandler<Type>::size();
@@ -335,7 +335,7 @@ void tuplePrepare(std::size_t& pos, TupleType tuple, AbstractPreparator::Ptr pPr
 
 template <typename TupleType, typename DefValType, typename Type, int N>
 POCO_TUPLE_TYPE_HANDLER_INLINE
-void tupleExtract(std::size_t& pos, TupleType tuple, DefValType defVal, AbstractExtractor::Ptr pExt)
+void tupleExtract(std::size_t& pos, TupleType tuple, DefValType defVal, AbstractExtractor::Ptr& pExt)
 {
 	Poco::Data::TypeHandler<Type>::extract(pos, tuple.template get<N>(),
 	defVal.template get<N>(), pExt);
@@ -369,7 +369,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17,T18,T19> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17,T18,T19> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -394,7 +394,7 @@ public:
 		tupleBind<TupleConstRef, T19, 19>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -443,7 +443,7 @@ public:
 			TypeHandler<T19>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -499,7 +499,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17,T18> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17,T18> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -523,7 +523,7 @@ public:
 		tupleBind<TupleConstRef, T18, 18>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -570,7 +570,7 @@ public:
 			TypeHandler<T18>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -624,7 +624,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -647,7 +647,7 @@ public:
 		tupleBind<TupleConstRef, T17, 17>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -692,7 +692,7 @@ public:
 			TypeHandler<T17>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -744,7 +744,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -766,7 +766,7 @@ public:
 		tupleBind<TupleConstRef, T16, 16>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -809,7 +809,7 @@ public:
 			TypeHandler<T16>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -859,7 +859,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -880,7 +880,7 @@ public:
 		tupleBind<TupleConstRef, T15, 15>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -921,7 +921,7 @@ public:
 			TypeHandler<T15>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -969,7 +969,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -989,7 +989,7 @@ public:
 		tupleBind<TupleConstRef, T14, 14>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1028,7 +1028,7 @@ public:
 			TypeHandler<T14>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1074,7 +1074,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1093,7 +1093,7 @@ public:
 		tupleBind<TupleConstRef, T13, 13>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1130,7 +1130,7 @@ public:
 			TypeHandler<T13>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1174,7 +1174,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1192,7 +1192,7 @@ public:
 		tupleBind<TupleConstRef, T12, 12>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1227,7 +1227,7 @@ public:
 			TypeHandler<T12>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1269,7 +1269,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1286,7 +1286,7 @@ public:
 		tupleBind<TupleConstRef, T11, 11>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1319,7 +1319,7 @@ public:
 			TypeHandler<T11>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1359,7 +1359,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9,T10> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1375,7 +1375,7 @@ public:
 		tupleBind<TupleConstRef, T10, 10>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1406,7 +1406,7 @@ public:
 			TypeHandler<T10>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1435,7 +1435,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1450,7 +1450,7 @@ public:
 		tupleBind<TupleConstRef, T9, 9>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1479,7 +1479,7 @@ public:
 			TypeHandler<T9>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1507,7 +1507,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1521,7 +1521,7 @@ public:
 		tupleBind<TupleConstRef, T8, 8>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1548,7 +1548,7 @@ public:
 			TypeHandler<T8>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1575,7 +1575,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, T7, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1588,7 +1588,7 @@ public:
 		tupleBind<TupleConstRef, T7, 7>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1613,7 +1613,7 @@ public:
 			TypeHandler<T7>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1639,7 +1639,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, T6, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1651,7 +1651,7 @@ public:
 		tupleBind<TupleConstRef, T6, 6>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1674,7 +1674,7 @@ public:
 			TypeHandler<T6>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1699,7 +1699,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, T5, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1710,7 +1710,7 @@ public:
 		tupleBind<TupleConstRef, T5, 5>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1731,7 +1731,7 @@ public:
 			TypeHandler<T5>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1755,7 +1755,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, T4, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1765,7 +1765,7 @@ public:
 		tupleBind<TupleConstRef, T4, 4>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1784,7 +1784,7 @@ public:
 			TypeHandler<T4>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1807,7 +1807,7 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, T3, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1816,7 +1816,7 @@ public:
 		tupleBind<TupleConstRef, T3, 3>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1833,7 +1833,7 @@ public:
 			TypeHandler<T3>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1855,7 +1855,7 @@ public:
 		typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, T2, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
@@ -1863,7 +1863,7 @@ public:
 		tupleBind<TupleConstRef, T2, 2>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1878,7 +1878,7 @@ public:
 			TypeHandler<T2>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1899,14 +1899,14 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, T1, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
 		tupleBind<TupleConstRef, T1, 1>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1919,7 +1919,7 @@ public:
 			TypeHandler<T1>::size();
 	}
 
-	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1939,13 +1939,13 @@ public:
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, NullTypeList> >::CONSTREFTYPE TupleConstRef;
 	typedef typename Poco::TypeWrapper<Poco::Tuple<T0, NullTypeList> >::REFTYPE	  TupleRef;
 
-	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, TupleConstRef tuple, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		poco_assert_dbg (!pBinder.isNull());
 		tupleBind<TupleConstRef, T0, 0>(pos, tuple, pBinder, dir);
 	}
 
-	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, TupleConstRef tuple, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		tuplePrepare<TupleConstRef, T0, 0>(pos, tuple, pPreparator);
@@ -1957,7 +1957,7 @@ public:
 	}
 
 	static void extract(std::size_t pos, TupleRef tuple, TupleConstRef defVal, 
-		AbstractExtractor::Ptr pExt)
+		AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		tupleExtract<TupleRef, TupleConstRef, T0, 0>(pos, tuple, defVal, pExt);
@@ -1973,7 +1973,7 @@ template <class K, class V>
 class TypeHandler<std::pair<K, V> >: public AbstractTypeHandler
 {
 public:
-	static void bind(std::size_t pos, const std::pair<K, V>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const std::pair<K, V>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		TypeHandler<K>::bind(pos, obj.first, pBinder, dir);
 		pos += TypeHandler<K>::size();
@@ -1985,14 +1985,14 @@ public:
 		return static_cast<std::size_t>(TypeHandler<K>::size() + TypeHandler<V>::size());
 	}
 
-	static void extract(std::size_t pos, std::pair<K, V>& obj, const std::pair<K, V>& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, std::pair<K, V>& obj, const std::pair<K, V>& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		TypeHandler<K>::extract(pos, obj.first, defVal.first, pExt);
 		pos += TypeHandler<K>::size();
 		TypeHandler<V>::extract(pos, obj.second, defVal.second, pExt);
 	}
 
-	static void prepare(std::size_t pos, const std::pair<K, V>& obj, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const std::pair<K, V>& obj, AbstractPreparator::Ptr& pPreparator)
 	{
 		TypeHandler<K>::prepare(pos, obj.first, pPreparator);
 		pos += TypeHandler<K>::size();
@@ -2010,7 +2010,7 @@ class TypeHandler<Poco::AutoPtr<T> >: public AbstractTypeHandler
 	/// Specialization of type handler for Poco::AutoPtr
 {
 public:
-	static void bind(std::size_t pos, const Poco::AutoPtr<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const Poco::AutoPtr<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		// *obj will trigger a nullpointer exception if empty: this is on purpose
 		TypeHandler<T>::bind(pos, *obj, pBinder, dir); 
@@ -2021,7 +2021,7 @@ public:
 		return static_cast<std::size_t>(TypeHandler<T>::size());
 	}
 
-	static void extract(std::size_t pos, Poco::AutoPtr<T>& obj, const Poco::AutoPtr<T>& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, Poco::AutoPtr<T>& obj, const Poco::AutoPtr<T>& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		
@@ -2032,7 +2032,7 @@ public:
 			TypeHandler<T>::extract(pos, *obj, *obj, pExt);
 	}
 
-	static void prepare(std::size_t pos, const Poco::AutoPtr<T>&, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const Poco::AutoPtr<T>&, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		TypeHandler<T>::prepare(pos, T(), pPreparator);
@@ -2050,7 +2050,7 @@ class TypeHandler<Poco::SharedPtr<T> >: public AbstractTypeHandler
 	/// Specialization of type handler for Poco::SharedPtr
 {
 public:
-	static void bind(std::size_t pos, const Poco::SharedPtr<T>& obj, AbstractBinder::Ptr pBinder, AbstractBinder::Direction dir)
+	static void bind(std::size_t pos, const Poco::SharedPtr<T>& obj, AbstractBinder::Ptr& pBinder, AbstractBinder::Direction dir)
 	{
 		// *obj will trigger a nullpointer exception if empty
 		TypeHandler<T>::bind(pos, *obj, pBinder, dir); 
@@ -2061,7 +2061,7 @@ public:
 		return static_cast<std::size_t>(TypeHandler<T>::size());
 	}
 
-	static void extract(std::size_t pos, Poco::SharedPtr<T>& obj, const Poco::SharedPtr<T>& defVal, AbstractExtractor::Ptr pExt)
+	static void extract(std::size_t pos, Poco::SharedPtr<T>& obj, const Poco::SharedPtr<T>& defVal, AbstractExtractor::Ptr& pExt)
 	{
 		poco_assert_dbg (!pExt.isNull());
 		
@@ -2072,7 +2072,7 @@ public:
 			TypeHandler<T>::extract(pos, *obj, *obj, pExt);
 	}
 
-	static void prepare(std::size_t pos, const Poco::SharedPtr<T>&, AbstractPreparator::Ptr pPreparator)
+	static void prepare(std::size_t pos, const Poco::SharedPtr<T>&, AbstractPreparator::Ptr& pPreparator)
 	{
 		poco_assert_dbg (!pPreparator.isNull());
 		TypeHandler<T>::prepare(pos, T(), pPreparator);
@@ -87,6 +87,54 @@ RecordSet::~RecordSet()
 }
 
 
+bool RecordSet::hasMoreBatches()
+{
+	return Statement::paused();
+}
+
+
+std::size_t RecordSet::fetchNextBatch()
+{
+	if (!Statement::paused()) return 0;
+
+	std::size_t rows = Statement::execute();
+	rewind();
+	return rows;
+}
+
+
+bool RecordSet::prefetchNextBatch()
+{
+	if (!Statement::paused()) return false;
+
+	Statement::executeAsync();
+	return true;
+}
+
+
+std::size_t RecordSet::waitForNextBatch()
+{
+	std::size_t rows = Statement::wait();
+	rewind();
+	return rows;
+}
+
+
+void RecordSet::rewind()
+{
+	_currentRow = 0;
+
+	RowMap::iterator it = _rowMap.begin();
+	RowMap::iterator end = _rowMap.end();
+	for (; it != end; ++it) delete it->second;
+	_rowMap.clear();
+
+	delete _pBegin;
+	_pBegin = 0;
+	_pBegin = new RowIterator(this, 0 == rowsExtracted());
+}
+
+
 void RecordSet::reset(const Statement& stmt)
 {
 	delete _pBegin;
@@ -38,6 +38,10 @@ const std::string SQLChannel::PROP_MAX_AGE("keep");
 const std::string SQLChannel::PROP_ASYNC("async");
 const std::string SQLChannel::PROP_TIMEOUT("timeout");
 const std::string SQLChannel::PROP_THROW("throw");
+const std::string SQLChannel::PROP_BATCH("batch");
+const std::string SQLChannel::PROP_FLUSH("flush");
+const std::string SQLChannel::PROP_MAX_QUEUE("maxQueue");
+const std::string SQLChannel::PROP_DROPPED("dropped");
 
 
 SQLChannel::SQLChannel():
@@ -48,7 +52,13 @@ SQLChannel::SQLChannel():
 	_async(true),
 	_pid(),
 	_tid(),
-	_priority()
+	_priority(),
+	_batchSize(0),
+	_flushInterval(1000),
+	_maxQueue(1000),
+	_dropped(0),
+	_stopBatchThread(false),
+	_batchRunnable(*this, &SQLChannel::runBatch)
 {
 }
 
@@ -65,7 +75,13 @@ SQLChannel::SQLChannel(const std::string& connector,
 	_async(true),
 	_pid(),
 	_tid(),
-	_priority()
+	_priority(),
+	_batchSize(0),
+	_flushInterval(1000),
+	_maxQueue(1000),
+	_dropped(0),
+	_stopBatchThread(false),
+	_batchRunnable(*this, &SQLChannel::runBatch)
 {
 	open();
 }
@@ -96,13 +112,15 @@ void SQLChannel::open()
 	
 void SQLChannel::close()
 {
+	stopBatch();
 	wait();
 }
 
 
 void SQLChannel::log(const Message& msg)
 {
-	if (_async) logAsync(msg);
+	if (_batchSize > 0) logBatch(msg);
+	else if (_async) logAsync(msg);
 	else logSync(msg);
 }
 
@@ -145,7 +163,122 @@ void SQLChannel::logSync(const Message& msg)
 	}
 }
 
-	
+void SQLChannel::logBatch(const Message& msg)
+{
+	bool flushNow = false;
+	{
+		Poco::FastMutex::ScopedLock l(_batchMutex);
+
+		if (_sources.size() >= _maxQueue)
+		{
+			++_dropped;
+			return;
+		}
+
+		std::string source = msg.getSource();
+		if (source.empty()) source = _name;
+		_sources.push_back(source);
+		_names.push_back(_name);
+		_pids.push_back(msg.getPid());
+		_threads.push_back(msg.getThread());
+		_tids.push_back(msg.getTid());
+		_priorities.push_back(msg.getPriority());
+		_texts.push_back(msg.getText());
+		_dateTimes.push_back(msg.getTime());
+
+		flushNow = _sources.size() >= _batchSize;
+	}
+
+	if (flushNow) _batchEvent.set();
+}
+
+
+void SQLChannel::runBatch()
+{
+	for (;;)
+	{
+		if (_flushInterval > 0)
+			_batchEvent.tryWait(_flushInterval);
+		else
+			_batchEvent.wait();
+
+		bool stop;
+		{
+			Poco::FastMutex::ScopedLock l(_batchMutex);
+			stop = _stopBatchThread;
+		}
+
+		flushBatch();
+		if (stop) return;
+	}
+}
+
+
+void SQLChannel::flushBatch()
+{
+	std::vector<std::string> sources;
+	std::vector<std::string> names;
+	std::vector<long>        pids;
+	std::vector<std::string> threads;
+	std::vector<long>        tids;
+	std::vector<int>         priorities;
+	std::vector<std::string> texts;
+	std::vector<DateTime>    dateTimes;
+	{
+		Poco::FastMutex::ScopedLock l(_batchMutex);
+		sources.swap(_sources);
+		names.swap(_names);
+		pids.swap(_pids);
+		threads.swap(_threads);
+		tids.swap(_tids);
+		priorities.swap(_priorities);
+		texts.swap(_texts);
+		dateTimes.swap(_dateTimes);
+	}
+
+	if (sources.empty()) return;
+
+	try
+	{
+		if (!_pSession || !_pSession->isConnected()) open();
+		if (_pArchiveStrategy) _pArchiveStrategy->archive();
+
+		std::string sql;
+		Poco::format(sql, "INSERT INTO %s VALUES (?,?,?,?,?,?,?,?)", _table);
+		Statement stmt(*_pSession);
+		stmt << sql,
+			use(sources),
+			use(names),
+			use(pids),
+			use(threads),
+			use(tids),
+			use(priorities),
+			use(texts),
+			use(dateTimes),
+			now;
+	}
+	catch (Exception&)
+	{
+		Poco::FastMutex::ScopedLock l(_batchMutex);
+		_dropped += sources.size();
+	}
+}
+
+
+void SQLChannel::stopBatch()
+{
+	if (_batchThread.isRunning())
+	{
+		{
+			Poco::FastMutex::ScopedLock l(_batchMutex);
+			_stopBatchThread = true;
+		}
+		_batchEvent.set();
+		_batchThread.join();
+	}
+}
+
+
 void SQLChannel::setProperty(const std::string& name, const std::string& value)
 {
 	if (name == PROP_NAME)
@@ -216,6 +349,37 @@ void SQLChannel::setProperty(const std::string& name, const std::string& value)
 	{
 		_throw = isTrue(value);
 	}
+	else if (name == PROP_BATCH)
+	{
+		if (value.empty() || '0' == value[0])
+		{
+			stopBatch();
+			_batchSize = 0;
+		}
+		else
+		{
+			_batchSize = NumberParser::parseUnsigned(value);
+			if (!_batchThread.isRunning())
+			{
+				{
+					Poco::FastMutex::ScopedLock l(_batchMutex);
+					_stopBatchThread = false;
+				}
+				_batchThread.start(_batchRunnable);
+			}
+		}
+	}
+	else if (name == PROP_FLUSH)
+	{
+		if (value.empty())
+			_flushInterval = 1000;
+		else
+			_flushInterval = NumberParser::parse(value);
+	}
+	else if (name == PROP_MAX_QUEUE)
+	{
+		_maxQueue = NumberParser::parseUnsigned(value);
+	}
 	else
 	{
 		Channel::setProperty(name, value);
@@ -259,6 +423,22 @@ std::string SQLChannel::getProperty(const std::string& name) const
 		if (_throw) return "true";
 		else return "false";
 	}
+	else if (name == PROP_BATCH)
+	{
+		return NumberFormatter::format(_batchSize);
+	}
+	else if (name == PROP_FLUSH)
+	{
+		return NumberFormatter::format(_flushInterval);
+	}
+	else if (name == PROP_MAX_QUEUE)
+	{
+		return NumberFormatter::format(_maxQueue);
+	}
+	else if (name == PROP_DROPPED)
+	{
+		return NumberFormatter::format(dropped());
+	}
 	else
 	{
 		return Channel::getProperty(name);
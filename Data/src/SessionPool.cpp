@@ -15,6 +15,7 @@
 #include "Poco/Data/SessionPool.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/DataException.h"
+#include "Poco/Metrics.h"
 #include <algorithm>
 
 
@@ -23,6 +24,8 @@ namespace Data {
 
 
 SessionPool::SessionPool(const std::string& connector, const std::string& connectionString, int minSessions, int maxSessions, int idleTime):
+	_pUsedGauge(0),
+	_pIdleGauge(0),
 	_connector(connector),
 	_connectionString(connectionString),
 	_minSessions(minSessions),
@@ -30,7 +33,9 @@ SessionPool::SessionPool(const std::string& connector, const std::string& connec
 	_idleTime(idleTime),
 	_nSessions(0),
 	_janitorTimer(1000*idleTime, 1000*idleTime/4),
-	_shutdown(false)
+	_shutdown(false),
+	_prewarmEnabled(false),
+	_prewarmRunnable(*this, &SessionPool::runPrewarm)
 {
 	Poco::TimerCallback<SessionPool> callback(*this, &SessionPool::onJanitorTimer);
 	_janitorTimer.start(callback);
@@ -63,32 +68,67 @@ Session SessionPool::get(const std::string& name, bool value)
 
 Session SessionPool::get()
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-    if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
-	
-	purgeDeadSessions();
+	PooledSessionHolderPtr pHolder;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+
+		while (!_idleSessions.empty())
+		{
+			PooledSessionHolderPtr pIdle(_idleSessions.front());
+			_idleSessions.pop_front();
+			if (pIdle->session()->isConnected())
+			{
+				pHolder = pIdle;
+				break;
+			}
+			else --_nSessions;
+		}
 
-	if (_idleSessions.empty())
+		if (pHolder)
+		{
+			_activeSessions.push_front(pHolder);
+			updateMetrics();
+		}
+		else
+		{
+			if (_nSessions >= _maxSessions)
+				throw SessionPoolExhaustedException(_connector);
+			// reserve a slot; the session is created without
+			// holding the pool lock
+			++_nSessions;
+		}
+	}
+
+	if (!pHolder)
 	{
-		if (_nSessions < _maxSessions)
+		try
 		{
 			Session newSession(SessionFactory::instance().create(_connector, _connectionString));
 			applySettings(newSession.impl());
 			customizeSession(newSession);
+			pHolder = new PooledSessionHolder(*this, newSession.impl());
+		}
+		catch (...)
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			--_nSessions;
+			throw;
+		}
 
-			PooledSessionHolderPtr pHolder(new PooledSessionHolder(*this, newSession.impl()));
-			_idleSessions.push_front(pHolder);
-			++_nSessions;
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown)
+		{
+			--_nSessions;
+			try { pHolder->session()->close(); }
+			catch (...) { }
+			throw InvalidAccessException("Session pool has been shut down.");
 		}
-		else throw SessionPoolExhaustedException(_connector);
+		_activeSessions.push_front(pHolder);
+		updateMetrics();
 	}
 
-	PooledSessionHolderPtr pHolder(_idleSessions.front());
-	PooledSessionImplPtr pPSI(new PooledSessionImpl(pHolder));
-	
-	_activeSessions.push_front(pHolder);
-	_idleSessions.pop_front();
-	return Session(pPSI);
+	return Session(PooledSessionImplPtr(new PooledSessionImpl(pHolder)));
 }
 
 
@@ -107,6 +147,7 @@ void SessionPool::purgeDeadSessions()
 		}
 		else ++it;
 	}
+	updateMetrics();
 }
 
 
@@ -253,6 +294,7 @@ void SessionPool::putBack(PooledSessionHolderPtr pHolder)
 		else --_nSessions;
 
 		_activeSessions.erase(it);
+		updateMetrics();
 	}
 	else
 	{
@@ -263,30 +305,136 @@ void SessionPool::putBack(PooledSessionHolderPtr pHolder)
 
 void SessionPool::onJanitorTimer(Poco::Timer&)
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	if (_shutdown) return;
+	SessionList expired;
+	bool replenish = false;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown) return;
 
-	SessionList::iterator it = _idleSessions.begin(); 
-	while (_nSessions > _minSessions && it != _idleSessions.end())
+		SessionList::iterator it = _idleSessions.begin();
+		while (it != _idleSessions.end())
+		{
+			if (!(*it)->session()->isConnected())
+			{
+				it = _idleSessions.erase(it);
+				--_nSessions;
+			}
+			else if (_nSessions > _minSessions && (*it)->idle() > _idleTime)
+			{
+				expired.push_back(*it);
+				it = _idleSessions.erase(it);
+				--_nSessions;
+			}
+			else ++it;
+		}
+		updateMetrics();
+		replenish = _prewarmEnabled && _nSessions < _minSessions;
+	}
+
+	// close expired sessions without holding the pool lock
+	SessionList::iterator it = expired.begin();
+	for (; it != expired.end(); ++it)
 	{
-		if ((*it)->idle() > _idleTime || !(*it)->session()->isConnected())
-		{	
-			try	{ (*it)->session()->close(); }
-			catch (...) { }
-			it = _idleSessions.erase(it);
+		try	{ (*it)->session()->close(); }
+		catch (...) { }
+	}
+
+	if (replenish && !_prewarmThread.isRunning())
+	{
+		try { _prewarmThread.start(_prewarmRunnable); }
+		catch (Poco::Exception&) { }
+	}
+}
+
+
+void SessionPool::updateMetrics()
+{
+	// Caller must hold _mutex.
+	if (!Poco::Metrics::MetricsRegistry::enabled()) return;
+
+	if (!_pUsedGauge)
+	{
+		Poco::Metrics::MetricsRegistry& registry = Poco::Metrics::MetricsRegistry::defaultRegistry();
+		std::string prefix("poco.sessionPool.");
+		prefix += name();
+		_pUsedGauge = &registry.gauge(prefix + ".usedSessions");
+		_pIdleGauge = &registry.gauge(prefix + ".idleSessions");
+	}
+	_pUsedGauge->set(static_cast<Poco::Int64>(_activeSessions.size()));
+	_pIdleGauge->set(static_cast<Poco::Int64>(_idleSessions.size()));
+}
+
+
+void SessionPool::prewarm()
+{
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+		_prewarmEnabled = true;
+	}
+
+	if (!_prewarmThread.isRunning())
+	{
+		try { _prewarmThread.start(_prewarmRunnable); }
+		catch (Poco::Exception&) { }
+	}
+}
+
+
+void SessionPool::runPrewarm()
+{
+	for (;;)
+	{
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			if (_shutdown || _nSessions >= _minSessions) return;
+			++_nSessions;
+		}
+
+		PooledSessionHolderPtr pHolder;
+		try
+		{
+			Session newSession(SessionFactory::instance().create(_connector, _connectionString));
+			applySettings(newSession.impl());
+			customizeSession(newSession);
+			pHolder = new PooledSessionHolder(*this, newSession.impl());
+		}
+		catch (...)
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
 			--_nSessions;
+			return;
 		}
-		else ++it;
+
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown)
+		{
+			--_nSessions;
+			try { pHolder->session()->close(); }
+			catch (...) { }
+			return;
+		}
+		_idleSessions.push_front(pHolder);
+		updateMetrics();
 	}
 }
 
 
 void SessionPool::shutdown()
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	if (_shutdown) return;
-	_shutdown = true;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_shutdown) return;
+		_shutdown = true;
+	}
+
+	// the janitor and the prewarm thread both acquire the pool
+	// mutex, so they must be stopped without holding it
 	_janitorTimer.stop();
+	try { _prewarmThread.join(); }
+	catch (Poco::Exception&) { }
+
+	Poco::Mutex::ScopedLock lock(_mutex);
 	closeAll(_idleSessions);
 	closeAll(_activeSessions);
 }
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Data/Statement.h"
+#include "Poco/Data/StatementCache.h"
 #include "Poco/Data/DataException.h"
 #include "Poco/Data/Extraction.h"
 #include "Poco/Data/Session.h"
@@ -20,6 +21,8 @@
 #include "Poco/Any.h"
 #include "Poco/Tuple.h"
 #include "Poco/ActiveMethod.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/SingletonHolder.h"
 #include <algorithm>
 
 
@@ -27,6 +30,32 @@ namespace Poco {
 namespace Data {
 
 
+namespace
+{
+	static Poco::SingletonHolder<Poco::ThreadPool> sh;
+}
+
+
+void AsyncExecStarter::start(StatementImpl* /*pOwner*/, Poco::ActiveRunnableBase::Ptr pRunnable)
+{
+	pRunnable->duplicate(); // the runnable releases itself when done
+	try
+	{
+		pool().start(*pRunnable);
+	}
+	catch (Poco::NoThreadAvailableException&)
+	{
+		pRunnable->run();
+	}
+}
+
+
+Poco::ThreadPool& AsyncExecStarter::pool()
+{
+	return *sh.get();
+}
+
+
 Statement::Statement(StatementImpl::Ptr pImpl):
 	_pImpl(pImpl),
 	_async(false)
@@ -55,6 +84,26 @@ Statement::Statement(const Statement& stmt):
 
 Statement::~Statement()
 {
+	try
+	{
+		if (!_pImpl.isNull() && !_async && _pAsyncExec.isNull() &&
+			1 == _pImpl.referenceCount() && done() && _pImpl->canReuse())
+		{
+			StatementCache& cache = _pImpl->session().statementCache();
+			if (cache.getCapacity() > 0)
+			{
+				std::string sql = _pImpl->toString();
+				if (!sql.empty())
+				{
+					_pImpl->unbind();
+					cache.put(sql, _pImpl);
+				}
+			}
+		}
+	}
+	catch (...)
+	{
+	}
 }
 
 
@@ -101,6 +150,7 @@ std::size_t Statement::execute(bool reset)
 
 		if (!isAsync())
 		{
+			if (initialized()) swapWithCached();
 			if (isDone) _pImpl->reset();
 			return _pImpl->execute(reset);
 		}
@@ -114,6 +164,20 @@ std::size_t Statement::execute(bool reset)
 }
 
 
+void Statement::swapWithCached()
+{
+	StatementCache& cache = _pImpl->session().statementCache();
+	if (0 == cache.getCapacity()) return;
+
+	StatementImpl::Ptr pCached = cache.get(_pImpl->toString());
+	if (pCached && pCached->canReuse())
+	{
+		pCached->reuse(*_pImpl);
+		_pImpl = pCached;
+	}
+}
+
+
 const Statement::Result& Statement::executeAsync(bool reset)
 {
 	Mutex::ScopedLock lock(_mutex);
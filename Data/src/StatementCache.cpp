@@ -0,0 +1,95 @@
+//
+// StatementCache.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  StatementCache
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/StatementCache.h"
+#include "Poco/Data/StatementImpl.h"
+
+
+namespace Poco {
+namespace Data {
+
+
+StatementCache::StatementCache(std::size_t capacity):
+	_capacity(capacity),
+	_hits(0),
+	_misses(0)
+{
+}
+
+
+StatementCache::~StatementCache()
+{
+}
+
+
+void StatementCache::setCapacity(std::size_t capacity)
+{
+	_capacity = capacity;
+	while (_index.size() > _capacity)
+	{
+		_index.erase(_lru.back().first);
+		_lru.pop_back();
+	}
+}
+
+
+StatementCache::StatementPtr StatementCache::get(const std::string& sql)
+{
+	IndexMap::iterator it = _index.find(sql);
+	if (it == _index.end())
+	{
+		++_misses;
+		return StatementPtr();
+	}
+
+	++_hits;
+	StatementPtr pStatement = it->second->second;
+	_lru.erase(it->second);
+	_index.erase(it);
+	return pStatement;
+}
+
+
+void StatementCache::put(const std::string& sql, StatementPtr pStatement)
+{
+	poco_check_ptr (pStatement);
+
+	if (0 == _capacity) return;
+
+	IndexMap::iterator it = _index.find(sql);
+	if (it != _index.end())
+	{
+		_lru.erase(it->second);
+		_index.erase(it);
+	}
+
+	_lru.push_front(std::make_pair(sql, pStatement));
+	_index[sql] = _lru.begin();
+
+	while (_index.size() > _capacity)
+	{
+		_index.erase(_lru.back().first);
+		_lru.pop_back();
+	}
+}
+
+
+void StatementCache::clear()
+{
+	_lru.clear();
+	_index.clear();
+}
+
+
+} } // namespace Poco::Data
@@ -196,6 +196,60 @@ void StatementImpl::compile()
 }
 
 
+bool StatementImpl::canReuse() const
+{
+	return false;
+}
+
+
+void StatementImpl::reuseImpl()
+{
+}
+
+
+void StatementImpl::reuse(StatementImpl& stmt)
+{
+	poco_assert (ST_INITIALIZED == stmt._state);
+
+	_bindings = stmt._bindings;
+	_extractors = stmt._extractors;
+	_columnsExtracted.assign(_extractors.size(), 0);
+	_subTotalRowCount.assign(_extractors.size(), 0);
+	_curDataSet = 0;
+	_storage = stmt._storage;
+	_extrLimit = stmt._extrLimit;
+	_lowerLimit = stmt._lowerLimit;
+	_bulkBinding = stmt._bulkBinding;
+	_bulkExtraction = stmt._bulkExtraction;
+	_state = ST_COMPILED;
+
+	reuseImpl();
+
+	if (!extractions().size() && !isStoredProcedure())
+	{
+		std::size_t cols = columnsReturned();
+		if (cols) makeExtractors(cols);
+	}
+
+	fixupExtraction();
+	fixupBinding();
+}
+
+
+void StatementImpl::unbind()
+{
+	_bindings.clear();
+	_extractors.clear();
+	_extractors.resize(1);
+	_columnsExtracted.assign(1, 0);
+	_subTotalRowCount.assign(1, 0);
+	_curDataSet = 0;
+	_bulkBinding = BULK_UNDEFINED;
+	_bulkExtraction = BULK_UNDEFINED;
+	_state = ST_COMPILED;
+}
+
+
 void StatementImpl::bind()
 {
 	if (_state == ST_COMPILED)
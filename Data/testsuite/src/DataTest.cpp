@@ -20,6 +20,7 @@
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
 #include "Poco/Data/SimpleRowFormatter.h"
+#include "Poco/Data/StatementCache.h"
 #include "Poco/Data/DataException.h"
 #include "Connector.h"
 #include "Poco/BinaryReader.h"
@@ -55,6 +56,7 @@ using Poco::NotImplementedException;
 using Poco::Data::Session;
 using Poco::Data::SessionFactory;
 using Poco::Data::Statement;
+using Poco::Data::StatementCache;
 using Poco::Data::NotSupportedException;
 using Poco::Data::CLOB;
 using Poco::Data::CLOBInputStream;
@@ -230,6 +232,47 @@ void DataTest::testProperties()
 }
 
 
+void DataTest::testStatementCache()
+{
+	Session sess(SessionFactory::instance().create("test", "cs"));
+	StatementCache& cache = sess.impl()->statementCache();
+	assert (0 == cache.getCapacity());
+
+	// caching is disabled by default
+	int result = 0;
+	sess << "SELECT 42", into(result), now;
+	assert (0 == cache.size());
+
+	sess.setProperty("statementCacheSize", std::size_t(2));
+	assert (2 == Poco::AnyCast<std::size_t>(sess.getProperty("statementCacheSize")));
+
+	sess << "SELECT 42", into(result), now;
+	assert (1 == cache.size());
+	assert (0 == cache.hits());
+
+	// repeated execution of the same SQL reuses the cached statement
+	sess << "SELECT 42", into(result), now;
+	assert (1 == cache.size());
+	assert (1 == cache.hits());
+
+	// the least recently used statement is evicted when the cache is full
+	sess << "SELECT 43", into(result), now;
+	sess << "SELECT 44", into(result), now;
+	assert (2 == cache.size());
+
+	sess << "SELECT 42", into(result), now;
+	assert (1 == cache.hits());
+
+	// statements kept alive by the application are not affected
+	Statement stmt = (sess << "SELECT 42", into(result));
+	stmt.execute();
+	stmt.execute();
+
+	sess.setProperty("statementCacheSize", std::size_t(0));
+	assert (0 == cache.size());
+}
+
+
 void DataTest::testLOB()
 {
 	std::vector<int> vec;
@@ -1376,6 +1419,7 @@ CppUnit::Test* DataTest::suite()
 	CppUnit_addTest(pSuite, DataTest, testStatementFormatting);
 	CppUnit_addTest(pSuite, DataTest, testFeatures);
 	CppUnit_addTest(pSuite, DataTest, testProperties);
+	CppUnit_addTest(pSuite, DataTest, testStatementCache);
 	CppUnit_addTest(pSuite, DataTest, testLOB);
 	CppUnit_addTest(pSuite, DataTest, testCLOB);
 	CppUnit_addTest(pSuite, DataTest, testCLOBStreams);
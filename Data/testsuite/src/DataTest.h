@@ -31,6 +31,7 @@ public:
 	void testStatementFormatting();
 	void testFeatures();
 	void testProperties();
+	void testStatementCache();
 	void testLOB();
 	void testCLOB();
 	void testCLOBStreams();
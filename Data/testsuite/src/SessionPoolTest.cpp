@@ -211,6 +211,32 @@ void SessionPoolTest::testSessionPool()
 }
 
 
+void SessionPoolTest::testSessionPoolPrewarm()
+{
+	SessionPool pool("test", "cs", 2, 4, 2);
+	assert (pool.allocated() == 0);
+
+	pool.prewarm();
+	// prewarming runs on a background thread
+	for (int i = 0; pool.idle() < 2 && i < 100; ++i)
+		Thread::sleep(10);
+
+	assert (pool.allocated() == 2);
+	assert (pool.idle() == 2);
+	assert (pool.used() == 0);
+
+	// get() is served from the prewarmed sessions
+	Session s1(pool.get());
+	assert (pool.allocated() == 2);
+	assert (pool.used() == 1);
+	assert (pool.idle() == 1);
+
+	pool.shutdown();
+	try { pool.prewarm(); fail ("must fail"); }
+	catch (InvalidAccessException&) { }
+}
+
+
 void SessionPoolTest::testSessionPoolContainer()
 {
 	SessionPoolContainer spc;
@@ -266,6 +292,7 @@ CppUnit::Test* SessionPoolTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SessionPoolTest");
 
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPool);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolPrewarm);
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolContainer);
 
 	return pSuite;
@@ -25,6 +25,7 @@ public:
 	~SessionPoolTest();
 
 	void testSessionPool();
+	void testSessionPoolPrewarm();
 	void testSessionPoolContainer();
 
 	void setUp();
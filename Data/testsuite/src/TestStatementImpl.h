@@ -64,6 +64,10 @@ protected:
 	bool canCompile() const;
 		/// Returns true if statement was not compiled.
 
+	bool canReuse() const;
+		/// Returns true if the statement was compiled, so that it
+		/// can be kept in the session's statement cache.
+
 	void compileImpl();
 		/// Compiles the statement, doesn't bind yet
 
@@ -111,6 +115,12 @@ inline bool TestStatementImpl::canCompile() const
 }
 
 
+inline bool TestStatementImpl::canReuse() const
+{
+	return _compiled;
+}
+
+
 } } } // namespace Poco::Data::Test
 
 
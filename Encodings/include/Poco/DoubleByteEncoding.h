@@ -53,6 +53,13 @@ public:
 	int convert(int ch, unsigned char* bytes, int length) const;
 	int queryConvert(const unsigned char* bytes, int length) const;
 	int sequenceLength(const unsigned char* bytes, int length) const;
+	int convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar = '?') const;
+		/// Converts a whole block of double-byte encoded text in one pass.
+		///
+		/// Runs of US-ASCII bytes are appended verbatim when the destination
+		/// encoding allows it, and double-byte sequences are resolved through
+		/// a per-lead-byte index into the mapping table, avoiding the
+		/// per-character virtual calls of the default implementation.
 
 protected:
 	DoubleByteEncoding(const char** names, const TextEncoding::CharacterMap& charMap, const Mapping mappingTable[], std::size_t mappingTableSize, const Mapping reverseMappingTable[], std::size_t reverseMappingTableSize);
@@ -105,14 +112,25 @@ protected:
 		/// 0x0100 to 0xFFFF for double-byte mappings.
 
 private:
+	struct MappingRange
+	{
+		const Mapping* begin;
+		const Mapping* end;
+	};
+
 	DoubleByteEncoding();
 
+	void buildLeadByteIndex();
+		/// Builds the per-lead-byte index over the (sorted) mapping table,
+		/// so that map() only searches the entries sharing the lead byte.
+
 	const char** _names;
 	const TextEncoding::CharacterMap& _charMap;
 	const Mapping* _mappingTable;
 	const std::size_t _mappingTableSize;
 	const Mapping* _reverseMappingTable;
 	const std::size_t _reverseMappingTableSize;
+	MappingRange _leadByteIndex[256];
 };
 
 
@@ -38,6 +38,7 @@ DoubleByteEncoding::DoubleByteEncoding(const char* names[], const TextEncoding::
 	_reverseMappingTable(reverseMappingTable),
 	_reverseMappingTableSize(reverseMappingTableSize)
 {
+	buildLeadByteIndex();
 }
 
 
@@ -142,6 +143,78 @@ int DoubleByteEncoding::sequenceLength(const unsigned char* bytes, int length) c
 }
 
 
+int DoubleByteEncoding::convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar) const
+{
+	poco_check_ptr (bytes);
+
+	const CharacterMap& outMap = destEncoding.characterMap();
+	bool asciiOut = true;
+	for (int i = 0; i < 128 && asciiOut; ++i)
+		asciiOut = (outMap[i] == i);
+
+	int errors = 0;
+	unsigned char buffer[MAX_SEQUENCE_LENGTH];
+	const unsigned char* it  = bytes;
+	const unsigned char* end = bytes + length;
+	destination.reserve(destination.size() + length);
+	while (it < end)
+	{
+		if (asciiOut)
+		{
+			// batch runs of bytes that decode to themselves
+			const unsigned char* runStart = it;
+			while (it < end && *it < 0x80 && _charMap[*it] == *it) ++it;
+			if (it != runStart)
+			{
+				destination.append(reinterpret_cast<const char*>(runStart), it - runStart);
+				continue;
+			}
+		}
+		int uc = _charMap[*it];
+		if (uc >= 0)
+		{
+			++it;
+		}
+		else if (uc == -2)
+		{
+			if (end - it >= 2)
+			{
+				uc = map(static_cast<Poco::UInt16>((it[0] << 8) | it[1]));
+				it += 2;
+			}
+			else
+			{
+				uc = -1;
+				it = end;
+			}
+			if (uc < 0)
+			{
+				uc = defaultChar;
+				++errors;
+			}
+		}
+		else // invalid lead byte
+		{
+			++it;
+			uc = defaultChar;
+			++errors;
+		}
+		if (asciiOut && uc >= 0 && uc < 128)
+		{
+			destination += (char) uc;
+		}
+		else
+		{
+			int n = destEncoding.convert(uc, buffer, sizeof(buffer));
+			if (n == 0) n = destEncoding.convert(defaultChar, buffer, sizeof(buffer));
+			poco_assert (n <= sizeof(buffer));
+			destination.append((const char*) buffer, n);
+		}
+	}
+	return errors;
+}
+
+
 struct MappingLessThan
 {
 	bool operator () (const DoubleByteEncoding::Mapping& mapping, const Poco::UInt16& key) const
@@ -151,12 +224,31 @@ struct MappingLessThan
 };
 
 
+void DoubleByteEncoding::buildLeadByteIndex()
+{
+	for (int i = 0; i < 256; ++i)
+	{
+		_leadByteIndex[i].begin = 0;
+		_leadByteIndex[i].end   = 0;
+	}
+	const Mapping* it  = _mappingTable;
+	const Mapping* end = _mappingTable + _mappingTableSize;
+	while (it != end)
+	{
+		Poco::UInt16 lead = static_cast<Poco::UInt16>(it->from >> 8);
+		const Mapping* first = it;
+		while (it != end && (it->from >> 8) == lead) ++it;
+		_leadByteIndex[lead].begin = first;
+		_leadByteIndex[lead].end   = it;
+	}
+}
+
+
 int DoubleByteEncoding::map(Poco::UInt16 encoded) const
 {
-	const Mapping* begin = _mappingTable;
-	const Mapping* end = begin + _mappingTableSize;
-	const Mapping* it = std::lower_bound(begin, end, encoded, MappingLessThan());
-	if (it != end && it->from == encoded)
+	const MappingRange& range = _leadByteIndex[encoded >> 8];
+	const Mapping* it = std::lower_bound(range.begin, range.end, encoded, MappingLessThan());
+	if (it != range.end && it->from == encoded)
 		return it->to;
 	else
 		return -1;
@@ -13,6 +13,7 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/ISO8859_4Encoding.h"
 #include "Poco/Windows950Encoding.h"
+#include "Poco/UTF8Encoding.h"
 
 
 DoubleByteEncodingTest::DoubleByteEncodingTest(const std::string& name): CppUnit::TestCase(name)
@@ -104,6 +105,29 @@ void DoubleByteEncodingTest::testDoubleByteReverse()
 }
 
 
+void DoubleByteEncodingTest::testConvertBlock()
+{
+	Poco::Windows950Encoding enc;
+	Poco::UTF8Encoding utf8;
+
+	unsigned char block[] = { 'A', 'B', 0xA1, 0x40, 'C' }; // "AB", IDEOGRAPHIC SPACE, "C"
+	std::string result;
+	assert (enc.convertBlock(block, sizeof(block), utf8, result) == 0);
+	assert (result == "AB\xE3\x80\x80" "C");
+
+	// invalid lead byte and truncated sequence are replaced
+	unsigned char bad[] = { 0x92, 'x', 0xA1 };
+	result.clear();
+	assert (enc.convertBlock(bad, sizeof(bad), utf8, result) == 2);
+	assert (result == "?x?");
+
+	// appends to existing content
+	result = "pre:";
+	assert (enc.convertBlock(block, 2, utf8, result) == 0);
+	assert (result == "pre:AB");
+}
+
+
 void DoubleByteEncodingTest::setUp()
 {
 }
@@ -122,6 +146,7 @@ CppUnit::Test* DoubleByteEncodingTest::suite()
 	CppUnit_addTest(pSuite, DoubleByteEncodingTest, testSingleByteReverse);
 	CppUnit_addTest(pSuite, DoubleByteEncodingTest, testDoubleByte);
 	CppUnit_addTest(pSuite, DoubleByteEncodingTest, testDoubleByteReverse);
+	CppUnit_addTest(pSuite, DoubleByteEncodingTest, testConvertBlock);
 
 	return pSuite;
 }
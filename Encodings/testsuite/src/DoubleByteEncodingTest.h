@@ -27,6 +27,7 @@ public:
 	void testSingleByteReverse();
 	void testDoubleByte();
 	void testDoubleByteReverse();
+	void testConvertBlock();
 
 	void setUp();
 	void tearDown();
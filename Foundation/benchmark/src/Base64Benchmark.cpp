@@ -0,0 +1,77 @@
+//
+// Base64Benchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Base64Encoder.h"
+#include "Poco/Base64Decoder.h"
+#include <sstream>
+#include <vector>
+
+
+using Poco::Base64Encoder;
+using Poco::Base64Decoder;
+
+
+namespace
+{
+	enum
+	{
+		DATA_SIZE = 1024
+	};
+
+	std::string makeData()
+	{
+		std::string data;
+		data.reserve(DATA_SIZE);
+		for (int i = 0; i < DATA_SIZE; i++)
+		{
+			data += char(i % 256);
+		}
+		return data;
+	}
+
+	void encode(int iterations)
+	{
+		std::string data = makeData();
+		for (int i = 0; i < iterations; i++)
+		{
+			std::ostringstream ostr;
+			Base64Encoder encoder(ostr);
+			encoder.write(data.data(), (std::streamsize) data.size());
+			encoder.close();
+		}
+	}
+
+	void decode(int iterations)
+	{
+		std::string data = makeData();
+		std::ostringstream encodedStream;
+		Base64Encoder encoder(encodedStream);
+		encoder.write(data.data(), (std::streamsize) data.size());
+		encoder.close();
+		std::string encoded = encodedStream.str();
+
+		std::vector<char> buffer(DATA_SIZE);
+		for (int i = 0; i < iterations; i++)
+		{
+			std::istringstream istr(encoded);
+			Base64Decoder decoder(istr);
+			decoder.read(&buffer[0], DATA_SIZE);
+		}
+	}
+}
+
+
+void benchmarkBase64()
+{
+	Benchmark::run("Base64 encode (1 KB)", encode, 100000);
+	Benchmark::run("Base64 decode (1 KB)", decode, 100000);
+}
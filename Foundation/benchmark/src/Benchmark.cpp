@@ -0,0 +1,92 @@
+//
+// Benchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmark.h"
+#include "Poco/AtomicCounter.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberFormatter.h"
+#include <iostream>
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+	Poco::AtomicCounter allocationCount;
+}
+
+
+//
+// Counting allocator: every allocation made by the benchmark
+// executable (including ones inside PocoFoundation) goes through
+// these overrides.
+//
+
+
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+	void* ptr = std::malloc(size ? size : 1);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+
+
+void* operator new[](std::size_t size)
+{
+	++allocationCount;
+	void* ptr = std::malloc(size ? size : 1);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+
+
+void operator delete(void* ptr) throw()
+{
+	std::free(ptr);
+}
+
+
+void operator delete[](void* ptr) throw()
+{
+	std::free(ptr);
+}
+
+
+void Benchmark::run(const std::string& name, Function function, int iterations)
+{
+	// warm up caches and lazily-initialized state
+	function(iterations/100 + 1);
+
+	Poco::Int64 allocationsBefore = allocations();
+	Poco::Stopwatch stopwatch;
+	stopwatch.start();
+	function(iterations);
+	stopwatch.stop();
+	Poco::Int64 allocationsAfter = allocations();
+
+	double seconds = stopwatch.elapsed()/double(Poco::Stopwatch::resolution());
+	double opsPerSecond = seconds > 0 ? iterations/seconds : 0;
+	double allocsPerOp = double(allocationsAfter - allocationsBefore)/iterations;
+
+	std::string line(name);
+	while (line.size() < 40) line += ' ';
+	line += Poco::NumberFormatter::format(opsPerSecond, 0);
+	line += " ops/s  ";
+	line += Poco::NumberFormatter::format(allocsPerOp, 2);
+	line += " allocs/op";
+	std::cout << line << std::endl;
+}
+
+
+Poco::Int64 Benchmark::allocations()
+{
+	return allocationCount.value();
+}
@@ -0,0 +1,45 @@
+//
+// Benchmark.h
+//
+// Definition of the Benchmark class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Benchmark_INCLUDED
+#define Benchmark_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+
+
+class Benchmark
+	/// A simple harness for microbenchmarks.
+	///
+	/// Each benchmark is a function running a given number of
+	/// iterations of the measured operation. The harness times
+	/// the function and reports the achieved operations per
+	/// second, together with the number of heap allocations
+	/// per operation (counted via overridden global operator
+	/// new; approximate if other threads allocate concurrently).
+{
+public:
+	typedef void (*Function)(int iterations);
+
+	static void run(const std::string& name, Function function, int iterations);
+		/// Runs the given benchmark function with the given number
+		/// of iterations and prints name, iterations, operations
+		/// per second and heap allocations per operation.
+
+	static Poco::Int64 allocations();
+		/// Returns the number of heap allocations made by the
+		/// process so far.
+};
+
+
+#endif // Benchmark_INCLUDED
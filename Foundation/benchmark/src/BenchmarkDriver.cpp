@@ -0,0 +1,35 @@
+//
+// BenchmarkDriver.cpp
+//
+// Console application entry point for the Foundation benchmarks.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include <iostream>
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		benchmarkNumber();
+		benchmarkNotificationQueue();
+		benchmarkThreadPool();
+		benchmarkLRUCache();
+		benchmarkBase64();
+		benchmarkDateTimeFormatter();
+		benchmarkChecksum();
+	}
+	catch (std::exception& exc)
+	{
+		std::cerr << exc.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,26 @@
+//
+// Benchmarks.h
+//
+// Declarations of the individual benchmark groups.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Benchmarks_INCLUDED
+#define Benchmarks_INCLUDED
+
+
+void benchmarkNumber();
+void benchmarkNotificationQueue();
+void benchmarkThreadPool();
+void benchmarkLRUCache();
+void benchmarkBase64();
+void benchmarkDateTimeFormatter();
+void benchmarkChecksum();
+
+
+#endif // Benchmarks_INCLUDED
@@ -0,0 +1,65 @@
+//
+// ChecksumBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/Checksum.h"
+#include <vector>
+
+
+using Poco::Checksum;
+
+
+namespace
+{
+	enum
+	{
+		BLOCK_SIZE = 4096
+	};
+
+	std::vector<char> makeBlock()
+	{
+		std::vector<char> block(BLOCK_SIZE);
+		for (int i = 0; i < BLOCK_SIZE; i++)
+		{
+			block[i] = char(i % 256);
+		}
+		return block;
+	}
+
+	void crc32(int iterations)
+	{
+		std::vector<char> block = makeBlock();
+		Checksum checksum(Checksum::TYPE_CRC32);
+		for (int i = 0; i < iterations; i++)
+		{
+			checksum.update(&block[0], BLOCK_SIZE);
+		}
+		poco_assert_dbg (checksum.checksum() != 0);
+	}
+
+	void adler32(int iterations)
+	{
+		std::vector<char> block = makeBlock();
+		Checksum checksum(Checksum::TYPE_ADLER32);
+		for (int i = 0; i < iterations; i++)
+		{
+			checksum.update(&block[0], BLOCK_SIZE);
+		}
+		poco_assert_dbg (checksum.checksum() != 0);
+	}
+}
+
+
+void benchmarkChecksum()
+{
+	Benchmark::run("Checksum CRC-32 (4 KB)", crc32, 200000);
+	Benchmark::run("Checksum Adler-32 (4 KB)", adler32, 200000);
+}
@@ -0,0 +1,68 @@
+//
+// DateTimeFormatterBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/DateTime.h"
+#include "Poco/Timestamp.h"
+
+
+using Poco::DateTimeFormatter;
+using Poco::DateTimeFormat;
+using Poco::DateTime;
+using Poco::Timestamp;
+
+
+namespace
+{
+	void formatISO8601(int iterations)
+	{
+		DateTime dateTime;
+		std::string result;
+		for (int i = 0; i < iterations; i++)
+		{
+			result.clear();
+			DateTimeFormatter::append(result, dateTime, DateTimeFormat::ISO8601_FORMAT);
+		}
+	}
+
+	void formatSortable(int iterations)
+	{
+		DateTime dateTime;
+		std::string result;
+		for (int i = 0; i < iterations; i++)
+		{
+			result.clear();
+			DateTimeFormatter::append(result, dateTime, DateTimeFormat::SORTABLE_FORMAT);
+		}
+	}
+
+	void formatFromTimestamp(int iterations)
+	{
+		// includes the Timestamp to DateTime conversion
+		Timestamp timestamp;
+		std::string result;
+		for (int i = 0; i < iterations; i++)
+		{
+			result.clear();
+			DateTimeFormatter::append(result, timestamp, DateTimeFormat::ISO8601_FORMAT);
+		}
+	}
+}
+
+
+void benchmarkDateTimeFormatter()
+{
+	Benchmark::run("DateTimeFormatter ISO8601", formatISO8601, 1000000);
+	Benchmark::run("DateTimeFormatter sortable", formatSortable, 1000000);
+	Benchmark::run("DateTimeFormatter from Timestamp", formatFromTimestamp, 1000000);
+}
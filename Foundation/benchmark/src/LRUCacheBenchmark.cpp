@@ -0,0 +1,74 @@
+//
+// LRUCacheBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/LRUCache.h"
+#include "Poco/SharedPtr.h"
+
+
+using Poco::LRUCache;
+using Poco::SharedPtr;
+
+
+namespace
+{
+	enum
+	{
+		CACHE_SIZE = 1024
+	};
+
+	void cacheAdd(int iterations)
+	{
+		LRUCache<int, int> cache(CACHE_SIZE);
+		for (int i = 0; i < iterations; i++)
+		{
+			cache.add(i, i);
+		}
+	}
+
+	void cacheGetHit(int iterations)
+	{
+		LRUCache<int, int> cache(CACHE_SIZE);
+		for (int i = 0; i < CACHE_SIZE; i++)
+		{
+			cache.add(i, i);
+		}
+		int sum = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			SharedPtr<int> pValue = cache.get(i % CACHE_SIZE);
+			if (pValue) sum += *pValue;
+		}
+		poco_assert_dbg (sum != 1);
+	}
+
+	void cacheGetMiss(int iterations)
+	{
+		LRUCache<int, int> cache(CACHE_SIZE);
+		for (int i = 0; i < CACHE_SIZE; i++)
+		{
+			cache.add(i, i);
+		}
+		for (int i = 0; i < iterations; i++)
+		{
+			SharedPtr<int> pValue = cache.get(CACHE_SIZE + i);
+			poco_assert_dbg (!pValue);
+		}
+	}
+}
+
+
+void benchmarkLRUCache()
+{
+	Benchmark::run("LRUCache add (with eviction)", cacheAdd, 1000000);
+	Benchmark::run("LRUCache get (hit)", cacheGetHit, 1000000);
+	Benchmark::run("LRUCache get (miss)", cacheGetMiss, 1000000);
+}
@@ -0,0 +1,76 @@
+//
+// NotificationQueueBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/AutoPtr.h"
+
+
+using Poco::NotificationQueue;
+using Poco::Notification;
+using Poco::AutoPtr;
+
+
+namespace
+{
+	void enqueueDequeue(int iterations)
+	{
+		NotificationQueue queue;
+		for (int i = 0; i < iterations; i++)
+		{
+			queue.enqueueNotification(new Notification);
+			AutoPtr<Notification> pNf(queue.dequeueNotification());
+		}
+	}
+
+	void enqueueDequeueReused(int iterations)
+	{
+		// same as above, but reusing one notification object,
+		// isolating the queue overhead from the allocation
+		NotificationQueue queue;
+		AutoPtr<Notification> pShared(new Notification);
+		for (int i = 0; i < iterations; i++)
+		{
+			queue.enqueueNotification(AutoPtr<Notification>(pShared));
+			AutoPtr<Notification> pNf(queue.dequeueNotification());
+		}
+	}
+
+	void enqueueDequeueBatch(int iterations)
+	{
+		const int batchSize = 64;
+		NotificationQueue queue;
+		std::vector<Notification::Ptr> batch;
+		batch.reserve(batchSize);
+		int i = 0;
+		while (i < iterations)
+		{
+			int count = 0;
+			while (count < batchSize && i + count < iterations)
+			{
+				queue.enqueueNotification(new Notification);
+				++count;
+			}
+			queue.dequeueBatch(batch, count);
+			batch.clear();
+			i += count;
+		}
+	}
+}
+
+
+void benchmarkNotificationQueue()
+{
+	Benchmark::run("NotificationQueue enqueue/dequeue", enqueueDequeue, 1000000);
+	Benchmark::run("NotificationQueue reused notification", enqueueDequeueReused, 1000000);
+	Benchmark::run("NotificationQueue batch(64)", enqueueDequeueBatch, 1000000);
+}
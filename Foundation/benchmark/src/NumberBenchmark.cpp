@@ -0,0 +1,73 @@
+//
+// NumberBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+
+
+using Poco::NumberFormatter;
+using Poco::NumberParser;
+
+
+namespace
+{
+	void formatInt(int iterations)
+	{
+		std::string result;
+		for (int i = 0; i < iterations; i++)
+		{
+			result.clear();
+			NumberFormatter::append(result, i);
+		}
+	}
+
+	void formatDouble(int iterations)
+	{
+		std::string result;
+		for (int i = 0; i < iterations; i++)
+		{
+			result.clear();
+			NumberFormatter::append(result, i*0.5, 2);
+		}
+	}
+
+	void parseInt(int iterations)
+	{
+		static const std::string value("1234567890");
+		int sum = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			sum += NumberParser::parse(value);
+		}
+		poco_assert_dbg (sum != 1);
+	}
+
+	void parseFloat(int iterations)
+	{
+		static const std::string value("12345.6789");
+		double sum = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			sum += NumberParser::parseFloat(value);
+		}
+		poco_assert_dbg (sum > 0);
+	}
+}
+
+
+void benchmarkNumber()
+{
+	Benchmark::run("NumberFormatter::append(int)", formatInt, 5000000);
+	Benchmark::run("NumberFormatter::append(double)", formatDouble, 1000000);
+	Benchmark::run("NumberParser::parse(int)", parseInt, 5000000);
+	Benchmark::run("NumberParser::parseFloat", parseFloat, 1000000);
+}
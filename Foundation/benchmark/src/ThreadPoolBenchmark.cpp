@@ -0,0 +1,74 @@
+//
+// ThreadPoolBenchmark.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/AtomicCounter.h"
+#include "Poco/Exception.h"
+
+
+using Poco::ThreadPool;
+using Poco::Runnable;
+using Poco::Thread;
+using Poco::AtomicCounter;
+
+
+namespace
+{
+	class NoopRunnable: public Runnable
+	{
+	public:
+		NoopRunnable(AtomicCounter& counter):
+			_counter(counter)
+		{
+		}
+
+		void run()
+		{
+			++_counter;
+		}
+
+	private:
+		AtomicCounter& _counter;
+	};
+
+	void dispatch(int iterations)
+	{
+		ThreadPool pool;
+		AtomicCounter counter;
+		NoopRunnable runnable(counter);
+		for (int i = 0; i < iterations; i++)
+		{
+			for (;;)
+			{
+				try
+				{
+					pool.start(runnable);
+					break;
+				}
+				catch (Poco::NoThreadAvailableException&)
+				{
+					Thread::yield();
+				}
+			}
+		}
+		pool.joinAll();
+		poco_assert (counter.value() == iterations);
+	}
+}
+
+
+void benchmarkThreadPool()
+{
+	Benchmark::run("ThreadPool dispatch", dispatch, 50000);
+}
@@ -24,6 +24,9 @@
 #include "Poco/ActiveResult.h"
 #include "Poco/ActiveMethod.h"
 #include "Poco/Mutex.h"
+#include <atomic>
+#include <memory>
+#include <utility>
 
 
 namespace Poco {
@@ -147,6 +150,11 @@ class AbstractEvent
 	/// Working with PriorityDelegate's as similar to working with BasicEvent.
 	/// Instead of delegate(), the priorityDelegate() function must be used
 	/// to create the PriorityDelegate.
+	///
+	/// Firing an event does not lock the event's mutex and does not copy the
+	/// delegate list. Instead, notifying threads read an immutable snapshot of
+	/// the strategy, which is republished whenever the delegate list changes.
+	/// The TStrategy's notify() method must therefore not modify the strategy.
 {
 public:
 	typedef TDelegate* DelegateHandle;
@@ -163,6 +171,7 @@ public:
 		_strategy(strat),
 		_enabled(true)
 	{
+		publishStrategy();
 	}
 
 	virtual ~AbstractEvent()
@@ -176,6 +185,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.add(aDelegate);
+		publishStrategy();
 	}
 
 	void operator -= (const TDelegate& aDelegate)
@@ -185,6 +195,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.remove(aDelegate);
+		publishStrategy();
 	}
 
 	DelegateHandle add(const TDelegate& aDelegate)
@@ -196,7 +207,9 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.add(aDelegate);
+		DelegateHandle handle = _strategy.add(aDelegate);
+		publishStrategy();
+		return handle;
 	}
 
 	void remove(DelegateHandle delegateHandle)
@@ -207,6 +220,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.remove(delegateHandle);
+		publishStrategy();
 	}
 
 	void operator () (const void* pSender, TArgs& args)
@@ -221,6 +235,20 @@ public:
 		notify(0, args);
 	}
 
+	void operator () (const void* pSender, TArgs&& args)
+		/// Shortcut for notify(pSender, args), accepting
+		/// a temporary argument.
+	{
+		notify(pSender, std::move(args));
+	}
+
+	void operator () (TArgs&& args)
+		/// Shortcut for notify(args), accepting
+		/// a temporary argument.
+	{
+		notify(0, std::move(args));
+	}
+
 	void notify(const void* pSender, TArgs& args)
 		/// Sends a notification to all registered delegates. The order is
 		/// determined by the TStrategy. This method is blocking. While executing,
@@ -231,17 +259,27 @@ public:
 		/// invoked prior to removal). If one of the delegates throws an exception,
 		/// the notify method is immediately aborted and the exception is propagated
 		/// to the caller.
+		///
+		/// Firing the event neither locks nor copies the delegate list;
+		/// the delegates are invoked through the currently published
+		/// snapshot of the strategy.
 	{
-		Poco::ScopedLockWithUnlock<TMutex> lock(_mutex);
+		if (!_enabled.load()) return;
 
-		if (!_enabled) return;
+		std::shared_ptr<TStrategy> pStrategy = std::atomic_load(&_pStrategy);
+		if (pStrategy) pStrategy->notify(pSender, args);
+	}
 
-		// thread-safeness:
-		// copy should be faster and safer than blocking until
-		// execution ends
-		TStrategy strategy(_strategy);
-		lock.unlock();
-		strategy.notify(pSender, args);
+	void notify(const void* pSender, TArgs&& args)
+		/// Sends a notification to all registered delegates, accepting
+		/// a temporary as argument. See notify(const void*, TArgs&)
+		/// for the semantics.
+		///
+		/// Note that since delegates receive the argument by reference,
+		/// any modifications they make are lost when the temporary is
+		/// destroyed upon return.
+	{
+		notify(pSender, args);
 	}
 
 	bool hasDelegates() const {
@@ -280,7 +318,6 @@ public:
 	void enable()
 		/// Enables the event.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
 		_enabled = true;
 	}
 
@@ -288,14 +325,12 @@ public:
 		/// Disables the event. notify and notifyAsnyc will be ignored,
 		/// but adding/removing delegates is still allowed.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
 		_enabled = false;
 	}
 
 	bool isEnabled() const
 	{
-		typename TMutex::ScopedLock lock(_mutex);
-		return _enabled;
+		return _enabled.load();
 	}
 
 	void clear()
@@ -303,6 +338,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.clear();
+		publishStrategy();
 	}
 
 	bool empty() const
@@ -341,9 +377,21 @@ protected:
 		return retArgs;
 	}
 
+	void publishStrategy()
+		/// Publishes a new snapshot of the strategy, to be read
+		/// by notifying threads without locking. Must be called
+		/// whenever the delegate list changes, with _mutex held.
+	{
+		if (_strategy.empty())
+			std::atomic_store(&_pStrategy, std::shared_ptr<TStrategy>());
+		else
+			std::atomic_store(&_pStrategy, std::make_shared<TStrategy>(_strategy));
+	}
+
 	TStrategy _strategy; /// The strategy used to notify observers.
-	bool      _enabled;  /// Stores if an event is enabled. Notfies on disabled events have no effect
-	                     /// but it is possible to change the observers.
+	std::shared_ptr<TStrategy> _pStrategy; /// The published snapshot of the strategy.
+	std::atomic<bool> _enabled; /// Stores if an event is enabled. Notifies on disabled events have no effect
+	                            /// but it is possible to change the observers.
 	mutable TMutex _mutex;
 
 private:
@@ -369,6 +417,7 @@ public:
 		_strategy(strat),
 		_enabled(true)
 	{
+		publishStrategy();
 	}
 
 	virtual ~AbstractEvent()
@@ -382,6 +431,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.add(aDelegate);
+		publishStrategy();
 	}
 
 	void operator -= (const TDelegate& aDelegate)
@@ -391,6 +441,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.remove(aDelegate);
+		publishStrategy();
 	}
 
 	DelegateHandle add(const TDelegate& aDelegate)
@@ -402,7 +453,9 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.add(aDelegate);
+		DelegateHandle handle = _strategy.add(aDelegate);
+		publishStrategy();
+		return handle;
 	}
 
 	void remove(DelegateHandle delegateHandle)
@@ -413,6 +466,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.remove(delegateHandle);
+		publishStrategy();
 	}
 
 	void operator () (const void* pSender)
@@ -437,17 +491,15 @@ public:
 		/// invoked prior to removal). If one of the delegates throws an exception,
 		/// the notify method is immediately aborted and the exception is propagated
 		/// to the caller.
+		///
+		/// Firing the event neither locks nor copies the delegate list;
+		/// the delegates are invoked through the currently published
+		/// snapshot of the strategy.
 	{
-		Poco::ScopedLockWithUnlock<TMutex> lock(_mutex);
-
-		if (!_enabled) return;
+		if (!_enabled.load()) return;
 
-		// thread-safeness:
-		// copy should be faster and safer than blocking until
-		// execution ends
-		TStrategy strategy(_strategy);
-		lock.unlock();
-		strategy.notify(pSender);
+		std::shared_ptr<TStrategy> pStrategy = std::atomic_load(&_pStrategy);
+		if (pStrategy) pStrategy->notify(pSender);
 	}
 
 	ActiveResult<void> notifyAsync(const void* pSender)
@@ -482,7 +534,6 @@ public:
 	void enable()
 		/// Enables the event.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
 		_enabled = true;
 	}
 
@@ -490,14 +541,12 @@ public:
 		/// Disables the event. notify and notifyAsnyc will be ignored,
 		/// but adding/removing delegates is still allowed.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
 		_enabled = false;
 	}
 
 	bool isEnabled() const
 	{
-		typename TMutex::ScopedLock lock(_mutex);
-		return _enabled;
+		return _enabled.load();
 	}
 
 	void clear()
@@ -505,6 +554,7 @@ public:
 	{
 		typename TMutex::ScopedLock lock(_mutex);
 		_strategy.clear();
+		publishStrategy();
 	}
 
 	bool empty() const
@@ -541,9 +591,21 @@ protected:
 		return;
 	}
 
+	void publishStrategy()
+		/// Publishes a new snapshot of the strategy, to be read
+		/// by notifying threads without locking. Must be called
+		/// whenever the delegate list changes, with _mutex held.
+	{
+		if (_strategy.empty())
+			std::atomic_store(&_pStrategy, std::shared_ptr<TStrategy>());
+		else
+			std::atomic_store(&_pStrategy, std::make_shared<TStrategy>(_strategy));
+	}
+
 	TStrategy _strategy; /// The strategy used to notify observers.
-	bool      _enabled;  /// Stores if an event is enabled. Notfies on disabled events have no effect
-	                     /// but it is possible to change the observers.
+	std::shared_ptr<TStrategy> _pStrategy; /// The published snapshot of the strategy.
+	std::atomic<bool> _enabled; /// Stores if an event is enabled. Notifies on disabled events have no effect
+	                            /// but it is possible to change the observers.
 	mutable TMutex _mutex;
 
 private:
@@ -0,0 +1,61 @@
+//
+// AccessBucketExpireCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  AccessBucketExpireCache
+//
+// Definition of the AccessBucketExpireCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_AccessBucketExpireCache_INCLUDED
+#define Foundation_AccessBucketExpireCache_INCLUDED
+
+
+#include "Poco/AbstractCache.h"
+#include "Poco/AccessBucketExpireStrategy.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class TMutex = FastMutex,
+	class TEventMutex = FastMutex
+>
+class AccessBucketExpireCache: public AbstractCache<TKey, TValue, AccessBucketExpireStrategy<TKey, TValue>, TMutex, TEventMutex>
+	/// An AccessBucketExpireCache expires entries after they have not
+	/// been accessed for a given time period (per default 10 minutes),
+	/// like an AccessExpireCache, but uses the bucketed expiry of
+	/// BucketExpireCache so both accesses and sweeps stay O(1)
+	/// amortized. Entries may outlive their expiration time by up to
+	/// one bucket width, but never expire early.
+{
+public:
+	AccessBucketExpireCache(Timestamp::TimeDiff expire = 600000, std::size_t bucketCount = BucketExpireStrategy<TKey, TValue>::DEFAULT_BUCKET_COUNT):
+		AbstractCache<TKey, TValue, AccessBucketExpireStrategy<TKey, TValue>, TMutex, TEventMutex>(AccessBucketExpireStrategy<TKey, TValue>(expire, bucketCount))
+	{
+	}
+
+	~AccessBucketExpireCache()
+	{
+	}
+
+private:
+	AccessBucketExpireCache(const AccessBucketExpireCache& aCache);
+	AccessBucketExpireCache& operator = (const AccessBucketExpireCache& aCache);
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_AccessBucketExpireCache_INCLUDED
@@ -0,0 +1,76 @@
+//
+// AccessBucketExpireStrategy.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  AccessBucketExpireStrategy
+//
+// Definition of the AccessBucketExpireStrategy class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_AccessBucketExpireStrategy_INCLUDED
+#define Foundation_AccessBucketExpireStrategy_INCLUDED
+
+
+#include "Poco/KeyValueArgs.h"
+#include "Poco/ValidArgs.h"
+#include "Poco/BucketExpireStrategy.h"
+#include "Poco/Timestamp.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue
+>
+class AccessBucketExpireStrategy: public BucketExpireStrategy<TKey, TValue>
+	/// An AccessBucketExpireStrategy implements time and access based
+	/// expiration of cache entries on top of the bucketed expiry of
+	/// BucketExpireStrategy. A get refiles the entry under the bucket
+	/// covering the access time, which is a constant-time operation
+	/// compared to AccessExpireStrategy's multimap reinsertion.
+{
+public:
+	AccessBucketExpireStrategy(Timestamp::TimeDiff expireTimeInMilliSec, std::size_t bucketCount = BucketExpireStrategy<TKey, TValue>::DEFAULT_BUCKET_COUNT):
+		BucketExpireStrategy<TKey, TValue>(expireTimeInMilliSec, bucketCount)
+		/// Create an expire strategy. Note that the smallest allowed caching time is 25ms.
+	{
+	}
+
+	~AccessBucketExpireStrategy()
+	{
+	}
+
+	void onGet(const void*, const TKey& key)
+	{
+		// get triggers an update to the expiration time
+		typename BucketExpireStrategy<TKey, TValue>::Iterator it = this->_keys.find(key);
+		if (it != this->_keys.end())
+		{
+			if (!this->isExpired(it->second)) // don't extend if already expired
+			{
+				UInt64 bucketId = this->currentBucket();
+				if (bucketId != it->second)
+				{
+					this->removeFromBucket(key, it->second);
+					this->_buckets[bucketId].insert(key);
+					it->second = bucketId;
+				}
+			}
+		}
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_AccessBucketExpireStrategy_INCLUDED
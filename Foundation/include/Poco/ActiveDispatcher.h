@@ -24,11 +24,16 @@
 #include "Poco/ActiveStarter.h"
 #include "Poco/ActiveRunnable.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
 
 
 namespace Poco {
 
 
+class ActiveExecutor;
+
+
 class Foundation_API ActiveDispatcher: protected Runnable
 	/// This class is used to implement an active object
 	/// with strictly serialized method execution.
@@ -78,6 +83,16 @@ public:
 		/// Creates the ActiveDispatcher and sets
 		/// the priority of its thread.
 
+	ActiveDispatcher(ActiveExecutor& executor);
+		/// Creates the ActiveDispatcher in shared-executor mode:
+		/// instead of running its methods in a thread of its own,
+		/// the dispatcher is multiplexed onto the given executor's
+		/// thread pool, together with any number of other
+		/// dispatchers. Methods still execute strictly serialized
+		/// and in FIFO order.
+		///
+		/// The executor must outlive the dispatcher.
+
 	virtual ~ActiveDispatcher();
 		/// Destroys the ActiveDispatcher.
 
@@ -92,8 +107,21 @@ protected:
 	void stop();
 
 private:
+	void drain();
+		/// Executes all currently queued methods on behalf of the
+		/// shared executor. If new methods have been enqueued in the
+		/// meantime, the dispatcher puts itself at the back of the
+		/// executor's ready queue again, so other dispatchers are
+		/// not starved.
+
 	Thread            _thread;
 	NotificationQueue _queue;
+	ActiveExecutor*   _pExecutor;
+	bool              _scheduled;
+	FastMutex         _stateMutex;
+	Condition         _unscheduled;
+
+	friend class ActiveExecutor;
 };
 
 
@@ -0,0 +1,97 @@
+//
+// ActiveExecutor.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ActiveObjects
+//
+// Definition of the ActiveExecutor class.
+//
+// Copyright (c) 2006-2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ActiveExecutor_INCLUDED
+#define Foundation_ActiveExecutor_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Runnable.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+
+
+namespace Poco {
+
+
+class ActiveDispatcher;
+class ThreadPool;
+
+
+class Foundation_API ActiveExecutor: protected Runnable
+	/// A shared executor for ActiveDispatcher objects.
+	///
+	/// Instead of giving every dispatcher a thread of its own, an
+	/// ActiveExecutor multiplexes any number of dispatchers onto a
+	/// fixed set of worker threads taken from a ThreadPool, so the
+	/// active object pattern scales to very large numbers of
+	/// objects.
+	///
+	/// Per-dispatcher ordering is preserved: a dispatcher is
+	/// executed by at most one worker at a time, and its methods
+	/// run in the order they were started. Methods of different
+	/// dispatchers run concurrently.
+	///
+	/// The executor must outlive the dispatchers using it, and must
+	/// only be stopped after all of them have been stopped.
+{
+public:
+	ActiveExecutor(ThreadPool& pool, int workers = 0);
+		/// Creates the ActiveExecutor and starts its workers on the
+		/// given thread pool. If workers is 0, one worker is started
+		/// for every currently available pool thread. The workers
+		/// occupy their pool threads until the executor is stopped.
+		///
+		/// Throws a NoThreadAvailableException if not even one
+		/// worker can be started.
+
+	~ActiveExecutor();
+		/// Stops the workers and destroys the ActiveExecutor.
+
+	void stop();
+		/// Stops all workers after the dispatchers already in the
+		/// ready queue have been executed, and waits for them to
+		/// finish. Must not be called while dispatchers are still
+		/// enqueuing methods.
+
+protected:
+	void schedule(ActiveDispatcher* pDispatcher);
+		/// Puts the given dispatcher at the back of the ready queue.
+
+	void run();
+		/// The worker entry point: executes ready dispatchers until
+		/// the executor is stopped.
+
+private:
+	ActiveExecutor();
+	ActiveExecutor(const ActiveExecutor&);
+	ActiveExecutor& operator = (const ActiveExecutor&);
+
+	NotificationQueue _readyQueue;
+	int               _activeWorkers;
+	bool              _stopped;
+	FastMutex         _mutex;
+	Condition         _workersDone;
+
+	friend class ActiveDispatcher;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ActiveExecutor_INCLUDED
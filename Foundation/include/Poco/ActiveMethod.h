@@ -23,6 +23,7 @@
 #include "Poco/ActiveRunnable.h"
 #include "Poco/ActiveStarter.h"
 #include "Poco/AutoPtr.h"
+#include <utility>
 
 
 namespace Poco {
@@ -92,7 +93,17 @@ public:
 		StarterType::start(_pOwner, pRunnable);
 		return result;
 	}
-		
+
+	ActiveResultType operator () (ArgType&& arg)
+		/// Invokes the ActiveMethod, moving the argument
+		/// into the execution thread instead of copying it.
+	{
+		ActiveResultType result(new ActiveResultHolder<ResultType>());
+		ActiveRunnableBase::Ptr pRunnable(new ActiveRunnableType(_pOwner, _method, std::move(arg), result));
+		StarterType::start(_pOwner, pRunnable);
+		return result;
+	}
+
 	ActiveMethod(const ActiveMethod& other):
 		_pOwner(other._pOwner),
 		_method(other._method)
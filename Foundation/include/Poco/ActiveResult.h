@@ -22,6 +22,7 @@
 #include "Poco/Mutex.h"
 #include "Poco/Event.h"
 #include "Poco/RefCountedObject.h"
+#include "Poco/MemoryPool.h"
 #include "Poco/Exception.h"
 #include <algorithm>
 
@@ -30,12 +31,15 @@ namespace Poco {
 
 
 template <class ResultType>
-class ActiveResultHolder: public RefCountedObject
+class ActiveResultHolder: public RefCountedObject, public PooledObject<ActiveResultHolder<ResultType> >
 	/// This class holds the result of an asynchronous method
 	/// invocation. It is used to pass the result from the
-	/// execution thread back to the invocation thread. 
+	/// execution thread back to the invocation thread.
 	/// The class uses reference counting for memory management.
 	/// Do not use this class directly, use ActiveResult instead.
+	///
+	/// Instances are allocated from a MemoryPool to keep
+	/// asynchronous method invocations off the global heap.
 {
 public:
 	ActiveResultHolder():
@@ -142,7 +146,7 @@ private:
 
 
 template <>
-class ActiveResultHolder<void>: public RefCountedObject
+class ActiveResultHolder<void>: public RefCountedObject, public PooledObject<ActiveResultHolder<void> >
 {
 public:
 	ActiveResultHolder():
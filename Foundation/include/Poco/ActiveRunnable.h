@@ -22,8 +22,10 @@
 #include "Poco/ActiveResult.h"
 #include "Poco/Runnable.h"
 #include "Poco/RefCountedObject.h"
+#include "Poco/MemoryPool.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Exception.h"
+#include <utility>
 
 
 namespace Poco {
@@ -38,7 +40,7 @@ public:
 
 
 template <class ResultType, class ArgType, class OwnerType>
-class ActiveRunnable: public ActiveRunnableBase
+class ActiveRunnable: public ActiveRunnableBase, public PooledObject<ActiveRunnable<ResultType, ArgType, OwnerType> >
 	/// This class is used by ActiveMethod.
 	/// See the ActiveMethod class for more information.
 {
@@ -55,6 +57,15 @@ public:
 		poco_check_ptr (pOwner);
 	}
 
+	ActiveRunnable(OwnerType* pOwner, Callback method, ArgType&& arg, const ActiveResultType& result):
+		_pOwner(pOwner),
+		_method(method),
+		_arg(std::move(arg)),
+		_result(result)
+	{
+		poco_check_ptr (pOwner);
+	}
+
 	void run()
 	{
 		ActiveRunnableBase::Ptr guard(this, false); // ensure automatic release when done
@@ -86,7 +97,7 @@ private:
 
 
 template <class ArgType, class OwnerType>
-class ActiveRunnable<void, ArgType, OwnerType>: public ActiveRunnableBase
+class ActiveRunnable<void, ArgType, OwnerType>: public ActiveRunnableBase, public PooledObject<ActiveRunnable<void, ArgType, OwnerType> >
 	/// This class is used by ActiveMethod.
 	/// See the ActiveMethod class for more information.
 {
@@ -103,6 +114,15 @@ public:
 		poco_check_ptr (pOwner);
 	}
 
+	ActiveRunnable(OwnerType* pOwner, Callback method, ArgType&& arg, const ActiveResultType& result):
+		_pOwner(pOwner),
+		_method(method),
+		_arg(std::move(arg)),
+		_result(result)
+	{
+		poco_check_ptr (pOwner);
+	}
+
 	void run()
 	{
 		ActiveRunnableBase::Ptr guard(this, false); // ensure automatic release when done
@@ -134,7 +154,7 @@ private:
 
 
 template <class ResultType, class OwnerType>
-class ActiveRunnable<ResultType, void, OwnerType>: public ActiveRunnableBase
+class ActiveRunnable<ResultType, void, OwnerType>: public ActiveRunnableBase, public PooledObject<ActiveRunnable<ResultType, void, OwnerType> >
 	/// This class is used by ActiveMethod.
 	/// See the ActiveMethod class for more information.
 {
@@ -180,7 +200,7 @@ private:
 
 
 template <class OwnerType>
-class ActiveRunnable<void, void, OwnerType>: public ActiveRunnableBase
+class ActiveRunnable<void, void, OwnerType>: public ActiveRunnableBase, public PooledObject<ActiveRunnable<void, void, OwnerType> >
 	/// This class is used by ActiveMethod.
 	/// See the ActiveMethod class for more information.
 {
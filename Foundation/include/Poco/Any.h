@@ -37,9 +37,15 @@ template <class> class VarHolderImpl;
 
 }
 
+
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+	#define POCO_ANY_HAVE_CPP11
+#endif
+
+
 #ifndef POCO_NO_SOO
 
-#ifndef POCO_ENABLE_CPP11
+#ifndef POCO_ANY_HAVE_CPP11
 	// C++11 needed for std::aligned_storage
 	#error "Any SOO can only be enabled with C++11 support"
 #endif
@@ -185,6 +191,17 @@ public:
 			construct(other);
 	}
 
+#ifdef POCO_ANY_HAVE_CPP11
+	Any(Any&& other)
+		/// Move constructor. A heap-allocated holder changes owners
+		/// without a copy; a locally held value is cloned into this
+		/// Any and destroyed in other. In both cases, other is left
+		/// empty.
+	{
+		steal(other);
+	}
+#endif
+
 	~Any()
 		/// Destructor. If Any is locally held, calls ValueHolder destructor;
 		/// otherwise, deletes the placeholder from the heap.
@@ -216,7 +233,7 @@ public:
 			Any tmp(*this);
 			try
 			{
-				if (_valueHolder.isLocal()) destruct();
+				clear();
 				construct(other);
 				other = tmp;
 			}
@@ -234,25 +251,43 @@ public:
 	Any& operator = (const ValueType& rhs)
 		/// Assignment operator for all types != Any.
 		///
-		/// Example: 
-		///   Any a = 13; 
+		/// Example:
+		///   Any a = 13;
 		///   Any a = string("12345");
 	{
-		construct(rhs);
+		Any tmp(rhs);
+		clear();
+		steal(tmp);
 		return *this;
 	}
-	
+
 	Any& operator = (const Any& rhs)
 		/// Assignment operator for Any.
 	{
-		if ((this != &rhs) && !rhs.empty())
-			construct(rhs);
-		else if ((this != &rhs) && rhs.empty())
-			_valueHolder.erase();
+		if (this != &rhs)
+		{
+			Any tmp(rhs);
+			clear();
+			steal(tmp);
+		}
 
 		return *this;
 	}
-	
+
+#ifdef POCO_ANY_HAVE_CPP11
+	Any& operator = (Any&& rhs)
+		/// Move assignment operator for Any.
+	{
+		if (this != &rhs)
+		{
+			clear();
+			steal(rhs);
+		}
+
+		return *this;
+	}
+#endif
+
 	bool empty() const
 		/// Returns true if the Any is empty.
 	{
@@ -349,6 +384,41 @@ private:
 		content()->~ValueHolder();
 	}
 
+	void clear()
+		/// Destroys the held value, if any, and leaves the Any empty.
+	{
+		if (!empty())
+		{
+			if (_valueHolder.isLocal())
+				destruct();
+			else
+				delete content();
+			_valueHolder.erase();
+		}
+	}
+
+	void steal(Any& other)
+		/// Takes over the content of other, leaving it empty.
+		/// A heap-allocated holder changes owners without a copy;
+		/// a locally held value is cloned into this Any and
+		/// destroyed in other. The Any must be empty when this
+		/// function is called.
+	{
+		if (other.empty()) return;
+
+		if (other._valueHolder.isLocal())
+		{
+			construct(other);
+			other.destruct();
+		}
+		else
+		{
+			_valueHolder.pHolder = other._valueHolder.pHolder;
+			_valueHolder.setLocal(false);
+		}
+		other._valueHolder.erase();
+	}
+
 	Placeholder<ValueHolder> _valueHolder;
 
 
@@ -377,6 +447,16 @@ private:
 	{
 	}
 
+#ifdef POCO_ANY_HAVE_CPP11
+	Any(Any&& other):
+		_pHolder(other._pHolder)
+		/// Move constructor. The content of other is transferred to
+		/// this Any without a copy, leaving other empty.
+	{
+		other._pHolder = 0;
+	}
+#endif
+
 	~Any()
 	{
 		delete _pHolder;
@@ -408,6 +488,20 @@ private:
 		return *this;
 	}
 
+#ifdef POCO_ANY_HAVE_CPP11
+	Any& operator = (Any&& rhs)
+		/// Move assignment operator for Any.
+	{
+		if (this != &rhs)
+		{
+			delete _pHolder;
+			_pHolder = rhs._pHolder;
+			rhs._pHolder = 0;
+		}
+		return *this;
+	}
+#endif
+
 	bool empty() const
 		/// Returns true if the Any is empty.
 	{
@@ -0,0 +1,254 @@
+//
+// ArenaAllocator.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  ArenaAllocator
+//
+// Definition of the ArenaAllocator class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ArenaAllocator_INCLUDED
+#define Foundation_ArenaAllocator_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API ArenaAllocator
+	/// A region-based ("arena") bump allocator.
+	///
+	/// Memory is carved from a list of chunks by simply
+	/// advancing a pointer; individual allocations are never
+	/// freed. Instead, the whole arena is released wholesale
+	/// with reset(), which rewinds all chunks while retaining
+	/// their memory for reuse. This makes the arena ideal for
+	/// per-request scratch memory, e.g. in a HTTPRequestHandler,
+	/// where many short-lived allocations would otherwise cause
+	/// heap churn.
+	///
+	/// A Scope object rewinds the arena to its construction-time
+	/// state when it is destroyed, allowing nested temporary
+	/// allocations:
+	///
+	///     ArenaAllocator arena;
+	///     {
+	///         ArenaAllocator::Scope scope(arena);
+	///         char* buffer = static_cast<char*>(arena.alloc(size));
+	///         ...
+	///     } // all allocations made within the scope are rewound
+	///
+	/// Arena memory can be handed to classes accepting externally
+	/// owned buffers, such as Poco::Buffer's non-owning constructor
+	/// or MemoryInputStream/MemoryOutputStream. For standard
+	/// containers, the ArenaAllocatorAdapter class template
+	/// provides a conforming allocator:
+	///
+	///     std::vector<int, ArenaAllocatorAdapter<int> > vec((ArenaAllocatorAdapter<int>(arena)));
+	///
+	/// Note that allocations returned by alloc() are only valid
+	/// until the arena is reset or rewound past them, and that
+	/// an ArenaAllocator is not thread-safe: each thread (or
+	/// request) should use its own arena.
+{
+public:
+	struct Mark
+		/// An opaque marker denoting the arena's current
+		/// allocation position. See mark() and rewind().
+	{
+		std::size_t chunk;
+		std::size_t offset;
+		std::size_t used;
+	};
+
+	class Foundation_API Scope
+		/// Rewinds the arena to its construction-time position
+		/// when destroyed.
+	{
+	public:
+		explicit Scope(ArenaAllocator& arena):
+			_arena(arena),
+			_mark(arena.mark())
+		{
+		}
+
+		~Scope()
+		{
+			_arena.rewind(_mark);
+		}
+
+	private:
+		Scope();
+		Scope(const Scope&);
+		Scope& operator = (const Scope&);
+
+		ArenaAllocator& _arena;
+		Mark _mark;
+	};
+
+	enum
+	{
+		DEFAULT_CHUNK_SIZE = 4096
+	};
+
+	explicit ArenaAllocator(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+		/// Creates the ArenaAllocator. Memory is obtained from
+		/// the heap in chunks of the given size; allocations
+		/// larger than the chunk size get a dedicated chunk.
+		///
+		/// No memory is allocated until the first call to alloc().
+
+	~ArenaAllocator();
+		/// Destroys the ArenaAllocator and frees all chunks.
+
+	void* alloc(std::size_t size);
+		/// Returns a pointer to size bytes of uninitialized
+		/// memory, suitably aligned for any object type.
+		///
+		/// The memory remains valid until the arena is reset
+		/// or rewound past it, or destroyed. It must not be
+		/// freed individually.
+
+	void reset();
+		/// Rewinds the arena to its initial state, invalidating
+		/// all outstanding allocations. Chunk memory is retained
+		/// for reuse.
+
+	Mark mark() const;
+		/// Returns a marker for the current allocation position.
+
+	void rewind(const Mark& mark);
+		/// Rewinds the arena to the given marker, invalidating
+		/// all allocations made after the marker was taken.
+
+	std::size_t used() const;
+		/// Returns the number of bytes allocated since the
+		/// last reset, including alignment padding.
+
+	std::size_t capacity() const;
+		/// Returns the total number of bytes held in chunks.
+
+private:
+	struct Chunk
+	{
+		char*       data;
+		std::size_t size;
+		std::size_t offset;
+	};
+
+	typedef std::vector<Chunk> ChunkVec;
+
+	ArenaAllocator(const ArenaAllocator&);
+	ArenaAllocator& operator = (const ArenaAllocator&);
+
+	void* allocChunk(std::size_t size);
+		/// Advances to the next chunk that can satisfy the
+		/// request, allocating a new one if necessary.
+
+	static std::size_t align(std::size_t size);
+
+	std::size_t _chunkSize;
+	std::size_t _currentChunk;
+	std::size_t _used;
+	ChunkVec    _chunks;
+};
+
+
+template <class T>
+class ArenaAllocatorAdapter
+	/// A standard-conforming allocator that obtains memory
+	/// from an ArenaAllocator, for use with std::vector,
+	/// std::basic_string and other standard containers.
+	///
+	/// deallocate() is a no-op; the memory is reclaimed when
+	/// the underlying arena is reset. The arena must outlive
+	/// every container using the adapter.
+{
+public:
+	typedef T value_type;
+
+	ArenaAllocatorAdapter(ArenaAllocator& arena):
+		_pArena(&arena)
+	{
+	}
+
+	template <class U>
+	ArenaAllocatorAdapter(const ArenaAllocatorAdapter<U>& other):
+		_pArena(other.arena())
+	{
+	}
+
+	T* allocate(std::size_t n)
+	{
+		return static_cast<T*>(_pArena->alloc(n*sizeof(T)));
+	}
+
+	void deallocate(T* /*ptr*/, std::size_t /*n*/)
+	{
+	}
+
+	ArenaAllocator* arena() const
+	{
+		return _pArena;
+	}
+
+private:
+	ArenaAllocator* _pArena;
+};
+
+
+template <class T, class U>
+inline bool operator == (const ArenaAllocatorAdapter<T>& a1, const ArenaAllocatorAdapter<U>& a2)
+{
+	return a1.arena() == a2.arena();
+}
+
+
+template <class T, class U>
+inline bool operator != (const ArenaAllocatorAdapter<T>& a1, const ArenaAllocatorAdapter<U>& a2)
+{
+	return a1.arena() != a2.arena();
+}
+
+
+//
+// inlines
+//
+inline ArenaAllocator::Mark ArenaAllocator::mark() const
+{
+	Mark m;
+	m.chunk  = _currentChunk;
+	m.offset = _currentChunk < _chunks.size() ? _chunks[_currentChunk].offset : 0;
+	m.used   = _used;
+	return m;
+}
+
+
+inline std::size_t ArenaAllocator::used() const
+{
+	return _used;
+}
+
+
+inline std::size_t ArenaAllocator::align(std::size_t size)
+{
+	const std::size_t alignment = alignof(std::max_align_t);
+	return (size + alignment - 1) & ~(alignment - 1);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ArenaAllocator_INCLUDED
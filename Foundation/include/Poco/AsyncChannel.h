@@ -23,12 +23,16 @@
 #include "Poco/Thread.h"
 #include "Poco/Mutex.h"
 #include "Poco/Runnable.h"
-#include "Poco/NotificationQueue.h"
+#include "Poco/Event.h"
+#include "Poco/AtomicCounter.h"
 
 
 namespace Poco {
 
 
+class AsyncMessageRing;
+
+
 class Foundation_API AsyncChannel: public Channel, public Runnable
 	/// A channel uses a separate thread for logging.
 	///
@@ -36,10 +40,28 @@ class Foundation_API AsyncChannel: public Channel, public Runnable
 	/// applications that produce huge amounts of log messages or
 	/// that write log messages to multiple channels simultaneously.
 	///
-	/// All log messages are put into a queue and this queue is
-	/// then processed by a separate thread.
+	/// All log messages are put into a bounded lock-free queue,
+	/// which is drained in batches by a separate thread and
+	/// forwarded to the target channel.
+	///
+	/// If messages are produced faster than the target channel can
+	/// write them and the queue fills up, the overflowPolicy
+	/// property determines what happens: the logging thread can
+	/// block until space is available (the default), the oldest
+	/// queued message can be dropped in favor of the new one, or
+	/// only a sample (one in sampleRate) of the incoming messages
+	/// is kept while the queue remains full. The number of messages
+	/// dropped due to overflow can be obtained via dropped().
 {
 public:
+	enum OverflowPolicy
+		/// What to do with a message logged while the queue is full.
+	{
+		OVERFLOW_BLOCK,       /// block the logging thread until space is available (default)
+		OVERFLOW_DROP_OLDEST, /// drop the oldest queued message to make room for the new one
+		OVERFLOW_SAMPLE       /// keep only one in sampleRate messages while the queue is full
+	};
+
 	AsyncChannel(Channel* pChannel = 0, Thread::Priority prio = Thread::PRIO_NORMAL);
 		/// Creates the AsyncChannel and connects it to
 		/// the given channel.
@@ -79,21 +101,70 @@ public:
 		///    * highest
 		///
 		/// The "priority" property is set-only.
+		///
+		/// The "queueSize" property sets the capacity of the
+		/// message queue in messages (rounded up to the next
+		/// power of two, default 8192). It must be set before
+		/// the channel is opened.
+		///
+		/// The "overflowPolicy" property determines what happens
+		/// when a message is logged while the queue is full.
+		/// The following values are supported:
+		///    * block (default)
+		///    * dropOldest
+		///    * sample
+		///
+		/// The "sampleRate" property specifies that with the
+		/// sample overflow policy, one in sampleRate messages
+		/// is kept while the queue is full (default 100).
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the property with the given name.
+		/// See setProperty() for a description of the supported
+		/// properties. In addition, the read-only "dropped"
+		/// property returns the number of messages dropped due
+		/// to queue overflow.
+
+	int dropped() const;
+		/// Returns the number of messages dropped due to
+		/// queue overflow since the channel was created.
 
 protected:
 	~AsyncChannel();
 	void run();
 	void setPriority(const std::string& value);
 		
+	void setQueueSize(const std::string& value);
+	void setOverflowPolicy(const std::string& value);
+	void setSampleRate(const std::string& value);
+
 private:
 	Channel*  _pChannel;
 	Thread    _thread;
 	FastMutex _threadMutex;
 	FastMutex _channelMutex;
-	NotificationQueue _queue;
+	AsyncMessageRing* _pRing;
+	std::size_t    _queueSize;
+	OverflowPolicy _overflowPolicy;
+	int            _sampleRate;
+	AtomicCounter  _dropped;
+	AtomicCounter  _sampleCounter;
+	Event          _queueReady;
+	Event          _queueSpace;
+	bool           _open;
+	bool           _stop;
 };
 
 
+//
+// inlines
+//
+inline int AsyncChannel::dropped() const
+{
+	return _dropped.value();
+}
+
+
 } // namespace Poco
 
 
@@ -0,0 +1,80 @@
+//
+// Base32Codec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Definition of the Base32Codec class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base32Codec_INCLUDED
+#define Foundation_Base32Codec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API Base32Codec
+	/// This class provides buffer-to-buffer Base32 encoding
+	/// and decoding.
+	///
+	/// In contrast to Base32Encoder and Base32Decoder, which
+	/// are stream based, the whole input is processed at once,
+	/// making this class the preferred interface when the data
+	/// is already in memory. The stream classes use it internally
+	/// for bulk writes.
+{
+public:
+	static std::size_t encodedLength(std::size_t size, bool padding = true);
+		/// Returns the number of characters encode() will produce
+		/// for size bytes of input.
+
+	static std::size_t encode(const void* data, std::size_t size, char* buffer, bool padding = true);
+		/// Encodes size bytes starting at data into buffer, which
+		/// must be at least encodedLength(size, padding) characters
+		/// large.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const void* data, std::size_t size, bool padding = true);
+		/// Encodes size bytes starting at data and returns
+		/// the result as a string.
+
+	static std::size_t maxDecodedLength(std::size_t size);
+		/// Returns an upper bound for the number of bytes decode()
+		/// can produce for size characters of input.
+
+	static std::size_t decode(const char* data, std::size_t size, void* buffer);
+		/// Decodes size characters starting at data into buffer, which
+		/// must be at least maxDecodedLength(size) bytes large.
+		/// Both padded and unpadded input is accepted.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input is not
+		/// valid base32-encoded data.
+
+	static std::string decode(const std::string& base32);
+		/// Decodes the given base32-encoded string and returns
+		/// the decoded bytes as a string.
+		///
+		/// Throws a DataFormatException if the input is not
+		/// valid base32-encoded data.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base32Codec_INCLUDED
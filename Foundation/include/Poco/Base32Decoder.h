@@ -39,9 +39,16 @@ class Foundation_API Base32DecoderBuf: public UnbufferedStreamBuf
 public:
 	Base32DecoderBuf(std::istream& istr);
 	~Base32DecoderBuf();
-	
+
+protected:
+	std::streamsize xsgetn(char_type* p, std::streamsize count);
+		/// Bulk override: decodes eight-character groups directly
+		/// into the target buffer, so large reads do not pay a
+		/// virtual call per character.
+
 private:
 	int readFromDevice();
+	bool readGroup();
 	int readOne();
 
 	unsigned char   _group[8];
@@ -43,6 +43,12 @@ public:
 	int close();
 		/// Closes the stream buffer.
 
+protected:
+	std::streamsize xsputn(const char* s, std::streamsize count);
+		/// Bulk override: encodes whole five-byte groups
+		/// buffer-to-buffer via Base32Codec, so large writes
+		/// do not pay a virtual call per character.
+
 private:
 	int writeToDevice(char c);
 
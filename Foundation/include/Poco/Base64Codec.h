@@ -0,0 +1,87 @@
+//
+// Base64Codec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Definition of the Base64Codec class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base64Codec_INCLUDED
+#define Foundation_Base64Codec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base64Encoder.h"
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API Base64Codec
+	/// This class provides buffer-to-buffer Base64 encoding
+	/// and decoding.
+	///
+	/// In contrast to Base64Encoder and Base64Decoder, which
+	/// are stream based, the whole input is processed at once,
+	/// using a SSSE3 vector kernel where available, making this
+	/// class the preferred interface when the data is already
+	/// in memory (e.g., when encoding authentication tokens).
+	/// The stream classes use it internally for bulk writes.
+	///
+	/// The same encoding options as for Base64Encoder
+	/// (BASE64_URL_ENCODING, BASE64_NO_PADDING) are supported.
+	/// No line breaks are ever produced.
+{
+public:
+	static std::size_t encodedLength(std::size_t size, int options = 0);
+		/// Returns the number of characters encode() will produce
+		/// for size bytes of input.
+
+	static std::size_t encode(const void* data, std::size_t size, char* buffer, int options = 0);
+		/// Encodes size bytes starting at data into buffer, which
+		/// must be at least encodedLength(size, options) characters
+		/// large. No line breaks are written.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const void* data, std::size_t size, int options = 0);
+		/// Encodes size bytes starting at data and returns
+		/// the result as a string.
+
+	static std::size_t maxDecodedLength(std::size_t size);
+		/// Returns an upper bound for the number of bytes decode()
+		/// can produce for size characters of input.
+
+	static std::size_t decode(const char* data, std::size_t size, void* buffer, int options = 0);
+		/// Decodes size characters starting at data into buffer, which
+		/// must be at least maxDecodedLength(size) bytes large.
+		/// Whitespace (CR, LF, TAB, space) is ignored, unless
+		/// BASE64_URL_ENCODING is given.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input is not
+		/// valid base64-encoded data.
+
+	static std::string decode(const std::string& base64, int options = 0);
+		/// Decodes the given base64-encoded string and returns
+		/// the decoded bytes as a string.
+		///
+		/// Throws a DataFormatException if the input is not
+		/// valid base64-encoded data.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base64Codec_INCLUDED
@@ -40,8 +40,15 @@ public:
 	Base64DecoderBuf(std::istream& istr, int options = 0);
 	~Base64DecoderBuf();
 
+protected:
+	std::streamsize xsgetn(char_type* p, std::streamsize count);
+		/// Bulk override: decodes four-character groups directly
+		/// into the target buffer, so large reads do not pay a
+		/// virtual call per character.
+
 private:
 	int readFromDevice();
+	bool readGroup();
 	int readOne();
 
 	int             _options;
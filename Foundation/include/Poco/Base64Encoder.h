@@ -67,6 +67,13 @@ public:
 	int getLineLength() const;
 		/// Returns the currently set line length.
 
+protected:
+	std::streamsize xsputn(const char* s, std::streamsize count);
+		/// Bulk override: encodes whole three-byte groups
+		/// buffer-to-buffer via Base64Codec, so large writes
+		/// (e.g. attachment bodies) do not pay a virtual
+		/// call per character.
+
 private:
 	int writeToDevice(char c);
 
@@ -0,0 +1,152 @@
+//
+// BinaryLogChannel.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryLogChannel
+//
+// Definition of the BinaryLogChannel class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BinaryLogChannel_INCLUDED
+#define Foundation_BinaryLogChannel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Channel.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <sstream>
+
+
+namespace Poco {
+
+
+class FileOutputStream;
+class BinaryWriter;
+
+
+class Foundation_API BinaryLogChannel: public Channel
+	/// A Channel that writes messages to a file as compact
+	/// binary records instead of formatted text, deferring
+	/// all message formatting to offline processing with
+	/// the BinaryLogReader class.
+	///
+	/// Every record is prefixed with its encoded length, so
+	/// a reader can skip over records without decoding them.
+	/// Message times are stored as deltas to the previous
+	/// record, and source names, thread names and source file
+	/// paths are interned: the full string is written only the
+	/// first time it occurs and subsequent records refer to it
+	/// by a small numeric identifier.
+	///
+	/// The log file can be decoded, and rendered to text using
+	/// a PatternFormatter, with the BinaryLogReader class.
+	///
+	/// The BinaryLogChannel supports the following configuration
+	/// properties:
+	///
+	///   * path:  The log file's path.
+	///   * flush: Specifies whether each log message is flushed
+	///     immediately to the log file (which may hurt application
+	///     performance, but ensures that everything is in the log
+	///     in case of a system crash), or whether it's allowed to
+	///     stay in the system's file buffer for some time.
+	///     Valid values are:
+	///
+	///        * true:  Every message is immediately flushed to the
+	///          log file (default).
+	///        * false: Messages are not immediately flushed to the
+	///          log file.
+{
+public:
+	BinaryLogChannel();
+		/// Creates the BinaryLogChannel.
+
+	BinaryLogChannel(const std::string& path);
+		/// Creates the BinaryLogChannel for a file
+		/// with the given path.
+
+	void open();
+		/// Opens the BinaryLogChannel and appends a section
+		/// header to the log file, creating it if necessary.
+
+	void close();
+		/// Closes the BinaryLogChannel.
+
+	void log(const Message& msg);
+		/// Writes the given message to the log file
+		/// as a binary record.
+
+	void setProperty(const std::string& name, const std::string& value);
+		/// Sets the property with the given name.
+		///
+		/// The following properties are supported:
+		///   * path:  The log file's path.
+		///   * flush: Specifies whether messages are immediately
+		///     flushed to the log file. Valid values are "true"
+		///     and "false".
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the property with the given name.
+		/// See setProperty() for a description of the supported
+		/// properties.
+
+	const std::string& path() const;
+		/// Returns the log file's path.
+
+	static const std::string PROP_PATH;
+	static const std::string PROP_FLUSH;
+
+protected:
+	~BinaryLogChannel();
+		/// Destroys the BinaryLogChannel.
+
+	void setFlush(const std::string& flush);
+		/// Sets the flush mode.
+
+private:
+	typedef std::map<std::string, UInt32> StringIdMap;
+
+	void openFile();
+		/// Opens the log file and writes a section header.
+		/// The caller must hold the mutex.
+
+	UInt32 intern(StringIdMap& map, const std::string& value, bool& isNew);
+		/// Returns the identifier for the given string, assigning
+		/// the next free identifier if the string is seen for the
+		/// first time.
+
+	std::string _path;
+	bool _flush;
+	FileOutputStream* _pStream;
+	BinaryWriter* _pWriter;
+	StringIdMap _sourceIds;
+	StringIdMap _threadIds;
+	StringIdMap _fileIds;
+	Timestamp::TimeVal _lastTime;
+	std::ostringstream _recordStream;
+	FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline const std::string& BinaryLogChannel::path() const
+{
+	return _path;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BinaryLogChannel_INCLUDED
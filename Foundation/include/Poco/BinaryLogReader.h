@@ -0,0 +1,95 @@
+//
+// BinaryLogReader.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryLogReader
+//
+// Definition of the BinaryLogReader class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BinaryLogReader_INCLUDED
+#define Foundation_BinaryLogReader_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/BinaryReader.h"
+#include "Poco/Timestamp.h"
+#include <deque>
+#include <istream>
+
+
+namespace Poco {
+
+
+class Message;
+
+
+class Foundation_API BinaryLogReader
+	/// BinaryLogReader decodes log files written by the
+	/// BinaryLogChannel back into Message objects, so that
+	/// they can be formatted offline, e.g. with a
+	/// PatternFormatter:
+	///
+	///     Poco::FileInputStream istr("app.log.bin");
+	///     Poco::BinaryLogReader reader(istr);
+	///     Poco::PatternFormatter formatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t");
+	///     Poco::Message msg;
+	///     std::string line;
+	///     while (reader.next(msg))
+	///     {
+	///         line.clear();
+	///         formatter.format(msg, line);
+	///         std::cout << line << std::endl;
+	///     }
+{
+public:
+	BinaryLogReader(std::istream& istr);
+		/// Creates the BinaryLogReader for the given stream.
+		/// The stream must have been opened in binary mode.
+
+	~BinaryLogReader();
+		/// Destroys the BinaryLogReader.
+
+	bool next(Message& msg);
+		/// Reads the next message from the stream.
+		///
+		/// Returns true if a message has been read, or false
+		/// if the end of the stream has been reached.
+		/// Throws a DataFormatException if the stream is not
+		/// a valid binary log.
+		///
+		/// The source file path set on the message points into
+		/// the reader's string table and remains valid for the
+		/// lifetime of the reader.
+
+private:
+	BinaryLogReader();
+	BinaryLogReader(const BinaryLogReader&);
+	BinaryLogReader& operator = (const BinaryLogReader&);
+
+	typedef std::deque<std::string> StringTable;
+
+	const std::string& resolve(StringTable& table);
+		/// Reads an interned string reference from the stream,
+		/// adding the string to the table if it is seen for the
+		/// first time.
+
+	BinaryReader _reader;
+	StringTable _sources;
+	StringTable _threads;
+	StringTable _files;
+	Timestamp::TimeVal _lastTime;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BinaryLogReader_INCLUDED
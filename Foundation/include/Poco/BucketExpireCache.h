@@ -0,0 +1,65 @@
+//
+// BucketExpireCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  BucketExpireCache
+//
+// Definition of the BucketExpireCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BucketExpireCache_INCLUDED
+#define Foundation_BucketExpireCache_INCLUDED
+
+
+#include "Poco/AbstractCache.h"
+#include "Poco/BucketExpireStrategy.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class TMutex = FastMutex,
+	class TEventMutex = FastMutex
+>
+class BucketExpireCache: public AbstractCache<TKey, TValue, BucketExpireStrategy<TKey, TValue>, TMutex, TEventMutex>
+	/// A BucketExpireCache caches entries for a fixed time period
+	/// (per default 10 minutes), like an ExpireCache, but files
+	/// entries into coarse time buckets that are swept wholesale,
+	/// so expiry maintenance stays O(1) amortized per entry even
+	/// with millions of cached elements. Entries may outlive their
+	/// expiration time by up to one bucket width (expiration period
+	/// divided by the bucket count), but never expire early.
+	///
+	/// For periodic batch sweeping from a background thread, call
+	/// forceReplace(), e.g. from a Util::Timer task.
+{
+public:
+	BucketExpireCache(Timestamp::TimeDiff expire = 600000, std::size_t bucketCount = BucketExpireStrategy<TKey, TValue>::DEFAULT_BUCKET_COUNT):
+		AbstractCache<TKey, TValue, BucketExpireStrategy<TKey, TValue>, TMutex, TEventMutex>(BucketExpireStrategy<TKey, TValue>(expire, bucketCount))
+	{
+	}
+
+	~BucketExpireCache()
+	{
+	}
+
+private:
+	BucketExpireCache(const BucketExpireCache& aCache);
+	BucketExpireCache& operator = (const BucketExpireCache& aCache);
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BucketExpireCache_INCLUDED
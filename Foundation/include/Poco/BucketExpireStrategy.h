@@ -0,0 +1,182 @@
+//
+// BucketExpireStrategy.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  BucketExpireStrategy
+//
+// Definition of the BucketExpireStrategy class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_BucketExpireStrategy_INCLUDED
+#define Foundation_BucketExpireStrategy_INCLUDED
+
+
+#include "Poco/KeyValueArgs.h"
+#include "Poco/ValidArgs.h"
+#include "Poco/AbstractStrategy.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Exception.h"
+#include "Poco/EventArgs.h"
+#include <set>
+#include <map>
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue
+>
+class BucketExpireStrategy: public AbstractStrategy<TKey, TValue>
+	/// A BucketExpireStrategy implements time based expiration of
+	/// cache entries using coarse time buckets (a one-level timing
+	/// wheel) instead of ExpireStrategy's per-entry multimap of
+	/// timestamps.
+	///
+	/// The expiration period is divided into a fixed number of
+	/// buckets; each entry is filed under the bucket covering its
+	/// insertion time, and whole buckets are swept at once when
+	/// they fall out of the expiration window. This makes expiry
+	/// maintenance O(1) amortized per entry, at the cost of
+	/// expiration accuracy: entries expire up to one bucket width
+	/// late (never early).
+	///
+	/// Batch sweeping can be driven from a background thread by
+	/// periodically calling forceReplace() on the owning cache.
+{
+public:
+	typedef std::set<TKey>          Bucket;
+	typedef std::map<UInt64, Bucket> BucketMap;
+	typedef typename BucketMap::iterator BucketIterator;
+	typedef std::map<TKey, UInt64>  Keys;
+	typedef typename Keys::iterator Iterator;
+
+	enum
+	{
+		DEFAULT_BUCKET_COUNT = 64
+	};
+
+public:
+	BucketExpireStrategy(Timestamp::TimeDiff expireTimeInMilliSec, std::size_t bucketCount = DEFAULT_BUCKET_COUNT):
+		_expireTime(expireTimeInMilliSec * 1000)
+		/// Create an expire strategy. Note that the smallest allowed caching time is 25ms.
+		/// The expiration period is divided into bucketCount buckets; entries may
+		/// outlive their expiration time by up to one bucket width.
+	{
+		if (_expireTime < 25000) throw InvalidArgumentException("expireTime must be at least 25 ms");
+		if (bucketCount == 0) throw InvalidArgumentException("bucketCount must not be zero");
+		_bucketWidth = _expireTime / static_cast<Timestamp::TimeDiff>(bucketCount);
+		if (_bucketWidth == 0) _bucketWidth = 1;
+	}
+
+	~BucketExpireStrategy()
+	{
+	}
+
+	void onAdd(const void*, const KeyValueArgs <TKey, TValue>& args)
+	{
+		UInt64 bucketId = currentBucket();
+		_buckets[bucketId].insert(args.key());
+		std::pair<Iterator, bool> stat = _keys.insert(typename Keys::value_type(args.key(), bucketId));
+		if (!stat.second)
+		{
+			removeFromBucket(args.key(), stat.first->second);
+			stat.first->second = bucketId;
+		}
+	}
+
+	void onRemove(const void*, const TKey& key)
+	{
+		Iterator it = _keys.find(key);
+		if (it != _keys.end())
+		{
+			removeFromBucket(key, it->second);
+			_keys.erase(it);
+		}
+	}
+
+	void onGet(const void*, const TKey& key)
+	{
+		// get triggers no changes in an expire
+	}
+
+	void onClear(const void*, const EventArgs& args)
+	{
+		_keys.clear();
+		_buckets.clear();
+	}
+
+	void onIsValid(const void*, ValidArgs<TKey>& args)
+	{
+		Iterator it = _keys.find(args.key());
+		if (it != _keys.end())
+		{
+			if (isExpired(it->second))
+			{
+				args.invalidate();
+			}
+		}
+		else //not found: probably removed by onReplace
+			args.invalidate();
+	}
+
+	void onReplace(const void*, std::set<TKey>& elemsToRemove)
+	{
+		// Note: replace only informs the cache which elements
+		// it would like to remove!
+		// it does not remove them on its own!
+		BucketIterator it = _buckets.begin();
+		while (it != _buckets.end() && isExpired(it->first))
+		{
+			elemsToRemove.insert(it->second.begin(), it->second.end());
+			++it;
+		}
+	}
+
+protected:
+	UInt64 currentBucket() const
+		/// Returns the bucket covering the current time.
+	{
+		Timestamp now;
+		return static_cast<UInt64>(now.epochMicroseconds() / _bucketWidth);
+	}
+
+	bool isExpired(UInt64 bucketId) const
+		/// Returns true if the whole bucket has fallen out of the
+		/// expiration window. The bucket's end is used, so no entry
+		/// filed under it can expire early.
+	{
+		Timestamp now;
+		Timestamp::TimeDiff bucketEnd = static_cast<Timestamp::TimeDiff>(bucketId + 1) * _bucketWidth;
+		return now.epochMicroseconds() >= bucketEnd + _expireTime;
+	}
+
+	void removeFromBucket(const TKey& key, UInt64 bucketId)
+	{
+		BucketIterator it = _buckets.find(bucketId);
+		if (it != _buckets.end())
+		{
+			it->second.erase(key);
+			if (it->second.empty()) _buckets.erase(it);
+		}
+	}
+
+	Timestamp::TimeDiff _expireTime;
+	Timestamp::TimeDiff _bucketWidth;
+	Keys      _keys;    /// Maps keys to the bucket they are filed under
+	BucketMap _buckets; /// Maps bucket ids to the keys inserted during that bucket's time slice
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_BucketExpireStrategy_INCLUDED
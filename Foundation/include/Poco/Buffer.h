@@ -112,21 +112,29 @@ public:
 		if (_ownMem) delete [] _ptr;
 	}
 	
-	void resize(std::size_t newCapacity, bool preserveContent = true)
-		/// Resizes the buffer capacity and size. If preserveContent is true,
+	void resize(std::size_t newSize, bool preserveContent = true)
+		/// Resizes the buffer. If preserveContent is true,
 		/// the content of the old buffer is copied over to the
-		/// new buffer. The new capacity can be larger or smaller than
+		/// new buffer. The new size can be larger or smaller than
 		/// the current one; if it is smaller, capacity will remain intact.
-		/// Size will always be set to the new capacity.
-		///  
-		/// Buffers only wrapping externally owned storage can not be 
+		/// Size will always be set to the new size.
+		///
+		/// If the buffer needs to grow beyond its current capacity,
+		/// the capacity is at least doubled, so that repeatedly
+		/// growing the buffer (e.g., via append()) takes amortized
+		/// constant time per element. New elements beyond the old
+		/// size are not initialized for scalar element types.
+		///
+		/// Buffers only wrapping externally owned storage can not be
 		/// resized. If resize is attempted on those, IllegalAccessException
 		/// is thrown.
 	{
 		if (!_ownMem) throw Poco::InvalidAccessException("Cannot resize buffer which does not own its storage.");
 
-		if (newCapacity > _capacity)
+		if (newSize > _capacity)
 		{
+			std::size_t newCapacity = _capacity*2;
+			if (newCapacity < newSize) newCapacity = newSize;
 			T* ptr = new T[newCapacity];
 			if (preserveContent)
 			{
@@ -136,8 +144,8 @@ public:
 			_ptr = ptr;
 			_capacity = newCapacity;
 		}
-		
-		_used = newCapacity;
+
+		_used = newSize;
 	}
 	
 	void setCapacity(std::size_t newCapacity, bool preserveContent = true)
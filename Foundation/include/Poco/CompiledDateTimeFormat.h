@@ -0,0 +1,129 @@
+//
+// CompiledDateTimeFormat.h
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  CompiledDateTimeFormat
+//
+// Definition of the CompiledDateTimeFormat class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CompiledDateTimeFormat_INCLUDED
+#define Foundation_CompiledDateTimeFormat_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <vector>
+#include <ctime>
+
+
+namespace Poco {
+
+
+class Foundation_API CompiledDateTimeFormat
+	/// A date/time format pattern, parsed once into a list of
+	/// formatting operations.
+	///
+	/// DateTimeFormatter rescans the format string on every call.
+	/// When the same pattern is used repeatedly (e.g., for
+	/// timestamping log lines), a CompiledDateTimeFormat avoids
+	/// the rescan, and for patterns without sub-second specifiers
+	/// (%s, %i, %c, %F) the formatted result is cached and reused
+	/// for timestamps falling within the same second.
+	///
+	/// The format pattern syntax is that of DateTimeFormatter.
+{
+public:
+	explicit CompiledDateTimeFormat(const std::string& fmt);
+		/// Parses the given format pattern.
+
+	CompiledDateTimeFormat(const CompiledDateTimeFormat& other);
+		/// Creates a CompiledDateTimeFormat by copying another one.
+		/// The cached result is not copied.
+
+	~CompiledDateTimeFormat();
+		/// Destroys the CompiledDateTimeFormat.
+
+	CompiledDateTimeFormat& operator = (const CompiledDateTimeFormat& other);
+		/// Assignment operator. The cached result is not copied.
+
+	void append(std::string& str, const DateTime& dateTime, int timeZoneDifferential = DateTimeFormatter::UTC) const;
+		/// Formats the given date and time and appends it to str.
+
+	void append(std::string& str, const Timestamp& timestamp, int timeZoneDifferential = DateTimeFormatter::UTC) const;
+		/// Formats the given timestamp and appends it to str.
+		///
+		/// If the pattern contains no sub-second specifiers, the
+		/// formatted result is cached and reused for subsequent
+		/// timestamps within the same second.
+
+	std::string format(const DateTime& dateTime, int timeZoneDifferential = DateTimeFormatter::UTC) const;
+		/// Formats the given date and time.
+
+	std::string format(const Timestamp& timestamp, int timeZoneDifferential = DateTimeFormatter::UTC) const;
+		/// Formats the given timestamp, using the per-second
+		/// cache where possible.
+
+	const std::string& pattern() const;
+		/// Returns the format pattern.
+
+	bool isSubSecond() const;
+		/// Returns true iff the pattern contains sub-second
+		/// specifiers (%s, %i, %c or %F) and the per-second
+		/// cache is therefore not used.
+
+private:
+	struct Op
+	{
+		Op(): spec(0)
+		{
+		}
+
+		char        spec; /// format specifier, or 0 for a literal
+		std::string text; /// literal text if spec is 0
+	};
+
+	void compile();
+		/// Parses _pattern into the list of operations.
+		/// Literal runs, including unknown specifiers and '%%',
+		/// are folded into a single operation.
+
+	std::string     _pattern;
+	std::vector<Op> _ops;
+	bool            _subSecond;
+
+	mutable FastMutex   _mutex;
+	mutable std::time_t _cacheSecond;
+	mutable int         _cacheTZD;
+	mutable std::string _cached;
+};
+
+
+//
+// inlines
+//
+inline const std::string& CompiledDateTimeFormat::pattern() const
+{
+	return _pattern;
+}
+
+
+inline bool CompiledDateTimeFormat::isSubSecond() const
+{
+	return _subSecond;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CompiledDateTimeFormat_INCLUDED
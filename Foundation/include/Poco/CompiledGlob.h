@@ -0,0 +1,133 @@
+//
+// CompiledGlob.h
+//
+// Library: Foundation
+// Package: Filesystem
+// Module:  CompiledGlob
+//
+// Definition of the CompiledGlob class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CompiledGlob_INCLUDED
+#define Foundation_CompiledGlob_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Glob.h"
+#include <vector>
+#include <utility>
+
+
+namespace Poco {
+
+
+class Foundation_API CompiledGlob
+	/// A glob pattern, parsed once into a list of matching
+	/// operations.
+	///
+	/// Glob::match() re-interprets the pattern string for every
+	/// candidate. When the same pattern is matched against many
+	/// subjects (e.g., when filtering the entries of a large
+	/// directory tree), a CompiledGlob parses the pattern once and
+	/// matches subjects with an iterative, non-recursive matcher.
+	///
+	/// The pattern syntax and the matching semantics are those of
+	/// the Glob class; the Glob::Options flags GLOB_DOT_SPECIAL and
+	/// GLOB_CASELESS are honored. Unlike Glob::match(), which
+	/// reports syntax errors in the pattern only when the faulty
+	/// part is reached during a match, the constructor validates
+	/// the complete pattern and throws a SyntaxException.
+	///
+	/// All strings are assumed to be UTF-8 encoded.
+{
+public:
+	CompiledGlob(const std::string& pattern, int options = 0);
+		/// Creates the CompiledGlob, parsing the given pattern.
+		/// The options are interpreted as in the Glob class.
+		///
+		/// Throws a SyntaxException if the pattern is malformed.
+
+	~CompiledGlob();
+		/// Destroys the CompiledGlob.
+
+	bool match(const char* subject, std::size_t length) const;
+		/// Matches the given subject against the glob pattern.
+		/// Returns true if the subject matches the pattern, false
+		/// otherwise.
+
+	bool match(const std::string& subject) const;
+		/// Matches the given subject against the glob pattern.
+		/// Returns true if the subject matches the pattern, false
+		/// otherwise.
+
+	const std::string& pattern() const;
+		/// Returns the pattern the CompiledGlob was created from.
+
+	int options() const;
+		/// Returns the options the CompiledGlob was created with.
+
+private:
+	enum TokenType
+	{
+		TOK_CHAR,     /// match one specific character
+		TOK_QUESTION, /// match any single character
+		TOK_STAR,     /// match any sequence of characters
+		TOK_SET       /// match one character against a character set
+	};
+
+	struct Token
+	{
+		TokenType   type;
+		int         ch;  /// character to match for TOK_CHAR
+		std::size_t set; /// index into _sets for TOK_SET
+	};
+
+	struct Set
+	{
+		bool invert;
+		std::vector<std::pair<int, int> > ranges;
+	};
+
+	void compile();
+		/// Parses _pattern into the list of tokens.
+
+	std::size_t compileSet(TextIterator& it, const TextIterator& end);
+		/// Parses a [SET] construct (after the opening bracket) and
+		/// returns its index in _sets.
+
+	bool matchToken(const Token& token, int c) const;
+		/// Matches a single character against a non-star token.
+
+	std::string        _pattern;
+	int                _options;
+	bool               _dotSpecial;
+	std::vector<Token> _tokens;
+	std::vector<Set>   _sets;
+};
+
+
+//
+// inlines
+//
+inline const std::string& CompiledGlob::pattern() const
+{
+	return _pattern;
+}
+
+
+inline int CompiledGlob::options() const
+{
+	return _options;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CompiledGlob_INCLUDED
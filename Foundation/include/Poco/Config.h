@@ -81,13 +81,18 @@
 // cases when value holder fits into POCO_SMALL_OBJECT_SIZE
 // (see below).
 //
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// !!! NOTE: Any/Dynamic::Var SOO will NOT work reliably   !!!
-// !!! without C++11 (std::aligned_storage in particular). !!!
-// !!! Only comment this out if your compiler has support  !!!
-// !!! for std::aligned_storage.                           !!!
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+// Small object optimization requires C++11 support
+// (std::aligned_storage in particular) and is therefore
+// enabled automatically when the compiler provides it.
+// Define POCO_NO_SOO to force heap allocation of all value
+// holders, or POCO_ENABLE_SOO to force the optimization on
+// (at your own risk on pre-C++11 compilers).
 //
+#if !defined(POCO_NO_SOO) && !defined(POCO_ENABLE_SOO)
+	#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+		#define POCO_ENABLE_SOO
+	#endif
+#endif
 #ifndef POCO_ENABLE_SOO
 #define POCO_NO_SOO
 #endif
@@ -96,9 +101,11 @@
 // Small object size in bytes. When assigned to Any or Var,
 // objects larger than this value will be alocated on the heap,
 // while those smaller will be placement new-ed into an
-// internal buffer.
+// internal buffer. The default of 64 bytes accommodates the
+// value holders for all arithmetic types, date/time types and
+// std::string.
 #if !defined(POCO_SMALL_OBJECT_SIZE) && !defined(POCO_NO_SOO)
-	#define POCO_SMALL_OBJECT_SIZE 32
+	#define POCO_SMALL_OBJECT_SIZE 64
 #endif
 
 
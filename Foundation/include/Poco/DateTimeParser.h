@@ -92,6 +92,17 @@ public:
 		/// Please see DateTimeFormatter::format() for a description of the format string.
 		/// Class DateTimeFormat defines format strings for various standard date/time formats.
 
+	static bool tryParseISO8601(const char* str, std::size_t length, DateTime& dateTime, int& timeZoneDifferential);
+		/// Parses a date and time in ISO 8601 format
+		/// (e.g. 2005-01-08T12:30:00.123456+01:00) using fixed-offset
+		/// digit extraction, bypassing the generic format interpreter.
+		/// The time, fractional seconds and time zone parts are optional.
+		///
+		/// Returns true if the string has been successfully parsed.
+		/// Returns false on irregular input, in which case the generic
+		/// parse() can be used as a fallback; dateTime and
+		/// timeZoneDifferential are unchanged.
+
 	static int parseMonth(std::string::const_iterator& it, const std::string::const_iterator& end);
 		/// Tries to interpret the given range as a month name. The range must be at least
 		/// three characters long. 
@@ -0,0 +1,74 @@
+//
+// DirEntry.h
+//
+// Library: Foundation
+// Package: Filesystem
+// Module:  DirectoryIterator
+//
+// Definition of the DirEntry structure.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_DirEntry_INCLUDED
+#define Foundation_DirEntry_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Timestamp.h"
+
+
+namespace Poco {
+
+
+struct Foundation_API DirEntry
+	/// A directory entry, together with the file attributes
+	/// the operating system reported while the directory was
+	/// being iterated (see DirectoryIterator::entry()).
+	///
+	/// Obtaining the attributes through a DirEntry is considerably
+	/// cheaper than querying them through the File interface, which
+	/// must resolve the complete path for every attribute queried.
+{
+	enum Type
+		/// The type of a directory entry.
+		///
+		/// The type describes the entry itself; for a symbolic
+		/// link, ENTRY_LINK is reported rather than the type of
+		/// the link target.
+	{
+		ENTRY_UNKNOWN,   /// the filesystem did not report a type
+		ENTRY_FILE,      /// a regular file
+		ENTRY_DIRECTORY, /// a directory
+		ENTRY_LINK,      /// a symbolic link
+		ENTRY_OTHER      /// a device, socket, FIFO, etc.
+	};
+
+	DirEntry():
+		type(ENTRY_UNKNOWN),
+		size(0)
+	{
+	}
+
+	std::string name;
+		/// The name of the entry.
+
+	Type type;
+		/// The type of the entry.
+
+	UInt64 size;
+		/// The size of the file in bytes.
+
+	Timestamp lastModified;
+		/// The modification date of the file.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_DirEntry_INCLUDED
@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/DirEntry.h"
 #include "Poco/File.h"
 #include "Poco/Path.h"
 
@@ -68,6 +69,31 @@ public:
 	const Path& path() const;
 		/// Returns the current path.
 
+	DirEntry::Type entryType() const;
+		/// Returns the type of the current entry, as reported by the
+		/// operating system during iteration (from dirent::d_type on
+		/// POSIX platforms, from the find data on Windows), without
+		/// performing an additional system call.
+		///
+		/// Returns DirEntry::ENTRY_UNKNOWN if the filesystem did not
+		/// report a type; in this case, use entry() or the File
+		/// interface to determine it.
+
+	bool entry(DirEntry& entry) const;
+		/// Fills the given DirEntry with the name, type, size and last
+		/// modification date of the current entry.
+		///
+		/// On POSIX platforms, this performs at most one fstatat()
+		/// call relative to the open directory, which is considerably
+		/// cheaper than the full path resolution required for every
+		/// attribute queried through the File interface. On Windows,
+		/// the attributes were already delivered with the find data
+		/// and no additional system call is made. The attributes
+		/// describe the entry itself; symbolic links are not followed.
+		///
+		/// Returns true if the attributes could be obtained,
+		/// false otherwise.
+
 	DirectoryIterator& operator = (const DirectoryIterator& it);
 	DirectoryIterator& operator = (const File& file);
 	DirectoryIterator& operator = (const Path& path);
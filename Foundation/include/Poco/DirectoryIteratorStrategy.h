@@ -44,6 +44,11 @@ public:
 protected:
 	bool isFiniteDepth();
 	bool isDirectory(Poco::File& file);
+	bool isDirectory(const DirectoryIterator& it);
+		/// Determines whether the iterator's current entry is a
+		/// directory from the entry type reported during iteration,
+		/// falling back to a stat through the File interface only
+		/// for symbolic links and entries of unknown type.
 
 	DepthFunPtr _depthDeterminer;
 	UInt16 _maxDepth;
@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/DirEntry.h"
 #include <dirent.h>
 
 
@@ -30,16 +31,19 @@ class Foundation_API DirectoryIteratorImpl
 public:
 	DirectoryIteratorImpl(const std::string& path);
 	~DirectoryIteratorImpl();
-	
+
 	void duplicate();
 	void release();
-	
+
 	const std::string& get() const;
 	const std::string& next();
-	
+	DirEntry::Type entryType() const;
+	bool entry(DirEntry& entry) const;
+
 private:
 	DIR*        _pDir;
 	std::string _current;
+	DirEntry::Type _type;
 	int _rc;
 };
 
@@ -53,6 +57,12 @@ const std::string& DirectoryIteratorImpl::get() const
 }
 
 
+inline DirEntry::Type DirectoryIteratorImpl::entryType() const
+{
+	return _type;
+}
+
+
 inline void DirectoryIteratorImpl::duplicate()
 {
 	++_rc;
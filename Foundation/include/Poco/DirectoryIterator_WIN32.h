@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/DirEntry.h"
 #include "Poco/UnWindows.h"
 
 
@@ -36,6 +37,8 @@ public:
 	
 	const std::string& get() const;
 	const std::string& next();
+	DirEntry::Type entryType() const;
+	bool entry(DirEntry& entry) const;
 	
 private:
 	HANDLE          _fh;
@@ -128,7 +128,27 @@ public:
 
 	BasicEvent<const DirectoryEvent> itemMovedTo;
 		/// Fired when a file or directory has been moved. This event delivers the new name.
-		
+
+	struct DirectoryMoveEvent
+	{
+		DirectoryMoveEvent(const File& f, const File& t):
+			fromItem(f),
+			toItem(t)
+		{
+		}
+
+		const File& fromItem;  /// The old name of the renamed file or directory.
+		const File& toItem;    /// The new name of the renamed file or directory.
+	};
+
+	BasicEvent<const DirectoryMoveEvent> itemMoved;
+		/// Fired when a rename within the watched directory could be detected
+		/// as a matching pair of itemMovedFrom and itemMovedTo events.
+		/// This event delivers both the old and the new name and is fired
+		/// in addition to itemMovedFrom and itemMovedTo.
+		///
+		/// Only fired on platforms where supportsMoveEvents() returns true.
+
 	BasicEvent<const Exception> scanError;
 		/// Fired when an error occurs while scanning for changes.
 	
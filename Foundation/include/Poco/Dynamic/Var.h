@@ -26,6 +26,11 @@
 #include <typeinfo>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+	#define POCO_VAR_HAVE_CPP11
+#endif
+
+
 namespace Poco {
 namespace Dynamic {
 
@@ -103,6 +108,13 @@ public:
 	Var(const Var& other);
 		/// Copy constructor.
 
+#ifdef POCO_VAR_HAVE_CPP11
+	Var(Var&& other);
+		/// Move constructor. The content of other is transferred to
+		/// this Var without a copy of a heap-allocated holder,
+		/// leaving other empty.
+#endif
+
 	~Var();
 		/// Destroys the Var.
 
@@ -231,7 +243,10 @@ public:
 		Var tmp(other);
 		swap(tmp);
 #else
-		construct(other);
+		Var tmp(other);
+		destruct();
+		_placeholder.erase();
+		steal(tmp);
 #endif
 		return *this;
 	}
@@ -242,6 +257,11 @@ public:
 	Var& operator = (const Var& other);
 		/// Assignment operator specialization for Var
 
+#ifdef POCO_VAR_HAVE_CPP11
+	Var& operator = (Var&& other);
+		/// Move assignment operator specialization for Var.
+#endif
+
 	template <typename T>
 	const Var operator + (const T& other) const
 		/// Addition operator for adding POD to Var
@@ -667,6 +687,28 @@ private:
 		}
 	}
 
+	void steal(Var& other)
+		/// Takes over the content of other, leaving it empty.
+		/// A heap-allocated holder changes owners without a copy;
+		/// a locally held value is cloned into this Var and
+		/// destroyed in other. The Var must be empty when this
+		/// function is called.
+	{
+		if (other.isEmpty()) return;
+
+		if (other._placeholder.isLocal())
+		{
+			construct(other);
+			other.destruct();
+		}
+		else
+		{
+			_placeholder.pHolder = other._placeholder.pHolder;
+			_placeholder.setLocal(false);
+		}
+		other._placeholder.erase();
+	}
+
 	Placeholder<VarHolder> _placeholder;
 
 #endif // POCO_NO_SOO
@@ -701,7 +743,8 @@ inline void Var::swap(Var& other)
 		Var tmp(*this);
 		try
 		{
-			if (_placeholder.isLocal()) destruct();
+			destruct();
+			_placeholder.erase();
 			construct(other);
 			other = tmp;
 		}
@@ -216,6 +216,56 @@ public:
 		return readLen;
 	}
 
+	const T* beginRead(std::size_t& length)
+		/// Returns a pointer to the unread data in the buffer and
+		/// sets length to the number of unread elements, without
+		/// copying anything. Unread data is always contiguous, so a
+		/// single region covers all of it. After the data has been
+		/// processed (e.g. passed to a socket send), endRead() must
+		/// be called with the number of elements actually consumed.
+		///
+		/// Returns a null pointer and zero length if the buffer is
+		/// not readable.
+		///
+		/// The returned pointer is only valid until the next
+		/// modifying operation on the buffer. If other threads
+		/// access the buffer, the mutex returned by mutex() must be
+		/// held externally for the whole beginRead()/endRead() pair.
+	{
+		Mutex::ScopedLock lock(_mutex);
+
+		if (!isReadable())
+		{
+			length = 0;
+			return 0;
+		}
+
+		length = _used;
+		return _buffer.begin() + _begin;
+	}
+
+	void endRead(std::size_t consumed)
+		/// Removes consumed elements from the buffer, completing a
+		/// read started with beginRead(). Consumed may be less than
+		/// the length returned by beginRead(); the remaining data
+		/// stays in the buffer.
+		///
+		/// Throws InvalidAccessException if consumed is greater than
+		/// the used size of the buffer.
+	{
+		Mutex::ScopedLock lock(_mutex);
+
+		if (consumed > _used)
+			throw InvalidAccessException("Cannot consume more data than used.");
+
+		std::size_t usedBefore = _used;
+		_used -= consumed;
+		if (0 == _used) _begin = 0;
+		else _begin += consumed;
+
+		if (_notify) notify(usedBefore);
+	}
+
 	std::size_t write(const T* pBuffer, std::size_t length)
 		/// Writes data from supplied buffer to the FIFO buffer.
 		/// If there is no sufficient space for the whole
@@ -267,6 +317,61 @@ public:
 		return write(buffer.begin(), length);
 	}
 
+	T* beginWrite(std::size_t& length)
+		/// Returns a pointer to the free space in the buffer and
+		/// sets length to the number of writable elements, without
+		/// copying anything. The unread data is moved to the start
+		/// of the buffer if necessary, so the whole available space
+		/// is contiguous. After data has been placed in the buffer
+		/// (e.g. by a socket receive), endWrite() must be called
+		/// with the number of elements actually written.
+		///
+		/// Returns a null pointer and zero length if the buffer is
+		/// not writable.
+		///
+		/// The returned pointer is only valid until the next
+		/// modifying operation on the buffer. If other threads
+		/// access the buffer, the mutex returned by mutex() must be
+		/// held externally for the whole beginWrite()/endWrite() pair.
+	{
+		Mutex::ScopedLock lock(_mutex);
+
+		if (!isWritable())
+		{
+			length = 0;
+			return 0;
+		}
+
+		if (_begin != 0)
+		{
+			std::memmove(_buffer.begin(), _buffer.begin() + _begin, _used * sizeof(T));
+			_begin = 0;
+		}
+
+		length = _buffer.size() - _used;
+		return _buffer.begin() + _used;
+	}
+
+	void endWrite(std::size_t written)
+		/// Adjusts the used buffer size by the number of elements
+		/// placed in the buffer, completing a write started with
+		/// beginWrite(). Written may be less than the length
+		/// returned by beginWrite().
+		///
+		/// Throws InvalidAccessException if written is greater than
+		/// the available space in the buffer.
+	{
+		Mutex::ScopedLock lock(_mutex);
+
+		if (written > _buffer.size() - (_begin + _used))
+			throw InvalidAccessException("Cannot extend buffer.");
+
+		std::size_t usedBefore = _used;
+		_used += written;
+
+		if (_notify) notify(usedBefore);
+	}
+
 	std::size_t size() const
 		/// Returns the size of the buffer.
 	{
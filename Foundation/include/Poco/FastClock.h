@@ -0,0 +1,243 @@
+//
+// FastClock.h
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  FastClock
+//
+// Definition of the FastClock class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FastClock_INCLUDED
+#define Foundation_FastClock_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Clock.h"
+
+
+namespace Poco {
+
+
+class Foundation_API FastClock
+	/// A FastClock works like a Clock, but reads the processor's
+	/// timestamp counter (rdtsc on x86, the virtual counter on
+	/// ARMv8) instead of calling into the operating system's
+	/// clock, making a read about an order of magnitude cheaper.
+	/// It is intended for high-frequency instrumentation code
+	/// that reads the clock many times per operation.
+	///
+	/// The timestamp counter is calibrated against Clock the
+	/// first time a FastClock is created, so FastClock values are
+	/// expressed in microseconds relative to the same
+	/// system-dependent epoch as Clock values. The calibrated
+	/// counter frequency can drift slightly relative to the
+	/// system clock over long periods; an application can call
+	/// recalibrate() periodically to correct the drift. Values
+	/// read across a recalibration may jump by the accumulated
+	/// drift and are therefore not strictly monotonic.
+	///
+	/// On platforms or compilers without a usable timestamp
+	/// counter, FastClock transparently falls back to Clock;
+	/// ready() can be used to find out whether the fast path
+	/// is available.
+{
+public:
+	typedef Clock::ClockVal  ClockVal;
+		/// Clock value in microsecond resolution.
+
+	typedef Clock::ClockDiff ClockDiff;
+		/// Difference between two ClockVal values in microseconds.
+
+	FastClock();
+		/// Creates a FastClock with the current clock value.
+
+	FastClock(ClockVal tv);
+		/// Creates a FastClock from the given clock value.
+
+	FastClock(const FastClock& other);
+		/// Copy constructor.
+
+	~FastClock();
+		/// Destroys the FastClock.
+
+	FastClock& operator = (const FastClock& other);
+	FastClock& operator = (ClockVal tv);
+
+	void swap(FastClock& clock);
+		/// Swaps the FastClock with another one.
+
+	void update();
+		/// Updates the FastClock with the current clock value.
+
+	bool operator == (const FastClock& ts) const;
+	bool operator != (const FastClock& ts) const;
+	bool operator >  (const FastClock& ts) const;
+	bool operator >= (const FastClock& ts) const;
+	bool operator <  (const FastClock& ts) const;
+	bool operator <= (const FastClock& ts) const;
+
+	FastClock  operator +  (ClockDiff d) const;
+	FastClock  operator -  (ClockDiff d) const;
+	ClockDiff  operator -  (const FastClock& ts) const;
+	FastClock& operator += (ClockDiff d);
+	FastClock& operator -= (ClockDiff d);
+
+	ClockVal microseconds() const;
+		/// Returns the clock value expressed in microseconds
+		/// since the same system-specific epoch time as used
+		/// by Clock.
+
+	ClockVal raw() const;
+		/// Returns the clock value expressed in microseconds.
+		///
+		/// Same as microseconds().
+
+	ClockDiff elapsed() const;
+		/// Returns the time elapsed since the time denoted by
+		/// the FastClock instance. Equivalent to FastClock() - *this.
+
+	bool isElapsed(ClockDiff interval) const;
+		/// Returns true iff the given interval has passed
+		/// since the time denoted by the FastClock instance.
+
+	static ClockDiff resolution();
+		/// Returns the resolution in units per second.
+		/// Since the FastClock class has microsecond resolution,
+		/// the returned value is always 1000000.
+
+	static void recalibrate();
+		/// Re-measures the timestamp counter frequency and base
+		/// value against Clock, correcting any drift accumulated
+		/// since the previous calibration. Calibration takes
+		/// about a millisecond.
+
+	static bool ready();
+		/// Returns true if a processor timestamp counter is used,
+		/// or false if FastClock falls back to reading Clock.
+
+	static ClockVal now();
+		/// Returns the current clock value in microseconds.
+
+private:
+	ClockVal _clock;
+};
+
+
+//
+// inlines
+//
+inline bool FastClock::operator == (const FastClock& ts) const
+{
+	return _clock == ts._clock;
+}
+
+
+inline bool FastClock::operator != (const FastClock& ts) const
+{
+	return _clock != ts._clock;
+}
+
+
+inline bool FastClock::operator > (const FastClock& ts) const
+{
+	return _clock > ts._clock;
+}
+
+
+inline bool FastClock::operator >= (const FastClock& ts) const
+{
+	return _clock >= ts._clock;
+}
+
+
+inline bool FastClock::operator < (const FastClock& ts) const
+{
+	return _clock < ts._clock;
+}
+
+
+inline bool FastClock::operator <= (const FastClock& ts) const
+{
+	return _clock <= ts._clock;
+}
+
+
+inline FastClock FastClock::operator + (FastClock::ClockDiff d) const
+{
+	return FastClock(_clock + d);
+}
+
+
+inline FastClock FastClock::operator - (FastClock::ClockDiff d) const
+{
+	return FastClock(_clock - d);
+}
+
+
+inline FastClock::ClockDiff FastClock::operator - (const FastClock& ts) const
+{
+	return _clock - ts._clock;
+}
+
+
+inline FastClock& FastClock::operator += (FastClock::ClockDiff d)
+{
+	_clock += d;
+	return *this;
+}
+
+
+inline FastClock& FastClock::operator -= (FastClock::ClockDiff d)
+{
+	_clock -= d;
+	return *this;
+}
+
+
+inline FastClock::ClockVal FastClock::microseconds() const
+{
+	return _clock;
+}
+
+
+inline FastClock::ClockVal FastClock::raw() const
+{
+	return _clock;
+}
+
+
+inline FastClock::ClockDiff FastClock::elapsed() const
+{
+	return now() - _clock;
+}
+
+
+inline bool FastClock::isElapsed(FastClock::ClockDiff interval) const
+{
+	return elapsed() >= interval;
+}
+
+
+inline FastClock::ClockDiff FastClock::resolution()
+{
+	return 1000000;
+}
+
+
+inline void swap(FastClock& c1, FastClock& c2)
+{
+	c1.swap(c2);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FastClock_INCLUDED
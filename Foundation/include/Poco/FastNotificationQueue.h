@@ -0,0 +1,182 @@
+//
+// FastNotificationQueue.h
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  FastNotificationQueue
+//
+// Definition of the FastNotificationQueue class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FastNotificationQueue_INCLUDED
+#define Foundation_FastNotificationQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Notification.h"
+#include "Poco/MPMCQueue.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <atomic>
+#include <vector>
+
+
+namespace Poco {
+
+
+class NotificationCenter;
+
+
+class Foundation_API FastNotificationQueue
+	/// A bounded, lock-free variant of NotificationQueue.
+	///
+	/// Notifications are passed through a fixed-size lock-free
+	/// ring buffer; as long as the queue is neither empty nor
+	/// full, enqueueNotification() and the dequeue methods do
+	/// not take any locks and do not signal any events, so the
+	/// queue scales to many concurrent producer and consumer
+	/// threads. Blocking (a consumer waiting for a notification,
+	/// or a producer waiting for space) falls back to a condition
+	/// variable.
+	///
+	/// In contrast to NotificationQueue, the queue has a fixed
+	/// capacity given in the constructor, and there is no
+	/// enqueueUrgentNotification(), as a ring buffer cannot
+	/// prepend. Otherwise the interface and ownership rules
+	/// are the same; in particular, the recommended shutdown
+	/// sequence with waiting worker threads is identical.
+{
+public:
+	explicit FastNotificationQueue(std::size_t size = 16384);
+		/// Creates the FastNotificationQueue with room for at
+		/// least size notifications. The actual capacity is
+		/// size rounded up to the next power of two.
+
+	~FastNotificationQueue();
+		/// Destroys the FastNotificationQueue.
+
+	void enqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO).
+		/// If the queue is full, waits until a consumer has
+		/// made room for the notification.
+		/// The queue takes ownership of the notification, thus
+		/// a call like
+		///     notificationQueue.enqueueNotification(new MyNotification);
+		/// does not result in a memory leak.
+
+	bool tryEnqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO), if room is available.
+		/// Returns true if the notification has been enqueued,
+		/// or false if the queue is full. The queue takes
+		/// ownership of the notification if (and only if)
+		/// true is returned.
+
+	Notification* dequeueNotification();
+		/// Dequeues the next pending notification.
+		/// Returns 0 (null) if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification();
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		/// This method returns 0 (null) if wakeUpAll()
+		/// has been called by another thread.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification(long milliseconds);
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns 0 (null) if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	int dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// Returns the number of notifications dequeued.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if wakeUpAll() has been called by another thread.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if no notification became available in time.
+
+	void dispatch(NotificationCenter& notificationCenter);
+		/// Dispatches all queued notifications to the given
+		/// notification center.
+
+	void wakeUpAll();
+		/// Wakes up all threads that wait for a notification.
+
+	bool empty() const;
+		/// Returns true iff the queue is empty.
+
+	int size() const;
+		/// Returns the approximate number of notifications in the queue.
+
+	std::size_t capacity() const;
+		/// Returns the maximum number of notifications the queue can hold.
+
+	void clear();
+		/// Removes all notifications from the queue.
+
+	bool hasIdleThreads() const;
+		/// Returns true if the queue has at least one thread waiting
+		/// for a notification.
+
+private:
+	FastNotificationQueue(const FastNotificationQueue&);
+	FastNotificationQueue& operator = (const FastNotificationQueue&);
+
+	Notification* dequeueOne();
+	void notifyConsumer();
+	void notifyProducer();
+
+	MPMCQueue<Notification*> _ring;
+	std::atomic<int>  _consumerSleepers;
+	std::atomic<int>  _producerSleepers;
+	unsigned long     _wakeUpGeneration;
+	Condition         _nfAvailable;
+	Condition         _roomAvailable;
+	mutable FastMutex _mutex;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FastNotificationQueue_INCLUDED
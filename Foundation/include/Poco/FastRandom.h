@@ -0,0 +1,159 @@
+//
+// FastRandom.h
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  FastRandom
+//
+// Definition of class FastRandom.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FastRandom_INCLUDED
+#define Foundation_FastRandom_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API FastRandom
+	/// A fast pseudo random number generator based on the
+	/// xoshiro256** algorithm by Blackman and Vigna.
+	///
+	/// FastRandom keeps only 32 bytes of state, produces 64 bits
+	/// per step with a handful of arithmetic operations and has a
+	/// period of 2^256 - 1. It is considerably faster than Random
+	/// and well suited for sampling, jitter and load-balancing
+	/// decisions where random numbers are consumed at a high rate.
+	/// The fill() member function generates random bytes in bulk,
+	/// without per-value call overhead.
+	///
+	/// FastRandom is not suitable for cryptographic purposes; use
+	/// RandomInputStream for that.
+{
+public:
+	FastRandom();
+		/// Creates the PRNG and seeds it with
+		/// a random seed obtained from a RandomInputStream.
+
+	explicit FastRandom(UInt64 seed);
+		/// Creates the PRNG and seeds it with the given seed.
+
+	~FastRandom();
+		/// Destroys the PRNG.
+
+	void seed(UInt64 seed);
+		/// Seeds the pseudo random generator with the given seed.
+		/// The 256-bit internal state is expanded from the seed
+		/// with the splitmix64 algorithm.
+
+	void seed();
+		/// Seeds the pseudo random generator with a random seed
+		/// obtained from a RandomInputStream.
+
+	UInt64 next64();
+		/// Returns the next 64-bit pseudo random number.
+
+	UInt32 next();
+		/// Returns the next 31-bit pseudo random number.
+
+	UInt32 next(UInt32 n);
+		/// Returns the next 31-bit pseudo random number modulo n.
+
+	char nextChar();
+		/// Returns the next pseudo random character.
+
+	bool nextBool();
+		/// Returns the next boolean pseudo random value.
+
+	float nextFloat();
+		/// Returns the next float pseudo random number between 0.0 and 1.0.
+
+	double nextDouble();
+		/// Returns the next double pseudo random number between 0.0 and 1.0.
+
+	void fill(void* buffer, std::size_t length);
+		/// Fills the given buffer with pseudo random bytes,
+		/// eight bytes per generator step.
+
+private:
+	static UInt64 rotl(UInt64 x, int k);
+
+	UInt64 _s[4];
+};
+
+
+//
+// inlines
+//
+inline UInt64 FastRandom::rotl(UInt64 x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+
+inline UInt64 FastRandom::next64()
+{
+	const UInt64 result = rotl(_s[1] * 5, 7) * 9;
+	const UInt64 t = _s[1] << 17;
+
+	_s[2] ^= _s[0];
+	_s[3] ^= _s[1];
+	_s[1] ^= _s[2];
+	_s[0] ^= _s[3];
+	_s[2] ^= t;
+	_s[3] = rotl(_s[3], 45);
+
+	return result;
+}
+
+
+inline UInt32 FastRandom::next()
+{
+	return UInt32(next64() >> 33);
+}
+
+
+inline UInt32 FastRandom::next(UInt32 n)
+{
+	return next() % n;
+}
+
+
+inline char FastRandom::nextChar()
+{
+	return char((next64() >> 32) & 0xFF);
+}
+
+
+inline bool FastRandom::nextBool()
+{
+	return (next64() & 0x8000000000000000ULL) != 0;
+}
+
+
+inline float FastRandom::nextFloat()
+{
+	return float(next64() >> 40) / float(1 << 24);
+}
+
+
+inline double FastRandom::nextDouble()
+{
+	return double(next64() >> 11) / double(1ULL << 53);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FastRandom_INCLUDED
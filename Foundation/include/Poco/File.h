@@ -70,6 +70,15 @@ public:
 		LINK_SYMBOLIC = 1  /// symbolic link
 	};
 
+	enum Options
+		/// Options for copyTo().
+	{
+		OPT_COPY_NO_PAGE_CACHE = OPT_COPY_NO_PAGE_CACHE_IMPL
+			/// Drop the copied data from the operating system's
+			/// page cache after copying, so that copying large
+			/// files does not evict more useful cached data.
+	};
+
 	File();
 		/// Creates the file.
 
@@ -183,11 +192,19 @@ public:
 		///
 		/// Does nothing on Windows.
 
-	void copyTo(const std::string& path) const;
+	void copyTo(const std::string& path, int options = 0) const;
 		/// Copies the file (or directory) to the given path.
 		/// The target path can be a directory.
 		///
 		/// A directory is copied recursively.
+		/// An optional combination of Options flags can be given.
+		///
+		/// On Linux, the copy is performed within the kernel where
+		/// possible: if source and target are on the same filesystem
+		/// and the filesystem supports it (e.g., Btrfs or XFS), the
+		/// file is cloned (reflinked) without copying any data;
+		/// otherwise copy_file_range() or sendfile() are used,
+		/// avoiding the round trip through a userspace buffer.
 
 	void moveTo(const std::string& path);
 		/// Copies the file (or directory) to the given path and
@@ -253,7 +270,7 @@ public:
 		/// exception for the last file-related error.
 
 protected:
-	void copyDirectory(const std::string& path) const;
+	void copyDirectory(const std::string& path, int options = 0) const;
 		/// Copies a directory. Used internally by copyTo().
 };
 
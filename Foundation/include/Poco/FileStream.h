@@ -48,19 +48,64 @@ class Foundation_API FileIOS: public virtual std::ios
 	/// UTF-8 encoded Unicode paths are correctly handled.
 {
 public:
+	enum OpenOption
+		/// Options for opening a file, in addition to the
+		/// std::ios::openmode flags.
+	{
+		OPT_DSYNC = 0x01  /// synchronized data writes (O_DSYNC on POSIX, FILE_FLAG_WRITE_THROUGH on Windows)
+	};
+
+	enum Advice
+		/// Access pattern hints for advise().
+	{
+		ADV_NORMAL,     /// no special access pattern (resets a previously given hint)
+		ADV_SEQUENTIAL, /// data will be accessed sequentially
+		ADV_RANDOM,     /// data will be accessed in random order
+		ADV_WILLNEED,   /// data will be needed soon
+		ADV_DONTNEED    /// data will not be needed again; drop it from the page cache
+	};
+
 	FileIOS(std::ios::openmode defaultMode);
 		/// Creates the basic stream.
-		
+
 	~FileIOS();
 		/// Destroys the stream.
 
 	void open(const std::string& path, std::ios::openmode mode);
 		/// Opens the file specified by path, using the given mode.
 		///
-		/// Throws a FileException (or a similar exception) if the file 
+		/// Throws a FileException (or a similar exception) if the file
+		/// does not exist or is not accessible for other reasons and
+		/// a new file cannot be created.
+
+	void open(const std::string& path, std::ios::openmode mode, int openOptions);
+		/// Opens the file specified by path, using the given mode and
+		/// a combination of OpenOption flags.
+		///
+		/// Throws a FileException (or a similar exception) if the file
 		/// does not exist or is not accessible for other reasons and
 		/// a new file cannot be created.
 
+	void advise(Advice advice);
+		/// Announces the intended access pattern for the file data
+		/// to the operating system (using posix_fadvise() on POSIX
+		/// platforms).
+		///
+		/// For ADV_DONTNEED on a stream opened for writing, buffered
+		/// data is flushed to disk first, so that the written pages
+		/// can actually be dropped from the page cache.
+		///
+		/// The hints are advisory only and are ignored on platforms
+		/// that do not support them. The stream must be open.
+
+	void preallocate(UInt64 length);
+		/// Allocates disk space for the first length bytes of the
+		/// file (using fallocate() or posix_fallocate(), where
+		/// available), extending the file size if it is currently
+		/// smaller than length. The stream must be open.
+		///
+		/// Throws a FileException if the space cannot be allocated.
+
 	void close();
 		/// Closes the file stream.
 		///
@@ -128,10 +173,21 @@ public:
 		/// Creates the FileOutputStream for the file given by path, using
 		/// the given mode.
 		///
-		/// The std::ios::out is always set, regardless of the actual 
+		/// The std::ios::out is always set, regardless of the actual
+		/// value specified for mode.
+		///
+		/// Throws a FileException (or a similar exception) if the file
+		/// does not exist or is not accessible for other reasons and
+		/// a new file cannot be created.
+
+	FileOutputStream(const std::string& path, std::ios::openmode mode, int openOptions);
+		/// Creates the FileOutputStream for the file given by path, using
+		/// the given mode and a combination of OpenOption flags.
+		///
+		/// The std::ios::out is always set, regardless of the actual
 		/// value specified for mode.
 		///
-		/// Throws a FileException (or a similar exception) if the file 
+		/// Throws a FileException (or a similar exception) if the file
 		/// does not exist or is not accessible for other reasons and
 		/// a new file cannot be created.
 
@@ -165,6 +221,10 @@ public:
 		/// Creates the FileStream for the file given by path, using
 		/// the given mode.
 
+	FileStream(const std::string& path, std::ios::openmode mode, int openOptions);
+		/// Creates the FileStream for the file given by path, using
+		/// the given mode and a combination of OpenOption flags.
+
 	~FileStream();
 		/// Destroys the FileOutputStream.
 };
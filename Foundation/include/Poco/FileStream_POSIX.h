@@ -37,8 +37,9 @@ public:
 	~FileStreamBuf();
 		/// Destroys the FileStream.
 
-	void open(const std::string& path, std::ios::openmode mode);
-		/// Opens the given file in the given mode.
+	void open(const std::string& path, std::ios::openmode mode, int openOptions = 0);
+		/// Opens the given file in the given mode, with an optional
+		/// combination of FileIOS::OpenOption flags.
 
 	bool close();
 		/// Closes the File stream buffer. Returns true if successful,
@@ -50,6 +51,19 @@ public:
 	std::streampos seekpos(std::streampos pos, std::ios::openmode mode = std::ios::in | std::ios::out);
 		/// Change to specified position, according to mode.
 
+	int nativeHandle() const;
+		/// Returns the underlying file descriptor, or -1 if
+		/// the stream buffer is not open.
+
+	void advise(int advice);
+		/// Gives the operating system a FileIOS::Advice hint
+		/// for the file data, using posix_fadvise().
+
+	void preallocate(UInt64 length);
+		/// Allocates disk space for the first length bytes of
+		/// the file, extending the file size if it is currently
+		/// smaller than length.
+
 protected:
 	enum
 	{
@@ -66,6 +80,15 @@ private:
 };
 
 
+//
+// inlines
+//
+inline int FileStreamBuf::nativeHandle() const
+{
+	return _fd;
+}
+
+
 } // namespace Poco
 
 
@@ -36,8 +36,9 @@ public:
 	~FileStreamBuf();
 		/// Destroys the FileStream.
 
-	void open(const std::string& path, std::ios::openmode mode);
-		/// Opens the given file in the given mode.
+	void open(const std::string& path, std::ios::openmode mode, int openOptions = 0);
+		/// Opens the given file in the given mode, with an optional
+		/// combination of FileIOS::OpenOption flags.
 
 	bool close();
 		/// Closes the File stream buffer. Returns true if successful,
@@ -49,6 +50,19 @@ public:
 	std::streampos seekpos(std::streampos pos, std::ios::openmode mode = std::ios::in | std::ios::out);
 		/// change to specified position, according to mode
 
+	HANDLE nativeHandle() const;
+		/// Returns the underlying file handle, or INVALID_HANDLE_VALUE
+		/// if the stream buffer is not open.
+
+	void advise(int advice);
+		/// Gives the operating system a FileIOS::Advice hint
+		/// for the file data. A no-op on Windows.
+
+	void preallocate(UInt64 length);
+		/// Allocates disk space for the first length bytes of
+		/// the file, extending the file size if it is currently
+		/// smaller than length.
+
 protected:
 	enum
 	{
@@ -65,6 +79,15 @@ private:
 };
 
 
+//
+// inlines
+//
+inline HANDLE FileStreamBuf::nativeHandle() const
+{
+	return _handle;
+}
+
+
 } // namespace Poco
 
 
@@ -26,6 +26,12 @@ namespace Poco {
 
 class FileImpl
 {
+public:
+	enum Options
+	{
+		OPT_COPY_NO_PAGE_CACHE_IMPL = 0x01
+	};
+
 protected:
 	typedef UInt64 FileSizeImpl;
 
@@ -51,7 +57,7 @@ protected:
 	void setSizeImpl(FileSizeImpl size);
 	void setWriteableImpl(bool flag = true);
 	void setExecutableImpl(bool flag = true);
-	void copyToImpl(const std::string& path) const;
+	void copyToImpl(const std::string& path, int options = 0) const;
 	void renameToImpl(const std::string& path);
 	void linkToImpl(const std::string& path, int type) const;
 	void removeImpl();
@@ -0,0 +1,469 @@
+//
+// FlatHashMap.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashMap
+//
+// Definition of the FlatHashMap class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashMap_INCLUDED
+#define Foundation_FlatHashMap_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Hash.h"
+#include "Poco/HashMap.h"
+#include "Poco/Exception.h"
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class Key, class Mapped, class HashFunc = Hash<Key> >
+class FlatHashMap
+	/// This class implements a map using a flat, open-addressing
+	/// hash table with robin-hood probing and backward-shift
+	/// deletion.
+	///
+	/// Unlike HashMap, which chains per-entry nodes off a bucket
+	/// vector, all entries are stored contiguously in a single
+	/// array, so a lookup typically touches only one or two cache
+	/// lines. This makes FlatHashMap preferable for large,
+	/// lookup-heavy tables.
+	///
+	/// The interface follows HashMap. In addition, find(), count()
+	/// and erase() accept any type that can be hashed by HashFunc
+	/// and compared to Key, enabling heterogeneous lookup (e.g.,
+	/// probing a std::string-keyed map with a const char* without
+	/// constructing a temporary string).
+	///
+	/// Note that insertion and deletion invalidate all iterators
+	/// and references, since entries are stored by value and may
+	/// be moved during probing.
+{
+public:
+	typedef Key           KeyType;
+	typedef Mapped        MappedType;
+	typedef Mapped&       Reference;
+	typedef const Mapped& ConstReference;
+	typedef Mapped*       Pointer;
+	typedef const Mapped* ConstPointer;
+
+	typedef HashMapEntry<Key, Mapped>      ValueType;
+	typedef std::pair<KeyType, MappedType> PairType;
+
+	class ConstIterator
+	{
+	public:
+		ConstIterator(): _pBucket(0), _pEnd(0)
+		{
+		}
+
+		ConstIterator(const ConstIterator& it): _pBucket(it._pBucket), _pEnd(it._pEnd)
+		{
+		}
+
+		ConstIterator& operator = (const ConstIterator& it)
+		{
+			_pBucket = it._pBucket;
+			_pEnd    = it._pEnd;
+			return *this;
+		}
+
+		bool operator == (const ConstIterator& it) const
+		{
+			return _pBucket == it._pBucket;
+		}
+
+		bool operator != (const ConstIterator& it) const
+		{
+			return _pBucket != it._pBucket;
+		}
+
+		ConstIterator& operator ++ () // prefix
+		{
+			++_pBucket;
+			skipEmpty();
+			return *this;
+		}
+
+		ConstIterator operator ++ (int) // postfix
+		{
+			ConstIterator result(*this);
+			++*this;
+			return result;
+		}
+
+		const ValueType& operator * () const
+		{
+			return _pBucket->value;
+		}
+
+		const ValueType* operator -> () const
+		{
+			return &_pBucket->value;
+		}
+
+	protected:
+		struct Bucket
+		{
+			Bucket(): hash(0), value()
+			{
+			}
+
+			std::size_t hash; // zero means empty
+			ValueType   value;
+		};
+
+		ConstIterator(Bucket* pBucket, Bucket* pEnd): _pBucket(pBucket), _pEnd(pEnd)
+		{
+			skipEmpty();
+		}
+
+		void skipEmpty()
+		{
+			while (_pBucket != _pEnd && _pBucket->hash == 0) ++_pBucket;
+		}
+
+		Bucket* _pBucket;
+		Bucket* _pEnd;
+
+		friend class FlatHashMap;
+	};
+
+	class Iterator: public ConstIterator
+	{
+	public:
+		Iterator()
+		{
+		}
+
+		Iterator(const Iterator& it): ConstIterator(it)
+		{
+		}
+
+		Iterator& operator = (const Iterator& it)
+		{
+			ConstIterator::operator = (it);
+			return *this;
+		}
+
+		Iterator& operator ++ () // prefix
+		{
+			ConstIterator::operator ++ ();
+			return *this;
+		}
+
+		Iterator operator ++ (int) // postfix
+		{
+			Iterator result(*this);
+			++*this;
+			return result;
+		}
+
+		ValueType& operator * () const
+		{
+			return this->_pBucket->value;
+		}
+
+		ValueType* operator -> () const
+		{
+			return &this->_pBucket->value;
+		}
+
+	protected:
+		typedef typename ConstIterator::Bucket Bucket;
+
+		Iterator(Bucket* pBucket, Bucket* pEnd): ConstIterator(pBucket, pEnd)
+		{
+		}
+
+		friend class FlatHashMap;
+	};
+
+	FlatHashMap():
+		_size(0)
+		/// Creates an empty FlatHashMap.
+	{
+	}
+
+	FlatHashMap(std::size_t initialReserve):
+		_size(0)
+		/// Creates the FlatHashMap with room for initialReserve entries.
+	{
+		_buckets.resize(capacityFor(initialReserve));
+	}
+
+	FlatHashMap& operator = (const FlatHashMap& map)
+		/// Assigns another FlatHashMap.
+	{
+		FlatHashMap tmp(map);
+		swap(tmp);
+		return *this;
+	}
+
+	void swap(FlatHashMap& map)
+		/// Swaps the FlatHashMap with another one.
+	{
+		_buckets.swap(map._buckets);
+		std::swap(_size, map._size);
+	}
+
+	ConstIterator begin() const
+	{
+		return ConstIterator(bucketBegin(), bucketEnd());
+	}
+
+	ConstIterator end() const
+	{
+		return ConstIterator(bucketEnd(), bucketEnd());
+	}
+
+	Iterator begin()
+	{
+		return Iterator(bucketBegin(), bucketEnd());
+	}
+
+	Iterator end()
+	{
+		return Iterator(bucketEnd(), bucketEnd());
+	}
+
+	template <class K>
+	ConstIterator find(const K& key) const
+	{
+		Bucket* pBucket = findBucket(key);
+		return ConstIterator(pBucket ? pBucket : bucketEnd(), bucketEnd());
+	}
+
+	template <class K>
+	Iterator find(const K& key)
+	{
+		Bucket* pBucket = findBucket(key);
+		return Iterator(pBucket ? pBucket : bucketEnd(), bucketEnd());
+	}
+
+	template <class K>
+	std::size_t count(const K& key) const
+	{
+		return findBucket(key) ? 1 : 0;
+	}
+
+	std::pair<Iterator, bool> insert(const PairType& pair)
+	{
+		return insert(ValueType(pair.first, pair.second));
+	}
+
+	std::pair<Iterator, bool> insert(const ValueType& value)
+	{
+		std::size_t h = hashFor(value.first);
+		Bucket* pBucket = findBucket(value.first);
+		if (pBucket)
+			return std::make_pair(Iterator(pBucket, bucketEnd()), false);
+		if ((_size + 1)*4 > _buckets.size()*3)
+			rehash(capacityFor(_size + 1));
+		pBucket = insertBucket(h, value);
+		++_size;
+		return std::make_pair(Iterator(pBucket, bucketEnd()), true);
+	}
+
+	void erase(Iterator it)
+	{
+		if (it != end())
+			eraseBucket(it._pBucket);
+	}
+
+	template <class K>
+	void erase(const K& key)
+	{
+		Bucket* pBucket = findBucket(key);
+		if (pBucket)
+			eraseBucket(pBucket);
+	}
+
+	void clear()
+	{
+		BucketVec empty(_buckets.size());
+		_buckets.swap(empty);
+		_size = 0;
+	}
+
+	std::size_t size() const
+	{
+		return _size;
+	}
+
+	bool empty() const
+	{
+		return _size == 0;
+	}
+
+	ConstReference operator [] (const KeyType& key) const
+	{
+		Bucket* pBucket = findBucket(key);
+		if (pBucket)
+			return pBucket->value.second;
+		else
+			throw NotFoundException();
+	}
+
+	Reference operator [] (const KeyType& key)
+	{
+		std::pair<Iterator, bool> res = insert(ValueType(key));
+		return res.first->second;
+	}
+
+private:
+	typedef typename ConstIterator::Bucket Bucket;
+	typedef std::vector<Bucket> BucketVec;
+
+	enum
+	{
+		MIN_BUCKET_COUNT = 16
+	};
+
+	static std::size_t capacityFor(std::size_t n)
+		/// Returns the smallest power of two bucket count
+		/// keeping the load factor below 3/4 for n entries.
+	{
+		std::size_t result = MIN_BUCKET_COUNT;
+		while (n*4 > result*3) result *= 2;
+		return result;
+	}
+
+	template <class K>
+	std::size_t hashFor(const K& key) const
+	{
+		std::size_t h = _hash(key);
+		// zero marks an empty bucket
+		return h ? h : 0x9E3779B9;
+	}
+
+	std::size_t probeDistance(std::size_t hash, std::size_t index) const
+	{
+		std::size_t mask = _buckets.size() - 1;
+		return (index + _buckets.size() - (hash & mask)) & mask;
+	}
+
+	Bucket* bucketBegin() const
+	{
+		return _buckets.empty() ? 0 : const_cast<Bucket*>(&_buckets[0]);
+	}
+
+	Bucket* bucketEnd() const
+	{
+		return _buckets.empty() ? 0 : const_cast<Bucket*>(&_buckets[0]) + _buckets.size();
+	}
+
+	template <class K>
+	Bucket* findBucket(const K& key) const
+	{
+		if (_size == 0) return 0;
+		std::size_t mask  = _buckets.size() - 1;
+		std::size_t h     = hashFor(key);
+		std::size_t index = h & mask;
+		std::size_t dist  = 0;
+		for (;;)
+		{
+			const Bucket& bucket = _buckets[index];
+			if (bucket.hash == 0)
+				return 0;
+			if (dist > probeDistance(bucket.hash, index))
+				return 0;
+			if (bucket.hash == h && bucket.value.first == key)
+				return const_cast<Bucket*>(&bucket);
+			index = (index + 1) & mask;
+			++dist;
+		}
+	}
+
+	Bucket* insertBucket(std::size_t h, const ValueType& value)
+		/// Robin-hood insertion: entries that have probed further
+		/// from their home bucket displace entries that are closer
+		/// to theirs.
+	{
+		std::size_t mask  = _buckets.size() - 1;
+		std::size_t index = h & mask;
+		std::size_t dist  = 0;
+		std::size_t insHash  = h;
+		ValueType   insValue(value);
+		Bucket* pResult = 0;
+		for (;;)
+		{
+			Bucket& bucket = _buckets[index];
+			if (bucket.hash == 0)
+			{
+				bucket.hash  = insHash;
+				bucket.value = std::move(insValue);
+				return pResult ? pResult : &bucket;
+			}
+			std::size_t bucketDist = probeDistance(bucket.hash, index);
+			if (bucketDist < dist)
+			{
+				std::swap(bucket.hash, insHash);
+				std::swap(bucket.value, insValue);
+				if (!pResult) pResult = &bucket;
+				dist = bucketDist;
+			}
+			index = (index + 1) & mask;
+			++dist;
+		}
+	}
+
+	void eraseBucket(Bucket* pBucket)
+		/// Backward-shift deletion: subsequent displaced entries
+		/// are moved one slot back, keeping probe sequences intact
+		/// without tombstones.
+	{
+		std::size_t mask  = _buckets.size() - 1;
+		std::size_t index = static_cast<std::size_t>(pBucket - &_buckets[0]);
+		for (;;)
+		{
+			std::size_t next = (index + 1) & mask;
+			Bucket& bucket     = _buckets[index];
+			Bucket& nextBucket = _buckets[next];
+			if (nextBucket.hash == 0 || probeDistance(nextBucket.hash, next) == 0)
+			{
+				bucket.hash  = 0;
+				bucket.value = ValueType();
+				break;
+			}
+			bucket.hash  = nextBucket.hash;
+			bucket.value = std::move(nextBucket.value);
+			index = next;
+		}
+		--_size;
+	}
+
+	void rehash(std::size_t bucketCount)
+	{
+		BucketVec oldBuckets(bucketCount);
+		oldBuckets.swap(_buckets);
+		for (typename BucketVec::iterator it = oldBuckets.begin(); it != oldBuckets.end(); ++it)
+		{
+			if (it->hash != 0)
+				insertBucket(it->hash, it->value);
+		}
+	}
+
+	BucketVec   _buckets;
+	std::size_t _size;
+	HashFunc    _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashMap_INCLUDED
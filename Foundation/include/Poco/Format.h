@@ -20,7 +20,11 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/Any.h"
+#include "Poco/NumericString.h"
 #include <vector>
+#include <type_traits>
+#include <cstdio>
+#include <cstring>
 
 
 namespace Poco {
@@ -132,6 +136,292 @@ void Foundation_API format(std::string& result, const std::string& fmt, const st
 	/// all other variants of format().
 
 
+namespace Impl {
+
+
+struct FormatSpec
+	/// A parsed %-specification for the formatTo() fast path.
+{
+	int  index;     // explicit argument index, or -1
+	int  width;
+	int  precision; // -1 if not given
+	char type;
+	bool leftAlign;
+	bool zeroPad;
+	bool showSign;
+	bool altForm;
+};
+
+
+inline bool parseFormatSpec(const char*& p, FormatSpec& spec)
+	/// Parses the %-specification starting after the percent sign
+	/// at p and advances p past it. Returns false if no valid
+	/// type character is found.
+{
+	spec.index = -1;
+	spec.width = 0;
+	spec.precision = -1;
+	spec.type = 0;
+	spec.leftAlign = false;
+	spec.zeroPad = false;
+	spec.showSign = false;
+	spec.altForm = false;
+
+	if (*p == '[')
+	{
+		++p;
+		if (*p < '0' || *p > '9') return false;
+		int n = 0;
+		while (*p >= '0' && *p <= '9') n = n*10 + (*p++ - '0');
+		if (*p != ']') return false;
+		++p;
+		spec.index = n;
+	}
+	for (;; ++p)
+	{
+		if (*p == '-') spec.leftAlign = true;
+		else if (*p == '+') spec.showSign = true;
+		else if (*p == '0') spec.zeroPad = true;
+		else if (*p == '#') spec.altForm = true;
+		else break;
+	}
+	while (*p >= '0' && *p <= '9') spec.width = spec.width*10 + (*p++ - '0');
+	if (*p == '.')
+	{
+		++p;
+		spec.precision = 0;
+		while (*p >= '0' && *p <= '9') spec.precision = spec.precision*10 + (*p++ - '0');
+	}
+	while (*p == 'l' || *p == 'L' || *p == 'h' || *p == '?') ++p;
+	switch (*p)
+	{
+	case 'b': case 'c': case 'd': case 'i': case 'o': case 'u':
+	case 'x': case 'X': case 'e': case 'E': case 'f': case 'g':
+	case 'G': case 's': case 'z':
+		spec.type = *p++;
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+inline void appendPadded(std::string& result, const char* text, std::size_t length, const FormatSpec& spec)
+{
+	if (!spec.leftAlign && length < std::size_t(spec.width))
+		result.append(std::size_t(spec.width) - length, ' ');
+	result.append(text, length);
+	if (spec.leftAlign && length < std::size_t(spec.width))
+		result.append(std::size_t(spec.width) - length, ' ');
+}
+
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value>::type
+formatValue(std::string& result, const FormatSpec& spec, T value)
+{
+	typedef typename UnsignedType<T>::Type UT;
+
+	char buffer[POCO_MAX_INT_STRING_LEN + 1];
+	char* out = buffer;
+	std::size_t size = POCO_MAX_INT_STRING_LEN;
+	int width = (spec.zeroPad && !spec.leftAlign) ? spec.width : -1;
+	switch (spec.type)
+	{
+	case 'd': case 'i':
+		if (spec.showSign && value >= 0)
+		{
+			*out++ = '+';
+			if (width > 0) --width;
+		}
+		intToStr(value, 10, out, size, false, width, '0');
+		break;
+	case 'u': case 'z':
+		uIntToStr(static_cast<UT>(value), 10, out, size, false, width, '0');
+		break;
+	case 'o':
+		uIntToStr(static_cast<UT>(value), 010, out, size, spec.altForm, width, '0');
+		break;
+	case 'x': case 'X':
+		uIntToStr(static_cast<UT>(value), 0x10, out, size, spec.altForm, width, '0');
+		if (spec.type == 'x')
+		{
+			for (char* q = out; q != out + size; ++q)
+			{
+				if (*q >= 'A' && *q <= 'F') *q += 'a' - 'A';
+			}
+		}
+		break;
+	case 'c':
+		*out = static_cast<char>(value);
+		size = 1;
+		break;
+	case 'b':
+		*out = value ? '1' : '0';
+		size = 1;
+		break;
+	default:
+		result.append("[ERRFMT]");
+		return;
+	}
+	appendPadded(result, buffer, size + (out - buffer), spec);
+}
+
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type
+formatValue(std::string& result, const FormatSpec& spec, T value)
+{
+	switch (spec.type)
+	{
+	case 'e': case 'E': case 'f': case 'g': case 'G':
+		break;
+	default:
+		result.append("[ERRFMT]");
+		return;
+	}
+
+	// let snprintf handle flags, width and precision for
+	// floating-point values; the buffer accommodates the full
+	// %f range of a double
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	char printfSpec[12];
+	int k = 0;
+	printfSpec[k++] = '%';
+	if (spec.leftAlign) printfSpec[k++] = '-';
+	if (spec.showSign)  printfSpec[k++] = '+';
+	if (spec.zeroPad)   printfSpec[k++] = '0';
+	if (spec.altForm)   printfSpec[k++] = '#';
+	printfSpec[k++] = '*';
+	printfSpec[k++] = '.';
+	printfSpec[k++] = '*';
+	printfSpec[k++] = spec.type;
+	printfSpec[k] = '\0';
+
+	int width = spec.width > 350 ? 350 : spec.width;
+	int precision = spec.precision;
+	if (precision < 0) precision = 6;
+	else if (precision > 350) precision = 350;
+	int n = std::snprintf(buffer, sizeof(buffer), printfSpec, width, precision, double(value));
+	if (n < 0 || n >= int(sizeof(buffer)))
+	{
+		result.append("[ERRFMT]");
+		return;
+	}
+	result.append(buffer, std::size_t(n));
+}
+
+
+inline void formatStringValue(std::string& result, const FormatSpec& spec, const char* value, std::size_t length)
+{
+	if (spec.type != 's')
+	{
+		result.append("[ERRFMT]");
+		return;
+	}
+	if (spec.precision >= 0 && std::size_t(spec.precision) < length)
+		length = std::size_t(spec.precision);
+	appendPadded(result, value, length, spec);
+}
+
+
+inline void formatValue(std::string& result, const FormatSpec& spec, const std::string& value)
+{
+	formatStringValue(result, spec, value.data(), value.length());
+}
+
+
+inline void formatValue(std::string& result, const FormatSpec& spec, const char* value)
+{
+	formatStringValue(result, spec, value, std::strlen(value));
+}
+
+
+inline bool formatNth(std::string& /*result*/, const FormatSpec& /*spec*/, std::size_t /*index*/)
+	/// Recursion end: no argument with the given index exists.
+{
+	return false;
+}
+
+
+template <typename T, typename... Rest>
+bool formatNth(std::string& result, const FormatSpec& spec, std::size_t index, const T& value, const Rest&... rest)
+{
+	if (index == 0)
+	{
+		formatValue(result, spec, value);
+		return true;
+	}
+	return formatNth(result, spec, index - 1, rest...);
+}
+
+
+} // namespace Impl
+
+
+template <typename... Args>
+void formatTo(std::string& result, const char* fmt, const Args&... args)
+	/// Appends the formatted string to result, like
+	/// format(std::string&, const std::string&, ...), but without
+	/// boxing the arguments into Any and without any intermediate
+	/// heap allocation: each argument is formatted by code selected
+	/// at compile time from its static type, and passing an
+	/// argument type that cannot be formatted fails to compile
+	/// instead of throwing at runtime.
+	///
+	/// The %-specification syntax is the same as for format(),
+	/// with two differences: the h/l/L/? length modifiers are
+	/// accepted but ignored, since the argument's actual type
+	/// determines the conversion, and a type character that does
+	/// not match the argument's type class (e.g. %s for an
+	/// integer) appends [ERRFMT] instead of throwing.
+	///
+	/// Supported argument types are the built-in integral and
+	/// floating-point types, std::string and const char*.
+{
+	std::size_t argIndex = 0;
+	const char* p = fmt;
+	while (*p)
+	{
+		if (*p != '%')
+		{
+			result += *p++;
+			continue;
+		}
+		const char* specStart = p++;
+		if (*p == '%')
+		{
+			result += '%';
+			++p;
+			continue;
+		}
+		Impl::FormatSpec spec;
+		if (!Impl::parseFormatSpec(p, spec))
+		{
+			result.append(specStart, p - specStart);
+			continue;
+		}
+		std::size_t useIndex = (spec.index >= 0) ? std::size_t(spec.index) : argIndex++;
+		if (!Impl::formatNth(result, spec, useIndex, args...))
+		{
+			// more format specifiers than values: copy verbatim
+			result.append(specStart, p - specStart);
+		}
+	}
+}
+
+
+template <typename... Args>
+std::string formatTo(const char* fmt, const Args&... args)
+	/// Returns the formatted string.
+	/// See formatTo(std::string&, const char*, ...) for details.
+{
+	std::string result;
+	formatTo(result, fmt, args...);
+	return result;
+}
+
+
 } // namespace Poco
 
 
@@ -20,6 +20,7 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/Channel.h"
+#include "Poco/ThreadLocal.h"
 
 
 namespace Poco {
@@ -87,6 +88,7 @@ protected:
 private:
 	Formatter* _pFormatter;
 	Channel* _pChannel;
+	ThreadLocal<std::string> _textBuffer;
 };
 
 
@@ -56,6 +56,7 @@ public:
 		GLOB_DOT_SPECIAL     = 0x01, /// '*' and '?' do not match '.' at beginning of subject
 		GLOB_FOLLOW_SYMLINKS = 0x02, /// follow symbolic links
 		GLOB_CASELESS        = 0x04, /// ignore case when comparing characters
+		GLOB_PARALLEL        = 0x08, /// distribute directory scans over the default thread pool (glob() only)
 		GLOB_DIRS_ONLY       = 0x80  /// only glob for directories (for internal use only)
 	};
 	
@@ -89,6 +90,10 @@ public:
 		///
 		/// Directories that for whatever reason cannot be traversed are
 		/// ignored.
+		///
+		/// If the GLOB_PARALLEL option is specified, the scans of
+		/// separate subdirectories are distributed over the default
+		/// thread pool.
 
 	static void glob(const char* pathPattern, std::set<std::string>& files, int options = 0);
 		/// Creates a set of files that match the given pathPattern.
@@ -104,6 +109,10 @@ public:
 		///
 		/// Directories that for whatever reason cannot be traversed are
 		/// ignored.
+		///
+		/// If the GLOB_PARALLEL option is specified, the scans of
+		/// separate subdirectories are distributed over the default
+		/// thread pool.
 
 	static void glob(const Path& pathPattern, std::set<std::string>& files, int options = 0);
 		/// Creates a set of files that match the given pathPattern.
@@ -116,6 +125,10 @@ public:
 		///
 		/// Directories that for whatever reason cannot be traversed are
 		/// ignored.
+		///
+		/// If the GLOB_PARALLEL option is specified, the scans of
+		/// separate subdirectories are distributed over the default
+		/// thread pool.
 
 	static void glob(const Path& pathPattern, const Path& basePath, std::set<std::string>& files, int options = 0);
 		/// Creates a set of files that match the given pathPattern, starting from basePath.
@@ -128,6 +141,10 @@ public:
 		///
 		/// Directories that for whatever reason cannot be traversed are
 		/// ignored.
+		///
+		/// If the GLOB_PARALLEL option is specified, the scans of
+		/// separate subdirectories are distributed over the default
+		/// thread pool.
 
 protected:
 	bool match(TextIterator& itp, const TextIterator& endp, TextIterator& its, const TextIterator& ends);
@@ -143,6 +160,8 @@ private:
 	Glob();
 	Glob(const Glob&);
 	Glob& operator = (const Glob&);
+
+	friend class GlobCollector;
 };
 
 
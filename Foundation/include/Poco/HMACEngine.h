@@ -27,15 +27,15 @@ namespace Poco {
 
 
 template <class Engine>
-class HMACEngine: public DigestEngine
-	/// This class implementes the HMAC message
-	/// authentication code algorithm, as specified
-	/// in RFC 2104. The underlying DigestEngine
-	/// (MD5Engine, SHA1Engine, etc.) must be given as 
-	/// template argument.
-	/// Since the HMACEngine is a DigestEngine, it can
-	/// be used with the DigestStream class to create
-	/// a HMAC for a stream.
+class HMACKey
+	/// Holds the precomputed padded key blocks (ipad and opad, see
+	/// RFC 2104) for use with a HMACEngine.
+	///
+	/// Deriving the padded blocks from the passphrase is the expensive
+	/// part of setting up a HMAC computation. When many messages are
+	/// authenticated with the same key (e.g., when signing requests),
+	/// compute the HMACKey once and construct the HMACEngine from it,
+	/// or use HMACEngine::hmac() for one-shot computations.
 {
 public:
 	enum
@@ -43,65 +43,62 @@ public:
 		BLOCK_SIZE  = Engine::BLOCK_SIZE,
 		DIGEST_SIZE = Engine::DIGEST_SIZE
 	};
-	
-	HMACEngine(const std::string& passphrase)
+
+	HMACKey(const std::string& passphrase)
+		/// Creates the HMACKey from the given passphrase.
 	{
 		init(passphrase.data(), passphrase.length());
 	}
-	
-	HMACEngine(const char* passphrase, std::size_t length)
+
+	HMACKey(const char* passphrase, std::size_t length)
+		/// Creates the HMACKey from the given passphrase.
 	{
 		poco_check_ptr (passphrase);
 
 		init(passphrase, length);
 	}
-	
-	~HMACEngine()
+
+	HMACKey(const HMACKey& key)
+	{
+		std::memcpy(_ipad, key._ipad, BLOCK_SIZE);
+		std::memcpy(_opad, key._opad, BLOCK_SIZE);
+	}
+
+	~HMACKey()
 	{
 		std::memset(_ipad, 0, BLOCK_SIZE);
 		std::memset(_opad, 0, BLOCK_SIZE);
-		delete [] _ipad;
-		delete [] _opad;
 	}
-		
-	std::size_t digestLength() const
+
+	HMACKey& operator = (const HMACKey& key)
 	{
-		return DIGEST_SIZE;
+		std::memcpy(_ipad, key._ipad, BLOCK_SIZE);
+		std::memcpy(_opad, key._opad, BLOCK_SIZE);
+		return *this;
 	}
-	
-	void reset()
+
+	const char* ipad() const
+		/// Returns the padded key block for the inner digest.
 	{
-		_engine.reset();
-		_engine.update(_ipad, BLOCK_SIZE);
+		return _ipad;
 	}
-	
-	const DigestEngine::Digest& digest()
+
+	const char* opad() const
+		/// Returns the padded key block for the outer digest.
 	{
-		const DigestEngine::Digest& d = _engine.digest();
-		char db[DIGEST_SIZE];
-		char* pdb = db;
-		for (DigestEngine::Digest::const_iterator it = d.begin(); it != d.end(); ++it)
-			*pdb++ = *it;
-		_engine.reset();
-		_engine.update(_opad, BLOCK_SIZE);
-		_engine.update(db, DIGEST_SIZE);
-		const DigestEngine::Digest& result = _engine.digest();
-		reset();
-		return result;
+		return _opad;
 	}
 
 protected:
 	void init(const char* passphrase, std::size_t length)
 	{
-		_ipad = new char[BLOCK_SIZE];
-		_opad = new char[BLOCK_SIZE];
 		std::memset(_ipad, 0, BLOCK_SIZE);
 		std::memset(_opad, 0, BLOCK_SIZE);
 		if (length > BLOCK_SIZE)
 		{
-			_engine.reset();
-			_engine.update(passphrase, length);
-			const DigestEngine::Digest& d = _engine.digest();
+			Engine engine;
+			engine.update(passphrase, length);
+			const DigestEngine::Digest& d = engine.digest();
 			char* ipad = _ipad;
 			char* opad = _opad;
 			int n = BLOCK_SIZE;
@@ -121,9 +118,119 @@ protected:
 			_ipad[i] ^= 0x36;
 			_opad[i] ^= 0x5c;
 		}
+	}
+
+private:
+	HMACKey();
+
+	char _ipad[BLOCK_SIZE];
+	char _opad[BLOCK_SIZE];
+};
+
+
+template <class Engine>
+class HMACEngine: public DigestEngine
+	/// This class implementes the HMAC message
+	/// authentication code algorithm, as specified
+	/// in RFC 2104. The underlying DigestEngine
+	/// (MD5Engine, SHA1Engine, etc.) must be given as
+	/// template argument.
+	/// Since the HMACEngine is a DigestEngine, it can
+	/// be used with the DigestStream class to create
+	/// a HMAC for a stream.
+{
+public:
+	enum
+	{
+		BLOCK_SIZE  = Engine::BLOCK_SIZE,
+		DIGEST_SIZE = Engine::DIGEST_SIZE
+	};
+
+	HMACEngine(const std::string& passphrase):
+		_key(passphrase)
+	{
+		reset();
+	}
+
+	HMACEngine(const char* passphrase, std::size_t length):
+		_key(passphrase, length)
+	{
 		reset();
 	}
-	
+
+	HMACEngine(const HMACKey<Engine>& key):
+		_key(key)
+		/// Creates the HMACEngine from a precomputed HMACKey,
+		/// avoiding the per-instance key schedule setup.
+	{
+		reset();
+	}
+
+	~HMACEngine()
+	{
+	}
+
+	std::size_t digestLength() const
+	{
+		return DIGEST_SIZE;
+	}
+
+	void reset()
+	{
+		_engine.reset();
+		_engine.update(_key.ipad(), BLOCK_SIZE);
+	}
+
+	void reset(const HMACKey<Engine>& key)
+		/// Resets the engine for a new computation with the
+		/// given precomputed key.
+	{
+		_key = key;
+		reset();
+	}
+
+	const DigestEngine::Digest& digest()
+	{
+		const DigestEngine::Digest& d = _engine.digest();
+		char db[DIGEST_SIZE];
+		char* pdb = db;
+		for (DigestEngine::Digest::const_iterator it = d.begin(); it != d.end(); ++it)
+			*pdb++ = *it;
+		_engine.reset();
+		_engine.update(_key.opad(), BLOCK_SIZE);
+		_engine.update(db, DIGEST_SIZE);
+		const DigestEngine::Digest& result = _engine.digest();
+		reset();
+		return result;
+	}
+
+	static void hmac(const HMACKey<Engine>& key, const void* data, std::size_t length, char* mac)
+		/// Computes the HMAC of the given data with the given
+		/// precomputed key in a single call, writing DIGEST_SIZE
+		/// bytes to the buffer pointed to by mac.
+		///
+		/// All working state lives on the stack, making this the
+		/// cheapest way to authenticate a message with a key that
+		/// is used repeatedly.
+	{
+		Engine engine;
+		engine.update(key.ipad(), BLOCK_SIZE);
+		engine.update(data, length);
+		const DigestEngine::Digest& d = engine.digest();
+		char db[DIGEST_SIZE];
+		char* pdb = db;
+		for (DigestEngine::Digest::const_iterator it = d.begin(); it != d.end(); ++it)
+			*pdb++ = *it;
+		engine.reset();
+		engine.update(key.opad(), BLOCK_SIZE);
+		engine.update(db, DIGEST_SIZE);
+		const DigestEngine::Digest& result = engine.digest();
+		char* pmac = mac;
+		for (DigestEngine::Digest::const_iterator it = result.begin(); it != result.end(); ++it)
+			*pmac++ = *it;
+	}
+
+protected:
 	void updateImpl(const void* data, std::size_t length)
 	{
 		_engine.update(data, length);
@@ -134,9 +241,8 @@ private:
 	HMACEngine(const HMACEngine&);
 	HMACEngine& operator = (const HMACEngine&);
 
-	Engine _engine;
-	char*  _ipad;
-	char*  _opad;
+	Engine          _engine;
+	HMACKey<Engine> _key;
 };
 
 
@@ -34,6 +34,7 @@ std::size_t Foundation_API hash(UInt32 n);
 std::size_t Foundation_API hash(Int64 n);
 std::size_t Foundation_API hash(UInt64 n);
 std::size_t Foundation_API hash(const std::string& str);
+std::size_t Foundation_API hash(const char* str);
 
 
 template <class T>
@@ -48,6 +49,27 @@ struct Hash
 };
 
 
+template <>
+struct Hash<std::string>
+	/// A hash function for std::string, with support for
+	/// heterogeneous lookup: a C string can be hashed without
+	/// constructing a temporary std::string. Both overloads
+	/// produce the same hash for equal character sequences.
+{
+	std::size_t operator () (const std::string& value) const
+		/// Returns the hash for the given value.
+	{
+		return Poco::hash(value);
+	}
+
+	std::size_t operator () (const char* value) const
+		/// Returns the hash for the given value.
+	{
+		return Poco::hash(value);
+	}
+};
+
+
 //
 // inlines
 //
@@ -0,0 +1,83 @@
+//
+// HexBinaryCodec.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Definition of the HexBinaryCodec class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HexBinaryCodec_INCLUDED
+#define Foundation_HexBinaryCodec_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+
+
+namespace Poco {
+
+
+class Foundation_API HexBinaryCodec
+	/// This class provides buffer-to-buffer hexBinary encoding
+	/// and decoding.
+	///
+	/// In contrast to HexBinaryEncoder and HexBinaryDecoder, which
+	/// are stream based, the whole input is processed at once,
+	/// making this class the preferred interface when the data is
+	/// already in memory. The stream classes use it internally
+	/// for bulk writes and reads.
+	///
+	/// No line breaks are ever produced.
+{
+public:
+	static std::size_t encodedLength(std::size_t size);
+		/// Returns the number of characters encode() will produce
+		/// for size bytes of input.
+
+	static std::size_t encode(const void* data, std::size_t size, char* buffer, bool uppercase = false);
+		/// Encodes size bytes starting at data into buffer, which
+		/// must be at least encodedLength(size) characters large.
+		/// No line breaks are written.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const void* data, std::size_t size, bool uppercase = false);
+		/// Encodes size bytes starting at data and returns
+		/// the result as a string.
+
+	static std::size_t maxDecodedLength(std::size_t size);
+		/// Returns an upper bound for the number of bytes decode()
+		/// can produce for size characters of input.
+
+	static std::size_t decode(const char* data, std::size_t size, void* buffer);
+		/// Decodes size characters starting at data into buffer, which
+		/// must be at least maxDecodedLength(size) bytes large.
+		/// Whitespace (CR, LF, TAB, space) is ignored.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input contains
+		/// characters other than hexadecimal digits and whitespace,
+		/// or an odd number of hexadecimal digits.
+
+	static std::string decode(const std::string& hex);
+		/// Decodes the given hexBinary-encoded string and returns
+		/// the decoded bytes as a string.
+		///
+		/// Throws a DataFormatException if the input is not
+		/// valid hexBinary-encoded data.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HexBinaryCodec_INCLUDED
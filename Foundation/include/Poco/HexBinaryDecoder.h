@@ -43,7 +43,13 @@ class Foundation_API HexBinaryDecoderBuf: public UnbufferedStreamBuf
 public:
 	HexBinaryDecoderBuf(std::istream& istr);
 	~HexBinaryDecoderBuf();
-	
+
+protected:
+	std::streamsize xsgetn(char_type* p, std::streamsize count);
+		/// Bulk override: reads and decodes whole buffers directly
+		/// into the target buffer, so large reads do not pay a
+		/// virtual call per character.
+
 private:
 	int readFromDevice();
 	int readOne();
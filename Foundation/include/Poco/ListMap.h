@@ -21,10 +21,18 @@
 #include "Poco/Foundation.h"
 #include "Poco/String.h"
 #include "Poco/Exception.h"
+#include "Poco/Hash.h"
+#include "Poco/Ascii.h"
 #include <list>
+#include <unordered_map>
 #include <utility>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_LISTMAP_HAVE_RVALUE_REFS
+#endif
+
+
 namespace Poco {
 
 
@@ -32,11 +40,19 @@ template <class Key, class Mapped, class Container = std::list<std::pair<Key, Ma
 class ListMap
 	/// This class implements a multimap in terms of a sequential container.
 	/// The use for this type of associative container is wherever automatic
-	/// ordering of elements is not desirable. Naturally, this container will
-	/// have inferior data retrieval performance and it is not recommended for
-	/// use with large datasets. The main purpose within POCO is for Internet
-	/// messages (email message, http headers etc), to prevent automatic 
-	/// header entry reordering.
+	/// ordering of elements is not desirable. The main purpose within POCO
+	/// is for Internet messages (email message, http headers etc), to
+	/// prevent automatic header entry reordering.
+	///
+	/// Small maps are searched with a plain linear scan. Once the map grows
+	/// beyond a threshold, a secondary hash index from keys to entries is
+	/// maintained alongside the sequential container, so lookups stay O(1)
+	/// while iteration order and duplicate-key semantics are unchanged.
+	/// The index is only ever touched by mutating operations; concurrent
+	/// lookups on a const ListMap remain safe. It requires a container
+	/// that does not invalidate iterators on insertion or erasure (such
+	/// as std::list) and assumes that keys are not modified directly
+	/// through iterators.
 {
 public:
 	typedef Key                 KeyType;
@@ -51,17 +67,39 @@ public:
 	typedef typename Container::iterator       Iterator;
 	typedef typename Container::const_iterator ConstIterator;
 	
-	ListMap()
+	ListMap():
+		_indexValid(false)
 		/// Creates an empty ListMap.
 	{
 	}
-	
+
 	ListMap(std::size_t initialReserve):
-		_list(initialReserve)
+		_list(initialReserve),
+		_indexValid(false)
 		/// Creates the ListMap with room for initialReserve entries.
 	{
 	}
-	
+
+	ListMap(const ListMap& map):
+		_list(map._list),
+		_indexValid(false)
+		/// Creates a ListMap by copying another one.
+	{
+	}
+
+#if defined(POCO_LISTMAP_HAVE_RVALUE_REFS)
+	ListMap(ListMap&& map):
+		_list(std::move(map._list)),
+		_index(std::move(map._index)),
+		_indexValid(map._indexValid)
+		/// Creates a ListMap by moving the contents of another
+		/// one, leaving the other ListMap empty.
+	{
+		map._index.clear();
+		map._indexValid = false;
+	}
+#endif
+
 	ListMap& operator = (const ListMap& map)
 		/// Assigns another ListMap.
 	{
@@ -69,11 +107,27 @@ public:
 		swap(tmp);
 		return *this;
 	}
-	
+
+#if defined(POCO_LISTMAP_HAVE_RVALUE_REFS)
+	ListMap& operator = (ListMap&& map)
+		/// Moves the contents of another ListMap into this
+		/// one, leaving the other ListMap empty.
+	{
+		_list = std::move(map._list);
+		_index = std::move(map._index);
+		_indexValid = map._indexValid;
+		map._index.clear();
+		map._indexValid = false;
+		return *this;
+	}
+#endif
+
 	void swap(ListMap& map)
 		/// Swaps the ListMap with another one.
 	{
 		_list.swap(map._list);
+		_index.swap(map._index);
+		std::swap(_indexValid, map._indexValid);
 	}
 	
 	ConstIterator begin() const
@@ -106,6 +160,15 @@ public:
 		/// or iterator pointing to the end if entry is
 		/// not found.
 	{
+		if (_indexValid)
+		{
+			std::pair<typename KeyIndex::const_iterator, typename KeyIndex::const_iterator> range = _index.equal_range(hashOf(key));
+			for (; range.first != range.second; ++range.first)
+			{
+				if (isEqual(range.first->second->first, key)) return range.first->second;
+			}
+			return _list.end();
+		}
 		typename Container::const_iterator it = _list.begin();
 		typename Container::const_iterator itEnd = _list.end();
 		for(; it != itEnd; ++it)
@@ -121,6 +184,15 @@ public:
 		/// or iterator pointing to the end if entry is
 		/// not found.
 	{
+		if (_indexValid)
+		{
+			std::pair<typename KeyIndex::iterator, typename KeyIndex::iterator> range = _index.equal_range(hashOf(key));
+			for (; range.first != range.second; ++range.first)
+			{
+				if (isEqual(range.first->second->first, key)) return range.first->second;
+			}
+			return _list.end();
+		}
 		typename Container::iterator it = _list.begin();
 		typename Container::iterator itEnd = _list.end();
 		for(; it != itEnd; ++it)
@@ -131,22 +203,40 @@ public:
 	}
 
 	Iterator insert(const ValueType& val)
-		/// Inserts the value into the map. If one or more values 
-		/// already exist, new value is inserted at the end of the 
+		/// Inserts the value into the map. If one or more values
+		/// already exist, new value is inserted at the end of the
 		/// block. Thus, all the equal value entries are located
 		/// sequentially at all times.
-		/// Returns iterator pointing to the newly inserted value 
+		/// Returns iterator pointing to the newly inserted value
 	{
 		Iterator it = find(val.first);
+		bool newKey = (it == _list.end());
 		while (it != _list.end() && isEqual(it->first, val.first)) ++it;
-		return _list.insert(it, val);
+		Iterator itInsert = _list.insert(it, val);
+		indexInserted(itInsert, newKey);
+		return itInsert;
 	}
-	
+
+#if defined(POCO_LISTMAP_HAVE_RVALUE_REFS)
+	Iterator insert(ValueType&& val)
+		/// Inserts the value into the map by moving it into
+		/// place; otherwise behaves like the copying insert().
+	{
+		Iterator it = find(val.first);
+		bool newKey = (it == _list.end());
+		while (it != _list.end() && isEqual(it->first, val.first)) ++it;
+		Iterator itInsert = _list.insert(it, std::move(val));
+		indexInserted(itInsert, newKey);
+		return itInsert;
+	}
+#endif
+
 	void erase(Iterator it)
 	{
+		if (_indexValid) removeFromIndex(it);
 		_list.erase(it);
 	}
-	
+
 	SizeType erase(const KeyType& key)
 	{
 		SizeType count = 0;
@@ -157,6 +247,7 @@ public:
 			if (isEqual(it->first, key))
 			{
 				++count;
+				if (_indexValid) removeFromIndex(it);
 				it = _list.erase(it);
 				removed = true;
 			}
@@ -168,10 +259,12 @@ public:
 		}
 		return count;
 	}
-	
+
 	void clear()
 	{
 		_list.clear();
+		_index.clear();
+		_indexValid = false;
 	}
 
 	std::size_t size() const
@@ -207,6 +300,107 @@ public:
 	}
 
 private:
+	enum
+	{
+		INDEX_THRESHOLD = 16
+			/// Size beyond which the secondary hash index is built.
+			/// Smaller maps are searched linearly, which is cheaper
+			/// than maintaining the index.
+	};
+
+	typedef std::unordered_multimap<std::size_t, Iterator> KeyIndex;
+		/// Maps the hash of a key to the first entry of that key's
+		/// block of equal keys. Hash collisions are resolved by
+		/// comparing the keys of the mapped entries.
+
+	void indexInserted(Iterator it, bool newKey)
+		/// Updates the index after it has been inserted into the
+		/// list. Builds the index once the map outgrows the
+		/// threshold.
+	{
+		if (_indexValid)
+		{
+			if (newKey) _index.insert(typename KeyIndex::value_type(hashOf(it->first), it));
+		}
+		else if (_list.size() >= INDEX_THRESHOLD)
+		{
+			buildIndex();
+		}
+	}
+
+	void buildIndex()
+	{
+		_index.clear();
+		Iterator it = _list.begin();
+		Iterator itEnd = _list.end();
+		Iterator itPrev = itEnd;
+		for (; it != itEnd; ++it)
+		{
+			if (itPrev == itEnd || !isEqual(itPrev->first, it->first))
+				_index.insert(typename KeyIndex::value_type(hashOf(it->first), it));
+			itPrev = it;
+		}
+		_indexValid = true;
+	}
+
+	void removeFromIndex(Iterator it)
+		/// Removes the given entry from the index before it is
+		/// erased from the list. If the entry heads a block of
+		/// equal keys, the index is repointed to the next entry
+		/// of the block.
+	{
+		std::pair<typename KeyIndex::iterator, typename KeyIndex::iterator> range = _index.equal_range(hashOf(it->first));
+		for (; range.first != range.second; ++range.first)
+		{
+			if (range.first->second == it)
+			{
+				Iterator itNext = it;
+				++itNext;
+				if (itNext != _list.end() && isEqual(itNext->first, it->first))
+					range.first->second = itNext;
+				else
+					_index.erase(range.first);
+				return;
+			}
+		}
+	}
+
+	std::size_t hashOf(const std::string& key) const
+		/// Returns the hash of the given key, case-folded like
+		/// icompare() when the map is case-insensitive, so that
+		/// keys comparing equal hash equally.
+	{
+		if (CaseSensitive) return Poco::hash(key);
+		std::size_t h = 0;
+		std::string::const_iterator it = key.begin();
+		std::string::const_iterator itEnd = key.end();
+		while (it != itEnd)
+		{
+			h = h * 0xf4243 ^ static_cast<std::size_t>(Ascii::toLower(*it++));
+		}
+		return h;
+	}
+
+	std::size_t hashOf(const char* key) const
+		/// Returns the hash of the given key, case-folded like
+		/// icompare() when the map is case-insensitive, so that
+		/// keys comparing equal hash equally.
+	{
+		if (CaseSensitive) return Poco::hash(key);
+		std::size_t h = 0;
+		while (*key)
+		{
+			h = h * 0xf4243 ^ static_cast<std::size_t>(Ascii::toLower(*key++));
+		}
+		return h;
+	}
+
+	template <typename T>
+	std::size_t hashOf(const T& key) const
+	{
+		return Poco::Hash<T>()(key);
+	}
+
 	template <typename T1, typename T2>
 	bool isEqual(T1 val1, T2 val2) const
 	{
@@ -237,6 +431,8 @@ private:
 	}
 
 	Container _list;
+	KeyIndex  _index;
+	bool      _indexValid;
 };
 
 
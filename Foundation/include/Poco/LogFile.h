@@ -49,6 +49,13 @@ public:
 		/// If flush is true, the text will be immediately
 		/// flushed to the file.
 
+	void writeRaw(const std::string& text, bool flush = true);
+		/// Writes the given text to the log file as-is, without
+		/// appending a newline. Used by FileChannel to write a
+		/// batch of pre-formatted log records in one operation.
+		/// If flush is true, the text will be immediately
+		/// flushed to the file.
+
 	UInt64 size() const;
 		/// Returns the current size in bytes of the log file.
 
@@ -69,6 +76,12 @@ inline void LogFile::write(const std::string& text, bool flush)
 }
 
 
+inline void LogFile::writeRaw(const std::string& text, bool flush)
+{
+	writeRawImpl(text, flush);
+}
+
+
 inline UInt64 LogFile::size() const
 {
 	return sizeImpl();
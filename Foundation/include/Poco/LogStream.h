@@ -20,14 +20,14 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/Logger.h"
-#include "Poco/UnbufferedStreamBuf.h"
+#include "Poco/BufferedStreamBuf.h"
 #include <istream>
 
 
 namespace Poco {
 
 
-class Foundation_API LogStreamBuf: public UnbufferedStreamBuf
+class Foundation_API LogStreamBuf: public BufferedStreamBuf
 	/// This class implements a streambuf interface
 	/// to a Logger.
 	///
@@ -35,6 +35,11 @@ class Foundation_API LogStreamBuf: public UnbufferedStreamBuf
 	/// to a string. As soon as a CR or LF (std::endl) is written,
 	/// the string is sent to the Logger, with the set
 	/// priority.
+	///
+	/// Characters are collected in an internal buffer and
+	/// scanned for line ends in blocks when the buffer is
+	/// flushed, so inserting values one by one does not incur
+	/// a virtual call per character.
 {
 public:
 	LogStreamBuf(Logger& logger, Message::Priority priority);
@@ -52,8 +57,13 @@ public:
 	Logger& logger() const;
 		/// Returns a reference to the Logger.
 
-private:
-	int writeToDevice(char c);
+protected:
+	enum
+	{
+		STREAM_BUFFER_SIZE = 1024
+	};
+
+	int writeToDevice(const char* buffer, std::streamsize length);
 
 private:
 	Logger&           _logger;
@@ -22,6 +22,7 @@
 #include "Poco/Channel.h"
 #include "Poco/Message.h"
 #include "Poco/Format.h"
+#include "Poco/AtomicCounter.h"
 #include <map>
 #include <vector>
 #include <cstddef>
@@ -427,6 +428,19 @@ public:
 		/// If the Logger does not yet exist, it is created, based
 		/// on its parent logger.
 
+	static Logger& fastGet(const std::string& name);
+		/// Returns a reference to the Logger with the given name,
+		/// like get(), but caches the result in a thread-local map,
+		/// so that repeated lookups of the same logger do not take
+		/// the global registry mutex.
+		///
+		/// destroy() and shutdown() invalidate the caches of all
+		/// threads by incrementing a global epoch counter; the next
+		/// lookup in each thread then refetches its loggers from
+		/// the registry. Level and channel changes do not require
+		/// invalidation, since they are made on the shared logger
+		/// instances themselves.
+
 	static Logger& unsafeGet(const std::string& name);
 		/// Returns a reference to the Logger with the given name.
 		/// If the Logger does not yet exist, it is created, based
@@ -505,7 +519,7 @@ private:
 	
 	std::string _name;
 	Channel*    _pChannel;
-	int         _level;
+	AtomicCounter _level;
 
 	static LoggerMap* _pLoggerMap;
 	static Mutex      _mapMtx;
@@ -0,0 +1,187 @@
+//
+// MPMCQueue.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  MPMCQueue
+//
+// Definition of the MPMCQueue class template.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_MPMCQueue_INCLUDED
+#define Foundation_MPMCQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Bugcheck.h"
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class T>
+class MPMCQueue
+	/// A bounded lock-free multi-producer/multi-consumer FIFO queue,
+	/// based on D. Vyukov's bounded MPMC queue algorithm.
+	///
+	/// Elements are stored by value; T must be default-constructible
+	/// and cheap to copy (e.g., a pointer or a small POD).
+	///
+	/// push() and pop() never block and never allocate; they fail
+	/// (returning false) if the queue is full or empty, respectively.
+	/// Any waiting or back-off strategy is up to the caller.
+{
+public:
+	explicit MPMCQueue(std::size_t size):
+		_cells(roundUpToPowerOfTwo(size)),
+		_mask(_cells.size() - 1),
+		_pushPos(0),
+		_popPos(0)
+	{
+		poco_assert (size >= 2);
+		for (std::size_t i = 0; i < _cells.size(); i++)
+		{
+			_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+		/// Creates the MPMCQueue with room for at least size
+		/// elements. The actual capacity is size rounded up to
+		/// the next power of two.
+
+	~MPMCQueue()
+	{
+	}
+		/// Destroys the MPMCQueue. Any elements still in the
+		/// queue are destroyed with it.
+
+	bool push(const T& element)
+		/// Appends the element to the queue.
+		/// Returns true if successful, or false if the queue is full.
+	{
+		Cell* pCell;
+		std::size_t pos = _pushPos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & _mask];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0)
+			{
+				if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = _pushPos.load(std::memory_order_relaxed);
+			}
+		}
+		pCell->element = element;
+		pCell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& element)
+		/// Removes the first element from the queue and assigns
+		/// it to element.
+		/// Returns true if successful, or false if the queue is empty.
+	{
+		Cell* pCell;
+		std::size_t pos = _popPos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & _mask];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = _popPos.load(std::memory_order_relaxed);
+			}
+		}
+		element = pCell->element;
+		pCell->element = T();
+		pCell->sequence.store(pos + _mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const
+		/// Returns true iff the queue appears to be empty.
+		/// The result is inherently a snapshot in the presence
+		/// of concurrent producers and consumers.
+	{
+		return _pushPos.load(std::memory_order_acquire) == _popPos.load(std::memory_order_acquire);
+	}
+
+	std::size_t size() const
+		/// Returns the approximate number of elements in the queue.
+		/// The result is inherently a snapshot in the presence
+		/// of concurrent producers and consumers.
+	{
+		std::size_t pushPos = _pushPos.load(std::memory_order_acquire);
+		std::size_t popPos  = _popPos.load(std::memory_order_acquire);
+		return pushPos > popPos ? pushPos - popPos : 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the maximum number of elements the queue can hold.
+	{
+		return _cells.size();
+	}
+
+private:
+	struct Cell
+	{
+		Cell(): sequence(0), element()
+		{
+		}
+
+		Cell(const Cell& cell): sequence(cell.sequence.load(std::memory_order_relaxed)), element(cell.element)
+		{
+		}
+
+		std::atomic<std::size_t> sequence;
+		T element;
+	};
+
+	static std::size_t roundUpToPowerOfTwo(std::size_t size)
+	{
+		std::size_t capacity = 2;
+		while (capacity < size) capacity <<= 1;
+		return capacity;
+	}
+
+	MPMCQueue(const MPMCQueue&);
+	MPMCQueue& operator = (const MPMCQueue&);
+
+	std::vector<Cell> _cells;
+	const std::size_t _mask;
+	std::atomic<std::size_t> _pushPos;
+	std::atomic<std::size_t> _popPos;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_MPMCQueue_INCLUDED
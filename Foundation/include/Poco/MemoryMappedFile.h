@@ -0,0 +1,119 @@
+//
+// MemoryMappedFile.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  MemoryMappedFile
+//
+// Definition of the MemoryMappedFile and MemoryMappedInputStream classes.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_MemoryMappedFile_INCLUDED
+#define Foundation_MemoryMappedFile_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/MemoryStream.h"
+
+
+namespace Poco {
+
+
+class Foundation_API MemoryMappedFile
+	/// A read-only memory mapping of an entire file.
+	///
+	/// The file contents can be accessed directly via begin() and
+	/// end(), without copying them through read() calls and stream
+	/// buffers. Use a MemoryMappedInputStream (or a MemoryInputStream
+	/// over begin() and size()) to parse the mapped data through the
+	/// usual stream interface.
+	///
+	/// On POSIX platforms, advise() can be used to announce the
+	/// intended access pattern for the mapping to the operating
+	/// system (using madvise()).
+{
+public:
+	enum Advice
+		/// Access pattern hints for advise().
+	{
+		ADV_NORMAL,     /// no special access pattern (resets a previously given hint)
+		ADV_SEQUENTIAL, /// the mapping will be accessed sequentially
+		ADV_RANDOM,     /// the mapping will be accessed in random order
+		ADV_WILLNEED,   /// the mapping will be needed soon
+		ADV_DONTNEED    /// the mapping will not be needed again; drop it from memory
+	};
+
+	MemoryMappedFile(const std::string& path);
+		/// Maps the entire file given by path read-only into memory.
+		///
+		/// Throws a FileException (or a similar exception) if the
+		/// file does not exist or cannot be mapped.
+
+	~MemoryMappedFile();
+		/// Destroys the MemoryMappedFile and removes the mapping.
+
+	const char* begin() const;
+		/// Returns the start address of the mapped file contents.
+		/// Will be NULL if the file is empty.
+
+	const char* end() const;
+		/// Returns the one-past-end address of the mapped file
+		/// contents. Will be NULL if the file is empty.
+
+	std::size_t size() const;
+		/// Returns the size of the mapped file in bytes.
+
+	void advise(Advice advice);
+		/// Announces the intended access pattern for the mapping
+		/// to the operating system, using madvise().
+		///
+		/// The hints are advisory only and are ignored on platforms
+		/// that do not support them.
+
+private:
+	MemoryMappedFile();
+	MemoryMappedFile(const MemoryMappedFile&);
+	MemoryMappedFile& operator = (const MemoryMappedFile&);
+
+	SharedMemory _memory;
+	std::size_t  _size;
+};
+
+
+class Foundation_API MemoryMappedInputStream: public MemoryMappedFile, public MemoryInputStream
+	/// An input stream reading directly from a read-only memory
+	/// mapping of a file.
+	///
+	/// Unlike a FileInputStream, the file contents are not copied
+	/// into an internal buffer; the stream reads straight from the
+	/// mapped pages.
+{
+public:
+	MemoryMappedInputStream(const std::string& path);
+		/// Creates the MemoryMappedInputStream for the file given by path.
+
+	~MemoryMappedInputStream();
+		/// Destroys the MemoryMappedInputStream.
+};
+
+
+//
+// inlines
+//
+inline std::size_t MemoryMappedFile::size() const
+{
+	return _size;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_MemoryMappedFile_INCLUDED
@@ -39,6 +39,15 @@ class Foundation_API MemoryPool
 	/// All allocated blocks are retained for future use.
 	/// A limit on the number of blocks can be specified.
 	/// Blocks can be preallocated.
+	///
+	/// If no limit on the number of blocks is specified
+	/// (maxAlloc == 0), each thread caches a small magazine
+	/// of blocks, refilled from (and flushed to) the shared
+	/// free list in batches. Steady-state get()/release()
+	/// then completes without locking, so threads do not
+	/// serialize on the pool's mutex. With a block limit,
+	/// the strict shared free list is used, so the limit
+	/// is enforced exactly.
 {
 public:
 	MemoryPool(std::size_t blockSize, int preAlloc = 0, int maxAlloc = 0);
@@ -59,35 +68,107 @@ public:
 	
 	std::size_t blockSize() const;
 		/// Returns the block size.
-		
+
 	int allocated() const;
 		/// Returns the number of allocated blocks.
-		
+
 	int available() const;
-		/// Returns the number of available blocks in the pool.
+		/// Returns the number of available blocks in the
+		/// pool's shared free list, not counting blocks
+		/// cached in per-thread magazines.
 
 private:
 	MemoryPool();
 	MemoryPool(const MemoryPool&);
 	MemoryPool& operator = (const MemoryPool&);
-	
+
 	void clear();
-	
+
 	enum
 	{
-		BLOCK_RESERVE = 128
+		BLOCK_RESERVE = 128,
+		MAGAZINE_CAPACITY = 32
 	};
-	
+
+	struct Magazine;
+	struct MagazineHolder;
+
+	Magazine* currentMagazine();
+		/// Returns the calling thread's magazine for this pool,
+		/// creating and registering it on first use.
+
+	void refillMagazine(Magazine* pMagazine);
+		/// Moves a batch of blocks from the shared free list
+		/// into the magazine, allocating a fresh block if the
+		/// free list is empty.
+
+	void flushMagazine(Magazine* pMagazine);
+		/// Returns half of the magazine's blocks to the
+		/// shared free list.
+
+	void retireMagazine(Magazine* pMagazine);
+		/// Returns all of the magazine's blocks to the shared
+		/// free list and unregisters it. Called on thread exit.
+
 	typedef std::vector<char*> BlockVec;
-	
+	typedef std::vector<Magazine*> MagazineVec;
+
 	std::size_t _blockSize;
 	int         _maxAlloc;
 	int         _allocated;
 	BlockVec    _blocks;
+	MagazineVec _magazines;
 	FastMutex   _mutex;
 };
 
 
+template <class C>
+class PooledObject
+	/// A mixin class template that allocates instances of
+	/// class C from a shared MemoryPool instead of the
+	/// global heap:
+	///
+	///     class MyObject: public Poco::PooledObject<MyObject>
+	///     {
+	///         ...
+	///     };
+	///
+	/// This is useful for small objects that are allocated
+	/// and freed at a high rate, such as the per-invocation
+	/// helper objects of ActiveMethod.
+	///
+	/// The pool grows on demand and retains all blocks until
+	/// the process exits. Classes derived from C fall back to
+	/// the global heap, since their size may differ from the
+	/// pool's block size.
+{
+public:
+	void* operator new(std::size_t size)
+	{
+		if (size != sizeof(C))
+			return ::operator new(size);
+		else
+			return pool().get();
+	}
+
+	void operator delete(void* ptr, std::size_t size)
+	{
+		if (!ptr) return;
+		if (size != sizeof(C))
+			::operator delete(ptr);
+		else
+			pool().release(ptr);
+	}
+
+private:
+	static MemoryPool& pool()
+	{
+		static MemoryPool memoryPool(sizeof(C));
+		return memoryPool;
+	}
+};
+
+
 //
 // inlines
 //
@@ -23,6 +23,11 @@
 #include <map>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_MESSAGE_HAVE_RVALUE_REFS
+#endif
+
+
 namespace Poco {
 
 
@@ -81,24 +86,52 @@ public:
 	Message(const Message& msg, const std::string& text);
 		/// Creates a Message by copying all but the text from another message.
 		
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+	Message(std::string&& source, std::string&& text, Priority prio);
+		/// Creates a Message with the given source, text and priority,
+		/// taking ownership of the source and text strings.
+		/// The thread and process ids are set.
+
+	Message(Message&& msg);
+		/// Creates a Message by moving the state of another one,
+		/// leaving the other message empty.
+#endif
+
 	~Message();
 		/// Destroys the Message.
 	
 	Message& operator = (const Message& msg);
 		/// Assignment operator.
 		
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+	Message& operator = (Message&& msg);
+		/// Move assignment operator.
+#endif
+
 	void swap(Message& msg);
 		/// Swaps the message with another one.	
 		
 	void setSource(const std::string& src);
 		/// Sets the source of the message.
 		
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+	void setSource(std::string&& src);
+		/// Sets the source of the message, taking
+		/// ownership of the given string.
+#endif
+
 	const std::string& getSource() const;
 		/// Returns the source of the message.
 		
 	void setText(const std::string& text);
 		/// Sets the text of the message.
 		
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+	void setText(std::string&& text);
+		/// Sets the text of the message, taking
+		/// ownership of the given string.
+#endif
+
 	const std::string& getText() const;
 		/// Returns the text of the message.
 		
@@ -117,6 +150,12 @@ public:
 	void setThread(const std::string& thread);
 		/// Sets the thread identifier for the message.
 		
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+	void setThread(std::string&& thread);
+		/// Sets the thread identifier for the message, taking
+		/// ownership of the given string.
+#endif
+
 	const std::string& getThread() const;
 		/// Returns the thread identifier for the message.
 
@@ -184,9 +223,15 @@ public:
 		/// If the parameter does not exist, it is created with an
 		/// empty string value.
 
+	typedef std::map<std::string, std::string> StringMap;
+
+	const StringMap& getParameters() const;
+		/// Returns a map containing all named parameters of
+		/// the message. If the message has no parameters,
+		/// an empty map is returned.
+
 protected:
 	void init();
-	typedef std::map<std::string, std::string> StringMap;
 
 private:	
 	std::string _source;
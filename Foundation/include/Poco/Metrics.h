@@ -0,0 +1,272 @@
+//
+// Metrics.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  Metrics
+//
+// Definition of the Metrics classes.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Metrics_INCLUDED
+#define Foundation_Metrics_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <string>
+
+
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_METRICS_HAVE_ATOMICS
+	#include <atomic>
+#endif
+
+
+namespace Poco {
+namespace Metrics {
+
+
+class Foundation_API Counter
+	/// A monotonically increasing counter.
+	///
+	/// The counter value is sharded over several cache-line
+	/// padded slots, with every thread incrementing its own
+	/// slot, so that heavily incremented counters do not cause
+	/// cache-line contention between threads. Reading the value
+	/// sums all slots and is therefore more expensive than
+	/// incrementing; counters are meant to be incremented on hot
+	/// paths and read by a scraper.
+{
+public:
+	enum
+	{
+		SHARD_COUNT     = 16,
+		CACHE_LINE_SIZE = 64
+	};
+
+	Counter();
+		/// Creates the Counter with value zero.
+
+	~Counter();
+		/// Destroys the Counter.
+
+	void increment();
+		/// Increments the counter by one.
+
+	void increment(Int64 n);
+		/// Increments the counter by the given value.
+
+	Int64 value() const;
+		/// Returns the current value of the counter.
+
+private:
+	Counter(const Counter&);
+	Counter& operator = (const Counter&);
+
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	struct Shard
+	{
+		std::atomic<Int64> value;
+		char pad[CACHE_LINE_SIZE - sizeof(std::atomic<Int64>)];
+	};
+
+	Shard _shards[SHARD_COUNT];
+#else
+	mutable FastMutex _mutex;
+	Int64 _value;
+#endif
+};
+
+
+class Foundation_API Gauge
+	/// A gauge holds a single value that can be set, incremented
+	/// and decremented, e.g. a queue depth or a number of active
+	/// connections.
+{
+public:
+	Gauge();
+		/// Creates the Gauge with value zero.
+
+	~Gauge();
+		/// Destroys the Gauge.
+
+	void set(Int64 value);
+		/// Sets the gauge to the given value.
+
+	void add(Int64 n);
+		/// Adds the given value to the gauge.
+
+	void subtract(Int64 n);
+		/// Subtracts the given value from the gauge.
+
+	Int64 value() const;
+		/// Returns the current value of the gauge.
+
+private:
+	Gauge(const Gauge&);
+	Gauge& operator = (const Gauge&);
+
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	std::atomic<Int64> _value;
+#else
+	mutable FastMutex _mutex;
+	Int64 _value;
+#endif
+};
+
+
+class Foundation_API Histogram
+	/// A histogram of non-negative integer values (e.g.
+	/// latencies in microseconds) with logarithmically scaled
+	/// buckets: every bucket covers one binary order of
+	/// magnitude, so the histogram covers the full Int64 range
+	/// with 64 buckets while keeping the relative quantile
+	/// estimation error bounded.
+{
+public:
+	enum
+	{
+		BUCKET_COUNT = 64
+	};
+
+	Histogram();
+		/// Creates an empty Histogram.
+
+	~Histogram();
+		/// Destroys the Histogram.
+
+	void update(Int64 value);
+		/// Adds the given value to the histogram.
+		/// Negative values are counted as zero.
+
+	Int64 count() const;
+		/// Returns the number of recorded values.
+
+	Int64 sum() const;
+		/// Returns the sum of all recorded values.
+
+	Int64 minimum() const;
+		/// Returns the smallest recorded value,
+		/// or zero if the histogram is empty.
+
+	Int64 maximum() const;
+		/// Returns the largest recorded value,
+		/// or zero if the histogram is empty.
+
+	Int64 quantile(double q) const;
+		/// Returns an estimate of the given quantile (0 .. 1),
+		/// e.g. quantile(0.99) returns the estimated 99th
+		/// percentile. The estimate is the upper bound of the
+		/// bucket containing the quantile.
+
+private:
+	Histogram(const Histogram&);
+	Histogram& operator = (const Histogram&);
+
+	static int bucketOf(Int64 value);
+
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	std::atomic<Int64> _buckets[BUCKET_COUNT];
+	std::atomic<Int64> _count;
+	std::atomic<Int64> _sum;
+	std::atomic<Int64> _min;
+	std::atomic<Int64> _max;
+#else
+	mutable FastMutex _mutex;
+	Int64 _buckets[BUCKET_COUNT];
+	Int64 _count;
+	Int64 _sum;
+	Int64 _min;
+	Int64 _max;
+#endif
+};
+
+
+class Foundation_API MetricsRegistry
+	/// A registry holding named counters, gauges and histograms.
+	///
+	/// Metrics are created on first access and owned by the
+	/// registry. The whole registry can be exported as a JSON
+	/// document, from which a scraper (e.g. an HTTP handler or
+	/// a periodic task) can serve or ship the values.
+	///
+	/// Built-in instrumentation in ThreadPool, NotificationQueue,
+	/// TCPServer and SessionPool records into the default registry
+	/// and is disabled unless setEnabled(true) is called, so
+	/// applications not interested in metrics pay at most the cost
+	/// of a flag check.
+{
+public:
+	MetricsRegistry();
+		/// Creates an empty MetricsRegistry.
+
+	~MetricsRegistry();
+		/// Destroys the MetricsRegistry and all metrics owned by it.
+
+	Counter& counter(const std::string& name);
+		/// Returns the counter with the given name, creating it
+		/// if it does not yet exist. The returned reference
+		/// remains valid for the lifetime of the registry.
+
+	Gauge& gauge(const std::string& name);
+		/// Returns the gauge with the given name, creating it
+		/// if it does not yet exist. The returned reference
+		/// remains valid for the lifetime of the registry.
+
+	Histogram& histogram(const std::string& name);
+		/// Returns the histogram with the given name, creating it
+		/// if it does not yet exist. The returned reference
+		/// remains valid for the lifetime of the registry.
+
+	std::string toJSON() const;
+		/// Returns all metrics as a JSON document of the form:
+		///
+		///     {
+		///       "counters": {"name": 42, ...},
+		///       "gauges": {"name": 7, ...},
+		///       "histograms": {
+		///         "name": {"count": 10, "sum": 123, "min": 1,
+		///                  "max": 50, "p50": 15, "p90": 31,
+		///                  "p99": 63},
+		///         ...
+		///       }
+		///     }
+
+	static MetricsRegistry& defaultRegistry();
+		/// Returns a reference to the default registry, into
+		/// which the built-in instrumentation records.
+
+	static bool enabled();
+		/// Returns true if the built-in instrumentation is enabled.
+
+	static void setEnabled(bool enabled);
+		/// Enables or disables the built-in instrumentation.
+		/// Instrumentation is disabled by default.
+
+private:
+	MetricsRegistry(const MetricsRegistry&);
+	MetricsRegistry& operator = (const MetricsRegistry&);
+
+	typedef std::map<std::string, Counter*> CounterMap;
+	typedef std::map<std::string, Gauge*> GaugeMap;
+	typedef std::map<std::string, Histogram*> HistogramMap;
+
+	CounterMap _counters;
+	GaugeMap _gauges;
+	HistogramMap _histograms;
+	mutable Mutex _mutex;
+};
+
+
+} } // namespace Poco::Metrics
+
+
+#endif // Foundation_Metrics_INCLUDED
@@ -22,6 +22,7 @@
 #include "Poco/Notification.h"
 #include "Poco/Mutex.h"
 #include "Poco/SharedPtr.h"
+#include <atomic>
 #include <vector>
 #include <cstddef>
 
@@ -50,9 +51,14 @@ class Foundation_API NotificationCenter
 	/// If an observer throws an exception while handling a notification, the NotificationCenter
 	/// stops dispatching the notification and postNotification() rethrows the exception.
 	///
-	/// In a multithreaded scenario, notifications are always delivered in the thread in which the 
+	/// In a multithreaded scenario, notifications are always delivered in the thread in which the
 	/// notification was posted, which may not be the same thread in which an observer registered itself.
 	///
+	/// Posting a notification does not acquire a lock and does not copy the observer list;
+	/// posting threads read an immutable snapshot of the observer list, which is
+	/// republished by addObserver() and removeObserver(). Notification posting from
+	/// multiple threads therefore scales independently of the posting rate.
+	///
 	/// The NotificationCenter class is basically a C++ implementation of the NSNotificationCenter class
 	/// found in Apple's Cocoa (or OpenStep).
 	///
@@ -95,6 +101,10 @@ public:
 
 	void removeObserver(const AbstractObserver& observer);
 		/// Unregisters an observer with the NotificationCenter.
+		///
+		/// Unless called from within a notification handler,
+		/// removeObserver() does not return while the observer
+		/// is being notified by another thread.
 
 	bool hasObserver(const AbstractObserver& observer) const;
 		/// Returns true if the observer is registered with this NotificationCenter.
@@ -128,7 +138,30 @@ private:
 	typedef SharedPtr<AbstractObserver> AbstractObserverPtr;
 	typedef std::vector<AbstractObserverPtr> ObserverList;
 
+	struct ObserverSnapshot
+		/// An immutable copy of the observer list. The current
+		/// snapshot is published through _pSnapshot and read
+		/// without locking by posting threads; addObserver()
+		/// and removeObserver() publish a new snapshot and
+		/// reclaim the old one after a grace period.
+	{
+		ObserverList observers;
+	};
+
+	void publishObservers();
+		/// Publishes a new snapshot of _observers and deletes
+		/// the previous one once no reader can see it anymore.
+		/// Must be called with _mutex held.
+
+	void synchronize();
+		/// Waits until all readers that may still see a
+		/// previously published snapshot have finished.
+
 	ObserverList  _observers;
+	std::atomic<ObserverSnapshot*> _pSnapshot;
+	std::vector<ObserverSnapshot*> _retiredSnapshots;
+	std::atomic<unsigned> _epoch;
+	mutable std::atomic<int> _readers[2];
 	mutable Mutex _mutex;
 };
 
@@ -23,11 +23,20 @@
 #include "Poco/Mutex.h"
 #include "Poco/Event.h"
 #include <deque>
+#include <vector>
 
 
 namespace Poco {
 
 
+namespace Metrics {
+
+class Gauge;
+class Histogram;
+
+}
+
+
 class NotificationCenter;
 
 
@@ -107,6 +116,30 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
+	int dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications under a single
+		/// lock acquisition and appends them to the given vector.
+		/// Returns the number of notifications dequeued.
+		///
+		/// Draining multiple notifications per call considerably reduces
+		/// locking overhead for high-volume consumers.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if wakeUpAll() has been called by another thread.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if no notification became available in time.
+
 	void dispatch(NotificationCenter& notificationCenter);
 		/// Dispatches all queued notifications to the given
 		/// notification center.
@@ -117,6 +150,16 @@ public:
 	bool empty() const;
 		/// Returns true iff the queue is empty.
 		
+	void enableMetrics(const std::string& name);
+		/// Enables metrics reporting for this queue into the
+		/// default MetricsRegistry (provided the registry's
+		/// built-in instrumentation is enabled):
+		///
+		///   * <name>.depth: a gauge tracking the queue depth.
+		///   * <name>.waitTime: a histogram of the time, in
+		///     microseconds, dequeueing threads spend blocked
+		///     waiting for a notification.
+
 	int size() const;
 		/// Returns the number of notifications in the queue.
 
@@ -143,9 +186,14 @@ private:
 	};
 	typedef std::deque<WaitInfo*> WaitQueue;
 
-	NfQueue           _nfQueue;
-	WaitQueue         _waitQueue;
-	mutable FastMutex _mutex;
+	void updateDepth();
+		/// Updates the depth gauge. The caller must hold the mutex.
+
+	NfQueue            _nfQueue;
+	WaitQueue          _waitQueue;
+	Metrics::Gauge*    _pDepthGauge;
+	Metrics::Histogram* _pWaitHistogram;
+	mutable FastMutex  _mutex;
 };
 
 
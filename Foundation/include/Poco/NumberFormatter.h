@@ -20,6 +20,7 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/NumericString.h"
+#include <cstring>
 
 
 namespace Poco {
@@ -504,6 +505,67 @@ public:
 		/// sixteen (64-bit architectures) characters wide
 		/// field in hexadecimal notation.
 
+	static std::size_t formatTo(char* buffer, std::size_t size, int value);
+		/// Formats an integer value in decimal notation into the
+		/// given buffer of the given size and appends a terminating
+		/// zero. Returns the number of characters written, not
+		/// counting the terminating zero.
+		///
+		/// Unlike format(), no std::string is allocated; buffers of
+		/// NF_MAX_INT_STRING_LEN characters are always large enough.
+		/// Throws a RangeException if the buffer is too small.
+
+	static std::size_t formatTo(char* buffer, std::size_t size, unsigned value);
+		/// Formats an unsigned int value in decimal notation into the
+		/// given buffer. See formatTo(char*, std::size_t, int).
+
+	static std::size_t formatTo(char* buffer, std::size_t size, long value);
+		/// Formats a long value in decimal notation into the
+		/// given buffer. See formatTo(char*, std::size_t, int).
+
+	static std::size_t formatTo(char* buffer, std::size_t size, unsigned long value);
+		/// Formats an unsigned long value in decimal notation into the
+		/// given buffer. See formatTo(char*, std::size_t, int).
+
+#ifdef POCO_HAVE_INT64
+
+#ifdef POCO_LONG_IS_64_BIT
+
+	static std::size_t formatTo(char* buffer, std::size_t size, long long value);
+		/// Formats a 64-bit integer value in decimal notation into the
+		/// given buffer. See formatTo(char*, std::size_t, int).
+
+	static std::size_t formatTo(char* buffer, std::size_t size, unsigned long long value);
+		/// Formats an unsigned 64-bit integer value in decimal notation
+		/// into the given buffer. See formatTo(char*, std::size_t, int).
+
+#else // ifndef POCO_LONG_IS_64_BIT
+
+	static std::size_t formatTo(char* buffer, std::size_t size, Int64 value);
+		/// Formats a 64-bit integer value in decimal notation into the
+		/// given buffer. See formatTo(char*, std::size_t, int).
+
+	static std::size_t formatTo(char* buffer, std::size_t size, UInt64 value);
+		/// Formats an unsigned 64-bit integer value in decimal notation
+		/// into the given buffer. See formatTo(char*, std::size_t, int).
+
+#endif // ifdef POCO_LONG_IS_64_BIT
+
+#endif // ifdef POCO_HAVE_INT64
+
+	static std::size_t formatTo(char* buffer, std::size_t size, float value);
+		/// Formats a float value in decimal floating-point notation
+		/// into the given buffer, computing the shortest string of
+		/// digits that correctly represents the value, and appends a
+		/// terminating zero. Returns the number of characters written.
+		///
+		/// Buffers of NF_MAX_FLT_STRING_LEN characters are always
+		/// large enough.
+
+	static std::size_t formatTo(char* buffer, std::size_t size, double value);
+		/// Formats a double value in decimal floating-point notation
+		/// into the given buffer. See formatTo(char*, std::size_t, float).
+
 private:
 };
 
@@ -901,6 +963,97 @@ inline std::string NumberFormatter::format(const void* ptr)
 }
 
 
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, int value)
+{
+	std::size_t sz = size;
+	intToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, unsigned value)
+{
+	std::size_t sz = size;
+	uIntToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, long value)
+{
+	std::size_t sz = size;
+	intToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, unsigned long value)
+{
+	std::size_t sz = size;
+	uIntToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+#ifdef POCO_HAVE_INT64
+
+#ifdef POCO_LONG_IS_64_BIT
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, long long value)
+{
+	std::size_t sz = size;
+	intToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, unsigned long long value)
+{
+	std::size_t sz = size;
+	uIntToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+#else // ifndef POCO_LONG_IS_64_BIT
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, Int64 value)
+{
+	std::size_t sz = size;
+	intToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, UInt64 value)
+{
+	std::size_t sz = size;
+	uIntToStr(value, 10, buffer, sz);
+	return sz;
+}
+
+
+#endif // ifdef POCO_LONG_IS_64_BIT
+
+#endif // ifdef POCO_HAVE_INT64
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, float value)
+{
+	floatToStr(buffer, static_cast<int>(size), value);
+	return std::strlen(buffer);
+}
+
+
+inline std::size_t NumberFormatter::formatTo(char* buffer, std::size_t size, double value)
+{
+	doubleToStr(buffer, static_cast<int>(size), value);
+	return std::strlen(buffer);
+}
+
+
 } // namespace Poco
 
 
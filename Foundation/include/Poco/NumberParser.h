@@ -117,6 +117,45 @@ public:
 		/// Returns true if a valid integer has been found, false otherwise. 
 		/// If parsing was not successful, value is undefined.
 
+#endif // defined(POCO_HAVE_INT64)
+
+	static bool tryParse(const char* s, std::size_t length, int& value);
+		/// Parses an integer value in decimal notation from the given
+		/// character range, which need not be zero-terminated.
+		/// The whole range must consist of an optional sign followed
+		/// by decimal digits; thousand separators and whitespace are
+		/// not accepted. Digits are consumed eight at a time with a
+		/// branch-light SWAR loop, making this considerably faster
+		/// than the std::string overloads for bulk parsing.
+		/// Returns true if a valid integer has been found, false otherwise.
+		/// If parsing was not successful, value is undefined.
+
+	static bool tryParseUnsigned(const char* s, std::size_t length, unsigned& value);
+		/// Parses an unsigned integer value in decimal notation from the
+		/// given character range.
+		/// See tryParse(const char*, std::size_t, int&) for details.
+
+#if defined(POCO_HAVE_INT64)
+
+	static bool tryParse64(const char* s, std::size_t length, Int64& value);
+		/// Parses a 64-bit integer value in decimal notation from the
+		/// given character range.
+		/// See tryParse(const char*, std::size_t, int&) for details.
+
+	static bool tryParseUnsigned64(const char* s, std::size_t length, UInt64& value);
+		/// Parses an unsigned 64-bit integer value in decimal notation
+		/// from the given character range.
+		/// See tryParse(const char*, std::size_t, int&) for details.
+
+	static std::size_t tryParseArray(const char* s, std::size_t length, Int64* values, std::size_t count, char delimiter = ',');
+		/// Parses up to count delimiter-separated 64-bit integer values
+		/// in decimal notation from the given character range (e.g., a
+		/// line of a CSV file) and stores them in the values array,
+		/// which must hold at least count elements.
+		/// Returns the number of values parsed. Parsing stops when
+		/// count values have been parsed, the end of the range is
+		/// reached, or a field is not a valid integer.
+
 #endif // defined(POCO_HAVE_INT64)
 
 	static double parseFloat(const std::string& s, char decimalSeparator = '.', char thousandSeparator = ',');
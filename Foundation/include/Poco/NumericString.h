@@ -30,6 +30,7 @@
 #include <limits>
 #include <cmath>
 #include <cctype>
+#include <type_traits>
 #if !defined(POCO_NO_LOCALE)
 	#include <locale>
 #endif
@@ -250,7 +251,40 @@ namespace Impl {
 		const char* _beg;
 		char*       _cur;
 		const char* _end;
-};	
+};
+
+
+template <typename T, bool IsBool = std::is_same<T, bool>::value>
+struct UnsignedType
+	/// The unsigned counterpart of an integral type
+	/// (bool maps to unsigned int, for which
+	/// std::make_unsigned is not defined).
+{
+	typedef typename std::make_unsigned<T>::type Type;
+};
+
+
+template <typename T>
+struct UnsignedType<T, true>
+{
+	typedef unsigned Type;
+};
+
+
+static const char DIGIT_PAIRS[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+	/// Lookup table for two decimal digits at a time, halving
+	/// the number of divisions in base-10 integer formatting.
+
 
 } // namespace Impl
 
@@ -280,18 +314,43 @@ bool intToStr(T value,
 
 	Impl::Ptr ptr(result, size);
 	int thCount = 0;
-	T tmpVal;
-	do
+	T tmpVal = value;
+	if ((base == 10) && !thSep)
 	{
-		tmpVal = value;
-		value /= base;
-		*ptr++ = "FEDCBA9876543210123456789ABCDEF"[15 + (tmpVal - value * base)];
-		if (thSep && (base == 10) && (++thCount == 3))
+		// common case: convert two decimal digits at a time
+		// through the lookup table
+		typedef typename Impl::UnsignedType<T>::Type UT;
+		UT uval = (value < 0) ? UT(0) - static_cast<UT>(value) : static_cast<UT>(value);
+		while (uval >= 100)
 		{
-			*ptr++ = thSep;
-			thCount = 0;
+			UT next = uval / 100;
+			unsigned pair = static_cast<unsigned>(uval - next * 100) * 2;
+			*ptr++ = Impl::DIGIT_PAIRS[pair + 1];
+			*ptr++ = Impl::DIGIT_PAIRS[pair];
+			uval = next;
 		}
-	} while (value);
+		if (uval >= 10)
+		{
+			unsigned pair = static_cast<unsigned>(uval) * 2;
+			*ptr++ = Impl::DIGIT_PAIRS[pair + 1];
+			*ptr++ = Impl::DIGIT_PAIRS[pair];
+		}
+		else *ptr++ = static_cast<char>('0' + uval);
+	}
+	else
+	{
+		do
+		{
+			tmpVal = value;
+			value /= base;
+			*ptr++ = "FEDCBA9876543210123456789ABCDEF"[15 + (tmpVal - value * base)];
+			if (thSep && (base == 10) && (++thCount == 3))
+			{
+				*ptr++ = thSep;
+				thCount = 0;
+			}
+		} while (value);
+	}
 
 	if ('0' == fill)
 	{
@@ -359,18 +418,41 @@ bool uIntToStr(T value,
 	Impl::Ptr ptr(result, size);
 	int thCount = 0;
 	T tmpVal;
-	do
+	if ((base == 10) && !thSep)
 	{
-		tmpVal = value;
-		value /= base;
-		*ptr++ = "FEDCBA9876543210123456789ABCDEF"[15 + (tmpVal - value * base)];
-		if (thSep && (base == 10) && (++thCount == 3))
+		// common case: convert two decimal digits at a time
+		// through the lookup table
+		while (value >= 100)
 		{
-			*ptr++ = thSep;
-			thCount = 0;
+			T next = value / 100;
+			unsigned pair = static_cast<unsigned>(value - next * 100) * 2;
+			*ptr++ = Impl::DIGIT_PAIRS[pair + 1];
+			*ptr++ = Impl::DIGIT_PAIRS[pair];
+			value = next;
 		}
-	} while (value);
-	
+		if (value >= 10)
+		{
+			unsigned pair = static_cast<unsigned>(value) * 2;
+			*ptr++ = Impl::DIGIT_PAIRS[pair + 1];
+			*ptr++ = Impl::DIGIT_PAIRS[pair];
+		}
+		else *ptr++ = static_cast<char>('0' + value);
+	}
+	else
+	{
+		do
+		{
+			tmpVal = value;
+			value /= base;
+			*ptr++ = "FEDCBA9876543210123456789ABCDEF"[15 + (tmpVal - value * base)];
+			if (thSep && (base == 10) && (++thCount == 3))
+			{
+				*ptr++ = thSep;
+				thCount = 0;
+			}
+		} while (value);
+	}
+
 	if ('0' == fill)
 	{
 		if (prefix && base == 010) --width;
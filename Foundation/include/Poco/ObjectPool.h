@@ -23,8 +23,10 @@
 #include "Poco/Condition.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/SharedPtr.h"
-#include <vector>
+#include "Poco/MPMCQueue.h"
+#include <atomic>
 #include <cctype>
+#include <cstddef>
 
 
 namespace Poco {
@@ -164,6 +166,16 @@ class ObjectPool
 	///     number of objects in the pool is below the capacity,
 	///     the object is added to the pool. Otherwise it is destroyed.
 	///   - If the object is not valid, it is destroyed immediately.
+	///
+	/// The free list is kept in a lock-free queue, and the factory's
+	/// activation, validation and deactivation hooks are invoked
+	/// without any lock held, so borrowing and returning objects does
+	/// not serialize threads as long as objects are available. A mutex
+	/// and condition variable are only used by borrowers waiting for
+	/// an object at peak capacity.
+	///
+	/// Objects can be created eagerly with prewarm() to avoid the
+	/// latency of on-demand construction after startup.
 {
 public:
 	ObjectPool(std::size_t capacity, std::size_t peakCapacity):
@@ -173,11 +185,14 @@ public:
 		/// The PoolableObjectFactory must have a public default constructor.
 		_capacity(capacity),
 		_peakCapacity(peakCapacity),
-		_size(0)
+		_size(0),
+		_pooled(0),
+		_waiters(0),
+		_pool(capacity > 0 ? capacity : 1)
 	{
 		poco_assert (capacity <= peakCapacity);
 	}
-	
+
 	ObjectPool(const F& factory, std::size_t capacity, std::size_t peakCapacity):
 		/// Creates a new ObjectPool with the given PoolableObjectFactory,
 		/// capacity and peak capacity. The PoolableObjectFactory must have
@@ -185,19 +200,23 @@ public:
 		_factory(factory),
 		_capacity(capacity),
 		_peakCapacity(peakCapacity),
-		_size(0)
+		_size(0),
+		_pooled(0),
+		_waiters(0),
+		_pool(capacity > 0 ? capacity : 1)
 	{
 		poco_assert (capacity <= peakCapacity);
 	}
-	
+
 	~ObjectPool()
 		/// Destroys the ObjectPool.
 	{
 		try
 		{
-			for (typename std::vector<P>::iterator it = _pool.begin(); it != _pool.end(); ++it)
+			P pObject;
+			while (_pool.pop(pObject))
 			{
-				_factory.destroyObject(*it);
+				_factory.destroyObject(pObject);
 			}
 		}
 		catch (...)
@@ -205,7 +224,44 @@ public:
 			poco_unexpected();
 		}
 	}
-		
+
+	void prewarm(std::size_t n)
+		/// Eagerly creates up to n objects and places them in the
+		/// pool, so that later borrowObject() calls do not pay for
+		/// on-demand construction. No more objects are created than
+		/// the pool's capacity (and peak capacity) allows.
+		///
+		/// If creating an object fails, the exception is passed on
+		/// to the caller; objects created so far remain pooled.
+	{
+		if (n > _capacity) n = _capacity;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			if (!claimSlot()) break;
+			P pObject;
+			try
+			{
+				pObject = _factory.createObject();
+			}
+			catch (...)
+			{
+				releaseSlot();
+				throw;
+			}
+			if (_pooled.fetch_add(1, std::memory_order_relaxed) < _capacity && _pool.push(pObject))
+			{
+				wakeOne();
+			}
+			else
+			{
+				_pooled.fetch_sub(1, std::memory_order_relaxed);
+				_factory.destroyObject(pObject);
+				releaseSlot();
+				break;
+			}
+		}
+	}
+
 	P borrowObject(long timeoutMilliseconds = 0)
 		/// Obtains an object from the pool, or creates a new object if
 		/// possible.
@@ -215,85 +271,75 @@ public:
 		/// If activating the object fails, the object is destroyed and
 		/// the exception is passed on to the caller.
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		P pObject;
+		if (takeObject(pObject))
+			return activateObject(pObject);
 
-		if (!_pool.empty())
+		if (timeoutMilliseconds == 0)
 		{
-			P pObject = _pool.back();
-			_pool.pop_back();
-			return activateObject(pObject);
+			return 0;
 		}
-
-		if (_size >= _peakCapacity)
 		{
-			if (timeoutMilliseconds == 0)
-			{
-				return 0;
-			}
-			while (_size >= _peakCapacity)
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			_waiters.fetch_add(1, std::memory_order_release);
+			try
 			{
-				if ( !_availableCondition.tryWait(_mutex, timeoutMilliseconds))
+				while (!takeObject(pObject))
 				{
-					// timeout
-					return 0;
+					if (!_availableCondition.tryWait(_mutex, timeoutMilliseconds))
+					{
+						// timeout
+						_waiters.fetch_sub(1, std::memory_order_release);
+						return 0;
+					}
 				}
 			}
+			catch (...)
+			{
+				_waiters.fetch_sub(1, std::memory_order_release);
+				throw;
+			}
+			_waiters.fetch_sub(1, std::memory_order_release);
 		}
-
-		// _size < _peakCapacity
-		P pObject = _factory.createObject();
-		activateObject(pObject);
-		_size++;
-		return pObject;
+		return activateObject(pObject);
 	}
 
 	void returnObject(P pObject)
 		/// Returns an object to the pool.
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
-
 		if (_factory.validateObject(pObject))
 		{
 			_factory.deactivateObject(pObject);
-			if (_pool.size() < _capacity)
+			if (_pooled.fetch_add(1, std::memory_order_relaxed) < _capacity && _pool.push(pObject))
 			{
-				try
-				{
-					_pool.push_back(pObject);
-					return;
-				}
-				catch (...)
-				{
-				}
+				wakeOne();
+				return;
 			}
+			_pooled.fetch_sub(1, std::memory_order_relaxed);
 		}
 		_factory.destroyObject(pObject);
-		_size--;
-		_availableCondition.signal();
+		releaseSlot();
 	}
 
 	std::size_t capacity() const
 	{
 		return _capacity;
 	}
-	
+
 	std::size_t peakCapacity() const
 	{
 		return _peakCapacity;
 	}
-	
+
 	std::size_t size() const
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
-		
-		return _size;
+		return _size.load();
 	}
-	
+
 	std::size_t available() const
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
-
-		return _pool.size() + _peakCapacity - _size;
+		return _pooled.load() + _peakCapacity - _size.load();
 	}
 
 protected:
@@ -306,21 +352,81 @@ protected:
 		catch (...)
 		{
 			_factory.destroyObject(pObject);
+			releaseSlot();
 			throw;
 		}
 		return pObject;
 	}
-	
+
+	bool takeObject(P& pObject)
+		/// Pops a pooled object, or claims capacity for a new one
+		/// and creates it. Returns false if the peak capacity has
+		/// been reached and no pooled object is available.
+	{
+		if (_pool.pop(pObject))
+		{
+			_pooled.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		if (!claimSlot())
+			return false;
+		try
+		{
+			pObject = _factory.createObject();
+		}
+		catch (...)
+		{
+			releaseSlot();
+			throw;
+		}
+		return true;
+	}
+
+	bool claimSlot()
+		/// Reserves capacity for one more managed object.
+	{
+		std::size_t size = _size.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			if (size >= _peakCapacity)
+				return false;
+			if (_size.compare_exchange_weak(size, size + 1))
+				return true;
+		}
+	}
+
+	void releaseSlot()
+		/// Releases the capacity of a destroyed object and
+		/// wakes up a waiting borrower.
+	{
+		_size.fetch_sub(1, std::memory_order_relaxed);
+		wakeOne();
+	}
+
+	void wakeOne()
+		/// Signals the availability condition, but only if
+		/// somebody is waiting, to keep the mutex off the
+		/// borrow/return fast path.
+	{
+		if (_waiters.load(std::memory_order_acquire) > 0)
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			_availableCondition.signal();
+		}
+	}
+
 private:
 	ObjectPool();
 	ObjectPool(const ObjectPool&);
 	ObjectPool& operator = (const ObjectPool&);
-	
+
 	F _factory;
 	std::size_t _capacity;
 	std::size_t _peakCapacity;
-	std::size_t _size;
-	std::vector<P> _pool;
+	std::atomic<std::size_t> _size;
+	std::atomic<std::size_t> _pooled;
+	std::atomic<int> _waiters;
+	MPMCQueue<P> _pool;
 	mutable Poco::FastMutex _mutex;
 	Poco::Condition _availableCondition;
 };
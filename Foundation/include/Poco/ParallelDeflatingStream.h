@@ -0,0 +1,224 @@
+//
+// ParallelDeflatingStream.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  ParallelDeflatingStream
+//
+// Definition of the ParallelDeflatingOutputStream class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ParallelDeflatingStream_INCLUDED
+#define Foundation_ParallelDeflatingStream_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/BufferedStreamBuf.h"
+#include "Poco/Buffer.h"
+#include "Poco/DeflatingStream.h"
+#include "Poco/Runnable.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <map>
+#include <ostream>
+#if defined(POCO_UNBUNDLED)
+#include <zlib.h>
+#else
+#include "Poco/zlib.h"
+#endif
+
+
+namespace Poco {
+
+
+class Foundation_API ParallelDeflatingStreamBuf: public BufferedStreamBuf
+	/// This is the streambuf class used by ParallelDeflatingOutputStream.
+	///
+	/// The input data is split into blocks of a configurable size.
+	/// Each block is compressed independently as a raw deflate stream
+	/// on a thread from the given ThreadPool, terminated with a sync
+	/// flush so that it ends on a byte boundary. The compressed blocks
+	/// are written to the output stream in their original order,
+	/// concatenated into a single deflate stream; the zlib or gzip
+	/// header and trailer (with the combined checksum) are written by
+	/// the stream itself. The result is a standard zlib or gzip stream
+	/// that any inflater (e.g., a Poco::InflatingInputStream) can
+	/// decompress.
+	///
+	/// Since the blocks are compressed independently (each block starts
+	/// with an empty dictionary), the compression ratio is slightly
+	/// worse than that of a DeflatingStreamBuf; the difference is
+	/// usually below one percent for block sizes of 128 KB or more.
+	///
+	/// Output streams should always call close() to ensure
+	/// proper completion of compression.
+{
+public:
+	enum
+	{
+		DEFAULT_BLOCK_SIZE = 131072
+	};
+
+	ParallelDeflatingStreamBuf(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, std::size_t blockSize, ThreadPool& pool);
+		/// Creates a ParallelDeflatingStreamBuf for compressing data passed
+		/// through in blocks of blockSize bytes, using threads from the
+		/// given thread pool, and forwarding it to the given output stream.
+
+	~ParallelDeflatingStreamBuf();
+		/// Destroys the ParallelDeflatingStreamBuf.
+
+	int close();
+		/// Finishes up the stream.
+		///
+		/// Waits until all pending blocks have been compressed and
+		/// written, then writes the stream trailer.
+
+protected:
+	int writeToDevice(const char* buffer, std::streamsize length);
+	virtual int sync();
+
+private:
+	class CompressTask: public Runnable
+		/// Compresses one block of input data as a raw deflate stream.
+	{
+	public:
+		CompressTask(ParallelDeflatingStreamBuf& parent, UInt32 sequence, const char* data, std::size_t length, bool finalBlock);
+		void run();
+
+		UInt32 sequence() const;
+		const char* data() const;
+		std::size_t size() const;
+		std::size_t uncompressedSize() const;
+		UInt32 checksum() const;
+		bool error() const;
+		const std::string& errorMessage() const;
+
+	private:
+		ParallelDeflatingStreamBuf& _parent;
+		UInt32       _sequence;
+		Buffer<char> _input;
+		std::size_t  _inputLength;
+		bool         _finalBlock;
+		Buffer<char> _output;
+		std::size_t  _outputLength;
+		UInt32       _checksum;
+		bool         _error;
+		std::string  _errorMessage;
+	};
+
+	enum
+	{
+		STREAM_BUFFER_SIZE = 1024,
+		MIN_BLOCK_SIZE     = 1024
+	};
+
+	void submitBlock(bool finalBlock);
+		/// Hands the current block over to a pool thread (or compresses
+		/// it inline if no thread is available) for compression.
+
+	void drainOne();
+		/// Waits for the next block (in sequence order) to be compressed
+		/// and writes it to the output stream.
+
+	void drainAll();
+		/// Writes all submitted blocks to the output stream, in order.
+
+	void taskDone(CompressTask* pTask);
+		/// Called by a CompressTask when it has finished.
+
+	void writeHeader();
+	void writeTrailer();
+
+	ParallelDeflatingStreamBuf(const ParallelDeflatingStreamBuf&);
+	ParallelDeflatingStreamBuf& operator = (const ParallelDeflatingStreamBuf&);
+
+	std::ostream* _pOstr;
+	DeflatingStreamBuf::StreamType _type;
+	int          _level;
+	std::size_t  _blockSize;
+	ThreadPool&  _pool;
+	std::size_t  _maxPending;
+	Buffer<char> _block;
+	std::size_t  _blockFill;
+	UInt32       _nextSubmit;
+	UInt32       _nextWrite;
+	std::map<UInt32, CompressTask*> _done;
+	FastMutex    _mutex;
+	Condition    _taskDone;
+	bool         _headerWritten;
+	UInt32       _checksum;
+	UInt64       _totalIn;
+
+	friend class CompressTask;
+};
+
+
+class Foundation_API ParallelDeflatingIOS: public virtual std::ios
+	/// The base class for ParallelDeflatingOutputStream.
+	///
+	/// This class is needed to ensure the correct initialization
+	/// order of the stream buffer and base classes.
+{
+public:
+	ParallelDeflatingIOS(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, std::size_t blockSize, ThreadPool& pool);
+		/// Creates a ParallelDeflatingIOS for compressing data passed
+		/// through and forwarding it to the given output stream.
+
+	~ParallelDeflatingIOS();
+		/// Destroys the ParallelDeflatingIOS.
+
+	ParallelDeflatingStreamBuf* rdbuf();
+		/// Returns a pointer to the underlying stream buffer.
+
+protected:
+	ParallelDeflatingStreamBuf _buf;
+};
+
+
+class Foundation_API ParallelDeflatingOutputStream: public std::ostream, public ParallelDeflatingIOS
+	/// This stream compresses all data passing through it using zlib's
+	/// deflate algorithm, distributing the compression of independent
+	/// blocks over a thread pool, pigz-style.
+	///
+	/// It produces a standard zlib or gzip stream and can be used as a
+	/// drop-in replacement for a DeflatingOutputStream where the input
+	/// is large and multiple cores are available. After all data has
+	/// been written to the stream, close() must be called to ensure
+	/// completion of compression.
+	/// Example:
+	///     std::ofstream ostr("data.gz", std::ios::binary);
+	///     ParallelDeflatingOutputStream deflater(ostr, DeflatingStreamBuf::STREAM_GZIP);
+	///     deflater << "Hello, world!" << std::endl;
+	///     deflater.close();
+	///     ostr.close();
+{
+public:
+	ParallelDeflatingOutputStream(std::ostream& ostr, DeflatingStreamBuf::StreamType type = DeflatingStreamBuf::STREAM_ZLIB, int level = Z_DEFAULT_COMPRESSION, std::size_t blockSize = ParallelDeflatingStreamBuf::DEFAULT_BLOCK_SIZE, ThreadPool& pool = ThreadPool::defaultPool());
+		/// Creates a ParallelDeflatingOutputStream for compressing data passed
+		/// through in blocks of blockSize bytes, using threads from the
+		/// given thread pool, and forwarding it to the given output stream.
+
+	~ParallelDeflatingOutputStream();
+		/// Destroys the ParallelDeflatingOutputStream.
+
+	int close();
+		/// Finishes up the stream.
+		///
+		/// Must be called to complete compression of the stream.
+
+protected:
+	virtual int sync();
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ParallelDeflatingStream_INCLUDED
@@ -22,6 +22,11 @@
 #include <vector>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_PATH_HAVE_RVALUE_REFS
+#endif
+
+
 namespace Poco {
 
 
@@ -70,6 +75,12 @@ public:
 	Path(const Path& path);
 		/// Copy constructor
 
+#if defined(POCO_PATH_HAVE_RVALUE_REFS)
+	Path(Path&& path);
+		/// Creates a Path by moving the state of another
+		/// one, leaving the other path empty.
+#endif
+
 	Path(const Path& parent, const std::string& fileName);
 		/// Creates a path from a parent path and a filename.
 		/// The parent path is expected to reference a directory.
@@ -88,7 +99,12 @@ public:
 		
 	Path& operator = (const Path& path);
 		/// Assignment operator.
-		
+
+#if defined(POCO_PATH_HAVE_RVALUE_REFS)
+	Path& operator = (Path&& path);
+		/// Move assignment operator.
+#endif
+
 	Path& operator = (const std::string& path);
 		/// Assigns a string containing a path in native format.
 
@@ -21,6 +21,9 @@
 #include "Poco/Foundation.h"
 #include "Poco/Formatter.h"
 #include "Poco/Message.h"
+#include "Poco/DateTime.h"
+#include "Poco/Timestamp.h"
+#include "Poco/ThreadLocal.h"
 
 #include <vector>
 
@@ -131,6 +134,27 @@ private:
 		std::string prepend;
 	};
 
+	struct CachedDateTime
+		/// Per-thread cache for the Timestamp to DateTime conversion,
+		/// which is the most expensive part of formatting the date/time
+		/// specifiers. The cached value is reused as long as messages
+		/// fall into the same second, and is only used for patterns
+		/// without sub-second specifiers (%i, %c, %F).
+	{
+		CachedDateTime(): valid(false), second(0)
+		{
+		}
+
+		bool valid;
+		Timestamp::TimeVal second;
+		DateTime dateTime;
+	};
+
+	void assignDateTime(DateTime& dateTime, const Timestamp& timestamp);
+		/// Converts the given timestamp to a DateTime, reusing the
+		/// per-thread cached conversion if the pattern has no sub-second
+		/// specifiers and the timestamp falls into the cached second.
+
 	void parsePattern();
 		/// Will parse the _pattern string into the vector of PatternActions,
 		/// which contains the message key, any text that needs to be written first
@@ -138,7 +162,10 @@ private:
 
 	std::vector<PatternAction> _patternActions;
 	bool _localTime;
+	bool _needDateTime;
+	bool _cacheDateTime;
 	std::string _pattern;
+	ThreadLocal<CachedDateTime> _dateTimeCache;
 };
 
 
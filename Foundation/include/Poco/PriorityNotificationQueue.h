@@ -24,6 +24,7 @@
 #include "Poco/Event.h"
 #include <map>
 #include <deque>
+#include <vector>
 
 
 namespace Poco {
@@ -110,6 +111,31 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
+	int dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications, in order of
+		/// their priority, under a single lock acquisition and appends
+		/// them to the given vector.
+		/// Returns the number of notifications dequeued.
+		///
+		/// Draining multiple notifications per call considerably reduces
+		/// locking overhead for high-volume consumers.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if wakeUpAll() has been called by another thread.
+
+	int waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns the number of notifications dequeued; returns 0
+		/// if no notification became available in time.
+
 	void dispatch(NotificationCenter& notificationCenter);
 		/// Dispatches all queued notifications to the given
 		/// notification center.
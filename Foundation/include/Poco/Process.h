@@ -209,6 +209,19 @@ public:
 		/// of the launched process is redirected to the Pipe.
 		/// The launched process is given the specified environment variables.
 
+	static std::vector<ProcessHandle> launchBatch(
+		const std::string& command,
+		const Args& args,
+		int count);
+		/// Launches count identical worker processes for the given
+		/// command and arguments and returns their handles.
+		///
+		/// Compared to calling launch() in a loop, the command line
+		/// is prepared only once. On platforms where processes are
+		/// spawned without duplicating the parent's address space
+		/// (see launch()), this makes starting a fleet of workers
+		/// cheap even for parents with a large resident set.
+
 	static int wait(const ProcessHandle& handle);
 		/// Waits for the process specified by handle to terminate
 		/// and returns the exit code of the process.
@@ -69,6 +69,19 @@ public:
 	static void requestTerminationImpl(PIDImpl pid);
 
 private:
+	static ProcessHandleImpl* launchBySpawnImpl(
+		const std::string& command, 
+		const ArgsImpl& args, 
+		const std::string& initialDirectory,
+		Pipe* inPipe, 
+		Pipe* outPipe, 
+		Pipe* errPipe,
+		const EnvImpl& env);
+		/// Launches the process with posix_spawn(), which avoids
+		/// duplicating the parent's address space. Returns 0 if the
+		/// request cannot be expressed with posix_spawn() on this
+		/// platform and the caller must fall back to fork()/exec().
+
 	static ProcessHandleImpl* launchByForkExecImpl(
 		const std::string& command, 
 		const ArgsImpl& args, 
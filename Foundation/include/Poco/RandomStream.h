@@ -29,7 +29,9 @@ namespace Poco {
 class Foundation_API RandomBuf: public BufferedStreamBuf
 	/// This streambuf generates random data.
 	/// On Windows NT, the cryptographic API is used.
-	/// On Unix, /dev/random is used, if available.
+	/// On Unix, the data is carved out of a per-thread
+	/// entropy pool that is refilled in large batches
+	/// from getrandom(2) or /dev/urandom.
 	/// Otherwise, a random number generator, some
 	/// more-or-less random data and a SHA-1 digest
 	/// is used to generate random data.
@@ -0,0 +1,161 @@
+//
+// ReadAheadStream.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  ReadAheadStream
+//
+// Definition of the ReadAheadInputStream class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ReadAheadStream_INCLUDED
+#define Foundation_ReadAheadStream_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/BufferedStreamBuf.h"
+#include "Poco/Buffer.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <deque>
+#include <istream>
+
+
+namespace Poco {
+
+
+class Foundation_API ReadAheadStreamBuf: public BufferedStreamBuf, private Runnable
+	/// This is the streambuf class used by ReadAheadInputStream.
+	///
+	/// A background thread continuously reads chunks from the given
+	/// input stream into a bounded queue, from which the reader is
+	/// served. Reading from the source stream is thereby overlapped
+	/// with the processing of the data already read.
+{
+public:
+	enum
+	{
+		DEFAULT_CHUNK_SIZE  = 65536,
+		DEFAULT_QUEUE_SIZE  = 4
+	};
+
+	ReadAheadStreamBuf(std::istream& istr, std::size_t chunkSize, std::size_t queueSize);
+		/// Creates a ReadAheadStreamBuf reading ahead from the given
+		/// input stream in chunks of chunkSize bytes, keeping at most
+		/// queueSize chunks queued.
+
+	~ReadAheadStreamBuf();
+		/// Destroys the ReadAheadStreamBuf and stops the
+		/// read-ahead thread.
+
+protected:
+	int readFromDevice(char* buffer, std::streamsize length);
+
+private:
+	struct Chunk
+	{
+		Chunk(std::size_t size):
+			data(size),
+			size(0)
+		{
+		}
+
+		Buffer<char> data;
+		std::size_t  size;
+	};
+
+	enum
+	{
+		STREAM_BUFFER_SIZE = 4096
+	};
+
+	void run();
+		/// Fills the chunk queue from the source stream.
+
+	ReadAheadStreamBuf(const ReadAheadStreamBuf&);
+	ReadAheadStreamBuf& operator = (const ReadAheadStreamBuf&);
+
+	std::istream& _istr;
+	std::size_t   _chunkSize;
+	std::size_t   _queueSize;
+	std::deque<Chunk*> _queue;
+	Chunk*        _pCurrent;
+	std::size_t   _offset;
+	bool          _sourceDone;
+	bool          _sourceError;
+	bool          _stopped;
+	FastMutex     _mutex;
+	Condition     _notEmpty;
+	Condition     _notFull;
+	Thread        _thread;
+};
+
+
+class Foundation_API ReadAheadIOS: public virtual std::ios
+	/// The base class for ReadAheadInputStream.
+	///
+	/// This class is needed to ensure the correct initialization
+	/// order of the stream buffer and base classes.
+{
+public:
+	ReadAheadIOS(std::istream& istr, std::size_t chunkSize, std::size_t queueSize);
+		/// Creates a ReadAheadIOS reading ahead from the given
+		/// input stream.
+
+	~ReadAheadIOS();
+		/// Destroys the ReadAheadIOS.
+
+	ReadAheadStreamBuf* rdbuf();
+		/// Returns a pointer to the underlying stream buffer.
+
+protected:
+	ReadAheadStreamBuf _buf;
+};
+
+
+class Foundation_API ReadAheadInputStream: public std::istream, public ReadAheadIOS
+	/// This stream decouples reading from the given input stream
+	/// from the processing of the data read.
+	///
+	/// A background thread reads ahead from the source stream into a
+	/// bounded queue of chunks, from which this stream is served. If
+	/// reading from the source stream is itself expensive - e.g., an
+	/// InflatingInputStream decompressing inside its read calls, or a
+	/// stream reading from a slow device - the expensive work runs on
+	/// the read-ahead thread, concurrently with the consumer parsing
+	/// the data already delivered.
+	/// Example:
+	///     Poco::FileInputStream fileStream("data.gz");
+	///     Poco::InflatingInputStream inflater(fileStream, InflatingStreamBuf::STREAM_GZIP);
+	///     Poco::ReadAheadInputStream istr(inflater);
+	///     // data is decompressed on the read-ahead thread
+	///     // while it is being parsed from istr
+	///
+	/// The source stream must not be accessed by others while the
+	/// ReadAheadInputStream is reading from it; the read-ahead thread
+	/// will usually have consumed the source far beyond the position
+	/// the consumer has reached.
+{
+public:
+	ReadAheadInputStream(std::istream& istr, std::size_t chunkSize = ReadAheadStreamBuf::DEFAULT_CHUNK_SIZE, std::size_t queueSize = ReadAheadStreamBuf::DEFAULT_QUEUE_SIZE);
+		/// Creates a ReadAheadInputStream reading ahead from the given
+		/// input stream in chunks of chunkSize bytes, keeping at most
+		/// queueSize chunks queued.
+
+	~ReadAheadInputStream();
+		/// Destroys the ReadAheadInputStream.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ReadAheadStream_INCLUDED
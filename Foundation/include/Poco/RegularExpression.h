@@ -22,6 +22,7 @@
 
 
 #include "Poco/Foundation.h"
+#include "Poco/SharedPtr.h"
 #include <vector>
 
 
@@ -70,7 +71,8 @@ public:
 		RE_NEWLINE_ANY     = 0x00400000, /// assume newline is any valid Unicode newline character [ctor]
 		RE_NEWLINE_ANYCRLF = 0x00500000, /// assume newline is any of CR, LF, CRLF [ctor]
 		RE_GLOBAL          = 0x10000000, /// replace all occurences (/g) [subst]
-		RE_NO_VARS         = 0x20000000  /// treat dollar in replacement string as ordinary character [subst]
+		RE_NO_VARS         = 0x20000000, /// treat dollar in replacement string as ordinary character [subst]
+		RE_STUDY_JIT       = 0x40000000  /// compile the pattern with the PCRE JIT compiler, if available; implies study [ctor]
 	};
 	
 	struct Match
@@ -84,6 +86,11 @@ public:
 		/// Creates a regular expression and parses the given pattern.
 		/// If study is true, the pattern is analyzed and optimized. This
 		/// is mainly useful if the pattern is used more than once.
+		/// If the RE_STUDY_JIT option is given, the pattern is additionally
+		/// compiled with the PCRE JIT compiler, if available.
+		/// Compiled patterns are kept in a process-wide LRU cache keyed by
+		/// pattern and options, so constructing a RegularExpression with a
+		/// recently used pattern does not recompile it.
 		/// For a description of the options, please see the PCRE documentation.
 		/// Throws a RegularExpressionException if the patter cannot be compiled.
 		
@@ -195,10 +202,14 @@ protected:
 	std::string::size_type substOne(std::string& subject, std::string::size_type offset, const std::string& replacement, int options) const;
 
 private:
+	struct CompiledProgram;
+
 	// Note: to avoid a dependency on the pcre.h header the following are 
 	// declared as void* and casted to the correct type in the implementation file.
 	void* _pcre;  // Actual type is pcre*
 	void* _extra; // Actual type is struct pcre_extra*
+
+	SharedPtr<CompiledProgram> _program;
 	
 	static const int OVEC_SIZE;
 	
@@ -42,6 +42,15 @@ public:
 	virtual bool mustRotate(LogFile* pFile) = 0;
 		/// Returns true if the given log file must
 		/// be rotated, false otherwise.
+
+	virtual bool mustRotate(LogFile* pFile, UInt64 size);
+		/// Returns true if a log file of the given size must
+		/// be rotated, false otherwise. The size is maintained
+		/// by the caller (see FileChannel), which saves a size
+		/// query on the file for every log message.
+		///
+		/// The default implementation ignores the size and
+		/// calls mustRotate(pFile).
 		
 private:
 	RotateStrategy(const RotateStrategy&);
@@ -137,6 +146,7 @@ public:
 	RotateByIntervalStrategy(const Timespan& span);
 	~RotateByIntervalStrategy();
 	bool mustRotate(LogFile* pFile);
+	bool mustRotate(LogFile* pFile, UInt64 size);
 
 private:
 	Timespan _span;
@@ -153,6 +163,7 @@ public:
 	RotateBySizeStrategy(UInt64 size);
 	~RotateBySizeStrategy();
 	bool mustRotate(LogFile* pFile);
+	bool mustRotate(LogFile* pFile, UInt64 size);
 
 private:
 	UInt64 _size;
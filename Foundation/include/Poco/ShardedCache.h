@@ -0,0 +1,245 @@
+//
+// ShardedCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ShardedCache
+//
+// Definition of the ShardedCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedCache_INCLUDED
+#define Foundation_ShardedCache_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Hash.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+#include <set>
+#include <utility>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class TKey, class TValue, class TCache, class THash = Hash<TKey> >
+class ShardedCache
+	/// A ShardedCache distributes entries over a number of
+	/// independent cache shards, routed by a hash of the key.
+	/// Each shard is a complete cache of the given TCache type
+	/// (e.g., an LRUCache or ExpireLRUCache) with its own
+	/// strategy and mutex, so concurrent accesses to different
+	/// keys mostly proceed in parallel instead of serializing
+	/// on a single cache mutex.
+	///
+	/// The has/get/add/update/remove interface matches
+	/// AbstractCache. Note that configuration arguments given
+	/// to the constructor are passed to every shard, so e.g.
+	/// an LRU capacity applies per shard, and the total
+	/// capacity is shardCount times larger.
+	///
+	/// Cache events (Add, Get, ...) are fired by the individual
+	/// shards; use shard() to register delegates. For hot paths,
+	/// setAccessEventsEnabled(false) suppresses the per-access
+	/// Get event on all shards. Since cache strategies observe
+	/// accesses through the same event, access-based replacement
+	/// (LRU ordering, access-expiration refresh) is not updated
+	/// while suppressed; entries then age by insertion order.
+{
+public:
+	explicit ShardedCache(std::size_t shardCount = DEFAULT_SHARD_COUNT)
+		/// Creates the ShardedCache with the given number of
+		/// default-constructed shards.
+	{
+		poco_assert (shardCount > 0);
+
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			_shards.push_back(new TCache);
+		}
+	}
+
+	template <typename... Args>
+	ShardedCache(std::size_t shardCount, Args&&... args)
+		/// Creates the ShardedCache with the given number of
+		/// shards, each constructed with the given arguments.
+	{
+		poco_assert (shardCount > 0);
+
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			_shards.push_back(new TCache(args...));
+		}
+	}
+
+	~ShardedCache()
+		/// Destroys the ShardedCache and all of its shards.
+	{
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			delete *it;
+		}
+	}
+
+	void add(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		shardFor(key).add(key, val);
+	}
+
+	void add(const TKey& key, SharedPtr<TValue> val)
+		/// Adds the key value pair to the cache. Note that adding a NULL SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		shardFor(key).add(key, val);
+	}
+
+	void update(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache; if the key already
+		/// exists, the entry is silently updated without remove/add
+		/// events being fired.
+	{
+		shardFor(key).update(key, val);
+	}
+
+	void update(const TKey& key, SharedPtr<TValue> val)
+		/// Adds the key value pair to the cache; if the key already
+		/// exists, the entry is silently updated without remove/add
+		/// events being fired.
+	{
+		shardFor(key).update(key, val);
+	}
+
+	void remove(const TKey& key)
+		/// Removes an entry from the cache. If the entry is not found,
+		/// the remove is ignored.
+	{
+		shardFor(key).remove(key);
+	}
+
+	bool has(const TKey& key) const
+		/// Returns true if the cache contains a value for the key.
+	{
+		return shardFor(key).has(key);
+	}
+
+	SharedPtr<TValue> get(const TKey& key)
+		/// Returns a SharedPtr of the value. The SharedPointer will remain valid
+		/// even when cache replacement removes the element.
+		/// If for the key no value exists, an empty SharedPtr is returned.
+	{
+		return shardFor(key).get(key);
+	}
+
+	void clear()
+		/// Removes all elements from the cache.
+	{
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			(*it)->clear();
+		}
+	}
+
+	std::size_t size()
+		/// Returns the number of cached elements over all shards.
+	{
+		std::size_t result = 0;
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			result += (*it)->size();
+		}
+		return result;
+	}
+
+	void forceReplace()
+		/// Forces cache replacement on all shards.
+	{
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			(*it)->forceReplace();
+		}
+	}
+
+	std::set<TKey> getAllKeys()
+		/// Returns a copy of all keys stored in the cache.
+	{
+		std::set<TKey> result;
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			std::set<TKey> keys = (*it)->getAllKeys();
+			result.insert(keys.begin(), keys.end());
+		}
+		return result;
+	}
+
+	void setAccessEventsEnabled(bool enabled)
+		/// Enables or disables the per-access Get event on all
+		/// shards. Suppressing it removes event dispatch from the
+		/// lookup hot path, at the cost of access-based replacement
+		/// no longer observing gets (see the class documentation).
+	{
+		for (typename ShardVec::iterator it = _shards.begin(); it != _shards.end(); ++it)
+		{
+			if (enabled)
+				(*it)->Get.enable();
+			else
+				(*it)->Get.disable();
+		}
+	}
+
+	std::size_t shardCount() const
+		/// Returns the number of shards.
+	{
+		return _shards.size();
+	}
+
+	TCache& shard(std::size_t index)
+		/// Returns the shard with the given index,
+		/// e.g. for registering event delegates.
+	{
+		poco_assert (index < _shards.size());
+
+		return *_shards[index];
+	}
+
+	TCache& shardFor(const TKey& key)
+		/// Returns the shard responsible for the given key.
+	{
+		return *_shards[_hash(key) % _shards.size()];
+	}
+
+	const TCache& shardFor(const TKey& key) const
+		/// Returns the shard responsible for the given key.
+	{
+		return *_shards[_hash(key) % _shards.size()];
+	}
+
+	enum
+	{
+		DEFAULT_SHARD_COUNT = 16
+	};
+
+private:
+	ShardedCache(const ShardedCache&);
+	ShardedCache& operator = (const ShardedCache&);
+
+	typedef std::vector<TCache*> ShardVec;
+
+	ShardVec _shards;
+	THash    _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedCache_INCLUDED
@@ -45,6 +45,30 @@ public:
 		AM_WRITE
 	};
 
+	enum Options
+		/// Additional placement options for the shared memory
+		/// segment. The options are hints for the operating system;
+		/// they are currently honored on Linux and ignored on other
+		/// platforms.
+	{
+		SM_DEFAULT    = 0x00,
+			/// Default placement with normal-size pages.
+
+		SM_HUGE_PAGES = 0x01,
+			/// Back the segment with huge pages to reduce TLB
+			/// pressure for large mappings. Explicitly reserved
+			/// huge pages (MAP_HUGETLB) are tried first; if that
+			/// fails (e.g., because no huge pages are reserved),
+			/// the mapping falls back to normal pages with
+			/// transparent huge pages advised via madvise().
+
+		SM_LOCK       = 0x02
+			/// Lock the segment into physical memory with mlock(),
+			/// preventing it from being paged out. Throws a
+			/// SystemException if the memory cannot be locked
+			/// (e.g., RLIMIT_MEMLOCK is exceeded).
+	};
+
 	SharedMemory();
 		/// Default constructor creates an unmapped SharedMemory object. 
 		/// No clients can connect to an unmapped SharedMemory object.
@@ -64,6 +88,18 @@ public:
 		/// by calling shm_unlink() (on POSIX platforms) when the SharedMemory object is destroyed.
 		/// The server parameter is ignored on Windows platforms.
 
+	SharedMemory(const std::string& name, std::size_t size, AccessMode mode, Options options, int numaNode = -1, const void* addrHint = 0, bool server = true);
+		/// Creates or connects to a shared memory object with the given name,
+		/// applying the given placement options (a combination of Options
+		/// flags).
+		///
+		/// If numaNode is non-negative, the segment's pages are bound to
+		/// the given NUMA node with mbind(); a SystemException is thrown
+		/// if the pages cannot be bound. Pass -1 for default placement.
+		///
+		/// See SharedMemory(const std::string&, std::size_t, AccessMode,
+		/// const void*, bool) for the remaining parameters.
+
 	SharedMemory(const File& file, AccessMode mode, const void* addrHint = 0);
 		/// Maps the entire contents of file into a shared memory segment.
 		///
@@ -107,7 +143,14 @@ inline void SharedMemory::swap(SharedMemory& other)
 }
 
 
-} // namespace Poco::Poco
+inline SharedMemory::Options operator | (SharedMemory::Options o1, SharedMemory::Options o2)
+	/// Combines two placement options.
+{
+	return static_cast<SharedMemory::Options>(static_cast<int>(o1) | static_cast<int>(o2));
+}
+
+
+} // namespace Poco
 
 
 #endif // Foundation_SharedMemory_INCLUDED
@@ -0,0 +1,160 @@
+//
+// SharedMemoryQueue.h
+//
+// Library: Foundation
+// Package: Processes
+// Module:  SharedMemoryQueue
+//
+// Definition of the SharedMemoryQueue class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_SharedMemoryQueue_INCLUDED
+#define Foundation_SharedMemoryQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedMemory.h"
+
+
+namespace Poco {
+
+
+class Foundation_API SharedMemoryQueue
+	/// A fixed-capacity single-producer/single-consumer queue of
+	/// variable-size messages, living in a SharedMemory segment.
+	///
+	/// The queue allows two processes to exchange messages without
+	/// copying them through a socket or pipe: the producer reserves
+	/// space directly in the shared ring buffer with beginWrite(),
+	/// fills the message in place and publishes it with
+	/// commitWrite(); the consumer obtains a pointer to the message
+	/// in place with beginRead() and releases the space with
+	/// endRead(). The convenience methods write() and read() copy
+	/// messages in and out for callers that do not need the
+	/// zero-copy interface.
+	///
+	/// One process (or thread) must act as the single producer and
+	/// one as the single consumer; concurrent producers or
+	/// consumers require external synchronization. A queue
+	/// transports messages in one direction only; use a pair of
+	/// queues for request/response exchanges. The blocking
+	/// operations wait on a futex on Linux and fall back to
+	/// yielding elsewhere, so no NamedMutex or NamedEvent is
+	/// involved.
+	///
+	/// The process creating the queue passes server = true (the
+	/// segment is removed when that SharedMemoryQueue is
+	/// destroyed); the attaching process passes server = false
+	/// and the same name and capacity.
+{
+public:
+	SharedMemoryQueue(const std::string& name, std::size_t capacity, bool server = true);
+		/// Creates (server = true) or attaches to (server = false)
+		/// the shared memory queue with the given name. The capacity
+		/// is the size of the ring buffer in bytes and is rounded up
+		/// to the next power of two; both sides must pass the same
+		/// capacity.
+		///
+		/// For maximum portability, name should be a valid Unix
+		/// filename and not contain any slashes or backslashes.
+		///
+		/// Throws a SystemException if the segment cannot be mapped,
+		/// or an InvalidArgumentException if the attached segment
+		/// was created with a different capacity.
+
+	~SharedMemoryQueue();
+		/// Destroys the SharedMemoryQueue. If the queue was created
+		/// with server = true, the shared memory segment is removed.
+
+	void* beginWrite(std::size_t size);
+		/// Reserves size bytes for a message in the ring buffer and
+		/// returns a pointer to the reserved space, blocking until
+		/// enough space is available. The message becomes visible to
+		/// the consumer only after commitWrite() is called.
+		///
+		/// Throws an InvalidArgumentException if size exceeds
+		/// maxMessageSize().
+
+	void* tryBeginWrite(std::size_t size);
+		/// Reserves size bytes for a message in the ring buffer and
+		/// returns a pointer to the reserved space, or null if there
+		/// is currently not enough space.
+		///
+		/// Throws an InvalidArgumentException if size exceeds
+		/// maxMessageSize().
+
+	void commitWrite();
+		/// Publishes the message reserved with beginWrite() or
+		/// tryBeginWrite() and wakes up a waiting consumer.
+
+	const void* beginRead(std::size_t& size);
+		/// Returns a pointer to the oldest unread message in the
+		/// ring buffer and sets size to its length, blocking until
+		/// a message is available. The pointed-to data remains valid
+		/// until endRead() is called.
+
+	const void* tryBeginRead(std::size_t& size);
+		/// Returns a pointer to the oldest unread message in the
+		/// ring buffer and sets size to its length, or null if the
+		/// queue is empty.
+
+	void endRead();
+		/// Releases the space occupied by the message obtained with
+		/// beginRead() or tryBeginRead() and wakes up a waiting
+		/// producer.
+
+	void write(const void* message, std::size_t size);
+		/// Copies the given message into the queue, blocking until
+		/// enough space is available.
+
+	std::size_t read(void* buffer, std::size_t size);
+		/// Copies the oldest unread message into the given buffer,
+		/// blocking until a message is available, and returns the
+		/// message length.
+		///
+		/// Throws a RangeException if the buffer is too small for
+		/// the message; the message remains in the queue in this
+		/// case.
+
+	std::size_t capacity() const;
+		/// Returns the capacity of the ring buffer in bytes.
+
+	std::size_t maxMessageSize() const;
+		/// Returns the largest message size that can be passed
+		/// through the queue.
+
+private:
+	SharedMemoryQueue();
+	SharedMemoryQueue(const SharedMemoryQueue&);
+	SharedMemoryQueue& operator = (const SharedMemoryQueue&);
+
+	struct Header;
+
+	SharedMemory _memory;
+	Header*      _pHeader;
+	char*        _pData;
+	std::size_t  _capacity;
+	std::size_t  _pendingWrite;
+	std::size_t  _pendingRead;
+};
+
+
+//
+// inlines
+//
+inline std::size_t SharedMemoryQueue::capacity() const
+{
+	return _capacity;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_SharedMemoryQueue_INCLUDED
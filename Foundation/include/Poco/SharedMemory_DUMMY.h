@@ -31,7 +31,7 @@ class Foundation_API SharedMemoryImpl: public RefCountedObject
 	/// that do not have shared memory support.
 {
 public:
-	SharedMemoryImpl(const std::string& id, std::size_t size, SharedMemory::AccessMode mode, const void* addr, bool server);
+	SharedMemoryImpl(const std::string& id, std::size_t size, SharedMemory::AccessMode mode, const void* addr, bool server, int options = 0, int numaNode = -1);
 		/// Creates or connects to a shared memory object with the given name.
 		///
 		/// For maximum portability, name should be a valid Unix filename and not
@@ -30,7 +30,7 @@ class Foundation_API SharedMemoryImpl: public RefCountedObject
 	/// Shared memory implementation for POSIX platforms.
 {
 public:
-	SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server);
+	SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server, int options = 0, int numaNode = -1);
 		/// Creates or connects to a shared memory object with the given name.
 		///
 		/// For maximum portability, name should be a valid Unix filename and not
@@ -43,6 +43,10 @@ public:
 		///
 		/// If server is set to false, the shared memory region will be unlinked
 		/// by calling shm_unlink when the SharedMemory object is destroyed.
+		///
+		/// The options are a combination of SharedMemory::Options flags;
+		/// if numaNode is non-negative, the segment is bound to the given
+		/// NUMA node. Both are honored on Linux only.
 
 	SharedMemoryImpl(const Poco::File& file, SharedMemory::AccessMode mode, const void* addrHint);
 		/// Maps the entire contents of file into a shared memory segment.
@@ -83,6 +87,8 @@ private:
 	std::string _name;
 	bool        _fileMapped;
 	bool        _server;
+	int         _options;
+	int         _numaNode;
 };
 
 
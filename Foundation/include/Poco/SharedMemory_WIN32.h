@@ -30,7 +30,7 @@ class Foundation_API SharedMemoryImpl: public RefCountedObject
 	/// Shared memory implementation for Windows platforms.
 {
 public:
-	SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server);
+	SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server, int options = 0, int numaNode = -1);
 		/// Creates or connects to a shared memory object with the given name.
 		///
 		/// For maximum portability, name should be a valid Unix filename and not
@@ -60,6 +60,8 @@ private:
 	std::ostream*       _pOstr;
 	const TextEncoding& _inEncoding;
 	const TextEncoding& _outEncoding;
+	const TextEncoding::CharacterMap& _inMap;
+	bool                _asciiOut;
 	int                 _defaultChar;
 	unsigned char       _buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
 	int                 _sequenceLength;
@@ -35,6 +35,15 @@ public:
 	static std::streamsize copyStream(std::istream& istr, std::ostream& ostr, std::size_t bufferSize = 8192);
 		/// Writes all bytes readable from istr to ostr, using an internal buffer.
 		///
+		/// On Linux, if both streams are file streams (FileInputStream,
+		/// FileOutputStream or FileStream), the data is copied directly
+		/// between the two file descriptors with copy_file_range() or
+		/// sendfile(), bypassing the buffer.
+		///
+		/// For bulk copies of large files that do not hit the zero-copy
+		/// path, a bufferSize of 64 KB or more performs significantly
+		/// better than the default.
+		///
 		/// Returns the number of bytes copied.
 
 #if defined(POCO_HAVE_INT64)
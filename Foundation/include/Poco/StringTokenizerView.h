@@ -0,0 +1,267 @@
+//
+// StringTokenizerView.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  StringTokenizerView
+//
+// Definition of the StringTokenizerView class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_StringTokenizerView_INCLUDED
+#define Foundation_StringTokenizerView_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <cstring>
+#include <iterator>
+
+
+namespace Poco {
+
+
+class Foundation_API StringTokenizerView
+	/// A tokenizer that splits a string into tokens separated by
+	/// separator characters, like StringTokenizer, but without
+	/// copying: tokens are produced lazily while iterating and refer
+	/// to character ranges within the source string. This avoids the
+	/// per-token allocation of StringTokenizer and is therefore
+	/// preferable in hot loops that split large numbers of strings.
+	///
+	/// The TOK_IGNORE_EMPTY and TOK_TRIM options behave exactly as
+	/// in StringTokenizer.
+	///
+	/// A StringTokenizerView does not own the character buffer it
+	/// refers to; the buffer must remain valid and unchanged while
+	/// the view or any of its iterators or tokens are in use.
+{
+public:
+	enum Options
+	{
+		TOK_IGNORE_EMPTY = 1, /// ignore empty tokens
+		TOK_TRIM	 = 2  /// remove leading and trailing whitespace from tokens
+	};
+
+	class Foundation_API Token
+		/// A reference to a single token within the source string.
+	{
+	public:
+		Token();
+			/// Creates an empty Token.
+
+		Token(const char* data, std::size_t size);
+			/// Creates the Token for the given character range.
+
+		const char* data() const;
+			/// Returns a pointer to the first character of the
+			/// token. The character sequence is not null-terminated.
+
+		std::size_t size() const;
+			/// Returns the length of the token in characters.
+
+		bool empty() const;
+			/// Returns true if the token is empty.
+
+		std::string toString() const;
+			/// Returns a copy of the token.
+
+		bool operator == (const std::string& str) const;
+		bool operator == (const char* str) const;
+		bool operator != (const std::string& str) const;
+		bool operator != (const char* str) const;
+			/// Compare the token characters byte-wise.
+
+	private:
+		const char* _data;
+		std::size_t _size;
+	};
+
+	class Foundation_API Iterator
+		/// A forward iterator over the tokens of a
+		/// StringTokenizerView. The next token is located when the
+		/// iterator is incremented.
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef Token        value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const Token* pointer;
+		typedef const Token& reference;
+
+		Iterator();
+			/// Creates the end iterator.
+
+		const Token& operator * () const;
+		const Token* operator -> () const;
+
+		Iterator& operator ++ ();
+		Iterator operator ++ (int);
+
+		bool operator == (const Iterator& it) const;
+		bool operator != (const Iterator& it) const;
+
+	private:
+		Iterator(const StringTokenizerView* pView);
+
+		void advance();
+			/// Locates the next token, or turns the iterator into
+			/// the end iterator if no tokens remain.
+
+		const StringTokenizerView* _pView;
+		const char* _pos;
+		bool  _last;
+		Token _token;
+
+		friend class StringTokenizerView;
+	};
+
+	StringTokenizerView(const std::string& str, const std::string& separators, int options = 0);
+		/// Creates a view splitting the given string into tokens
+		/// separated by one of the separator characters given in
+		/// separators. The string must remain valid and unchanged
+		/// while the view is in use.
+
+	StringTokenizerView(const char* begin, const char* end, const std::string& separators, int options = 0);
+		/// Creates a view splitting the given character range into
+		/// tokens.
+
+	Iterator begin() const;
+		/// Returns an iterator for the first token.
+
+	Iterator end() const;
+		/// Returns the end iterator.
+
+private:
+	StringTokenizerView();
+	StringTokenizerView(const StringTokenizerView&);
+	StringTokenizerView& operator = (const StringTokenizerView&);
+
+	const char* _begin;
+	const char* _end;
+	std::string _separators;
+	int _options;
+
+	friend class Iterator;
+};
+
+
+//
+// inlines
+//
+inline StringTokenizerView::Token::Token():
+	_data(0),
+	_size(0)
+{
+}
+
+
+inline StringTokenizerView::Token::Token(const char* data, std::size_t size):
+	_data(data),
+	_size(size)
+{
+}
+
+
+inline const char* StringTokenizerView::Token::data() const
+{
+	return _data;
+}
+
+
+inline std::size_t StringTokenizerView::Token::size() const
+{
+	return _size;
+}
+
+
+inline bool StringTokenizerView::Token::empty() const
+{
+	return _size == 0;
+}
+
+
+inline std::string StringTokenizerView::Token::toString() const
+{
+	return _size ? std::string(_data, _size) : std::string();
+}
+
+
+inline bool StringTokenizerView::Token::operator == (const std::string& str) const
+{
+	return _size == str.size() && (_size == 0 || std::memcmp(_data, str.data(), _size) == 0);
+}
+
+
+inline bool StringTokenizerView::Token::operator == (const char* str) const
+{
+	return _size == std::strlen(str) && (_size == 0 || std::memcmp(_data, str, _size) == 0);
+}
+
+
+inline bool StringTokenizerView::Token::operator != (const std::string& str) const
+{
+	return !(*this == str);
+}
+
+
+inline bool StringTokenizerView::Token::operator != (const char* str) const
+{
+	return !(*this == str);
+}
+
+
+inline const StringTokenizerView::Token& StringTokenizerView::Iterator::operator * () const
+{
+	return _token;
+}
+
+
+inline const StringTokenizerView::Token* StringTokenizerView::Iterator::operator -> () const
+{
+	return &_token;
+}
+
+
+inline StringTokenizerView::Iterator& StringTokenizerView::Iterator::operator ++ ()
+{
+	advance();
+	return *this;
+}
+
+
+inline StringTokenizerView::Iterator StringTokenizerView::Iterator::operator ++ (int)
+{
+	Iterator it(*this);
+	advance();
+	return it;
+}
+
+
+inline bool StringTokenizerView::Iterator::operator == (const Iterator& it) const
+{
+	return _pView == it._pView && _pos == it._pos && _last == it._last;
+}
+
+
+inline bool StringTokenizerView::Iterator::operator != (const Iterator& it) const
+{
+	return !(*this == it);
+}
+
+
+inline StringTokenizerView::Iterator StringTokenizerView::end() const
+{
+	return Iterator();
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_StringTokenizerView_INCLUDED
@@ -0,0 +1,162 @@
+//
+// StripedCounter.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  StripedCounter
+//
+// Definition of the StripedCounter class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_StripedCounter_INCLUDED
+#define Foundation_StripedCounter_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+
+
+namespace Poco {
+
+
+class StripedCounter
+	/// This class implements a counter optimized for
+	/// high-contention updates, such as statistics maintained
+	/// by many threads and read only occasionally (e.g., by a
+	/// metrics scraper).
+	///
+	/// In contrast to AtomicCounter, updates do not all target
+	/// the same memory location. The counter value is striped
+	/// over a fixed number of cache-line-padded slots, and each
+	/// thread updates its own slot, so concurrent updates from
+	/// different cores do not bounce a shared cache line.
+	/// Reading the value sums all slots and is therefore more
+	/// expensive than reading an AtomicCounter.
+	///
+	/// The value returned by value() is a best-effort snapshot;
+	/// updates performed concurrently with value() may or may
+	/// not be included. Updates themselves are never lost.
+{
+public:
+	typedef Poco::Int64 ValueType;
+
+	StripedCounter();
+		/// Creates a new StripedCounter and initializes it to zero.
+
+	explicit StripedCounter(ValueType initialValue);
+		/// Creates a new StripedCounter and initializes it with
+		/// the given value.
+
+	~StripedCounter();
+		/// Destroys the StripedCounter.
+
+	void increment();
+		/// Increments the counter.
+
+	void decrement();
+		/// Decrements the counter.
+
+	void add(ValueType amount);
+		/// Adds the given (possibly negative) amount to the counter.
+
+	ValueType value() const;
+		/// Returns the current value of the counter by summing
+		/// all slots.
+
+private:
+	StripedCounter(const StripedCounter&);
+	StripedCounter& operator = (const StripedCounter&);
+
+	static unsigned stripe();
+		/// Returns the slot index for the calling thread.
+
+	enum
+	{
+		STRIPE_COUNT = 16, // must be a power of two
+		CACHE_LINE_SIZE = 64
+	};
+
+	struct Slot
+	{
+		std::atomic<ValueType> value;
+		char padding[CACHE_LINE_SIZE - sizeof(std::atomic<ValueType>)];
+	};
+
+	Slot _slots[STRIPE_COUNT];
+};
+
+
+//
+// inlines
+//
+inline StripedCounter::StripedCounter()
+{
+	for (int i = 0; i < STRIPE_COUNT; i++)
+	{
+		_slots[i].value.store(0, std::memory_order_relaxed);
+	}
+}
+
+
+inline StripedCounter::StripedCounter(ValueType initialValue)
+{
+	_slots[0].value.store(initialValue, std::memory_order_relaxed);
+	for (int i = 1; i < STRIPE_COUNT; i++)
+	{
+		_slots[i].value.store(0, std::memory_order_relaxed);
+	}
+}
+
+
+inline StripedCounter::~StripedCounter()
+{
+}
+
+
+inline unsigned StripedCounter::stripe()
+{
+	static std::atomic<unsigned> nextIndex(0);
+	thread_local unsigned index(nextIndex.fetch_add(1, std::memory_order_relaxed));
+	return index & (STRIPE_COUNT - 1);
+}
+
+
+inline void StripedCounter::increment()
+{
+	_slots[stripe()].value.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+inline void StripedCounter::decrement()
+{
+	_slots[stripe()].value.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+inline void StripedCounter::add(ValueType amount)
+{
+	_slots[stripe()].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+
+inline StripedCounter::ValueType StripedCounter::value() const
+{
+	ValueType sum = 0;
+	for (int i = 0; i < STRIPE_COUNT; i++)
+	{
+		sum += _slots[i].value.load(std::memory_order_relaxed);
+	}
+	return sum;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_StripedCounter_INCLUDED
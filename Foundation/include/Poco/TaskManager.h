@@ -24,7 +24,11 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/NotificationCenter.h"
 #include "Poco/Timestamp.h"
+#include "Poco/Thread.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Event.h"
 #include <list>
+#include <map>
 
 
 namespace Poco {
@@ -45,6 +49,13 @@ class Foundation_API TaskManager
 	/// subclasses for the various events that result in a notification.
 	/// To keep the number of notifications small, a TaskProgressNotification
 	/// will only be sent out once in 100 milliseconds.
+	///
+	/// Alternatively, progress notifications can be coalesced
+	/// (see setProgressCoalescingInterval()). In coalescing mode,
+	/// progress updates only record the latest progress value per task,
+	/// and a dedicated thread periodically posts one
+	/// TaskProgressNotification per updated task, so task threads
+	/// are never stalled by observer dispatch.
 {
 public:
 	typedef AutoPtr<Task>      TaskPtr;
@@ -96,6 +107,27 @@ public:
 	void removeObserver(const AbstractObserver& observer);
 		/// Unregisters an observer with the NotificationCenter.
 
+	void setProgressCoalescingInterval(long milliseconds);
+		/// Enables or disables coalescing of progress notifications.
+		///
+		/// If milliseconds is greater than zero, progress updates
+		/// reported by tasks are coalesced: only the latest progress
+		/// value per task is kept, and every milliseconds a dedicated
+		/// thread posts one TaskProgressNotification for each task
+		/// whose progress changed. Task threads never invoke
+		/// observers directly in this mode.
+		///
+		/// If milliseconds is zero (the default), progress
+		/// notifications are posted synchronously from the task's
+		/// thread, throttled to one notification per 100 milliseconds.
+		///
+		/// Note that in coalescing mode, a final progress notification
+		/// may be delivered after the task's TaskFinishedNotification.
+
+	long getProgressCoalescingInterval() const;
+		/// Returns the progress coalescing interval in milliseconds,
+		/// or zero if coalescing is disabled.
+
 	static const int MIN_PROGRESS_NOTIFICATION_INTERVAL;
 
 protected:
@@ -110,10 +142,23 @@ protected:
 	void taskFailed(Task* pTask, const Exception& exc);
 
 private:
+	typedef std::map<TaskPtr, float> ProgressMap;
+
+	void startProgressThread();
+	void stopProgressThread();
+	void runProgressThread();
+		/// Periodically posts the coalesced progress notifications.
+
 	ThreadPool&        _threadPool;
 	TaskList           _taskList;
 	Timestamp          _lastProgressNotification;
 	NotificationCenter _nc;
+	long               _progressCoalescingInterval;
+	ProgressMap        _pendingProgress;
+	Thread             _progressThread;
+	RunnableAdapter<TaskManager> _progressRunnable;
+	Event              _progressStop;
+	bool               _progressThreadRunning;
 	mutable FastMutex  _mutex;
 
 	friend class Task;
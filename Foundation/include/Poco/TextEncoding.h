@@ -134,6 +134,21 @@ public:
 		/// the byte sequence remains unchanged.
 		/// The default implementation simply returns 0.
 
+	virtual int convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar = '?') const;
+		/// Converts a block of bytes in this encoding and appends the
+		/// result, converted to destEncoding, to destination.
+		/// Malformed or inconvertible sequences are replaced with
+		/// defaultChar; the number of such replacements is returned.
+		///
+		/// The default implementation decodes single-byte characters
+		/// directly through the characterMap() of this encoding and
+		/// writes ASCII characters directly when destEncoding encodes
+		/// US-ASCII as itself, so single-byte encodings (ISO-8859-*,
+		/// windows-125x, ASCII) are converted in bulk without
+		/// per-character virtual calls; only multi-byte sequences go
+		/// through queryConvert()/convert(). Subclasses with multi-byte
+		/// sequences can override this with a batched implementation.
+
 	static TextEncoding& byName(const std::string& encodingName);
 		/// Returns the TextEncoding object for the given encoding name.
 		///
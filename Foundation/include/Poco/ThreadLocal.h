@@ -22,6 +22,11 @@
 #include <map>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+	#define POCO_THREADLOCAL_HAVE_NATIVE_TLS
+#endif
+
+
 namespace Poco {
 
 
@@ -87,6 +92,12 @@ public:
 	static void clear();
 		/// Clears the current thread's TLS object.
 		/// Does nothing in the main thread.
+
+	static unsigned epoch();
+		/// Returns the current thread's TLS epoch. The epoch is
+		/// incremented by clear(), invalidating the native
+		/// thread_local slot caches kept by the ThreadLocal
+		/// template.
 	
 private:
 	typedef std::map<const void*, TLSAbstractSlot*> TLSMap;
@@ -139,10 +150,32 @@ public:
 	C& get()
 		/// Returns a reference to the underlying data object.
 		/// The reference can be used to modify the object.
+		///
+		/// Where the compiler supports native thread_local storage,
+		/// the slot found by the first lookup is cached per thread,
+		/// reducing subsequent accesses from a map lookup to a
+		/// thread-local read and two comparisons. The cache is
+		/// keyed by the ThreadLocal's address and invalidated via
+		/// ThreadLocalStorage::epoch() when the thread's storage
+		/// is cleared (e.g. between ThreadPool jobs).
 	{
+#if defined(POCO_THREADLOCAL_HAVE_NATIVE_TLS)
+		static thread_local const void* cachedKey = 0;
+		static thread_local Slot* cachedSlot = 0;
+		static thread_local unsigned cachedEpoch = 0;
+		if (cachedKey == this && cachedEpoch == ThreadLocalStorage::epoch())
+			return cachedSlot->value();
+#endif
 		TLSAbstractSlot*& p = ThreadLocalStorage::current().get(this);
 		if (!p) p = new Slot;
+#if defined(POCO_THREADLOCAL_HAVE_NATIVE_TLS)
+		cachedKey = this;
+		cachedSlot = static_cast<Slot*>(p);
+		cachedEpoch = ThreadLocalStorage::epoch();
+		return cachedSlot->value();
+#else
 		return static_cast<Slot*>(p)->value();
+#endif
 	}
 	
 private:
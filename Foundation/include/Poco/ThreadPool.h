@@ -27,8 +27,16 @@
 namespace Poco {
 
 
+namespace Metrics {
+
+class Gauge;
+
+}
+
+
 class Runnable;
 class PooledThread;
+class WorkStealingPool;
 
 
 class Foundation_API ThreadPool
@@ -45,30 +53,56 @@ class Foundation_API ThreadPool
 	/// threads are created. Once the demand for threads sinks
 	/// again, no-longer used threads are stopped and removed
 	/// from the pool.
+	///
+	/// With the default scheduling policy, every call to start()
+	/// hands the target to a dedicated pooled thread. With the
+	/// work-stealing policy, targets are enqueued on per-worker
+	/// lock-free queues and idle workers steal work from their
+	/// siblings, which scales considerably better when many short
+	/// targets are started from many threads concurrently.
 {
 public:
+	enum SchedulingPolicy
+	{
+		SCHEDULING_DEFAULT = 0,
+			/// Every started target runs on a dedicated pooled thread,
+			/// obtained under a pool-wide mutex.
+		SCHEDULING_WORK_STEALING = 1
+			/// Started targets are distributed over per-worker lock-free
+			/// queues; idle workers steal queued targets from their
+			/// siblings. Queued targets that have not yet been started
+			/// when stopAll() is called are discarded, and worker
+			/// threads are not retired while the pool exists.
+	};
+
 	ThreadPool(int minCapacity = 2,
 		int maxCapacity = 16,
 		int idleTime = 60,
-		int stackSize = POCO_THREAD_STACK_SIZE);
+		int stackSize = POCO_THREAD_STACK_SIZE,
+		SchedulingPolicy schedulingPolicy = SCHEDULING_DEFAULT);
 		/// Creates a thread pool with minCapacity threads.
 		/// If required, up to maxCapacity threads are created
 		/// a NoThreadAvailableException exception is thrown.
 		/// If a thread is running idle for more than idleTime seconds,
 		/// and more than minCapacity threads are running, the thread
 		/// is killed. Threads are created with given stack size.
+		/// The schedulingPolicy selects how started targets are
+		/// assigned to pooled threads.
 
 	ThreadPool(const std::string& name,
 		int minCapacity = 2,
 		int maxCapacity = 16,
 		int idleTime = 60,
-		int stackSize = POCO_THREAD_STACK_SIZE);
+		int stackSize = POCO_THREAD_STACK_SIZE,
+		SchedulingPolicy schedulingPolicy = SCHEDULING_DEFAULT);
 		/// Creates a thread pool with the given name and minCapacity threads.
 		/// If required, up to maxCapacity threads are created
 		/// a NoThreadAvailableException exception is thrown.
 		/// If a thread is running idle for more than idleTime seconds,
 		/// and more than minCapacity threads are running, the thread
 		/// is killed. Threads are created with given stack size.
+		/// The schedulingPolicy selects how started targets are
+		/// assigned to pooled threads.
 
 	~ThreadPool();
 		/// Currently running threads will remain active
@@ -85,6 +119,9 @@ public:
 		/// Sets the stack size for threads.
 		/// New stack size applies only for newly created threads.
 
+	SchedulingPolicy getSchedulingPolicy() const;
+		/// Returns the scheduling policy given in the constructor.
+
 	int getStackSize() const;
 		/// Returns the stack size used to create new threads.
 
@@ -107,6 +144,10 @@ public:
 		/// Assigns the given name to the thread.
 		/// Throws a NoThreadAvailableException if no more
 		/// threads are available.
+		///
+		/// With the work-stealing scheduling policy, the
+		/// given name is ignored, as queued targets may run
+		/// on any worker thread.
 
 	void startWithPriority(Thread::Priority priority, Runnable& target);
 		/// Obtains a thread, adjusts the thread's priority, and starts the target.
@@ -162,6 +203,7 @@ protected:
 	PooledThread* createThread();
 
 	void housekeep();
+	void updateMetrics();
 
 private:
 	ThreadPool(const ThreadPool& pool);
@@ -176,7 +218,11 @@ private:
 	int _serial;
 	int _age;
 	int _stackSize;
+	SchedulingPolicy _schedulingPolicy;
 	ThreadVec _threads;
+	WorkStealingPool* _pStealingPool;
+	Metrics::Gauge* _pUsedGauge;
+	Metrics::Gauge* _pAllocatedGauge;
 	mutable FastMutex _mutex;
 };
 
@@ -184,15 +230,15 @@ private:
 //
 // inlines
 //
-inline void ThreadPool::setStackSize(int stackSize)
+inline int ThreadPool::getStackSize() const
 {
-	_stackSize = stackSize;
+	return _stackSize;
 }
 
 
-inline int ThreadPool::getStackSize() const
+inline ThreadPool::SchedulingPolicy ThreadPool::getSchedulingPolicy() const
 {
-	return _stackSize;
+	return _schedulingPolicy;
 }
 
 
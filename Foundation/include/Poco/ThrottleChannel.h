@@ -0,0 +1,169 @@
+//
+// ThrottleChannel.h
+//
+// Library: Foundation
+// Package: Logging
+// Module:  ThrottleChannel
+//
+// Definition of the ThrottleChannel class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ThrottleChannel_INCLUDED
+#define Foundation_ThrottleChannel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Channel.h"
+#include "Poco/Message.h"
+#include "Poco/Random.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <map>
+
+
+namespace Poco {
+
+
+class Foundation_API ThrottleChannel: public Channel
+	/// This channel suppresses repeated messages before they
+	/// reach the destination channel, protecting it against
+	/// error storms where the same message is formatted and
+	/// written over and over again.
+	///
+	/// Messages are deduplicated by source, priority and a hash
+	/// of the message text. The first occurrence of a message is
+	/// passed on; repeats arriving within the suppression window
+	/// are counted but not forwarded. When the window expires,
+	/// a summary message ("last message repeated N times") with
+	/// the source and priority of the suppressed message is
+	/// emitted, followed by the new occurrence.
+	///
+	/// Optionally, messages can also be sampled probabilistically,
+	/// forwarding each message only with a given probability.
+	/// To sample different loggers at different rates, attach a
+	/// separately configured ThrottleChannel to each logger.
+	///
+	/// The ThrottleChannel supports the following configuration
+	/// properties:
+	///
+	///   * channel:    The destination channel to which messages
+	///     are forwarded.
+	///   * window:     The suppression window in milliseconds
+	///     (default 5000). Repeats of a message within the window
+	///     are summarized instead of forwarded.
+	///   * sampleRate: The probability (between 0 and 1) with which
+	///     a message is forwarded (default 1, meaning that every
+	///     message is forwarded). Sampling is applied before
+	///     deduplication.
+{
+public:
+	ThrottleChannel();
+		/// Creates the ThrottleChannel with no destination channel.
+
+	ThrottleChannel(Channel* pChannel);
+		/// Creates the ThrottleChannel and connects it to
+		/// the given channel.
+
+	void setChannel(Channel* pChannel);
+		/// Sets the destination channel to which messages
+		/// are forwarded.
+
+	Channel* getChannel() const;
+		/// Returns the destination channel.
+
+	void log(const Message& msg);
+		/// Forwards the message to the destination channel,
+		/// unless it is a repeat within the suppression window
+		/// or is dropped by sampling.
+
+	void setProperty(const std::string& name, const std::string& value);
+		/// Sets or changes a configuration property.
+		///
+		/// The following properties are supported:
+		///   * channel:    The destination channel, resolved via
+		///     the LoggingRegistry.
+		///   * window:     The suppression window in milliseconds.
+		///   * sampleRate: The forwarding probability (0 .. 1).
+		///
+		/// Unsupported properties are passed to the destination
+		/// channel.
+
+	std::string getProperty(const std::string& name) const;
+		/// Returns the value of the property with the given name.
+
+	void open();
+		/// Opens the destination channel.
+
+	void close();
+		/// Emits pending summary messages and closes the
+		/// destination channel.
+
+	static const std::string PROP_CHANNEL;
+	static const std::string PROP_WINDOW;
+	static const std::string PROP_SAMPLERATE;
+
+protected:
+	~ThrottleChannel();
+		/// Destroys the ThrottleChannel.
+
+private:
+	struct MessageKey
+	{
+		std::string source;
+		int priority;
+		std::size_t textHash;
+
+		bool operator < (const MessageKey& other) const
+		{
+			if (source != other.source) return source < other.source;
+			if (priority != other.priority) return priority < other.priority;
+			return textHash < other.textHash;
+		}
+	};
+
+	struct SuppressionEntry
+	{
+		SuppressionEntry(): count(0)
+		{
+		}
+
+		Timestamp windowStart;
+		int count;
+	};
+
+	typedef std::map<MessageKey, SuppressionEntry> SuppressionMap;
+
+	void emitSummary(const MessageKey& key, const SuppressionEntry& entry);
+		/// Forwards a "last message repeated N times" summary for
+		/// the given entry. The caller must hold the mutex.
+
+	void purge();
+		/// Removes expired entries from the suppression map,
+		/// emitting summaries for suppressed repeats.
+		/// The caller must hold the mutex.
+
+	enum
+	{
+		DEFAULT_WINDOW  = 5000,
+		PURGE_THRESHOLD = 1000 // purge expired entries when the map grows beyond this
+	};
+
+	Channel* _pChannel;
+	Timestamp::TimeDiff _window;
+	double _sampleRate;
+	SuppressionMap _messages;
+	Random _random;
+	FastMutex _mutex;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ThrottleChannel_INCLUDED
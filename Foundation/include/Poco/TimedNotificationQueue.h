@@ -25,6 +25,7 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Clock.h"
 #include <map>
+#include <vector>
 
 
 namespace Poco {
@@ -55,10 +56,10 @@ public:
 	TimedNotificationQueue();
 		/// Creates the TimedNotificationQueue.
 
-	~TimedNotificationQueue();
+	virtual ~TimedNotificationQueue();
 		/// Destroys the TimedNotificationQueue.
 
-	void enqueueNotification(Notification::Ptr pNotification, Timestamp timestamp);
+	virtual void enqueueNotification(Notification::Ptr pNotification, Timestamp timestamp);
 		/// Enqueues the given notification by adding it to
 		/// the queue according to the given timestamp.
 		/// Lower timestamp values are inserted before higher ones.
@@ -69,7 +70,7 @@ public:
 		///
 		/// The Timestamp is converted to an equivalent Clock value.
 
-	void enqueueNotification(Notification::Ptr pNotification, Clock clock);
+	virtual void enqueueNotification(Notification::Ptr pNotification, Clock clock);
 		/// Enqueues the given notification by adding it to
 		/// the queue according to the given clock value.
 		/// Lower clock values are inserted before higher ones.
@@ -78,7 +79,15 @@ public:
 		///     notificationQueue.enqueueNotification(new MyNotification, someTime);
 		/// does not result in a memory leak.
 
-	Notification* dequeueNotification();
+	virtual void enqueueNotification(Notification::Ptr pNotification, Clock clock, const void* pOwner);
+		/// Enqueues the given notification, tagged with the given
+		/// owner, by adding it to the queue according to the given
+		/// clock value.
+		///
+		/// All notifications tagged with the same owner can later be
+		/// cancelled together with a single call to cancelNotifications().
+
+	virtual Notification* dequeueNotification();
 		/// Dequeues the next pending notification with a timestamp
 		/// less than or equal to the current time.
 		/// Returns 0 (null) if no notification is available.
@@ -89,10 +98,10 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 		
-	Notification* waitDequeueNotification();
+	virtual Notification* waitDequeueNotification();
 		/// Dequeues the next pending notification.
 		/// If no notification is available, waits for a notification
-		/// to be enqueued. 
+		/// to be enqueued.
 		/// The caller gains ownership of the notification and
 		/// is expected to release it when done with it.
 		///
@@ -100,7 +109,7 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
-	Notification* waitDequeueNotification(long milliseconds);
+	virtual Notification* waitDequeueNotification(long milliseconds);
 		/// Dequeues the next pending notification.
 		/// If no notification is available, waits for a notification
 		/// to be enqueued up to the specified time.
@@ -112,13 +121,32 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
-	bool empty() const;
+	virtual int dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+		/// Dequeues up to maxCount pending notifications with a
+		/// timestamp less than or equal to the current time, under
+		/// a single lock acquisition, and appends them to the given
+		/// vector.
+		/// Returns the number of notifications dequeued.
+		///
+		/// Draining multiple due notifications per call considerably
+		/// reduces locking overhead for high-volume consumers.
+
+	virtual int cancelNotifications(const void* pOwner);
+		/// Removes all pending notifications tagged with the given
+		/// owner from the queue.
+		/// Returns the number of notifications removed.
+		///
+		/// This implementation must scan the entire queue and is
+		/// therefore O(n); see TimingWheelNotificationQueue for a
+		/// queue with inexpensive bulk cancellation.
+
+	virtual bool empty() const;
 		/// Returns true iff the queue is empty.
-		
-	int size() const;
+
+	virtual int size() const;
 		/// Returns the number of notifications in the queue.
 
-	void clear();
+	virtual void clear();
 		/// Removes all notifications from the queue.
 		///
 		/// Calling clear() while another thread executes one of
@@ -126,10 +154,15 @@ public:
 		/// behavior.
 
 protected:
-	typedef std::multimap<Clock, Notification::Ptr> NfQueue;
+	struct QueuedNotification
+	{
+		Notification::Ptr pNf;
+		const void*       pOwner;
+	};
+	typedef std::multimap<Clock, QueuedNotification> NfQueue;
 	Notification::Ptr dequeueOne(NfQueue::iterator& it);
 	bool wait(Clock::ClockDiff interval);
-	
+
 private:
 	NfQueue _nfQueue;
 	Event   _nfAvailable;
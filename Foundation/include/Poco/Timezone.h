@@ -49,7 +49,23 @@ public:
 		/// Returns the time zone differential for the current timezone.
 		/// The timezone differential is computed as utcOffset() + dst()
 		/// and is expressed in seconds.
-	
+
+	static int tzd(const Timestamp& timestamp);
+		/// Returns the time zone differential in effect at the given
+		/// point in time, expressed in seconds.
+		///
+		/// The differential is served from a cached snapshot of the
+		/// timezone rules whenever the given time falls into the
+		/// snapshot's validity interval, so repeated calls for nearby
+		/// points in time (e.g. when timestamping log messages) do not
+		/// go through the C library's locking localtime() machinery.
+
+	static void invalidateCache();
+		/// Discards the cached timezone information used by tzd(),
+		/// forcing it to be recomputed on the next call. This should
+		/// be called after the process' timezone has been changed
+		/// (e.g., by modifying the TZ environment variable).
+
 	static std::string name();
 		/// Returns the timezone name currently in effect.
 		
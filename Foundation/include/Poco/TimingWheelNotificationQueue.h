@@ -0,0 +1,127 @@
+//
+// TimingWheelNotificationQueue.h
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  TimingWheelNotificationQueue
+//
+// Definition of the TimingWheelNotificationQueue class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimingWheelNotificationQueue_INCLUDED
+#define Foundation_TimingWheelNotificationQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/TimedNotificationQueue.h"
+#include <map>
+
+
+namespace Poco {
+
+
+class Foundation_API TimingWheelNotificationQueue: public TimedNotificationQueue
+	/// A drop-in replacement for TimedNotificationQueue based on a
+	/// hierarchical timing wheel (G. Varghese, A. Lauck: "Hashed and
+	/// Hierarchical Timing Wheels").
+	///
+	/// Instead of a balanced tree ordered by timestamp, notifications
+	/// are bucketed into a hierarchy of fixed-size slot arrays, making
+	/// both scheduling and cancellation O(1) and allocation-light.
+	/// This pays off with very large numbers of outstanding timed
+	/// notifications (e.g., hundreds of thousands of connection
+	/// timeouts), where the O(log n) insertions and node allocations
+	/// of TimedNotificationQueue dominate.
+	///
+	/// The trade-offs are a fixed scheduling granularity of one
+	/// millisecond (notifications are never delivered before their
+	/// microsecond-resolution Clock value, but may be delivered up
+	/// to one millisecond late), and that notifications expiring in
+	/// the same millisecond are delivered in unspecified order.
+	///
+	/// The multithreading restrictions of TimedNotificationQueue
+	/// apply unchanged: multiple threads may enqueue, but only one
+	/// thread at a time may dequeue.
+{
+public:
+	TimingWheelNotificationQueue();
+		/// Creates the TimingWheelNotificationQueue.
+
+	~TimingWheelNotificationQueue();
+		/// Destroys the TimingWheelNotificationQueue.
+
+	void enqueueNotification(Notification::Ptr pNotification, Timestamp timestamp);
+	void enqueueNotification(Notification::Ptr pNotification, Clock clock);
+	void enqueueNotification(Notification::Ptr pNotification, Clock clock, const void* pOwner);
+	Notification* dequeueNotification();
+	Notification* waitDequeueNotification();
+	Notification* waitDequeueNotification(long milliseconds);
+	int dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount);
+	int cancelNotifications(const void* pOwner);
+		/// Removes all pending notifications tagged with the given
+		/// owner from the queue.
+		/// Returns the number of notifications removed.
+		///
+		/// In contrast to TimedNotificationQueue, cancellation cost
+		/// is proportional to the number of notifications cancelled,
+		/// not to the size of the queue.
+	bool empty() const;
+	int size() const;
+	void clear();
+
+private:
+	enum
+	{
+		WHEEL_BITS   = 6,
+		WHEEL_SLOTS  = 1 << WHEEL_BITS,
+		WHEEL_LEVELS = 6,
+		TICK_MICROSECONDS = 1000
+	};
+
+	struct Entry;
+	typedef std::multimap<const void*, Entry*> OwnerIndex;
+
+	struct Entry
+	{
+		Clock               clock;
+		Notification::Ptr   pNf;
+		const void*         pOwner;
+		Entry*              pPrev;
+		Entry*              pNext;
+		Entry**             pList;
+		int                 level; // -1 if on the expired list
+		OwnerIndex::iterator ownerIt;
+	};
+
+	static Poco::Int64 tickOf(const Clock& clock);
+	void insertEntry(Entry* pEntry);
+	void linkExpired(Entry* pEntry);
+	void unlinkEntry(Entry* pEntry);
+	void deleteEntry(Entry* pEntry);
+	void advanceTo(Poco::Int64 nowTick);
+	void cascade(int level, int slot);
+	Entry* popExpired();
+	Clock::ClockDiff nextSleep() const;
+
+	Entry*      _slots[WHEEL_LEVELS][WHEEL_SLOTS];
+	int         _levelCounts[WHEEL_LEVELS];
+	Entry*      _expired;
+	Entry*      _expiredTail;
+	Poco::Int64 _lastTick;
+	OwnerIndex  _ownerIndex;
+	std::size_t _size;
+	Event       _nfAvailable;
+	mutable FastMutex _mutex;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimingWheelNotificationQueue_INCLUDED
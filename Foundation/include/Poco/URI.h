@@ -23,6 +23,11 @@
 #include <utility>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_URI_HAVE_RVALUE_REFS
+#endif
+
+
 namespace Poco {
 
 
@@ -78,7 +83,13 @@ public:
 
 	URI(const URI& uri);
 		/// Copy constructor. Creates an URI from another one.
-		
+
+#if defined(POCO_URI_HAVE_RVALUE_REFS)
+	URI(URI&& uri);
+		/// Creates an URI by moving the state of another
+		/// one, leaving the other URI empty.
+#endif
+
 	URI(const URI& baseURI, const std::string& relativeURI);
 		/// Creates an URI from a base URI and a relative URI, according to
 		/// the algorithm in section 5.2 of RFC 3986.
@@ -94,7 +105,12 @@ public:
 	
 	URI& operator = (const URI& uri);
 		/// Assignment operator.
-		
+
+#if defined(POCO_URI_HAVE_RVALUE_REFS)
+	URI& operator = (URI&& uri);
+		/// Move assignment operator.
+#endif
+
 	URI& operator = (const std::string& uri);
 		/// Parses and assigns an URI from the given string. Throws a
 		/// SyntaxException if the uri is not valid.
@@ -0,0 +1,329 @@
+//
+// URIView.h
+//
+// Library: Foundation
+// Package: URI
+// Module:  URIView
+//
+// Definition of the URIView class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_URIView_INCLUDED
+#define Foundation_URIView_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <vector>
+#include <utility>
+#include <cstring>
+
+
+namespace Poco {
+
+
+class URI;
+
+
+class Foundation_API URIView
+	/// A read-only view of a URI, as specified in RFC 3986.
+	///
+	/// While the URI class splits a URI into six separately allocated
+	/// strings and eagerly decodes all percent-escapes, a URIView only
+	/// records where each component lies within the original character
+	/// buffer. Constructing a URIView therefore performs no allocation,
+	/// and components are only copied or decoded when explicitly
+	/// requested. This makes the class suitable for request routing and
+	/// other hot paths that inspect many URIs but rarely need more than
+	/// one component of each.
+	///
+	/// In contrast to the URI class, no normalization is performed:
+	/// the scheme and host are viewed in their original case and
+	/// percent-escapes remain in place until a component is decoded.
+	///
+	/// A URIView does not own the character buffer it refers to; the
+	/// buffer must remain valid and unchanged for the lifetime of the
+	/// view. Use toURI() to obtain a self-contained URI.
+{
+public:
+	typedef std::vector<std::pair<std::string, std::string> > QueryParameters;
+
+	class Foundation_API Part
+		/// A reference to a single component of a URI within the
+		/// original character buffer.
+	{
+	public:
+		Part();
+			/// Creates an empty Part.
+
+		Part(const char* data, std::size_t size);
+			/// Creates the Part for the given character range.
+
+		const char* data() const;
+			/// Returns a pointer to the first character of the
+			/// component. The character sequence is not
+			/// null-terminated.
+
+		std::size_t size() const;
+			/// Returns the length of the component in characters.
+
+		bool empty() const;
+			/// Returns true if the component is empty or absent.
+
+		std::string toString() const;
+			/// Returns a copy of the component, with any
+			/// percent-escapes left in place.
+
+		std::string decoded(bool plusAsSpace = false) const;
+			/// Returns a copy of the component with percent-encoded
+			/// characters replaced by the actual characters.
+			///
+			/// When plusAsSpace is true, non-encoded plus signs are
+			/// decoded as spaces.
+			///
+			/// Throws a URISyntaxException if the component contains
+			/// a malformed percent-escape.
+
+		bool operator == (const std::string& str) const;
+		bool operator == (const char* str) const;
+		bool operator != (const std::string& str) const;
+		bool operator != (const char* str) const;
+			/// Compare the viewed characters byte-wise, without
+			/// decoding percent-escapes.
+
+	private:
+		const char* _data;
+		std::size_t _size;
+	};
+
+	URIView();
+		/// Creates an empty URIView.
+
+	explicit URIView(const std::string& uri);
+		/// Creates a URIView over the given string. The string must
+		/// remain valid and unchanged for the lifetime of the view.
+		///
+		/// Throws a URISyntaxException if the URI is malformed.
+
+	explicit URIView(const char* uri);
+		/// Creates a URIView over the given null-terminated string.
+
+	URIView(const char* uri, std::size_t length);
+		/// Creates a URIView over the given character range.
+
+	Part scheme() const;
+		/// Returns the scheme part of the URI, in its original case.
+
+	Part userInfo() const;
+		/// Returns the user-info part of the URI.
+
+	Part host() const;
+		/// Returns the host part of the URI, in its original case.
+
+	Part port() const;
+		/// Returns the port digits of the URI, which may be empty.
+
+	unsigned short portNumber() const;
+		/// Returns the numeric port number of the URI. If no port
+		/// number is specified, the well-known port number for the
+		/// scheme is returned, if it is known; otherwise, 0 is
+		/// returned.
+		///
+		/// Throws a URISyntaxException if the port is not a valid
+		/// number between 1 and 65535.
+
+	Part authority() const;
+		/// Returns the authority part (user-info, host and port) of
+		/// the URI.
+
+	Part path() const;
+		/// Returns the path part of the URI, with any
+		/// percent-escapes left in place.
+
+	Part query() const;
+		/// Returns the query part of the URI, with any
+		/// percent-escapes left in place.
+
+	Part fragment() const;
+		/// Returns the fragment part of the URI, with any
+		/// percent-escapes left in place.
+
+	Part pathAndQuery() const;
+		/// Returns the path and query parts of the URI, separated by
+		/// a question mark, as they appear in the buffer.
+
+	Part pathEtc() const;
+		/// Returns the path, query and fragment parts of the URI as
+		/// they appear in the buffer.
+
+	QueryParameters getQueryParameters() const;
+		/// Returns the decoded query string parameters as a vector
+		/// of name-value pairs.
+
+	bool empty() const;
+		/// Returns true if the viewed URI is empty.
+
+	URI toURI() const;
+		/// Returns a self-contained URI parsed from the viewed
+		/// character buffer.
+
+private:
+	void parse();
+	void parseAuthority(const char*& it, const char* end);
+	void parsePathEtc(const char*& it, const char* end);
+
+	const char* _begin;
+	std::size_t _length;
+	Part _scheme;
+	Part _userInfo;
+	Part _host;
+	Part _port;
+	Part _authority;
+	Part _path;
+	Part _query;
+	Part _fragment;
+	Part _pathAndQuery;
+	Part _pathEtc;
+};
+
+
+//
+// inlines
+//
+inline URIView::Part::Part():
+	_data(0),
+	_size(0)
+{
+}
+
+
+inline URIView::Part::Part(const char* data, std::size_t size):
+	_data(data),
+	_size(size)
+{
+}
+
+
+inline const char* URIView::Part::data() const
+{
+	return _data;
+}
+
+
+inline std::size_t URIView::Part::size() const
+{
+	return _size;
+}
+
+
+inline bool URIView::Part::empty() const
+{
+	return _size == 0;
+}
+
+
+inline std::string URIView::Part::toString() const
+{
+	return _size ? std::string(_data, _size) : std::string();
+}
+
+
+inline bool URIView::Part::operator == (const std::string& str) const
+{
+	return _size == str.size() && (_size == 0 || std::memcmp(_data, str.data(), _size) == 0);
+}
+
+
+inline bool URIView::Part::operator == (const char* str) const
+{
+	return _size == std::strlen(str) && (_size == 0 || std::memcmp(_data, str, _size) == 0);
+}
+
+
+inline bool URIView::Part::operator != (const std::string& str) const
+{
+	return !(*this == str);
+}
+
+
+inline bool URIView::Part::operator != (const char* str) const
+{
+	return !(*this == str);
+}
+
+
+inline URIView::Part URIView::scheme() const
+{
+	return _scheme;
+}
+
+
+inline URIView::Part URIView::userInfo() const
+{
+	return _userInfo;
+}
+
+
+inline URIView::Part URIView::host() const
+{
+	return _host;
+}
+
+
+inline URIView::Part URIView::port() const
+{
+	return _port;
+}
+
+
+inline URIView::Part URIView::authority() const
+{
+	return _authority;
+}
+
+
+inline URIView::Part URIView::path() const
+{
+	return _path;
+}
+
+
+inline URIView::Part URIView::query() const
+{
+	return _query;
+}
+
+
+inline URIView::Part URIView::fragment() const
+{
+	return _fragment;
+}
+
+
+inline URIView::Part URIView::pathAndQuery() const
+{
+	return _pathAndQuery;
+}
+
+
+inline URIView::Part URIView::pathEtc() const
+{
+	return _pathEtc;
+}
+
+
+inline bool URIView::empty() const
+{
+	return _length == 0;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_URIView_INCLUDED
@@ -38,6 +38,17 @@ public:
 	int convert(int ch, unsigned char* bytes, int length) const;
 	int queryConvert(const unsigned char* bytes, int length) const;
 	int sequenceLength(const unsigned char* bytes, int length) const;
+	int convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar = '?') const;
+
+	static bool isValid(const char* data, std::size_t length);
+		/// Returns true if the given byte range is a valid UTF-8
+		/// encoded string (no overlong forms, surrogates or
+		/// sequences beyond U+10FFFF), false otherwise.
+		///
+		/// Runs of ASCII characters are scanned sixteen bytes per
+		/// iteration where SSE2 is available, so validating mostly-ASCII
+		/// input is considerably faster than iterating the string with
+		/// queryConvert().
 
 	static bool isLegal(const unsigned char *bytes, int length);
 		/// Utility routine to tell whether a sequence of bytes is legal UTF-8.
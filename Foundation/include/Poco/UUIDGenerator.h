@@ -69,7 +69,27 @@ public:
 		
 	UUID createRandom();
 		/// Creates a random UUID.
-		
+
+	void createBulk(UUID* pUUIDs, std::size_t n);
+		/// Creates n new time-based UUIDs and stores them in the
+		/// given array, which must hold at least n elements.
+		///
+		/// The generator's mutex is acquired only once for the
+		/// whole batch, which is considerably faster than calling
+		/// create() n times.
+		///
+		/// Throws a SystemException if no MAC address can be
+		/// obtained.
+
+	void createRandomBulk(UUID* pUUIDs, std::size_t n);
+		/// Creates n random UUIDs and stores them in the given
+		/// array, which must hold at least n elements.
+		///
+		/// The random source is set up only once for the whole
+		/// batch, which is considerably faster than calling
+		/// createRandom() n times.
+
+
 	UUID createOne();
 		/// Tries to create and return a time-based UUID (see create()), and, 
 		/// if that does not work due to the unavailability of a MAC address,
@@ -80,7 +100,16 @@ public:
 
 	static UUIDGenerator& defaultGenerator();
 		/// Returns a reference to the default UUIDGenerator.
-		
+
+	static UUIDGenerator& threadLocalGenerator();
+		/// Returns a reference to a thread-local UUIDGenerator.
+		///
+		/// Unlike defaultGenerator(), which is shared by all
+		/// threads and serializes them on its mutex, every thread
+		/// gets its own generator, so UUIDs can be created without
+		/// contention. Time-based UUIDs created by different
+		/// threads use independent clock sequences.
+
 protected:
 	Timestamp::UtcTimeVal timeStamp();
 	void getNode();
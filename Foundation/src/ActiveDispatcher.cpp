@@ -13,6 +13,7 @@
 
 
 #include "Poco/ActiveDispatcher.h"
+#include "Poco/ActiveExecutor.h"
 #include "Poco/Notification.h"
 #include "Poco/AutoPtr.h"
 
@@ -45,19 +46,30 @@ namespace
 }
 
 
-ActiveDispatcher::ActiveDispatcher()
+ActiveDispatcher::ActiveDispatcher():
+	_pExecutor(0),
+	_scheduled(false)
 {
 	_thread.start(*this);
 }
 
 
-ActiveDispatcher::ActiveDispatcher(Thread::Priority prio)
+ActiveDispatcher::ActiveDispatcher(Thread::Priority prio):
+	_pExecutor(0),
+	_scheduled(false)
 {
 	_thread.setPriority(prio);
 	_thread.start(*this);
 }
 
 
+ActiveDispatcher::ActiveDispatcher(ActiveExecutor& executor):
+	_pExecutor(&executor),
+	_scheduled(false)
+{
+}
+
+
 ActiveDispatcher::~ActiveDispatcher()
 {
 	try
@@ -75,6 +87,15 @@ void ActiveDispatcher::start(ActiveRunnableBase::Ptr pRunnable)
 	poco_check_ptr (pRunnable);
 
 	_queue.enqueueNotification(new MethodNotification(pRunnable));
+	if (_pExecutor)
+	{
+		FastMutex::ScopedLock lock(_stateMutex);
+		if (!_scheduled)
+		{
+			_scheduled = true;
+			_pExecutor->schedule(this);
+		}
+	}
 }
 
 
@@ -101,12 +122,53 @@ void ActiveDispatcher::run()
 }
 
 
+void ActiveDispatcher::drain()
+{
+	AutoPtr<Notification> pNf = _queue.dequeueNotification();
+	while (pNf)
+	{
+		MethodNotification* pMethodNf = dynamic_cast<MethodNotification*>(pNf.get());
+		poco_check_ptr (pMethodNf);
+		ActiveRunnableBase::Ptr pRunnable = pMethodNf->runnable();
+		pRunnable->duplicate(); // run will release
+		pRunnable->run();
+		pRunnable = 0;
+		pNf = 0;
+		pNf = _queue.dequeueNotification();
+	}
+
+	FastMutex::ScopedLock lock(_stateMutex);
+	if (_queue.empty())
+	{
+		_scheduled = false;
+		_unscheduled.broadcast();
+	}
+	else
+	{
+		// a method was enqueued after the queue was drained; go to
+		// the back of the ready queue so other dispatchers are not
+		// starved
+		_pExecutor->schedule(this);
+	}
+}
+
+
 void ActiveDispatcher::stop()
 {
-	_queue.clear();
-	_queue.wakeUpAll();
-	_queue.enqueueNotification(new StopNotification);
-	_thread.join();
+	if (_pExecutor)
+	{
+		_queue.clear();
+		FastMutex::ScopedLock lock(_stateMutex);
+		while (_scheduled)
+			_unscheduled.wait(_stateMutex);
+	}
+	else
+	{
+		_queue.clear();
+		_queue.wakeUpAll();
+		_queue.enqueueNotification(new StopNotification);
+		_thread.join();
+	}
 }
 
 
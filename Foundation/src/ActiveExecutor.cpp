@@ -0,0 +1,130 @@
+//
+// ActiveExecutor.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  ActiveObjects
+//
+// Copyright (c) 2006-2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ActiveExecutor.h"
+#include "Poco/ActiveDispatcher.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Notification.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	class DispatcherNotification: public Notification
+	{
+	public:
+		DispatcherNotification(ActiveDispatcher* pDispatcher):
+			_pDispatcher(pDispatcher)
+		{
+		}
+
+		ActiveDispatcher* dispatcher() const
+		{
+			return _pDispatcher;
+		}
+
+	private:
+		ActiveDispatcher* _pDispatcher;
+	};
+
+	class StopNotification: public Notification
+	{
+	};
+}
+
+
+ActiveExecutor::ActiveExecutor(ThreadPool& pool, int workers):
+	_activeWorkers(0),
+	_stopped(false)
+{
+	if (workers <= 0) workers = pool.available();
+	if (workers <= 0) workers = 1;
+	for (int i = 0; i < workers; i++)
+	{
+		try
+		{
+			{
+				FastMutex::ScopedLock lock(_mutex);
+				++_activeWorkers;
+			}
+			pool.start(*this);
+		}
+		catch (NoThreadAvailableException&)
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			if (--_activeWorkers == 0) throw;
+			break;
+		}
+	}
+}
+
+
+ActiveExecutor::~ActiveExecutor()
+{
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void ActiveExecutor::stop()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_stopped) return;
+	_stopped = true;
+	for (int i = 0; i < _activeWorkers; i++)
+	{
+		_readyQueue.enqueueNotification(new StopNotification);
+	}
+	while (_activeWorkers > 0)
+		_workersDone.wait(_mutex);
+}
+
+
+void ActiveExecutor::schedule(ActiveDispatcher* pDispatcher)
+{
+	poco_check_ptr (pDispatcher);
+
+	_readyQueue.enqueueNotification(new DispatcherNotification(pDispatcher));
+}
+
+
+void ActiveExecutor::run()
+{
+	AutoPtr<Notification> pNf = _readyQueue.waitDequeueNotification();
+	while (pNf && !dynamic_cast<StopNotification*>(pNf.get()))
+	{
+		DispatcherNotification* pDispatcherNf = dynamic_cast<DispatcherNotification*>(pNf.get());
+		poco_check_ptr (pDispatcherNf);
+		pDispatcherNf->dispatcher()->drain();
+		pNf = 0;
+		pNf = _readyQueue.waitDequeueNotification();
+	}
+
+	FastMutex::ScopedLock lock(_mutex);
+	if (--_activeWorkers == 0)
+		_workersDone.broadcast();
+}
+
+
+} // namespace Poco
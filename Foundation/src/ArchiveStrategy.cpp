@@ -19,9 +19,10 @@
 #include "Poco/DeflatingStream.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Exception.h"
-#include "Poco/ActiveDispatcher.h"
-#include "Poco/ActiveMethod.h"
-#include "Poco/Void.h"
+#include "Poco/Notification.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/Thread.h"
+#include "Poco/Mutex.h"
 #include "Poco/FileStream.h"
 
 
@@ -33,21 +34,76 @@ namespace Poco {
 //
 
 
-class ArchiveCompressor: public ActiveDispatcher
+class ArchiveCompressor: public Runnable
+	/// Compresses archived log files on a dedicated low-priority
+	/// thread, so that rotation only has to rename the file and
+	/// the logging thread never waits for the compressor.
 {
 public:
 	ArchiveCompressor():
-		compress(this, &ArchiveCompressor::compressImpl)
+		_thread("ArchiveCompressor")
 	{
 	}
-	
+
 	~ArchiveCompressor()
 	{
+		if (_thread.isRunning())
+		{
+			// plain Notification serves as stop marker; the queue
+			// is drained in order, so pending compressions complete
+			_queue.enqueueNotification(new Notification);
+			_thread.join();
+		}
+	}
+
+	void compress(const std::string& path)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (!_thread.isRunning())
+		{
+			_thread.setPriority(Thread::PRIO_LOWEST);
+			_thread.start(*this);
+		}
+		_queue.enqueueNotification(new ArchiveNotification(path));
+	}
+
+	void run()
+	{
+		for (;;)
+		{
+			AutoPtr<Notification> pNf = _queue.waitDequeueNotification();
+			ArchiveNotification* pANf = dynamic_cast<ArchiveNotification*>(pNf.get());
+			if (!pANf) break;
+			try
+			{
+				compressImpl(pANf->path());
+			}
+			catch (...)
+			{
+				// ignore errors and leave the uncompressed file in place
+			}
+		}
 	}
-	
-	ActiveMethod<void, std::string, ArchiveCompressor, ActiveStarter<ActiveDispatcher> > compress;
 
 protected:
+	class ArchiveNotification: public Notification
+	{
+	public:
+		ArchiveNotification(const std::string& path):
+			_path(path)
+		{
+		}
+
+		const std::string& path() const
+		{
+			return _path;
+		}
+
+	private:
+		std::string _path;
+	};
+
 	void compressImpl(const std::string& path)
 	{
 		std::string gzPath(path);
@@ -75,6 +131,11 @@ protected:
 		f.remove();
 		return;
 	}
+
+private:
+	Thread _thread;
+	NotificationQueue _queue;
+	FastMutex _mutex;
 };
 
 
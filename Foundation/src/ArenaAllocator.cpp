@@ -0,0 +1,127 @@
+//
+// ArenaAllocator.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  ArenaAllocator
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ArenaAllocator.h"
+#include "Poco/Bugcheck.h"
+
+
+namespace Poco {
+
+
+ArenaAllocator::ArenaAllocator(std::size_t chunkSize):
+	_chunkSize(align(chunkSize)),
+	_currentChunk(0),
+	_used(0)
+{
+	poco_assert (chunkSize > 0);
+}
+
+
+ArenaAllocator::~ArenaAllocator()
+{
+	for (ChunkVec::iterator it = _chunks.begin(); it != _chunks.end(); ++it)
+	{
+		delete [] it->data;
+	}
+}
+
+
+void* ArenaAllocator::alloc(std::size_t size)
+{
+	size = align(size);
+	if (_currentChunk < _chunks.size())
+	{
+		Chunk& chunk = _chunks[_currentChunk];
+		if (chunk.size - chunk.offset >= size)
+		{
+			void* ptr = chunk.data + chunk.offset;
+			chunk.offset += size;
+			_used += size;
+			return ptr;
+		}
+	}
+	return allocChunk(size);
+}
+
+
+void ArenaAllocator::reset()
+{
+	for (ChunkVec::iterator it = _chunks.begin(); it != _chunks.end(); ++it)
+	{
+		it->offset = 0;
+	}
+	_currentChunk = 0;
+	_used = 0;
+}
+
+
+void ArenaAllocator::rewind(const Mark& mark)
+{
+	poco_assert (mark.chunk <= _chunks.size());
+
+	for (std::size_t i = mark.chunk; i < _chunks.size(); ++i)
+	{
+		_chunks[i].offset = 0;
+	}
+	if (mark.chunk < _chunks.size())
+		_chunks[mark.chunk].offset = mark.offset;
+	_currentChunk = mark.chunk;
+	_used = mark.used;
+}
+
+
+std::size_t ArenaAllocator::capacity() const
+{
+	std::size_t result = 0;
+	for (ChunkVec::const_iterator it = _chunks.begin(); it != _chunks.end(); ++it)
+	{
+		result += it->size;
+	}
+	return result;
+}
+
+
+void* ArenaAllocator::allocChunk(std::size_t size)
+{
+	if (_currentChunk < _chunks.size())
+		++_currentChunk;
+	while (_currentChunk < _chunks.size() && _chunks[_currentChunk].size < size)
+	{
+		// skip retained chunks too small for the request
+		++_currentChunk;
+	}
+	if (_currentChunk == _chunks.size())
+	{
+		Chunk chunk;
+		chunk.size   = size > _chunkSize ? size : _chunkSize;
+		chunk.offset = 0;
+		chunk.data   = new char[chunk.size];
+		try
+		{
+			_chunks.push_back(chunk);
+		}
+		catch (...)
+		{
+			delete [] chunk.data;
+			throw;
+		}
+	}
+	Chunk& chunk = _chunks[_currentChunk];
+	chunk.offset = size;
+	_used += size;
+	return chunk.data;
+}
+
+
+} // namespace Poco
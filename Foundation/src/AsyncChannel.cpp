@@ -13,42 +13,187 @@
 
 
 #include "Poco/AsyncChannel.h"
-#include "Poco/Notification.h"
 #include "Poco/Message.h"
 #include "Poco/Formatter.h"
-#include "Poco/AutoPtr.h"
 #include "Poco/LoggingRegistry.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
 #include "Poco/Exception.h"
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_ASYNC_CHANNEL_HAVE_ATOMICS
+	#include <atomic>
+#endif
+
 
 namespace Poco {
 
 
-class MessageNotification: public Notification
+class AsyncMessageRing
+	/// A bounded multiple-producer/multiple-consumer message queue.
+	///
+	/// If atomics are available, the queue is a lock-free ring buffer
+	/// (based on the well-known bounded MPMC queue with per-slot
+	/// sequence numbers), so that producers never take a lock on the
+	/// logging fast path. Otherwise, a mutex-protected ring buffer
+	/// with identical semantics is used.
+	///
+	/// The queue must support concurrent tryPop() calls because with
+	/// the drop-oldest overflow policy producers pop the oldest
+	/// message themselves, concurrently with the draining thread.
 {
 public:
-	MessageNotification(const Message& msg):
-		_msg(msg)
+	AsyncMessageRing(std::size_t size)
 	{
+		std::size_t n = 2;
+		while (n < size) n += n;
+		_slots = new Slot[n];
+		_mask = n - 1;
+#if defined(POCO_ASYNC_CHANNEL_HAVE_ATOMICS)
+		for (std::size_t i = 0; i < n; i++)
+			_slots[i].sequence.store(i, std::memory_order_relaxed);
+		_pushPos.store(0, std::memory_order_relaxed);
+		_popPos.store(0, std::memory_order_relaxed);
+#else
+		_pushPos = 0;
+		_popPos  = 0;
+#endif
+	}
+
+	~AsyncMessageRing()
+	{
+		delete [] _slots;
+	}
+
+	bool tryPush(const Message& msg)
+		/// Adds a message to the queue.
+		/// Returns false if the queue is full.
+	{
+#if defined(POCO_ASYNC_CHANNEL_HAVE_ATOMICS)
+		Slot* pSlot;
+		std::size_t pos = _pushPos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pSlot = &_slots[pos & _mask];
+			std::size_t seq = pSlot->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0)
+			{
+				if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = _pushPos.load(std::memory_order_relaxed);
+		}
+		pSlot->message = msg;
+		pSlot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+#else
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (_pushPos - _popPos > _mask) return false;
+		_slots[_pushPos & _mask].message = msg;
+		++_pushPos;
+		return true;
+#endif
 	}
-	
-	~MessageNotification()
+
+	bool tryPop(Message& msg)
+		/// Removes the oldest message from the queue.
+		/// Returns false if the queue is empty.
 	{
+#if defined(POCO_ASYNC_CHANNEL_HAVE_ATOMICS)
+		Slot* pSlot;
+		std::size_t pos = _popPos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pSlot = &_slots[pos & _mask];
+			std::size_t seq = pSlot->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = _popPos.load(std::memory_order_relaxed);
+		}
+		msg.swap(pSlot->message);
+		pSlot->sequence.store(pos + _mask + 1, std::memory_order_release);
+		return true;
+#else
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (_pushPos == _popPos) return false;
+		msg.swap(_slots[_popPos & _mask].message);
+		++_popPos;
+		return true;
+#endif
 	}
-	
-	const Message& message() const
+
+	bool empty() const
+		/// Returns true if the queue appears empty.
 	{
-		return _msg;
+#if defined(POCO_ASYNC_CHANNEL_HAVE_ATOMICS)
+		return _popPos.load(std::memory_order_relaxed) == _pushPos.load(std::memory_order_relaxed);
+#else
+		FastMutex::ScopedLock lock(_mutex);
+
+		return _pushPos == _popPos;
+#endif
 	}
-	
+
 private:
-	Message _msg;
+	AsyncMessageRing();
+	AsyncMessageRing(const AsyncMessageRing&);
+	AsyncMessageRing& operator = (const AsyncMessageRing&);
+
+#if defined(POCO_ASYNC_CHANNEL_HAVE_ATOMICS)
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence;
+		Message message;
+	};
+
+	Slot* _slots;
+	std::size_t _mask;
+	std::atomic<std::size_t> _pushPos;
+	std::atomic<std::size_t> _popPos;
+#else
+	struct Slot
+	{
+		Message message;
+	};
+
+	Slot* _slots;
+	std::size_t _mask;
+	std::size_t _pushPos;
+	std::size_t _popPos;
+	mutable FastMutex _mutex;
+#endif
 };
 
 
-AsyncChannel::AsyncChannel(Channel* pChannel, Thread::Priority prio): 
-	_pChannel(pChannel), 
-	_thread("AsyncChannel")
+namespace
+{
+	enum
+	{
+		DEFAULT_QUEUE_SIZE    = 8192,
+		DEFAULT_SAMPLE_RATE   = 100,
+		MAX_BATCH_SIZE        = 64,  // messages logged per channel mutex acquisition
+		BLOCK_WAIT_TIME       = 10,  // milliseconds a blocked producer waits for space
+		EMPTY_QUEUE_WAIT_TIME = 100  // milliseconds the draining thread waits for messages
+	};
+}
+
+
+AsyncChannel::AsyncChannel(Channel* pChannel, Thread::Priority prio):
+	_pChannel(pChannel),
+	_thread("AsyncChannel"),
+	_pRing(0),
+	_queueSize(DEFAULT_QUEUE_SIZE),
+	_overflowPolicy(OVERFLOW_BLOCK),
+	_sampleRate(DEFAULT_SAMPLE_RATE),
+	_open(false),
+	_stop(false)
 {
 	if (_pChannel) _pChannel->duplicate();
 	_thread.setPriority(prio);
@@ -61,6 +206,7 @@ AsyncChannel::~AsyncChannel()
 	{
 		close();
 		if (_pChannel) _pChannel->release();
+		delete _pRing;
 	}
 	catch (...)
 	{
@@ -72,7 +218,7 @@ AsyncChannel::~AsyncChannel()
 void AsyncChannel::setChannel(Channel* pChannel)
 {
 	FastMutex::ScopedLock lock(_channelMutex);
-	
+
 	if (_pChannel) _pChannel->release();
 	_pChannel = pChannel;
 	if (_pChannel) _pChannel->duplicate();
@@ -89,8 +235,13 @@ void AsyncChannel::open()
 {
 	FastMutex::ScopedLock lock(_threadMutex);
 
+	if (!_pRing) _pRing = new AsyncMessageRing(_queueSize);
 	if (!_thread.isRunning())
+	{
+		_stop = false;
 		_thread.start(*this);
+	}
+	_open = true;
 }
 
 
@@ -98,22 +249,50 @@ void AsyncChannel::close()
 {
 	if (_thread.isRunning())
 	{
-		while (!_queue.empty()) Thread::sleep(100);
-		
-		do 
+		_open = false;
+		_stop = true;
+
+		do
 		{
-			_queue.wakeUpAll(); 
+			_queueReady.set();
 		}
 		while (!_thread.tryJoin(100));
+		_stop = false;
 	}
 }
 
 
 void AsyncChannel::log(const Message& msg)
 {
-	open();
+	if (!_open) open();
 
-	_queue.enqueueNotification(new MessageNotification(msg));
+	bool wasEmpty = _pRing->empty();
+	while (!_pRing->tryPush(msg))
+	{
+		if (_overflowPolicy == OVERFLOW_DROP_OLDEST)
+		{
+			Message oldest;
+			if (_pRing->tryPop(oldest)) ++_dropped;
+		}
+		else if (_overflowPolicy == OVERFLOW_SAMPLE)
+		{
+			if (++_sampleCounter % _sampleRate == 0)
+			{
+				Message oldest;
+				if (_pRing->tryPop(oldest)) ++_dropped;
+			}
+			else
+			{
+				++_dropped;
+				return;
+			}
+		}
+		else
+		{
+			_queueSpace.tryWait(BLOCK_WAIT_TIME);
+		}
+	}
+	if (wasEmpty) _queueReady.set();
 }
 
 
@@ -123,31 +302,75 @@ void AsyncChannel::setProperty(const std::string& name, const std::string& value
 		setChannel(LoggingRegistry::defaultRegistry().channelForName(value));
 	else if (name == "priority")
 		setPriority(value);
+	else if (name == "queueSize")
+		setQueueSize(value);
+	else if (name == "overflowPolicy")
+		setOverflowPolicy(value);
+	else if (name == "sampleRate")
+		setSampleRate(value);
 	else
 		Channel::setProperty(name, value);
 }
 
 
+std::string AsyncChannel::getProperty(const std::string& name) const
+{
+	if (name == "queueSize")
+		return NumberFormatter::format(static_cast<UInt64>(_queueSize));
+	else if (name == "overflowPolicy")
+	{
+		switch (_overflowPolicy)
+		{
+		case OVERFLOW_DROP_OLDEST:
+			return "dropOldest";
+		case OVERFLOW_SAMPLE:
+			return "sample";
+		default:
+			return "block";
+		}
+	}
+	else if (name == "sampleRate")
+		return NumberFormatter::format(_sampleRate);
+	else if (name == "dropped")
+		return NumberFormatter::format(_dropped.value());
+	else
+		return Channel::getProperty(name);
+}
+
+
 void AsyncChannel::run()
 {
-	AutoPtr<Notification> nf = _queue.waitDequeueNotification();
-	while (nf)
+	Message msg;
+	for (;;)
 	{
-		MessageNotification* pNf = dynamic_cast<MessageNotification*>(nf.get());
+		if (_pRing->tryPop(msg))
 		{
 			FastMutex::ScopedLock lock(_channelMutex);
 
-			if (pNf && _pChannel) _pChannel->log(pNf->message());
+			int n = 0;
+			for (;;)
+			{
+				if (_pChannel) _pChannel->log(msg);
+				if (++n == MAX_BATCH_SIZE || !_pRing->tryPop(msg)) break;
+			}
+			_queueSpace.set();
+		}
+		else if (_stop)
+		{
+			break;
+		}
+		else
+		{
+			_queueReady.tryWait(EMPTY_QUEUE_WAIT_TIME);
 		}
-		nf = _queue.waitDequeueNotification();
 	}
 }
-		
-		
+
+
 void AsyncChannel::setPriority(const std::string& value)
 {
 	Thread::Priority prio = Thread::PRIO_NORMAL;
-	
+
 	if (value == "lowest")
 		prio = Thread::PRIO_LOWEST;
 	else if (value == "low")
@@ -160,9 +383,42 @@ void AsyncChannel::setPriority(const std::string& value)
 		prio = Thread::PRIO_HIGHEST;
 	else
 		throw InvalidArgumentException("thread priority", value);
-		
+
 	_thread.setPriority(prio);
 }
 
 
+void AsyncChannel::setQueueSize(const std::string& value)
+{
+	int n = NumberParser::parse(value);
+	if (n <= 0) throw InvalidArgumentException("queueSize", value);
+
+	FastMutex::ScopedLock lock(_threadMutex);
+
+	if (_pRing) throw InvalidAccessException("queueSize cannot be changed once the channel has been opened");
+	_queueSize = static_cast<std::size_t>(n);
+}
+
+
+void AsyncChannel::setOverflowPolicy(const std::string& value)
+{
+	if (value == "block")
+		_overflowPolicy = OVERFLOW_BLOCK;
+	else if (value == "dropOldest")
+		_overflowPolicy = OVERFLOW_DROP_OLDEST;
+	else if (value == "sample")
+		_overflowPolicy = OVERFLOW_SAMPLE;
+	else
+		throw InvalidArgumentException("overflowPolicy", value);
+}
+
+
+void AsyncChannel::setSampleRate(const std::string& value)
+{
+	int n = NumberParser::parse(value);
+	if (n <= 0) throw InvalidArgumentException("sampleRate", value);
+	_sampleRate = n;
+}
+
+
 } // namespace Poco
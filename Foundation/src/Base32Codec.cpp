@@ -0,0 +1,209 @@
+//
+// Base32Codec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base32Codec.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	const unsigned char ENCODING[32] =
+	{
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+		'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+		'Y', 'Z', '2', '3', '4', '5', '6', '7',
+	};
+
+
+	struct DecodingTable
+	{
+		DecodingTable()
+		{
+			std::memset(table, 0xFF, sizeof(table));
+			for (unsigned i = 0; i < 32; i++)
+			{
+				table[ENCODING[i]] = (unsigned char) i;
+			}
+		}
+
+		unsigned char table[256];
+	};
+
+
+	const unsigned char* decodingTable()
+	{
+		static const DecodingTable tables;
+		return tables.table;
+	}
+
+
+	// number of characters a final partial group of
+	// 0 to 4 bytes produces without padding
+	const std::size_t TAIL_LENGTH[5] = { 0, 2, 4, 5, 7 };
+}
+
+
+std::size_t Base32Codec::encodedLength(std::size_t size, bool padding)
+{
+	std::size_t length = size/5*8;
+	std::size_t rem = size%5;
+	if (padding && rem > 0)
+		length += 8;
+	else
+		length += TAIL_LENGTH[rem];
+	return length;
+}
+
+
+std::size_t Base32Codec::encode(const void* data, std::size_t size, char* buffer, bool padding)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	char* dst = buffer;
+
+	while (size >= 5)
+	{
+		*dst++ = ENCODING[src[0] >> 3];
+		*dst++ = ENCODING[((src[0] & 0x07) << 2) | (src[1] >> 6)];
+		*dst++ = ENCODING[(src[1] & 0x3E) >> 1];
+		*dst++ = ENCODING[((src[1] & 0x01) << 4) | (src[2] >> 4)];
+		*dst++ = ENCODING[((src[2] & 0x0F) << 1) | (src[3] >> 7)];
+		*dst++ = ENCODING[(src[3] & 0x7C) >> 2];
+		*dst++ = ENCODING[((src[3] & 0x03) << 3) | (src[4] >> 5)];
+		*dst++ = ENCODING[src[4] & 0x1F];
+		src  += 5;
+		size -= 5;
+	}
+	if (size > 0)
+	{
+		unsigned char group[5] = { 0, 0, 0, 0, 0 };
+		std::memcpy(group, src, size);
+		*dst++ = ENCODING[group[0] >> 3];
+		*dst++ = ENCODING[((group[0] & 0x07) << 2) | (group[1] >> 6)];
+		if (size > 1)
+		{
+			*dst++ = ENCODING[(group[1] & 0x3E) >> 1];
+			*dst++ = ENCODING[((group[1] & 0x01) << 4) | (group[2] >> 4)];
+		}
+		if (size > 2)
+		{
+			*dst++ = ENCODING[((group[2] & 0x0F) << 1) | (group[3] >> 7)];
+		}
+		if (size > 3)
+		{
+			*dst++ = ENCODING[(group[3] & 0x7C) >> 2];
+			*dst++ = ENCODING[(group[3] & 0x03) << 3];
+		}
+		if (padding)
+		{
+			for (std::size_t i = TAIL_LENGTH[size]; i < 8; i++)
+				*dst++ = '=';
+		}
+	}
+	return dst - buffer;
+}
+
+
+std::string Base32Codec::encode(const void* data, std::size_t size, bool padding)
+{
+	std::string result;
+	result.resize(encodedLength(size, padding));
+	if (size > 0)
+	{
+		encode(data, size, &result[0], padding);
+	}
+	return result;
+}
+
+
+std::size_t Base32Codec::maxDecodedLength(std::size_t size)
+{
+	return (size + 7)/8*5;
+}
+
+
+std::size_t Base32Codec::decode(const char* data, std::size_t size, void* buffer)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* table = decodingTable();
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = src + size;
+	unsigned char* dst = reinterpret_cast<unsigned char*>(buffer);
+	unsigned char* out = dst;
+
+	unsigned char group[8];
+	for (;;)
+	{
+		int n = 0;
+		int pad = 0;
+		while (n < 8)
+		{
+			if (src == end) break;
+			unsigned char c = *src++;
+			if (c == '=')
+			{
+				group[n++] = 0;
+				++pad;
+			}
+			else
+			{
+				unsigned char v = table[c];
+				if (v == 0xFF || pad != 0) throw DataFormatException();
+				group[n++] = v;
+			}
+		}
+		if (n == 0) break;
+		if (n < 8)
+		{
+			// incomplete final group; treat missing characters as padding
+			pad += 8 - n;
+			while (n < 8) group[n++] = 0;
+		}
+		// per RFC 4648, Section 6, permissible group lengths are
+		// 2, 4, 5, 7 and 8 data characters
+		if (pad == 2 || pad == 5 || pad > 6) throw DataFormatException();
+		*out++ = (group[0] << 3) | (group[1] >> 2);
+		if (pad < 6) *out++ = ((group[1] & 0x03) << 6) | (group[2] << 1) | (group[3] >> 4);
+		if (pad < 4) *out++ = ((group[3] & 0x0F) << 4) | (group[4] >> 1);
+		if (pad < 3) *out++ = ((group[4] & 0x01) << 7) | (group[5] << 2) | (group[6] >> 3);
+		if (pad < 1) *out++ = ((group[6] & 0x07) << 5) | group[7];
+		if (pad != 0) break;
+	}
+	// nothing may follow the final padded group
+	if (src != end) throw DataFormatException();
+	return out - dst;
+}
+
+
+std::string Base32Codec::decode(const std::string& base32)
+{
+	std::string result;
+	if (base32.empty()) return result;
+	result.resize(maxDecodedLength(base32.size()));
+	std::size_t n = decode(base32.data(), base32.size(), &result[0]);
+	result.resize(n);
+	return result;
+}
+
+
+} // namespace Poco
@@ -61,65 +61,92 @@ Base32DecoderBuf::~Base32DecoderBuf()
 
 int Base32DecoderBuf::readFromDevice()
 {
-	if (_groupIndex < _groupLength) 
-	{
+	if (_groupIndex < _groupLength)
 		return _group[_groupIndex++];
-	}
+	if (!readGroup())
+		return -1;
+	return _group[_groupIndex++];
+}
+
+
+bool Base32DecoderBuf::readGroup()
+{
+	unsigned char buffer[8];
+	std::memset(buffer, '=', sizeof(buffer));
+	int c;
+
+	// per RFC-4648, Section 6, permissible block lengths are:
+	// 2, 4, 5, 7, and 8 bytes. Any other length is malformed.
+	//
+	do {
+		if ((c = readOne()) == -1) return false;
+		buffer[0] = (unsigned char) c;
+		if (IN_ENCODING[buffer[0]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) throw DataFormatException();
+		buffer[1] = (unsigned char) c;
+		if (IN_ENCODING[buffer[1]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) break;
+		buffer[2] = (unsigned char) c;
+		if (IN_ENCODING[buffer[2]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) throw DataFormatException();
+		buffer[3] = (unsigned char) c;
+		if (IN_ENCODING[buffer[3]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) break;
+		buffer[4] = (unsigned char) c;
+		if (IN_ENCODING[buffer[4]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) break;
+		buffer[5] = (unsigned char) c;
+		if (IN_ENCODING[buffer[5]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) throw DataFormatException();
+		buffer[6] = (unsigned char) c;
+		if (IN_ENCODING[buffer[6]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) break;
+		buffer[7] = (unsigned char) c;
+		if (IN_ENCODING[buffer[7]] == 0xFF) throw DataFormatException();
+	} while (false);
+
+	_group[0] = (IN_ENCODING[buffer[0]] << 3) | (IN_ENCODING[buffer[1]] >> 2);
+	_group[1] = ((IN_ENCODING[buffer[1]] & 0x03) << 6) | (IN_ENCODING[buffer[2]] << 1) | (IN_ENCODING[buffer[3]] >> 4);
+	_group[2] = ((IN_ENCODING[buffer[3]] & 0x0F) << 4) | (IN_ENCODING[buffer[4]] >> 1);
+	_group[3] = ((IN_ENCODING[buffer[4]] & 0x01) << 7) | (IN_ENCODING[buffer[5]] << 2) | (IN_ENCODING[buffer[6]] >> 3);
+	_group[4] = ((IN_ENCODING[buffer[6]] & 0x07) << 5) | IN_ENCODING[buffer[7]];
+
+	if (buffer[2] == '=')
+		_groupLength = 1;
+	else if (buffer[4] == '=') 
+		_groupLength = 2;
+	else if (buffer[5] == '=') 
+		_groupLength = 3;
+	else if (buffer[7] == '=') 
+		_groupLength = 4;
 	else
+		_groupLength = 5;
+	_groupIndex = 0;
+	return true;
+}
+
+
+std::streamsize Base32DecoderBuf::xsgetn(char_type* p, std::streamsize count)
+{
+	if (count <= 0) return 0;
+
+	// route the first character through uflow() to honor
+	// a pending putback character
+	int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*p = std::char_traits<char>::to_char_type(c);
+
+	std::streamsize copied = 1;
+	while (copied < count)
 	{
-		unsigned char buffer[8];
-		std::memset(buffer, '=', sizeof(buffer));
-		int c;
-
-		// per RFC-4648, Section 6, permissible block lengths are:
-		// 2, 4, 5, 7, and 8 bytes. Any other length is malformed.
-		//
-		do {
-			if ((c = readOne()) == -1) return -1;
-			buffer[0] = (unsigned char) c;
-			if (IN_ENCODING[buffer[0]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[1] = (unsigned char) c;
-			if (IN_ENCODING[buffer[1]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[2] = (unsigned char) c;
-			if (IN_ENCODING[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[3] = (unsigned char) c;
-			if (IN_ENCODING[buffer[3]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[4] = (unsigned char) c;
-			if (IN_ENCODING[buffer[4]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[5] = (unsigned char) c;
-			if (IN_ENCODING[buffer[5]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[6] = (unsigned char) c;
-			if (IN_ENCODING[buffer[6]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[7] = (unsigned char) c;
-			if (IN_ENCODING[buffer[7]] == 0xFF) throw DataFormatException();
-		} while (false);
-
-		_group[0] = (IN_ENCODING[buffer[0]] << 3) | (IN_ENCODING[buffer[1]] >> 2);
-		_group[1] = ((IN_ENCODING[buffer[1]] & 0x03) << 6) | (IN_ENCODING[buffer[2]] << 1) | (IN_ENCODING[buffer[3]] >> 4);
-		_group[2] = ((IN_ENCODING[buffer[3]] & 0x0F) << 4) | (IN_ENCODING[buffer[4]] >> 1);
-		_group[3] = ((IN_ENCODING[buffer[4]] & 0x01) << 7) | (IN_ENCODING[buffer[5]] << 2) | (IN_ENCODING[buffer[6]] >> 3);
-		_group[4] = ((IN_ENCODING[buffer[6]] & 0x07) << 5) | IN_ENCODING[buffer[7]];
-
-		if (buffer[2] == '=')
-			_groupLength = 1;
-		else if (buffer[4] == '=') 
-			_groupLength = 2;
-		else if (buffer[5] == '=') 
-			_groupLength = 3;
-		else if (buffer[7] == '=') 
-			_groupLength = 4;
-		else
-			_groupLength = 5;
-		_groupIndex = 1;
-		return _group[0];
+		if (_groupIndex >= _groupLength)
+		{
+			if (!readGroup()) break;
+		}
+		while (_groupIndex < _groupLength && copied < count)
+			p[copied++] = (char) _group[_groupIndex++];
 	}
+	return copied;
 }
 
 
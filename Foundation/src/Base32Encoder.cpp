@@ -13,11 +13,18 @@
 
 
 #include "Poco/Base32Encoder.h"
+#include "Poco/Base32Codec.h"
 
 
 namespace Poco {
 
 
+namespace
+{
+	const std::size_t BULK_BUFFER_SIZE = 16384;
+}
+
+
 const unsigned char Base32EncoderBuf::OUT_ENCODING[32] =
 {
 	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
@@ -78,6 +85,35 @@ int Base32EncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize Base32EncoderBuf::xsputn(const char* s, std::streamsize count)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	std::streamsize written = 0;
+	// complete a pending input group first
+	while (_groupLength != 0 && written < count)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	char buffer[BULK_BUFFER_SIZE];
+	while (count - written >= 5)
+	{
+		std::size_t n = static_cast<std::size_t>(count - written)/5*5;
+		if (n > BULK_BUFFER_SIZE/8*5) n = BULK_BUFFER_SIZE/8*5;
+		std::size_t encoded = Base32Codec::encode(s + written, n, buffer);
+		if (_buf.sputn(buffer, static_cast<std::streamsize>(encoded)) != static_cast<std::streamsize>(encoded)) return written;
+		written += static_cast<std::streamsize>(n);
+	}
+	while (written < count)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	return count;
+}
+
+
 int Base32EncoderBuf::close()
 {
 	static const int eof = std::char_traits<char>::eof();
@@ -0,0 +1,290 @@
+//
+// Base64Codec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base64Codec.h"
+#include "Poco/Exception.h"
+#include <cstring>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define POCO_BASE64_HW_SSSE3 1
+	#include <tmmintrin.h>
+	#include <cpuid.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	const unsigned char ENCODING[64] =
+	{
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+		'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+		'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+		'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+		'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+		'w', 'x', 'y', 'z', '0', '1', '2', '3',
+		'4', '5', '6', '7', '8', '9', '+', '/'
+	};
+
+
+	const unsigned char ENCODING_URL[64] =
+	{
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+		'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+		'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+		'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+		'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+		'w', 'x', 'y', 'z', '0', '1', '2', '3',
+		'4', '5', '6', '7', '8', '9', '-', '_'
+	};
+
+
+	struct DecodingTables
+	{
+		DecodingTables()
+		{
+			std::memset(standard, 0xFF, sizeof(standard));
+			std::memset(url, 0xFF, sizeof(url));
+			for (unsigned i = 0; i < 64; i++)
+			{
+				standard[ENCODING[i]] = (unsigned char) i;
+				url[ENCODING_URL[i]] = (unsigned char) i;
+			}
+		}
+
+		unsigned char standard[256];
+		unsigned char url[256];
+	};
+
+
+	const unsigned char* decodingTable(int options)
+	{
+		static const DecodingTables tables;
+		return (options & BASE64_URL_ENCODING) ? tables.url : tables.standard;
+	}
+
+
+#if defined(POCO_BASE64_HW_SSSE3)
+
+
+	__attribute__((target("ssse3")))
+	std::size_t encodeSSSE3(const unsigned char* src, std::size_t size, char* buffer, bool url)
+		/// Encodes whole three-byte groups, twelve input bytes
+		/// (sixteen output characters) per iteration, as long as
+		/// sixteen input bytes can be loaded. Returns the number
+		/// of input bytes consumed.
+	{
+		// see Wojciech Mula, "Base64 encoding with SIMD instructions"
+		const __m128i shuf = _mm_set_epi8(
+			10, 11,  9, 10,
+			 7,  8,  6,  7,
+			 4,  5,  3,  4,
+			 1,  2,  0,  1);
+		// offsets from the 6-bit index to the ASCII alphabet,
+		// selected by the index range (0-25, 26-51, 52-61, 62, 63)
+		const __m128i lut = url ?
+			_mm_setr_epi8('A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 0, 0) :
+			_mm_setr_epi8('A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 0, 0);
+
+		const unsigned char* p = src;
+		char* out = buffer;
+		while (size >= 16)
+		{
+			__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			in = _mm_shuffle_epi8(in, shuf);
+			const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+			const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+			const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+			const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+			const __m128i indices = _mm_or_si128(t1, t3);
+			__m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+			range = _mm_sub_epi8(range, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+			const __m128i result = _mm_add_epi8(indices, _mm_shuffle_epi8(lut, range));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+			p += 12;
+			out += 16;
+			size -= 12;
+		}
+		return p - src;
+	}
+
+
+	bool haveSSSE3()
+	{
+		unsigned eax = 0;
+		unsigned ebx = 0;
+		unsigned ecx = 0;
+		unsigned edx = 0;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+		return (ecx & bit_SSSE3) != 0;
+	}
+
+
+#endif // POCO_BASE64_HW_SSSE3
+}
+
+
+std::size_t Base64Codec::encodedLength(std::size_t size, int options)
+{
+	if (options & BASE64_NO_PADDING)
+		return (size*4 + 2)/3;
+	else
+		return (size + 2)/3*4;
+}
+
+
+std::size_t Base64Codec::encode(const void* data, std::size_t size, char* buffer, int options)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* table = (options & BASE64_URL_ENCODING) ? ENCODING_URL : ENCODING;
+	char* dst = buffer;
+
+#if defined(POCO_BASE64_HW_SSSE3)
+	static const bool haveHW = haveSSSE3();
+	if (haveHW && size >= 16)
+	{
+		std::size_t consumed = encodeSSSE3(src, size, dst, (options & BASE64_URL_ENCODING) != 0);
+		src  += consumed;
+		dst  += consumed/3*4;
+		size -= consumed;
+	}
+#endif
+
+	while (size >= 3)
+	{
+		*dst++ = table[src[0] >> 2];
+		*dst++ = table[((src[0] & 0x03) << 4) | (src[1] >> 4)];
+		*dst++ = table[((src[1] & 0x0F) << 2) | (src[2] >> 6)];
+		*dst++ = table[src[2] & 0x3F];
+		src  += 3;
+		size -= 3;
+	}
+	if (size == 1)
+	{
+		*dst++ = table[src[0] >> 2];
+		*dst++ = table[(src[0] & 0x03) << 4];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*dst++ = '=';
+			*dst++ = '=';
+		}
+	}
+	else if (size == 2)
+	{
+		*dst++ = table[src[0] >> 2];
+		*dst++ = table[((src[0] & 0x03) << 4) | (src[1] >> 4)];
+		*dst++ = table[(src[1] & 0x0F) << 2];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*dst++ = '=';
+		}
+	}
+	return dst - buffer;
+}
+
+
+std::string Base64Codec::encode(const void* data, std::size_t size, int options)
+{
+	std::string result;
+	result.resize(encodedLength(size, options));
+	if (size > 0)
+	{
+		result.resize(encode(data, size, &result[0], options));
+	}
+	return result;
+}
+
+
+std::size_t Base64Codec::maxDecodedLength(std::size_t size)
+{
+	return (size + 3)/4*3;
+}
+
+
+std::size_t Base64Codec::decode(const char* data, std::size_t size, void* buffer, int options)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* table = decodingTable(options);
+	const bool skipWS = !(options & BASE64_URL_ENCODING);
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = src + size;
+	unsigned char* dst = reinterpret_cast<unsigned char*>(buffer);
+	unsigned char* out = dst;
+
+	unsigned char group[4];
+	for (;;)
+	{
+		int n = 0;
+		int pad = 0;
+		while (n < 4)
+		{
+			if (src == end) break;
+			unsigned char c = *src++;
+			if (skipWS && (c == ' ' || c == '\r' || c == '\t' || c == '\n')) continue;
+			if (c == '=')
+			{
+				group[n++] = 0;
+				++pad;
+			}
+			else
+			{
+				unsigned char v = table[c];
+				if (v == 0xFF || pad != 0) throw DataFormatException();
+				group[n++] = v;
+			}
+		}
+		if (n == 0) break;
+		if (n < 4)
+		{
+			// incomplete final group; only valid without padding
+			if (!(options & BASE64_NO_PADDING) || n == 1 || pad != 0) throw DataFormatException();
+			pad = 4 - n;
+			while (n < 4) group[n++] = 0;
+		}
+		if (pad > 2) throw DataFormatException();
+		*out++ = (group[0] << 2) | (group[1] >> 4);
+		if (pad < 2) *out++ = (group[1] << 4) | (group[2] >> 2);
+		if (pad < 1) *out++ = (group[2] << 6) | group[3];
+		if (pad != 0) break;
+	}
+	// only whitespace may follow the final padded group
+	while (src != end)
+	{
+		unsigned char c = *src++;
+		if (!skipWS || (c != ' ' && c != '\r' && c != '\t' && c != '\n')) throw DataFormatException();
+	}
+	return out - dst;
+}
+
+
+std::string Base64Codec::decode(const std::string& base64, int options)
+{
+	std::string result;
+	if (base64.empty()) return result;
+	result.resize(maxDecodedLength(base64.size()));
+	std::size_t n = decode(base64.data(), base64.size(), &result[0], options);
+	result.resize(n);
+	return result;
+}
+
+
+} // namespace Poco
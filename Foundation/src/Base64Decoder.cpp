@@ -84,55 +84,82 @@ Base64DecoderBuf::~Base64DecoderBuf()
 int Base64DecoderBuf::readFromDevice()
 {
 	if (_groupIndex < _groupLength)
-	{
 		return _group[_groupIndex++];
-	}
-	else
+	if (!readGroup())
+		return -1;
+	return _group[_groupIndex++];
+}
+
+
+bool Base64DecoderBuf::readGroup()
+{
+	unsigned char buffer[4];
+	int c;
+	if ((c = readOne()) == -1) return false;
+	buffer[0] = (unsigned char) c;
+	if (_pInEncoding[buffer[0]] == 0xFF) throw DataFormatException();
+	if ((c = readOne()) == -1) return false;
+	buffer[1] = (unsigned char) c;
+	if (_pInEncoding[buffer[1]] == 0xFF) throw DataFormatException();
+	if (_options & BASE64_NO_PADDING)
 	{
-		unsigned char buffer[4];
-		int c;
-		if ((c = readOne()) == -1) return -1;
-		buffer[0] = (unsigned char) c;
-		if (_pInEncoding[buffer[0]] == 0xFF) throw DataFormatException();
-		if ((c = readOne()) == -1) return -1;
-		buffer[1] = (unsigned char) c;
-		if (_pInEncoding[buffer[1]] == 0xFF) throw DataFormatException();
-		if (_options & BASE64_NO_PADDING)
-		{
-			if ((c = readOne()) != -1)
-				buffer[2] = c;
-			else
-				buffer[2] = '=';
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) != -1)
-				buffer[3] = c;
-			else
-				buffer[3] = '=';
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
-		}
-		else
-		{
-			if ((c = readOne()) == -1) throw DataFormatException();
+		if ((c = readOne()) != -1)
 			buffer[2] = c;
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
+		else
+			buffer[2] = '=';
+		if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) != -1)
 			buffer[3] = c;
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
-		}
+		else
+			buffer[3] = '=';
+		if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+	}
+	else
+	{
+		if ((c = readOne()) == -1) throw DataFormatException();
+		buffer[2] = c;
+		if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
+		if ((c = readOne()) == -1) throw DataFormatException();
+		buffer[3] = c;
+		if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+	}
 
-		_group[0] = (_pInEncoding[buffer[0]] << 2) | (_pInEncoding[buffer[1]] >> 4);
-		_group[1] = ((_pInEncoding[buffer[1]] & 0x0F) << 4) | (_pInEncoding[buffer[2]] >> 2);
-		_group[2] = (_pInEncoding[buffer[2]] << 6) | _pInEncoding[buffer[3]];
+	_group[0] = (_pInEncoding[buffer[0]] << 2) | (_pInEncoding[buffer[1]] >> 4);
+	_group[1] = ((_pInEncoding[buffer[1]] & 0x0F) << 4) | (_pInEncoding[buffer[2]] >> 2);
+	_group[2] = (_pInEncoding[buffer[2]] << 6) | _pInEncoding[buffer[3]];
 
-		if (buffer[2] == '=')
-			_groupLength = 1;
-		else if (buffer[3] == '=')
-			_groupLength = 2;
-		else
-			_groupLength = 3;
-		_groupIndex = 1;
-		return _group[0];
+	if (buffer[2] == '=')
+		_groupLength = 1;
+	else if (buffer[3] == '=')
+		_groupLength = 2;
+	else
+		_groupLength = 3;
+	_groupIndex = 0;
+	return true;
+}
+
+
+std::streamsize Base64DecoderBuf::xsgetn(char_type* p, std::streamsize count)
+{
+	if (count <= 0) return 0;
+
+	// route the first character through uflow() to honor
+	// a pending putback character
+	int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*p = std::char_traits<char>::to_char_type(c);
+
+	std::streamsize copied = 1;
+	while (copied < count)
+	{
+		if (_groupIndex >= _groupLength)
+		{
+			if (!readGroup()) break;
+		}
+		while (_groupIndex < _groupLength && copied < count)
+			p[copied++] = (char) _group[_groupIndex++];
 	}
+	return copied;
 }
 
 
@@ -13,11 +13,18 @@
 
 
 #include "Poco/Base64Encoder.h"
+#include "Poco/Base64Codec.h"
 
 
 namespace Poco {
 
 
+namespace
+{
+	const std::size_t BULK_BUFFER_SIZE = 16384;
+}
+
+
 const unsigned char Base64EncoderBuf::OUT_ENCODING[64] =
 {
 	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
@@ -108,6 +115,49 @@ int Base64EncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize Base64EncoderBuf::xsputn(const char* s, std::streamsize count)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	std::streamsize written = 0;
+	// complete a pending input group first
+	while (_groupLength != 0 && written < count)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	char buffer[BULK_BUFFER_SIZE];
+	while (count - written >= 3)
+	{
+		std::size_t n = static_cast<std::size_t>(count - written)/3*3;
+		if (n > BULK_BUFFER_SIZE/4*3) n = BULK_BUFFER_SIZE/4*3;
+		if (_lineLength > 0)
+		{
+			// encode only up to the next line break
+			std::size_t lineBytes = static_cast<std::size_t>(_lineLength - _pos)/4*3;
+			if (n > lineBytes) n = lineBytes;
+			if (n == 0) break;
+		}
+		std::size_t encoded = Base64Codec::encode(s + written, n, buffer, _options);
+		if (_buf.sputn(buffer, static_cast<std::streamsize>(encoded)) != static_cast<std::streamsize>(encoded)) return written;
+		written += static_cast<std::streamsize>(n);
+		_pos += static_cast<int>(encoded);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			if (_buf.sputc('\r') == eof) return written;
+			if (_buf.sputc('\n') == eof) return written;
+			_pos = 0;
+		}
+	}
+	while (written < count)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	return count;
+}
+
+
 int Base64EncoderBuf::close()
 {
 	static const int eof = std::char_traits<char>::eof();
@@ -0,0 +1,198 @@
+//
+// BinaryLogChannel.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryLogChannel
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/BinaryLogChannel.h"
+#include "Poco/BinaryWriter.h"
+#include "Poco/FileStream.h"
+#include "Poco/Message.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+const std::string BinaryLogChannel::PROP_PATH  = "path";
+const std::string BinaryLogChannel::PROP_FLUSH = "flush";
+
+
+BinaryLogChannel::BinaryLogChannel():
+	_flush(true),
+	_pStream(0),
+	_pWriter(0),
+	_lastTime(0)
+{
+}
+
+
+BinaryLogChannel::BinaryLogChannel(const std::string& path):
+	_path(path),
+	_flush(true),
+	_pStream(0),
+	_pWriter(0),
+	_lastTime(0)
+{
+}
+
+
+BinaryLogChannel::~BinaryLogChannel()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void BinaryLogChannel::open()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_pStream) openFile();
+}
+
+
+void BinaryLogChannel::close()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	delete _pWriter;
+	delete _pStream;
+	_pWriter = 0;
+	_pStream = 0;
+}
+
+
+void BinaryLogChannel::log(const Message& msg)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_pStream) openFile();
+
+	_recordStream.str(std::string());
+	BinaryWriter record(_recordStream);
+
+	Timestamp::TimeVal time = msg.getTime().epochMicroseconds();
+	record << Int64(time - _lastTime);
+	record << UInt8(msg.getPriority());
+
+	bool isNew = false;
+	UInt32 id = intern(_sourceIds, msg.getSource(), isNew);
+	record.write7BitEncoded(id);
+	if (isNew) record << msg.getSource();
+
+	record << msg.getText();
+
+	id = intern(_threadIds, msg.getThread(), isNew);
+	record.write7BitEncoded(id);
+	if (isNew) record << msg.getThread();
+
+	record.write7BitEncoded(UInt64(msg.getTid()));
+	record.write7BitEncoded(UInt64(msg.getPid()));
+
+	std::string file(msg.getSourceFile() ? msg.getSourceFile() : "");
+	id = intern(_fileIds, file, isNew);
+	record.write7BitEncoded(id);
+	if (isNew) record << file;
+	record.write7BitEncoded(UInt32(msg.getSourceLine()));
+
+	const Message::StringMap& params = msg.getParameters();
+	record.write7BitEncoded(UInt32(params.size()));
+	for (Message::StringMap::const_iterator it = params.begin(); it != params.end(); ++it)
+	{
+		record << it->first << it->second;
+	}
+
+	const std::string& data = _recordStream.str();
+	_pWriter->write7BitEncoded(UInt32(data.size()));
+	_pWriter->writeRaw(data);
+	if (_flush) _pWriter->flush();
+	if (!_pStream->good()) throw WriteFileException(_path);
+
+	_lastTime = time;
+}
+
+
+void BinaryLogChannel::setProperty(const std::string& name, const std::string& value)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (name == PROP_PATH)
+		_path = value;
+	else if (name == PROP_FLUSH)
+		setFlush(value);
+	else
+		Channel::setProperty(name, value);
+}
+
+
+std::string BinaryLogChannel::getProperty(const std::string& name) const
+{
+	if (name == PROP_PATH)
+		return _path;
+	else if (name == PROP_FLUSH)
+		return std::string(_flush ? "true" : "false");
+	else
+		return Channel::getProperty(name);
+}
+
+
+void BinaryLogChannel::openFile()
+{
+	if (_path.empty()) throw PropertyNotSupportedException("Property path must be specified");
+
+	_pStream = new FileOutputStream(_path, std::ios::out | std::ios::app | std::ios::binary);
+	_pWriter = new BinaryWriter(*_pStream);
+	_sourceIds.clear();
+	_threadIds.clear();
+	_fileIds.clear();
+	_lastTime = 0;
+	// Each section starts with a zero length prefix, followed by a
+	// byte order mark and the format magic. A reader resets its
+	// interning tables and time base whenever it sees a section
+	// header, so appending to an existing file is safe.
+	_pWriter->write7BitEncoded(UInt32(0));
+	_pWriter->writeBOM();
+	_pWriter->writeRaw("PBL1", 4);
+}
+
+
+void BinaryLogChannel::setFlush(const std::string& flush)
+{
+	_flush = (flush == "true");
+}
+
+
+UInt32 BinaryLogChannel::intern(StringIdMap& map, const std::string& value, bool& isNew)
+{
+	StringIdMap::iterator it = map.find(value);
+	if (it != map.end())
+	{
+		isNew = false;
+		return it->second;
+	}
+	else
+	{
+		UInt32 id = static_cast<UInt32>(map.size());
+		map[value] = id;
+		isNew = true;
+		return id;
+	}
+}
+
+
+} // namespace Poco
@@ -0,0 +1,123 @@
+//
+// BinaryLogReader.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  BinaryLogReader
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/BinaryLogReader.h"
+#include "Poco/Message.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+BinaryLogReader::BinaryLogReader(std::istream& istr):
+	_reader(istr),
+	_lastTime(0)
+{
+}
+
+
+BinaryLogReader::~BinaryLogReader()
+{
+}
+
+
+bool BinaryLogReader::next(Message& msg)
+{
+	UInt32 length;
+	for (;;)
+	{
+		_reader.read7BitEncoded(length);
+		if (!_reader.good()) return false;
+		if (length != 0) break;
+
+		// section header: byte order mark and format magic
+		_reader.readBOM();
+		char magic[4];
+		_reader.readRaw(magic, 4);
+		if (!_reader.good() || std::memcmp(magic, "PBL1", 4) != 0)
+			throw DataFormatException("not a binary log file");
+		_sources.clear();
+		_threads.clear();
+		_files.clear();
+		_lastTime = 0;
+	}
+
+	Int64 timeDelta;
+	UInt8 prio;
+	_reader >> timeDelta >> prio;
+	if (!_reader.good() || prio < Message::PRIO_FATAL || prio > Message::PRIO_TRACE)
+		throw DataFormatException("corrupted binary log record");
+	_lastTime += timeDelta;
+
+	Message decoded;
+	decoded.setTime(Timestamp(_lastTime));
+	decoded.setPriority(static_cast<Message::Priority>(prio));
+	decoded.setSource(resolve(_sources));
+
+	std::string text;
+	_reader >> text;
+	decoded.setText(text);
+
+	decoded.setThread(resolve(_threads));
+
+	UInt64 tid;
+	UInt64 pid;
+	_reader.read7BitEncoded(tid);
+	_reader.read7BitEncoded(pid);
+	decoded.setTid(static_cast<long>(tid));
+	decoded.setPid(static_cast<long>(pid));
+
+	const std::string& file = resolve(_files);
+	decoded.setSourceFile(file.empty() ? 0 : file.c_str());
+	UInt32 line;
+	_reader.read7BitEncoded(line);
+	decoded.setSourceLine(static_cast<int>(line));
+
+	UInt32 paramCount;
+	_reader.read7BitEncoded(paramCount);
+	if (!_reader.good()) throw DataFormatException("corrupted binary log record");
+	std::string param;
+	std::string value;
+	for (UInt32 i = 0; i < paramCount; i++)
+	{
+		_reader >> param >> value;
+		decoded.set(param, value);
+	}
+	if (!_reader.good()) throw DataFormatException("corrupted binary log record");
+
+	msg.swap(decoded);
+	return true;
+}
+
+
+const std::string& BinaryLogReader::resolve(StringTable& table)
+{
+	UInt32 id;
+	_reader.read7BitEncoded(id);
+	if (id == table.size())
+	{
+		std::string value;
+		_reader >> value;
+		table.push_back(value);
+	}
+	else if (id > table.size())
+	{
+		throw DataFormatException("corrupted binary log record");
+	}
+	return table[id];
+}
+
+
+} // namespace Poco
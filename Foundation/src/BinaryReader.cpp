@@ -257,6 +257,73 @@ void BinaryReader::read7BitEncoded(UInt64& value)
 #endif
 
 
+void BinaryReader::readZigZagEncoded(Int32& value)
+{
+	UInt32 encoded;
+	read7BitEncoded(encoded);
+	value = static_cast<Int32>(encoded >> 1) ^ -static_cast<Int32>(encoded & 1);
+}
+
+
+#if defined(POCO_HAVE_INT64)
+
+
+void BinaryReader::readZigZagEncoded(Int64& value)
+{
+	UInt64 encoded;
+	read7BitEncoded(encoded);
+	value = static_cast<Int64>(encoded >> 1) ^ -static_cast<Int64>(encoded & 1);
+}
+
+
+#endif
+
+
+void BinaryReader::readArrayImpl(char* data, std::size_t count, std::size_t width)
+{
+	if (count == 0) return;
+
+	_istr.read(data, static_cast<std::streamsize>(count*width));
+	if (_flipBytes && width > 1)
+	{
+		std::size_t n = static_cast<std::size_t>(_istr.gcount())/width;
+		switch (width)
+		{
+		case 2:
+			{
+				UInt16* values = reinterpret_cast<UInt16*>(data);
+				for (std::size_t i = 0; i < n; ++i)
+					values[i] = ByteOrder::flipBytes(values[i]);
+			}
+			break;
+		case 4:
+			{
+				UInt32* values = reinterpret_cast<UInt32*>(data);
+				for (std::size_t i = 0; i < n; ++i)
+					values[i] = ByteOrder::flipBytes(values[i]);
+			}
+			break;
+#if defined(POCO_HAVE_INT64)
+		case 8:
+			{
+				UInt64* values = reinterpret_cast<UInt64*>(data);
+				for (std::size_t i = 0; i < n; ++i)
+					values[i] = ByteOrder::flipBytes(values[i]);
+			}
+			break;
+#endif
+		default:
+			{
+				for (std::size_t i = 0; i < n; ++i)
+					for (std::size_t j = 0; j < width/2; ++j)
+						std::swap(data[i*width + j], data[i*width + width - 1 - j]);
+			}
+			break;
+		}
+	}
+}
+
+
 void BinaryReader::readRaw(std::streamsize length, std::string& value)
 {
 	value.clear();
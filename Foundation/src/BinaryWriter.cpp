@@ -16,6 +16,7 @@
 #include "Poco/ByteOrder.h"
 #include "Poco/TextEncoding.h"
 #include "Poco/TextConverter.h"
+#include <algorithm>
 #include <cstring>
 
 
@@ -322,6 +323,88 @@ void BinaryWriter::write7BitEncoded(UInt64 value)
 #endif
 
 
+void BinaryWriter::writeZigZagEncoded(Int32 value)
+{
+	write7BitEncoded((static_cast<UInt32>(value) << 1) ^ static_cast<UInt32>(value >> 31));
+}
+
+
+#if defined(POCO_HAVE_INT64)
+
+
+void BinaryWriter::writeZigZagEncoded(Int64 value)
+{
+	write7BitEncoded((static_cast<UInt64>(value) << 1) ^ static_cast<UInt64>(value >> 63));
+}
+
+
+#endif
+
+
+void BinaryWriter::writeArrayImpl(const char* data, std::size_t count, std::size_t width)
+{
+	if (count == 0) return;
+
+	if (_flipBytes && width > 1)
+	{
+#if defined(POCO_HAVE_INT64)
+		UInt64 chunk[1024];
+#else
+		UInt32 chunk[2048];
+#endif
+		const std::size_t chunkElems = sizeof(chunk)/width;
+		while (count > 0)
+		{
+			std::size_t n = std::min(count, chunkElems);
+			switch (width)
+			{
+			case 2:
+				{
+					const UInt16* src = reinterpret_cast<const UInt16*>(data);
+					UInt16* dst = reinterpret_cast<UInt16*>(chunk);
+					for (std::size_t i = 0; i < n; ++i)
+						dst[i] = ByteOrder::flipBytes(src[i]);
+				}
+				break;
+			case 4:
+				{
+					const UInt32* src = reinterpret_cast<const UInt32*>(data);
+					UInt32* dst = reinterpret_cast<UInt32*>(chunk);
+					for (std::size_t i = 0; i < n; ++i)
+						dst[i] = ByteOrder::flipBytes(src[i]);
+				}
+				break;
+#if defined(POCO_HAVE_INT64)
+			case 8:
+				{
+					const UInt64* src = reinterpret_cast<const UInt64*>(data);
+					UInt64* dst = chunk;
+					for (std::size_t i = 0; i < n; ++i)
+						dst[i] = ByteOrder::flipBytes(src[i]);
+				}
+				break;
+#endif
+			default:
+				{
+					char* dst = reinterpret_cast<char*>(chunk);
+					for (std::size_t i = 0; i < n; ++i)
+						for (std::size_t j = 0; j < width; ++j)
+							dst[i*width + j] = data[i*width + width - 1 - j];
+				}
+				break;
+			}
+			_ostr.write(reinterpret_cast<const char*>(chunk), static_cast<std::streamsize>(n*width));
+			data  += n*width;
+			count -= n;
+		}
+	}
+	else
+	{
+		_ostr.write(data, static_cast<std::streamsize>(count*width));
+	}
+}
+
+
 void BinaryWriter::writeRaw(const std::string& rawData)
 {
 	_ostr.write(rawData.data(), (std::streamsize) rawData.length());
@@ -18,11 +18,177 @@
 #else
 #include "Poco/zlib.h"
 #endif
+#include <cstring>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define POCO_CHECKSUM_HW_CRC32C 1
+#include <cpuid.h>
+#include <nmmintrin.h>
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+	const UInt32 CRC32C_POLY = 0x82F63B78; // Castagnoli polynomial, reflected
+
+
+	class CRC32CTable
+	{
+	public:
+		CRC32CTable()
+		{
+			for (UInt32 n = 0; n < 256; ++n)
+			{
+				UInt32 crc = n;
+				for (int k = 0; k < 8; ++k)
+				{
+					crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+				}
+				_table[n] = crc;
+			}
+		}
+
+		UInt32 operator [] (UInt32 index) const
+		{
+			return _table[index];
+		}
+
+	private:
+		UInt32 _table[256];
+	};
+
+
+	UInt32 crc32cSW(UInt32 crc, const unsigned char* data, unsigned length)
+	{
+		static CRC32CTable table;
+
+		crc = ~crc;
+		while (length--)
+		{
+			crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+		}
+		return ~crc;
+	}
+
+
+#if defined(POCO_CHECKSUM_HW_CRC32C)
+	__attribute__((target("sse4.2")))
+	UInt32 crc32cHW(UInt32 crc, const unsigned char* data, unsigned length)
+	{
+		crc = ~crc;
+#if defined(__x86_64__)
+		while (length >= 8)
+		{
+			UInt64 chunk;
+			std::memcpy(&chunk, data, sizeof(chunk));
+			crc = static_cast<UInt32>(_mm_crc32_u64(crc, chunk));
+			data += 8;
+			length -= 8;
+		}
+#endif
+		while (length >= 4)
+		{
+			UInt32 chunk;
+			std::memcpy(&chunk, data, sizeof(chunk));
+			crc = _mm_crc32_u32(crc, chunk);
+			data += 4;
+			length -= 4;
+		}
+		while (length--)
+		{
+			crc = _mm_crc32_u8(crc, *data++);
+		}
+		return ~crc;
+	}
+
+
+	bool haveHWCRC32C()
+	{
+		unsigned int eax, ebx, ecx, edx;
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+			return (ecx & bit_SSE4_2) != 0;
+		return false;
+	}
+#endif // POCO_CHECKSUM_HW_CRC32C
+
+
+	UInt32 crc32c(UInt32 crc, const unsigned char* data, unsigned length)
+	{
+#if defined(POCO_CHECKSUM_HW_CRC32C)
+		static const bool haveHW = haveHWCRC32C();
+		if (haveHW) return crc32cHW(crc, data, length);
+#endif
+		return crc32cSW(crc, data, length);
+	}
+
+
+	//
+	// CRC combination over GF(2), following the approach of
+	// zlib's crc32_combine(), but with the Castagnoli polynomial.
+	//
+	UInt32 gf2MatrixTimes(const UInt32* mat, UInt32 vec)
+	{
+		UInt32 sum = 0;
+		while (vec)
+		{
+			if (vec & 1) sum ^= *mat;
+			vec >>= 1;
+			++mat;
+		}
+		return sum;
+	}
+
+
+	void gf2MatrixSquare(UInt32* square, const UInt32* mat)
+	{
+		for (int n = 0; n < 32; ++n)
+		{
+			square[n] = gf2MatrixTimes(mat, mat[n]);
+		}
+	}
+
+
+	UInt32 crc32cCombine(UInt32 crc1, UInt32 crc2, UInt32 len2)
+	{
+		UInt32 even[32]; // even-power-of-two zeros operator
+		UInt32 odd[32];  // odd-power-of-two zeros operator
+
+		if (len2 == 0) return crc1;
+
+		// put operator for one zero bit in odd
+		odd[0] = CRC32C_POLY;
+		UInt32 row = 1;
+		for (int n = 1; n < 32; ++n)
+		{
+			odd[n] = row;
+			row <<= 1;
+		}
+
+		// put operator for two zero bits in even, four zero bits in odd
+		gf2MatrixSquare(even, odd);
+		gf2MatrixSquare(odd, even);
+
+		// apply len2 zeros to crc1 (appending len2 zero bytes to
+		// the data to which crc1 corresponds)
+		do
+		{
+			gf2MatrixSquare(even, odd);
+			if (len2 & 1) crc1 = gf2MatrixTimes(even, crc1);
+			len2 >>= 1;
+			if (len2 == 0) break;
+			gf2MatrixSquare(odd, even);
+			if (len2 & 1) crc1 = gf2MatrixTimes(odd, crc1);
+			len2 >>= 1;
+		}
+		while (len2 != 0);
+
+		return crc1 ^ crc2;
+	}
+}
+
+
 Checksum::Checksum():
 	_type(TYPE_CRC32),
 	_value(crc32(0L, Z_NULL, 0))
@@ -36,7 +202,7 @@ Checksum::Checksum(Type t):
 {
 	if (t == TYPE_CRC32)
 		_value = crc32(0L, Z_NULL, 0);
-	else
+	else if (t == TYPE_ADLER32)
 		_value = adler32(0L, Z_NULL, 0);
 }
 
@@ -50,8 +216,23 @@ void Checksum::update(const char* data, unsigned length)
 {
 	if (_type == TYPE_ADLER32)
 		_value = adler32(_value, reinterpret_cast<const Bytef*>(data), length);
-	else
+	else if (_type == TYPE_CRC32)
 		_value = crc32(_value, reinterpret_cast<const Bytef*>(data), length);
+	else
+		_value = crc32c(_value, reinterpret_cast<const unsigned char*>(data), length);
+}
+
+
+void Checksum::combine(Poco::UInt32 checksum, Poco::UInt32 length)
+{
+	if (length == 0) return;
+
+	if (_type == TYPE_ADLER32)
+		_value = static_cast<Poco::UInt32>(adler32_combine(_value, checksum, length));
+	else if (_type == TYPE_CRC32)
+		_value = static_cast<Poco::UInt32>(crc32_combine(_value, checksum, length));
+	else
+		_value = crc32cCombine(_value, checksum, length);
 }
 
 
@@ -0,0 +1,180 @@
+//
+// CompiledDateTimeFormat.cpp
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  CompiledDateTimeFormat
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CompiledDateTimeFormat.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+
+
+namespace Poco {
+
+
+CompiledDateTimeFormat::CompiledDateTimeFormat(const std::string& fmt):
+	_pattern(fmt),
+	_subSecond(false),
+	_cacheSecond(-1),
+	_cacheTZD(0)
+{
+	compile();
+}
+
+
+CompiledDateTimeFormat::CompiledDateTimeFormat(const CompiledDateTimeFormat& other):
+	_pattern(other._pattern),
+	_ops(other._ops),
+	_subSecond(other._subSecond),
+	_cacheSecond(-1),
+	_cacheTZD(0)
+{
+}
+
+
+CompiledDateTimeFormat::~CompiledDateTimeFormat()
+{
+}
+
+
+CompiledDateTimeFormat& CompiledDateTimeFormat::operator = (const CompiledDateTimeFormat& other)
+{
+	if (&other != this)
+	{
+		_pattern     = other._pattern;
+		_ops         = other._ops;
+		_subSecond   = other._subSecond;
+		_cacheSecond = -1;
+		_cached.clear();
+	}
+	return *this;
+}
+
+
+void CompiledDateTimeFormat::compile()
+{
+	static const std::string SPECIFIERS("wWbBdefmnoyYHhaAMSsicFzZ");
+
+	Op literal;
+	std::string::const_iterator it  = _pattern.begin();
+	std::string::const_iterator end = _pattern.end();
+	while (it != end)
+	{
+		if (*it == '%')
+		{
+			if (++it != end)
+			{
+				if (SPECIFIERS.find(*it) != std::string::npos)
+				{
+					if (!literal.text.empty())
+					{
+						_ops.push_back(literal);
+						literal.text.clear();
+					}
+					Op op;
+					op.spec = *it;
+					_ops.push_back(op);
+					if (*it == 's' || *it == 'i' || *it == 'c' || *it == 'F')
+						_subSecond = true;
+				}
+				else literal.text += *it;
+				++it;
+			}
+		}
+		else literal.text += *it++;
+	}
+	if (!literal.text.empty())
+	{
+		_ops.push_back(literal);
+	}
+}
+
+
+void CompiledDateTimeFormat::append(std::string& str, const DateTime& dateTime, int timeZoneDifferential) const
+{
+	for (std::vector<Op>::const_iterator ip = _ops.begin(); ip != _ops.end(); ++ip)
+	{
+		switch (ip->spec)
+		{
+		case 0:   str.append(ip->text); break;
+		case 'w': str.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
+		case 'W': str.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()]); break;
+		case 'b': str.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
+		case 'B': str.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1]); break;
+		case 'd': NumberFormatter::append0(str, dateTime.day(), 2); break;
+		case 'e': NumberFormatter::append(str, dateTime.day()); break;
+		case 'f': NumberFormatter::append(str, dateTime.day(), 2); break;
+		case 'm': NumberFormatter::append0(str, dateTime.month(), 2); break;
+		case 'n': NumberFormatter::append(str, dateTime.month()); break;
+		case 'o': NumberFormatter::append(str, dateTime.month(), 2); break;
+		case 'y': NumberFormatter::append0(str, dateTime.year() % 100, 2); break;
+		case 'Y': NumberFormatter::append0(str, dateTime.year(), 4); break;
+		case 'H': NumberFormatter::append0(str, dateTime.hour(), 2); break;
+		case 'h': NumberFormatter::append0(str, dateTime.hourAMPM(), 2); break;
+		case 'a': str.append(dateTime.isAM() ? "am" : "pm"); break;
+		case 'A': str.append(dateTime.isAM() ? "AM" : "PM"); break;
+		case 'M': NumberFormatter::append0(str, dateTime.minute(), 2); break;
+		case 'S': NumberFormatter::append0(str, dateTime.second(), 2); break;
+		case 's': NumberFormatter::append0(str, dateTime.second(), 2);
+		          str += '.';
+		          NumberFormatter::append0(str, dateTime.millisecond()*1000 + dateTime.microsecond(), 6);
+		          break;
+		case 'i': NumberFormatter::append0(str, dateTime.millisecond(), 3); break;
+		case 'c': NumberFormatter::append(str, dateTime.millisecond()/100); break;
+		case 'F': NumberFormatter::append0(str, dateTime.millisecond()*1000 + dateTime.microsecond(), 6); break;
+		case 'z': DateTimeFormatter::tzdISO(str, timeZoneDifferential); break;
+		case 'Z': DateTimeFormatter::tzdRFC(str, timeZoneDifferential); break;
+		}
+	}
+}
+
+
+void CompiledDateTimeFormat::append(std::string& str, const Timestamp& timestamp, int timeZoneDifferential) const
+{
+	if (_subSecond)
+	{
+		DateTime dateTime(timestamp);
+		append(str, dateTime, timeZoneDifferential);
+	}
+	else
+	{
+		std::time_t second = timestamp.epochTime();
+		FastMutex::ScopedLock lock(_mutex);
+		if (second != _cacheSecond || timeZoneDifferential != _cacheTZD)
+		{
+			_cached.clear();
+			DateTime dateTime(timestamp);
+			append(_cached, dateTime, timeZoneDifferential);
+			_cacheSecond = second;
+			_cacheTZD    = timeZoneDifferential;
+		}
+		str.append(_cached);
+	}
+}
+
+
+std::string CompiledDateTimeFormat::format(const DateTime& dateTime, int timeZoneDifferential) const
+{
+	std::string result;
+	append(result, dateTime, timeZoneDifferential);
+	return result;
+}
+
+
+std::string CompiledDateTimeFormat::format(const Timestamp& timestamp, int timeZoneDifferential) const
+{
+	std::string result;
+	append(result, timestamp, timeZoneDifferential);
+	return result;
+}
+
+
+} // namespace Poco
@@ -0,0 +1,228 @@
+//
+// CompiledGlob.cpp
+//
+// Library: Foundation
+// Package: Filesystem
+// Module:  CompiledGlob
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CompiledGlob.h"
+#include "Poco/Exception.h"
+#include "Poco/UTF8Encoding.h"
+#include "Poco/Unicode.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	int nextChar(const UTF8Encoding& encoding, const unsigned char*& it, const unsigned char* end)
+		/// Decodes the code point at it and advances it past it.
+		/// Like TextIterator, returns -1 for a malformed sequence,
+		/// advancing by a single byte.
+	{
+		if (*it < 0x80) return *it++;
+		int n = encoding.sequenceLength(it, static_cast<int>(end - it));
+		if (n <= 0 || it + n > end)
+		{
+			++it;
+			return -1;
+		}
+		int cc = encoding.queryConvert(it, n);
+		it += n;
+		return cc >= 0 ? cc : -1;
+	}
+}
+
+
+CompiledGlob::CompiledGlob(const std::string& pattern, int options):
+	_pattern(pattern),
+	_options(options),
+	_dotSpecial(false)
+{
+	compile();
+}
+
+
+CompiledGlob::~CompiledGlob()
+{
+}
+
+
+bool CompiledGlob::match(const char* subject, std::size_t length) const
+{
+	UTF8Encoding utf8;
+	const unsigned char* it  = reinterpret_cast<const unsigned char*>(subject);
+	const unsigned char* end = it + length;
+
+	if (_dotSpecial && it != end && *it == '.')
+		return false;
+
+	std::size_t tok = 0;
+	std::size_t nTokens = _tokens.size();
+	const unsigned char* starIt = 0;
+	std::size_t starTok = 0;
+
+	while (it != end)
+	{
+		if (tok < nTokens)
+		{
+			const Token& token = _tokens[tok];
+			if (token.type == TOK_STAR)
+			{
+				starTok = tok++;
+				starIt  = it;
+				continue;
+			}
+			const unsigned char* next = it;
+			int cc = nextChar(utf8, next, end);
+			if (matchToken(token, cc))
+			{
+				++tok;
+				it = next;
+				continue;
+			}
+		}
+		if (starIt)
+		{
+			// backtrack: let the most recent '*' consume one more character
+			tok = starTok + 1;
+			nextChar(utf8, starIt, end);
+			it = starIt;
+			continue;
+		}
+		return false;
+	}
+	while (tok < nTokens && _tokens[tok].type == TOK_STAR) ++tok;
+	return tok == nTokens;
+}
+
+
+bool CompiledGlob::match(const std::string& subject) const
+{
+	return match(subject.data(), subject.size());
+}
+
+
+void CompiledGlob::compile()
+{
+	UTF8Encoding utf8;
+	TextIterator it(_pattern, utf8);
+	TextIterator end(_pattern);
+
+	_dotSpecial = (_options & Glob::GLOB_DOT_SPECIAL) && it != end && (*it == '?' || *it == '*');
+	while (it != end)
+	{
+		Token token;
+		token.ch  = 0;
+		token.set = 0;
+		switch (*it)
+		{
+		case '?':
+			token.type = TOK_QUESTION;
+			++it;
+			break;
+		case '*':
+			token.type = TOK_STAR;
+			++it;
+			break;
+		case '[':
+			if (++it != end)
+			{
+				token.type = TOK_SET;
+				token.set  = compileSet(it, end);
+				break;
+			}
+			throw SyntaxException("bad range syntax in glob pattern");
+		case '\\':
+			if (++it == end) throw SyntaxException("backslash must be followed by character in glob pattern");
+			// fallthrough
+		default:
+			token.type = TOK_CHAR;
+			token.ch   = (_options & Glob::GLOB_CASELESS) ? Unicode::toLower(*it) : *it;
+			++it;
+		}
+		_tokens.push_back(token);
+	}
+}
+
+
+std::size_t CompiledGlob::compileSet(TextIterator& it, const TextIterator& end)
+{
+	Set set;
+	set.invert = *it == '!';
+	if (set.invert && ++it == end)
+		throw SyntaxException("bad range syntax in glob pattern");
+
+	while (it != end)
+	{
+		switch (*it)
+		{
+		case ']':
+			++it;
+			_sets.push_back(set);
+			return _sets.size() - 1;
+		case '\\':
+			if (++it == end) throw SyntaxException("backslash must be followed by character in glob pattern");
+		}
+		int first = *it;
+		int last  = first;
+		if (++it != end && *it == '-')
+		{
+			if (++it != end)
+				last = *it++;
+			else
+				throw SyntaxException("bad range syntax in glob pattern");
+		}
+		if (_options & Glob::GLOB_CASELESS)
+		{
+			first = Unicode::toLower(first);
+			last  = Unicode::toLower(last);
+		}
+		set.ranges.push_back(std::make_pair(first, last));
+	}
+	throw SyntaxException("range must be terminated by closing bracket in glob pattern");
+}
+
+
+bool CompiledGlob::matchToken(const Token& token, int c) const
+{
+	switch (token.type)
+	{
+	case TOK_QUESTION:
+		return true;
+	case TOK_CHAR:
+		if (_options & Glob::GLOB_CASELESS)
+			return token.ch == Unicode::toLower(c);
+		else
+			return token.ch == c;
+	case TOK_SET:
+		{
+			const Set& set = _sets[token.set];
+			if (_options & Glob::GLOB_CASELESS)
+				c = Unicode::toLower(c);
+			bool mtch = false;
+			for (std::vector<std::pair<int, int> >::const_iterator itr = set.ranges.begin(); itr != set.ranges.end(); ++itr)
+			{
+				if (itr->first <= c && c <= itr->second)
+				{
+					mtch = true;
+					break;
+				}
+			}
+			return set.invert ? !mtch : mtch;
+		}
+	default:
+		return false;
+	}
+}
+
+
+} // namespace Poco
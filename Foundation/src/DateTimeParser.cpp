@@ -17,11 +17,41 @@
 #include "Poco/DateTime.h"
 #include "Poco/Exception.h"
 #include "Poco/Ascii.h"
+#include "Poco/ByteOrder.h"
+#include <cstring>
 
 
 namespace Poco {
 
 
+namespace
+{
+	inline bool parseDigits4(const char* p, int& value)
+		/// Reads four decimal digits at once, rejecting
+		/// any non-digit byte.
+	{
+		UInt32 v;
+		std::memcpy(&v, p, 4);
+#if defined(POCO_ARCH_BIG_ENDIAN)
+		v = ByteOrder::flipBytes(v);
+#endif
+		UInt32 d = v - 0x30303030u;
+		if ((v & 0xF0F0F0F0u) != 0x30303030u || ((d + 0x06060606u) & 0xF0F0F0F0u) != 0) return false;
+		d = (d*10 + (d >> 8)) & 0x00FF00FFu;
+		value = static_cast<int>((d*100 + (d >> 16)) & 0x0000FFFFu);
+		return true;
+	}
+
+
+	inline bool parseDigits2(const char* p, int& value)
+	{
+		if (!Ascii::isDigit(p[0]) || !Ascii::isDigit(p[1])) return false;
+		value = (p[0] - '0')*10 + (p[1] - '0');
+		return true;
+	}
+}
+
+
 #define SKIP_JUNK() \
 	while (it != end && !Ascii::isDigit(*it)) ++it
 
@@ -228,6 +258,8 @@ bool DateTimeParser::tryParse(const std::string& str, DateTime& dateTime, int& t
 		return tryParse("%W, %e %b %r %H:%M:%S %Z", str, dateTime, timeZoneDifferential);
 	else if (Ascii::isDigit(str[0]))
 	{
+		if (tryParseISO8601(str.data(), str.length(), dateTime, timeZoneDifferential))
+			return true;
 		if (str.find(' ') != std::string::npos || str.length() == 10)
 			return tryParse(DateTimeFormat::SORTABLE_FORMAT, str, dateTime, timeZoneDifferential);
 		else if (str.find('.') != std::string::npos || str.find(',') != std::string::npos)
@@ -239,6 +271,85 @@ bool DateTimeParser::tryParse(const std::string& str, DateTime& dateTime, int& t
 }
 
 
+bool DateTimeParser::tryParseISO8601(const char* str, std::size_t length, DateTime& dateTime, int& timeZoneDifferential)
+{
+	if (!str || length < 10) return false;
+
+	int year   = 0;
+	int month  = 0;
+	int day    = 0;
+	int hour   = 0;
+	int minute = 0;
+	int second = 0;
+	int millis = 0;
+	int micros = 0;
+	int tzd    = 0;
+
+	if (!parseDigits4(str, year)) return false;
+	if (str[4] != '-' || !parseDigits2(str + 5, month)) return false;
+	if (str[7] != '-' || !parseDigits2(str + 8, day)) return false;
+
+	std::size_t pos = 10;
+	if (pos < length && (str[pos] == 'T' || str[pos] == ' '))
+	{
+		++pos;
+		if (pos + 5 > length) return false;
+		if (!parseDigits2(str + pos, hour)) return false;
+		if (str[pos + 2] != ':' || !parseDigits2(str + pos + 3, minute)) return false;
+		pos += 5;
+		if (pos < length && str[pos] == ':')
+		{
+			if (pos + 3 > length || !parseDigits2(str + pos + 1, second)) return false;
+			pos += 3;
+			if (pos < length && (str[pos] == '.' || str[pos] == ','))
+			{
+				++pos;
+				if (pos >= length || !Ascii::isDigit(str[pos])) return false;
+				int scale = 100000;
+				while (pos < length && Ascii::isDigit(str[pos]))
+				{
+					int fraction = (str[pos++] - '0')*scale;
+					millis += fraction/1000;
+					micros += fraction%1000;
+					if (scale > 1) scale /= 10;
+					else while (pos < length && Ascii::isDigit(str[pos])) ++pos;
+				}
+			}
+		}
+	}
+	if (pos < length)
+	{
+		if (str[pos] == 'Z')
+		{
+			++pos;
+		}
+		else if (str[pos] == '+' || str[pos] == '-')
+		{
+			int sign = str[pos] == '+' ? 1 : -1;
+			++pos;
+			int hours = 0;
+			if (pos + 2 > length || !parseDigits2(str + pos, hours)) return false;
+			pos += 2;
+			if (pos < length && str[pos] == ':') ++pos;
+			int minutes = 0;
+			if (pos < length)
+			{
+				if (pos + 2 > length || !parseDigits2(str + pos, minutes)) return false;
+				pos += 2;
+			}
+			tzd = sign*(hours*3600 + minutes*60);
+		}
+		else return false;
+	}
+	if (pos != length) return false;
+
+	if (!DateTime::isValid(year, month, day, hour, minute, second, millis, micros)) return false;
+	dateTime.assign(year, month, day, hour, minute, second, millis, micros);
+	timeZoneDifferential = tzd;
+	return true;
+}
+
+
 int DateTimeParser::parseTZD(std::string::const_iterator& it, const std::string::const_iterator& end)
 {
 	struct Zone
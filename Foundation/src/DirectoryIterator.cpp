@@ -72,6 +72,18 @@ DirectoryIterator::~DirectoryIterator()
 }
 
 
+DirEntry::Type DirectoryIterator::entryType() const
+{
+	return _pImpl ? _pImpl->entryType() : DirEntry::ENTRY_UNKNOWN;
+}
+
+
+bool DirectoryIterator::entry(DirEntry& entry) const
+{
+	return _pImpl ? _pImpl->entry(entry) : false;
+}
+
+
 DirectoryIterator& DirectoryIterator::operator = (const DirectoryIterator& it)
 {
 	if (_pImpl) _pImpl->release();
@@ -46,6 +46,31 @@ bool TraverseBase::isDirectory(Poco::File& file)
 }
 
 
+bool TraverseBase::isDirectory(const DirectoryIterator& it)
+{
+	switch (it.entryType())
+	{
+	case DirEntry::ENTRY_DIRECTORY:
+		return true;
+	case DirEntry::ENTRY_FILE:
+	case DirEntry::ENTRY_OTHER:
+		return false;
+	default:
+		// symbolic links (which may point to directories) and
+		// entries of unknown type need a stat that follows links,
+		// as before
+		try
+		{
+			return File(it.path()).isDirectory();
+		}
+		catch (...)
+		{
+			return false;
+		}
+	}
+}
+
+
 //
 // ChildrenFirstTraverse
 //
@@ -68,7 +93,7 @@ const std::string ChildrenFirstTraverse::next(Stack* itStack, bool* isFinished)
 	// go deeper into not empty directory
 	// (if depth limit allows)
 	bool isDepthLimitReached = isFiniteDepth() && _depthDeterminer(*itStack) >= _maxDepth;
-	if (!isDepthLimitReached && isDirectory(*itStack->top()))
+	if (!isDepthLimitReached && isDirectory(itStack->top()))
 	{
 		DirectoryIterator child_it(itStack->top().path());
 		// check if directory is empty
@@ -121,7 +146,7 @@ const std::string SiblingsFirstTraverse::next(Stack* itStack, bool* isFinished)
 
 	// add dirs to queue (if depth limit allows)
 	bool isDepthLimitReached = isFiniteDepth() && _depthDeterminer(*itStack) >= _maxDepth;
-	if (!isDepthLimitReached && isDirectory(*itStack->top()))
+	if (!isDepthLimitReached && isDirectory(itStack->top()))
 	{
 		const std::string& p = itStack->top()->path();
 		_dirsStack.top().push(p);
@@ -19,12 +19,14 @@
 #include "Poco/File_UNIX.h"
 #endif
 #include "Poco/Path.h"
+#include <sys/stat.h>
+#include <fcntl.h>
 
 
 namespace Poco {
 
 
-DirectoryIteratorImpl::DirectoryIteratorImpl(const std::string& path): _pDir(0), _rc(1)
+DirectoryIteratorImpl::DirectoryIteratorImpl(const std::string& path): _pDir(0), _type(DirEntry::ENTRY_UNKNOWN), _rc(1)
 {
 	Path p(path);
 	p.makeFile();
@@ -52,13 +54,65 @@ const std::string& DirectoryIteratorImpl::next()
 	{
 		struct dirent* pEntry = readdir(_pDir);
 		if (pEntry)
+		{
 			_current = pEntry->d_name;
+#if defined(DT_UNKNOWN)
+			switch (pEntry->d_type)
+			{
+			case DT_REG:
+				_type = DirEntry::ENTRY_FILE;
+				break;
+			case DT_DIR:
+				_type = DirEntry::ENTRY_DIRECTORY;
+				break;
+			case DT_LNK:
+				_type = DirEntry::ENTRY_LINK;
+				break;
+			case DT_UNKNOWN:
+				_type = DirEntry::ENTRY_UNKNOWN;
+				break;
+			default:
+				_type = DirEntry::ENTRY_OTHER;
+				break;
+			}
+#else
+			_type = DirEntry::ENTRY_UNKNOWN;
+#endif
+		}
 		else
+		{
 			_current.clear();
+			_type = DirEntry::ENTRY_UNKNOWN;
+		}
 	}
 	while (_current == "." || _current == "..");
 	return _current;
 }
 
 
+bool DirectoryIteratorImpl::entry(DirEntry& entry) const
+{
+	entry.name = _current;
+	entry.type = _type;
+#if !defined(POCO_VXWORKS) && defined(AT_SYMLINK_NOFOLLOW)
+	struct stat st;
+	if (fstatat(dirfd(_pDir), _current.c_str(), &st, AT_SYMLINK_NOFOLLOW) != 0)
+		return false;
+	if (S_ISREG(st.st_mode))
+		entry.type = DirEntry::ENTRY_FILE;
+	else if (S_ISDIR(st.st_mode))
+		entry.type = DirEntry::ENTRY_DIRECTORY;
+	else if (S_ISLNK(st.st_mode))
+		entry.type = DirEntry::ENTRY_LINK;
+	else
+		entry.type = DirEntry::ENTRY_OTHER;
+	entry.size = static_cast<UInt64>(st.st_size);
+	entry.lastModified = Timestamp::fromEpochTime(st.st_mtime);
+	return true;
+#else
+	return false;
+#endif
+}
+
+
 } // namespace Poco
@@ -72,4 +72,24 @@ const std::string& DirectoryIteratorImpl::next()
 }
 
 
+DirEntry::Type DirectoryIteratorImpl::entryType() const
+{
+	if (_current.empty()) return DirEntry::ENTRY_UNKNOWN;
+	if (_fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) return DirEntry::ENTRY_LINK;
+	if (_fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) return DirEntry::ENTRY_DIRECTORY;
+	if (_fd.dwFileAttributes & FILE_ATTRIBUTE_DEVICE) return DirEntry::ENTRY_OTHER;
+	return DirEntry::ENTRY_FILE;
+}
+
+
+bool DirectoryIteratorImpl::entry(DirEntry& entry) const
+{
+	entry.name = _current;
+	entry.type = entryType();
+	entry.size = (static_cast<UInt64>(_fd.nFileSizeHigh) << 32) + _fd.nFileSizeLow;
+	entry.lastModified = Timestamp::fromFileTimeNP(_fd.ftLastWriteTime.dwLowDateTime, _fd.ftLastWriteTime.dwHighDateTime);
+	return true;
+}
+
+
 } // namespace Poco
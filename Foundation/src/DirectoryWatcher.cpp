@@ -40,6 +40,7 @@
 #endif
 #include <algorithm>
 #include <map>
+#include <set>
 
 
 namespace Poco {
@@ -215,14 +216,24 @@ public:
 					break;
 				case WAIT_OBJECT_0 + 1:
 					{
+						// Absorb further change notifications arriving within
+						// a short window, so that a burst of changes results
+						// in a single rescan.
+						DWORD rc;
+						do
+						{
+							if (FindNextChangeNotification(hChange) == FALSE)
+							{
+								FileImpl::handleLastErrorImpl(path);
+							}
+							rc = WaitForMultipleObjects(2, h, FALSE, COALESCE_TIMEOUT);
+						}
+						while (rc == WAIT_OBJECT_0 + 1);
+						if (rc == WAIT_OBJECT_0) stopped = true;
 						ItemInfoMap newEntries;
 						scan(newEntries);
 						compare(entries, newEntries);
 						std::swap(entries, newEntries);
-						if (FindNextChangeNotification(hChange) == FALSE)
-						{
-							FileImpl::handleLastErrorImpl(path);
-						}
 					}
 					break;
 				default:
@@ -246,8 +257,13 @@ public:
 	{
 		return false;
 	}
-	
+
 private:
+	enum
+	{
+		COALESCE_TIMEOUT = 50 /// milliseconds to wait for further notifications before rescanning
+	};
+
 	HANDLE _hStopped;
 };
 
@@ -297,8 +313,22 @@ public:
 				owner().scanError(&owner(), exc);
 			}
 		}
-		
-		Poco::Buffer<char> buffer(4096);
+
+		ItemInfoMap entries;
+		try
+		{
+			// A snapshot of the directory is kept up to date from the
+			// received events, so that the watcher can recover from an
+			// event queue overflow by rescanning and comparing against
+			// the last known state.
+			scan(entries);
+		}
+		catch (Poco::Exception& exc)
+		{
+			owner().scanError(&owner(), exc);
+		}
+
+		Poco::Buffer<char> buffer(BUFFER_SIZE);
 		while (!_stopped)
 		{
 			fd_set fds;
@@ -311,70 +341,150 @@ public:
 
 			if (select(_fd + 1, &fds, NULL, NULL, &tv) == 1)
 			{
-				int n = read(_fd, buffer.begin(), buffer.size());
-				int i = 0;
-				if (n > 0)
+				bool overflow = false;
+				std::set<std::string> modified;
+				std::map<Poco::UInt32, std::string> movedFrom;
+				int reads = 0;
+				do
 				{
+					int n = read(_fd, buffer.begin(), buffer.size());
+					if (n <= 0) break;
+					int i = 0;
 					while (n > 0)
 					{
 						struct inotify_event* pEvent = reinterpret_cast<struct inotify_event*>(buffer.begin() + i);
-						
-						if (pEvent->len > 0)
-						{						
-							if (!owner().eventsSuspended())
-							{
-								Poco::Path p(owner().directory().path());
-								p.makeDirectory();
-								p.setFileName(pEvent->name);
-								Poco::File f(p.toString());
-	
-								if ((pEvent->mask & IN_CREATE) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_ADDED))
-								{
-									DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_ADDED);
-									owner().itemAdded(&owner(), ev);
-								}
-								if ((pEvent->mask & IN_DELETE) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_REMOVED))
-								{
-									DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_REMOVED);
-									owner().itemRemoved(&owner(), ev);
-								}
-								if ((pEvent->mask & IN_MODIFY) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MODIFIED))
-								{
-									DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MODIFIED);
-									owner().itemModified(&owner(), ev);
-								}
-								if ((pEvent->mask & IN_MOVED_FROM) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MOVED_FROM))
-								{
-									DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MOVED_FROM);
-									owner().itemMovedFrom(&owner(), ev);
-								}
-								if ((pEvent->mask & IN_MOVED_TO) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MOVED_TO))
-								{
-									DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MOVED_TO);
-									owner().itemMovedTo(&owner(), ev);
-								}
-							}
+
+						if (pEvent->mask & IN_Q_OVERFLOW)
+						{
+							overflow = true;
 						}
-						
+						else if (pEvent->len > 0)
+						{
+							handleEvent(pEvent, entries, modified, movedFrom);
+						}
+
 						i += sizeof(inotify_event) + pEvent->len;
 						n -= sizeof(inotify_event) + pEvent->len;
 					}
+
+					// Events arriving immediately after the ones just read
+					// belong to the same burst and are coalesced into this
+					// batch.
+					fd_set more;
+					FD_ZERO(&more);
+					FD_SET(_fd, &more);
+					struct timeval poll;
+					poll.tv_sec  = 0;
+					poll.tv_usec = 0;
+					if (select(_fd + 1, &more, NULL, NULL, &poll) != 1) break;
+				}
+				while (++reads < MAX_BATCH_READS && !_stopped);
+
+				if (overflow)
+				{
+					// The event queue overflowed and events were lost;
+					// rescan the watched directory and report the changes
+					// against the last known state.
+					try
+					{
+						ItemInfoMap newEntries;
+						scan(newEntries);
+						compare(entries, newEntries);
+						std::swap(entries, newEntries);
+					}
+					catch (Poco::Exception& exc)
+					{
+						owner().scanError(&owner(), exc);
+					}
 				}
 			}
 		}
 	}
-	
+
 	void stop()
 	{
 		_stopped = true;
 	}
-	
+
 	bool supportsMoveEvents() const
 	{
 		return true;
 	}
 
 private:
+	enum
+	{
+		BUFFER_SIZE = 65536,
+		MAX_BATCH_READS = 16 /// upper bound on the length of a coalescing batch
+	};
+
+	void handleEvent(struct inotify_event* pEvent, ItemInfoMap& entries, std::set<std::string>& modified, std::map<Poco::UInt32, std::string>& movedFrom)
+	{
+		std::string name(pEvent->name);
+		Poco::Path p(owner().directory().path());
+		p.makeDirectory();
+		p.setFileName(name);
+		Poco::File f(p.toString());
+
+		if (pEvent->mask & (IN_CREATE | IN_MOVED_TO | IN_MODIFY))
+		{
+			try
+			{
+				entries[name] = ItemInfo(f);
+			}
+			catch (...)
+			{
+				entries.erase(name);
+			}
+		}
+		if (pEvent->mask & (IN_DELETE | IN_MOVED_FROM))
+		{
+			entries.erase(name);
+		}
+
+		if (owner().eventsSuspended()) return;
+
+		if ((pEvent->mask & IN_CREATE) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_ADDED))
+		{
+			DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_ADDED);
+			owner().itemAdded(&owner(), ev);
+		}
+		if ((pEvent->mask & IN_DELETE) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_REMOVED))
+		{
+			DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_REMOVED);
+			owner().itemRemoved(&owner(), ev);
+		}
+		if ((pEvent->mask & IN_MODIFY) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MODIFIED))
+		{
+			// every write() to a file produces its own IN_MODIFY event;
+			// report an item only once per batch
+			if (modified.insert(name).second)
+			{
+				DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MODIFIED);
+				owner().itemModified(&owner(), ev);
+			}
+		}
+		if ((pEvent->mask & IN_MOVED_FROM) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MOVED_FROM))
+		{
+			DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MOVED_FROM);
+			owner().itemMovedFrom(&owner(), ev);
+			movedFrom[pEvent->cookie] = f.path();
+		}
+		if ((pEvent->mask & IN_MOVED_TO) && (owner().eventMask() & DirectoryWatcher::DW_ITEM_MOVED_TO))
+		{
+			DirectoryWatcher::DirectoryEvent ev(f, DirectoryWatcher::DW_ITEM_MOVED_TO);
+			owner().itemMovedTo(&owner(), ev);
+			std::map<Poco::UInt32, std::string>::iterator it = movedFrom.find(pEvent->cookie);
+			if (it != movedFrom.end())
+			{
+				Poco::File from(it->second);
+				DirectoryWatcher::DirectoryMoveEvent mev(from, f);
+				owner().itemMoved(&owner(), mev);
+				movedFrom.erase(it);
+			}
+		}
+	}
+
 	int _fd;
 	bool _stopped;
 };
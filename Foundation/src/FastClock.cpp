@@ -0,0 +1,179 @@
+//
+// FastClock.cpp
+//
+// Library: Foundation
+// Package: DateTime
+// Module:  FastClock
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/FastClock.h"
+#include "Poco/Mutex.h"
+#include <algorithm>
+
+
+#if (defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L)) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+	#define POCO_FASTCLOCK_HAVE_TSC
+	#include <atomic>
+	#if defined(__x86_64__) || defined(__i386__)
+		#include <x86intrin.h>
+	#endif
+#endif
+
+
+namespace Poco {
+
+
+#if defined(POCO_FASTCLOCK_HAVE_TSC)
+
+
+namespace
+{
+	inline UInt64 readTicks()
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#else
+		UInt64 ticks;
+		__asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (ticks));
+		return ticks;
+#endif
+	}
+
+	struct Calibration
+	{
+		Clock::ClockVal baseMicros;
+		UInt64 baseTicks;
+		double microsPerTick;
+	};
+
+	// Recalibration writes into the slot not currently published,
+	// so concurrent readers always see a consistent calibration.
+	Calibration calibrationPool[2];
+	std::atomic<Calibration*> currentCalibration(0);
+	int calibrationIndex(0);
+	FastMutex calibrationMutex;
+
+	Calibration* calibrate()
+	{
+		FastMutex::ScopedLock lock(calibrationMutex);
+
+		Clock startClock;
+		UInt64 startTicks = readTicks();
+		while (startClock.elapsed() < 1000)
+		{
+			// busy wait about a millisecond for a measurable tick delta
+		}
+		Clock endClock;
+		UInt64 endTicks = readTicks();
+
+		Calibration* pCal = &calibrationPool[calibrationIndex];
+		calibrationIndex = (calibrationIndex + 1) % 2;
+		pCal->baseMicros = endClock.microseconds();
+		pCal->baseTicks  = endTicks;
+		pCal->microsPerTick = double(endClock.microseconds() - startClock.microseconds())/double(endTicks - startTicks);
+		currentCalibration.store(pCal, std::memory_order_release);
+		return pCal;
+	}
+}
+
+
+FastClock::ClockVal FastClock::now()
+{
+	Calibration* pCal = currentCalibration.load(std::memory_order_acquire);
+	if (!pCal) pCal = calibrate();
+	return pCal->baseMicros + ClockVal(double(readTicks() - pCal->baseTicks)*pCal->microsPerTick);
+}
+
+
+void FastClock::recalibrate()
+{
+	calibrate();
+}
+
+
+bool FastClock::ready()
+{
+	return true;
+}
+
+
+#else
+
+
+FastClock::ClockVal FastClock::now()
+{
+	Clock clock;
+	return clock.microseconds();
+}
+
+
+void FastClock::recalibrate()
+{
+}
+
+
+bool FastClock::ready()
+{
+	return false;
+}
+
+
+#endif // POCO_FASTCLOCK_HAVE_TSC
+
+
+FastClock::FastClock()
+{
+	update();
+}
+
+
+FastClock::FastClock(ClockVal tv)
+{
+	_clock = tv;
+}
+
+
+FastClock::FastClock(const FastClock& other)
+{
+	_clock = other._clock;
+}
+
+
+FastClock::~FastClock()
+{
+}
+
+
+FastClock& FastClock::operator = (const FastClock& other)
+{
+	_clock = other._clock;
+	return *this;
+}
+
+
+FastClock& FastClock::operator = (ClockVal tv)
+{
+	_clock = tv;
+	return *this;
+}
+
+
+void FastClock::swap(FastClock& timestamp)
+{
+	std::swap(_clock, timestamp._clock);
+}
+
+
+void FastClock::update()
+{
+	_clock = now();
+}
+
+
+} // namespace Poco
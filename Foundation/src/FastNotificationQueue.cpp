@@ -0,0 +1,266 @@
+//
+// FastNotificationQueue.cpp
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  FastNotificationQueue
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/FastNotificationQueue.h"
+#include "Poco/NotificationCenter.h"
+#include "Poco/Notification.h"
+#include "Poco/Clock.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	const long SLEEP_SLICE_MS = 100;
+		// Upper bound for a single condition wait. Bounds the window
+		// of the (benign) race between a lock-free push and a thread
+		// going to sleep on the condition variable.
+}
+
+
+FastNotificationQueue::FastNotificationQueue(std::size_t size):
+	_ring(size),
+	_consumerSleepers(0),
+	_producerSleepers(0),
+	_wakeUpGeneration(0)
+{
+}
+
+
+FastNotificationQueue::~FastNotificationQueue()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void FastNotificationQueue::enqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+	Notification* pNf = pNotification.duplicate();
+	if (_ring.push(pNf))
+	{
+		notifyConsumer();
+		return;
+	}
+
+	for (;;)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_producerSleepers.fetch_add(1, std::memory_order_seq_cst);
+		bool pushed = _ring.push(pNf);
+		if (!pushed)
+		{
+			_roomAvailable.tryWait(_mutex, SLEEP_SLICE_MS);
+			pushed = _ring.push(pNf);
+		}
+		_producerSleepers.fetch_sub(1, std::memory_order_seq_cst);
+		if (pushed)
+		{
+			notifyConsumer();
+			return;
+		}
+	}
+}
+
+
+bool FastNotificationQueue::tryEnqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+	Notification* pNf = pNotification.duplicate();
+	if (_ring.push(pNf))
+	{
+		notifyConsumer();
+		return true;
+	}
+	pNf->release();
+	return false;
+}
+
+
+Notification* FastNotificationQueue::dequeueNotification()
+{
+	return dequeueOne();
+}
+
+
+Notification* FastNotificationQueue::waitDequeueNotification()
+{
+	for (;;)
+	{
+		Notification* pNf = dequeueOne();
+		if (pNf) return pNf;
+
+		FastMutex::ScopedLock lock(_mutex);
+		unsigned long generation = _wakeUpGeneration;
+		if (!_ring.empty()) continue;
+		_consumerSleepers.fetch_add(1, std::memory_order_seq_cst);
+		_nfAvailable.tryWait(_mutex, SLEEP_SLICE_MS);
+		_consumerSleepers.fetch_sub(1, std::memory_order_seq_cst);
+		if (_wakeUpGeneration != generation) return 0;
+	}
+}
+
+
+Notification* FastNotificationQueue::waitDequeueNotification(long milliseconds)
+{
+	Clock start;
+	for (;;)
+	{
+		Notification* pNf = dequeueOne();
+		if (pNf) return pNf;
+
+		Clock::ClockDiff remaining = milliseconds*Clock::ClockDiff(1000) - start.elapsed();
+		if (remaining <= 0) return 0;
+		long slice = static_cast<long>((remaining + 999)/1000);
+		if (slice > SLEEP_SLICE_MS) slice = SLEEP_SLICE_MS;
+
+		FastMutex::ScopedLock lock(_mutex);
+		unsigned long generation = _wakeUpGeneration;
+		if (!_ring.empty()) continue;
+		_consumerSleepers.fetch_add(1, std::memory_order_seq_cst);
+		_nfAvailable.tryWait(_mutex, slice);
+		_consumerSleepers.fetch_sub(1, std::memory_order_seq_cst);
+		if (_wakeUpGeneration != generation) return 0;
+	}
+}
+
+
+int FastNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	int count = 0;
+	while (count < maxCount)
+	{
+		Notification* pNf = dequeueOne();
+		if (!pNf) break;
+		notifications.push_back(Notification::Ptr(pNf));
+		++count;
+	}
+	return count;
+}
+
+
+int FastNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	if (maxCount <= 0) return 0;
+
+	Notification* pNf = waitDequeueNotification();
+	if (!pNf) return 0;
+	notifications.push_back(Notification::Ptr(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+int FastNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds)
+{
+	if (maxCount <= 0) return 0;
+
+	Notification* pNf = waitDequeueNotification(milliseconds);
+	if (!pNf) return 0;
+	notifications.push_back(Notification::Ptr(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+void FastNotificationQueue::dispatch(NotificationCenter& notificationCenter)
+{
+	Notification::Ptr pNf = dequeueOne();
+	while (pNf)
+	{
+		notificationCenter.postNotification(pNf);
+		pNf = dequeueOne();
+	}
+}
+
+
+void FastNotificationQueue::wakeUpAll()
+{
+	FastMutex::ScopedLock lock(_mutex);
+	++_wakeUpGeneration;
+	_nfAvailable.broadcast();
+}
+
+
+bool FastNotificationQueue::empty() const
+{
+	return _ring.empty();
+}
+
+
+int FastNotificationQueue::size() const
+{
+	return static_cast<int>(_ring.size());
+}
+
+
+std::size_t FastNotificationQueue::capacity() const
+{
+	return _ring.capacity();
+}
+
+
+void FastNotificationQueue::clear()
+{
+	Notification* pNf;
+	while ((pNf = dequeueOne()))
+	{
+		pNf->release();
+	}
+}
+
+
+bool FastNotificationQueue::hasIdleThreads() const
+{
+	return _consumerSleepers.load(std::memory_order_seq_cst) > 0;
+}
+
+
+Notification* FastNotificationQueue::dequeueOne()
+{
+	Notification* pNf = 0;
+	if (_ring.pop(pNf))
+	{
+		notifyProducer();
+		return pNf;
+	}
+	return 0;
+}
+
+
+void FastNotificationQueue::notifyConsumer()
+{
+	if (_consumerSleepers.load(std::memory_order_seq_cst) > 0)
+	{
+		_nfAvailable.signal();
+	}
+}
+
+
+void FastNotificationQueue::notifyProducer()
+{
+	if (_producerSleepers.load(std::memory_order_seq_cst) > 0)
+	{
+		_roomAvailable.signal();
+	}
+}
+
+
+} // namespace Poco
@@ -0,0 +1,90 @@
+//
+// FastRandom.cpp
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  FastRandom
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+//
+// The xoshiro256** algorithm was designed by David Blackman and
+// Sebastiano Vigna and placed in the public domain
+// (http://prng.di.unimi.it/).
+//
+
+
+#include "Poco/FastRandom.h"
+#include "Poco/RandomStream.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+FastRandom::FastRandom()
+{
+	seed();
+}
+
+
+FastRandom::FastRandom(UInt64 seed)
+{
+	this->seed(seed);
+}
+
+
+FastRandom::~FastRandom()
+{
+}
+
+
+void FastRandom::seed(UInt64 seed)
+{
+	// expand the seed into the 256-bit state with splitmix64,
+	// which guarantees a non-zero, well-mixed state for any seed
+	for (int i = 0; i < 4; ++i)
+	{
+		seed += 0x9E3779B97F4A7C15ULL;
+		UInt64 z = seed;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		_s[i] = z ^ (z >> 31);
+	}
+}
+
+
+void FastRandom::seed()
+{
+	RandomInputStream ris;
+	ris.read(reinterpret_cast<char*>(_s), sizeof(_s));
+	if (!_s[0] && !_s[1] && !_s[2] && !_s[3])
+	{
+		// the all-zero state is the one invalid state
+		seed(0);
+	}
+}
+
+
+void FastRandom::fill(void* buffer, std::size_t length)
+{
+	char* ptr = reinterpret_cast<char*>(buffer);
+	while (length >= sizeof(UInt64))
+	{
+		UInt64 value = next64();
+		std::memcpy(ptr, &value, sizeof(value));
+		ptr += sizeof(value);
+		length -= sizeof(value);
+	}
+	if (length > 0)
+	{
+		UInt64 value = next64();
+		std::memcpy(ptr, &value, length);
+	}
+}
+
+
+} // namespace Poco
@@ -208,7 +208,7 @@ File& File::setExecutable(bool flag)
 }
 
 
-void File::copyTo(const std::string& path) const
+void File::copyTo(const std::string& path, int options) const
 {
 	Path src(getPathImpl());
 	Path dest(path);
@@ -219,13 +219,13 @@ void File::copyTo(const std::string& path) const
 		dest.setFileName(src.getFileName());
 	}
 	if (isDirectory())
-		copyDirectory(dest.toString());
+		copyDirectory(dest.toString(), options);
 	else
-		copyToImpl(dest.toString());
+		copyToImpl(dest.toString(), options);
 }
 
 
-void File::copyDirectory(const std::string& path) const
+void File::copyDirectory(const std::string& path, int options) const
 {
 	File target(path);
 	target.createDirectories();
@@ -236,7 +236,7 @@ void File::copyDirectory(const std::string& path) const
 	DirectoryIterator end;
 	for (; it != end; ++it)
 	{
-		it->copyTo(path);
+		it->copyTo(path, options);
 	}
 }
 
@@ -18,6 +18,7 @@
 #include "Poco/PurgeStrategy.h"
 #include "Poco/Message.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTime.h"
 #include "Poco/LocalDateTime.h"
@@ -38,12 +39,17 @@ const std::string FileChannel::PROP_PURGEAGE     = "purgeAge";
 const std::string FileChannel::PROP_PURGECOUNT   = "purgeCount";
 const std::string FileChannel::PROP_FLUSH        = "flush";
 const std::string FileChannel::PROP_ROTATEONOPEN = "rotateOnOpen";
+const std::string FileChannel::PROP_BUFFERSIZE   = "bufferSize";
+const std::string FileChannel::PROP_FLUSHINTERVAL = "flushInterval";
 
 FileChannel::FileChannel(): 
 	_times("utc"),
 	_compress(false),
 	_flush(true),
 	_rotateOnOpen(false),
+	_bufferSize(0),
+	_flushInterval(1000),
+	_size(0),
 	_pFile(0),
 	_pRotateStrategy(0),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
@@ -58,6 +64,9 @@ FileChannel::FileChannel(const std::string& path):
 	_compress(false),
 	_flush(true),
 	_rotateOnOpen(false),
+	_bufferSize(0),
+	_flushInterval(1000),
+	_size(0),
 	_pFile(0),
 	_pRotateStrategy(0),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
@@ -101,6 +110,7 @@ void FileChannel::open()
 				_pFile = new LogFile(_path);
 			}
 		}
+		_size = _pFile->size();
 	}
 }
 
@@ -109,6 +119,13 @@ void FileChannel::close()
 {
 	FastMutex::ScopedLock lock(_mutex);
 
+	try
+	{
+		flushBuffer();
+	}
+	catch (...)
+	{
+	}
 	delete _pFile;
 	_pFile = 0;
 }
@@ -120,7 +137,30 @@ void FileChannel::log(const Message& msg)
 
 	FastMutex::ScopedLock lock(_mutex);
 
-	if (_pRotateStrategy && _pArchiveStrategy && _pRotateStrategy->mustRotate(_pFile))
+	if (_bufferSize > 0)
+	{
+		if (_buffer.empty()) _bufferTime.update();
+		_buffer.append(msg.getText());
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		_buffer.append("\r\n");
+#else
+		_buffer.append(1, '\n');
+#endif
+		if (_buffer.size() >= _bufferSize || _bufferTime.isElapsed(Timestamp::TimeDiff(_flushInterval)*1000))
+			flushBuffer();
+	}
+	else
+	{
+		rotateIfRequired();
+		_pFile->write(msg.getText(), _flush);
+		_size += msg.getText().size() + 1;
+	}
+}
+
+
+void FileChannel::rotateIfRequired()
+{
+	if (_pRotateStrategy && _pArchiveStrategy && _pRotateStrategy->mustRotate(_pFile, _size))
 	{
 		try
 		{
@@ -134,9 +174,20 @@ void FileChannel::log(const Message& msg)
 		// we must call mustRotate() again to give the
 		// RotateByIntervalStrategy a chance to write its timestamp
 		// to the new file.
-		_pRotateStrategy->mustRotate(_pFile);
+		_pRotateStrategy->mustRotate(_pFile, 0);
+		_size = _pFile->size();
 	}
-	_pFile->write(msg.getText(), _flush);
+}
+
+
+void FileChannel::flushBuffer()
+{
+	if (_buffer.empty() || !_pFile) return;
+
+	rotateIfRequired();
+	_pFile->writeRaw(_buffer, _flush);
+	_size += _buffer.size();
+	_buffer.clear();
 }
 
 	
@@ -170,6 +221,10 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 		setFlush(value);
 	else if (name == PROP_ROTATEONOPEN)
 		setRotateOnOpen(value);
+	else if (name == PROP_BUFFERSIZE)
+		setBufferSize(value);
+	else if (name == PROP_FLUSHINTERVAL)
+		setFlushInterval(value);
 	else
 		Channel::setProperty(name, value);
 }
@@ -195,6 +250,10 @@ std::string FileChannel::getProperty(const std::string& name) const
 		return std::string(_flush ? "true" : "false");
 	else if (name == PROP_ROTATEONOPEN)
 		return std::string(_rotateOnOpen ? "true" : "false");
+	else if (name == PROP_BUFFERSIZE)
+		return NumberFormatter::format(_bufferSize);
+	else if (name == PROP_FLUSHINTERVAL)
+		return NumberFormatter::format(_flushInterval);
 	else
 		return Channel::getProperty(name);
 }
@@ -343,6 +402,37 @@ void FileChannel::setRotateOnOpen(const std::string& rotateOnOpen)
 }
 
 
+void FileChannel::setBufferSize(const std::string& bufferSize)
+{
+	std::string::const_iterator it  = bufferSize.begin();
+	std::string::const_iterator end = bufferSize.end();
+	UInt64 n = 0;
+	while (it != end && Ascii::isSpace(*it)) ++it;
+	while (it != end && Ascii::isDigit(*it)) { n *= 10; n += *it++ - '0'; }
+	while (it != end && Ascii::isSpace(*it)) ++it;
+	std::string unit;
+	while (it != end && Ascii::isAlpha(*it)) unit += *it++;
+
+	if (unit == "K")
+		n *= 1024;
+	else if (unit == "M")
+		n *= 1024*1024;
+	else if (!unit.empty() && icompare(unit, "none") != 0)
+		throw InvalidArgumentException("bufferSize", bufferSize);
+
+	flushBuffer();
+	_bufferSize = n;
+}
+
+
+void FileChannel::setFlushInterval(const std::string& flushInterval)
+{
+	int n = NumberParser::parse(flushInterval);
+	if (n < 0) throw InvalidArgumentException("flushInterval", flushInterval);
+	_flushInterval = n;
+}
+
+
 void FileChannel::purge()
 {
 	if (_pPurgeStrategy)
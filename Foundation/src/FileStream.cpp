@@ -43,6 +43,25 @@ void FileIOS::open(const std::string& path, std::ios::openmode mode)
 }
 
 
+void FileIOS::open(const std::string& path, std::ios::openmode mode, int openOptions)
+{
+	clear();
+	_buf.open(path, mode | _defaultMode, openOptions);
+}
+
+
+void FileIOS::advise(Advice advice)
+{
+	_buf.advise(advice);
+}
+
+
+void FileIOS::preallocate(UInt64 length)
+{
+	_buf.preallocate(length);
+}
+
+
 void FileIOS::close()
 {
 	if (!_buf.close())
@@ -93,6 +112,14 @@ FileOutputStream::FileOutputStream(const std::string& path, std::ios::openmode m
 }
 
 
+FileOutputStream::FileOutputStream(const std::string& path, std::ios::openmode mode, int openOptions):
+	FileIOS(std::ios::out),
+	std::ostream(&_buf)
+{
+	open(path, mode, openOptions);
+}
+
+
 FileOutputStream::~FileOutputStream()
 {
 }
@@ -113,6 +140,14 @@ FileStream::FileStream(const std::string& path, std::ios::openmode mode):
 }
 
 
+FileStream::FileStream(const std::string& path, std::ios::openmode mode, int openOptions):
+	FileIOS(std::ios::in | std::ios::out),
+	std::iostream(&_buf)
+{
+	open(path, mode, openOptions);
+}
+
+
 FileStream::~FileStream()
 {
 }
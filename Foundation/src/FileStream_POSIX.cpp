@@ -19,6 +19,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <cerrno>
 
 
 namespace Poco {
@@ -38,7 +39,7 @@ FileStreamBuf::~FileStreamBuf()
 }
 
 
-void FileStreamBuf::open(const std::string& path, std::ios::openmode mode)
+void FileStreamBuf::open(const std::string& path, std::ios::openmode mode, int openOptions)
 {
 	poco_assert (_fd == -1);
 
@@ -60,6 +61,13 @@ void FileStreamBuf::open(const std::string& path, std::ios::openmode mode)
 		flags |= O_RDONLY;
 	else
 		flags |= O_WRONLY;
+
+	if (openOptions & FileIOS::OPT_DSYNC)
+#if defined(O_DSYNC)
+		flags |= O_DSYNC;
+#else
+		flags |= O_SYNC;
+#endif
 			
 	_fd = ::open(path.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
 	if (_fd == -1)
@@ -152,6 +160,98 @@ std::streampos FileStreamBuf::seekoff(std::streamoff off, std::ios::seekdir dir,
 }
 
 
+void FileStreamBuf::advise(int advice)
+{
+	if (_fd == -1) throw FileException("stream is not open", _path);
+
+	if (advice == FileIOS::ADV_DONTNEED && (getMode() & std::ios::out))
+	{
+		// flush buffered and dirty data first, otherwise the
+		// written pages cannot be dropped from the page cache
+		sync();
+		if (fdatasync(_fd) != 0)
+			File::handleLastError(_path);
+	}
+
+#if defined(POSIX_FADV_NORMAL)
+	int adv;
+	switch (advice)
+	{
+	case FileIOS::ADV_SEQUENTIAL:
+		adv = POSIX_FADV_SEQUENTIAL;
+		break;
+	case FileIOS::ADV_RANDOM:
+		adv = POSIX_FADV_RANDOM;
+		break;
+	case FileIOS::ADV_WILLNEED:
+		adv = POSIX_FADV_WILLNEED;
+		break;
+	case FileIOS::ADV_DONTNEED:
+		adv = POSIX_FADV_DONTNEED;
+		break;
+	default:
+		adv = POSIX_FADV_NORMAL;
+		break;
+	}
+	posix_fadvise(_fd, 0, 0, adv); // advisory only; ignore errors
+#endif
+}
+
+
+void FileStreamBuf::preallocate(UInt64 length)
+{
+	if (_fd == -1) throw FileException("stream is not open", _path);
+
+	if (getMode() & std::ios::out)
+		sync();
+
+#if POCO_OS == POCO_OS_LINUX
+	if (fallocate(_fd, 0, 0, static_cast<off_t>(length)) != 0)
+	{
+		if (errno == EOPNOTSUPP || errno == ENOSYS)
+		{
+			// not supported by the kernel or filesystem; fall back to
+			// the (potentially zero-filling) portable implementation
+			int rc = posix_fallocate(_fd, 0, static_cast<off_t>(length));
+			if (rc != 0)
+			{
+				errno = rc;
+				File::handleLastError(_path);
+			}
+		}
+		else File::handleLastError(_path);
+	}
+#elif POCO_OS == POCO_OS_MAC_OS_X
+	struct stat st;
+	if (fstat(_fd, &st) != 0)
+		File::handleLastError(_path);
+	if (static_cast<UInt64>(st.st_size) < length)
+	{
+		fstore_t store;
+		store.fst_flags      = F_ALLOCATECONTIG;
+		store.fst_posmode    = F_PEOFPOSMODE;
+		store.fst_offset     = 0;
+		store.fst_length     = static_cast<off_t>(length - st.st_size);
+		store.fst_bytesalloc = 0;
+		if (fcntl(_fd, F_PREALLOCATE, &store) == -1)
+		{
+			store.fst_flags = F_ALLOCATEALL;
+			fcntl(_fd, F_PREALLOCATE, &store); // best effort
+		}
+		if (ftruncate(_fd, static_cast<off_t>(length)) != 0)
+			File::handleLastError(_path);
+	}
+#else
+	int rc = posix_fallocate(_fd, 0, static_cast<off_t>(length));
+	if (rc != 0)
+	{
+		errno = rc;
+		File::handleLastError(_path);
+	}
+#endif
+}
+
+
 std::streampos FileStreamBuf::seekpos(std::streampos pos, std::ios::openmode mode)
 {
 	if (_fd == -1 || !(getMode() & mode)) 
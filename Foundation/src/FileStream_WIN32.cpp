@@ -37,7 +37,7 @@ FileStreamBuf::~FileStreamBuf()
 }
 
 
-void FileStreamBuf::open(const std::string& path, std::ios::openmode mode)
+void FileStreamBuf::open(const std::string& path, std::ios::openmode mode, int openOptions)
 {
 	poco_assert (_handle == INVALID_HANDLE_VALUE);
 
@@ -63,6 +63,8 @@ void FileStreamBuf::open(const std::string& path, std::ios::openmode mode)
 		creationDisp = OPEN_ALWAYS;
 
 	DWORD flags = FILE_ATTRIBUTE_NORMAL;
+	if (openOptions & FileIOS::OPT_DSYNC)
+		flags |= FILE_FLAG_WRITE_THROUGH;
 	
 #if defined (POCO_WIN32_UTF8)
 	std::wstring utf16Path;
@@ -184,6 +186,43 @@ std::streampos FileStreamBuf::seekoff(std::streamoff off, std::ios::seekdir dir,
 }
 
 
+void FileStreamBuf::advise(int /*advice*/)
+{
+	if (INVALID_HANDLE_VALUE == _handle)
+		throw FileException("stream is not open", _path);
+
+	// there is no equivalent of posix_fadvise() for an already
+	// opened file on Windows
+}
+
+
+void FileStreamBuf::preallocate(UInt64 length)
+{
+	if (INVALID_HANDLE_VALUE == _handle)
+		throw FileException("stream is not open", _path);
+
+	if (getMode() & std::ios::out)
+		sync();
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(_handle, &size) == 0)
+		File::handleLastError(_path);
+	if (static_cast<UInt64>(size.QuadPart) >= length) return;
+
+	LARGE_INTEGER zero;
+	zero.QuadPart = 0;
+	LARGE_INTEGER cur;
+	if (SetFilePointerEx(_handle, zero, &cur, FILE_CURRENT) == 0)
+		File::handleLastError(_path);
+	LARGE_INTEGER li;
+	li.QuadPart = static_cast<LONGLONG>(length);
+	if (SetFilePointerEx(_handle, li, NULL, FILE_BEGIN) == 0 || SetEndOfFile(_handle) == 0)
+		File::handleLastError(_path);
+	if (SetFilePointerEx(_handle, cur, NULL, FILE_BEGIN) == 0)
+		File::handleLastError(_path);
+}
+
+
 std::streampos FileStreamBuf::seekpos(std::streampos pos, std::ios::openmode mode)
 {
 	if (INVALID_HANDLE_VALUE == _handle || !(getMode() & mode))
@@ -34,6 +34,16 @@
 #include <stdio.h>
 #include <utime.h>
 #include <cstring>
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 27)
+#define POCO_HAVE_COPY_FILE_RANGE 1
+#endif
+#endif
+#endif
 
 #if (POCO_OS == POCO_OS_SOLARIS)
 #define STATFSFN statvfs
@@ -326,7 +336,54 @@ void FileImpl::setExecutableImpl(bool flag)
 }
 
 
-void FileImpl::copyToImpl(const std::string& path) const
+namespace
+{
+#if POCO_OS == POCO_OS_LINUX
+	void copyInKernel(int sd, int dd)
+		/// Copies as much as possible from sd to dd within the kernel,
+		/// using copy_file_range() or sendfile(). Both file offsets are
+		/// advanced; whatever could not be copied this way is left to
+		/// the caller's read/write loop, which resumes at the current
+		/// offsets.
+	{
+		const std::size_t CHUNK_SIZE = 0x7FFFF000;
+		bool useSendFile = false;
+		for (;;)
+		{
+			ssize_t n = -1;
+#if defined(POCO_HAVE_COPY_FILE_RANGE)
+			if (!useSendFile)
+			{
+				n = copy_file_range(sd, 0, dd, 0, CHUNK_SIZE, 0);
+				if (n < 0)
+				{
+					if (errno == EINTR) continue;
+					if (errno == EINVAL || errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP)
+						useSendFile = true;
+					else
+						return;
+				}
+			}
+#else
+			useSendFile = true;
+#endif
+			if (useSendFile)
+			{
+				n = sendfile(dd, sd, 0, CHUNK_SIZE);
+				if (n < 0)
+				{
+					if (errno == EINTR) continue;
+					return;
+				}
+			}
+			if (n == 0) return;
+		}
+	}
+#endif
+}
+
+
+void FileImpl::copyToImpl(const std::string& path, int options) const
 {
 	poco_assert (!_path.empty());
 
@@ -347,30 +404,51 @@ void FileImpl::copyToImpl(const std::string& path) const
 		close(sd);
 		handleLastErrorImpl(path);
 	}
-	Buffer<char> buffer(blockSize);
-	try
+	bool cloned = false;
+#if POCO_OS == POCO_OS_LINUX && defined(FICLONE)
+	// if source and target are on the same filesystem and the
+	// filesystem supports it, share the extents instead of
+	// copying any data
+	if (ioctl(dd, FICLONE, sd) == 0) cloned = true;
+#endif
+	if (!cloned)
 	{
-		int n;
-		while ((n = read(sd, buffer.begin(), blockSize)) > 0)
+#if POCO_OS == POCO_OS_LINUX
+		copyInKernel(sd, dd);
+#endif
+		Buffer<char> buffer(blockSize);
+		try
 		{
-			if (write(dd, buffer.begin(), n) != n)
-				handleLastErrorImpl(path);
+			int n;
+			while ((n = read(sd, buffer.begin(), blockSize)) > 0)
+			{
+				if (write(dd, buffer.begin(), n) != n)
+					handleLastErrorImpl(path);
+			}
+			if (n < 0)
+				handleLastErrorImpl(_path);
+		}
+		catch (...)
+		{
+			close(sd);
+			close(dd);
+			throw;
 		}
-		if (n < 0)
-			handleLastErrorImpl(_path);
-	}
-	catch (...)
-	{
-		close(sd);
-		close(dd);
-		throw;
 	}
+#if defined(POSIX_FADV_DONTNEED)
+	if (options & OPT_COPY_NO_PAGE_CACHE_IMPL)
+		posix_fadvise(sd, 0, 0, POSIX_FADV_DONTNEED); // advisory only; ignore errors
+#endif
 	close(sd);
 	if (fsync(dd) != 0)
 	{
 		close(dd);
 		handleLastErrorImpl(path);
 	}
+#if defined(POSIX_FADV_DONTNEED)
+	if (options & OPT_COPY_NO_PAGE_CACHE_IMPL)
+		posix_fadvise(dd, 0, 0, POSIX_FADV_DONTNEED); // advisory only; ignore errors
+#endif
 	if (close(dd) != 0)
 		handleLastErrorImpl(path);
 }
@@ -288,12 +288,19 @@ void FileImpl::setExecutableImpl(bool flag)
 }
 
 
-void FileImpl::copyToImpl(const std::string& path) const
+void FileImpl::copyToImpl(const std::string& path, int options) const
 {
 	poco_assert (!_path.empty());
 
+#if defined(COPY_FILE_NO_BUFFERING)
+	DWORD flags = 0;
+	if (options & OPT_COPY_NO_PAGE_CACHE_IMPL) flags |= COPY_FILE_NO_BUFFERING;
+	if (CopyFileExA(_path.c_str(), path.c_str(), NULL, NULL, NULL, flags) == 0)
+		handleLastErrorImpl(_path);
+#else
 	if (CopyFileA(_path.c_str(), path.c_str(), FALSE) == 0)
 		handleLastErrorImpl(_path);
+#endif
 }
 
 
@@ -291,14 +291,21 @@ void FileImpl::setExecutableImpl(bool flag)
 }
 
 
-void FileImpl::copyToImpl(const std::string& path) const
+void FileImpl::copyToImpl(const std::string& path, int options) const
 {
 	poco_assert (!_path.empty());
 
 	std::wstring upath;
 	convertPath(path, upath);
+#if defined(COPY_FILE_NO_BUFFERING)
+	DWORD flags = 0;
+	if (options & OPT_COPY_NO_PAGE_CACHE_IMPL) flags |= COPY_FILE_NO_BUFFERING;
+	if (CopyFileExW(_upath.c_str(), upath.c_str(), NULL, NULL, NULL, flags) == 0)
+		handleLastErrorImpl(_path);
+#else
 	if (CopyFileW(_upath.c_str(), upath.c_str(), FALSE) == 0)
 		handleLastErrorImpl(_path);
+#endif
 }
 
 
@@ -86,7 +86,8 @@ void FormattingChannel::log(const Message& msg)
 	{
 		if (_pFormatter)
 		{
-			std::string text;
+			std::string& text = _textBuffer.get();
+			text.clear();
 			_pFormatter->format(msg, text);
 			_pChannel->log(Message(msg, text));
 		}
@@ -13,17 +13,168 @@
 
 
 #include "Poco/Glob.h"
+#include "Poco/CompiledGlob.h"
 #include "Poco/Path.h"
 #include "Poco/Exception.h"
 #include "Poco/DirectoryIterator.h"
 #include "Poco/File.h"
 #include "Poco/UTF8Encoding.h"
 #include "Poco/Unicode.h"
+#include "Poco/Runnable.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <deque>
 
 
 namespace Poco {
 
 
+class GlobCollector: public Runnable
+	/// Collects the files matching a path pattern, like
+	/// Glob::collect(), but distributes the scans of separate
+	/// subdirectories over the default thread pool.
+	///
+	/// Directories to scan are kept in a work queue which is
+	/// processed by the calling thread and by as many pooled
+	/// threads as are available when collect() is invoked.
+{
+public:
+	GlobCollector(const Path& pathPattern, std::set<std::string>& files, int options):
+		_pathPattern(pathPattern),
+		_files(files),
+		_options(options),
+		_pending(0),
+		_running(0)
+	{
+	}
+
+	void collect(const Path& base, const Path& current, const std::string& pattern)
+	{
+		push(base, current, pattern);
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			_running = 1;
+		}
+		ThreadPool& pool = ThreadPool::defaultPool();
+		int workers = pool.available();
+		for (int i = 0; i < workers; i++)
+		{
+			{
+				FastMutex::ScopedLock lock(_mutex);
+				++_running;
+			}
+			try
+			{
+				pool.start(*this);
+			}
+			catch (NoThreadAvailableException&)
+			{
+				FastMutex::ScopedLock lock(_mutex);
+				--_running;
+				break;
+			}
+		}
+		run();
+		FastMutex::ScopedLock lock(_mutex);
+		while (_running > 0) _finished.wait(_mutex);
+	}
+
+	void run()
+	{
+		for (;;)
+		{
+			WorkItem item;
+			{
+				FastMutex::ScopedLock lock(_mutex);
+				while (_queue.empty() && _pending > 0) _available.wait(_mutex);
+				if (_queue.empty()) break;
+				item = _queue.front();
+				_queue.pop_front();
+			}
+			process(item);
+			FastMutex::ScopedLock lock(_mutex);
+			if (--_pending == 0) _available.broadcast();
+		}
+		FastMutex::ScopedLock lock(_mutex);
+		if (--_running == 0) _finished.broadcast();
+	}
+
+protected:
+	struct WorkItem
+	{
+		Path        base;
+		Path        current;
+		std::string pattern;
+	};
+
+	void push(const Path& base, const Path& current, const std::string& pattern)
+	{
+		WorkItem item;
+		item.base    = base;
+		item.current = current;
+		item.pattern = pattern;
+		FastMutex::ScopedLock lock(_mutex);
+		_queue.push_back(item);
+		++_pending;
+		_available.signal();
+	}
+
+	void process(const WorkItem& item)
+	{
+		try
+		{
+			CompiledGlob g(item.pattern, _options);
+			DirectoryIterator it(item.base);
+			DirectoryIterator end;
+			while (it != end)
+			{
+				const std::string& name = it.name();
+				if (g.match(name))
+				{
+					Path p(item.current);
+					if (p.depth() < _pathPattern.depth() - 1)
+					{
+						p.pushDirectory(name);
+						push(it.path(), p, _pathPattern[p.depth()]);
+					}
+					else
+					{
+						p.setFileName(name);
+						if (Glob::isDirectory(p, (_options & Glob::GLOB_FOLLOW_SYMLINKS) != 0))
+						{
+							p.makeDirectory();
+							FastMutex::ScopedLock lock(_mutex);
+							_files.insert(p.toString());
+						}
+						else if (!(_options & Glob::GLOB_DIRS_ONLY))
+						{
+							FastMutex::ScopedLock lock(_mutex);
+							_files.insert(p.toString());
+						}
+					}
+				}
+				++it;
+			}
+		}
+		catch (Exception&)
+		{
+		}
+	}
+
+private:
+	Path                   _pathPattern;
+	std::set<std::string>& _files;
+	int                    _options;
+	std::deque<WorkItem>   _queue;
+	int                    _pending;
+	int                    _running;
+	FastMutex              _mutex;
+	Condition              _available;
+	Condition              _finished;
+};
+
+
 Glob::Glob(const std::string& pattern, int options)
 	: _pattern(pattern), _options(options)
 {
@@ -80,7 +231,15 @@ void Glob::glob(const Path& pathPattern, std::set<std::string>& files, int optio
 	}
 	if (pathPattern.isDirectory())
 		options |= GLOB_DIRS_ONLY;
-	collect(pattern, absBase, base, pathPattern[base.depth()], files, options);
+	if (options & GLOB_PARALLEL)
+	{
+		GlobCollector collector(pattern, files, options);
+		collector.collect(absBase, base, pathPattern[base.depth()]);
+	}
+	else
+	{
+		collect(pattern, absBase, base, pathPattern[base.depth()], files, options);
+	}
 }
 
 
@@ -92,7 +251,15 @@ void Glob::glob(const Path& pathPattern, const Path& basePath, std::set<std::str
 	absBase.makeAbsolute();
 	if (pathPattern.isDirectory())
 		options |= GLOB_DIRS_ONLY;
-	collect(pattern, absBase, basePath, pathPattern[basePath.depth()], files, options);
+	if (options & GLOB_PARALLEL)
+	{
+		GlobCollector collector(pattern, files, options);
+		collector.collect(absBase, basePath, pathPattern[basePath.depth()]);
+	}
+	else
+	{
+		collect(pattern, absBase, basePath, pathPattern[basePath.depth()], files, options);
+	}
 }
 
 
@@ -213,7 +380,7 @@ void Glob::collect(const Path& pathPattern, const Path& base, const Path& curren
 		std::string pp = pathPattern.toString();
 		std::string basep = base.toString();
 		std::string curp  = current.toString();
-		Glob g(pattern, options);
+		CompiledGlob g(pattern, options);
 		DirectoryIterator it(base);
 		DirectoryIterator end;
 		while (it != end)
@@ -31,4 +31,15 @@ std::size_t hash(const std::string& str)
 }
 
 
+std::size_t hash(const char* str)
+{
+	std::size_t h = 0;
+	while (*str)
+	{
+		h = h * 0xf4243 ^ *str++;
+	}
+	return h;
+}
+
+
 } // namespace Poco
@@ -0,0 +1,137 @@
+//
+// HexBinaryCodec.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/HexBinaryCodec.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	const char DIGITS_LOWER[] = "0123456789abcdef";
+	const char DIGITS_UPPER[] = "0123456789ABCDEF";
+
+
+	struct DecodingTable
+	{
+		DecodingTable()
+		{
+			std::memset(table, 0xFF, sizeof(table));
+			for (unsigned i = 0; i < 16; i++)
+			{
+				table[static_cast<unsigned char>(DIGITS_LOWER[i])] = (unsigned char) i;
+				table[static_cast<unsigned char>(DIGITS_UPPER[i])] = (unsigned char) i;
+			}
+		}
+
+		unsigned char table[256];
+	};
+
+
+	const unsigned char* decodingTable()
+	{
+		static const DecodingTable tables;
+		return tables.table;
+	}
+}
+
+
+std::size_t HexBinaryCodec::encodedLength(std::size_t size)
+{
+	return size*2;
+}
+
+
+std::size_t HexBinaryCodec::encode(const void* data, std::size_t size, char* buffer, bool uppercase)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	const char* digits = uppercase ? DIGITS_UPPER : DIGITS_LOWER;
+	char* dst = buffer;
+
+	for (std::size_t i = 0; i < size; i++)
+	{
+		*dst++ = digits[src[i] >> 4];
+		*dst++ = digits[src[i] & 0x0F];
+	}
+	return dst - buffer;
+}
+
+
+std::string HexBinaryCodec::encode(const void* data, std::size_t size, bool uppercase)
+{
+	std::string result;
+	result.resize(encodedLength(size));
+	if (size > 0)
+	{
+		encode(data, size, &result[0], uppercase);
+	}
+	return result;
+}
+
+
+std::size_t HexBinaryCodec::maxDecodedLength(std::size_t size)
+{
+	return (size + 1)/2;
+}
+
+
+std::size_t HexBinaryCodec::decode(const char* data, std::size_t size, void* buffer)
+{
+	poco_check_ptr (data);
+	poco_check_ptr (buffer);
+
+	const unsigned char* table = decodingTable();
+	const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = src + size;
+	unsigned char* dst = reinterpret_cast<unsigned char*>(buffer);
+	unsigned char* out = dst;
+
+	int high = -1;
+	while (src != end)
+	{
+		unsigned char c = *src++;
+		if (c == ' ' || c == '\r' || c == '\t' || c == '\n') continue;
+		unsigned char v = table[c];
+		if (v == 0xFF) throw DataFormatException();
+		if (high < 0)
+			high = v;
+		else
+		{
+			*out++ = (unsigned char) ((high << 4) | v);
+			high = -1;
+		}
+	}
+	if (high >= 0) throw DataFormatException();
+	return out - dst;
+}
+
+
+std::string HexBinaryCodec::decode(const std::string& hex)
+{
+	std::string result;
+	if (hex.empty()) return result;
+	result.resize(maxDecodedLength(hex.size()));
+	std::size_t n = decode(hex.data(), hex.size(), &result[0]);
+	result.resize(n);
+	return result;
+}
+
+
+} // namespace Poco
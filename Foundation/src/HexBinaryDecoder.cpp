@@ -19,7 +19,13 @@
 namespace Poco {
 
 
-HexBinaryDecoderBuf::HexBinaryDecoderBuf(std::istream& istr): 
+namespace
+{
+	const std::size_t BULK_BUFFER_SIZE = 16384;
+}
+
+
+HexBinaryDecoderBuf::HexBinaryDecoderBuf(std::istream& istr):
 	_buf(*istr.rdbuf())
 {
 }
@@ -55,6 +61,56 @@ int HexBinaryDecoderBuf::readFromDevice()
 }
 
 
+std::streamsize HexBinaryDecoderBuf::xsgetn(char_type* p, std::streamsize count)
+{
+	if (count <= 0) return 0;
+
+	// route the first character through uflow() to honor
+	// a pending putback character
+	int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*p = std::char_traits<char>::to_char_type(c);
+
+	char buffer[BULK_BUFFER_SIZE];
+	std::streamsize copied = 1;
+	int half = -1;
+	while (copied < count)
+	{
+		// request one character less when a high nibble is pending,
+		// so a fully decoded chunk never leaves one behind
+		std::streamsize want = 2*(count - copied) - (half >= 0 ? 1 : 0);
+		if (want > static_cast<std::streamsize>(BULK_BUFFER_SIZE)) want = BULK_BUFFER_SIZE;
+		std::streamsize n = _buf.sgetn(buffer, want);
+		for (std::streamsize i = 0; i < n; i++)
+		{
+			int ch = static_cast<unsigned char>(buffer[i]);
+			if (ch == ' ' || ch == '\r' || ch == '\t' || ch == '\n') continue;
+			int d;
+			if (ch >= '0' && ch <= '9')
+				d = ch - '0';
+			else if (ch >= 'A' && ch <= 'F')
+				d = ch - 'A' + 10;
+			else if (ch >= 'a' && ch <= 'f')
+				d = ch - 'a' + 10;
+			else throw DataFormatException();
+			if (half < 0)
+				half = d;
+			else
+			{
+				p[copied++] = (char) ((half << 4) | d);
+				half = -1;
+			}
+		}
+		if (n < want)
+		{
+			if (half >= 0) throw DataFormatException();
+			break;
+		}
+	}
+	return copied;
+}
+
+
 int HexBinaryDecoderBuf::readOne()
 {
 	int ch = _buf.sbumpc();
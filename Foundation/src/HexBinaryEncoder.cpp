@@ -13,11 +13,18 @@
 
 
 #include "Poco/HexBinaryEncoder.h"
+#include "Poco/HexBinaryCodec.h"
 
 
 namespace Poco {
 
 
+namespace
+{
+	const std::size_t BULK_BUFFER_SIZE = 16384;
+}
+
+
 HexBinaryEncoderBuf::HexBinaryEncoderBuf(std::ostream& ostr): 
 	_pos(0),
 	_lineLength(72),
@@ -74,6 +81,37 @@ int HexBinaryEncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize HexBinaryEncoderBuf::xsputn(const char* s, std::streamsize count)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	char buffer[BULK_BUFFER_SIZE];
+	std::streamsize written = 0;
+	while (written < count)
+	{
+		std::size_t n = static_cast<std::size_t>(count - written);
+		if (n > BULK_BUFFER_SIZE/2) n = BULK_BUFFER_SIZE/2;
+		if (_lineLength > 0)
+		{
+			// encode only up to the next line break
+			int remaining = _lineLength - _pos;
+			std::size_t lineBytes = remaining > 0 ? static_cast<std::size_t>(remaining + 1)/2 : 1;
+			if (n > lineBytes) n = lineBytes;
+		}
+		std::size_t encoded = HexBinaryCodec::encode(s + written, n, buffer, _uppercase != 0);
+		if (_buf.sputn(buffer, static_cast<std::streamsize>(encoded)) != static_cast<std::streamsize>(encoded)) return written;
+		written += static_cast<std::streamsize>(n);
+		_pos += static_cast<int>(encoded);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			if (_buf.sputc('\n') == eof) return written;
+			_pos = 0;
+		}
+	}
+	return count;
+}
+
+
 int HexBinaryEncoderBuf::close()
 {
 	sync();
@@ -47,14 +47,22 @@ void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Typ
 	}
 	else
 	{
-		for(std::string::const_iterator it = value.begin(), end = value.end(); it != end; ++it)
+		std::string::const_iterator it = value.begin(), end = value.end();
+		while(it != end)
 		{
 			// Forward slash isn't strictly required by JSON spec, but some parsers expect it
-			if((*it >= 0 && *it <= 31) || (*it == '"') || (*it == '\\') || (*it == '/'))
+			std::string::const_iterator run = it;
+			while(run != end && !((*run >= 0 && *run <= 31) || (*run == '"') || (*run == '\\') || (*run == '/')))
+				++run;
+			// write the clean run in one piece instead of a call per character
+			if(run != it) (obj.*write)(&(*it), static_cast<S>(run - it));
+			if(run != end)
 			{
-				std::string str = Poco::UTF8::escape(it, it + 1, true);
+				std::string str = Poco::UTF8::escape(run, run + 1, true);
 				(obj.*write)(str.c_str(), str.size());
-			}else (obj.*write)(&(*it), 1);
+				++run;
+			}
+			it = run;
 		}
 	}
 	if(wrap) (obj.*write)("\"", 1);
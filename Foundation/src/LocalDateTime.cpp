@@ -259,26 +259,7 @@ void LocalDateTime::determineTzd(bool adjust)
 {
 	if (adjust)
 	{
-		std::time_t epochTime = _dateTime.timestamp().epochTime();
-#if defined(_WIN32) || defined(POCO_NO_POSIX_TSF)
-#if defined(_WIN32_WCE) && _WIN32_WCE < 0x800
-		std::tm* broken = wceex_localtime(&epochTime);
-#else
-		std::tm* broken = std::localtime(&epochTime);
-#endif
-		if (!broken) throw Poco::SystemException("cannot get local time");
-		_tzd = (Timezone::utcOffset() + ((broken->tm_isdst == 1) ? 3600 : 0));
-#else
-		std::tm broken;
-#if defined(POCO_VXWORKS)
-		if (localtime_r(&epochTime, &broken) != OK)
-			throw Poco::SystemException("cannot get local time");
-#else
-		if (!localtime_r(&epochTime, &broken))
-			throw Poco::SystemException("cannot get local time");
-#endif
-		_tzd = (Timezone::utcOffset() + ((broken.tm_isdst == 1) ? 3600 : 0));
-#endif
+		_tzd = Timezone::tzd(_dateTime.timestamp());
 		adjustForTzd();
 	}
 	else
@@ -47,6 +47,15 @@ void LogFileImpl::writeImpl(const std::string& text, bool flush)
 }
 
 
+void LogFileImpl::writeRawImpl(const std::string& text, bool flush)
+{
+	_str << text;
+	if (flush)
+		_str.flush();
+	if (!_str.good()) throw WriteFileException(_path);
+}
+
+
 UInt64 LogFileImpl::sizeImpl() const
 {
 	return (UInt64) _str.tellp();
@@ -57,6 +57,21 @@ void LogFileImpl::writeImpl(const std::string& text, bool flush)
 }
 
 
+void LogFileImpl::writeRawImpl(const std::string& text, bool flush)
+{
+	if (INVALID_HANDLE_VALUE == _hFile)	createFile();
+
+	DWORD bytesWritten;
+	BOOL res = WriteFile(_hFile, text.data(), (DWORD) text.size(), &bytesWritten, NULL);
+	if (!res) throw WriteFileException(_path);
+	if (flush)
+	{
+		res = FlushFileBuffers(_hFile);
+		if (!res) throw WriteFileException(_path);
+	}
+}
+
+
 UInt64 LogFileImpl::sizeImpl() const
 {
 	if (INVALID_HANDLE_VALUE == _hFile)
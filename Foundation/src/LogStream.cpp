@@ -24,6 +24,7 @@ namespace Poco {
 
 
 LogStreamBuf::LogStreamBuf(Logger& logger, Message::Priority priority):
+	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::out),
 	_logger(logger),
 	_priority(priority)
 {
@@ -32,6 +33,13 @@ LogStreamBuf::LogStreamBuf(Logger& logger, Message::Priority priority):
 
 LogStreamBuf::~LogStreamBuf()
 {
+	try
+	{
+		sync();
+	}
+	catch (...)
+	{
+	}
 }
 
 
@@ -41,19 +49,26 @@ void LogStreamBuf::setPriority(Message::Priority priority)
 }
 
 
-int LogStreamBuf::writeToDevice(char c)
+int LogStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
 {
-	if (c == '\n' || c == '\r')
+	const char* end = buffer + length;
+	const char* start = buffer;
+	for (const char* it = buffer; it != end; ++it)
 	{
-		if (_message.find_first_not_of("\r\n") != std::string::npos)
+		if (*it == '\n' || *it == '\r')
 		{
-			Message msg(_logger.name(), _message, _priority);
-			_message.clear();
-			_logger.log(msg);
+			_message.append(start, it - start);
+			start = it + 1;
+			if (!_message.empty())
+			{
+				Message msg(_logger.name(), _message, _priority);
+				_message.clear();
+				_logger.log(msg);
+			}
 		}
 	}
-	else _message += c;
-	return c;
+	_message.append(start, end - start);
+	return static_cast<int>(length);
 }
 
 
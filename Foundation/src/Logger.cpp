@@ -15,6 +15,8 @@
 #include "Poco/Logger.h"
 #include "Poco/Formatter.h"
 #include "Poco/LoggingRegistry.h"
+#include "Poco/ThreadLocal.h"
+#include "Poco/AutoPtr.h"
 #include "Poco/Exception.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
@@ -29,6 +31,24 @@ Mutex Logger::_mapMtx;
 const std::string Logger::ROOT;
 
 
+namespace
+{
+	struct LoggerCache
+		/// Per-thread logger cache for Logger::fastGet().
+	{
+		LoggerCache(): epoch(0)
+		{
+		}
+
+		int epoch;
+		std::map<std::string, AutoPtr<Logger> > loggers;
+	};
+
+	ThreadLocal<LoggerCache> loggerCache;
+	AtomicCounter cacheEpoch;
+}
+
+
 Logger::Logger(const std::string& name, Channel* pChannel, int level): _name(name), _pChannel(pChannel), _level(level)
 {
 	if (pChannel) pChannel->duplicate();
@@ -288,6 +308,24 @@ Logger& Logger::get(const std::string& name)
 }
 
 
+Logger& Logger::fastGet(const std::string& name)
+{
+	LoggerCache& cache = loggerCache.get();
+	int epoch = cacheEpoch.value();
+	if (cache.epoch != epoch)
+	{
+		cache.loggers.clear();
+		cache.epoch = epoch;
+	}
+	std::map<std::string, AutoPtr<Logger> >::iterator it = cache.loggers.find(name);
+	if (it != cache.loggers.end()) return *it->second;
+
+	Logger& logger = get(name);
+	cache.loggers[name] = AutoPtr<Logger>(&logger, true);
+	return logger;
+}
+
+
 Logger& Logger::unsafeGet(const std::string& name)
 {
 	Logger* pLogger = find(name);
@@ -347,6 +385,7 @@ void Logger::shutdown()
 		}
 		delete _pLoggerMap;
 		_pLoggerMap = 0;
+		++cacheEpoch;
 	}
 }
 
@@ -374,6 +413,7 @@ void Logger::destroy(const std::string& name)
 		{
 			it->second->release();
 			_pLoggerMap->erase(it);
+			++cacheEpoch;
 		}
 	}
 }
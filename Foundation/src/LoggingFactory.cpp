@@ -15,6 +15,8 @@
 #include "Poco/LoggingFactory.h"
 #include "Poco/SingletonHolder.h"
 #include "Poco/AsyncChannel.h"
+#include "Poco/BinaryLogChannel.h"
+#include "Poco/ThrottleChannel.h"
 #include "Poco/ConsoleChannel.h"
 #include "Poco/FileChannel.h"
 #include "Poco/FormattingChannel.h"
@@ -93,6 +95,8 @@ void LoggingFactory::registerBuiltins()
 #endif
 #ifndef POCO_NO_FILECHANNEL
 	_channelFactory.registerClass("FileChannel", new Instantiator<FileChannel, Channel>);
+	_channelFactory.registerClass("BinaryLogChannel", new Instantiator<BinaryLogChannel, Channel>);
+	_channelFactory.registerClass("ThrottleChannel", new Instantiator<ThrottleChannel, Channel>);
 #endif
 	_channelFactory.registerClass("FormattingChannel", new Instantiator<FormattingChannel, Channel>);
 #ifndef POCO_NO_SPLITTERCHANNEL
@@ -0,0 +1,96 @@
+//
+// MemoryMappedFile.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  MemoryMappedFile
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/MemoryMappedFile.h"
+#include "Poco/File.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/mman.h>
+#endif
+
+
+namespace Poco {
+
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path):
+	_size(0)
+{
+	File file(path);
+	if (file.getSize() > 0)
+	{
+		SharedMemory memory(file, SharedMemory::AM_READ);
+		_memory.swap(memory);
+		_size = static_cast<std::size_t>(_memory.end() - _memory.begin());
+	}
+}
+
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+}
+
+
+const char* MemoryMappedFile::begin() const
+{
+	return _memory.begin();
+}
+
+
+const char* MemoryMappedFile::end() const
+{
+	return _memory.end();
+}
+
+
+void MemoryMappedFile::advise(Advice advice)
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	if (_size == 0) return;
+
+	int adv;
+	switch (advice)
+	{
+	case ADV_SEQUENTIAL:
+		adv = MADV_SEQUENTIAL;
+		break;
+	case ADV_RANDOM:
+		adv = MADV_RANDOM;
+		break;
+	case ADV_WILLNEED:
+		adv = MADV_WILLNEED;
+		break;
+	case ADV_DONTNEED:
+		adv = MADV_DONTNEED;
+		break;
+	default:
+		adv = MADV_NORMAL;
+		break;
+	}
+	madvise(_memory.begin(), _size, adv); // advisory only; ignore errors
+#endif
+}
+
+
+MemoryMappedInputStream::MemoryMappedInputStream(const std::string& path):
+	MemoryMappedFile(path),
+	MemoryInputStream(begin(), static_cast<std::streamsize>(size()))
+{
+}
+
+
+MemoryMappedInputStream::~MemoryMappedInputStream()
+{
+}
+
+
+} // namespace Poco
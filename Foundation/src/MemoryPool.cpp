@@ -14,11 +14,49 @@
 
 #include "Poco/MemoryPool.h"
 #include "Poco/Exception.h"
+#include <algorithm>
 
 
 namespace Poco {
 
 
+struct MemoryPool::Magazine
+	/// A small per-thread cache of memory blocks belonging to
+	/// one pool. The owning thread accesses it without locking;
+	/// only refills, flushes and retirement touch the pool's
+	/// shared state.
+{
+	MemoryPool* pPool;
+	int         count;
+	char*       blocks[MAGAZINE_CAPACITY];
+};
+
+
+struct MemoryPool::MagazineHolder
+	/// Holds the calling thread's magazines, one per pool the
+	/// thread has used. On thread exit, the destructor returns
+	/// all cached blocks to their pools. Magazines whose pool
+	/// has already been destroyed (pPool == 0) are simply deleted.
+{
+	~MagazineHolder()
+	{
+		for (MagazineVec::iterator it = magazines.begin(); it != magazines.end(); ++it)
+		{
+			if ((*it)->pPool) (*it)->pPool->retireMagazine(*it);
+			delete *it;
+		}
+	}
+
+	static MagazineHolder& current()
+	{
+		static thread_local MagazineHolder holder;
+		return holder;
+	}
+
+	MagazineVec magazines;
+};
+
+
 MemoryPool::MemoryPool(std::size_t blockSize, int preAlloc, int maxAlloc):
 	_blockSize(blockSize),
 	_maxAlloc(maxAlloc),
@@ -33,7 +71,7 @@ MemoryPool::MemoryPool(std::size_t blockSize, int preAlloc, int maxAlloc):
 	if (maxAlloc > 0 && maxAlloc < r)
 		r = maxAlloc;
 	_blocks.reserve(r);
-	
+
 	try
 	{
 		for (int i = 0; i < preAlloc; ++i)
@@ -48,9 +86,22 @@ MemoryPool::MemoryPool(std::size_t blockSize, int preAlloc, int maxAlloc):
 	}
 }
 
-	
+
 MemoryPool::~MemoryPool()
 {
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		for (MagazineVec::iterator it = _magazines.begin(); it != _magazines.end(); ++it)
+		{
+			for (int i = 0; i < (*it)->count; ++i)
+			{
+				delete [] (*it)->blocks[i];
+			}
+			(*it)->count = 0;
+			(*it)->pPool = 0;
+		}
+		_magazines.clear();
+	}
 	clear();
 }
 
@@ -67,11 +118,19 @@ void MemoryPool::clear()
 
 void* MemoryPool::get()
 {
+	if (_maxAlloc == 0)
+	{
+		Magazine* pMagazine = currentMagazine();
+		if (pMagazine->count == 0)
+			refillMagazine(pMagazine);
+		return pMagazine->blocks[--pMagazine->count];
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
-	
+
 	if (_blocks.empty())
 	{
-		if (_maxAlloc == 0 || _allocated < _maxAlloc)
+		if (_allocated < _maxAlloc)
 		{
 			++_allocated;
 			return new char[_blockSize];
@@ -86,11 +145,20 @@ void* MemoryPool::get()
 	}
 }
 
-	
+
 void MemoryPool::release(void* ptr)
 {
+	if (_maxAlloc == 0)
+	{
+		Magazine* pMagazine = currentMagazine();
+		if (pMagazine->count == MAGAZINE_CAPACITY)
+			flushMagazine(pMagazine);
+		pMagazine->blocks[pMagazine->count++] = reinterpret_cast<char*>(ptr);
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
-	
+
 	try
 	{
 		_blocks.push_back(reinterpret_cast<char*>(ptr));
@@ -102,4 +170,98 @@ void MemoryPool::release(void* ptr)
 }
 
 
+MemoryPool::Magazine* MemoryPool::currentMagazine()
+{
+	static thread_local Magazine* lastMagazine(0);
+	if (lastMagazine && lastMagazine->pPool == this)
+		return lastMagazine;
+
+	MagazineHolder& holder = MagazineHolder::current();
+	for (MagazineVec::iterator it = holder.magazines.begin(); it != holder.magazines.end(); ++it)
+	{
+		if ((*it)->pPool == this)
+		{
+			lastMagazine = *it;
+			return lastMagazine;
+		}
+	}
+
+	Magazine* pMagazine = new Magazine;
+	pMagazine->pPool = this;
+	pMagazine->count = 0;
+	try
+	{
+		holder.magazines.push_back(pMagazine);
+	}
+	catch (...)
+	{
+		delete pMagazine;
+		throw;
+	}
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_magazines.push_back(pMagazine);
+	}
+	lastMagazine = pMagazine;
+	return pMagazine;
+}
+
+
+void MemoryPool::refillMagazine(Magazine* pMagazine)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	while (pMagazine->count < MAGAZINE_CAPACITY/2 && !_blocks.empty())
+	{
+		pMagazine->blocks[pMagazine->count++] = _blocks.back();
+		_blocks.pop_back();
+	}
+	if (pMagazine->count == 0)
+	{
+		++_allocated;
+		pMagazine->blocks[pMagazine->count++] = new char[_blockSize];
+	}
+}
+
+
+void MemoryPool::flushMagazine(Magazine* pMagazine)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	while (pMagazine->count > MAGAZINE_CAPACITY/2)
+	{
+		char* ptr = pMagazine->blocks[--pMagazine->count];
+		try
+		{
+			_blocks.push_back(ptr);
+		}
+		catch (...)
+		{
+			delete [] ptr;
+		}
+	}
+}
+
+
+void MemoryPool::retireMagazine(Magazine* pMagazine)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	while (pMagazine->count > 0)
+	{
+		char* ptr = pMagazine->blocks[--pMagazine->count];
+		try
+		{
+			_blocks.push_back(ptr);
+		}
+		catch (...)
+		{
+			delete [] ptr;
+		}
+	}
+	MagazineVec::iterator it = std::find(_magazines.begin(), _magazines.end(), pMagazine);
+	if (it != _magazines.end()) _magazines.erase(it);
+}
+
+
 } // namespace Poco
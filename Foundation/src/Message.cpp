@@ -19,6 +19,7 @@
 #endif
 #include "Poco/Thread.h"
 #include <algorithm>
+#include <utility>
 
 
 namespace Poco {
@@ -100,6 +101,38 @@ Message::Message(const Message& msg, const std::string& text):
 }
 
 
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+Message::Message(std::string&& source, std::string&& text, Priority prio): 
+	_source(std::move(source)), 
+	_text(std::move(text)), 
+	_prio(prio), 
+	_tid(0),
+	_pid(0),
+	_file(0),
+	_line(0),
+	_pMap(0) 
+{
+	init();
+}
+
+
+Message::Message(Message&& msg):
+	_source(std::move(msg._source)),
+	_text(std::move(msg._text)),
+	_prio(msg._prio),
+	_time(msg._time),
+	_tid(msg._tid),
+	_thread(std::move(msg._thread)),
+	_pid(msg._pid),
+	_file(msg._file),
+	_line(msg._line),
+	_pMap(msg._pMap)
+{
+	msg._pMap = 0;
+}
+#endif
+
+
 Message::~Message()
 {
 	delete _pMap;
@@ -131,6 +164,29 @@ Message& Message::operator = (const Message& msg)
 }
 
 
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+Message& Message::operator = (Message&& msg)
+{
+	if (&msg != this)
+	{
+		_source = std::move(msg._source);
+		_text   = std::move(msg._text);
+		_prio   = msg._prio;
+		_time   = msg._time;
+		_tid    = msg._tid;
+		_thread = std::move(msg._thread);
+		_pid    = msg._pid;
+		_file   = msg._file;
+		_line   = msg._line;
+		delete _pMap;
+		_pMap = msg._pMap;
+		msg._pMap = 0;
+	}
+	return *this;
+}
+#endif
+
+
 void Message::swap(Message& msg)
 {
 	using std::swap;
@@ -153,12 +209,28 @@ void Message::setSource(const std::string& src)
 }
 
 
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+void Message::setSource(std::string&& src)
+{
+	_source = std::move(src);
+}
+#endif
+
+
 void Message::setText(const std::string& text)
 {
 	_text = text;
 }
 
 
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+void Message::setText(std::string&& text)
+{
+	_text = std::move(text);
+}
+#endif
+
+
 void Message::setPriority(Priority prio)
 {
 	_prio = prio;
@@ -177,6 +249,14 @@ void Message::setThread(const std::string& thread)
 }
 
 
+#if defined(POCO_MESSAGE_HAVE_RVALUE_REFS)
+void Message::setThread(std::string&& thread)
+{
+	_thread = std::move(thread);
+}
+#endif
+
+
 void Message::setTid(long tid)
 {
 	_tid = tid;
@@ -247,6 +327,17 @@ void Message::set(const std::string& param, const std::string& value)
 }
 
 
+const Message::StringMap& Message::getParameters() const
+{
+	static const StringMap emptyMap;
+
+	if (_pMap)
+		return *_pMap;
+	else
+		return emptyMap;
+}
+
+
 const std::string& Message::operator [] (const std::string& param) const
 {
 	if (_pMap)
@@ -0,0 +1,435 @@
+//
+// Metrics.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  Metrics
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Metrics.h"
+#include "Poco/AtomicCounter.h"
+#include "Poco/JSONString.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/SingletonHolder.h"
+
+
+namespace Poco {
+namespace Metrics {
+
+
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+namespace
+{
+	std::atomic<unsigned> shardCounter(0);
+
+	inline std::size_t currentShard()
+	{
+		static thread_local std::size_t shard = shardCounter++ % Counter::SHARD_COUNT;
+		return shard;
+	}
+}
+#endif
+
+
+//
+// Counter
+//
+
+
+Counter::Counter()
+#if !defined(POCO_METRICS_HAVE_ATOMICS)
+	: _value(0)
+#endif
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		_shards[i].value.store(0, std::memory_order_relaxed);
+	}
+#endif
+}
+
+
+Counter::~Counter()
+{
+}
+
+
+void Counter::increment()
+{
+	increment(1);
+}
+
+
+void Counter::increment(Int64 n)
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	_shards[currentShard()].value.fetch_add(n, std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	_value += n;
+#endif
+}
+
+
+Int64 Counter::value() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	Int64 total = 0;
+	for (int i = 0; i < SHARD_COUNT; i++)
+	{
+		total += _shards[i].value.load(std::memory_order_relaxed);
+	}
+	return total;
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _value;
+#endif
+}
+
+
+//
+// Gauge
+//
+
+
+Gauge::Gauge():
+	_value(0)
+{
+}
+
+
+Gauge::~Gauge()
+{
+}
+
+
+void Gauge::set(Int64 value)
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	_value.store(value, std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	_value = value;
+#endif
+}
+
+
+void Gauge::add(Int64 n)
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	_value.fetch_add(n, std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	_value += n;
+#endif
+}
+
+
+void Gauge::subtract(Int64 n)
+{
+	add(-n);
+}
+
+
+Int64 Gauge::value() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	return _value.load(std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _value;
+#endif
+}
+
+
+//
+// Histogram
+//
+
+
+Histogram::Histogram():
+	_count(0),
+	_sum(0),
+	_min(0),
+	_max(0)
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		_buckets[i].store(0, std::memory_order_relaxed);
+	}
+#else
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		_buckets[i] = 0;
+	}
+#endif
+}
+
+
+Histogram::~Histogram()
+{
+}
+
+
+int Histogram::bucketOf(Int64 value)
+{
+	int bucket = 0;
+	UInt64 v = static_cast<UInt64>(value);
+	while (v >>= 1) ++bucket;
+	return bucket;
+}
+
+
+void Histogram::update(Int64 value)
+{
+	if (value < 0) value = 0;
+
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	_buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+	_sum.fetch_add(value, std::memory_order_relaxed);
+	Int64 seen = _min.load(std::memory_order_relaxed);
+	while ((_count.load(std::memory_order_relaxed) == 0 || value < seen) && !_min.compare_exchange_weak(seen, value, std::memory_order_relaxed));
+	seen = _max.load(std::memory_order_relaxed);
+	while (value > seen && !_max.compare_exchange_weak(seen, value, std::memory_order_relaxed));
+	_count.fetch_add(1, std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	_buckets[bucketOf(value)]++;
+	_sum += value;
+	if (_count == 0 || value < _min) _min = value;
+	if (value > _max) _max = value;
+	_count++;
+#endif
+}
+
+
+Int64 Histogram::count() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	return _count.load(std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _count;
+#endif
+}
+
+
+Int64 Histogram::sum() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	return _sum.load(std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _sum;
+#endif
+}
+
+
+Int64 Histogram::minimum() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	return _min.load(std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _min;
+#endif
+}
+
+
+Int64 Histogram::maximum() const
+{
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	return _max.load(std::memory_order_relaxed);
+#else
+	FastMutex::ScopedLock lock(_mutex);
+	return _max;
+#endif
+}
+
+
+Int64 Histogram::quantile(double q) const
+{
+	if (q < 0.0) q = 0.0;
+	if (q > 1.0) q = 1.0;
+
+	Int64 counts[BUCKET_COUNT];
+	Int64 total = 0;
+#if defined(POCO_METRICS_HAVE_ATOMICS)
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		counts[i] = _buckets[i].load(std::memory_order_relaxed);
+		total += counts[i];
+	}
+#else
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		for (int i = 0; i < BUCKET_COUNT; i++)
+		{
+			counts[i] = _buckets[i];
+			total += counts[i];
+		}
+	}
+#endif
+	if (total == 0) return 0;
+
+	Int64 target = static_cast<Int64>(q*total);
+	if (target >= total) target = total - 1;
+	Int64 seen = 0;
+	for (int i = 0; i < BUCKET_COUNT; i++)
+	{
+		seen += counts[i];
+		if (seen > target)
+		{
+			if (i >= 62) return maximum();
+			Int64 upperBound = (Int64(1) << (i + 1)) - 1;
+			Int64 max = maximum();
+			return upperBound < max ? upperBound : max;
+		}
+	}
+	return maximum();
+}
+
+
+//
+// MetricsRegistry
+//
+
+
+namespace
+{
+	AtomicCounter metricsEnabled;
+}
+
+
+MetricsRegistry::MetricsRegistry()
+{
+}
+
+
+MetricsRegistry::~MetricsRegistry()
+{
+	for (CounterMap::iterator it = _counters.begin(); it != _counters.end(); ++it)
+		delete it->second;
+	for (GaugeMap::iterator it = _gauges.begin(); it != _gauges.end(); ++it)
+		delete it->second;
+	for (HistogramMap::iterator it = _histograms.begin(); it != _histograms.end(); ++it)
+		delete it->second;
+}
+
+
+Counter& MetricsRegistry::counter(const std::string& name)
+{
+	Mutex::ScopedLock lock(_mutex);
+
+	CounterMap::iterator it = _counters.find(name);
+	if (it != _counters.end()) return *it->second;
+	Counter* pCounter = new Counter;
+	_counters[name] = pCounter;
+	return *pCounter;
+}
+
+
+Gauge& MetricsRegistry::gauge(const std::string& name)
+{
+	Mutex::ScopedLock lock(_mutex);
+
+	GaugeMap::iterator it = _gauges.find(name);
+	if (it != _gauges.end()) return *it->second;
+	Gauge* pGauge = new Gauge;
+	_gauges[name] = pGauge;
+	return *pGauge;
+}
+
+
+Histogram& MetricsRegistry::histogram(const std::string& name)
+{
+	Mutex::ScopedLock lock(_mutex);
+
+	HistogramMap::iterator it = _histograms.find(name);
+	if (it != _histograms.end()) return *it->second;
+	Histogram* pHistogram = new Histogram;
+	_histograms[name] = pHistogram;
+	return *pHistogram;
+}
+
+
+std::string MetricsRegistry::toJSON() const
+{
+	Mutex::ScopedLock lock(_mutex);
+
+	std::string json("{\"counters\":{");
+	for (CounterMap::const_iterator it = _counters.begin(); it != _counters.end(); ++it)
+	{
+		if (it != _counters.begin()) json += ',';
+		json += Poco::toJSON(it->first);
+		json += ':';
+		NumberFormatter::append(json, it->second->value());
+	}
+	json += "},\"gauges\":{";
+	for (GaugeMap::const_iterator it = _gauges.begin(); it != _gauges.end(); ++it)
+	{
+		if (it != _gauges.begin()) json += ',';
+		json += Poco::toJSON(it->first);
+		json += ':';
+		NumberFormatter::append(json, it->second->value());
+	}
+	json += "},\"histograms\":{";
+	for (HistogramMap::const_iterator it = _histograms.begin(); it != _histograms.end(); ++it)
+	{
+		if (it != _histograms.begin()) json += ',';
+		const Histogram& histogram = *it->second;
+		json += Poco::toJSON(it->first);
+		json += ":{\"count\":";
+		NumberFormatter::append(json, histogram.count());
+		json += ",\"sum\":";
+		NumberFormatter::append(json, histogram.sum());
+		json += ",\"min\":";
+		NumberFormatter::append(json, histogram.minimum());
+		json += ",\"max\":";
+		NumberFormatter::append(json, histogram.maximum());
+		json += ",\"p50\":";
+		NumberFormatter::append(json, histogram.quantile(0.5));
+		json += ",\"p90\":";
+		NumberFormatter::append(json, histogram.quantile(0.9));
+		json += ",\"p99\":";
+		NumberFormatter::append(json, histogram.quantile(0.99));
+		json += '}';
+	}
+	json += "}}";
+	return json;
+}
+
+
+namespace
+{
+	static SingletonHolder<MetricsRegistry> sh;
+}
+
+
+MetricsRegistry& MetricsRegistry::defaultRegistry()
+{
+	return *sh.get();
+}
+
+
+bool MetricsRegistry::enabled()
+{
+	return metricsEnabled.value() != 0;
+}
+
+
+void MetricsRegistry::setEnabled(bool enabled)
+{
+	metricsEnabled = enabled ? 1 : 0;
+}
+
+
+} } // namespace Poco::Metrics
@@ -17,18 +17,38 @@
 #include "Poco/Observer.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/SingletonHolder.h"
+#include "Poco/Thread.h"
 
 
 namespace Poco {
 
 
-NotificationCenter::NotificationCenter()
+namespace
+{
+	// Number of postNotification() frames on the current thread's
+	// stack, across all NotificationCenter instances. Used to detect
+	// re-entrant observer registration changes from within a
+	// notification handler.
+	thread_local int postingDepth(0);
+}
+
+
+NotificationCenter::NotificationCenter():
+	_pSnapshot(new ObserverSnapshot),
+	_epoch(0)
 {
+	_readers[0] = 0;
+	_readers[1] = 0;
 }
 
 
 NotificationCenter::~NotificationCenter()
 {
+	delete _pSnapshot.load();
+	for (std::vector<ObserverSnapshot*>::iterator it = _retiredSnapshots.begin(); it != _retiredSnapshots.end(); ++it)
+	{
+		delete *it;
+	}
 }
 
 
@@ -36,6 +56,7 @@ void NotificationCenter::addObserver(const AbstractObserver& observer)
 {
 	Mutex::ScopedLock lock(_mutex);
 	_observers.push_back(observer.clone());
+	publishObservers();
 }
 
 
@@ -48,6 +69,7 @@ void NotificationCenter::removeObserver(const AbstractObserver& observer)
 		{
 			(*it)->disable();
 			_observers.erase(it);
+			publishObservers();
 			return;
 		}
 	}
@@ -68,13 +90,25 @@ void NotificationCenter::postNotification(Notification::Ptr pNotification)
 {
 	poco_check_ptr (pNotification);
 
-	ScopedLockWithUnlock<Mutex> lock(_mutex);
-	ObserverList observersToNotify(_observers);
-	lock.unlock();
-	for (ObserverList::iterator it = observersToNotify.begin(); it != observersToNotify.end(); ++it)
+	std::atomic<int>& readers = _readers[_epoch.load() & 1];
+	++readers;
+	++postingDepth;
+	try
 	{
-		(*it)->notify(pNotification);
+		ObserverSnapshot* pSnapshot = _pSnapshot.load();
+		for (ObserverList::iterator it = pSnapshot->observers.begin(); it != pSnapshot->observers.end(); ++it)
+		{
+			(*it)->notify(pNotification);
+		}
+	}
+	catch (...)
+	{
+		--postingDepth;
+		--readers;
+		throw;
 	}
+	--postingDepth;
+	--readers;
 }
 
 
@@ -94,6 +128,53 @@ std::size_t NotificationCenter::countObservers() const
 }
 
 
+void NotificationCenter::publishObservers()
+{
+	ObserverSnapshot* pNew = new ObserverSnapshot;
+	pNew->observers = _observers;
+	ObserverSnapshot* pOld = _pSnapshot.exchange(pNew);
+	if (postingDepth > 0)
+	{
+		// Called from within a notification handler; the calling
+		// thread itself is a reader, so waiting for the grace
+		// period would deadlock. Retire the snapshot instead;
+		// it is reclaimed by the next publication from outside
+		// a handler, or by the destructor.
+		_retiredSnapshots.push_back(pOld);
+	}
+	else
+	{
+		synchronize();
+		delete pOld;
+		for (std::vector<ObserverSnapshot*>::iterator it = _retiredSnapshots.begin(); it != _retiredSnapshots.end(); ++it)
+		{
+			delete *it;
+		}
+		_retiredSnapshots.clear();
+	}
+}
+
+
+void NotificationCenter::synchronize()
+{
+	// A reader increments a reader count before loading the current
+	// snapshot. Any reader that may still see the previous snapshot
+	// has therefore incremented one of the two counts before it was
+	// exchanged. Flipping the epoch twice and draining the count
+	// associated with each previous epoch guarantees that all such
+	// readers have finished; new readers increment the other count
+	// and obtain the new snapshot, so the waits terminate.
+	for (int flip = 0; flip < 2; flip++)
+	{
+		unsigned epoch = _epoch.fetch_add(1);
+		while (_readers[epoch & 1].load() > 0)
+		{
+			Thread::yield();
+		}
+	}
+}
+
+
 namespace
 {
 	static SingletonHolder<NotificationCenter> sh;
@@ -16,12 +16,16 @@
 #include "Poco/NotificationCenter.h"
 #include "Poco/Notification.h"
 #include "Poco/SingletonHolder.h"
+#include "Poco/Metrics.h"
+#include "Poco/Clock.h"
 
 
 namespace Poco {
 
 
-NotificationQueue::NotificationQueue()
+NotificationQueue::NotificationQueue():
+	_pDepthGauge(0),
+	_pWaitHistogram(0)
 {
 }
 
@@ -53,7 +57,8 @@ void NotificationQueue::enqueueNotification(Notification::Ptr pNotification)
 		_waitQueue.pop_front();
 		pWI->pNf = pNotification;
 		pWI->nfAvailable.set();
-	}	
+	}
+	updateDepth();
 }
 
 
@@ -71,14 +76,17 @@ void NotificationQueue::enqueueUrgentNotification(Notification::Ptr pNotificatio
 		_waitQueue.pop_front();
 		pWI->pNf = pNotification;
 		pWI->nfAvailable.set();
-	}	
+	}
+	updateDepth();
 }
 
 
 Notification* NotificationQueue::dequeueNotification()
 {
 	FastMutex::ScopedLock lock(_mutex);
-	return dequeueOne().duplicate();
+	Notification* pNf = dequeueOne().duplicate();
+	updateDepth();
+	return pNf;
 }
 
 
@@ -86,14 +94,30 @@ Notification* NotificationQueue::waitDequeueNotification()
 {
 	Notification::Ptr pNf;
 	WaitInfo* pWI = 0;
+	Metrics::Histogram* pWaitHistogram = 0;
 	{
 		FastMutex::ScopedLock lock(_mutex);
 		pNf = dequeueOne();
-		if (pNf) return pNf.duplicate();
+		if (pNf)
+		{
+			updateDepth();
+			return pNf.duplicate();
+		}
 		pWI = new WaitInfo;
 		_waitQueue.push_back(pWI);
+		if (_pWaitHistogram && Metrics::MetricsRegistry::enabled())
+			pWaitHistogram = _pWaitHistogram;
+	}
+	if (pWaitHistogram)
+	{
+		Clock start;
+		pWI->nfAvailable.wait();
+		pWaitHistogram->update(start.elapsed());
+	}
+	else
+	{
+		pWI->nfAvailable.wait();
 	}
-	pWI->nfAvailable.wait();
 	pNf = pWI->pNf;
 	delete pWI;
 	return pNf.duplicate();
@@ -104,15 +128,24 @@ Notification* NotificationQueue::waitDequeueNotification(long milliseconds)
 {
 	Notification::Ptr pNf;
 	WaitInfo* pWI = 0;
+	Metrics::Histogram* pWaitHistogram = 0;
 	{
 		FastMutex::ScopedLock lock(_mutex);
 		pNf = dequeueOne();
-		if (pNf) return pNf.duplicate();
+		if (pNf)
+		{
+			updateDepth();
+			return pNf.duplicate();
+		}
 		pWI = new WaitInfo;
 		_waitQueue.push_back(pWI);
+		if (_pWaitHistogram && Metrics::MetricsRegistry::enabled())
+			pWaitHistogram = _pWaitHistogram;
 	}
+	Clock start;
 	if (pWI->nfAvailable.tryWait(milliseconds))
 	{
+		if (pWaitHistogram) pWaitHistogram->update(start.elapsed());
 		pNf = pWI->pNf;
 	}
 	else
@@ -133,6 +166,96 @@ Notification* NotificationQueue::waitDequeueNotification(long milliseconds)
 }
 
 
+int NotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	int count = 0;
+	while (count < maxCount)
+	{
+		Notification::Ptr pNf = dequeueOne();
+		if (!pNf) break;
+		notifications.push_back(pNf);
+		++count;
+	}
+	return count;
+}
+
+
+int NotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	if (maxCount <= 0) return 0;
+
+	int count = dequeueBatch(notifications, maxCount);
+	if (count > 0) return count;
+
+	Notification::Ptr pNf;
+	WaitInfo* pWI = 0;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pNf = dequeueOne();
+		if (!pNf)
+		{
+			pWI = new WaitInfo;
+			_waitQueue.push_back(pWI);
+		}
+	}
+	if (pWI)
+	{
+		pWI->nfAvailable.wait();
+		pNf = pWI->pNf;
+		delete pWI;
+	}
+	if (!pNf) return 0;
+	notifications.push_back(pNf);
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+int NotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds)
+{
+	if (maxCount <= 0) return 0;
+
+	int count = dequeueBatch(notifications, maxCount);
+	if (count > 0) return count;
+
+	Notification::Ptr pNf;
+	WaitInfo* pWI = 0;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pNf = dequeueOne();
+		if (!pNf)
+		{
+			pWI = new WaitInfo;
+			_waitQueue.push_back(pWI);
+		}
+	}
+	if (pWI)
+	{
+		if (pWI->nfAvailable.tryWait(milliseconds))
+		{
+			pNf = pWI->pNf;
+		}
+		else
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			pNf = pWI->pNf;
+			for (WaitQueue::iterator it = _waitQueue.begin(); it != _waitQueue.end(); ++it)
+			{
+				if (*it == pWI)
+				{
+					_waitQueue.erase(it);
+					break;
+				}
+			}
+		}
+		delete pWI;
+	}
+	if (!pNf) return 0;
+	notifications.push_back(pNf);
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
 void NotificationQueue::dispatch(NotificationCenter& notificationCenter)
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -174,6 +297,24 @@ void NotificationQueue::clear()
 {
 	FastMutex::ScopedLock lock(_mutex);
 	_nfQueue.clear();	
+	updateDepth();
+}
+
+
+void NotificationQueue::enableMetrics(const std::string& name)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	Metrics::MetricsRegistry& registry = Metrics::MetricsRegistry::defaultRegistry();
+	_pDepthGauge = &registry.gauge(name + ".depth");
+	_pWaitHistogram = &registry.histogram(name + ".waitTime");
+	updateDepth();
+}
+
+
+void NotificationQueue::updateDepth()
+{
+	if (_pDepthGauge && Metrics::MetricsRegistry::enabled())
+		_pDepthGauge->set(static_cast<Int64>(_nfQueue.size()));
 }
 
 
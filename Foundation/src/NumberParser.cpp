@@ -18,6 +18,8 @@
 #include "Poco/NumericString.h"
 #include <cstdio>
 #include <cctype>
+#include <cstring>
+#include <limits>
 #include <stdlib.h>
 #if !defined(POCO_NO_LOCALE)
 	#include <locale>
@@ -38,6 +40,86 @@
 namespace Poco {
 
 
+namespace
+{
+#if defined(POCO_ARCH_LITTLE_ENDIAN)
+	inline bool allEightDigits(UInt64 chunk)
+		/// Returns true if all eight bytes of chunk are
+		/// ASCII decimal digits.
+	{
+		return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+			(((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+	}
+
+
+	inline UInt32 parseEightDigits(UInt64 chunk)
+		/// Converts eight ASCII decimal digits to their numeric
+		/// value with three multiplications (SWAR).
+	{
+		chunk &= 0x0F0F0F0F0F0F0F0FULL;
+		chunk = (chunk * 2561) >> 8;
+		chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+		return UInt32(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+	}
+#endif
+
+
+	template <typename T>
+	bool parseDecimalUnsigned(const char* s, std::size_t length, T& value)
+	{
+		if (length == 0) return false;
+		T result = 0;
+		std::size_t i = 0;
+#if defined(POCO_ARCH_LITTLE_ENDIAN)
+		while (length - i >= 8 && result <= (std::numeric_limits<T>::max() - 99999999) / 100000000)
+		{
+			UInt64 chunk;
+			std::memcpy(&chunk, s + i, sizeof(chunk));
+			if (!allEightDigits(chunk)) break;
+			result = result * 100000000 + parseEightDigits(chunk);
+			i += 8;
+		}
+#endif
+		for (; i < length; ++i)
+		{
+			const char c = s[i];
+			if (c < '0' || c > '9') return false;
+			const T digit = T(c - '0');
+			if (result > (std::numeric_limits<T>::max() - digit) / 10) return false;
+			result = result * 10 + digit;
+		}
+		value = result;
+		return true;
+	}
+
+
+	template <typename T, typename UT>
+	bool parseDecimalSigned(const char* s, std::size_t length, T& value)
+	{
+		bool negative = false;
+		if (length > 0 && (*s == '-' || *s == '+'))
+		{
+			negative = (*s == '-');
+			++s;
+			--length;
+		}
+		UT magnitude;
+		if (!parseDecimalUnsigned(s, length, magnitude)) return false;
+		if (negative)
+		{
+			if (magnitude > UT(std::numeric_limits<T>::max()) + 1) return false;
+			value = T(UT(0) - magnitude);
+		}
+		else
+		{
+			if (magnitude > UT(std::numeric_limits<T>::max())) return false;
+			value = T(magnitude);
+		}
+		return true;
+	}
+}
+
+
 int NumberParser::parse(const std::string& s, char thSep)
 {
 	int result;
@@ -176,6 +258,60 @@ bool NumberParser::tryParseOct64(const std::string& s, UInt64& value)
 #endif // defined(POCO_HAVE_INT64)
 
 
+bool NumberParser::tryParse(const char* s, std::size_t length, int& value)
+{
+	poco_check_ptr (s);
+	return parseDecimalSigned<int, unsigned>(s, length, value);
+}
+
+
+bool NumberParser::tryParseUnsigned(const char* s, std::size_t length, unsigned& value)
+{
+	poco_check_ptr (s);
+	return parseDecimalUnsigned(s, length, value);
+}
+
+
+#if defined(POCO_HAVE_INT64)
+
+
+bool NumberParser::tryParse64(const char* s, std::size_t length, Int64& value)
+{
+	poco_check_ptr (s);
+	return parseDecimalSigned<Int64, UInt64>(s, length, value);
+}
+
+
+bool NumberParser::tryParseUnsigned64(const char* s, std::size_t length, UInt64& value)
+{
+	poco_check_ptr (s);
+	return parseDecimalUnsigned(s, length, value);
+}
+
+
+std::size_t NumberParser::tryParseArray(const char* s, std::size_t length, Int64* values, std::size_t count, char delimiter)
+{
+	poco_check_ptr (s);
+	poco_check_ptr (values);
+
+	std::size_t parsed = 0;
+	std::size_t pos = 0;
+	while (parsed < count)
+	{
+		std::size_t start = pos;
+		while (pos < length && s[pos] != delimiter) ++pos;
+		if (!parseDecimalSigned<Int64, UInt64>(s + start, pos - start, values[parsed])) break;
+		++parsed;
+		if (pos >= length) break;
+		++pos; // skip the delimiter
+	}
+	return parsed;
+}
+
+
+#endif // defined(POCO_HAVE_INT64)
+
+
 double NumberParser::parseFloat(const std::string& s, char decSep, char thSep)
 {
 	double result;
@@ -0,0 +1,412 @@
+//
+// ParallelDeflatingStream.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  ParallelDeflatingStream
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ParallelDeflatingStream.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+ParallelDeflatingStreamBuf::CompressTask::CompressTask(ParallelDeflatingStreamBuf& parent, UInt32 sequence, const char* data, std::size_t length, bool finalBlock):
+	_parent(parent),
+	_sequence(sequence),
+	_input(length),
+	_inputLength(length),
+	_finalBlock(finalBlock),
+	_output(0),
+	_outputLength(0),
+	_checksum(0),
+	_error(false)
+{
+	if (length > 0)
+	{
+		std::memcpy(_input.begin(), data, length);
+	}
+}
+
+
+void ParallelDeflatingStreamBuf::CompressTask::run()
+{
+	try
+	{
+		z_stream zstr;
+		zstr.zalloc = Z_NULL;
+		zstr.zfree  = Z_NULL;
+		zstr.opaque = Z_NULL;
+
+		int rc = deflateInit2(&zstr, _parent._level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		if (rc != Z_OK) throw IOException(zError(rc));
+
+		std::size_t bound = deflateBound(&zstr, static_cast<uLong>(_inputLength)) + 16;
+		_output.resize(bound, false);
+
+		zstr.next_in   = reinterpret_cast<unsigned char*>(_input.begin());
+		zstr.avail_in  = static_cast<unsigned>(_inputLength);
+		zstr.next_out  = reinterpret_cast<unsigned char*>(_output.begin());
+		zstr.avail_out = static_cast<unsigned>(bound);
+
+		rc = deflate(&zstr, _finalBlock ? Z_FINISH : Z_SYNC_FLUSH);
+		if (rc != Z_OK && rc != Z_STREAM_END)
+		{
+			deflateEnd(&zstr);
+			throw IOException(zError(rc));
+		}
+		_outputLength = bound - zstr.avail_out;
+		deflateEnd(&zstr);
+
+		if (_parent._type == DeflatingStreamBuf::STREAM_GZIP)
+			_checksum = static_cast<UInt32>(crc32(crc32(0, Z_NULL, 0), reinterpret_cast<unsigned char*>(_input.begin()), static_cast<unsigned>(_inputLength)));
+		else
+			_checksum = static_cast<UInt32>(adler32(adler32(0, Z_NULL, 0), reinterpret_cast<unsigned char*>(_input.begin()), static_cast<unsigned>(_inputLength)));
+	}
+	catch (std::exception& exc)
+	{
+		_error = true;
+		_errorMessage = exc.what();
+	}
+	catch (...)
+	{
+		_error = true;
+		_errorMessage = "unknown error";
+	}
+	_parent.taskDone(this);
+}
+
+
+UInt32 ParallelDeflatingStreamBuf::CompressTask::sequence() const
+{
+	return _sequence;
+}
+
+
+const char* ParallelDeflatingStreamBuf::CompressTask::data() const
+{
+	return _output.begin();
+}
+
+
+std::size_t ParallelDeflatingStreamBuf::CompressTask::size() const
+{
+	return _outputLength;
+}
+
+
+std::size_t ParallelDeflatingStreamBuf::CompressTask::uncompressedSize() const
+{
+	return _inputLength;
+}
+
+
+UInt32 ParallelDeflatingStreamBuf::CompressTask::checksum() const
+{
+	return _checksum;
+}
+
+
+bool ParallelDeflatingStreamBuf::CompressTask::error() const
+{
+	return _error;
+}
+
+
+const std::string& ParallelDeflatingStreamBuf::CompressTask::errorMessage() const
+{
+	return _errorMessage;
+}
+
+
+ParallelDeflatingStreamBuf::ParallelDeflatingStreamBuf(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, std::size_t blockSize, ThreadPool& pool):
+	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::out),
+	_pOstr(&ostr),
+	_type(type),
+	_level(level),
+	_blockSize(blockSize < MIN_BLOCK_SIZE ? MIN_BLOCK_SIZE : blockSize),
+	_pool(pool),
+	_maxPending(pool.capacity() + 2),
+	_block(_blockSize),
+	_blockFill(0),
+	_nextSubmit(0),
+	_nextWrite(0),
+	_headerWritten(false),
+	_totalIn(0)
+{
+	if (type == DeflatingStreamBuf::STREAM_GZIP)
+		_checksum = static_cast<UInt32>(crc32(0, Z_NULL, 0));
+	else
+		_checksum = static_cast<UInt32>(adler32(0, Z_NULL, 0));
+}
+
+
+ParallelDeflatingStreamBuf::~ParallelDeflatingStreamBuf()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+	}
+	FastMutex::ScopedLock lock(_mutex);
+	while (_done.size() < _nextSubmit - _nextWrite)
+	{
+		_taskDone.wait(_mutex);
+	}
+	for (std::map<UInt32, CompressTask*>::iterator it = _done.begin(); it != _done.end(); ++it)
+	{
+		delete it->second;
+	}
+	_done.clear();
+}
+
+
+int ParallelDeflatingStreamBuf::close()
+{
+	BufferedStreamBuf::sync();
+	if (_pOstr)
+	{
+		submitBlock(true);
+		drainAll();
+		writeTrailer();
+		_pOstr->flush();
+		if (!_pOstr->good()) throw IOException("error writing deflated data");
+		_pOstr = 0;
+	}
+	return 0;
+}
+
+
+int ParallelDeflatingStreamBuf::sync()
+{
+	if (BufferedStreamBuf::sync())
+		return -1;
+
+	if (_pOstr)
+	{
+		if (_blockFill > 0) submitBlock(false);
+		drainAll();
+		// NOTE: analogous to DeflatingStreamBuf::sync(), the underlying
+		// stream is not flushed here. See GH #1828.
+	}
+	return 0;
+}
+
+
+int ParallelDeflatingStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
+{
+	if (length == 0 || !_pOstr) return 0;
+
+	std::streamsize written = 0;
+	while (written < length)
+	{
+		std::size_t n = static_cast<std::size_t>(length - written);
+		if (n > _blockSize - _blockFill) n = _blockSize - _blockFill;
+		std::memcpy(_block.begin() + _blockFill, buffer + written, n);
+		_blockFill += n;
+		written    += n;
+		if (_blockFill == _blockSize) submitBlock(false);
+	}
+	return static_cast<int>(length);
+}
+
+
+void ParallelDeflatingStreamBuf::submitBlock(bool finalBlock)
+{
+	while (_nextSubmit - _nextWrite >= _maxPending)
+	{
+		drainOne();
+	}
+
+	CompressTask* pTask = new CompressTask(*this, _nextSubmit, _block.begin(), _blockFill, finalBlock);
+	++_nextSubmit;
+	_blockFill = 0;
+	try
+	{
+		_pool.start(*pTask);
+	}
+	catch (NoThreadAvailableException&)
+	{
+		pTask->run();
+	}
+}
+
+
+void ParallelDeflatingStreamBuf::drainOne()
+{
+	CompressTask* pTask = 0;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		std::map<UInt32, CompressTask*>::iterator it;
+		while ((it = _done.find(_nextWrite)) == _done.end())
+		{
+			_taskDone.wait(_mutex);
+		}
+		pTask = it->second;
+		_done.erase(it);
+	}
+
+	if (pTask->error())
+	{
+		std::string msg = pTask->errorMessage();
+		delete pTask;
+		throw IOException(msg);
+	}
+
+	if (!_headerWritten) writeHeader();
+	_pOstr->write(pTask->data(), static_cast<std::streamsize>(pTask->size()));
+	if (!_pOstr->good())
+	{
+		delete pTask;
+		throw IOException("error writing deflated data");
+	}
+	if (_type == DeflatingStreamBuf::STREAM_GZIP)
+		_checksum = static_cast<UInt32>(crc32_combine(_checksum, pTask->checksum(), static_cast<z_off_t>(pTask->uncompressedSize())));
+	else
+		_checksum = static_cast<UInt32>(adler32_combine(_checksum, pTask->checksum(), static_cast<z_off_t>(pTask->uncompressedSize())));
+	_totalIn += pTask->uncompressedSize();
+	++_nextWrite;
+	delete pTask;
+}
+
+
+void ParallelDeflatingStreamBuf::drainAll()
+{
+	while (_nextWrite != _nextSubmit)
+	{
+		drainOne();
+	}
+}
+
+
+void ParallelDeflatingStreamBuf::taskDone(CompressTask* pTask)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	_done[pTask->sequence()] = pTask;
+	_taskDone.broadcast();
+}
+
+
+void ParallelDeflatingStreamBuf::writeHeader()
+{
+	if (_type == DeflatingStreamBuf::STREAM_GZIP)
+	{
+		static const char GZIP_HEADER[] =
+		{
+			'\x1F', '\x8B', '\x08', '\x00',  // magic, deflate, no flags
+			'\x00', '\x00', '\x00', '\x00',  // no modification time
+			'\x00', '\xFF'                   // no extra flags, unknown OS
+		};
+		_pOstr->write(GZIP_HEADER, sizeof(GZIP_HEADER));
+	}
+	else
+	{
+		// compression level bits as set by zlib's deflate()
+		int level = (_level == Z_DEFAULT_COMPRESSION) ? 6 : _level;
+		int levelFlags;
+		if (level < 2)
+			levelFlags = 0;
+		else if (level < 6)
+			levelFlags = 1;
+		else if (level == 6)
+			levelFlags = 2;
+		else
+			levelFlags = 3;
+		unsigned header = (0x78 << 8) + (levelFlags << 6);
+		header += 31 - (header % 31);
+		char zlibHeader[2];
+		zlibHeader[0] = static_cast<char>(header >> 8);
+		zlibHeader[1] = static_cast<char>(header & 0xFF);
+		_pOstr->write(zlibHeader, sizeof(zlibHeader));
+	}
+	if (!_pOstr->good()) throw IOException("error writing deflated data");
+	_headerWritten = true;
+}
+
+
+void ParallelDeflatingStreamBuf::writeTrailer()
+{
+	char trailer[8];
+	std::streamsize length;
+	if (_type == DeflatingStreamBuf::STREAM_GZIP)
+	{
+		// CRC-32 and uncompressed size, both little-endian
+		UInt32 size = static_cast<UInt32>(_totalIn);
+		trailer[0] = static_cast<char>(_checksum & 0xFF);
+		trailer[1] = static_cast<char>((_checksum >> 8) & 0xFF);
+		trailer[2] = static_cast<char>((_checksum >> 16) & 0xFF);
+		trailer[3] = static_cast<char>((_checksum >> 24) & 0xFF);
+		trailer[4] = static_cast<char>(size & 0xFF);
+		trailer[5] = static_cast<char>((size >> 8) & 0xFF);
+		trailer[6] = static_cast<char>((size >> 16) & 0xFF);
+		trailer[7] = static_cast<char>((size >> 24) & 0xFF);
+		length = 8;
+	}
+	else
+	{
+		// Adler-32, big-endian
+		trailer[0] = static_cast<char>((_checksum >> 24) & 0xFF);
+		trailer[1] = static_cast<char>((_checksum >> 16) & 0xFF);
+		trailer[2] = static_cast<char>((_checksum >> 8) & 0xFF);
+		trailer[3] = static_cast<char>(_checksum & 0xFF);
+		length = 4;
+	}
+	_pOstr->write(trailer, length);
+	if (!_pOstr->good()) throw IOException("error writing deflated data");
+}
+
+
+ParallelDeflatingIOS::ParallelDeflatingIOS(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, std::size_t blockSize, ThreadPool& pool):
+	_buf(ostr, type, level, blockSize, pool)
+{
+	poco_ios_init(&_buf);
+}
+
+
+ParallelDeflatingIOS::~ParallelDeflatingIOS()
+{
+}
+
+
+ParallelDeflatingStreamBuf* ParallelDeflatingIOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+ParallelDeflatingOutputStream::ParallelDeflatingOutputStream(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, std::size_t blockSize, ThreadPool& pool):
+	std::ostream(&_buf),
+	ParallelDeflatingIOS(ostr, type, level, blockSize, pool)
+{
+}
+
+
+ParallelDeflatingOutputStream::~ParallelDeflatingOutputStream()
+{
+}
+
+
+int ParallelDeflatingOutputStream::close()
+{
+	return _buf.close();
+}
+
+
+int ParallelDeflatingOutputStream::sync()
+{
+	return _buf.pubsync();
+}
+
+
+} // namespace Poco
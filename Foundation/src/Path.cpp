@@ -86,6 +86,20 @@ Path::Path(const Path& path):
 }
 
 
+#if defined(POCO_PATH_HAVE_RVALUE_REFS)
+Path::Path(Path&& path):
+	_node(std::move(path._node)),
+	_device(std::move(path._device)),
+	_name(std::move(path._name)),
+	_version(std::move(path._version)),
+	_dirs(std::move(path._dirs)),
+	_absolute(path._absolute)
+{
+	path.clear();
+}
+#endif
+
+
 Path::Path(const Path& parent, const std::string& fileName):
 	_node(parent._node),
 	_device(parent._device),
@@ -135,6 +149,24 @@ Path& Path::operator = (const Path& path)
 }
 
 
+#if defined(POCO_PATH_HAVE_RVALUE_REFS)
+Path& Path::operator = (Path&& path)
+{
+	if (&path != this)
+	{
+		_node     = std::move(path._node);
+		_device   = std::move(path._device);
+		_name     = std::move(path._name);
+		_version  = std::move(path._version);
+		_dirs     = std::move(path._dirs);
+		_absolute = path._absolute;
+		path.clear();
+	}
+	return *this;
+}
+#endif
+
+
 Path& Path::operator = (const std::string& path)
 {
 	return assign(path);
@@ -32,13 +32,17 @@ const std::string PatternFormatter::PROP_TIMES   = "times";
 
 
 PatternFormatter::PatternFormatter():
-	_localTime(false)
+	_localTime(false),
+	_needDateTime(false),
+	_cacheDateTime(false)
 {
 }
 
 
 PatternFormatter::PatternFormatter(const std::string& format):
 	_localTime(false),
+	_needDateTime(false),
+	_cacheDateTime(false),
 	_pattern(format)
 {
 	parsePattern();
@@ -59,7 +63,8 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 		timestamp += Timezone::utcOffset()*Timestamp::resolution();
 		timestamp += Timezone::dst()*Timestamp::resolution();
 	}
-	DateTime dateTime = timestamp;
+	DateTime dateTime;
+	if (_needDateTime) assignDateTime(dateTime, timestamp);
 	for (std::vector<PatternAction>::iterator ip = _patternActions.begin(); ip != _patternActions.end(); ++ip)
 	{
 		text.append(ip->prepend);
@@ -123,7 +128,7 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 				localTime = true;
 				timestamp += Timezone::utcOffset()*Timestamp::resolution();
 				timestamp += Timezone::dst()*Timestamp::resolution();
-				dateTime = timestamp;
+				assignDateTime(dateTime, timestamp);
 			}
 			break;
 		}
@@ -131,6 +136,27 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 }
 
 
+void PatternFormatter::assignDateTime(DateTime& dateTime, const Timestamp& timestamp)
+{
+	if (_cacheDateTime)
+	{
+		CachedDateTime& cache = _dateTimeCache.get();
+		Timestamp::TimeVal second = timestamp.epochMicroseconds()/Timestamp::resolution();
+		if (!cache.valid || cache.second != second)
+		{
+			cache.dateTime = timestamp;
+			cache.second   = second;
+			cache.valid    = true;
+		}
+		dateTime = cache.dateTime;
+	}
+	else
+	{
+		dateTime = timestamp;
+	}
+}
+
+
 void PatternFormatter::parsePattern()
 {
 	_patternActions.clear();
@@ -187,6 +213,27 @@ void PatternFormatter::parsePattern()
 	{
 		_patternActions.push_back(endAct);
 	}
+
+	_needDateTime = false;
+	bool subSecond = false;
+	for (std::vector<PatternAction>::const_iterator ip = _patternActions.begin(); ip != _patternActions.end(); ++ip)
+	{
+		switch (ip->key)
+		{
+		case 'w': case 'W': case 'b': case 'B':
+		case 'd': case 'e': case 'f': case 'm':
+		case 'n': case 'o': case 'y': case 'Y':
+		case 'H': case 'h': case 'a': case 'A':
+		case 'M': case 'S':
+			_needDateTime = true;
+			break;
+		case 'i': case 'c': case 'F':
+			_needDateTime = true;
+			subSecond = true;
+			break;
+		}
+	}
+	_cacheDateTime = _needDateTime && !subSecond;
 }
 
 	
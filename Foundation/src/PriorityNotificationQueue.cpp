@@ -116,6 +116,96 @@ Notification* PriorityNotificationQueue::waitDequeueNotification(long millisecon
 }
 
 
+int PriorityNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	int count = 0;
+	while (count < maxCount)
+	{
+		Notification::Ptr pNf = dequeueOne();
+		if (!pNf) break;
+		notifications.push_back(pNf);
+		++count;
+	}
+	return count;
+}
+
+
+int PriorityNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	if (maxCount <= 0) return 0;
+
+	int count = dequeueBatch(notifications, maxCount);
+	if (count > 0) return count;
+
+	Notification::Ptr pNf;
+	WaitInfo* pWI = 0;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pNf = dequeueOne();
+		if (!pNf)
+		{
+			pWI = new WaitInfo;
+			_waitQueue.push_back(pWI);
+		}
+	}
+	if (pWI)
+	{
+		pWI->nfAvailable.wait();
+		pNf = pWI->pNf;
+		delete pWI;
+	}
+	if (!pNf) return 0;
+	notifications.push_back(pNf);
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+int PriorityNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount, long milliseconds)
+{
+	if (maxCount <= 0) return 0;
+
+	int count = dequeueBatch(notifications, maxCount);
+	if (count > 0) return count;
+
+	Notification::Ptr pNf;
+	WaitInfo* pWI = 0;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pNf = dequeueOne();
+		if (!pNf)
+		{
+			pWI = new WaitInfo;
+			_waitQueue.push_back(pWI);
+		}
+	}
+	if (pWI)
+	{
+		if (pWI->nfAvailable.tryWait(milliseconds))
+		{
+			pNf = pWI->pNf;
+		}
+		else
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			pNf = pWI->pNf;
+			for (WaitQueue::iterator it = _waitQueue.begin(); it != _waitQueue.end(); ++it)
+			{
+				if (*it == pWI)
+				{
+					_waitQueue.erase(it);
+					break;
+				}
+			}
+		}
+		delete pWI;
+	}
+	if (!pNf) return 0;
+	notifications.push_back(pNf);
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
 void PriorityNotificationQueue::dispatch(NotificationCenter& notificationCenter)
 {
 	FastMutex::ScopedLock lock(_mutex);
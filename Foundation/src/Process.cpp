@@ -162,6 +162,22 @@ ProcessHandle Process::launch(const std::string& command, const Args& args, cons
 }
 
 
+std::vector<ProcessHandle> Process::launchBatch(const std::string& command, const Args& args, int count)
+{
+	poco_assert (count >= 0);
+
+	std::vector<ProcessHandle> handles;
+	handles.reserve(count);
+	std::string initialDirectory;
+	Env env;
+	for (int i = 0; i < count; i++)
+	{
+		handles.push_back(ProcessHandle(launchImpl(command, args, initialDirectory, 0, 0, 0, env)));
+	}
+	return handles;
+}
+
+
 int Process::wait(const ProcessHandle& handle)
 {
 	return handle.wait();
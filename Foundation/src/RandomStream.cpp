@@ -21,6 +21,12 @@
 #elif defined(POCO_OS_FAMILY_UNIX)
 #include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/syscall.h>
+#endif
+#include <cerrno>
+#include <cstring>
 #endif
 #include <ctime>
 
@@ -28,6 +34,137 @@
 namespace Poco {
 
 
+#if defined(POCO_OS_FAMILY_UNIX)
+
+
+namespace
+{
+	class EntropyPool
+		/// A per-thread pool of entropy, refilled in large batches
+		/// so that consumers pay one system call per POOL_SIZE bytes
+		/// instead of one per read.
+	{
+	public:
+		enum
+		{
+			POOL_SIZE = 65536
+		};
+
+		EntropyPool():
+			_pos(0),
+			_avail(0)
+		{
+		}
+
+		int read(char* buffer, std::streamsize length)
+		{
+			int copied = 0;
+			while (length > 0)
+			{
+				if (_avail == 0 && refill() <= 0) break;
+				std::size_t n = _avail < static_cast<std::size_t>(length) ? _avail : static_cast<std::size_t>(length);
+				std::memcpy(buffer, _pool + _pos, n);
+				buffer  += n;
+				length  -= n;
+				_pos    += n;
+				_avail  -= n;
+				copied  += static_cast<int>(n);
+			}
+			return copied;
+		}
+
+		void reset()
+			/// Discards the pooled entropy, e.g. after a fork, so
+			/// that parent and child do not draw the same bytes.
+		{
+			_pos   = 0;
+			_avail = 0;
+		}
+
+	private:
+		int refill()
+		{
+			int n = 0;
+#if POCO_OS == POCO_OS_LINUX && defined(SYS_getrandom)
+			static bool haveGetrandom = true;
+			if (haveGetrandom)
+			{
+				std::size_t total = 0;
+				while (total < sizeof(_pool))
+				{
+					long rc = syscall(SYS_getrandom, _pool + total, sizeof(_pool) - total, 0);
+					if (rc < 0)
+					{
+						if (errno == EINTR) continue;
+						if (errno == ENOSYS) haveGetrandom = false;
+						break;
+					}
+					total += static_cast<std::size_t>(rc);
+				}
+				n = static_cast<int>(total);
+			}
+			if (n <= 0)
+#endif
+			{
+				int fd = open("/dev/urandom", O_RDONLY, 0);
+				if (fd >= 0)
+				{
+					n = static_cast<int>(::read(fd, _pool, sizeof(_pool)));
+					close(fd);
+				}
+			}
+			if (n < 0) n = 0;
+			_pos   = 0;
+			_avail = static_cast<std::size_t>(n);
+			return n;
+		}
+
+		char        _pool[POOL_SIZE];
+		std::size_t _pos;
+		std::size_t _avail;
+	};
+
+
+	thread_local EntropyPool* pCurrentPool(0);
+
+
+	extern "C" void resetEntropyPoolAtFork()
+	{
+		if (pCurrentPool) pCurrentPool->reset();
+	}
+
+
+	struct EntropyPoolHolder
+	{
+		EntropyPoolHolder():
+			pPool(new EntropyPool)
+		{
+			pCurrentPool = pPool;
+		}
+
+		~EntropyPoolHolder()
+		{
+			pCurrentPool = 0;
+			delete pPool;
+		}
+
+		EntropyPool* pPool;
+	};
+
+
+	EntropyPool& entropyPool()
+	{
+		static bool atForkRegistered = (pthread_atfork(0, 0, resetEntropyPoolAtFork) == 0);
+		(void) atForkRegistered;
+		static thread_local EntropyPoolHolder holder;
+		return *holder.pPool;
+	}
+}
+
+
+#endif // POCO_OS_FAMILY_UNIX
+
+
 RandomBuf::RandomBuf(): BufferedStreamBuf(256, std::ios::in)
 {
 }
@@ -50,12 +187,7 @@ int RandomBuf::readFromDevice(char* buffer, std::streamsize length)
 	n = static_cast<int>(length);
 #else
 	#if defined(POCO_OS_FAMILY_UNIX)
-	int fd = open("/dev/urandom", O_RDONLY, 0);
-	if (fd >= 0) 
-	{
-		n = read(fd, buffer, length);
-		close(fd);
-	}
+	n = entropyPool().read(buffer, length);
 	#endif
 	if (n <= 0)
 	{
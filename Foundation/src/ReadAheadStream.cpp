@@ -0,0 +1,168 @@
+//
+// ReadAheadStream.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  ReadAheadStream
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ReadAheadStream.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+ReadAheadStreamBuf::ReadAheadStreamBuf(std::istream& istr, std::size_t chunkSize, std::size_t queueSize):
+	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::in),
+	_istr(istr),
+	_chunkSize(chunkSize > 0 ? chunkSize : static_cast<std::size_t>(DEFAULT_CHUNK_SIZE)),
+	_queueSize(queueSize > 0 ? queueSize : 1),
+	_pCurrent(0),
+	_offset(0),
+	_sourceDone(false),
+	_sourceError(false),
+	_stopped(false)
+{
+	_thread.start(*this);
+}
+
+
+ReadAheadStreamBuf::~ReadAheadStreamBuf()
+{
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_stopped = true;
+		_notFull.broadcast();
+	}
+	try
+	{
+		_thread.join();
+	}
+	catch (...)
+	{
+	}
+	delete _pCurrent;
+	for (std::deque<Chunk*>::iterator it = _queue.begin(); it != _queue.end(); ++it)
+	{
+		delete *it;
+	}
+}
+
+
+void ReadAheadStreamBuf::run()
+{
+	try
+	{
+		for (;;)
+		{
+			Chunk* pChunk = new Chunk(_chunkSize);
+			if (_istr.good())
+			{
+				_istr.read(pChunk->data.begin(), static_cast<std::streamsize>(_chunkSize));
+				pChunk->size = static_cast<std::size_t>(_istr.gcount());
+			}
+			if (pChunk->size == 0)
+			{
+				delete pChunk;
+				break;
+			}
+			FastMutex::ScopedLock lock(_mutex);
+			while (_queue.size() >= _queueSize && !_stopped)
+			{
+				_notFull.wait(_mutex);
+			}
+			if (_stopped)
+			{
+				delete pChunk;
+				return;
+			}
+			_queue.push_back(pChunk);
+			_notEmpty.signal();
+		}
+	}
+	catch (...)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_sourceError = true;
+	}
+	FastMutex::ScopedLock lock(_mutex);
+	_sourceDone = true;
+	_notEmpty.signal();
+}
+
+
+int ReadAheadStreamBuf::readFromDevice(char* buffer, std::streamsize length)
+{
+	if (!_pCurrent)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		while (_queue.empty() && !_sourceDone)
+		{
+			_notEmpty.wait(_mutex);
+		}
+		if (!_queue.empty())
+		{
+			_pCurrent = _queue.front();
+			_queue.pop_front();
+			_offset = 0;
+			_notFull.signal();
+		}
+		else
+		{
+			if (_sourceError) throw IOException("error reading from read-ahead source stream");
+			return 0;
+		}
+	}
+
+	std::size_t n = _pCurrent->size - _offset;
+	if (n > static_cast<std::size_t>(length)) n = static_cast<std::size_t>(length);
+	std::memcpy(buffer, _pCurrent->data.begin() + _offset, n);
+	_offset += n;
+	if (_offset == _pCurrent->size)
+	{
+		delete _pCurrent;
+		_pCurrent = 0;
+	}
+	return static_cast<int>(n);
+}
+
+
+ReadAheadIOS::ReadAheadIOS(std::istream& istr, std::size_t chunkSize, std::size_t queueSize):
+	_buf(istr, chunkSize, queueSize)
+{
+	poco_ios_init(&_buf);
+}
+
+
+ReadAheadIOS::~ReadAheadIOS()
+{
+}
+
+
+ReadAheadStreamBuf* ReadAheadIOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+ReadAheadInputStream::ReadAheadInputStream(std::istream& istr, std::size_t chunkSize, std::size_t queueSize):
+	std::istream(&_buf),
+	ReadAheadIOS(istr, chunkSize, queueSize)
+{
+}
+
+
+ReadAheadInputStream::~ReadAheadInputStream()
+{
+}
+
+
+} // namespace Poco
@@ -14,6 +14,9 @@
 
 #include "Poco/RegularExpression.h"
 #include "Poco/Exception.h"
+#include "Poco/LRUCache.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/ThreadLocal.h"
 #include <sstream>
 #if defined(POCO_UNBUNDLED)
 #include <pcre.h>
@@ -29,26 +32,122 @@ namespace Poco {
 const int RegularExpression::OVEC_SIZE = 63; // must be multiple of 3
 
 
+struct RegularExpression::CompiledProgram
+	/// A compiled (and optionally studied) pattern, shared
+	/// between all RegularExpression instances created with
+	/// the same pattern and options via the pattern cache.
+{
+	CompiledProgram(pcre* pProgram, pcre_extra* pStudyData):
+		pPCRE(pProgram),
+		pExtra(pStudyData)
+	{
+	}
+
+	~CompiledProgram()
+	{
+		if (pPCRE) pcre_free(pPCRE);
+#if defined(PCRE_STUDY_JIT_COMPILE)
+		if (pExtra) pcre_free_study(pExtra);
+#else
+		if (pExtra) pcre_free(pExtra);
+#endif
+	}
+
+	pcre*       pPCRE;
+	pcre_extra* pExtra;
+
+private:
+	CompiledProgram(const CompiledProgram&);
+	CompiledProgram& operator = (const CompiledProgram&);
+};
+
+
+namespace
+{
+	const long PATTERN_CACHE_SIZE = 128;
+
+
+#if defined(PCRE_STUDY_JIT_COMPILE)
+	class JitStackHolder
+		/// Holds a per-thread PCRE JIT stack larger than the
+		/// default machine-stack budget, so deeply nesting
+		/// patterns do not fail with PCRE_ERROR_JIT_STACKLIMIT.
+	{
+	public:
+		JitStackHolder():
+			_pStack(pcre_jit_stack_alloc(32*1024, 512*1024))
+		{
+		}
+
+		~JitStackHolder()
+		{
+			if (_pStack) pcre_jit_stack_free(_pStack);
+		}
+
+		pcre_jit_stack* stack() const
+		{
+			return _pStack;
+		}
+
+	private:
+		pcre_jit_stack* _pStack;
+	};
+
+
+	pcre_jit_stack* jitStackCallback(void*)
+	{
+		static Poco::ThreadLocal<JitStackHolder> tls;
+		return tls.get().stack();
+	}
+#endif
+}
+
+
 RegularExpression::RegularExpression(const std::string& pattern, int options, bool study): _pcre(0), _extra(0)
 {
-	const char* error;
-	int offs;
-	_pcre = pcre_compile(pattern.c_str(), options, &error, &offs, 0);
-	if (!_pcre)
+	static LRUCache<std::string, CompiledProgram> cache(PATTERN_CACHE_SIZE);
+
+	bool jit = (options & RE_STUDY_JIT) != 0;
+	if (jit) study = true;
+	int compileOptions = options & ~RE_STUDY_JIT;
+
+	std::string key(pattern);
+	key += '\1';
+	NumberFormatter::appendHex(key, static_cast<unsigned>(compileOptions));
+	key += study ? (jit ? 'J' : 'S') : 'N';
+
+	_program = cache.get(key);
+	if (!_program)
 	{
-		std::ostringstream msg;
-		msg << error << " (at offset " << offs << ")";
-		throw RegularExpressionException(msg.str());
+		const char* error;
+		int offs;
+		pcre* ppcre = pcre_compile(pattern.c_str(), compileOptions, &error, &offs, 0);
+		if (!ppcre)
+		{
+			std::ostringstream msg;
+			msg << error << " (at offset " << offs << ")";
+			throw RegularExpressionException(msg.str());
+		}
+		pcre_extra* extra = 0;
+#if defined(PCRE_STUDY_JIT_COMPILE)
+		if (study)
+			extra = pcre_study(ppcre, jit ? PCRE_STUDY_JIT_COMPILE : 0, &error);
+		if (jit && extra)
+			pcre_assign_jit_stack(extra, jitStackCallback, 0);
+#else
+		if (study)
+			extra = pcre_study(ppcre, 0, &error);
+#endif
+		_program = new CompiledProgram(ppcre, extra);
+		cache.add(key, _program);
 	}
-	if (study)
-		_extra = pcre_study(reinterpret_cast<pcre*>(_pcre), 0, &error);
+	_pcre  = _program->pPCRE;
+	_extra = _program->pExtra;
 }
 
 
 RegularExpression::~RegularExpression()
 {
-	if (_pcre)  pcre_free(reinterpret_cast<pcre*>(_pcre));
-	if (_extra) pcre_free(reinterpret_cast<struct pcre_extra*>(_extra));
 }
 
 
@@ -37,6 +37,12 @@ RotateStrategy::~RotateStrategy()
 }
 
 
+bool RotateStrategy::mustRotate(LogFile* pFile, UInt64 /*size*/)
+{
+	return mustRotate(pFile);
+}
+
+
 //
 // RotateByIntervalStrategy
 //
@@ -60,9 +66,15 @@ RotateByIntervalStrategy::~RotateByIntervalStrategy()
 
 bool RotateByIntervalStrategy::mustRotate(LogFile* pFile)
 {
-	if (_lastRotate == 0 || pFile->size() == 0)
+	return mustRotate(pFile, pFile->size());
+}
+
+
+bool RotateByIntervalStrategy::mustRotate(LogFile* pFile, UInt64 size)
+{
+	if (_lastRotate == 0 || size == 0)
 	{
-		if (pFile->size() != 0)
+		if (size != 0)
 		{
 			Poco::FileInputStream istr(pFile->path());
 			std::string tag;
@@ -110,4 +122,10 @@ bool RotateBySizeStrategy::mustRotate(LogFile* pFile)
 }
 
 
+bool RotateBySizeStrategy::mustRotate(LogFile* /*pFile*/, UInt64 size)
+{
+	return size >= _size;
+}
+
+
 } // namespace Poco
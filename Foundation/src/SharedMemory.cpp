@@ -40,6 +40,12 @@ SharedMemory::SharedMemory(const std::string& name, std::size_t size, AccessMode
 }
 
 
+SharedMemory::SharedMemory(const std::string& name, std::size_t size, AccessMode mode, Options options, int numaNode, const void* addrHint, bool server):
+	_pImpl(new SharedMemoryImpl(name, size, mode, addrHint, server, options, numaNode))
+{
+}
+
+
 SharedMemory::SharedMemory(const Poco::File& file, AccessMode mode, const void* addrHint):
 	_pImpl(new SharedMemoryImpl(file, mode, addrHint))
 {
@@ -0,0 +1,360 @@
+//
+// SharedMemoryQueue.cpp
+//
+// Library: Foundation
+// Package: Processes
+// Module:  SharedMemoryQueue
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SharedMemoryQueue.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include <cstring>
+
+
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_SHMQUEUE_HAVE_ATOMICS
+	#include <atomic>
+#endif
+
+
+#if defined(POCO_SHMQUEUE_HAVE_ATOMICS) && defined(__linux__)
+	#define POCO_SHMQUEUE_HAVE_FUTEX
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+	#include <climits>
+#endif
+
+
+namespace Poco {
+
+
+#if defined(POCO_SHMQUEUE_HAVE_ATOMICS)
+
+
+namespace
+{
+	const UInt32 QUEUE_MAGIC  = 0x51485350; // "PSHQ"
+	const UInt32 WRAP_MARKER  = 0xFFFFFFFF;
+	const std::size_t RECORD_HEADER_SIZE = 8;
+	const std::size_t MIN_CAPACITY = 4096;
+
+
+	inline std::size_t alignUp(std::size_t size)
+	{
+		return (size + 7) & ~std::size_t(7);
+	}
+
+
+	inline std::size_t roundUpToPowerOfTwo(std::size_t size)
+	{
+		std::size_t result = MIN_CAPACITY;
+		while (result < size) result <<= 1;
+		return result;
+	}
+
+
+#if defined(POCO_SHMQUEUE_HAVE_FUTEX)
+	inline void futexWait(std::atomic<UInt32>* pWord, UInt32 expected)
+	{
+		syscall(SYS_futex, reinterpret_cast<UInt32*>(pWord), FUTEX_WAIT, expected, (void*) 0, (void*) 0, 0);
+	}
+
+	inline void futexWakeAll(std::atomic<UInt32>* pWord)
+	{
+		syscall(SYS_futex, reinterpret_cast<UInt32*>(pWord), FUTEX_WAKE, INT_MAX, (void*) 0, (void*) 0, 0);
+	}
+#else
+	inline void futexWait(std::atomic<UInt32>* pWord, UInt32 expected)
+	{
+		// no futex on this platform; poll with a short sleep
+		if (pWord->load(std::memory_order_acquire) == expected)
+			Thread::sleep(1);
+	}
+
+	inline void futexWakeAll(std::atomic<UInt32>*)
+	{
+	}
+#endif
+}
+
+
+//
+// The segment starts with this header, followed by the ring buffer.
+// head and tail are free-running byte positions; readSeq and writeSeq
+// count completed reads and writes and serve as futex words for
+// blocked producers and consumers, respectively.
+//
+// Messages are stored as an 8-byte record header (length plus
+// padding, keeping the payload 8-byte aligned) followed by the
+// payload. A record with length WRAP_MARKER tells the consumer to
+// skip to the next ring buffer wrap-around.
+//
+struct SharedMemoryQueue::Header
+{
+	UInt32 magic;
+	UInt32 capacity;
+	char pad0[56];
+	std::atomic<UInt64> head;
+	std::atomic<UInt32> readSeq;
+	char pad1[52];
+	std::atomic<UInt64> tail;
+	std::atomic<UInt32> writeSeq;
+	char pad2[52];
+};
+
+
+SharedMemoryQueue::SharedMemoryQueue(const std::string& name, std::size_t capacity, bool server):
+	_memory(name, sizeof(Header) + roundUpToPowerOfTwo(capacity), SharedMemory::AM_WRITE, 0, server),
+	_pHeader(reinterpret_cast<Header*>(_memory.begin())),
+	_pData(_memory.begin() + sizeof(Header)),
+	_capacity(roundUpToPowerOfTwo(capacity)),
+	_pendingWrite(0),
+	_pendingRead(0)
+{
+	if (server)
+	{
+		_pHeader->capacity = static_cast<UInt32>(_capacity);
+		_pHeader->head.store(0, std::memory_order_relaxed);
+		_pHeader->readSeq.store(0, std::memory_order_relaxed);
+		_pHeader->tail.store(0, std::memory_order_relaxed);
+		_pHeader->writeSeq.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		_pHeader->magic = QUEUE_MAGIC;
+	}
+	else
+	{
+		// give the creating process a moment in case it has mapped
+		// the segment but not yet initialized the header
+		for (int i = 0; _pHeader->magic != QUEUE_MAGIC && i < 100; i++)
+		{
+			Thread::sleep(10);
+		}
+		if (_pHeader->magic != QUEUE_MAGIC)
+			throw InvalidArgumentException("shared memory segment does not contain a queue", name);
+		if (_pHeader->capacity != _capacity)
+			throw InvalidArgumentException("shared memory queue capacity mismatch", name);
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+}
+
+
+SharedMemoryQueue::~SharedMemoryQueue()
+{
+}
+
+
+void* SharedMemoryQueue::beginWrite(std::size_t size)
+{
+	for (;;)
+	{
+		UInt32 seq = _pHeader->readSeq.load(std::memory_order_acquire);
+		void* ptr = tryBeginWrite(size);
+		if (ptr) return ptr;
+		futexWait(&_pHeader->readSeq, seq);
+	}
+}
+
+
+void* SharedMemoryQueue::tryBeginWrite(std::size_t size)
+{
+	if (size > maxMessageSize())
+		throw InvalidArgumentException("message too large for shared memory queue");
+	poco_assert (_pendingWrite == 0);
+
+	std::size_t recordSize = RECORD_HEADER_SIZE + alignUp(size);
+	UInt64 head = _pHeader->head.load(std::memory_order_acquire);
+	UInt64 tail = _pHeader->tail.load(std::memory_order_relaxed);
+	std::size_t available = _capacity - static_cast<std::size_t>(tail - head);
+	std::size_t offset = static_cast<std::size_t>(tail) & (_capacity - 1);
+	std::size_t contiguous = _capacity - offset;
+
+	std::size_t needed = recordSize;
+	if (contiguous < recordSize) needed += contiguous;
+	if (available < needed) return 0;
+
+	if (contiguous < recordSize)
+	{
+		// not enough room before the wrap-around; leave a marker
+		// telling the consumer to skip ahead
+		*reinterpret_cast<UInt32*>(_pData + offset) = WRAP_MARKER;
+		offset = 0;
+	}
+	*reinterpret_cast<UInt32*>(_pData + offset) = static_cast<UInt32>(size);
+	_pendingWrite = needed;
+	return _pData + offset + RECORD_HEADER_SIZE;
+}
+
+
+void SharedMemoryQueue::commitWrite()
+{
+	poco_assert (_pendingWrite != 0);
+
+	UInt64 tail = _pHeader->tail.load(std::memory_order_relaxed);
+	_pHeader->tail.store(tail + _pendingWrite, std::memory_order_release);
+	_pendingWrite = 0;
+	_pHeader->writeSeq.fetch_add(1, std::memory_order_release);
+	futexWakeAll(&_pHeader->writeSeq);
+}
+
+
+const void* SharedMemoryQueue::beginRead(std::size_t& size)
+{
+	for (;;)
+	{
+		UInt32 seq = _pHeader->writeSeq.load(std::memory_order_acquire);
+		const void* ptr = tryBeginRead(size);
+		if (ptr) return ptr;
+		futexWait(&_pHeader->writeSeq, seq);
+	}
+}
+
+
+const void* SharedMemoryQueue::tryBeginRead(std::size_t& size)
+{
+	poco_assert (_pendingRead == 0);
+
+	UInt64 head = _pHeader->head.load(std::memory_order_relaxed);
+	UInt64 tail = _pHeader->tail.load(std::memory_order_acquire);
+	if (head == tail) return 0;
+
+	std::size_t skipped = 0;
+	std::size_t offset = static_cast<std::size_t>(head) & (_capacity - 1);
+	UInt32 length = *reinterpret_cast<const UInt32*>(_pData + offset);
+	if (length == WRAP_MARKER)
+	{
+		skipped = _capacity - offset;
+		offset = 0;
+		length = *reinterpret_cast<const UInt32*>(_pData);
+	}
+	size = length;
+	_pendingRead = skipped + RECORD_HEADER_SIZE + alignUp(length);
+	return _pData + offset + RECORD_HEADER_SIZE;
+}
+
+
+void SharedMemoryQueue::endRead()
+{
+	poco_assert (_pendingRead != 0);
+
+	UInt64 head = _pHeader->head.load(std::memory_order_relaxed);
+	_pHeader->head.store(head + _pendingRead, std::memory_order_release);
+	_pendingRead = 0;
+	_pHeader->readSeq.fetch_add(1, std::memory_order_release);
+	futexWakeAll(&_pHeader->readSeq);
+}
+
+
+void SharedMemoryQueue::write(const void* message, std::size_t size)
+{
+	void* ptr = beginWrite(size);
+	std::memcpy(ptr, message, size);
+	commitWrite();
+}
+
+
+std::size_t SharedMemoryQueue::read(void* buffer, std::size_t size)
+{
+	std::size_t messageSize;
+	const void* ptr = beginRead(messageSize);
+	if (messageSize > size)
+	{
+		_pendingRead = 0;
+		throw RangeException("buffer too small for shared memory queue message");
+	}
+	std::memcpy(buffer, ptr, messageSize);
+	endRead();
+	return messageSize;
+}
+
+
+std::size_t SharedMemoryQueue::maxMessageSize() const
+{
+	return _capacity/2 - RECORD_HEADER_SIZE;
+}
+
+
+#else // !POCO_SHMQUEUE_HAVE_ATOMICS
+
+
+struct SharedMemoryQueue::Header
+{
+};
+
+
+SharedMemoryQueue::SharedMemoryQueue(const std::string&, std::size_t, bool)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+SharedMemoryQueue::~SharedMemoryQueue()
+{
+}
+
+
+void* SharedMemoryQueue::beginWrite(std::size_t)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+void* SharedMemoryQueue::tryBeginWrite(std::size_t)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+void SharedMemoryQueue::commitWrite()
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+const void* SharedMemoryQueue::beginRead(std::size_t&)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+const void* SharedMemoryQueue::tryBeginRead(std::size_t&)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+void SharedMemoryQueue::endRead()
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+void SharedMemoryQueue::write(const void*, std::size_t)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+std::size_t SharedMemoryQueue::read(void*, std::size_t)
+{
+	throw NotImplementedException("SharedMemoryQueue requires compiler support for atomics");
+}
+
+
+std::size_t SharedMemoryQueue::maxMessageSize() const
+{
+	return 0;
+}
+
+
+#endif // POCO_SHMQUEUE_HAVE_ATOMICS
+
+
+} // namespace Poco
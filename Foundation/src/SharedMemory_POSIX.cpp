@@ -20,19 +20,25 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <cstring>
+#endif
 
 
 namespace Poco {
 
 
-SharedMemoryImpl::SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server):
+SharedMemoryImpl::SharedMemoryImpl(const std::string& name, std::size_t size, SharedMemory::AccessMode mode, const void* addrHint, bool server, int options, int numaNode):
 	_size(size),
 	_fd(-1),
 	_address(0),
 	_access(mode),
 	_name("/"),
 	_fileMapped(false),
-	_server(server)
+	_server(server),
+	_options(options),
+	_numaNode(numaNode)
 {
 #if POCO_OS == POCO_OS_HPUX
 	_name.append("tmp/");
@@ -70,7 +76,9 @@ SharedMemoryImpl::SharedMemoryImpl(const Poco::File& file, SharedMemory::AccessM
 	_access(mode),
 	_name(file.path()),
 	_fileMapped(true),
-	_server(false)
+	_server(false),
+	_options(0),
+	_numaNode(-1)
 {
 	if (!file.exists() || !file.isFile())
 		throw FileNotFoundException(file.path());
@@ -100,9 +108,65 @@ void SharedMemoryImpl::map(const void* addrHint)
 	if (_access == SharedMemory::AM_WRITE)
 		access |= PROT_WRITE;
 
-	void* addr = ::mmap(const_cast<void*>(addrHint), _size, access, MAP_SHARED, _fd, 0);
+	void* addr = MAP_FAILED;
+#if defined(__linux__) && defined(MAP_HUGETLB)
+	if (_options & SharedMemory::SM_HUGE_PAGES)
+	{
+		// explicitly reserved huge pages; fails unless huge pages
+		// are available and the segment is suitably sized
+		addr = ::mmap(const_cast<void*>(addrHint), _size, access, MAP_SHARED | MAP_HUGETLB, _fd, 0);
+	}
+#endif
 	if (addr == MAP_FAILED)
-		throw SystemException("Cannot map file into shared memory", _name);
+	{
+		addr = ::mmap(const_cast<void*>(addrHint), _size, access, MAP_SHARED, _fd, 0);
+		if (addr == MAP_FAILED)
+			throw SystemException("Cannot map file into shared memory", _name);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+		if (_options & SharedMemory::SM_HUGE_PAGES)
+		{
+			// best effort: ask for transparent huge pages instead
+			// (requires transparent_hugepage/shmem_enabled=advise
+			// for shared mappings)
+			::madvise(addr, _size, MADV_HUGEPAGE);
+		}
+#endif
+	}
+
+#if defined(__linux__) && defined(SYS_mbind)
+	if (_numaNode >= 0)
+	{
+		// bind the segment's pages to the given NUMA node; call the
+		// mbind syscall directly to avoid a dependency on libnuma
+		const int MPOL_BIND_POLICY = 2;
+		const int MAX_NODES = 1024;
+		if (_numaNode >= MAX_NODES)
+		{
+			::munmap(addr, _size);
+			close();
+			throw InvalidArgumentException("Invalid NUMA node", _name);
+		}
+		unsigned long nodeMask[MAX_NODES/(8*sizeof(unsigned long))];
+		std::memset(nodeMask, 0, sizeof(nodeMask));
+		nodeMask[_numaNode/(8*sizeof(unsigned long))] |= 1UL << (_numaNode % (8*sizeof(unsigned long)));
+		if (::syscall(SYS_mbind, addr, _size, MPOL_BIND_POLICY, nodeMask, (unsigned long) MAX_NODES, 0UL) != 0)
+		{
+			::munmap(addr, _size);
+			close();
+			throw SystemException("Cannot bind shared memory to NUMA node", _name);
+		}
+	}
+#endif
+
+	if (_options & SharedMemory::SM_LOCK)
+	{
+		if (::mlock(addr, _size) != 0)
+		{
+			::munmap(addr, _size);
+			close();
+			throw SystemException("Cannot lock shared memory", _name);
+		}
+	}
 
 	_address = static_cast<char*>(addr);
 }
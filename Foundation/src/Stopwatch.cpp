@@ -18,7 +18,12 @@
 namespace Poco {
 
 
-Stopwatch::Stopwatch(): _elapsed(0), _running(false)
+Stopwatch::Stopwatch(): _useFastClock(false), _start(0), _elapsed(0), _running(false)
+{
+}
+
+
+Stopwatch::Stopwatch(bool useFastClock): _useFastClock(useFastClock), _start(0), _elapsed(0), _running(false)
 {
 }
 
@@ -31,14 +36,9 @@ Stopwatch::~Stopwatch()
 Clock::ClockDiff Stopwatch::elapsed() const
 {
 	if (_running)
-	{
-		Clock current;
-		return _elapsed + (current - _start);
-	}
+		return _elapsed + (current() - _start);
 	else
-	{
 		return _elapsed;
-	}
 }
 
 
@@ -52,7 +52,7 @@ void Stopwatch::reset()
 void Stopwatch::restart()
 {
 	_elapsed = 0;
-	_start.update();
+	_start = current();
 	_running = true;
 }
 
@@ -19,11 +19,31 @@
 namespace Poco {
 
 
+namespace
+{
+	bool isASCIITransparent(const TextEncoding& encoding)
+		/// Returns true if every US-ASCII byte of the given
+		/// encoding decodes to itself, in which case ASCII
+		/// characters can be written without going through
+		/// the virtual convert() call.
+	{
+		const TextEncoding::CharacterMap& map = encoding.characterMap();
+		for (int i = 0; i < 128; ++i)
+		{
+			if (map[i] != i) return false;
+		}
+		return true;
+	}
+}
+
+
 StreamConverterBuf::StreamConverterBuf(std::istream& istr, const TextEncoding& inEncoding, const TextEncoding& outEncoding, int defaultChar):
 	_pIstr(&istr),
 	_pOstr(0),
 	_inEncoding(inEncoding),
 	_outEncoding(outEncoding),
+	_inMap(inEncoding.characterMap()),
+	_asciiOut(isASCIITransparent(outEncoding)),
 	_defaultChar(defaultChar),
 	_sequenceLength(0),
 	_pos(0),
@@ -37,6 +57,8 @@ StreamConverterBuf::StreamConverterBuf(std::ostream& ostr, const TextEncoding& i
 	_pOstr(&ostr),
 	_inEncoding(inEncoding),
 	_outEncoding(outEncoding),
+	_inMap(inEncoding.characterMap()),
+	_asciiOut(isASCIITransparent(outEncoding)),
 	_defaultChar(defaultChar),
 	_sequenceLength(0),
 	_pos(0),
@@ -62,32 +84,43 @@ int StreamConverterBuf::readFromDevice()
 	if (c == -1) return -1;	
 
 	poco_assert (c < 256);
-	int uc;
+	int uc = _inMap[c];
 	_buffer [0] = (unsigned char) c;
-	int n = _inEncoding.queryConvert(_buffer, 1);
-	int read = 1;
-
-	while (-1 > n)
+	if (uc < 0)
 	{
-		poco_assert_dbg(-n <= sizeof(_buffer));
-		_pIstr->read((char*) _buffer + read, -n - read);
-		read = -n;
-		n = _inEncoding.queryConvert(_buffer, -n);
+		int n = _inEncoding.queryConvert(_buffer, 1);
+		int read = 1;
+
+		while (-1 > n)
+		{
+			poco_assert_dbg(-n <= sizeof(_buffer));
+			_pIstr->read((char*) _buffer + read, -n - read);
+			read = -n;
+			n = _inEncoding.queryConvert(_buffer, -n);
+		}
+
+		if (-1 >= n)
+		{
+			uc = _defaultChar;
+			++_errors;
+		}
+		else
+		{
+			uc = n;
+		}
 	}
 
-	if (-1 >= n)
+	if (_asciiOut && uc >= 0 && uc < 128)
 	{
-		uc = _defaultChar;
-		++_errors;
+		_buffer[0] = (unsigned char) uc;
+		_sequenceLength = 1;
 	}
 	else
 	{
-		uc = n;
+		_sequenceLength = _outEncoding.convert(uc, _buffer, sizeof(_buffer));
+		if (_sequenceLength == 0)
+			_sequenceLength = _outEncoding.convert(_defaultChar, _buffer, sizeof(_buffer));
 	}
-
-	_sequenceLength = _outEncoding.convert(uc, _buffer, sizeof(_buffer));
-	if (_sequenceLength == 0)
-		_sequenceLength = _outEncoding.convert(_defaultChar, _buffer, sizeof(_buffer));
 	if (_sequenceLength == 0)
 		return -1;
 	else
@@ -100,6 +133,23 @@ int StreamConverterBuf::writeToDevice(char c)
 	poco_assert_dbg (_pOstr);
 
 	_buffer[_pos++] = (unsigned char) c;
+	if (_sequenceLength == 0 && _pos == 1 && _inMap[(unsigned char) c] >= 0)
+	{
+		int uc = _inMap[(unsigned char) c];
+		if (_asciiOut && uc < 128)
+		{
+			_pOstr->put((char) uc);
+		}
+		else
+		{
+			int n = _outEncoding.convert(uc, _buffer, sizeof(_buffer));
+			if (n == 0) n = _outEncoding.convert(_defaultChar, _buffer, sizeof(_buffer));
+			poco_assert_dbg (n <= sizeof(_buffer));
+			_pOstr->write((char*) _buffer, n);
+		}
+		_pos = 0;
+		return charToInt(c);
+	}
 	if (_sequenceLength == 0 || _sequenceLength == _pos)
 	{
 		int n = _inEncoding.queryConvert(_buffer, _pos);
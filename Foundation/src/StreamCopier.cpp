@@ -14,17 +14,77 @@
 
 #include "Poco/StreamCopier.h"
 #include "Poco/Buffer.h"
+#include "Poco/FileStream.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/sendfile.h>
+#include <unistd.h>
+#include <cerrno>
+#if defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 27)
+#define POCO_HAVE_COPY_FILE_RANGE 1
+#endif
+#endif
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+#if POCO_OS == POCO_OS_LINUX
+	Poco::UInt64 copyFileToFile(std::istream& istr, std::ostream& ostr)
+		/// If both streams are file streams, copies as much data as
+		/// possible directly between the two file descriptors, using
+		/// copy_file_range() or sendfile(), and returns the number of
+		/// bytes copied. Returns 0 if the fast path is not applicable.
+		///
+		/// The file offsets are left in sync with the stream positions,
+		/// so the caller can always resume with the generic buffer loop,
+		/// which will also see end-of-file if everything has been copied.
+	{
+		FileStreamBuf* pInBuf  = dynamic_cast<FileStreamBuf*>(istr.rdbuf());
+		FileStreamBuf* pOutBuf = dynamic_cast<FileStreamBuf*>(ostr.rdbuf());
+		if (!pInBuf || !pOutBuf || pInBuf == pOutBuf) return 0;
+		if (!istr.good() || !ostr.good()) return 0;
+		// flush buffered data and synchronize the file offsets with the stream positions
+		if (pInBuf->pubseekoff(0, std::ios::cur, std::ios::in) < 0) return 0;
+		if (pOutBuf->pubseekoff(0, std::ios::cur, std::ios::out) < 0) return 0;
+		int inFD  = pInBuf->nativeHandle();
+		int outFD = pOutBuf->nativeHandle();
+		if (inFD == -1 || outFD == -1) return 0;
+
+		const std::size_t CHUNK_SIZE = 0x7FFFF000; // maximum count per call
+		Poco::UInt64 copied = 0;
+		for (;;)
+		{
+			ssize_t n;
+#if defined(POCO_HAVE_COPY_FILE_RANGE)
+			n = copy_file_range(inFD, 0, outFD, 0, CHUNK_SIZE, 0);
+			if (n < 0 && (errno == EINVAL || errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP))
+				n = sendfile(outFD, inFD, 0, CHUNK_SIZE);
+#else
+			n = sendfile(outFD, inFD, 0, CHUNK_SIZE);
+#endif
+			if (n > 0)
+				copied += static_cast<Poco::UInt64>(n);
+			else if (n == 0 || errno != EINTR)
+				return copied;
+		}
+	}
+#endif
+}
+
+
 std::streamsize StreamCopier::copyStream(std::istream& istr, std::ostream& ostr, std::size_t bufferSize)
 {
 	poco_assert (bufferSize > 0);
 
 	Buffer<char> buffer(bufferSize);
 	std::streamsize len = 0;
+#if POCO_OS == POCO_OS_LINUX
+	len += static_cast<std::streamsize>(copyFileToFile(istr, ostr));
+#endif
 	istr.read(buffer.begin(), bufferSize);
 	std::streamsize n = istr.gcount();
 	while (n > 0)
@@ -49,6 +109,9 @@ Poco::UInt64 StreamCopier::copyStream64(std::istream& istr, std::ostream& ostr,
 
 	Buffer<char> buffer(bufferSize);
 	Poco::UInt64 len = 0;
+#if POCO_OS == POCO_OS_LINUX
+	len += copyFileToFile(istr, ostr);
+#endif
 	istr.read(buffer.begin(), bufferSize);
 	std::streamsize n = istr.gcount();
 	while (n > 0)
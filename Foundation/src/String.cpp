@@ -13,11 +13,198 @@
 
 
 #include "Poco/String.h"
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+	#define POCO_STRING_HAVE_SSE2 1
+	#include <emmintrin.h>
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+	void rangeToUpper(char* p, std::size_t n)
+		/// Converts the given character range to upper-case,
+		/// sixteen characters per iteration where SSE2 is available.
+	{
+#if defined(POCO_STRING_HAVE_SSE2)
+		const __m128i va    = _mm_set1_epi8('a' - 1);
+		const __m128i vz    = _mm_set1_epi8('z' + 1);
+		const __m128i delta = _mm_set1_epi8(0x20);
+		while (n >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i m = _mm_and_si128(_mm_cmpgt_epi8(v, va), _mm_cmplt_epi8(v, vz));
+			v = _mm_sub_epi8(v, _mm_and_si128(m, delta));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+			p += 16;
+			n -= 16;
+		}
+#endif
+		while (n--)
+		{
+			*p = static_cast<char>(Ascii::toUpper(*p));
+			++p;
+		}
+	}
+
+
+	void rangeToLower(char* p, std::size_t n)
+		/// Converts the given character range to lower-case,
+		/// sixteen characters per iteration where SSE2 is available.
+	{
+#if defined(POCO_STRING_HAVE_SSE2)
+		const __m128i vA    = _mm_set1_epi8('A' - 1);
+		const __m128i vZ    = _mm_set1_epi8('Z' + 1);
+		const __m128i delta = _mm_set1_epi8(0x20);
+		while (n >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i m = _mm_and_si128(_mm_cmpgt_epi8(v, vA), _mm_cmplt_epi8(v, vZ));
+			v = _mm_add_epi8(v, _mm_and_si128(m, delta));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+			p += 16;
+			n -= 16;
+		}
+#endif
+		while (n--)
+		{
+			*p = static_cast<char>(Ascii::toLower(*p));
+			++p;
+		}
+	}
+
+
+#if defined(POCO_STRING_HAVE_SSE2)
+	inline __m128i spaceMask(__m128i v)
+		/// Returns a byte mask of the whitespace characters in v
+		/// (space and '\t' .. '\r', matching Ascii::isSpace()).
+	{
+		return _mm_or_si128(
+			_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+			_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1))));
+	}
+#endif
+
+
+	std::size_t leadingSpace(const char* p, std::size_t n)
+		/// Returns the index of the first non-whitespace
+		/// character in the given range (n if there is none).
+	{
+		std::size_t i = 0;
+#if defined(POCO_STRING_HAVE_SSE2)
+		while (i + 16 <= n)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			if (_mm_movemask_epi8(spaceMask(v)) != 0xFFFF) break;
+			i += 16;
+		}
+#endif
+		while (i < n && Ascii::isSpace(p[i])) ++i;
+		return i;
+	}
+
+
+	std::size_t trailingSpace(const char* p, std::size_t n)
+		/// Returns the index one past the last non-whitespace
+		/// character in the given range (0 if there is none).
+	{
+		std::size_t i = n;
+#if defined(POCO_STRING_HAVE_SSE2)
+		while (i >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i - 16));
+			if (_mm_movemask_epi8(spaceMask(v)) != 0xFFFF) break;
+			i -= 16;
+		}
+#endif
+		while (i > 0 && Ascii::isSpace(p[i - 1])) --i;
+		return i;
+	}
+}
+
+
+std::string toUpper(const std::string& str)
+{
+	std::string result(str);
+	return toUpperInPlace(result);
+}
+
+
+std::string& toUpperInPlace(std::string& str)
+{
+	if (!str.empty()) rangeToUpper(&str[0], str.size());
+	return str;
+}
+
+
+std::string toLower(const std::string& str)
+{
+	std::string result(str);
+	return toLowerInPlace(result);
+}
+
+
+std::string& toLowerInPlace(std::string& str)
+{
+	if (!str.empty()) rangeToLower(&str[0], str.size());
+	return str;
+}
+
+
+std::string trim(const std::string& str)
+{
+	std::size_t last  = trailingSpace(str.data(), str.size());
+	std::size_t first = leadingSpace(str.data(), last);
+	return std::string(str, first, last - first);
+}
+
+
+std::string& trimInPlace(std::string& str)
+{
+	std::size_t last  = trailingSpace(str.data(), str.size());
+	std::size_t first = leadingSpace(str.data(), last);
+	str.resize(last);
+	str.erase(0, first);
+	return str;
+}
+
+
+int icompare(const char* s1, std::size_t n1, const char* s2, std::size_t n2)
+{
+	poco_check_ptr (s1);
+	poco_check_ptr (s2);
+
+	std::size_t n = n1 < n2 ? n1 : n2;
+	std::size_t i = 0;
+#if defined(POCO_STRING_HAVE_SSE2)
+	const __m128i vA    = _mm_set1_epi8('A' - 1);
+	const __m128i vZ    = _mm_set1_epi8('Z' + 1);
+	const __m128i delta = _mm_set1_epi8(0x20);
+	while (i + 16 <= n)
+	{
+		__m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s1 + i));
+		__m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s2 + i));
+		v1 = _mm_add_epi8(v1, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(v1, vA), _mm_cmplt_epi8(v1, vZ)), delta));
+		v2 = _mm_add_epi8(v2, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(v2, vA), _mm_cmplt_epi8(v2, vZ)), delta));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)) != 0xFFFF) break;
+		i += 16;
+	}
+#endif
+	for (; i < n; ++i)
+	{
+		int c1 = Ascii::toLower(s1[i]);
+		int c2 = Ascii::toLower(s2[i]);
+		if (c1 < c2)
+			return -1;
+		else if (c1 > c2)
+			return 1;
+	}
+	return n1 < n2 ? -1 : (n1 > n2 ? 1 : 0);
+}
+
+
 #if defined(POCO_NO_TEMPLATE_ICOMPARE)
 
 
@@ -0,0 +1,100 @@
+//
+// StringTokenizerView.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  StringTokenizerView
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/StringTokenizerView.h"
+#include "Poco/Ascii.h"
+
+
+namespace Poco {
+
+
+StringTokenizerView::StringTokenizerView(const std::string& str, const std::string& separators, int options):
+	_begin(str.c_str()),
+	_end(str.c_str() + str.length()),
+	_separators(separators),
+	_options(options)
+{
+}
+
+
+StringTokenizerView::StringTokenizerView(const char* begin, const char* end, const std::string& separators, int options):
+	_begin(begin),
+	_end(end),
+	_separators(separators),
+	_options(options)
+{
+}
+
+
+StringTokenizerView::Iterator StringTokenizerView::begin() const
+{
+	if (_begin == _end) return end();
+	Iterator it(this);
+	it.advance();
+	return it;
+}
+
+
+StringTokenizerView::Iterator::Iterator():
+	_pView(0),
+	_pos(0),
+	_last(true)
+{
+}
+
+
+StringTokenizerView::Iterator::Iterator(const StringTokenizerView* pView):
+	_pView(pView),
+	_pos(pView->_begin),
+	_last(false)
+{
+}
+
+
+void StringTokenizerView::Iterator::advance()
+{
+	bool doTrim = (_pView->_options & TOK_TRIM) != 0;
+	bool ignoreEmpty = (_pView->_options & TOK_IGNORE_EMPTY) != 0;
+	const std::string& separators = _pView->_separators;
+
+	for (;;)
+	{
+		if (_last)
+		{
+			// no tokens remain; become the end iterator
+			_pView = 0;
+			_pos = 0;
+			return;
+		}
+		const char* tokenBegin = _pos;
+		const char* p = _pos;
+		while (p != _pView->_end && separators.find(*p) == std::string::npos) ++p;
+		const char* tokenEnd = p;
+		if (p != _pView->_end)
+			_pos = p + 1;
+		else
+			_last = true;
+		if (doTrim)
+		{
+			while (tokenBegin != tokenEnd && Ascii::isSpace(*tokenBegin)) ++tokenBegin;
+			while (tokenEnd != tokenBegin && Ascii::isSpace(*(tokenEnd - 1))) --tokenEnd;
+		}
+		if (tokenBegin == tokenEnd && ignoreEmpty) continue;
+		_token = Token(tokenBegin, tokenEnd - tokenBegin);
+		return;
+	}
+}
+
+
+} // namespace Poco
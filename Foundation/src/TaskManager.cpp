@@ -15,6 +15,7 @@
 #include "Poco/TaskManager.h"
 #include "Poco/TaskNotification.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/ErrorHandler.h"
 
 
 namespace Poco {
@@ -24,19 +25,33 @@ const int TaskManager::MIN_PROGRESS_NOTIFICATION_INTERVAL = 100000; // 100 milli
 
 
 TaskManager::TaskManager():
-	_threadPool(ThreadPool::defaultPool())
+	_threadPool(ThreadPool::defaultPool()),
+	_progressCoalescingInterval(0),
+	_progressRunnable(*this, &TaskManager::runProgressThread),
+	_progressThreadRunning(false)
 {
 }
 
 
 TaskManager::TaskManager(ThreadPool& pool):
-	_threadPool(pool)
+	_threadPool(pool),
+	_progressCoalescingInterval(0),
+	_progressRunnable(*this, &TaskManager::runProgressThread),
+	_progressThreadRunning(false)
 {
 }
 
 
 TaskManager::~TaskManager()
 {
+	try
+	{
+		stopProgressThread();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
 }
 
 
@@ -112,10 +127,39 @@ void TaskManager::taskStarted(Task* pTask)
 }
 
 
+void TaskManager::setProgressCoalescingInterval(long milliseconds)
+{
+	poco_assert (milliseconds >= 0);
+
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_progressCoalescingInterval = milliseconds;
+	}
+	if (milliseconds > 0)
+		startProgressThread();
+	else
+		stopProgressThread();
+}
+
+
+long TaskManager::getProgressCoalescingInterval() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _progressCoalescingInterval;
+}
+
+
 void TaskManager::taskProgress(Task* pTask, float progress)
 {
 	ScopedLockWithUnlock<FastMutex> lock(_mutex);
 
+	if (_progressCoalescingInterval > 0)
+	{
+		_pendingProgress[TaskPtr(pTask, true)] = progress;
+		return;
+	}
+
 	if (_lastProgressNotification.isElapsed(MIN_PROGRESS_NOTIFICATION_INTERVAL))
 	{
 		_lastProgressNotification.update();
@@ -153,4 +197,70 @@ void TaskManager::taskFailed(Task* pTask, const Exception& exc)
 }
 
 
+void TaskManager::startProgressThread()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_progressThreadRunning)
+	{
+		_progressThreadRunning = true;
+		_progressThread.start(_progressRunnable);
+	}
+}
+
+
+void TaskManager::stopProgressThread()
+{
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		if (!_progressThreadRunning) return;
+		_progressThreadRunning = false;
+	}
+	_progressStop.set();
+	_progressThread.join();
+}
+
+
+void TaskManager::runProgressThread()
+{
+	bool stopped = false;
+	while (!stopped)
+	{
+		long interval;
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			interval = _progressCoalescingInterval;
+		}
+		if (interval <= 0) interval = MIN_PROGRESS_NOTIFICATION_INTERVAL/1000;
+		stopped = _progressStop.tryWait(interval);
+
+		ProgressMap pending;
+		{
+			FastMutex::ScopedLock lock(_mutex);
+			pending.swap(_pendingProgress);
+		}
+		for (ProgressMap::iterator it = pending.begin(); it != pending.end(); ++it)
+		{
+			TaskPtr pTask = it->first;
+			try
+			{
+				_nc.postNotification(new TaskProgressNotification(pTask.get(), it->second));
+			}
+			catch (Exception& exc)
+			{
+				ErrorHandler::handle(exc);
+			}
+			catch (std::exception& exc)
+			{
+				ErrorHandler::handle(exc);
+			}
+			catch (...)
+			{
+				ErrorHandler::handle();
+			}
+		}
+	}
+}
+
+
 } // namespace Poco
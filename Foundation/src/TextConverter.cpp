@@ -15,6 +15,7 @@
 #include "Poco/TextConverter.h"
 #include "Poco/TextIterator.h"
 #include "Poco/TextEncoding.h"
+#include "Poco/UTF8Encoding.h"
 
 
 namespace {
@@ -43,6 +44,55 @@ TextConverter::~TextConverter()
 
 int TextConverter::convert(const std::string& source, std::string& destination, Transform trans)
 {
+	if (_inEncoding.isA("UTF-8") && _outEncoding.isA("UTF-8") && UTF8Encoding::isValid(source.data(), source.size()))
+	{
+		// Bulk path for the frequent UTF-8 to UTF-8 case (e.g. UTF8::toUpper()):
+		// the input is known to be well-formed, so sequences can be decoded
+		// inline, without per-character iterator and virtual call overhead.
+		destination.reserve(destination.size() + source.size());
+		unsigned char buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
+		const unsigned char* p   = reinterpret_cast<const unsigned char*>(source.data());
+		const unsigned char* end = p + source.size();
+		while (p < end)
+		{
+			int c;
+			unsigned char b = *p;
+			if (b < 0x80)
+			{
+				c = b;
+				++p;
+			}
+			else if (b < 0xE0)
+			{
+				c = ((b & 0x1F) << 6) | (p[1] & 0x3F);
+				p += 2;
+			}
+			else if (b < 0xF0)
+			{
+				c = ((b & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+				p += 3;
+			}
+			else
+			{
+				c = ((b & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+				p += 4;
+			}
+			c = trans(c);
+			if (c >= 0 && c <= 0x7F)
+			{
+				destination += (char) c;
+			}
+			else
+			{
+				int n = _outEncoding.convert(c, buffer, sizeof(buffer));
+				if (n == 0) n = _outEncoding.convert(_defaultChar, buffer, sizeof(buffer));
+				poco_assert (n <= sizeof(buffer));
+				destination.append((const char*) buffer, n);
+			}
+		}
+		return 0;
+	}
+
 	int errors = 0;
 	TextIterator it(source, _inEncoding);
 	TextIterator end(source);
@@ -115,13 +165,15 @@ int TextConverter::convert(const void* source, int length, std::string& destinat
 
 int TextConverter::convert(const std::string& source, std::string& destination)
 {
-	return convert(source, destination, nullTransform);
+	return _inEncoding.convertBlock(reinterpret_cast<const unsigned char*>(source.data()), (int) source.size(), _outEncoding, destination, _defaultChar);
 }
 
 
 int TextConverter::convert(const void* source, int length, std::string& destination)
 {
-	return convert(source, length, destination, nullTransform);
+	poco_check_ptr (source);
+
+	return _inEncoding.convertBlock(reinterpret_cast<const unsigned char*>(source), length, _outEncoding, destination, _defaultChar);
 }
 
 
@@ -25,9 +25,10 @@
 #include "Poco/Windows1250Encoding.h"
 #include "Poco/Windows1251Encoding.h"
 #include "Poco/Windows1252Encoding.h"
-#include "Poco/RWLock.h"
+#include "Poco/Mutex.h"
 #include "Poco/SingletonHolder.h"
 #include <map>
+#include <memory>
 
 
 namespace Poco {
@@ -39,9 +40,19 @@ namespace Poco {
 
 
 class TextEncodingManager
+	/// Registry of the known text encodings.
+	///
+	/// Lookups greatly outnumber registrations, so the registry is kept
+	/// as an immutable map that is replaced as a whole on every add() or
+	/// remove() and read without locking: find() atomically loads the
+	/// current snapshot and searches it. Alias names resolved through the
+	/// linear isA() scan are memoized in a second snapshot, so repeated
+	/// lookups under a non-canonical name are plain map hits, too.
 {
 public:
-	TextEncodingManager()
+	TextEncodingManager():
+		_pEncodings(std::make_shared<EncodingMap>()),
+		_pAliases(std::make_shared<EncodingMap>())
 	{
 		TextEncoding::Ptr pUtf8Encoding(new UTF8Encoding);
 		add(pUtf8Encoding, TextEncoding::GLOBAL);
@@ -69,30 +80,44 @@ public:
 
 	void add(TextEncoding::Ptr pEncoding, const std::string& name)
 	{
-		RWLock::ScopedLock lock(_lock, true);
-	
-		_encodings[name] = pEncoding;
+		FastMutex::ScopedLock lock(_mutex);
+
+		std::shared_ptr<EncodingMap> pNew = std::make_shared<EncodingMap>(*std::atomic_load(&_pEncodings));
+		(*pNew)[name] = pEncoding;
+		std::atomic_store(&_pEncodings, EncodingMapPtr(pNew));
+		// memoized aliases may resolve differently now
+		std::atomic_store(&_pAliases, EncodingMapPtr(std::make_shared<EncodingMap>()));
 	}
 
 	void remove(const std::string& name)
 	{
-		RWLock::ScopedLock lock(_lock, true);
-	
-		_encodings.erase(name);
+		FastMutex::ScopedLock lock(_mutex);
+
+		std::shared_ptr<EncodingMap> pNew = std::make_shared<EncodingMap>(*std::atomic_load(&_pEncodings));
+		pNew->erase(name);
+		std::atomic_store(&_pEncodings, EncodingMapPtr(pNew));
+		std::atomic_store(&_pAliases, EncodingMapPtr(std::make_shared<EncodingMap>()));
 	}
-	
+
 	TextEncoding::Ptr find(const std::string& name) const
 	{
-		RWLock::ScopedLock lock(_lock);
-		
-		EncodingMap::const_iterator it = _encodings.find(name);
-		if (it != _encodings.end())
+		EncodingMapPtr pMap = std::atomic_load(&_pEncodings);
+		EncodingMap::const_iterator it = pMap->find(name);
+		if (it != pMap->end())
+			return it->second;
+
+		EncodingMapPtr pAliases = std::atomic_load(&_pAliases);
+		it = pAliases->find(name);
+		if (it != pAliases->end())
 			return it->second;
-		
-		for (it = _encodings.begin(); it != _encodings.end(); ++it)
+
+		for (it = pMap->begin(); it != pMap->end(); ++it)
 		{
 			if (it->second->isA(name))
+			{
+				cacheAlias(name, it->second);
 				return it->second;
+			}
 		}
 		return TextEncoding::Ptr();
 	}
@@ -100,11 +125,32 @@ public:
 private:
 	TextEncodingManager(const TextEncodingManager&);
 	TextEncodingManager& operator = (const TextEncodingManager&);
-	
+
 	typedef std::map<std::string, TextEncoding::Ptr, CILess> EncodingMap;
-	
-	EncodingMap    _encodings;
-	mutable RWLock _lock;
+	typedef std::shared_ptr<const EncodingMap> EncodingMapPtr;
+
+	void cacheAlias(const std::string& name, TextEncoding::Ptr pEncoding) const
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		// only cache the alias if the encoding is still registered,
+		// so a concurrent remove() cannot resurrect it
+		EncodingMapPtr pMap = std::atomic_load(&_pEncodings);
+		for (EncodingMap::const_iterator it = pMap->begin(); it != pMap->end(); ++it)
+		{
+			if (it->second == pEncoding)
+			{
+				std::shared_ptr<EncodingMap> pNew = std::make_shared<EncodingMap>(*std::atomic_load(&_pAliases));
+				(*pNew)[name] = pEncoding;
+				std::atomic_store(&_pAliases, EncodingMapPtr(pNew));
+				return;
+			}
+		}
+	}
+
+	EncodingMapPtr    _pEncodings;
+	mutable EncodingMapPtr _pAliases;
+	mutable FastMutex _mutex;
 };
 
 
@@ -145,6 +191,72 @@ int TextEncoding::sequenceLength(const unsigned char* bytes, int length) const
 }
 
 
+int TextEncoding::convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar) const
+{
+	poco_check_ptr (bytes);
+
+	const CharacterMap& inMap  = characterMap();
+	const CharacterMap& outMap = destEncoding.characterMap();
+
+	// If every US-ASCII byte of the destination encoding decodes to
+	// itself, ASCII characters can be written without going through
+	// the virtual convert() call.
+	bool asciiOut = true;
+	for (int i = 0; i < 128 && asciiOut; ++i)
+		asciiOut = (outMap[i] == i);
+
+	int errors = 0;
+	unsigned char buffer[MAX_SEQUENCE_LENGTH];
+	const unsigned char* it  = bytes;
+	const unsigned char* end = bytes + length;
+	destination.reserve(destination.size() + length);
+	while (it < end)
+	{
+		int uc = inMap[*it];
+		if (uc >= 0)
+		{
+			++it;
+		}
+		else
+		{
+			// multi-byte or malformed sequence
+			int n = queryConvert(it, 1);
+			int read = 1;
+			while (-1 > n && (end - it) >= -n)
+			{
+				read = -n;
+				n = queryConvert(it, read);
+			}
+			if (-1 > n)
+				it = end;
+			else
+				it += read;
+			if (-1 >= n)
+			{
+				uc = defaultChar;
+				++errors;
+			}
+			else
+			{
+				uc = n;
+			}
+		}
+		if (asciiOut && uc >= 0 && uc < 128)
+		{
+			destination += (char) uc;
+		}
+		else
+		{
+			int n = destEncoding.convert(uc, buffer, sizeof(buffer));
+			if (n == 0) n = destEncoding.convert(defaultChar, buffer, sizeof(buffer));
+			poco_assert (n <= sizeof(buffer));
+			destination.append((const char*) buffer, n);
+		}
+	}
+	return errors;
+}
+
+
 TextEncoding& TextEncoding::byName(const std::string& encodingName)
 {
 	TextEncoding* pEncoding = manager().find(encodingName);
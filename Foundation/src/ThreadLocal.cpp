@@ -57,6 +57,10 @@ TLSAbstractSlot*& ThreadLocalStorage::get(const void* key)
 namespace
 {
 	static SingletonHolder<ThreadLocalStorage> sh;
+
+#if defined(POCO_THREADLOCAL_HAVE_NATIVE_TLS)
+	thread_local unsigned tlsEpoch(0);
+#endif
 }
 
 
@@ -76,10 +80,23 @@ ThreadLocalStorage& ThreadLocalStorage::current()
 
 void ThreadLocalStorage::clear()
 {
+#if defined(POCO_THREADLOCAL_HAVE_NATIVE_TLS)
+	++tlsEpoch;
+#endif
 	Thread* pThread = Thread::current();
 	if (pThread)
 		pThread->clearTLS();
 }
 
 
+unsigned ThreadLocalStorage::epoch()
+{
+#if defined(POCO_THREADLOCAL_HAVE_NATIVE_TLS)
+	return tlsEpoch;
+#else
+	return 0;
+#endif
+}
+
+
 } // namespace Poco
@@ -13,13 +13,17 @@
 
 
 #include "Poco/ThreadPool.h"
+#include "Poco/Metrics.h"
 #include "Poco/Runnable.h"
 #include "Poco/Thread.h"
 #include "Poco/Event.h"
+#include "Poco/Condition.h"
 #include "Poco/ThreadLocal.h"
 #include "Poco/ErrorHandler.h"
 #include <sstream>
 #include <ctime>
+#include <atomic>
+#include <cstddef>
 #if defined(_WIN32_WCE) && _WIN32_WCE < 0x800
 #include "wce_time.h"
 #endif
@@ -232,19 +236,577 @@ void PooledThread::run()
 }
 
 
+class StealingThread;
+
+
+class WorkStealingPool
+	/// The internal engine behind ThreadPool's work-stealing
+	/// scheduling policy. Each worker thread owns a bounded
+	/// lock-free task queue; started targets are distributed
+	/// round-robin over the workers and an idle worker steals
+	/// queued targets from its siblings before going to sleep.
+{
+public:
+	struct Task
+	{
+		Runnable*        pTarget;
+		Thread::Priority priority;
+	};
+
+	WorkStealingPool(const std::string& name, int minCapacity, int maxCapacity, int stackSize);
+	~WorkStealingPool();
+
+	void start(Runnable& target, Thread::Priority priority);
+	void addCapacity(int n);
+	int capacity() const;
+	void setStackSize(int stackSize);
+	int used() const;
+	int allocated() const;
+	int available() const;
+	void joinAll();
+	void stopAll();
+
+	bool steal(Task& task, const StealingThread* pThief);
+		/// Attempts to dequeue a task from any other worker's queue.
+
+	bool sleep();
+		/// Called by an idle worker; blocks until new work may be
+		/// available. Returns false if the pool has been stopped.
+
+	void taskDone();
+		/// Called by a worker after a dequeued target has run.
+
+private:
+	struct WorkerSlots
+		/// A published, grow-only array of worker pointers. Producers
+		/// read it without taking the pool mutex; replaced arrays are
+		/// retired and only freed when the pool is destroyed, so a
+		/// stale snapshot always remains valid.
+	{
+		explicit WorkerSlots(int slotsSize):
+			size(slotsSize),
+			workers(new StealingThread*[slotsSize])
+		{
+		}
+
+		~WorkerSlots()
+		{
+			delete [] workers;
+		}
+
+		int size;
+		StealingThread** workers;
+	};
+
+	StealingThread* createWorker();
+	bool growWorkers();
+	bool haveQueuedTasks() const;
+
+	std::string        _name;
+	int                _minCapacity;
+	std::atomic<int>   _maxCapacity;
+	int                _stackSize;
+	int                _serial;
+	std::atomic<WorkerSlots*> _slots;
+	std::vector<WorkerSlots*> _retiredSlots;
+	std::atomic<int>   _workerCount;
+	std::atomic<unsigned> _nextWorker;
+	std::atomic<int>   _pendingCount;
+	std::atomic<int>   _sleeperCount;
+	std::atomic<bool>  _stopped;
+	Condition          _wakeupCond;
+	Condition          _idleCond;
+	mutable FastMutex  _mutex;
+};
+
+
+class StealingThread: public Runnable
+	/// A worker thread of the WorkStealingPool, owning a bounded
+	/// lock-free multi-producer/multi-consumer task queue
+	/// (after D. Vyukov's bounded MPMC queue algorithm).
+{
+public:
+	enum
+	{
+		QUEUE_SIZE = 1024 /// per-worker task queue size; must be a power of two
+	};
+
+	StealingThread(const std::string& name, WorkStealingPool& pool, int stackSize):
+		_pool(pool),
+		_thread(name),
+		_busy(false),
+		_cells(QUEUE_SIZE),
+		_enqueuePos(0),
+		_dequeuePos(0)
+	{
+		poco_assert_dbg (stackSize >= 0);
+		_thread.setStackSize(stackSize);
+		for (std::size_t i = 0; i < QUEUE_SIZE; i++)
+			_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	void start()
+	{
+		_thread.start(*this);
+	}
+
+	void join()
+	{
+		_thread.join();
+	}
+
+	bool busy() const
+	{
+		return _busy.load(std::memory_order_relaxed);
+	}
+
+	bool push(const WorkStealingPool::Task& task)
+	{
+		Cell* pCell;
+		std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & (QUEUE_SIZE - 1)];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0)
+			{
+				if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false; // queue full
+			}
+			else
+			{
+				pos = _enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		pCell->task = task;
+		pCell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(WorkStealingPool::Task& task)
+	{
+		Cell* pCell;
+		std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & (QUEUE_SIZE - 1)];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false; // queue empty
+			}
+			else
+			{
+				pos = _dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+		task = pCell->task;
+		pCell->sequence.store(pos + QUEUE_SIZE, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const
+	{
+		return _enqueuePos.load(std::memory_order_acquire) == _dequeuePos.load(std::memory_order_acquire);
+	}
+
+	void run()
+	{
+		WorkStealingPool::Task task;
+		for (;;)
+		{
+			if (pop(task) || _pool.steal(task, this))
+			{
+				execute(task);
+			}
+			else if (!_pool.sleep())
+			{
+				break;
+			}
+		}
+	}
+
+private:
+	void execute(const WorkStealingPool::Task& task)
+	{
+		_busy.store(true, std::memory_order_relaxed);
+		if (task.priority != Thread::PRIO_NORMAL)
+			_thread.setPriority(task.priority);
+		try
+		{
+			task.pTarget->run();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+		if (task.priority != Thread::PRIO_NORMAL)
+			_thread.setPriority(Thread::PRIO_NORMAL);
+		ThreadLocalStorage::clear();
+		_busy.store(false, std::memory_order_relaxed);
+		_pool.taskDone();
+	}
+
+	struct Cell
+	{
+		std::atomic<std::size_t>   sequence;
+		WorkStealingPool::Task     task;
+	};
+
+	WorkStealingPool& _pool;
+	Thread            _thread;
+	std::atomic<bool> _busy;
+	std::vector<Cell> _cells;
+	std::atomic<std::size_t> _enqueuePos;
+	std::atomic<std::size_t> _dequeuePos;
+};
+
+
+WorkStealingPool::WorkStealingPool(const std::string& name, int minCapacity, int maxCapacity, int stackSize):
+	_name(name),
+	_minCapacity(minCapacity),
+	_maxCapacity(maxCapacity),
+	_stackSize(stackSize),
+	_serial(0),
+	_slots(new WorkerSlots(maxCapacity)),
+	_workerCount(0),
+	_nextWorker(0),
+	_pendingCount(0),
+	_sleeperCount(0),
+	_stopped(false)
+{
+	poco_assert (minCapacity >= 1 && maxCapacity >= minCapacity);
+
+	WorkerSlots* pSlots = _slots.load(std::memory_order_relaxed);
+	for (int i = 0; i < _minCapacity; i++)
+	{
+		StealingThread* pWorker = createWorker();
+		pSlots->workers[i] = pWorker;
+		_workerCount.store(i + 1, std::memory_order_release);
+		pWorker->start();
+	}
+}
+
+
+WorkStealingPool::~WorkStealingPool()
+{
+	try
+	{
+		stopAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+	delete _slots.load(std::memory_order_relaxed);
+	for (std::vector<WorkerSlots*>::iterator it = _retiredSlots.begin(); it != _retiredSlots.end(); ++it)
+	{
+		delete *it;
+	}
+}
+
+
+void WorkStealingPool::start(Runnable& target, Thread::Priority priority)
+{
+	Task task;
+	task.pTarget  = &target;
+	task.priority = priority;
+
+	_pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+	// Grow the worker set while there is still capacity and
+	// no worker is sitting idle.
+	if (_sleeperCount.load(std::memory_order_relaxed) == 0
+	 && _workerCount.load(std::memory_order_relaxed) < capacity())
+	{
+		try
+		{
+			growWorkers();
+		}
+		catch (...)
+		{
+			_pendingCount.fetch_sub(1, std::memory_order_relaxed);
+			throw;
+		}
+	}
+
+	bool grown = true;
+	while (grown)
+	{
+		WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+		int n = _workerCount.load(std::memory_order_acquire);
+		if (n > pSlots->size) n = pSlots->size;
+
+		unsigned first = _nextWorker.fetch_add(1, std::memory_order_relaxed);
+		for (int i = 0; i < n; i++)
+		{
+			if (pSlots->workers[(first + i) % n]->push(task))
+			{
+				if (_sleeperCount.load(std::memory_order_seq_cst) > 0)
+				{
+					_wakeupCond.signal();
+				}
+				return;
+			}
+		}
+
+		// All visible queues are full; retry after adding a worker.
+		try
+		{
+			grown = growWorkers();
+		}
+		catch (...)
+		{
+			_pendingCount.fetch_sub(1, std::memory_order_relaxed);
+			throw;
+		}
+	}
+
+	_pendingCount.fetch_sub(1, std::memory_order_relaxed);
+	throw NoThreadAvailableException();
+}
+
+
+void WorkStealingPool::addCapacity(int n)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	poco_assert (_maxCapacity + n >= _minCapacity);
+	_maxCapacity += n;
+}
+
+
+int WorkStealingPool::capacity() const
+{
+	return _maxCapacity.load(std::memory_order_relaxed);
+}
+
+
+void WorkStealingPool::setStackSize(int stackSize)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	_stackSize = stackSize;
+}
+
+
+int WorkStealingPool::used() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+	int n = _workerCount.load(std::memory_order_acquire);
+	int count = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (pSlots->workers[i]->busy()) ++count;
+	}
+	return count;
+}
+
+
+int WorkStealingPool::allocated() const
+{
+	return _workerCount.load(std::memory_order_acquire);
+}
+
+
+int WorkStealingPool::available() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+	int n = _workerCount.load(std::memory_order_acquire);
+	int count = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (!pSlots->workers[i]->busy()) ++count;
+	}
+	return count + _maxCapacity - n;
+}
+
+
+void WorkStealingPool::joinAll()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	while (_pendingCount.load(std::memory_order_acquire) > 0)
+	{
+		_idleCond.tryWait(_mutex, 100);
+	}
+}
+
+
+void WorkStealingPool::stopAll()
+{
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (_stopped.exchange(true)) return;
+		_wakeupCond.broadcast();
+	}
+
+	WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+	int n = _workerCount.load(std::memory_order_acquire);
+	for (int i = 0; i < n; i++)
+	{
+		pSlots->workers[i]->join();
+		delete pSlots->workers[i];
+	}
+	_workerCount.store(0, std::memory_order_release);
+
+	// Queued targets that never ran are discarded; release any
+	// thread blocked in joinAll().
+	FastMutex::ScopedLock lock(_mutex);
+	_pendingCount.store(0, std::memory_order_release);
+	_idleCond.broadcast();
+}
+
+
+bool WorkStealingPool::steal(Task& task, const StealingThread* pThief)
+{
+	WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+	int n = _workerCount.load(std::memory_order_acquire);
+	if (n > pSlots->size) n = pSlots->size;
+
+	for (int i = 0; i < n; i++)
+	{
+		StealingThread* pWorker = pSlots->workers[i];
+		if (pWorker != pThief && pWorker->pop(task))
+			return true;
+	}
+	return false;
+}
+
+
+bool WorkStealingPool::sleep()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_stopped.load(std::memory_order_acquire)) return false;
+
+	_sleeperCount.fetch_add(1, std::memory_order_seq_cst);
+	if (!haveQueuedTasks())
+	{
+		_wakeupCond.tryWait(_mutex, 100);
+	}
+	_sleeperCount.fetch_sub(1, std::memory_order_seq_cst);
+
+	return !_stopped.load(std::memory_order_acquire);
+}
+
+
+void WorkStealingPool::taskDone()
+{
+	if (_pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_idleCond.broadcast();
+	}
+}
+
+
+StealingThread* WorkStealingPool::createWorker()
+{
+	std::ostringstream name;
+	name << _name << "[#" << ++_serial << "]";
+	return new StealingThread(name.str(), *this, _stackSize);
+}
+
+
+bool WorkStealingPool::growWorkers()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	int n = _workerCount.load(std::memory_order_relaxed);
+	if (n >= _maxCapacity || _stopped.load(std::memory_order_relaxed))
+		return false;
+
+	WorkerSlots* pSlots = _slots.load(std::memory_order_relaxed);
+	if (n == pSlots->size)
+	{
+		WorkerSlots* pNewSlots = new WorkerSlots(_maxCapacity);
+		for (int i = 0; i < n; i++)
+		{
+			pNewSlots->workers[i] = pSlots->workers[i];
+		}
+		_retiredSlots.push_back(pSlots);
+		_slots.store(pNewSlots, std::memory_order_release);
+		pSlots = pNewSlots;
+	}
+
+	StealingThread* pWorker = createWorker();
+	try
+	{
+		pWorker->start();
+	}
+	catch (...)
+	{
+		delete pWorker;
+		throw;
+	}
+	pSlots->workers[n] = pWorker;
+	_workerCount.store(n + 1, std::memory_order_release);
+	return true;
+}
+
+
+bool WorkStealingPool::haveQueuedTasks() const
+{
+	WorkerSlots* pSlots = _slots.load(std::memory_order_acquire);
+	int n = _workerCount.load(std::memory_order_acquire);
+	if (n > pSlots->size) n = pSlots->size;
+
+	for (int i = 0; i < n; i++)
+	{
+		if (!pSlots->workers[i]->empty()) return true;
+	}
+	return false;
+}
+
+
 ThreadPool::ThreadPool(int minCapacity,
 	int maxCapacity,
 	int idleTime,
-	int stackSize): 
-	_minCapacity(minCapacity), 
-	_maxCapacity(maxCapacity), 
+	int stackSize,
+	SchedulingPolicy schedulingPolicy):
+	_minCapacity(minCapacity),
+	_maxCapacity(maxCapacity),
 	_idleTime(idleTime),
 	_serial(0),
 	_age(0),
-	_stackSize(stackSize)
+	_stackSize(stackSize),
+	_schedulingPolicy(schedulingPolicy),
+	_pStealingPool(0),
+	_pUsedGauge(0),
+	_pAllocatedGauge(0)
 {
 	poco_assert (minCapacity >= 1 && maxCapacity >= minCapacity && idleTime > 0);
 
+	if (_schedulingPolicy == SCHEDULING_WORK_STEALING)
+	{
+		_pStealingPool = new WorkStealingPool(_name, minCapacity, maxCapacity, stackSize);
+		return;
+	}
+
 	for (int i = 0; i < _minCapacity; i++)
 	{
 		PooledThread* pThread = createThread();
@@ -258,17 +820,28 @@ ThreadPool::ThreadPool(const std::string& name,
 	int minCapacity,
 	int maxCapacity,
 	int idleTime,
-	int stackSize):
+	int stackSize,
+	SchedulingPolicy schedulingPolicy):
 	_name(name),
-	_minCapacity(minCapacity), 
-	_maxCapacity(maxCapacity), 
+	_minCapacity(minCapacity),
+	_maxCapacity(maxCapacity),
 	_idleTime(idleTime),
 	_serial(0),
 	_age(0),
-	_stackSize(stackSize)
+	_stackSize(stackSize),
+	_schedulingPolicy(schedulingPolicy),
+	_pStealingPool(0),
+	_pUsedGauge(0),
+	_pAllocatedGauge(0)
 {
 	poco_assert (minCapacity >= 1 && maxCapacity >= minCapacity && idleTime > 0);
 
+	if (_schedulingPolicy == SCHEDULING_WORK_STEALING)
+	{
+		_pStealingPool = new WorkStealingPool(_name, minCapacity, maxCapacity, stackSize);
+		return;
+	}
+
 	for (int i = 0; i < _minCapacity; i++)
 	{
 		PooledThread* pThread = createThread();
@@ -288,11 +861,18 @@ ThreadPool::~ThreadPool()
 	{
 		poco_unexpected();
 	}
+	delete _pStealingPool;
 }
 
 
 void ThreadPool::addCapacity(int n)
 {
+	if (_pStealingPool)
+	{
+		_pStealingPool->addCapacity(n);
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	poco_assert (_maxCapacity + n >= _minCapacity);
@@ -303,13 +883,24 @@ void ThreadPool::addCapacity(int n)
 
 int ThreadPool::capacity() const
 {
+	if (_pStealingPool) return _pStealingPool->capacity();
+
 	FastMutex::ScopedLock lock(_mutex);
 	return _maxCapacity;
 }
 
 
+void ThreadPool::setStackSize(int stackSize)
+{
+	_stackSize = stackSize;
+	if (_pStealingPool) _pStealingPool->setStackSize(stackSize);
+}
+
+
 int ThreadPool::available() const
 {
+	if (_pStealingPool) return _pStealingPool->available();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	int count = 0;
@@ -323,6 +914,8 @@ int ThreadPool::available() const
 
 int ThreadPool::used() const
 {
+	if (_pStealingPool) return _pStealingPool->used();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	int count = 0;
@@ -336,6 +929,8 @@ int ThreadPool::used() const
 
 int ThreadPool::allocated() const
 {
+	if (_pStealingPool) return _pStealingPool->allocated();
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	return int(_threads.size());
@@ -344,30 +939,48 @@ int ThreadPool::allocated() const
 
 void ThreadPool::start(Runnable& target)
 {
-	getThread()->start(Thread::PRIO_NORMAL, target);
+	if (_pStealingPool)
+		_pStealingPool->start(target, Thread::PRIO_NORMAL);
+	else
+		getThread()->start(Thread::PRIO_NORMAL, target);
 }
 
 
 void ThreadPool::start(Runnable& target, const std::string& name)
 {
-	getThread()->start(Thread::PRIO_NORMAL, target, name);
+	if (_pStealingPool)
+		_pStealingPool->start(target, Thread::PRIO_NORMAL);
+	else
+		getThread()->start(Thread::PRIO_NORMAL, target, name);
 }
 
 
 void ThreadPool::startWithPriority(Thread::Priority priority, Runnable& target)
 {
-	getThread()->start(priority, target);
+	if (_pStealingPool)
+		_pStealingPool->start(target, priority);
+	else
+		getThread()->start(priority, target);
 }
 
 
 void ThreadPool::startWithPriority(Thread::Priority priority, Runnable& target, const std::string& name)
 {
-	getThread()->start(priority, target, name);
+	if (_pStealingPool)
+		_pStealingPool->start(target, priority);
+	else
+		getThread()->start(priority, target, name);
 }
 
 
 void ThreadPool::stopAll()
 {
+	if (_pStealingPool)
+	{
+		_pStealingPool->stopAll();
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	for (ThreadVec::iterator it = _threads.begin(); it != _threads.end(); ++it)
@@ -380,6 +993,12 @@ void ThreadPool::stopAll()
 
 void ThreadPool::joinAll()
 {
+	if (_pStealingPool)
+	{
+		_pStealingPool->joinAll();
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	for (ThreadVec::iterator it = _threads.begin(); it != _threads.end(); ++it)
@@ -392,6 +1011,8 @@ void ThreadPool::joinAll()
 
 void ThreadPool::collect()
 {
+	if (_pStealingPool) return;
+
 	FastMutex::ScopedLock lock(_mutex);
 	housekeep();
 }
@@ -435,6 +1056,7 @@ void ThreadPool::housekeep()
 		else (*it)->release();
 	}
 	_threads.insert(_threads.end(), activeThreads.begin(), activeThreads.end());
+	updateMetrics();
 }
 
 
@@ -470,10 +1092,33 @@ PooledThread* ThreadPool::getThread()
 			throw NoThreadAvailableException();
 	}
 	pThread->activate();
+	updateMetrics();
 	return pThread;
 }
 
 
+void ThreadPool::updateMetrics()
+{
+	if (!Metrics::MetricsRegistry::enabled()) return;
+
+	if (!_pUsedGauge)
+	{
+		Metrics::MetricsRegistry& registry = Metrics::MetricsRegistry::defaultRegistry();
+		std::string prefix("poco.threadPool.");
+		prefix += _name.empty() ? std::string("default") : _name;
+		_pUsedGauge      = &registry.gauge(prefix + ".usedThreads");
+		_pAllocatedGauge = &registry.gauge(prefix + ".allocatedThreads");
+	}
+	int used = 0;
+	for (ThreadVec::const_iterator it = _threads.begin(); it != _threads.end(); ++it)
+	{
+		if (!(*it)->idle()) ++used;
+	}
+	_pUsedGauge->set(used);
+	_pAllocatedGauge->set(static_cast<Int64>(_threads.size()));
+}
+
+
 PooledThread* ThreadPool::createThread()
 {
 	std::ostringstream name;
@@ -0,0 +1,210 @@
+//
+// ThrottleChannel.cpp
+//
+// Library: Foundation
+// Package: Logging
+// Module:  ThrottleChannel
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ThrottleChannel.h"
+#include "Poco/LoggingRegistry.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Hash.h"
+#include "Poco/Exception.h"
+#include <vector>
+
+
+namespace Poco {
+
+
+const std::string ThrottleChannel::PROP_CHANNEL    = "channel";
+const std::string ThrottleChannel::PROP_WINDOW     = "window";
+const std::string ThrottleChannel::PROP_SAMPLERATE = "sampleRate";
+
+
+ThrottleChannel::ThrottleChannel():
+	_pChannel(0),
+	_window(DEFAULT_WINDOW),
+	_sampleRate(1.0)
+{
+}
+
+
+ThrottleChannel::ThrottleChannel(Channel* pChannel):
+	_pChannel(pChannel),
+	_window(DEFAULT_WINDOW),
+	_sampleRate(1.0)
+{
+	if (_pChannel) _pChannel->duplicate();
+}
+
+
+ThrottleChannel::~ThrottleChannel()
+{
+	try
+	{
+		close();
+		if (_pChannel) _pChannel->release();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ThrottleChannel::setChannel(Channel* pChannel)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_pChannel) _pChannel->release();
+	_pChannel = pChannel;
+	if (_pChannel) _pChannel->duplicate();
+}
+
+
+Channel* ThrottleChannel::getChannel() const
+{
+	return _pChannel;
+}
+
+
+void ThrottleChannel::log(const Message& msg)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_pChannel) return;
+
+	if (_sampleRate < 1.0 && _random.nextDouble() >= _sampleRate) return;
+
+	MessageKey key;
+	key.source   = msg.getSource();
+	key.priority = msg.getPriority();
+	key.textHash = Poco::hash(msg.getText());
+
+	Timestamp now;
+	SuppressionMap::iterator it = _messages.find(key);
+	if (it != _messages.end())
+	{
+		if (now - it->second.windowStart < _window*Timestamp::TimeDiff(1000))
+		{
+			++it->second.count;
+			return;
+		}
+		emitSummary(key, it->second);
+		it->second.windowStart = now;
+		it->second.count = 0;
+	}
+	else
+	{
+		if (_messages.size() >= PURGE_THRESHOLD) purge();
+		SuppressionEntry entry;
+		entry.windowStart = now;
+		_messages[key] = entry;
+	}
+	_pChannel->log(msg);
+}
+
+
+void ThrottleChannel::setProperty(const std::string& name, const std::string& value)
+{
+	if (name == PROP_CHANNEL)
+	{
+		setChannel(LoggingRegistry::defaultRegistry().channelForName(value));
+	}
+	else if (name == PROP_WINDOW)
+	{
+		int window = NumberParser::parse(value);
+		if (window <= 0) throw InvalidArgumentException("window", value);
+
+		FastMutex::ScopedLock lock(_mutex);
+		_window = window;
+	}
+	else if (name == PROP_SAMPLERATE)
+	{
+		double rate = NumberParser::parseFloat(value);
+		if (rate <= 0.0 || rate > 1.0) throw InvalidArgumentException("sampleRate", value);
+
+		FastMutex::ScopedLock lock(_mutex);
+		_sampleRate = rate;
+	}
+	else
+	{
+		Channel::setProperty(name, value);
+	}
+}
+
+
+std::string ThrottleChannel::getProperty(const std::string& name) const
+{
+	if (name == PROP_WINDOW)
+		return NumberFormatter::format(static_cast<Int64>(_window));
+	else if (name == PROP_SAMPLERATE)
+		return NumberFormatter::format(_sampleRate);
+	else
+		return Channel::getProperty(name);
+}
+
+
+void ThrottleChannel::open()
+{
+	if (_pChannel) _pChannel->open();
+}
+
+
+void ThrottleChannel::close()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_pChannel)
+	{
+		for (SuppressionMap::const_iterator it = _messages.begin(); it != _messages.end(); ++it)
+		{
+			emitSummary(it->first, it->second);
+		}
+		_messages.clear();
+		_pChannel->close();
+	}
+}
+
+
+void ThrottleChannel::emitSummary(const MessageKey& key, const SuppressionEntry& entry)
+{
+	if (entry.count > 0)
+	{
+		std::string text("last message repeated ");
+		NumberFormatter::append(text, entry.count);
+		text.append(entry.count == 1 ? " time" : " times");
+		Message summary(key.source, text, static_cast<Message::Priority>(key.priority));
+		_pChannel->log(summary);
+	}
+}
+
+
+void ThrottleChannel::purge()
+{
+	Timestamp now;
+	std::vector<MessageKey> expired;
+	for (SuppressionMap::const_iterator it = _messages.begin(); it != _messages.end(); ++it)
+	{
+		if (now - it->second.windowStart >= _window*Timestamp::TimeDiff(1000))
+		{
+			emitSummary(it->first, it->second);
+			expired.push_back(it->first);
+		}
+	}
+	for (std::vector<MessageKey>::const_iterator it = expired.begin(); it != expired.end(); ++it)
+	{
+		_messages.erase(*it);
+	}
+}
+
+
+} // namespace Poco
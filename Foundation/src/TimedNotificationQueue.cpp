@@ -40,25 +40,31 @@ TimedNotificationQueue::~TimedNotificationQueue()
 
 void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Timestamp timestamp)
 {
-	poco_check_ptr (pNotification);
-
 	Timestamp tsNow;
 	Clock clock;
 	Timestamp::TimeDiff diff = timestamp - tsNow;
 	clock += diff;
 
-	FastMutex::ScopedLock lock(_mutex);
-	_nfQueue.insert(NfQueue::value_type(clock, pNotification));
-	_nfAvailable.set();
+	enqueueNotification(pNotification, clock, 0);
 }
 
 
 void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Clock clock)
+{
+	enqueueNotification(pNotification, clock, 0);
+}
+
+
+void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Clock clock, const void* pOwner)
 {
 	poco_check_ptr (pNotification);
 
+	QueuedNotification qNf;
+	qNf.pNf    = pNotification;
+	qNf.pOwner = pOwner;
+
 	FastMutex::ScopedLock lock(_mutex);
-	_nfQueue.insert(NfQueue::value_type(clock, pNotification));
+	_nfQueue.insert(NfQueue::value_type(clock, qNf));
 	_nfAvailable.set();
 }
 
@@ -73,7 +79,7 @@ Notification* TimedNotificationQueue::dequeueNotification()
 		Clock::ClockDiff sleep = -it->first.elapsed();
 		if (sleep <= 0)
 		{
-			Notification::Ptr pNf = it->second;
+			Notification::Ptr pNf = it->second.pNf;
 			_nfQueue.erase(it);
 			return pNf.duplicate();
 		}
@@ -82,6 +88,25 @@ Notification* TimedNotificationQueue::dequeueNotification()
 }
 
 
+int TimedNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	int count = 0;
+	while (count < maxCount)
+	{
+		NfQueue::iterator it = _nfQueue.begin();
+		if (it == _nfQueue.end()) break;
+		Clock::ClockDiff sleep = -it->first.elapsed();
+		if (sleep > 0) break;
+		notifications.push_back(it->second.pNf);
+		_nfQueue.erase(it);
+		++count;
+	}
+	return count;
+}
+
+
 Notification* TimedNotificationQueue::waitDequeueNotification()
 {
 	for (;;)
@@ -191,10 +216,31 @@ void TimedNotificationQueue::clear()
 }
 
 
+int TimedNotificationQueue::cancelNotifications(const void* pOwner)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	int count = 0;
+	NfQueue::iterator it = _nfQueue.begin();
+	while (it != _nfQueue.end())
+	{
+		if (it->second.pOwner == pOwner)
+		{
+			NfQueue::iterator itDel = it;
+			++it;
+			_nfQueue.erase(itDel);
+			++count;
+		}
+		else ++it;
+	}
+	return count;
+}
+
+
 Notification::Ptr TimedNotificationQueue::dequeueOne(NfQueue::iterator& it)
 {
 	FastMutex::ScopedLock lock(_mutex);
-	Notification::Ptr pNf = it->second;
+	Notification::Ptr pNf = it->second.pNf;
 	_nfQueue.erase(it);
 	return pNf;
 }
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Timezone.h"
+#include <atomic>
 #include <ctime>
 
 
@@ -32,9 +33,56 @@
 namespace Poco {
 
 
+namespace
+{
+	// Cache for the time zone differential. Timezone rule changes (DST
+	// transitions) take effect at multiples of 15 minutes worldwide, so
+	// a differential, once determined, remains valid for the 15-minute
+	// interval containing the point in time it was determined for.
+	// The interval number and the differential are packed into a single
+	// atomic value so that readers never see a torn snapshot and never
+	// have to take a lock.
+	const std::time_t TZD_CACHE_INTERVAL = 900;
+	const Poco::Int64 TZD_BIAS = 0x20000; // |tzd| is always < 2^17 seconds
+	std::atomic<Poco::Int64> cachedTZD(0);
+
+	inline Poco::Int64 packTZD(std::time_t interval, int tzd)
+	{
+		return (static_cast<Poco::Int64>(interval) << 18) | static_cast<Poco::Int64>(tzd + TZD_BIAS);
+	}
+}
+
+
 int Timezone::tzd()
 {
-	return utcOffset() + dst();
+	return tzd(Timestamp());
+}
+
+
+int Timezone::tzd(const Timestamp& timestamp)
+{
+	std::time_t time = timestamp.epochTime();
+	if (time >= 0)
+	{
+		std::time_t interval = time/TZD_CACHE_INTERVAL;
+		Poco::Int64 cached = cachedTZD.load(std::memory_order_relaxed);
+		if ((cached >> 18) == static_cast<Poco::Int64>(interval))
+			return static_cast<int>(cached & 0x3FFFF) - static_cast<int>(TZD_BIAS);
+		int result = utcOffset() + (isDst(timestamp) ? 3600 : 0);
+		cachedTZD.store(packTZD(interval, result), std::memory_order_relaxed);
+		return result;
+	}
+	else
+	{
+		// pre-epoch times are not cached
+		return utcOffset() + (isDst(timestamp) ? 3600 : 0);
+	}
+}
+
+
+void Timezone::invalidateCache()
+{
+	cachedTZD.store(0, std::memory_order_relaxed);
 }
 
 
@@ -0,0 +1,411 @@
+//
+// TimingWheelNotificationQueue.cpp
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  TimingWheelNotificationQueue
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/TimingWheelNotificationQueue.h"
+#include "Poco/Notification.h"
+#include <cstring>
+
+
+namespace Poco {
+
+
+TimingWheelNotificationQueue::TimingWheelNotificationQueue():
+	_expired(0),
+	_expiredTail(0),
+	_lastTick(0),
+	_size(0)
+{
+	std::memset(_slots, 0, sizeof(_slots));
+	std::memset(_levelCounts, 0, sizeof(_levelCounts));
+	Clock now;
+	_lastTick = now.microseconds()/TICK_MICROSECONDS;
+}
+
+
+TimingWheelNotificationQueue::~TimingWheelNotificationQueue()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void TimingWheelNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Timestamp timestamp)
+{
+	Timestamp tsNow;
+	Clock clock;
+	Timestamp::TimeDiff diff = timestamp - tsNow;
+	clock += diff;
+
+	enqueueNotification(pNotification, clock, 0);
+}
+
+
+void TimingWheelNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Clock clock)
+{
+	enqueueNotification(pNotification, clock, 0);
+}
+
+
+void TimingWheelNotificationQueue::enqueueNotification(Notification::Ptr pNotification, Clock clock, const void* pOwner)
+{
+	poco_check_ptr (pNotification);
+
+	Entry* pEntry = new Entry;
+	pEntry->clock  = clock;
+	pEntry->pNf    = pNotification;
+	pEntry->pOwner = pOwner;
+
+	FastMutex::ScopedLock lock(_mutex);
+	insertEntry(pEntry);
+	if (pOwner)
+	{
+		pEntry->ownerIt = _ownerIndex.insert(OwnerIndex::value_type(pOwner, pEntry));
+	}
+	++_size;
+	_nfAvailable.set();
+}
+
+
+Notification* TimingWheelNotificationQueue::dequeueNotification()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	Clock now;
+	advanceTo(now.microseconds()/TICK_MICROSECONDS);
+	Entry* pEntry = popExpired();
+	if (!pEntry) return 0;
+	Notification::Ptr pNf = pEntry->pNf;
+	deleteEntry(pEntry);
+	return pNf.duplicate();
+}
+
+
+Notification* TimingWheelNotificationQueue::waitDequeueNotification()
+{
+	for (;;)
+	{
+		Clock::ClockDiff sleep;
+		{
+			FastMutex::ScopedLock lock(_mutex);
+
+			Clock now;
+			advanceTo(now.microseconds()/TICK_MICROSECONDS);
+			Entry* pEntry = popExpired();
+			if (pEntry)
+			{
+				Notification::Ptr pNf = pEntry->pNf;
+				deleteEntry(pEntry);
+				return pNf.duplicate();
+			}
+			sleep = nextSleep();
+		}
+		if (sleep < 0)
+			_nfAvailable.wait();
+		else
+			_nfAvailable.tryWait(static_cast<long>((sleep + 999)/1000));
+	}
+}
+
+
+Notification* TimingWheelNotificationQueue::waitDequeueNotification(long milliseconds)
+{
+	Clock start;
+	for (;;)
+	{
+		Clock::ClockDiff sleep;
+		{
+			FastMutex::ScopedLock lock(_mutex);
+
+			Clock now;
+			advanceTo(now.microseconds()/TICK_MICROSECONDS);
+			Entry* pEntry = popExpired();
+			if (pEntry)
+			{
+				Notification::Ptr pNf = pEntry->pNf;
+				deleteEntry(pEntry);
+				return pNf.duplicate();
+			}
+			sleep = nextSleep();
+		}
+		Clock::ClockDiff remaining = milliseconds*Clock::ClockDiff(1000) - start.elapsed();
+		if (remaining <= 0) return 0;
+		if (sleep < 0 || sleep > remaining) sleep = remaining;
+		_nfAvailable.tryWait(static_cast<long>((sleep + 999)/1000));
+	}
+}
+
+
+int TimingWheelNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, int maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	Clock now;
+	advanceTo(now.microseconds()/TICK_MICROSECONDS);
+	int count = 0;
+	while (count < maxCount)
+	{
+		Entry* pEntry = popExpired();
+		if (!pEntry) break;
+		notifications.push_back(pEntry->pNf);
+		deleteEntry(pEntry);
+		++count;
+	}
+	return count;
+}
+
+
+int TimingWheelNotificationQueue::cancelNotifications(const void* pOwner)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	int count = 0;
+	OwnerIndex::iterator it = _ownerIndex.lower_bound(pOwner);
+	while (it != _ownerIndex.end() && it->first == pOwner)
+	{
+		Entry* pEntry = it->second;
+		++it;
+		unlinkEntry(pEntry);
+		deleteEntry(pEntry);
+		++count;
+	}
+	return count;
+}
+
+
+bool TimingWheelNotificationQueue::empty() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return _size == 0;
+}
+
+
+int TimingWheelNotificationQueue::size() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return static_cast<int>(_size);
+}
+
+
+void TimingWheelNotificationQueue::clear()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	for (int level = 0; level < WHEEL_LEVELS; level++)
+	{
+		for (int slot = 0; slot < WHEEL_SLOTS; slot++)
+		{
+			Entry* pEntry = _slots[level][slot];
+			while (pEntry)
+			{
+				Entry* pNext = pEntry->pNext;
+				delete pEntry;
+				pEntry = pNext;
+			}
+			_slots[level][slot] = 0;
+		}
+		_levelCounts[level] = 0;
+	}
+	Entry* pEntry = _expired;
+	while (pEntry)
+	{
+		Entry* pNext = pEntry->pNext;
+		delete pEntry;
+		pEntry = pNext;
+	}
+	_expired = _expiredTail = 0;
+	_ownerIndex.clear();
+	_size = 0;
+}
+
+
+inline Poco::Int64 TimingWheelNotificationQueue::tickOf(const Clock& clock)
+{
+	// Round up: a notification must never expire before its deadline.
+	return (clock.microseconds() + TICK_MICROSECONDS - 1)/TICK_MICROSECONDS;
+}
+
+
+void TimingWheelNotificationQueue::insertEntry(Entry* pEntry)
+{
+	Poco::Int64 tick = tickOf(pEntry->clock);
+	if (tick <= _lastTick)
+	{
+		linkExpired(pEntry);
+		return;
+	}
+
+	Poco::Int64 diff = tick - _lastTick;
+	int level = 0;
+	while (level < WHEEL_LEVELS - 1 && diff >= (Poco::Int64(1) << (WHEEL_BITS*(level + 1))))
+	{
+		++level;
+	}
+	int slot = static_cast<int>((tick >> (WHEEL_BITS*level)) & (WHEEL_SLOTS - 1));
+
+	Entry** pList = &_slots[level][slot];
+	pEntry->pList = pList;
+	pEntry->level = level;
+	pEntry->pPrev = 0;
+	pEntry->pNext = *pList;
+	if (*pList) (*pList)->pPrev = pEntry;
+	*pList = pEntry;
+	++_levelCounts[level];
+}
+
+
+void TimingWheelNotificationQueue::linkExpired(Entry* pEntry)
+{
+	pEntry->pList = &_expired;
+	pEntry->level = -1;
+	pEntry->pNext = 0;
+	pEntry->pPrev = _expiredTail;
+	if (_expiredTail)
+		_expiredTail->pNext = pEntry;
+	else
+		_expired = pEntry;
+	_expiredTail = pEntry;
+}
+
+
+void TimingWheelNotificationQueue::unlinkEntry(Entry* pEntry)
+{
+	if (pEntry->pPrev)
+		pEntry->pPrev->pNext = pEntry->pNext;
+	else
+		*pEntry->pList = pEntry->pNext;
+	if (pEntry->pNext)
+		pEntry->pNext->pPrev = pEntry->pPrev;
+	else if (pEntry->level < 0)
+		_expiredTail = pEntry->pPrev;
+	if (pEntry->level >= 0)
+		--_levelCounts[pEntry->level];
+}
+
+
+void TimingWheelNotificationQueue::deleteEntry(Entry* pEntry)
+{
+	if (pEntry->pOwner)
+	{
+		_ownerIndex.erase(pEntry->ownerIt);
+	}
+	poco_assert_dbg (_size > 0);
+	--_size;
+	delete pEntry;
+}
+
+
+void TimingWheelNotificationQueue::advanceTo(Poco::Int64 nowTick)
+{
+	bool wheelsEmpty = true;
+	for (int level = 0; wheelsEmpty && level < WHEEL_LEVELS; level++)
+	{
+		wheelsEmpty = _levelCounts[level] == 0;
+	}
+	if (wheelsEmpty)
+	{
+		if (nowTick > _lastTick) _lastTick = nowTick;
+		return;
+	}
+
+	while (_lastTick < nowTick)
+	{
+		++_lastTick;
+		Poco::Int64 tick = _lastTick;
+		for (int level = 1; level < WHEEL_LEVELS; level++)
+		{
+			if ((tick & ((Poco::Int64(1) << (WHEEL_BITS*level)) - 1)) != 0) break;
+			cascade(level, static_cast<int>((tick >> (WHEEL_BITS*level)) & (WHEEL_SLOTS - 1)));
+		}
+		int slot = static_cast<int>(tick & (WHEEL_SLOTS - 1));
+		Entry* pEntry = _slots[0][slot];
+		_slots[0][slot] = 0;
+		while (pEntry)
+		{
+			Entry* pNext = pEntry->pNext;
+			--_levelCounts[0];
+			linkExpired(pEntry);
+			pEntry = pNext;
+		}
+	}
+}
+
+
+void TimingWheelNotificationQueue::cascade(int level, int slot)
+{
+	Entry* pEntry = _slots[level][slot];
+	_slots[level][slot] = 0;
+	while (pEntry)
+	{
+		Entry* pNext = pEntry->pNext;
+		--_levelCounts[level];
+		insertEntry(pEntry);
+		pEntry = pNext;
+	}
+}
+
+
+TimingWheelNotificationQueue::Entry* TimingWheelNotificationQueue::popExpired()
+{
+	Entry* pEntry = _expired;
+	if (pEntry)
+	{
+		unlinkEntry(pEntry);
+	}
+	return pEntry;
+}
+
+
+Clock::ClockDiff TimingWheelNotificationQueue::nextSleep() const
+{
+	bool haveUpper = false;
+	for (int level = 1; level < WHEEL_LEVELS; level++)
+	{
+		if (_levelCounts[level] > 0)
+		{
+			haveUpper = true;
+			break;
+		}
+	}
+
+	Poco::Int64 best = -1;
+	if (_levelCounts[0] > 0)
+	{
+		for (int i = 1; i < WHEEL_SLOTS; i++)
+		{
+			if (_slots[0][(_lastTick + i) & (WHEEL_SLOTS - 1)])
+			{
+				best = i;
+				break;
+			}
+		}
+	}
+	if (haveUpper)
+	{
+		// Entries in upper wheels cannot expire before the next
+		// cascade, which happens when the lowest wheel wraps.
+		Poco::Int64 toWrap = WHEEL_SLOTS - (_lastTick & (WHEEL_SLOTS - 1));
+		if (best < 0 || toWrap < best) best = toWrap;
+	}
+	if (best < 0) return -1;
+	return best*Clock::ClockDiff(TICK_MICROSECONDS);
+}
+
+
+} // namespace Poco
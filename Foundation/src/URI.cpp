@@ -111,6 +111,21 @@ URI::URI(const URI& uri):
 {
 }
 
+
+#if defined(POCO_URI_HAVE_RVALUE_REFS)
+URI::URI(URI&& uri):
+	_scheme(std::move(uri._scheme)),
+	_userInfo(std::move(uri._userInfo)),
+	_host(std::move(uri._host)),
+	_port(uri._port),
+	_path(std::move(uri._path)),
+	_query(std::move(uri._query)),
+	_fragment(std::move(uri._fragment))
+{
+	uri.clear();
+}
+#endif
+
 	
 URI::URI(const URI& baseURI, const std::string& relativeURI):
 	_scheme(baseURI._scheme),
@@ -155,7 +170,26 @@ URI& URI::operator = (const URI& uri)
 	return *this;
 }
 
-	
+
+#if defined(POCO_URI_HAVE_RVALUE_REFS)
+URI& URI::operator = (URI&& uri)
+{
+	if (&uri != this)
+	{
+		_scheme   = std::move(uri._scheme);
+		_userInfo = std::move(uri._userInfo);
+		_host     = std::move(uri._host);
+		_port     = uri._port;
+		_path     = std::move(uri._path);
+		_query    = std::move(uri._query);
+		_fragment = std::move(uri._fragment);
+		uri.clear();
+	}
+	return *this;
+}
+#endif
+
+
 URI& URI::operator = (const std::string& uri)
 {
 	clear();
@@ -0,0 +1,296 @@
+//
+// URIView.cpp
+//
+// Library: Foundation
+// Package: URI
+// Module:  URIView
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/URIView.h"
+#include "Poco/URI.h"
+#include "Poco/NumberParser.h"
+#include "Poco/String.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	unsigned short wellKnownPort(const URIView::Part& scheme)
+	{
+		std::string lowerScheme(scheme.toString());
+		toLowerInPlace(lowerScheme);
+		if (lowerScheme == "ftp")
+			return 21;
+		else if (lowerScheme == "ssh")
+			return 22;
+		else if (lowerScheme == "telnet")
+			return 23;
+		else if (lowerScheme == "http" || lowerScheme == "ws")
+			return 80;
+		else if (lowerScheme == "nntp")
+			return 119;
+		else if (lowerScheme == "ldap")
+			return 389;
+		else if (lowerScheme == "https" || lowerScheme == "wss")
+			return 443;
+		else if (lowerScheme == "rtsp")
+			return 554;
+		else if (lowerScheme == "sip")
+			return 5060;
+		else if (lowerScheme == "sips")
+			return 5061;
+		else if (lowerScheme == "xmpp")
+			return 5222;
+		else
+			return 0;
+	}
+}
+
+
+URIView::URIView():
+	_begin(0),
+	_length(0)
+{
+}
+
+
+URIView::URIView(const std::string& uri):
+	_begin(uri.c_str()),
+	_length(uri.length())
+{
+	parse();
+}
+
+
+URIView::URIView(const char* uri):
+	_begin(uri),
+	_length(std::strlen(uri))
+{
+	parse();
+}
+
+
+URIView::URIView(const char* uri, std::size_t length):
+	_begin(uri),
+	_length(length)
+{
+	parse();
+}
+
+
+unsigned short URIView::portNumber() const
+{
+	if (!_port.empty())
+	{
+		int nport = 0;
+		if (NumberParser::tryParse(_port.toString(), nport) && nport > 0 && nport < 65536)
+			return (unsigned short) nport;
+		else
+			throw URISyntaxException("bad or invalid port number", _port.toString());
+	}
+	else return wellKnownPort(_scheme);
+}
+
+
+URIView::QueryParameters URIView::getQueryParameters() const
+{
+	QueryParameters result;
+	const char* it  = _query.data();
+	const char* end = it + _query.size();
+	while (it != end)
+	{
+		std::string name;
+		std::string value;
+		while (it != end && *it != '=' && *it != '&')
+		{
+			if (*it == '+')
+				name += ' ';
+			else
+				name += *it;
+			++it;
+		}
+		if (it != end && *it == '=')
+		{
+			++it;
+			while (it != end && *it != '&')
+			{
+				if (*it == '+')
+					value += ' ';
+				else
+					value += *it;
+				++it;
+			}
+		}
+		std::string decodedName;
+		std::string decodedValue;
+		URI::decode(name, decodedName);
+		URI::decode(value, decodedValue);
+		result.push_back(std::make_pair(decodedName, decodedValue));
+		if (it != end && *it == '&') ++it;
+	}
+	return result;
+}
+
+
+URI URIView::toURI() const
+{
+	if (_length == 0) return URI();
+	return URI(std::string(_begin, _length));
+}
+
+
+void URIView::parse()
+{
+	const char* it  = _begin;
+	const char* end = _begin + _length;
+	if (it == end) return;
+	if (*it != '/' && *it != '.' && *it != '?' && *it != '#')
+	{
+		const char* schemeBegin = it;
+		while (it != end && *it != ':' && *it != '?' && *it != '#' && *it != '/') ++it;
+		if (it != end && *it == ':')
+		{
+			_scheme = Part(schemeBegin, it - schemeBegin);
+			++it;
+			if (it == end) throw URISyntaxException("URI scheme must be followed by authority or path", std::string(_begin, _length));
+			if (*it == '/')
+			{
+				++it;
+				if (it != end && *it == '/')
+				{
+					++it;
+					parseAuthority(it, end);
+				}
+				else --it;
+			}
+			parsePathEtc(it, end);
+		}
+		else
+		{
+			it = _begin;
+			parsePathEtc(it, end);
+		}
+	}
+	else parsePathEtc(it, end);
+}
+
+
+void URIView::parseAuthority(const char*& it, const char* end)
+{
+	const char* begin = it;
+	while (it != end && *it != '/' && *it != '?' && *it != '#') ++it;
+	_authority = Part(begin, it - begin);
+
+	// the user-info part ends at the last '@' in the authority
+	const char* hostBegin = begin;
+	for (const char* p = it; p != begin;)
+	{
+		--p;
+		if (*p == '@')
+		{
+			_userInfo = Part(begin, p - begin);
+			hostBegin = p + 1;
+			break;
+		}
+	}
+
+	const char* p = hostBegin;
+	if (p != it && *p == '[')
+	{
+		// IPv6 address
+		++p;
+		const char* host = p;
+		while (p != it && *p != ']') ++p;
+		if (p == it) throw URISyntaxException("unterminated IPv6 address", std::string(_begin, _length));
+		_host = Part(host, p - host);
+		++p;
+	}
+	else
+	{
+		const char* host = p;
+		while (p != it && *p != ':') ++p;
+		_host = Part(host, p - host);
+	}
+	if (p != it && *p == ':')
+		_port = Part(p + 1, it - (p + 1));
+}
+
+
+void URIView::parsePathEtc(const char*& it, const char* end)
+{
+	if (it == end) return;
+	const char* begin = it;
+	_pathEtc = Part(begin, end - begin);
+	if (*it != '?' && *it != '#')
+	{
+		const char* path = it;
+		while (it != end && *it != '?' && *it != '#') ++it;
+		_path = Part(path, it - path);
+	}
+	const char* pathAndQueryEnd = it;
+	if (it != end && *it == '?')
+	{
+		++it;
+		const char* query = it;
+		while (it != end && *it != '#') ++it;
+		_query = Part(query, it - query);
+		pathAndQueryEnd = it;
+	}
+	_pathAndQuery = Part(begin, pathAndQueryEnd - begin);
+	if (it != end && *it == '#')
+	{
+		++it;
+		_fragment = Part(it, end - it);
+		it = end;
+	}
+}
+
+
+std::string URIView::Part::decoded(bool plusAsSpace) const
+{
+	std::string decodedStr;
+	decodedStr.reserve(_size);
+	const char* it  = _data;
+	const char* end = _data + _size;
+	while (it != end)
+	{
+		char c = *it++;
+		if (plusAsSpace && c == '+') c = ' ';
+		else if (c == '%')
+		{
+			if (it == end) throw URISyntaxException("URI encoding: no hex digit following percent sign", toString());
+			char hi = *it++;
+			if (it == end) throw URISyntaxException("URI encoding: two hex digits must follow percent sign", toString());
+			char lo = *it++;
+			if (hi >= '0' && hi <= '9')
+				c = hi - '0';
+			else if (hi >= 'A' && hi <= 'F')
+				c = hi - 'A' + 10;
+			else if (hi >= 'a' && hi <= 'f')
+				c = hi - 'a' + 10;
+			else throw URISyntaxException("URI encoding: not a hex digit");
+			c *= 16;
+			if (lo >= '0' && lo <= '9')
+				c += lo - '0';
+			else if (lo >= 'A' && lo <= 'F')
+				c += lo - 'A' + 10;
+			else if (lo >= 'a' && lo <= 'f')
+				c += lo - 'a' + 10;
+			else throw URISyntaxException("URI encoding: not a hex digit");
+		}
+		decodedStr += c;
+	}
+	return decodedStr;
+}
+
+
+} // namespace Poco
@@ -14,6 +14,11 @@
 
 #include "Poco/UTF8Encoding.h"
 #include "Poco/String.h"
+#include <cstring>
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+	#define POCO_UTF8_HAVE_SSE2 1
+	#include <emmintrin.h>
+#endif
 
 
 namespace Poco {
@@ -198,6 +203,102 @@ int UTF8Encoding::sequenceLength(const unsigned char* bytes, int length) const
 }
 
 
+int UTF8Encoding::convertBlock(const unsigned char* bytes, int length, const TextEncoding& destEncoding, std::string& destination, int defaultChar) const
+{
+	poco_check_ptr (bytes);
+
+	if (!isValid(reinterpret_cast<const char*>(bytes), length))
+		return TextEncoding::convertBlock(bytes, length, destEncoding, destination, defaultChar);
+
+	if (destEncoding.isA(_names[0]))
+	{
+		// validated UTF-8 to UTF-8 is a straight copy
+		destination.append(reinterpret_cast<const char*>(bytes), length);
+		return 0;
+	}
+
+	const CharacterMap& outMap = destEncoding.characterMap();
+	bool asciiOut = true;
+	for (int i = 0; i < 128 && asciiOut; ++i)
+		asciiOut = (outMap[i] == i);
+
+	unsigned char buffer[MAX_SEQUENCE_LENGTH];
+	const unsigned char* p   = bytes;
+	const unsigned char* end = bytes + length;
+	destination.reserve(destination.size() + length);
+	while (p < end)
+	{
+		int uc;
+		unsigned char b = *p;
+		if (b < 0x80)
+		{
+			uc = b;
+			++p;
+			if (asciiOut)
+			{
+				destination += (char) uc;
+				continue;
+			}
+		}
+		else if (b < 0xE0)
+		{
+			uc = ((b & 0x1F) << 6) | (p[1] & 0x3F);
+			p += 2;
+		}
+		else if (b < 0xF0)
+		{
+			uc = ((b & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+			p += 3;
+		}
+		else
+		{
+			uc = ((b & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+			p += 4;
+		}
+		int n = destEncoding.convert(uc, buffer, sizeof(buffer));
+		if (n == 0) n = destEncoding.convert(defaultChar, buffer, sizeof(buffer));
+		poco_assert (n <= sizeof(buffer));
+		destination.append((const char*) buffer, n);
+	}
+	return 0;
+}
+
+
+bool UTF8Encoding::isValid(const char* data, std::size_t length)
+{
+	if (length == 0) return true;
+	poco_check_ptr (data);
+
+	const unsigned char* p   = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	while (p < end)
+	{
+#if defined(POCO_UTF8_HAVE_SSE2)
+		while (p + 16 <= end)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			if (_mm_movemask_epi8(v) != 0) break;
+			p += 16;
+		}
+#else
+		while (end - p >= 8)
+		{
+			UInt64 chunk;
+			std::memcpy(&chunk, p, sizeof(chunk));
+			if (chunk & 0x8080808080808080ULL) break;
+			p += 8;
+		}
+#endif
+		while (p < end && *p < 0x80) ++p;
+		if (p == end) break;
+		int n = -_charMap[*p];
+		if (n < 2 || end - p < n || !isLegal(p, n)) return false;
+		p += n;
+	}
+	return true;
+}
+
+
 bool UTF8Encoding::isLegal(const unsigned char *bytes, int length)
 {
 	// Note: The following is loosely based on the isLegalUTF8 function
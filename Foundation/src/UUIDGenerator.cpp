@@ -19,6 +19,7 @@
 #include "Poco/MD5Engine.h"
 #include "Poco/SHA1Engine.h"
 #include "Poco/SingletonHolder.h"
+#include "Poco/ThreadLocal.h"
 #include <cstring>
 
 
@@ -100,6 +101,43 @@ UUID UUIDGenerator::createRandom()
 }
 
 
+void UUIDGenerator::createBulk(UUID* pUUIDs, std::size_t n)
+{
+	poco_check_ptr (pUUIDs);
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_haveNode)
+	{
+		Environment::nodeId(_node);
+		_haveNode = true;
+	}
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		Timestamp::UtcTimeVal tv = timeStamp();
+		UInt32 timeLow = UInt32(tv & 0xFFFFFFFF);
+		UInt16 timeMid = UInt16((tv >> 32) & 0xFFFF);
+		UInt16 timeHiAndVersion = UInt16((tv >> 48) & 0x0FFF) + (UUID::UUID_TIME_BASED << 12);
+		UInt16 clockSeq = (UInt16(_random.next() >> 4) & 0x3FFF) | 0x8000;
+		pUUIDs[i] = UUID(timeLow, timeMid, timeHiAndVersion, clockSeq, _node);
+	}
+}
+
+
+void UUIDGenerator::createRandomBulk(UUID* pUUIDs, std::size_t n)
+{
+	poco_check_ptr (pUUIDs);
+
+	char buffer[16];
+	RandomInputStream ris;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		ris.read(buffer, sizeof(buffer));
+		pUUIDs[i] = UUID(buffer, UUID::UUID_RANDOM);
+	}
+}
+
+
 Timestamp::UtcTimeVal UUIDGenerator::timeStamp()
 {
 	Timestamp now;
@@ -139,6 +177,7 @@ UUID UUIDGenerator::createOne()
 namespace
 {
 	static SingletonHolder<UUIDGenerator> sh;
+	static ThreadLocal<UUIDGenerator> tlsGenerator;
 }
 
 
@@ -148,4 +187,10 @@ UUIDGenerator& UUIDGenerator::defaultGenerator()
 }
 
 
+UUIDGenerator& UUIDGenerator::threadLocalGenerator()
+{
+	return tlsGenerator.get();
+}
+
+
 } // namespace Poco
@@ -13,20 +13,102 @@
 
 
 #include "Poco/UnicodeConverter.h"
-#include "Poco/TextConverter.h"
 #include "Poco/TextIterator.h"
 #include "Poco/UTF8Encoding.h"
-#include "Poco/UTF16Encoding.h"
-#include "Poco/UTF32Encoding.h"
 #include <cstring>
 
 
 namespace Poco {
 
 
+namespace
+{
+	const int DEFAULT_CHAR = '?';
+
+
+	inline unsigned decodeUTF8(const unsigned char*& p)
+		/// Decodes the UTF-8 sequence at p and advances p past it.
+		/// The input must have been validated with
+		/// UTF8Encoding::isValid() beforehand.
+	{
+		unsigned char c = *p;
+		if (c < 0x80)
+		{
+			++p;
+			return c;
+		}
+		else if (c < 0xE0)
+		{
+			unsigned uc = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+			p += 2;
+			return uc;
+		}
+		else if (c < 0xF0)
+		{
+			unsigned uc = ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+			p += 3;
+			return uc;
+		}
+		else
+		{
+			unsigned uc = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+			p += 4;
+			return uc;
+		}
+	}
+
+
+	inline void appendUTF8(std::string& utf8String, unsigned uc)
+		/// Appends the UTF-8 encoding of the given code point;
+		/// code points beyond U+10FFFF are replaced with DEFAULT_CHAR.
+	{
+		if (uc < 0x80)
+		{
+			utf8String += (char) uc;
+		}
+		else if (uc < 0x800)
+		{
+			utf8String += (char) (((uc >> 6) & 0x1F) | 0xC0);
+			utf8String += (char) ((uc & 0x3F) | 0x80);
+		}
+		else if (uc < 0x10000)
+		{
+			utf8String += (char) (((uc >> 12) & 0x0F) | 0xE0);
+			utf8String += (char) (((uc >> 6) & 0x3F) | 0x80);
+			utf8String += (char) ((uc & 0x3F) | 0x80);
+		}
+		else if (uc <= 0x10FFFF)
+		{
+			utf8String += (char) (((uc >> 18) & 0x07) | 0xF0);
+			utf8String += (char) (((uc >> 12) & 0x3F) | 0x80);
+			utf8String += (char) (((uc >> 6) & 0x3F) | 0x80);
+			utf8String += (char) ((uc & 0x3F) | 0x80);
+		}
+		else
+		{
+			utf8String += (char) DEFAULT_CHAR;
+		}
+	}
+}
+
+
 void UnicodeConverter::convert(const std::string& utf8String, UTF32String& utf32String)
 {
 	utf32String.clear();
+	if (UTF8Encoding::isValid(utf8String.data(), utf8String.size()))
+	{
+		// bulk path: the input is known to be well-formed, so the
+		// sequences can be decoded without any further checking
+		utf32String.reserve(utf8String.size());
+		const unsigned char* p   = reinterpret_cast<const unsigned char*>(utf8String.data());
+		const unsigned char* end = p + utf8String.size();
+		while (p < end)
+		{
+			utf32String += (UTF32Char) decodeUTF8(p);
+		}
+		return;
+	}
+
 	UTF8Encoding utf8Encoding;
 	TextIterator it(utf8String, utf8Encoding);
 	TextIterator end(utf8String);
@@ -66,10 +148,32 @@ void UnicodeConverter::convert(const char* utf8String, UTF32String& utf32String)
 void UnicodeConverter::convert(const std::string& utf8String, UTF16String& utf16String)
 {
 	utf16String.clear();
+	if (UTF8Encoding::isValid(utf8String.data(), utf8String.size()))
+	{
+		utf16String.reserve(utf8String.size());
+		const unsigned char* p   = reinterpret_cast<const unsigned char*>(utf8String.data());
+		const unsigned char* end = p + utf8String.size();
+		while (p < end)
+		{
+			unsigned cc = decodeUTF8(p);
+			if (cc <= 0xffff)
+			{
+				utf16String += (UTF16Char) cc;
+			}
+			else
+			{
+				cc -= 0x10000;
+				utf16String += (UTF16Char) ((cc >> 10) & 0x3ff) | 0xd800;
+				utf16String += (UTF16Char) (cc & 0x3ff) | 0xdc00;
+			}
+		}
+		return;
+	}
+
 	UTF8Encoding utf8Encoding;
 	TextIterator it(utf8String, utf8Encoding);
 	TextIterator end(utf8String);
-	while (it != end) 
+	while (it != end)
 	{
 		int cc = *it++;
 		if (cc <= 0xffff)
@@ -112,37 +216,47 @@ void UnicodeConverter::convert(const char* utf8String, UTF16String& utf16String)
 
 void UnicodeConverter::convert(const UTF16String& utf16String, std::string& utf8String)
 {
-	utf8String.clear();
-	UTF8Encoding utf8Encoding;
-	UTF16Encoding utf16Encoding;
-	TextConverter converter(utf16Encoding, utf8Encoding);
-	converter.convert(utf16String.data(), (int) utf16String.length() * sizeof(UTF16Char), utf8String);
+	toUTF8(utf16String.data(), utf16String.length(), utf8String);
 }
 
 
 void UnicodeConverter::convert(const UTF32String& utf32String, std::string& utf8String)
 {
-	utf8String.clear();
-	UTF8Encoding utf8Encoding;
-	UTF32Encoding utf32Encoding;
-	TextConverter converter(utf32Encoding, utf8Encoding);
-	converter.convert(utf32String.data(), (int) utf32String.length() * sizeof(UTF32Char), utf8String);
+	toUTF8(utf32String.data(), utf32String.length(), utf8String);
 }
 
 
 void UnicodeConverter::convert(const UTF16Char* utf16String,  std::size_t length, std::string& utf8String)
 {
 	utf8String.clear();
-	UTF8Encoding utf8Encoding;
-	UTF16Encoding utf16Encoding;
-	TextConverter converter(utf16Encoding, utf8Encoding);
-	converter.convert(utf16String, (int) length * sizeof(UTF16Char), utf8String);
+	utf8String.reserve(length);
+	const UTF16Char* p   = utf16String;
+	const UTF16Char* end = utf16String + length;
+	while (p < end)
+	{
+		unsigned cc = *p++;
+		if (cc >= 0xd800 && cc < 0xe000)
+		{
+			if (cc < 0xdc00 && p < end && *p >= 0xdc00 && *p < 0xe000)
+				cc = (((cc & 0x3ff) << 10) | (*p++ & 0x3ff)) + 0x10000;
+			else
+				cc = DEFAULT_CHAR; // unpaired surrogate
+		}
+		appendUTF8(utf8String, cc);
+	}
 }
 
 
 void UnicodeConverter::convert(const UTF32Char* utf32String,  std::size_t length, std::string& utf8String)
 {
-	toUTF8(UTF32String(utf32String, length), utf8String);
+	utf8String.clear();
+	utf8String.reserve(length);
+	const UTF32Char* p   = utf32String;
+	const UTF32Char* end = utf32String + length;
+	while (p < end)
+	{
+		appendUTF8(utf8String, (unsigned) *p++);
+	}
 }
 
 
@@ -58,6 +58,21 @@ Var::Var(const Var& other)
 #endif
 
 
+#ifdef POCO_VAR_HAVE_CPP11
+Var::Var(Var&& other)
+#ifdef POCO_NO_SOO
+	: _pHolder(other._pHolder)
+{
+	other._pHolder = 0;
+}
+#else
+{
+	steal(other);
+}
+#endif
+#endif // POCO_VAR_HAVE_CPP11
+
+
 Var::~Var()
 {
 	destruct();
@@ -70,13 +85,36 @@ Var& Var::operator = (const Var& rhs)
 	Var tmp(rhs);
 	swap(tmp);
 #else
-	if ((this != &rhs) && !rhs.isEmpty())
-		construct(rhs);
-	else if ((this != &rhs) && rhs.isEmpty())
+	if (this != &rhs)
+	{
+		Var tmp(rhs);
+		destruct();
+		_placeholder.erase();
+		steal(tmp);
+	}
+#endif
+	return *this;
+}
+
+
+#ifdef POCO_VAR_HAVE_CPP11
+Var& Var::operator = (Var&& rhs)
+{
+	if (this != &rhs)
+	{
+#ifdef POCO_NO_SOO
+		delete _pHolder;
+		_pHolder = rhs._pHolder;
+		rhs._pHolder = 0;
+#else
+		destruct();
 		_placeholder.erase();
+		steal(rhs);
 #endif
+	}
 	return *this;
 }
+#endif // POCO_VAR_HAVE_CPP11
 
 
 const Var Var::operator + (const Var& other) const
@@ -330,8 +368,7 @@ void Var::empty()
 	delete _pHolder;
 	_pHolder = 0;
 #else
-	if (_placeholder.isLocal()) this->~Var();
-	else delete content();
+	destruct();
 	_placeholder.erase();
 #endif
 }
@@ -343,8 +380,7 @@ void Var::clear()
 	delete _pHolder;
 	_pHolder = 0;
 #else
-	if (_placeholder.isLocal()) this->~Var();
-	else delete content();
+	destruct();
 	_placeholder.erase();
 #endif
 }
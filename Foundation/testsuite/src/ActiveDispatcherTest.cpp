@@ -12,16 +12,21 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/ActiveDispatcher.h"
+#include "Poco/ActiveExecutor.h"
 #include "Poco/ActiveMethod.h"
+#include "Poco/ThreadPool.h"
 #include "Poco/Thread.h"
 #include "Poco/Event.h"
 #include "Poco/Exception.h"
+#include <vector>
 
 
 using Poco::ActiveDispatcher;
+using Poco::ActiveExecutor;
 using Poco::ActiveMethod;
 using Poco::ActiveResult;
 using Poco::ActiveStarter;
+using Poco::ThreadPool;
 using Poco::Thread;
 using Poco::Event;
 using Poco::Exception;
@@ -85,6 +90,27 @@ namespace
 	private:
 		Event _continue;
 	};
+
+	class SharedActiveObject: public ActiveDispatcher
+	{
+	public:
+		SharedActiveObject(ActiveExecutor& executor):
+			ActiveDispatcher(executor),
+			recordMethod(this, &SharedActiveObject::recordMethodImpl)
+		{
+		}
+
+		ActiveMethod<int, int, SharedActiveObject, ActiveStarter<ActiveDispatcher> > recordMethod;
+
+		std::vector<int> recorded;
+
+	protected:
+		int recordMethodImpl(const int& n)
+		{
+			recorded.push_back(n);
+			return n;
+		}
+	};
 }
 
 
@@ -195,6 +221,40 @@ void ActiveDispatcherTest::testVoidIn()
 }
 
 
+void ActiveDispatcherTest::testSharedExecutor()
+{
+	ThreadPool pool(4, 4);
+	ActiveExecutor executor(pool);
+	{
+		const int OBJECTS = 64;
+		const int CALLS   = 16;
+		std::vector<SharedActiveObject*> objects;
+		for (int i = 0; i < OBJECTS; i++)
+			objects.push_back(new SharedActiveObject(executor));
+		std::vector<ActiveResult<int> > results;
+		for (int n = 0; n < CALLS; n++)
+		{
+			for (int i = 0; i < OBJECTS; i++)
+				results.push_back(objects[i]->recordMethod(n));
+		}
+		for (std::vector<ActiveResult<int> >::iterator it = results.begin(); it != results.end(); ++it)
+			it->wait();
+		for (int i = 0; i < OBJECTS; i++)
+		{
+			assert (objects[i]->recorded.size() == CALLS);
+			for (int n = 0; n < CALLS; n++)
+			{
+				assert (objects[i]->recorded[n] == n);
+			}
+		}
+		for (int i = 0; i < OBJECTS; i++)
+			delete objects[i];
+	}
+	executor.stop();
+	pool.joinAll();
+}
+
+
 void ActiveDispatcherTest::setUp()
 {
 }
@@ -216,6 +276,7 @@ CppUnit::Test* ActiveDispatcherTest::suite()
 	CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoid);
 	CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoidIn);
 	CppUnit_addTest(pSuite, ActiveDispatcherTest, testVoidInOut);
+	CppUnit_addTest(pSuite, ActiveDispatcherTest, testSharedExecutor);
 
 	return pSuite;
 }
@@ -28,6 +28,7 @@ public:
 	void testVoid();
 	void testVoidIn();
 	void testVoidInOut();
+	void testSharedExecutor();
 
 	void setUp();
 	void tearDown();
@@ -26,26 +26,55 @@ using Poco::Exception;
 
 namespace
 {
+	struct MovableArg
+	{
+		static int copies;
+
+		MovableArg(): value(0)
+		{
+		}
+
+		MovableArg(int v): value(v)
+		{
+		}
+
+		MovableArg(const MovableArg& arg): value(arg.value)
+		{
+			++copies;
+		}
+
+		MovableArg(MovableArg&& arg): value(arg.value)
+		{
+			arg.value = 0;
+		}
+
+		int value;
+	};
+
+	int MovableArg::copies = 0;
+
 	class ActiveObject
 	{
 	public:
-		typedef ActiveMethod<int, int, ActiveObject>   IntIntType;
-		typedef ActiveMethod<void, int, ActiveObject>  VoidIntType;
-		typedef ActiveMethod<void, void, ActiveObject> VoidVoidType;
-		typedef ActiveMethod<int, void, ActiveObject>  IntVoidType;
+		typedef ActiveMethod<int, int, ActiveObject>        IntIntType;
+		typedef ActiveMethod<void, int, ActiveObject>       VoidIntType;
+		typedef ActiveMethod<void, void, ActiveObject>      VoidVoidType;
+		typedef ActiveMethod<int, void, ActiveObject>       IntVoidType;
+		typedef ActiveMethod<int, MovableArg, ActiveObject> IntMovableType;
 
 		ActiveObject():
 			testMethod(this, &ActiveObject::testMethodImpl),
 			testVoid(this,&ActiveObject::testVoidOutImpl),
 			testVoidInOut(this,&ActiveObject::testVoidInOutImpl),
-			testVoidIn(this,&ActiveObject::testVoidInImpl)
+			testVoidIn(this,&ActiveObject::testVoidInImpl),
+			testMovable(this, &ActiveObject::testMovableImpl)
 		{
 		}
-		
+
 		~ActiveObject()
 		{
 		}
-		
+
 		IntIntType testMethod;
 
 		VoidIntType testVoid;
@@ -53,7 +82,9 @@ namespace
 		VoidVoidType testVoidInOut;
 
 		IntVoidType testVoidIn;
-		
+
+		IntMovableType testMovable;
+
 		void cont()
 		{
 			_continue.set();
@@ -83,7 +114,12 @@ namespace
 			_continue.wait();
 			return 123;
 		}
-		
+
+		int testMovableImpl(const MovableArg& arg)
+		{
+			return arg.value;
+		}
+
 	private:
 		Event _continue;
 	};
@@ -234,6 +270,26 @@ void ActiveMethodTest::testVoidIn()
 }
 
 
+void ActiveMethodTest::testMoveArgument()
+{
+	ActiveObject activeObj;
+	MovableArg::copies = 0;
+	ActiveResult<int> result = activeObj.testMovable(MovableArg(42));
+	result.wait();
+	assert (result.available());
+	assert (!result.failed());
+	assert (result.data() == 42);
+	assert (MovableArg::copies == 0);
+
+	MovableArg arg(42);
+	result = activeObj.testMovable(arg);
+	result.wait();
+	assert (result.data() == 42);
+	assert (arg.value == 42);
+	assert (MovableArg::copies > 0);
+}
+
+
 void ActiveMethodTest::setUp()
 {
 }
@@ -256,6 +312,7 @@ CppUnit::Test* ActiveMethodTest::suite()
 	CppUnit_addTest(pSuite, ActiveMethodTest, testVoidOut);
 	CppUnit_addTest(pSuite, ActiveMethodTest, testVoidIn);
 	CppUnit_addTest(pSuite, ActiveMethodTest, testVoidInOut);
+	CppUnit_addTest(pSuite, ActiveMethodTest, testMoveArgument);
 
 	return pSuite;
 }
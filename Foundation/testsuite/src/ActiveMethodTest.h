@@ -32,6 +32,7 @@ public:
 	void testVoidOut();
 	void testVoidInOut();
 	void testVoidIn();
+	void testMoveArgument();
 
 	void setUp();
 	void tearDown();
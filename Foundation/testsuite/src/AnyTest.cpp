@@ -15,6 +15,7 @@
 #include "Poco/Any.h"
 #include "Poco/Bugcheck.h"
 #include <vector>
+#include <utility>
 
 
 #if defined(_MSC_VER) && _MSC_VER < 1400
@@ -197,6 +198,31 @@ void AnyTest::testSwap()
 }
 
 
+void AnyTest::testMove()
+{
+#ifdef POCO_ANY_HAVE_CPP11
+	std::string text = "test message";
+	Any original = text;
+	Any moved = std::move(original);
+
+	assert (original.empty());
+	assert (!moved.empty());
+	assert (moved.type() == typeid(std::string));
+	assert (text == AnyCast<std::string>(moved));
+
+	Any assigned;
+	assigned = std::move(moved);
+	assert (moved.empty());
+	assert (text == AnyCast<std::string>(assigned));
+
+	Any i = 42;
+	assigned = std::move(i);
+	assert (i.empty());
+	assert (42 == AnyCast<int>(assigned));
+#endif
+}
+
+
 void AnyTest::testEmptyCopy()
 {
 	const Any null;
@@ -291,6 +317,7 @@ CppUnit::Test* AnyTest::suite()
 	CppUnit_addTest(pSuite, AnyTest, testConvertingAssign);
 	CppUnit_addTest(pSuite, AnyTest, testBadCast);
 	CppUnit_addTest(pSuite, AnyTest, testSwap);
+	CppUnit_addTest(pSuite, AnyTest, testMove);
 	CppUnit_addTest(pSuite, AnyTest, testEmptyCopy);
 	CppUnit_addTest(pSuite, AnyTest, testCastToReference);
 	CppUnit_addTest(pSuite, AnyTest, testInt);
@@ -30,6 +30,7 @@ public:
 	void testConvertingAssign();
 	void testBadCast();
 	void testSwap();
+	void testMove();
 	void testEmptyCopy();
 	void testCastToReference();
 
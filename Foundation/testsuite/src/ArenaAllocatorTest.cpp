@@ -0,0 +1,124 @@
+//
+// ArenaAllocatorTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ArenaAllocatorTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ArenaAllocator.h"
+#include <vector>
+#include <cstring>
+
+
+using Poco::ArenaAllocator;
+using Poco::ArenaAllocatorAdapter;
+
+
+ArenaAllocatorTest::ArenaAllocatorTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ArenaAllocatorTest::~ArenaAllocatorTest()
+{
+}
+
+
+void ArenaAllocatorTest::testAlloc()
+{
+	ArenaAllocator arena(256);
+	assert (arena.used() == 0);
+	assert (arena.capacity() == 0);
+
+	char* ptr1 = static_cast<char*>(arena.alloc(10));
+	char* ptr2 = static_cast<char*>(arena.alloc(10));
+	assert (ptr1 != ptr2);
+	assert (reinterpret_cast<std::size_t>(ptr2) % alignof(std::max_align_t) == 0);
+	assert (arena.used() > 0);
+	assert (arena.capacity() >= 256);
+	std::memset(ptr1, 0xAB, 10);
+	std::memset(ptr2, 0xCD, 10);
+
+	// allocations larger than the chunk size get a dedicated chunk
+	char* big = static_cast<char*>(arena.alloc(10000));
+	std::memset(big, 0xEF, 10000);
+	assert (arena.capacity() >= 10000 + 256);
+}
+
+
+void ArenaAllocatorTest::testReset()
+{
+	ArenaAllocator arena(256);
+	char* ptr1 = static_cast<char*>(arena.alloc(16));
+	arena.reset();
+	assert (arena.used() == 0);
+
+	// chunk memory is retained and reused
+	char* ptr2 = static_cast<char*>(arena.alloc(16));
+	assert (ptr1 == ptr2);
+
+	for (int i = 0; i < 1000; ++i) arena.alloc(100);
+	std::size_t cap = arena.capacity();
+	arena.reset();
+	for (int i = 0; i < 1000; ++i) arena.alloc(100);
+	assert (arena.capacity() == cap);
+}
+
+
+void ArenaAllocatorTest::testScope()
+{
+	ArenaAllocator arena(256);
+	arena.alloc(16);
+	std::size_t used = arena.used();
+	{
+		ArenaAllocator::Scope scope(arena);
+		for (int i = 0; i < 100; ++i) arena.alloc(64);
+		assert (arena.used() > used);
+	}
+	assert (arena.used() == used);
+}
+
+
+void ArenaAllocatorTest::testAdapter()
+{
+	ArenaAllocator arena;
+	std::vector<int, ArenaAllocatorAdapter<int> > vec((ArenaAllocatorAdapter<int>(arena)));
+	for (int i = 0; i < 1000; ++i)
+	{
+		vec.push_back(i);
+	}
+	for (int i = 0; i < 1000; ++i)
+	{
+		assert (vec[i] == i);
+	}
+	assert (arena.used() >= 1000*sizeof(int));
+}
+
+
+void ArenaAllocatorTest::setUp()
+{
+}
+
+
+void ArenaAllocatorTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ArenaAllocatorTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ArenaAllocatorTest");
+
+	CppUnit_addTest(pSuite, ArenaAllocatorTest, testAlloc);
+	CppUnit_addTest(pSuite, ArenaAllocatorTest, testReset);
+	CppUnit_addTest(pSuite, ArenaAllocatorTest, testScope);
+	CppUnit_addTest(pSuite, ArenaAllocatorTest, testAdapter);
+
+	return pSuite;
+}
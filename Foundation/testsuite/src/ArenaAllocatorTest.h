@@ -0,0 +1,41 @@
+//
+// ArenaAllocatorTest.h
+//
+// Definition of the ArenaAllocatorTest class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ArenaAllocatorTest_INCLUDED
+#define ArenaAllocatorTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ArenaAllocatorTest: public CppUnit::TestCase
+{
+public:
+	ArenaAllocatorTest(const std::string& name);
+	~ArenaAllocatorTest();
+
+	void testAlloc();
+	void testReset();
+	void testScope();
+	void testAdapter();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // ArenaAllocatorTest_INCLUDED
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base32Encoder.h"
 #include "Poco/Base32Decoder.h"
+#include "Poco/Base32Codec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base32Encoder;
 using Poco::Base32Decoder;
+using Poco::Base32Codec;
 using Poco::DataFormatException;
 
 
@@ -160,6 +162,60 @@ void Base32Test::testEncodeDecode()
 }
 
 
+void Base32Test::testCodec()
+{
+	// test vectors from RFC 4648
+	assert (Base32Codec::encode("", 0) == "");
+	assert (Base32Codec::encode("f", 1) == "MY======");
+	assert (Base32Codec::encode("fo", 2) == "MZXQ====");
+	assert (Base32Codec::encode("foo", 3) == "MZXW6===");
+	assert (Base32Codec::encode("foob", 4) == "MZXW6YQ=");
+	assert (Base32Codec::encode("fooba", 5) == "MZXW6YTB");
+	assert (Base32Codec::encode("foobar", 6) == "MZXW6YTBOI======");
+	assert (Base32Codec::encode("foobar", 6, false) == "MZXW6YTBOI");
+
+	assert (Base32Codec::decode("MZXW6YTBOI======") == "foobar");
+	assert (Base32Codec::decode("MZXW6YTBOI") == "foobar");
+	assert (Base32Codec::decode("MZXW6YQ=") == "foob");
+	assert (Base32Codec::decode("") == "");
+
+	try
+	{
+		std::string s = Base32Codec::decode("MZX");
+		failmsg("invalid group length - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		std::string s = Base32Codec::decode("1ZXW6YTB");
+		failmsg("invalid character - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		std::string s = Base32Codec::decode("MZXW6===X");
+		failmsg("data after padding - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+
+	// codec and stream must produce identical output
+	std::string src;
+	for (int i = 0; i < 255; ++i) src += char(i);
+	std::ostringstream str;
+	Base32Encoder encoder(str);
+	encoder.write(src.data(), (std::streamsize) src.size());
+	encoder.close();
+	assert (Base32Codec::encode(src.data(), src.size()) == str.str());
+	assert (Base32Codec::decode(str.str()) == src);
+}
+
+
 void Base32Test::setUp()
 {
 }
@@ -177,6 +233,7 @@ CppUnit::Test* Base32Test::suite()
 	CppUnit_addTest(pSuite, Base32Test, testEncoder);
 	CppUnit_addTest(pSuite, Base32Test, testDecoder);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base32Test, testCodec);
 
 	return pSuite;
 }
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
+#include "Poco/Base64Codec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base64Encoder;
 using Poco::Base64Decoder;
+using Poco::Base64Codec;
 using Poco::DataFormatException;
 
 
@@ -343,6 +345,56 @@ void Base64Test::testEncodeDecode()
 }
 
 
+void Base64Test::testCodec()
+{
+	assert (Base64Codec::encode("", 0) == "");
+	assert (Base64Codec::encode("f", 1) == "Zg==");
+	assert (Base64Codec::encode("fo", 2) == "Zm8=");
+	assert (Base64Codec::encode("foo", 3) == "Zm9v");
+	assert (Base64Codec::encode("foob", 4) == "Zm9vYg==");
+	assert (Base64Codec::encode("fooba", 5) == "Zm9vYmE=");
+	assert (Base64Codec::encode("foobar", 6) == "Zm9vYmFy");
+	assert (Base64Codec::encode("foob", 4, Poco::BASE64_NO_PADDING) == "Zm9vYg");
+
+	assert (Base64Codec::decode(std::string("Zm9vYmFy")) == "foobar");
+	assert (Base64Codec::decode(std::string("Zm9vYmE=")) == "fooba");
+	assert (Base64Codec::decode(std::string("Zm9v\r\nYmFy")) == "foobar");
+	assert (Base64Codec::decode(std::string("Zm9vYg"), Poco::BASE64_NO_PADDING) == "foob");
+
+	std::string binary("\xfb\xef\xff", 3);
+	assert (Base64Codec::encode(binary.data(), binary.size(), Poco::BASE64_URL_ENCODING) == "--__");
+	assert (Base64Codec::decode(std::string("--__"), Poco::BASE64_URL_ENCODING) == binary);
+
+	// codec output must match the stream encoder for long input
+	std::string data;
+	for (int i = 0; i < 1000; ++i) data += char(i % 256);
+	std::ostringstream ostr;
+	Base64Encoder encoder(ostr);
+	encoder.rdbuf()->setLineLength(0);
+	encoder.write(data.data(), (std::streamsize) data.size());
+	encoder.close();
+	assert (Base64Codec::encode(data.data(), data.size()) == ostr.str());
+	assert (Base64Codec::decode(ostr.str()) == data);
+
+	try
+	{
+		Base64Codec::decode(std::string("Zm9v!mFy"));
+		failmsg("bad character - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		Base64Codec::decode(std::string("Zm9vYmE"));
+		failmsg("truncated input - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+}
+
+
 void Base64Test::setUp()
 {
 }
@@ -364,6 +416,7 @@ CppUnit::Test* Base64Test::suite()
 	CppUnit_addTest(pSuite, Base64Test, testDecoderURL);
 	CppUnit_addTest(pSuite, Base64Test, testDecoderNoPadding);
 	CppUnit_addTest(pSuite, Base64Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base64Test, testCodec);
 
 	return pSuite;
 }
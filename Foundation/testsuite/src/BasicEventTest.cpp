@@ -398,6 +398,19 @@ int BasicEventTest::getCount() const
 	return _count;
 }
 
+void BasicEventTest::testRvalueNotify()
+{
+	Simple += delegate(this, &BasicEventTest::onSimple);
+	Simple.notify(this, 42);
+	assert (_count == 1);
+	Simple(this, 43);
+	assert (_count == 2);
+	Simple -= delegate(this, &BasicEventTest::onSimple);
+	Simple.notify(this, 44);
+	assert (_count == 2);
+}
+
+
 void BasicEventTest::setUp()
 {
 	_count = 0;
@@ -434,5 +447,6 @@ CppUnit::Test* BasicEventTest::suite()
 	CppUnit_addTest(pSuite, BasicEventTest, testOverwriteDelegate);
 	CppUnit_addTest(pSuite, BasicEventTest, testAsyncNotify);
 	CppUnit_addTest(pSuite, BasicEventTest, testNullMutex);
+	CppUnit_addTest(pSuite, BasicEventTest, testRvalueNotify);
 	return pSuite;
 }
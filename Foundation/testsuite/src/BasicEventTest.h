@@ -44,6 +44,7 @@ public:
 	void testOverwriteDelegate();
 	void testAsyncNotify();
 	void testNullMutex();
+	void testRvalueNotify();
 	
 	void setUp();
 	void tearDown();
@@ -0,0 +1,146 @@
+//
+// BinaryLogChannelTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/BinaryLogChannel.h"
+#include "Poco/BinaryLogReader.h"
+#include "Poco/Message.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/Timestamp.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/AutoPtr.h"
+#include "BinaryLogChannelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+
+
+using Poco::BinaryLogChannel;
+using Poco::BinaryLogReader;
+using Poco::Message;
+using Poco::File;
+using Poco::FileInputStream;
+using Poco::Timestamp;
+using Poco::DateTimeFormatter;
+using Poco::AutoPtr;
+
+
+BinaryLogChannelTest::BinaryLogChannelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+BinaryLogChannelTest::~BinaryLogChannelTest()
+{
+}
+
+
+void BinaryLogChannelTest::testRoundTrip()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<BinaryLogChannel> pChannel = new BinaryLogChannel(name);
+		pChannel->open();
+		Message msg1("source", "first message", Message::PRIO_INFORMATION);
+		msg1.set("param", "value");
+		pChannel->log(msg1);
+		Message msg2("other.source", "second message", Message::PRIO_ERROR);
+		pChannel->log(msg2);
+		pChannel->close();
+
+		FileInputStream istr(name, std::ios::binary);
+		BinaryLogReader reader(istr);
+		Message msg;
+		assert (reader.next(msg));
+		assert (msg.getSource() == "source");
+		assert (msg.getText() == "first message");
+		assert (msg.getPriority() == Message::PRIO_INFORMATION);
+		assert (msg.getTime() == msg1.getTime());
+		assert (msg.get("param") == "value");
+		assert (reader.next(msg));
+		assert (msg.getSource() == "other.source");
+		assert (msg.getText() == "second message");
+		assert (msg.getPriority() == Message::PRIO_ERROR);
+		assert (!msg.has("param"));
+		assert (!reader.next(msg));
+	}
+	catch (...)
+	{
+		File f(name);
+		f.remove();
+		throw;
+	}
+	File f(name);
+	f.remove();
+}
+
+
+void BinaryLogChannelTest::testAppend()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<BinaryLogChannel> pChannel = new BinaryLogChannel(name);
+		pChannel->open();
+		pChannel->log(Message("source", "before reopen", Message::PRIO_INFORMATION));
+		pChannel->close();
+		pChannel->open();
+		pChannel->log(Message("source", "after reopen", Message::PRIO_WARNING));
+		pChannel->close();
+
+		FileInputStream istr(name, std::ios::binary);
+		BinaryLogReader reader(istr);
+		Message msg;
+		assert (reader.next(msg));
+		assert (msg.getText() == "before reopen");
+		assert (reader.next(msg));
+		assert (msg.getText() == "after reopen");
+		assert (msg.getPriority() == Message::PRIO_WARNING);
+		assert (!reader.next(msg));
+	}
+	catch (...)
+	{
+		File f(name);
+		f.remove();
+		throw;
+	}
+	File f(name);
+	f.remove();
+}
+
+
+void BinaryLogChannelTest::setUp()
+{
+}
+
+
+void BinaryLogChannelTest::tearDown()
+{
+}
+
+
+std::string BinaryLogChannelTest::filename() const
+{
+	std::string name = "binlog_";
+	name.append(DateTimeFormatter::format(Timestamp(), "%Y%m%d%H%M%S"));
+	name.append(".log");
+	return name;
+}
+
+
+CppUnit::Test* BinaryLogChannelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("BinaryLogChannelTest");
+
+	CppUnit_addTest(pSuite, BinaryLogChannelTest, testRoundTrip);
+	CppUnit_addTest(pSuite, BinaryLogChannelTest, testAppend);
+
+	return pSuite;
+}
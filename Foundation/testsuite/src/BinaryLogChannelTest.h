@@ -0,0 +1,40 @@
+//
+// BinaryLogChannelTest.h
+//
+// Definition of the BinaryLogChannelTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef BinaryLogChannelTest_INCLUDED
+#define BinaryLogChannelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class BinaryLogChannelTest: public CppUnit::TestCase
+{
+public:
+	BinaryLogChannelTest(const std::string& name);
+	~BinaryLogChannelTest();
+
+	void testRoundTrip();
+	void testAppend();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+	std::string filename() const;
+};
+
+
+#endif // BinaryLogChannelTest_INCLUDED
@@ -14,6 +14,7 @@
 #include "Poco/BinaryWriter.h"
 #include "Poco/BinaryReader.h"
 #include "Poco/Buffer.h"
+#include <cstring>
 #include <sstream>
 
 
@@ -76,6 +77,98 @@ void BinaryReaderWriterTest::testLittleEndian()
 }
 
 
+void BinaryReaderWriterTest::testArray()
+{
+	BinaryWriter::StreamByteOrder orders[] =
+	{
+		BinaryWriter::NATIVE_BYTE_ORDER,
+		BinaryWriter::BIG_ENDIAN_BYTE_ORDER,
+		BinaryWriter::LITTLE_ENDIAN_BYTE_ORDER
+	};
+	for (int i = 0; i < 3; ++i)
+	{
+		std::stringstream sstream;
+		BinaryWriter writer(sstream, orders[i]);
+		BinaryReader reader(sstream, static_cast<BinaryReader::StreamByteOrder>(orders[i]));
+
+		char chars[4] = {'a', 'b', 'c', 'd'};
+		Poco::UInt16 shorts[3] = {1, 50000, 0x1234};
+		Int32 ints[3] = {-123456, 123456, 0x12345678};
+		double doubles[515];
+		for (int j = 0; j < 515; ++j) doubles[j] = j - 257.5;
+
+		writer.writeArray(chars, 4);
+		writer.writeArray(shorts, 3);
+		writer.writeArray(ints, 3);
+		writer.writeArray(doubles, 515);
+
+		char rchars[4];
+		Poco::UInt16 rshorts[3];
+		Int32 rints[3];
+		double rdoubles[515];
+
+		reader.readArray(rchars, 4);
+		reader.readArray(rshorts, 3);
+		reader.readArray(rints, 3);
+		reader.readArray(rdoubles, 515);
+		assert (reader.good());
+
+		assert (std::memcmp(rchars, chars, sizeof(chars)) == 0);
+		assert (std::memcmp(rshorts, shorts, sizeof(shorts)) == 0);
+		assert (std::memcmp(rints, ints, sizeof(ints)) == 0);
+		assert (std::memcmp(rdoubles, doubles, sizeof(doubles)) == 0);
+	}
+
+	// the stream contents must match those produced by single-value inserters
+	{
+		std::stringstream sstream1;
+		std::stringstream sstream2;
+		BinaryWriter writer1(sstream1, BinaryWriter::BIG_ENDIAN_BYTE_ORDER);
+		BinaryWriter writer2(sstream2, BinaryWriter::BIG_ENDIAN_BYTE_ORDER);
+		Int32 ints[3] = {-123456, 123456, 0x12345678};
+		writer1.writeArray(ints, 3);
+		for (int i = 0; i < 3; ++i) writer2 << ints[i];
+		assert (sstream1.str() == sstream2.str());
+	}
+}
+
+
+void BinaryReaderWriterTest::testZigZagEncoded()
+{
+	std::stringstream sstream;
+	BinaryWriter writer(sstream);
+	BinaryReader reader(sstream);
+
+	Int32 values32[] = {0, -1, 1, -64, 64, -123456, 123456, -2147483647, 2147483647};
+	for (unsigned i = 0; i < sizeof(values32)/sizeof(Int32); ++i)
+		writer.writeZigZagEncoded(values32[i]);
+
+	// small magnitudes, positive or negative, must encode in one byte
+	assert (sstream.str().size() < 9*5);
+	assert (sstream.str()[0] == 0);
+
+	for (unsigned i = 0; i < sizeof(values32)/sizeof(Int32); ++i)
+	{
+		Int32 value;
+		reader.readZigZagEncoded(value);
+		assert (value == values32[i]);
+	}
+
+#if defined(POCO_HAVE_INT64)
+	Int64 values64[] = {0, -1, 1, -1234567890, 1234567890, -4611686018427387904LL, 4611686018427387904LL};
+	for (unsigned i = 0; i < sizeof(values64)/sizeof(Int64); ++i)
+		writer.writeZigZagEncoded(values64[i]);
+	for (unsigned i = 0; i < sizeof(values64)/sizeof(Int64); ++i)
+	{
+		Int64 value;
+		reader.readZigZagEncoded(value);
+		assert (value == values64[i]);
+	}
+#endif
+	assert (reader.good());
+}
+
+
 void BinaryReaderWriterTest::write(BinaryWriter& writer)
 {
 	writer << true;
@@ -276,6 +369,8 @@ CppUnit::Test* BinaryReaderWriterTest::suite()
 	CppUnit_addTest(pSuite, BinaryReaderWriterTest, testBigEndian);
 	CppUnit_addTest(pSuite, BinaryReaderWriterTest, testLittleEndian);
 	CppUnit_addTest(pSuite, BinaryReaderWriterTest, testWrappers);
+	CppUnit_addTest(pSuite, BinaryReaderWriterTest, testArray);
+	CppUnit_addTest(pSuite, BinaryReaderWriterTest, testZigZagEncoded);
 
 	return pSuite;
 }
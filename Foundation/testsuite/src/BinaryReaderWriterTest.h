@@ -30,6 +30,8 @@ public:
 	void testBigEndian();
 	void testLittleEndian();
 	void testWrappers();
+	void testArray();
+	void testZigZagEncoded();
 	void write(Poco::BinaryWriter& writer);
 	void read(Poco::BinaryReader& reader);
 
@@ -0,0 +1,130 @@
+//
+// BucketExpireCacheTest.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "BucketExpireCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/BucketExpireCache.h"
+#include "Poco/AccessBucketExpireCache.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+
+
+using Poco::BucketExpireCache;
+using Poco::AccessBucketExpireCache;
+using Poco::Thread;
+
+
+BucketExpireCacheTest::BucketExpireCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+BucketExpireCacheTest::~BucketExpireCacheTest()
+{
+}
+
+
+void BucketExpireCacheTest::testClear()
+{
+	BucketExpireCache<int, int> aCache(600000);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assert (aCache.has(1));
+	assert (aCache.has(3));
+	assert (aCache.has(5));
+	assert (*aCache.get(1) == 2);
+	assert (*aCache.get(3) == 4);
+	assert (*aCache.get(5) == 6);
+	aCache.clear();
+	assert (!aCache.has(1));
+	assert (!aCache.has(3));
+	assert (!aCache.has(5));
+
+	try
+	{
+		BucketExpireCache<int, int> badCache(24);
+		failmsg("cache expire lower than 25 is illegal, test should fail");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void BucketExpireCacheTest::testExpire()
+{
+	// 80ms in 8 buckets: entries live between 80 and 90 ms
+	BucketExpireCache<int, int> aCache(80, 8);
+	aCache.add(1, 2);
+	assert (aCache.has(1));
+	assert (*aCache.get(1) == 2);
+	Thread::sleep(40);
+	assert (aCache.has(1)); // must never expire early
+	Thread::sleep(90);
+	assert (!aCache.has(1));
+	assert (aCache.get(1).isNull());
+	assert (aCache.size() == 0);
+}
+
+
+void BucketExpireCacheTest::testAccessExpire()
+{
+	AccessBucketExpireCache<int, int> aCache(80, 8);
+	aCache.add(1, 2);
+	for (int i = 0; i < 5; ++i)
+	{
+		Thread::sleep(40);
+		// each get refreshes the expiration time
+		assert (!aCache.get(1).isNull());
+	}
+	Thread::sleep(130);
+	assert (!aCache.has(1));
+}
+
+
+void BucketExpireCacheTest::testBatchSweep()
+{
+	const int N = 10000;
+
+	BucketExpireCache<int, int> aCache(80, 8);
+	for (int i = 0; i < N; ++i)
+	{
+		aCache.add(i, i);
+	}
+	assert (aCache.size() == N);
+	Thread::sleep(130);
+	aCache.forceReplace();
+	assert (aCache.size() == 0);
+}
+
+
+void BucketExpireCacheTest::setUp()
+{
+}
+
+
+void BucketExpireCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* BucketExpireCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("BucketExpireCacheTest");
+
+	CppUnit_addTest(pSuite, BucketExpireCacheTest, testClear);
+	CppUnit_addTest(pSuite, BucketExpireCacheTest, testExpire);
+	CppUnit_addTest(pSuite, BucketExpireCacheTest, testAccessExpire);
+	CppUnit_addTest(pSuite, BucketExpireCacheTest, testBatchSweep);
+
+	return pSuite;
+}
@@ -0,0 +1,41 @@
+//
+// BucketExpireCacheTest.h
+//
+// Definition of the BucketExpireCacheTest class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef BucketExpireCacheTest_INCLUDED
+#define BucketExpireCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class BucketExpireCacheTest: public CppUnit::TestCase
+{
+public:
+	BucketExpireCacheTest(const std::string& name);
+	~BucketExpireCacheTest();
+
+	void testClear();
+	void testExpire();
+	void testAccessExpire();
+	void testBatchSweep();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // BucketExpireCacheTest_INCLUDED
@@ -14,6 +14,8 @@
 #include "ExpireLRUCacheTest.h"
 #include "UniqueExpireCacheTest.h"
 #include "UniqueExpireLRUCacheTest.h"
+#include "ShardedCacheTest.h"
+#include "BucketExpireCacheTest.h"
 
 CppUnit::Test* CacheTestSuite::suite()
 {
@@ -24,6 +26,8 @@ CppUnit::Test* CacheTestSuite::suite()
 	pSuite->addTest(UniqueExpireCacheTest::suite());
 	pSuite->addTest(ExpireLRUCacheTest::suite());
 	pSuite->addTest(UniqueExpireLRUCacheTest::suite());
+	pSuite->addTest(ShardedCacheTest::suite());
+	pSuite->addTest(BucketExpireCacheTest::suite());
 
 	return pSuite;
 }
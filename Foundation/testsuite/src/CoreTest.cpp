@@ -19,6 +19,7 @@
 #include "Poco/Buffer.h"
 #include "Poco/FIFOBuffer.h"
 #include "Poco/AtomicCounter.h"
+#include "Poco/StripedCounter.h"
 #include "Poco/Nullable.h"
 #include "Poco/Ascii.h"
 #include "Poco/BasicEvent.h"
@@ -71,6 +72,29 @@ namespace
 	private:
 		AtomicCounter& _counter;
 	};
+
+	class SCTRunnable: public Poco::Runnable
+	{
+	public:
+		SCTRunnable(Poco::StripedCounter& counter):
+			_counter(counter)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < 100000; ++i)
+			{
+				_counter.increment();
+				_counter.decrement();
+				_counter.add(2);
+				_counter.add(-2);
+			}
+		}
+
+	private:
+		Poco::StripedCounter& _counter;
+	};
 }
 
 
@@ -422,6 +446,67 @@ void CoreTest::testFIFOBufferEOFAndError()
 }
 
 
+void CoreTest::testFIFOBufferDirectAccess()
+{
+	typedef FIFOBuffer::Type T;
+
+	FIFOBuffer f(20);
+
+	std::size_t length = 0;
+	assert (0 == f.beginRead(length));
+	assert (0 == length);
+
+	T* ptr = f.beginWrite(length);
+	assert (0 != ptr);
+	assert (20 == length);
+	std::memcpy(ptr, "0123456789", 10);
+	f.endWrite(10);
+	assert (10 == f.used());
+
+	const T* readPtr = f.beginRead(length);
+	assert (0 != readPtr);
+	assert (10 == length);
+	assert (0 == std::memcmp(readPtr, "0123456789", 10));
+	f.endRead(4);
+	assert (6 == f.used());
+
+	readPtr = f.beginRead(length);
+	assert (6 == length);
+	assert (0 == std::memcmp(readPtr, "456789", 6));
+
+	// beginWrite() compacts the buffer, so the whole
+	// available space is contiguous
+	ptr = f.beginWrite(length);
+	assert (14 == length);
+	std::memcpy(ptr, "abcdefghijklmn", 14);
+	f.endWrite(14);
+	assert (f.isFull());
+
+	assert (0 == f.beginWrite(length));
+	assert (0 == length);
+
+	readPtr = f.beginRead(length);
+	assert (20 == length);
+	assert (0 == std::memcmp(readPtr, "456789abcdefghijklmn", 20));
+	f.endRead(20);
+	assert (f.isEmpty());
+
+	try
+	{
+		f.endRead(1);
+		fail ("must throw InvalidAccessException");
+	}
+	catch (InvalidAccessException&) { }
+
+	try
+	{
+		f.endWrite(21);
+		fail ("must throw InvalidAccessException");
+	}
+	catch (InvalidAccessException&) { }
+}
+
+
 void CoreTest::testFIFOBufferChar()
 {
 	typedef FIFOBuffer::Type T;
@@ -940,11 +1025,51 @@ void CoreTest::testAtomicCounter()
 	t3.join();
 	t4.join();
 	t5.join();
-	
+
 	assert (ac.value() == 0);
 }
 
 
+void CoreTest::testStripedCounter()
+{
+	Poco::StripedCounter sc;
+
+	assert (sc.value() == 0);
+	sc.increment();
+	assert (sc.value() == 1);
+	sc.decrement();
+	assert (sc.value() == 0);
+	sc.add(42);
+	assert (sc.value() == 42);
+	sc.add(-42);
+	assert (sc.value() == 0);
+
+	Poco::StripedCounter sc2(2);
+	assert (sc2.value() == 2);
+
+	SCTRunnable sct(sc);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	Thread t4;
+	Thread t5;
+
+	t1.start(sct);
+	t2.start(sct);
+	t3.start(sct);
+	t4.start(sct);
+	t5.start(sct);
+
+	t1.join();
+	t2.join();
+	t3.join();
+	t4.join();
+	t5.join();
+
+	assert (sc.value() == 0);
+}
+
+
 void CoreTest::testNullable()
 {
 	Nullable<int> i;
@@ -1158,7 +1283,9 @@ CppUnit::Test* CoreTest::suite()
 	CppUnit_addTest(pSuite, CoreTest, testFIFOBufferChar);
 	CppUnit_addTest(pSuite, CoreTest, testFIFOBufferInt);
 	CppUnit_addTest(pSuite, CoreTest, testFIFOBufferEOFAndError);
+	CppUnit_addTest(pSuite, CoreTest, testFIFOBufferDirectAccess);
 	CppUnit_addTest(pSuite, CoreTest, testAtomicCounter);
+	CppUnit_addTest(pSuite, CoreTest, testStripedCounter);
 	CppUnit_addTest(pSuite, CoreTest, testNullable);
 	CppUnit_addTest(pSuite, CoreTest, testAscii);
 
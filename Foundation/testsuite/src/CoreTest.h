@@ -33,7 +33,9 @@ public:
 	void testFIFOBufferChar();
 	void testFIFOBufferInt();
 	void testFIFOBufferEOFAndError();
+	void testFIFOBufferDirectAccess();
 	void testAtomicCounter();
+	void testStripedCounter();
 	void testNullable();
 	void testAscii();
 
@@ -17,6 +17,7 @@
 #include "ByteOrderTest.h"
 #include "StringTest.h"
 #include "StringTokenizerTest.h"
+#include "StringTokenizerViewTest.h"
 #ifndef POCO_VXWORKS
 #include "FPETest.h"
 #endif
@@ -26,6 +27,8 @@
 #include "NumberParserTest.h"
 #include "DynamicFactoryTest.h"
 #include "MemoryPoolTest.h"
+#include "MetricsTest.h"
+#include "ArenaAllocatorTest.h"
 #include "AnyTest.h"
 #include "VarTest.h"
 #include "FormatTest.h"
@@ -50,6 +53,7 @@ CppUnit::Test* CoreTestSuite::suite()
 	pSuite->addTest(ByteOrderTest::suite());
 	pSuite->addTest(StringTest::suite());
 	pSuite->addTest(StringTokenizerTest::suite());
+	pSuite->addTest(StringTokenizerViewTest::suite());
 #ifndef POCO_VXWORKS
 	pSuite->addTest(FPETest::suite());
 #endif
@@ -59,6 +63,8 @@ CppUnit::Test* CoreTestSuite::suite()
 	pSuite->addTest(NumberParserTest::suite());
 	pSuite->addTest(DynamicFactoryTest::suite());
 	pSuite->addTest(MemoryPoolTest::suite());
+	pSuite->addTest(MetricsTest::suite());
+	pSuite->addTest(ArenaAllocatorTest::suite());
 	pSuite->addTest(AnyTest::suite());
 	pSuite->addTest(VarTest::suite());
 	pSuite->addTest(FormatTest::suite());
@@ -16,6 +16,7 @@
 #include "PBKDF2EngineTest.h"
 #include "DigestStreamTest.h"
 #include "RandomTest.h"
+#include "FastRandomTest.h"
 #include "RandomStreamTest.h"
 
 
@@ -30,6 +31,7 @@ CppUnit::Test* CryptTestSuite::suite()
 	pSuite->addTest(PBKDF2EngineTest::suite());
 	pSuite->addTest(DigestStreamTest::suite());
 	pSuite->addTest(RandomTest::suite());
+	pSuite->addTest(FastRandomTest::suite());
 	pSuite->addTest(RandomStreamTest::suite());
 
 	return pSuite;
@@ -15,12 +15,16 @@
 #include "Poco/DateTimeFormat.h"
 #include "Poco/DateTime.h"
 #include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/CompiledDateTimeFormat.h"
 
 
 using Poco::DateTime;
 using Poco::Timespan;
 using Poco::DateTimeFormat;
 using Poco::DateTimeFormatter;
+using Poco::CompiledDateTimeFormat;
+using Poco::Timestamp;
 
 
 DateTimeFormatterTest::DateTimeFormatterTest(const std::string& name)
@@ -198,6 +202,34 @@ void DateTimeFormatterTest::testTimespan()
 }
 
 
+void DateTimeFormatterTest::testCompiledFormat()
+{
+	DateTime dt(2005, 1, 8, 12, 30, 0, 250);
+
+	CompiledDateTimeFormat sortable(DateTimeFormat::SORTABLE_FORMAT);
+	assert (sortable.pattern() == DateTimeFormat::SORTABLE_FORMAT);
+	assert (!sortable.isSubSecond());
+	assert (sortable.format(dt) == DateTimeFormatter::format(dt, DateTimeFormat::SORTABLE_FORMAT));
+
+	CompiledDateTimeFormat frac(DateTimeFormat::ISO8601_FRAC_FORMAT);
+	assert (frac.isSubSecond());
+	assert (frac.format(dt, 3600) == DateTimeFormatter::format(dt, DateTimeFormat::ISO8601_FRAC_FORMAT, 3600));
+
+	CompiledDateTimeFormat custom("%w/%W/%b/%B/%d/%e/%f/%m/%n/%o/%y/%Y/%H/%h/%a/%A/%M/%S/%s/%i/%c/%F/%z/%Z/%x/%%");
+	assert (custom.format(dt) == DateTimeFormatter::format(dt, custom.pattern()));
+
+	// for whole-second patterns, timestamps within the same
+	// second reuse the cached result
+	Timestamp now;
+	std::string str = sortable.format(now);
+	assert (str == DateTimeFormatter::format(now, DateTimeFormat::SORTABLE_FORMAT));
+	assert (sortable.format(now) == str);
+	str.clear();
+	sortable.append(str, now);
+	assert (str == DateTimeFormatter::format(now, DateTimeFormat::SORTABLE_FORMAT));
+}
+
+
 void DateTimeFormatterTest::setUp()
 {
 }
@@ -223,6 +255,7 @@ CppUnit::Test* DateTimeFormatterTest::suite()
 	CppUnit_addTest(pSuite, DateTimeFormatterTest, testSORTABLE);
 	CppUnit_addTest(pSuite, DateTimeFormatterTest, testCustom);
 	CppUnit_addTest(pSuite, DateTimeFormatterTest, testTimespan);
+	CppUnit_addTest(pSuite, DateTimeFormatterTest, testCompiledFormat);
 
 	return pSuite;
 }
@@ -35,6 +35,7 @@ public:
 	void testSORTABLE();
 	void testCustom();
 	void testTimespan();
+	void testCompiledFormat();
 	
 	void setUp();
 	void tearDown();
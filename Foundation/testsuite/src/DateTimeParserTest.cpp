@@ -758,6 +758,47 @@ void DateTimeParserTest::testParseDayOfWeek()
 }
 
 
+void DateTimeParserTest::testISO8601FastPath()
+{
+	int tzd = 99;
+	DateTime dt;
+	std::string str("2005-01-08T12:30:05.123456+01:00");
+	assert (DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	assert (dt.year() == 2005);
+	assert (dt.month() == 1);
+	assert (dt.day() == 8);
+	assert (dt.hour() == 12);
+	assert (dt.minute() == 30);
+	assert (dt.second() == 5);
+	assert (dt.millisecond() == 123);
+	assert (dt.microsecond() == 456);
+	assert (tzd == 3600);
+
+	str = "2005-01-08T12:30:00Z";
+	assert (DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	assert (dt.hour() == 12);
+	assert (tzd == 0);
+
+	str = "2005-01-08";
+	assert (DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	assert (dt.day() == 8);
+	assert (dt.hour() == 0);
+
+	// irregular input must be rejected, leaving the
+	// output arguments unchanged
+	dt.assign(1999, 9, 9);
+	tzd = 42;
+	str = "2005-1-08T12:30:00Z";
+	assert (!DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	str = "2005-01-08X12:30:00";
+	assert (!DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	str = "2005-13-40";
+	assert (!DateTimeParser::tryParseISO8601(str.data(), str.size(), dt, tzd));
+	assert (dt.year() == 1999);
+	assert (tzd == 42);
+}
+
+
 void DateTimeParserTest::setUp()
 {
 }
@@ -782,6 +823,7 @@ CppUnit::Test* DateTimeParserTest::suite()
 	CppUnit_addTest(pSuite, DateTimeParserTest, testASCTIME);
 	CppUnit_addTest(pSuite, DateTimeParserTest, testSORTABLE);
 	CppUnit_addTest(pSuite, DateTimeParserTest, testCustom);
+	CppUnit_addTest(pSuite, DateTimeParserTest, testISO8601FastPath);
 	CppUnit_addTest(pSuite, DateTimeParserTest, testGuess);
 	CppUnit_addTest(pSuite, DateTimeParserTest, testParseMonth);
 	CppUnit_addTest(pSuite, DateTimeParserTest, testParseDayOfWeek);
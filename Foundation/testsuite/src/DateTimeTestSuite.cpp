@@ -11,6 +11,7 @@
 #include "DateTimeTestSuite.h"
 #include "TimestampTest.h"
 #include "ClockTest.h"
+#include "FastClockTest.h"
 #include "TimespanTest.h"
 #include "TimezoneTest.h"
 #include "DateTimeTest.h"
@@ -25,6 +26,7 @@ CppUnit::Test* DateTimeTestSuite::suite()
 
 	pSuite->addTest(TimestampTest::suite());
 	pSuite->addTest(ClockTest::suite());
+	pSuite->addTest(FastClockTest::suite());
 	pSuite->addTest(TimespanTest::suite());
 	pSuite->addTest(TimezoneTest::suite());
 	pSuite->addTest(DateTimeTest::suite());
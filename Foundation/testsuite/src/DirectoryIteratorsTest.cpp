@@ -51,6 +51,44 @@ void DirectoryIteratorsTest::testDirectoryIterator()
 }
 
 
+void DirectoryIteratorsTest::testDirectoryEntry()
+{
+	Path p = path();
+	DirectoryIterator dirIterator(p);
+	DirectoryIterator end;
+	int files = 0;
+	int dirs = 0;
+
+	while (dirIterator != end)
+	{
+		DirEntry entry;
+		File file(dirIterator->path());
+		assert (dirIterator.entry(entry));
+		assertEquals(dirIterator.name(), entry.name);
+		if (entry.type == DirEntry::ENTRY_DIRECTORY)
+		{
+			assert (file.isDirectory());
+			++dirs;
+		}
+		else if (entry.type == DirEntry::ENTRY_FILE)
+		{
+			assert (file.isFile());
+			assertEquals((long) file.getSize(), (long) entry.size);
+			assert (entry.lastModified == file.getLastModified());
+			++files;
+		}
+		++dirIterator;
+	}
+
+	assertEquals(6, files);
+	assertEquals(1, dirs);
+
+	assert (end.entryType() == DirEntry::ENTRY_UNKNOWN);
+	DirEntry entry;
+	assert (!end.entry(entry));
+}
+
+
 void DirectoryIteratorsTest::testSortedDirectoryIterator()
 {
 	Path p = path();
@@ -197,6 +235,7 @@ CppUnit::Test* DirectoryIteratorsTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("DirectoryIteratorsTest");
 
 	CppUnit_addTest(pSuite, DirectoryIteratorsTest, testDirectoryIterator);
+	CppUnit_addTest(pSuite, DirectoryIteratorsTest, testDirectoryEntry);
 	CppUnit_addTest(pSuite, DirectoryIteratorsTest, testSortedDirectoryIterator);
 	CppUnit_addTest(pSuite, DirectoryIteratorsTest, testSimpleRecursiveDirectoryIterator);
 	CppUnit_addTest(pSuite, DirectoryIteratorsTest, testSiblingsFirstRecursiveDirectoryIterator);
@@ -26,6 +26,7 @@ public:
 	~DirectoryIteratorsTest();
 
 	void testDirectoryIterator();
+	void testDirectoryEntry();
 	void testSortedDirectoryIterator();
 	void testSimpleRecursiveDirectoryIterator();
 	void testSiblingsFirstRecursiveDirectoryIterator();
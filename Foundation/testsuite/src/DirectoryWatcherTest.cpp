@@ -188,10 +188,46 @@ void DirectoryWatcherTest::testMoved()
 }
 
 
+void DirectoryWatcherTest::testMovedPair()
+{
+	Poco::Path p(path());
+	p.setFileName("test.txt");
+	Poco::FileOutputStream fos(p.toString());
+	fos << "Hello, world!";
+	fos.close();
+
+	DirectoryWatcher dw(path().toString(), DirectoryWatcher::DW_FILTER_ENABLE_ALL, 2);
+
+	dw.itemMoved += Poco::delegate(this, &DirectoryWatcherTest::onItemMoved);
+
+	Poco::Thread::sleep(1000);
+
+	Poco::Path p2(path());
+	p2.setFileName("test2.txt");
+	Poco::File f(p.toString());
+	f.renameTo(p2.toString());
+
+	Poco::Thread::sleep(2000*dw.scanInterval());
+
+	if (dw.supportsMoveEvents())
+	{
+		assert (_moveEvents.size() == 1);
+		assert (Poco::Path(_moveEvents[0].fromPath).getFileName() == "test.txt");
+		assert (Poco::Path(_moveEvents[0].toPath).getFileName() == "test2.txt");
+	}
+	else
+	{
+		assert (_moveEvents.empty());
+	}
+	assert (!_error);
+}
+
+
 void DirectoryWatcherTest::setUp()
 {
 	_error = false;
 	_events.clear();
+	_moveEvents.clear();
 	
 	try
 	{
@@ -270,6 +306,15 @@ void DirectoryWatcherTest::onItemMovedTo(const Poco::DirectoryWatcher::Directory
 }
 
 
+void DirectoryWatcherTest::onItemMoved(const Poco::DirectoryWatcher::DirectoryMoveEvent& ev)
+{
+	MoveEvent me;
+	me.fromPath = ev.fromItem.path();
+	me.toPath = ev.toItem.path();
+	_moveEvents.push_back(me);
+}
+
+
 void DirectoryWatcherTest::onError(const Poco::Exception& exc)
 {
 	_error = true;
@@ -292,6 +337,7 @@ CppUnit::Test* DirectoryWatcherTest::suite()
 	CppUnit_addTest(pSuite, DirectoryWatcherTest, testRemoved);
 	CppUnit_addTest(pSuite, DirectoryWatcherTest, testModified);
 	CppUnit_addTest(pSuite, DirectoryWatcherTest, testMoved);
+	CppUnit_addTest(pSuite, DirectoryWatcherTest, testMovedPair);
 
 	return pSuite;
 }
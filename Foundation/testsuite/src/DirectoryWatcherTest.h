@@ -35,7 +35,8 @@ public:
 	void testRemoved();
 	void testModified();
 	void testMoved();
-	
+	void testMovedPair();
+
 	void setUp();
 	void tearDown();
 
@@ -47,6 +48,7 @@ protected:
 	void onItemModified(const Poco::DirectoryWatcher::DirectoryEvent& ev);
 	void onItemMovedFrom(const Poco::DirectoryWatcher::DirectoryEvent& ev);
 	void onItemMovedTo(const Poco::DirectoryWatcher::DirectoryEvent& ev);
+	void onItemMoved(const Poco::DirectoryWatcher::DirectoryMoveEvent& ev);
 	void onError(const Poco::Exception& exc);
 	
 	Poco::Path path() const;
@@ -58,7 +60,13 @@ private:
 		std::string callback;
 		std::string path;
 	};
+	struct MoveEvent
+	{
+		std::string fromPath;
+		std::string toPath;
+	};
 	std::vector<DirEvent> _events;
+	std::vector<MoveEvent> _moveEvents;
 	bool _error;
 };
 
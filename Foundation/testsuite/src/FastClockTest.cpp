@@ -0,0 +1,102 @@
+//
+// FastClockTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "FastClockTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/FastClock.h"
+#include "Poco/Clock.h"
+#include "Poco/Thread.h"
+
+
+using Poco::FastClock;
+using Poco::Clock;
+using Poco::Thread;
+
+
+FastClockTest::FastClockTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+FastClockTest::~FastClockTest()
+{
+}
+
+
+void FastClockTest::testFastClock()
+{
+	FastClock t1;
+	Thread::sleep(200);
+	FastClock t2;
+	FastClock t3 = t2;
+	assert (t1 != t2);
+	assert (!(t1 == t2));
+	assert (t2 > t1);
+	assert (t2 >= t1);
+	assert (!(t1 > t2));
+	assert (!(t1 >= t2));
+	assert (t2 == t3);
+	assert (!(t2 != t3));
+	assert (t2 >= t3);
+	assert (t2 <= t3);
+	FastClock::ClockDiff d = (t2 - t1);
+	assert (d >= 180000 && d <= 300000);
+
+	t1.swap(t2);
+	assert (t1 > t2);
+	t2.swap(t1);
+
+	FastClock now;
+	Thread::sleep(201);
+	assert (now.elapsed() >= 200000);
+	assert (now.isElapsed(now.elapsed()));
+	assert (!now.isElapsed(now.elapsed() + 100000));
+}
+
+
+void FastClockTest::testCalibration()
+{
+	// FastClock values must stay close to Clock values,
+	// also after an explicit recalibration.
+	FastClock fast;
+	Clock clock;
+	FastClock::ClockDiff d = fast.raw() - clock.raw();
+	if (d < 0) d = -d;
+	assert (d < 100000);
+
+	FastClock::recalibrate();
+	FastClock fast2;
+	Clock clock2;
+	d = fast2.raw() - clock2.raw();
+	if (d < 0) d = -d;
+	assert (d < 100000);
+}
+
+
+void FastClockTest::setUp()
+{
+}
+
+
+void FastClockTest::tearDown()
+{
+}
+
+
+CppUnit::Test* FastClockTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("FastClockTest");
+
+	CppUnit_addTest(pSuite, FastClockTest, testFastClock);
+	CppUnit_addTest(pSuite, FastClockTest, testCalibration);
+
+	return pSuite;
+}
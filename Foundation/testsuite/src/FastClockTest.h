@@ -0,0 +1,37 @@
+//
+// FastClockTest.h
+//
+// Definition of the FastClockTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef FastClockTest_INCLUDED
+#define FastClockTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class FastClockTest: public CppUnit::TestCase
+{
+public:
+	FastClockTest(const std::string& name);
+	~FastClockTest();
+
+	void testFastClock();
+	void testCalibration();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // FastClockTest_INCLUDED
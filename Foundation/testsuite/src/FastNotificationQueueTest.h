@@ -0,0 +1,50 @@
+//
+// FastNotificationQueueTest.h
+//
+// Definition of the FastNotificationQueueTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef FastNotificationQueueTest_INCLUDED
+#define FastNotificationQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+#include "Poco/FastNotificationQueue.h"
+#include "Poco/Mutex.h"
+#include <set>
+
+
+class FastNotificationQueueTest: public CppUnit::TestCase
+{
+public:
+	FastNotificationQueueTest(const std::string& name);
+	~FastNotificationQueueTest();
+
+	void testQueueDequeue();
+	void testWaitDequeue();
+	void testBounds();
+	void testThreads();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+protected:
+	void work();
+
+private:
+	Poco::FastNotificationQueue _queue;
+	std::multiset<std::string>  _handled;
+	Poco::FastMutex             _mutex;
+};
+
+
+#endif // FastNotificationQueueTest_INCLUDED
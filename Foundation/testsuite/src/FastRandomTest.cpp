@@ -0,0 +1,122 @@
+//
+// FastRandomTest.cpp
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "FastRandomTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/FastRandom.h"
+
+
+using Poco::FastRandom;
+
+
+FastRandomTest::FastRandomTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+FastRandomTest::~FastRandomTest()
+{
+}
+
+
+void FastRandomTest::testSequence()
+{
+	FastRandom rnd1(12345);
+	FastRandom rnd2(12345);
+	for (int i = 0; i < 100; ++i)
+	{
+		assert (rnd1.next64() == rnd2.next64());
+	}
+
+	rnd1.seed(12345);
+	rnd2.seed(54321);
+	bool equals = true;
+	for (int i = 0; i < 20; ++i)
+	{
+		if (rnd1.next64() != rnd2.next64())
+		{
+			equals = false;
+			break;
+		}
+	}
+	assert (!equals);
+}
+
+
+void FastRandomTest::testDistribution()
+{
+	FastRandom rnd(123456);
+	const int n = 11;
+	int d[n] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	for (int i = 0; i < 100; ++i)
+	{
+		d[rnd.next(n)] = 1;
+	}
+	int sum = 0;
+	for (int k = 0; k < n; ++k) sum += d[k];
+
+	assert (sum == n);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		float f = rnd.nextFloat();
+		assert (f >= 0.0f && f <= 1.0f);
+		double g = rnd.nextDouble();
+		assert (g >= 0.0 && g <= 1.0);
+	}
+}
+
+
+void FastRandomTest::testFill()
+{
+	FastRandom rnd1(98765);
+	FastRandom rnd2(98765);
+
+	// fill() consumes the same sequence as next64()
+	unsigned char buffer[37];
+	rnd1.fill(buffer, sizeof(buffer));
+
+	int histogram[256] = {0};
+	for (std::size_t i = 0; i < sizeof(buffer); ++i)
+		histogram[buffer[i]]++;
+
+	// all-zero output would mean the generator did not run
+	int zeros = histogram[0];
+	assert (zeros < (int) sizeof(buffer));
+
+	// a second generator with the same seed produces the same bytes
+	unsigned char buffer2[37];
+	rnd2.fill(buffer2, sizeof(buffer2));
+	for (std::size_t i = 0; i < sizeof(buffer); ++i)
+		assert (buffer[i] == buffer2[i]);
+}
+
+
+void FastRandomTest::setUp()
+{
+}
+
+
+void FastRandomTest::tearDown()
+{
+}
+
+
+CppUnit::Test* FastRandomTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("FastRandomTest");
+
+	CppUnit_addTest(pSuite, FastRandomTest, testSequence);
+	CppUnit_addTest(pSuite, FastRandomTest, testDistribution);
+	CppUnit_addTest(pSuite, FastRandomTest, testFill);
+
+	return pSuite;
+}
@@ -0,0 +1,40 @@
+//
+// FastRandomTest.h
+//
+// Definition of the FastRandomTest class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef FastRandomTest_INCLUDED
+#define FastRandomTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class FastRandomTest: public CppUnit::TestCase
+{
+public:
+	FastRandomTest(const std::string& name);
+	~FastRandomTest();
+
+	void testSequence();
+	void testDistribution();
+	void testFill();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // FastRandomTest_INCLUDED
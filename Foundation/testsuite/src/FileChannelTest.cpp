@@ -544,6 +544,59 @@ void FileChannelTest::testWrongPurgeOption()
 }
 
 
+void FileChannelTest::testBufferSize()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "8 K");
+		pChannel->setProperty(FileChannel::PROP_FLUSHINTERVAL, "60000");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 100; ++i)
+		{
+			pChannel->log(msg);
+		}
+		// the messages fit into the buffer; closing the
+		// channel must write them out
+		pChannel->close();
+		File f(name);
+		assert (f.exists());
+		assert (f.getSize() >= 100*25);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+
+	try
+	{
+		// size-based rotation must work with group commit enabled
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "1 K");
+		pChannel->setProperty(FileChannel::PROP_ROTATION, "2 K");
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 200; ++i)
+		{
+			pChannel->log(msg);
+		}
+		pChannel->close();
+		File f(name + ".0");
+		assert (f.exists());
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
 void FileChannelTest::setUp()
 {
 }
@@ -647,6 +700,7 @@ CppUnit::Test* FileChannelTest::suite()
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeAge);
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeCount);
 	CppUnit_addTest(pSuite, FileChannelTest, testWrongPurgeOption);
+	CppUnit_addTest(pSuite, FileChannelTest, testBufferSize);
 
 	return pSuite;
 }
@@ -44,6 +44,7 @@ public:
 	void testPurgeAge();
 	void testPurgeCount();
 	void testWrongPurgeOption();
+	void testBufferSize();
 
 	void setUp();
 	void tearDown();
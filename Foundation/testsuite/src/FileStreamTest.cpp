@@ -303,6 +303,55 @@ void FileStreamTest::testMultiOpen()
 }
 
 
+void FileStreamTest::testAdvise()
+{
+	Poco::TemporaryFile file;
+	{
+		Poco::FileOutputStream ostr(file.path(), std::ios::out | std::ios::trunc, Poco::FileIOS::OPT_DSYNC);
+		ostr << "0123456789";
+		ostr.advise(Poco::FileIOS::ADV_DONTNEED);
+		ostr.close();
+	}
+	{
+		Poco::FileInputStream istr(file.path());
+		istr.advise(Poco::FileIOS::ADV_SEQUENTIAL);
+		std::string s;
+		std::getline(istr, s);
+		assert (s == "0123456789");
+	}
+	{
+		Poco::FileInputStream istr;
+		try
+		{
+			istr.advise(Poco::FileIOS::ADV_SEQUENTIAL);
+			failmsg("advise() on a closed stream - must throw");
+		}
+		catch (Poco::FileException&)
+		{
+		}
+	}
+}
+
+
+void FileStreamTest::testPreallocate()
+{
+	Poco::TemporaryFile file;
+	Poco::FileOutputStream ostr(file.path());
+	ostr.preallocate(16384);
+	assert (Poco::File(file.path()).getSize() == 16384);
+	ostr.preallocate(1024); // must not shrink the file
+	assert (Poco::File(file.path()).getSize() == 16384);
+	ostr << "0123456789";
+	ostr.close();
+
+	Poco::FileInputStream istr(file.path());
+	std::string s;
+	s.resize(10);
+	istr.read(&s[0], 10);
+	assert (s == "0123456789");
+}
+
+
 void FileStreamTest::setUp()
 {
 }
@@ -328,6 +377,8 @@ CppUnit::Test* FileStreamTest::suite()
 	CppUnit_addTest(pSuite, FileStreamTest, testOpenModeApp);
 	CppUnit_addTest(pSuite, FileStreamTest, testSeek);
 	CppUnit_addTest(pSuite, FileStreamTest, testMultiOpen);
+	CppUnit_addTest(pSuite, FileStreamTest, testAdvise);
+	CppUnit_addTest(pSuite, FileStreamTest, testPreallocate);
 
 	return pSuite;
 }
@@ -35,6 +35,8 @@ public:
 	void testOpenModeApp();
 	void testSeek();
 	void testMultiOpen();
+	void testAdvise();
+	void testPreallocate();
 
 	void setUp();
 	void tearDown();
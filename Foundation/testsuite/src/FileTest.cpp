@@ -381,6 +381,36 @@ void FileTest::testCopy()
 }
 
 
+void FileTest::testCopyLarge()
+{
+	std::ofstream ostr("testfile.dat", std::ios::binary);
+	std::string data;
+	for (int i = 0; i < 200000; ++i)
+	{
+		data += "0123456789";
+		data += static_cast<char>(i % 256);
+	}
+	ostr.write(data.data(), (std::streamsize) data.size());
+	ostr.close();
+
+	File f1("testfile.dat");
+	TemporaryFile f2;
+	f1.copyTo(f2.path());
+	assert (f2.exists());
+	assert (f1.getSize() == f2.getSize());
+	std::ifstream istr(f2.path().c_str(), std::ios::binary);
+	std::string copied((std::istreambuf_iterator<char>(istr)), std::istreambuf_iterator<char>());
+	istr.close();
+	assert (copied == data);
+
+	TemporaryFile f3;
+	f1.copyTo(f3.path(), File::OPT_COPY_NO_PAGE_CACHE);
+	assert (f3.exists());
+	assert (f1.getSize() == f3.getSize());
+	f1.remove();
+}
+
+
 void FileTest::testMove()
 {
 	std::ofstream ostr("testfile.dat");
@@ -549,6 +579,7 @@ CppUnit::Test* FileTest::suite()
 	CppUnit_addTest(pSuite, FileTest, testSize);
 	CppUnit_addTest(pSuite, FileTest, testDirectory);
 	CppUnit_addTest(pSuite, FileTest, testCopy);
+	CppUnit_addTest(pSuite, FileTest, testCopyLarge);
 	CppUnit_addTest(pSuite, FileTest, testMove);
 	CppUnit_addTest(pSuite, FileTest, testCopyDirectory);
 	CppUnit_addTest(pSuite, FileTest, testRename);
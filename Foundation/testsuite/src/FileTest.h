@@ -33,6 +33,7 @@ public:
 	void testSize();
 	void testDirectory();
 	void testCopy();
+	void testCopyLarge();
 	void testMove();
 	void testCopyDirectory();
 	void testRename();
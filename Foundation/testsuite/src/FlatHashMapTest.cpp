@@ -0,0 +1,245 @@
+//
+// FlatHashMapTest.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "FlatHashMapTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/FlatHashMap.h"
+#include "Poco/Exception.h"
+#include <map>
+
+
+using Poco::FlatHashMap;
+
+
+FlatHashMapTest::FlatHashMapTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+FlatHashMapTest::~FlatHashMapTest()
+{
+}
+
+
+void FlatHashMapTest::testInsert()
+{
+	const int N = 1000;
+
+	typedef FlatHashMap<int, int> IntMap;
+	IntMap hm;
+
+	assert (hm.empty());
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntMap::Iterator, bool> res = hm.insert(IntMap::ValueType(i, i*2));
+		assert (res.first->first == i);
+		assert (res.first->second == i*2);
+		assert (res.second);
+		IntMap::Iterator it = hm.find(i);
+		assert (it != hm.end());
+		assert (it->first == i);
+		assert (it->second == i*2);
+		assert (hm.count(i) == 1);
+		assert (hm.size() == i + 1);
+	}
+
+	assert (!hm.empty());
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assert (it != hm.end());
+		assert (it->first == i);
+		assert (it->second == i*2);
+	}
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntMap::Iterator, bool> res = hm.insert(IntMap::ValueType(i, 0));
+		assert (res.first->first == i);
+		assert (res.first->second == i*2);
+		assert (!res.second);
+	}
+}
+
+
+void FlatHashMapTest::testErase()
+{
+	const int N = 1000;
+
+	typedef FlatHashMap<int, int> IntMap;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(IntMap::ValueType(i, i*2));
+	}
+	assert (hm.size() == N);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		hm.erase(i);
+		IntMap::Iterator it = hm.find(i);
+		assert (it == hm.end());
+	}
+	assert (hm.size() == N/2);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assert (it == hm.end());
+	}
+
+	for (int i = 1; i < N; i += 2)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assert (it != hm.end());
+		assert (it->first == i);
+	}
+
+	for (int i = 0; i < N; i += 2)
+	{
+		hm.insert(IntMap::ValueType(i, i*2));
+	}
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assert (it != hm.end());
+		assert (it->first == i);
+		assert (it->second == i*2);
+	}
+}
+
+
+void FlatHashMapTest::testIterator()
+{
+	const int N = 1000;
+
+	typedef FlatHashMap<int, int> IntMap;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(IntMap::ValueType(i, i*2));
+	}
+
+	std::map<int, int> values;
+	IntMap::Iterator it; // do not initialize here to test proper behavior of uninitialized iterators
+	it = hm.begin();
+	while (it != hm.end())
+	{
+		assert (values.find(it->first) == values.end());
+		values[it->first] = it->second;
+		++it;
+	}
+
+	assert (values.size() == N);
+}
+
+
+void FlatHashMapTest::testConstIterator()
+{
+	const int N = 1000;
+
+	typedef FlatHashMap<int, int> IntMap;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(IntMap::ValueType(i, i*2));
+	}
+
+	std::map<int, int> values;
+	IntMap::ConstIterator it = hm.begin();
+	while (it != hm.end())
+	{
+		assert (values.find(it->first) == values.end());
+		values[it->first] = it->second;
+		++it;
+	}
+
+	assert (values.size() == N);
+}
+
+
+void FlatHashMapTest::testIndex()
+{
+	typedef FlatHashMap<int, int> IntMap;
+	IntMap hm;
+
+	hm[1] = 2;
+	hm[2] = 4;
+	hm[3] = 6;
+
+	assert (hm.size() == 3);
+	assert (hm[1] == 2);
+	assert (hm[2] == 4);
+	assert (hm[3] == 6);
+
+	try
+	{
+		const IntMap& im = hm;
+		int POCO_UNUSED x = im[4];
+		fail("no such key - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+}
+
+
+void FlatHashMapTest::testHeterogeneousLookup()
+{
+	typedef FlatHashMap<std::string, int> StringMap;
+	StringMap hm;
+
+	hm["one"] = 1;
+	hm["two"] = 2;
+
+	// probe with a C string; no temporary std::string is constructed
+	const char* probe = "one";
+	StringMap::Iterator it = hm.find(probe);
+	assert (it != hm.end());
+	assert (it->second == 1);
+	assert (hm.count("two") == 1);
+	assert (hm.count("three") == 0);
+
+	hm.erase("two");
+	assert (hm.size() == 1);
+	assert (hm.find("two") == hm.end());
+}
+
+
+void FlatHashMapTest::setUp()
+{
+}
+
+
+void FlatHashMapTest::tearDown()
+{
+}
+
+
+CppUnit::Test* FlatHashMapTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("FlatHashMapTest");
+
+	CppUnit_addTest(pSuite, FlatHashMapTest, testInsert);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testErase);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testIterator);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testConstIterator);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testIndex);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testHeterogeneousLookup);
+
+	return pSuite;
+}
@@ -17,6 +17,7 @@
 
 
 using Poco::format;
+using Poco::formatTo;
 using Poco::BadCastException;
 using Poco::Int64;
 using Poco::UInt64;
@@ -353,6 +354,24 @@ void FormatTest::testIndex()
 }
 
 
+void FormatTest::testFormatTo()
+{
+	std::string s;
+	formatTo(s, "%d", 42);
+	assert (s == "42");
+	assert (formatTo("%5d|%-5d|%05d", 42, 42, 42) == "   42|42   |00042");
+	assert (formatTo("%d %u %x %X %o", -1, 255u, 255, 255, 8) == "-1 255 ff FF 10");
+	assert (formatTo("%+d %+d", 42, -42) == "+42 -42");
+	assert (formatTo("%s|%.3s", std::string("foo"), "barbaz") == "foo|bar");
+	assert (formatTo("%c%b", 'x', true) == "x1");
+	assert (formatTo("%.2f", 1.5) == "1.50");
+	assert (formatTo("second: %[1]d, first: %[0]d", 1, 2) == "second: 2, first: 1");
+	assert (formatTo("100%%") == "100%");
+	assert (formatTo("%s", 42) == "[ERRFMT]");
+	assert (formatTo("%d %d", 1) == "1 %d");
+}
+
+
 void FormatTest::setUp()
 {
 }
@@ -376,6 +395,7 @@ CppUnit::Test* FormatTest::suite()
 	CppUnit_addTest(pSuite, FormatTest, testString);
 	CppUnit_addTest(pSuite, FormatTest, testMultiple);
 	CppUnit_addTest(pSuite, FormatTest, testIndex);
+	CppUnit_addTest(pSuite, FormatTest, testFormatTo);
 
 	return pSuite;
 }
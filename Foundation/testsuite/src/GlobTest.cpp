@@ -12,6 +12,8 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/Glob.h"
+#include "Poco/CompiledGlob.h"
+#include "Poco/Exception.h"
 #include "Poco/File.h"
 #include "Poco/Path.h"
 #include <fstream>
@@ -485,6 +487,111 @@ void GlobTest::testMatchEmptyPattern()
 }
 
 
+void GlobTest::testCompiledGlob()
+{
+	const char* patterns[] =
+	{
+		"a", "ab", "?", "\\?", "a?", "??", "?a?", "a\\?",
+		"*", "a*", "ab*", "*a", "*ab", "*.c", "*.[hc]",
+		"[abc]", "[!abc]", "[a-z]", "[!a-z]", "[a-zA-Z0-9_]",
+		"m*ss*pp?", "a*a*a*a*b", "[\\]]", "\\[a\\]"
+	};
+	const char* subjects[] =
+	{
+		"", "a", "b", ".", ".a", "ab", "abc", "abab", "aab", "ba",
+		"a.c", "foo.h", "foo.c", "f", "A", "AB", "xyz", "a-z",
+		"?", "*", "[", "]", "[a]", "mississippi", "aaaaab", "z"
+	};
+	int options[] =
+	{
+		Glob::GLOB_DEFAULT,
+		Glob::GLOB_CASELESS,
+		Glob::GLOB_DOT_SPECIAL,
+		Glob::GLOB_CASELESS | Glob::GLOB_DOT_SPECIAL
+	};
+
+	// CompiledGlob must agree with Glob on all pattern/subject/option combinations
+	for (int p = 0; p < sizeof(patterns)/sizeof(patterns[0]); p++)
+	{
+		for (int o = 0; o < sizeof(options)/sizeof(options[0]); o++)
+		{
+			Glob g(patterns[p], options[o]);
+			Poco::CompiledGlob cg(patterns[p], options[o]);
+			assert (cg.pattern() == patterns[p]);
+			assert (cg.options() == options[o]);
+			for (int s = 0; s < sizeof(subjects)/sizeof(subjects[0]); s++)
+			{
+				std::string subject(subjects[s]);
+				assert (cg.match(subject) == g.match(subject));
+				assert (cg.match(subject.data(), subject.size()) == g.match(subject));
+			}
+		}
+	}
+
+	// the constructor validates the complete pattern
+	try
+	{
+		Poco::CompiledGlob cg("[abc");
+		failmsg("unterminated set - must throw");
+	}
+	catch (Poco::SyntaxException&)
+	{
+	}
+	try
+	{
+		Poco::CompiledGlob cg("foo\\");
+		failmsg("trailing backslash - must throw");
+	}
+	catch (Poco::SyntaxException&)
+	{
+	}
+}
+
+
+void GlobTest::testGlobParallel()
+{
+	createFile("globtest/Makefile");
+	createFile("globtest/.hidden");
+	createFile("globtest/include/one.h");
+	createFile("globtest/include/two.h");
+	createFile("globtest/src/one.c");
+	createFile("globtest/src/two.c");
+	createFile("globtest/src/main.c");
+	createFile("globtest/testsuite/src/test.h");
+	createFile("globtest/testsuite/src/test.c");
+	createFile("globtest/testsuite/src/main.c");
+
+	const char* patterns[] =
+	{
+		"globtest/*",
+		"globtest/*/*.[hc]",
+		"gl?bt?st/*/*/*.c",
+		"globtest/*/src/*",
+		"globtest/*/"
+	};
+	for (int p = 0; p < sizeof(patterns)/sizeof(patterns[0]); p++)
+	{
+		std::set<std::string> sequential;
+		std::set<std::string> parallel;
+		Glob::glob(patterns[p], sequential);
+		Glob::glob(patterns[p], parallel, Glob::GLOB_PARALLEL);
+		assert (parallel == sequential);
+		assert (!parallel.empty());
+	}
+
+	std::set<std::string> files;
+	Glob::glob("GlobTest/*/*.C", files, Glob::GLOB_CASELESS | Glob::GLOB_PARALLEL);
+	translatePaths(files);
+	assert (files.size() == 3);
+	assert (files.find("globtest/src/one.c") != files.end());
+	assert (files.find("globtest/src/two.c") != files.end());
+	assert (files.find("globtest/src/main.c") != files.end());
+
+	File dir("globtest");
+	dir.remove(true);
+}
+
+
 void GlobTest::createFile(const std::string& path)
 {
 	Path p(path, Path::PATH_UNIX);
@@ -530,6 +637,8 @@ CppUnit::Test* GlobTest::suite()
 	CppUnit_addTest(pSuite, GlobTest, testCaseless);
 	CppUnit_addTest(pSuite, GlobTest, testGlob);
 	CppUnit_addTest(pSuite, GlobTest, testMatchEmptyPattern);
+	CppUnit_addTest(pSuite, GlobTest, testCompiledGlob);
+	CppUnit_addTest(pSuite, GlobTest, testGlobParallel);
 
 	return pSuite;
 }
@@ -33,6 +33,8 @@ public:
 	void testGlob();
 	void testCaseless();
 	void testMatchEmptyPattern();
+	void testCompiledGlob();
+	void testGlobParallel();
 
 	void setUp();
 	void tearDown();
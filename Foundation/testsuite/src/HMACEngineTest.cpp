@@ -57,6 +57,40 @@ void HMACEngineTest::testHMAC()
 }
 
 
+void HMACEngineTest::testHMACKey()
+{
+	// same test vectors as testHMAC(), using a precomputed key
+
+	std::string key(16, 0x0b);
+	std::string data("Hi There");
+	Poco::HMACKey<MD5Engine> hmacKey(key);
+
+	HMACEngine<MD5Engine> hmac1(hmacKey);
+	hmac1.update(data);
+	std::string digest = DigestEngine::digestToHex(hmac1.digest());
+	assert (digest == "9294727a3638bb1c13f48ef8158bfc9d");
+
+	// engine reuse with the same key
+	hmac1.update(data);
+	digest = DigestEngine::digestToHex(hmac1.digest());
+	assert (digest == "9294727a3638bb1c13f48ef8158bfc9d");
+
+	// reset with another precomputed key
+	std::string key2("Jefe");
+	std::string data2("what do ya want for nothing?");
+	hmac1.reset(Poco::HMACKey<MD5Engine>(key2));
+	hmac1.update(data2);
+	digest = DigestEngine::digestToHex(hmac1.digest());
+	assert (digest == "750c783e6ab0b503eaa86e310a5db738");
+
+	// one-shot computation
+	char mac[HMACEngine<MD5Engine>::DIGEST_SIZE];
+	HMACEngine<MD5Engine>::hmac(hmacKey, data.data(), data.size(), mac);
+	DigestEngine::Digest d(mac, mac + sizeof(mac));
+	assert (DigestEngine::digestToHex(d) == "9294727a3638bb1c13f48ef8158bfc9d");
+}
+
+
 void HMACEngineTest::setUp()
 {
 }
@@ -72,6 +106,7 @@ CppUnit::Test* HMACEngineTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HMACEngineTest");
 
 	CppUnit_addTest(pSuite, HMACEngineTest, testHMAC);
+	CppUnit_addTest(pSuite, HMACEngineTest, testHMACKey);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~HMACEngineTest();
 
 	void testHMAC();
+	void testHMACKey();
 
 	void setUp();
 	void tearDown();
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/HexBinaryEncoder.h"
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinaryCodec.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::HexBinaryEncoder;
 using Poco::HexBinaryDecoder;
+using Poco::HexBinaryCodec;
 using Poco::DataFormatException;
 
 
@@ -183,6 +185,47 @@ void HexBinaryTest::testEncodeDecode()
 }
 
 
+void HexBinaryTest::testCodec()
+{
+	assert (HexBinaryCodec::encode("\x00\x01\xAB\xCD\xEF", 5) == "0001abcdef");
+	assert (HexBinaryCodec::encode("\x00\x01\xAB\xCD\xEF", 5, true) == "0001ABCDEF");
+	assert (HexBinaryCodec::encode("", 0) == "");
+
+	assert (HexBinaryCodec::decode("0001abcdef") == std::string("\x00\x01\xAB\xCD\xEF", 5));
+	assert (HexBinaryCodec::decode("0001ABCDEF") == std::string("\x00\x01\xAB\xCD\xEF", 5));
+	assert (HexBinaryCodec::decode("00 01\tab\r\ncd ef") == std::string("\x00\x01\xAB\xCD\xEF", 5));
+	assert (HexBinaryCodec::decode("") == "");
+
+	try
+	{
+		std::string s = HexBinaryCodec::decode("abc");
+		failmsg("odd number of digits - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		std::string s = HexBinaryCodec::decode("abcx");
+		failmsg("invalid character - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+
+	// codec and stream must produce identical output
+	std::string src;
+	for (int i = 0; i < 255; ++i) src += char(i);
+	std::ostringstream str;
+	HexBinaryEncoder encoder(str);
+	encoder.rdbuf()->setLineLength(0);
+	encoder.write(src.data(), (std::streamsize) src.size());
+	encoder.close();
+	assert (HexBinaryCodec::encode(src.data(), src.size()) == str.str());
+	assert (HexBinaryCodec::decode(str.str()) == src);
+}
+
+
 void HexBinaryTest::setUp()
 {
 }
@@ -200,6 +243,7 @@ CppUnit::Test* HexBinaryTest::suite()
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testDecoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncodeDecode);
+	CppUnit_addTest(pSuite, HexBinaryTest, testCodec);
 
 	return pSuite;
 }
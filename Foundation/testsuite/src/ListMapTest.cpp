@@ -257,6 +257,52 @@ void ListMapTest::testStringIndex()
 }
 
 
+void ListMapTest::testIndexedLookup()
+{
+	// enough entries to activate the secondary hash index
+	const int N = 100;
+
+	typedef ListMap<std::string, int> StrToIntMap;
+	StrToIntMap lm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		lm.insert(StrToIntMap::ValueType("Key" + std::to_string(i), i));
+	}
+	assert (lm.size() == N);
+
+	for (int i = 0; i < N; ++i)
+	{
+		StrToIntMap::Iterator it = lm.find("Key" + std::to_string(i));
+		assert (it != lm.end());
+		assert (it->second == i);
+		// lookups are case-insensitive by default
+		it = lm.find("KEY" + std::to_string(i));
+		assert (it != lm.end());
+		assert (it->second == i);
+	}
+	assert (lm.find("NoSuchKey") == lm.end());
+
+	// duplicate keys remain grouped and find() returns the first one
+	lm.insert(StrToIntMap::ValueType("Key10", 1010));
+	StrToIntMap::Iterator it = lm.find("Key10");
+	assert (it != lm.end() && it->second == 10);
+	++it;
+	assert (it != lm.end() && it->second == 1010);
+	++it;
+	assert (it != lm.end() && it->first == "Key11");
+
+	// erasing the first entry of a duplicate block keeps the rest findable
+	lm.erase(lm.find("Key10"));
+	it = lm.find("Key10");
+	assert (it != lm.end() && it->second == 1010);
+
+	assert (lm.erase(std::string("Key10")) == 1);
+	assert (lm.find("Key10") == lm.end());
+	assert (lm.size() == N - 1);
+}
+
+
 void ListMapTest::setUp()
 {
 }
@@ -278,6 +324,7 @@ CppUnit::Test* ListMapTest::suite()
 	CppUnit_addTest(pSuite, ListMapTest, testConstIterator);
 	CppUnit_addTest(pSuite, ListMapTest, testIntIndex);
 	CppUnit_addTest(pSuite, ListMapTest, testStringIndex);
+	CppUnit_addTest(pSuite, ListMapTest, testIndexedLookup);
 
 	return pSuite;
 }
@@ -31,6 +31,7 @@ public:
 	void testConstIterator();
 	void testIntIndex();
 	void testStringIndex();
+	void testIndexedLookup();
 
 	void setUp();
 	void tearDown();
@@ -51,6 +51,16 @@ void LogStreamTest::testLogStream()
 	assert (pChannel->list().begin()->getPriority() == Message::PRIO_ERROR);
 	assert (pChannel->list().begin()->getText() == "error");
 	pChannel->list().clear();
+
+	ls.information() << "line1\nline2\r\nline3" << std::endl;
+	assert (pChannel->list().size() == 3);
+	TestChannel::MsgList::const_iterator it = pChannel->list().begin();
+	assert (it->getText() == "line1");
+	++it;
+	assert (it->getText() == "line2");
+	++it;
+	assert (it->getText() == "line3");
+	pChannel->list().clear();
 }
 
 
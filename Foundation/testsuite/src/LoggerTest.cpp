@@ -165,6 +165,24 @@ void LoggerTest::testLogger()
 }
 
 
+void LoggerTest::testFastGet()
+{
+	Logger& logger1 = Logger::fastGet("fastGetTest");
+	Logger& logger2 = Logger::get("fastGetTest");
+	assert (&logger1 == &logger2);
+	assert (&Logger::fastGet("fastGetTest") == &logger1);
+
+	Logger::setLevel("fastGetTest", Message::PRIO_ERROR);
+	assert (Logger::fastGet("fastGetTest").getLevel() == Message::PRIO_ERROR);
+
+	AutoPtr<Logger> pLogger1(&logger1, true); // keep alive across destroy()
+	Logger::destroy("fastGetTest");
+	Logger& logger3 = Logger::fastGet("fastGetTest");
+	assert (&logger3 != &logger1);
+	assert (&Logger::get("fastGetTest") == &logger3);
+}
+
+
 void LoggerTest::testFormat()
 {
 	std::string str = Logger::format("$0$1", "foo", "bar");
@@ -290,6 +308,7 @@ CppUnit::Test* LoggerTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("LoggerTest");
 
 	CppUnit_addTest(pSuite, LoggerTest, testLogger);
+	CppUnit_addTest(pSuite, LoggerTest, testFastGet);
 	CppUnit_addTest(pSuite, LoggerTest, testFormat);
 	CppUnit_addTest(pSuite, LoggerTest, testFormatAny);
 	CppUnit_addTest(pSuite, LoggerTest, testDump);
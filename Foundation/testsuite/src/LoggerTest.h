@@ -25,6 +25,7 @@ public:
 	~LoggerTest();
 
 	void testLogger();
+	void testFastGet();
 	void testFormat();
 	void testFormatAny();
 	void testDump();
@@ -12,10 +12,40 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/MemoryPool.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
 #include <vector>
 
 
 using Poco::MemoryPool;
+using Poco::Thread;
+using Poco::Runnable;
+
+
+namespace
+{
+	class MagazineRunnable: public Runnable
+	{
+	public:
+		MagazineRunnable(MemoryPool& pool): _pool(pool)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < 10000; ++i)
+			{
+				void* ptr1 = _pool.get();
+				void* ptr2 = _pool.get();
+				_pool.release(ptr1);
+				_pool.release(ptr2);
+			}
+		}
+
+	private:
+		MemoryPool& _pool;
+	};
+}
 
 
 MemoryPoolTest::MemoryPoolTest(const std::string& name): CppUnit::TestCase(name)
@@ -68,6 +98,34 @@ void MemoryPoolTest::testMemoryPool()
 }
 
 
+void MemoryPoolTest::testMemoryPoolMagazine()
+{
+	MemoryPool pool(64);
+
+	// without a block limit, released blocks are cached in
+	// the calling thread's magazine and reused directly
+	void* ptr = pool.get();
+	pool.release(ptr);
+	assert (pool.get() == ptr);
+	pool.release(ptr);
+
+	MagazineRunnable r1(pool);
+	MagazineRunnable r2(pool);
+	Thread t1;
+	Thread t2;
+	t1.start(r1);
+	t2.start(r2);
+	t1.join();
+	t2.join();
+
+	// each thread's working set is at most two blocks, and
+	// exiting threads return their magazines to the pool;
+	// only ptr remains cached in this thread's magazine
+	assert (pool.allocated() <= 8);
+	assert (pool.available() == pool.allocated() - 1);
+}
+
+
 void MemoryPoolTest::setUp()
 {
 }
@@ -83,6 +141,7 @@ CppUnit::Test* MemoryPoolTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("MemoryPoolTest");
 
 	CppUnit_addTest(pSuite, MemoryPoolTest, testMemoryPool);
+	CppUnit_addTest(pSuite, MemoryPoolTest, testMemoryPoolMagazine);
 
 	return pSuite;
 }
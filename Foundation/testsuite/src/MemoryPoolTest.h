@@ -25,6 +25,7 @@ public:
 	~MemoryPoolTest();
 
 	void testMemoryPool();
+	void testMemoryPoolMagazine();
 
 	void setUp();
 	void tearDown();
@@ -13,6 +13,9 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Buffer.h"
 #include "Poco/MemoryStream.h"
+#include "Poco/MemoryMappedFile.h"
+#include "Poco/FileStream.h"
+#include "Poco/TemporaryFile.h"
 #include <sstream>
 
 
@@ -466,6 +469,31 @@ void MemoryStreamTest::testOutputSeekVsStringStream()
 }
 
 
+void MemoryStreamTest::testMemoryMappedFile()
+{
+	Poco::TemporaryFile file;
+	std::string data;
+	for (int i = 0; i < 10000; ++i) data += char('a' + i % 26);
+	{
+		Poco::FileOutputStream ostr(file.path());
+		ostr.write(data.data(), (std::streamsize) data.size());
+	}
+
+	Poco::MemoryMappedFile mmf(file.path());
+	assert (mmf.size() == data.size());
+	assert (mmf.end() - mmf.begin() == (std::ptrdiff_t) data.size());
+	assert (std::string(mmf.begin(), mmf.size()) == data);
+	mmf.advise(Poco::MemoryMappedFile::ADV_SEQUENTIAL);
+	mmf.advise(Poco::MemoryMappedFile::ADV_NORMAL);
+
+	Poco::MemoryMappedInputStream istr(file.path());
+	std::string line;
+	std::getline(istr, line);
+	assert (line == data);
+	assert (istr.eof());
+}
+
+
 void MemoryStreamTest::setUp()
 {
 }
@@ -487,6 +515,7 @@ CppUnit::Test* MemoryStreamTest::suite()
 	CppUnit_addTest(pSuite, MemoryStreamTest, testInputSeekVsStringStream);
 	CppUnit_addTest(pSuite, MemoryStreamTest, testOutputSeek);
 	CppUnit_addTest(pSuite, MemoryStreamTest, testOutputSeekVsStringStream);
+	CppUnit_addTest(pSuite, MemoryStreamTest, testMemoryMappedFile);
 
 	return pSuite;
 }
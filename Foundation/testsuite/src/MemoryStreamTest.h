@@ -31,6 +31,7 @@ public:
 	void testInputSeekVsStringStream();
 	void testOutputSeek();
 	void testOutputSeekVsStringStream();
+	void testMemoryMappedFile();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,180 @@
+//
+// MetricsTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "MetricsTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Metrics.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+
+
+using Poco::Metrics::Counter;
+using Poco::Metrics::Gauge;
+using Poco::Metrics::Histogram;
+using Poco::Metrics::MetricsRegistry;
+using Poco::Thread;
+using Poco::Runnable;
+
+
+namespace
+{
+	class CounterRunnable: public Runnable
+	{
+	public:
+		CounterRunnable(Counter& counter, int count):
+			_counter(counter),
+			_count(count)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _count; i++)
+			{
+				_counter.increment();
+			}
+		}
+
+	private:
+		Counter& _counter;
+		int _count;
+	};
+}
+
+
+MetricsTest::MetricsTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+MetricsTest::~MetricsTest()
+{
+}
+
+
+void MetricsTest::testCounter()
+{
+	Counter counter;
+	assert (counter.value() == 0);
+	counter.increment();
+	assert (counter.value() == 1);
+	counter.increment(41);
+	assert (counter.value() == 42);
+
+	Counter shared;
+	CounterRunnable cr1(shared, 10000);
+	CounterRunnable cr2(shared, 10000);
+	Thread t1;
+	Thread t2;
+	t1.start(cr1);
+	t2.start(cr2);
+	t1.join();
+	t2.join();
+	assert (shared.value() == 20000);
+}
+
+
+void MetricsTest::testGauge()
+{
+	Gauge gauge;
+	assert (gauge.value() == 0);
+	gauge.set(100);
+	assert (gauge.value() == 100);
+	gauge.add(10);
+	assert (gauge.value() == 110);
+	gauge.subtract(20);
+	assert (gauge.value() == 90);
+	gauge.set(-5);
+	assert (gauge.value() == -5);
+}
+
+
+void MetricsTest::testHistogram()
+{
+	Histogram histogram;
+	assert (histogram.count() == 0);
+	assert (histogram.sum() == 0);
+	assert (histogram.minimum() == 0);
+	assert (histogram.maximum() == 0);
+	assert (histogram.quantile(0.5) == 0);
+
+	for (int i = 1; i <= 1000; i++)
+	{
+		histogram.update(i);
+	}
+	assert (histogram.count() == 1000);
+	assert (histogram.sum() == 500500);
+	assert (histogram.minimum() == 1);
+	assert (histogram.maximum() == 1000);
+
+	// quantile estimates are bucket upper bounds;
+	// with power-of-two buckets the estimate is at most
+	// one binary order of magnitude above the true value
+	Poco::Int64 p50 = histogram.quantile(0.5);
+	assert (p50 >= 500 && p50 <= 1023);
+	Poco::Int64 p99 = histogram.quantile(0.99);
+	assert (p99 >= 990 && p99 <= 1023);
+	assert (histogram.quantile(1.0) <= 1000);
+
+	histogram.update(-10);
+	assert (histogram.minimum() == 0);
+}
+
+
+void MetricsTest::testRegistry()
+{
+	MetricsRegistry registry;
+	Counter& counter = registry.counter("test.counter");
+	counter.increment(42);
+	assert (&registry.counter("test.counter") == &counter);
+
+	Gauge& gauge = registry.gauge("test.gauge");
+	gauge.set(7);
+	assert (&registry.gauge("test.gauge") == &gauge);
+
+	Histogram& histogram = registry.histogram("test.histogram");
+	histogram.update(100);
+	assert (&registry.histogram("test.histogram") == &histogram);
+
+	std::string json = registry.toJSON();
+	assert (json.find("\"test.counter\":42") != std::string::npos);
+	assert (json.find("\"test.gauge\":7") != std::string::npos);
+	assert (json.find("\"test.histogram\":{\"count\":1") != std::string::npos);
+
+	assert (!MetricsRegistry::enabled());
+	MetricsRegistry::setEnabled(true);
+	assert (MetricsRegistry::enabled());
+	MetricsRegistry::setEnabled(false);
+	assert (!MetricsRegistry::enabled());
+}
+
+
+void MetricsTest::setUp()
+{
+}
+
+
+void MetricsTest::tearDown()
+{
+}
+
+
+CppUnit::Test* MetricsTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("MetricsTest");
+
+	CppUnit_addTest(pSuite, MetricsTest, testCounter);
+	CppUnit_addTest(pSuite, MetricsTest, testGauge);
+	CppUnit_addTest(pSuite, MetricsTest, testHistogram);
+	CppUnit_addTest(pSuite, MetricsTest, testRegistry);
+
+	return pSuite;
+}
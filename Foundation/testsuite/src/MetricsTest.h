@@ -0,0 +1,39 @@
+//
+// MetricsTest.h
+//
+// Definition of the MetricsTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef MetricsTest_INCLUDED
+#define MetricsTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class MetricsTest: public CppUnit::TestCase
+{
+public:
+	MetricsTest(const std::string& name);
+	~MetricsTest();
+
+	void testCounter();
+	void testGauge();
+	void testHistogram();
+	void testRegistry();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // MetricsTest_INCLUDED
@@ -151,6 +151,34 @@ void NotificationQueueTest::testWaitDequeue()
 }
 
 
+void NotificationQueueTest::testDequeueBatch()
+{
+	NotificationQueue queue;
+	std::vector<Notification::Ptr> batch;
+	assert (queue.dequeueBatch(batch, 10) == 0);
+	assert (batch.empty());
+
+	queue.enqueueNotification(new QTestNotification("first"));
+	queue.enqueueNotification(new QTestNotification("second"));
+	queue.enqueueNotification(new QTestNotification("third"));
+	assert (queue.dequeueBatch(batch, 2) == 2);
+	assert (batch.size() == 2);
+	assert (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "first");
+	assert (dynamic_cast<QTestNotification*>(batch[1].get())->data() == "second");
+	assert (queue.size() == 1);
+
+	batch.clear();
+	assert (queue.waitDequeueBatch(batch, 10) == 1);
+	assert (batch.size() == 1);
+	assert (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "third");
+	assert (queue.empty());
+
+	batch.clear();
+	assert (queue.waitDequeueBatch(batch, 10, 20) == 0);
+	assert (batch.empty());
+}
+
+
 void NotificationQueueTest::testThreads()
 {
 	const int NOTIFICATION_COUNT = 5000;
@@ -223,6 +251,7 @@ CppUnit::Test* NotificationQueueTest::suite()
 	CppUnit_addTest(pSuite, NotificationQueueTest, testQueueDequeue);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testQueueDequeueUrgent);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testWaitDequeue);
+	CppUnit_addTest(pSuite, NotificationQueueTest, testDequeueBatch);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testThreads);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testDefaultQueue);
 
@@ -30,6 +30,7 @@ public:
 	void testQueueDequeue();
 	void testQueueDequeueUrgent();
 	void testWaitDequeue();
+	void testDequeueBatch();
 	void testThreads();
 	void testDefaultQueue();
 
@@ -11,8 +11,10 @@
 #include "NotificationsTestSuite.h"
 #include "NotificationCenterTest.h"
 #include "NotificationQueueTest.h"
+#include "FastNotificationQueueTest.h"
 #include "PriorityNotificationQueueTest.h"
 #include "TimedNotificationQueueTest.h"
+#include "TimingWheelNotificationQueueTest.h"
 
 
 CppUnit::Test* NotificationsTestSuite::suite()
@@ -21,8 +23,10 @@ CppUnit::Test* NotificationsTestSuite::suite()
 
 	pSuite->addTest(NotificationCenterTest::suite());
 	pSuite->addTest(NotificationQueueTest::suite());
+	pSuite->addTest(FastNotificationQueueTest::suite());
 	pSuite->addTest(PriorityNotificationQueueTest::suite());
 	pSuite->addTest(TimedNotificationQueueTest::suite());
+	pSuite->addTest(TimingWheelNotificationQueueTest::suite());
 
 	return pSuite;
 }
@@ -315,6 +315,44 @@ void NumberFormatterTest::testAppend()
 }
 
 
+void NumberFormatterTest::testFormatTo()
+{
+	char buffer[64];
+	std::size_t n = NumberFormatter::formatTo(buffer, sizeof(buffer), 123);
+	assert (n == 3);
+	assert (std::string(buffer) == "123");
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), -123);
+	assert (n == 4);
+	assert (std::string(buffer) == "-123");
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), 123u);
+	assert (n == 3);
+	assert (std::string(buffer) == "123");
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), 0);
+	assert (n == 1);
+	assert (std::string(buffer) == "0");
+#if defined(POCO_HAVE_INT64)
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), Poco::Int64(-9223372036854775807LL));
+	assert (std::string(buffer) == "-9223372036854775807");
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), Poco::UInt64(18446744073709551615ULL));
+	assert (std::string(buffer) == "18446744073709551615");
+#endif
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), 12.25);
+	assert (std::string(buffer, n) == "12.25");
+	n = NumberFormatter::formatTo(buffer, sizeof(buffer), 0.5f);
+	assert (std::string(buffer, n) == "0.5");
+
+	try
+	{
+		char small[3];
+		NumberFormatter::formatTo(small, sizeof(small), 123456);
+		fail ("buffer too small - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+}
+
+
 void NumberFormatterTest::setUp()
 {
 }
@@ -335,6 +373,7 @@ CppUnit::Test* NumberFormatterTest::suite()
 	CppUnit_addTest(pSuite, NumberFormatterTest, testFormatHex);
 	CppUnit_addTest(pSuite, NumberFormatterTest, testFormatFloat);
 	CppUnit_addTest(pSuite, NumberFormatterTest, testAppend);
+	CppUnit_addTest(pSuite, NumberFormatterTest, testFormatTo);
 
 	return pSuite;
 }
@@ -30,6 +30,7 @@ public:
 	void testFormatHex();
 	void testFormatFloat();
 	void testAppend();
+	void testFormatTo();
 
 	void setUp();
 	void tearDown();
@@ -171,6 +171,46 @@ void NumberParserTest::testParse()
 }
 
 
+void NumberParserTest::testParseBuffer()
+{
+	int i;
+	unsigned u;
+	assert (NumberParser::tryParse("123", 3, i) && i == 123);
+	assert (NumberParser::tryParse("-123", 4, i) && i == -123);
+	assert (NumberParser::tryParse("+123", 4, i) && i == 123);
+	assert (NumberParser::tryParse("-2147483648", 11, i) && i == -2147483648LL);
+	assert (NumberParser::tryParseUnsigned("4294967295", 10, u) && u == 4294967295U);
+	assert (!NumberParser::tryParse("", 0, i));
+	assert (!NumberParser::tryParse("-", 1, i));
+	assert (!NumberParser::tryParse(" 123", 4, i));
+	assert (!NumberParser::tryParse("123 ", 4, i));
+	assert (!NumberParser::tryParse("1,234", 5, i));
+	assert (!NumberParser::tryParse("2147483648", 10, i));
+	assert (!NumberParser::tryParseUnsigned("-1", 2, u));
+
+	// only the given range is considered
+	assert (NumberParser::tryParse("123456", 3, i) && i == 123);
+
+#if defined(POCO_HAVE_INT64)
+	Int64 i64;
+	UInt64 u64;
+	assert (NumberParser::tryParse64("-9223372036854775808", 20, i64) && i64 == -9223372036854775807LL - 1);
+	assert (NumberParser::tryParse64("9223372036854775807", 19, i64) && i64 == 9223372036854775807LL);
+	assert (!NumberParser::tryParse64("9223372036854775808", 19, i64));
+	assert (NumberParser::tryParseUnsigned64("18446744073709551615", 20, u64) && u64 == 18446744073709551615ULL);
+	assert (!NumberParser::tryParseUnsigned64("18446744073709551616", 20, u64));
+
+	Int64 values[8];
+	std::string line("1,-2,3,42");
+	assert (NumberParser::tryParseArray(line.data(), line.size(), values, 8) == 4);
+	assert (values[0] == 1 && values[1] == -2 && values[2] == 3 && values[3] == 42);
+	line = "10;20;bad;40";
+	assert (NumberParser::tryParseArray(line.data(), line.size(), values, 8, ';') == 2);
+	assert (values[0] == 10 && values[1] == 20);
+#endif
+}
+
+
 void NumberParserTest::testLimits()
 {
 	assert(testUpperLimit<Int8>());
@@ -318,6 +358,7 @@ CppUnit::Test* NumberParserTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("NumberParserTest");
 
 	CppUnit_addTest(pSuite, NumberParserTest, testParse);
+	CppUnit_addTest(pSuite, NumberParserTest, testParseBuffer);
 	CppUnit_addTest(pSuite, NumberParserTest, testLimits);
 	CppUnit_addTest(pSuite, NumberParserTest, testParseError);
 
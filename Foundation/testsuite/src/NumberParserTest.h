@@ -29,6 +29,7 @@ public:
 	~NumberParserTest();
 
 	void testParse();
+	void testParseBuffer();
 	void testLimits();
 	void testParseError();
 
@@ -25,6 +25,7 @@ public:
 	~ObjectPoolTest();
 
 	void testObjectPool();
+	void testObjectPoolPrewarm();
 
 	void setUp();
 	void tearDown();
@@ -16,6 +16,7 @@
 #include "Poco/Random.h"
 #include "Poco/Environment.h"
 #include <iostream>
+#include <utility>
 
 #if defined(POCO_OS_FAMILY_WINDOWS) && defined(POCO_WIN32_UTF8)
 #if defined(_WIN32_WCE)
@@ -1576,6 +1577,21 @@ void PathTest::testSwap()
 }
 
 
+void PathTest::testMove()
+{
+#ifdef POCO_PATH_HAVE_RVALUE_REFS
+	Path p1("c:\\temp\\foo.bar");
+	Path p2(std::move(p1));
+	assert (p2.toString() == "c:\\temp\\foo.bar");
+	assert (p1.toString() == "");
+
+	p1 = std::move(p2);
+	assert (p1.toString() == "c:\\temp\\foo.bar");
+	assert (p2.toString() == "");
+#endif
+}
+
+
 void PathTest::testResolve()
 {
 	Path p("c:\\foo\\", Path::PATH_WINDOWS);
@@ -1659,6 +1675,7 @@ CppUnit::Test* PathTest::suite()
 	CppUnit_addTest(pSuite, PathTest, testListRoots);
 	CppUnit_addTest(pSuite, PathTest, testFind);
 	CppUnit_addTest(pSuite, PathTest, testSwap);
+	CppUnit_addTest(pSuite, PathTest, testMove);
 	CppUnit_addTest(pSuite, PathTest, testResolve);
 	CppUnit_addTest(pSuite, PathTest, testPushPop);
 	CppUnit_addTest(pSuite, PathTest, testWindowsSystem);
@@ -49,6 +49,7 @@ public:
 	void testListRoots();
 	void testFind();
 	void testSwap();
+	void testMove();
 	void testResolve();
 	void testPushPop();
 	void testWindowsSystem();
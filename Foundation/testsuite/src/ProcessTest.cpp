@@ -62,6 +62,39 @@ void ProcessTest::testLaunch()
 }
 
 
+void ProcessTest::testLaunchBatch()
+{
+	std::string name("TestApp");
+	std::string cmd;
+#if defined(_DEBUG) && (POCO_OS != POCO_OS_ANDROID)
+	name += "d";
+#endif
+
+#if defined(POCO_OS_FAMILY_UNIX)
+	cmd = "./";
+	cmd += name;
+#elif defined(_WIN32_WCE)
+	cmd = "\\";
+	cmd += name;
+	cmd += ".EXE";
+#else
+	cmd = name;
+#endif
+
+	std::vector<std::string> args;
+	args.push_back("arg1");
+	args.push_back("arg2");
+	args.push_back("arg3");
+	std::vector<ProcessHandle> handles = Process::launchBatch(cmd, args, 4);
+	assert (handles.size() == 4);
+	for (std::vector<ProcessHandle>::iterator it = handles.begin(); it != handles.end(); ++it)
+	{
+		int rc = it->wait();
+		assert (rc == 3);
+	}
+}
+
+
 void ProcessTest::testLaunchRedirectIn()
 {
 #if !defined(_WIN32_WCE)
@@ -260,6 +293,7 @@ CppUnit::Test* ProcessTest::suite()
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchRedirectOut);
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchEnv);
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchArgs);
+	CppUnit_addTest(pSuite, ProcessTest, testLaunchBatch);
 	CppUnit_addTest(pSuite, ProcessTest, testIsRunning);
 
 	return pSuite;
@@ -29,6 +29,7 @@ public:
 	void testLaunchRedirectOut();
 	void testLaunchEnv();
 	void testLaunchArgs();
+	void testLaunchBatch();
 	void testIsRunning();
 
 	void setUp();
@@ -0,0 +1,123 @@
+//
+// ReadAheadStreamTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ReadAheadStreamTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ReadAheadStream.h"
+#include "Poco/DeflatingStream.h"
+#include "Poco/InflatingStream.h"
+#include "Poco/StreamCopier.h"
+#include <sstream>
+
+
+using Poco::ReadAheadInputStream;
+using Poco::DeflatingOutputStream;
+using Poco::DeflatingStreamBuf;
+using Poco::InflatingInputStream;
+using Poco::InflatingStreamBuf;
+using Poco::StreamCopier;
+
+
+ReadAheadStreamTest::ReadAheadStreamTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ReadAheadStreamTest::~ReadAheadStreamTest()
+{
+}
+
+
+void ReadAheadStreamTest::testReadAhead()
+{
+	// sizes around the chunk boundary
+	std::size_t sizes[] = {0, 1, 4095, 4096, 4097, 300000};
+	for (int i = 0; i < 6; ++i)
+	{
+		std::string data(sizes[i], 'x');
+		for (std::size_t j = 0; j < data.size(); ++j)
+			data[j] = static_cast<char>('A' + j % 57);
+
+		std::istringstream src(data);
+		ReadAheadInputStream istr(src, 4096, 2);
+		std::ostringstream dst;
+		StreamCopier::copyStream(istr, dst);
+		assert (dst.str() == data);
+		assert (istr.eof());
+	}
+
+	std::istringstream src("line one\nline two");
+	ReadAheadInputStream istr(src);
+	std::string line;
+	std::getline(istr, line);
+	assert (line == "line one");
+	std::getline(istr, line);
+	assert (line == "line two");
+	assert (istr.eof());
+}
+
+
+void ReadAheadStreamTest::testInflatingSource()
+{
+	std::string data;
+	data.reserve(2000000);
+	while (data.size() < 2000000)
+	{
+		data += "the quick brown fox jumps over the lazy dog ";
+		data += static_cast<char>('0' + data.size() % 10);
+	}
+
+	std::stringstream compressed;
+	DeflatingOutputStream deflater(compressed, DeflatingStreamBuf::STREAM_GZIP);
+	deflater << data;
+	deflater.close();
+
+	InflatingInputStream inflater(compressed, InflatingStreamBuf::STREAM_GZIP);
+	ReadAheadInputStream istr(inflater);
+	std::ostringstream inflated;
+	StreamCopier::copyStream(istr, inflated);
+	assert (inflated.str() == data);
+}
+
+
+void ReadAheadStreamTest::testEarlyDestruction()
+{
+	// the read-ahead thread must be stopped and joined even if
+	// the consumer abandons the stream with the queue full
+	std::string data(1000000, 'q');
+	std::istringstream src(data);
+	ReadAheadInputStream istr(src, 1024, 2);
+	char buffer[100];
+	istr.read(buffer, sizeof(buffer));
+	assert (istr.gcount() == sizeof(buffer));
+}
+
+
+void ReadAheadStreamTest::setUp()
+{
+}
+
+
+void ReadAheadStreamTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ReadAheadStreamTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ReadAheadStreamTest");
+
+	CppUnit_addTest(pSuite, ReadAheadStreamTest, testReadAhead);
+	CppUnit_addTest(pSuite, ReadAheadStreamTest, testInflatingSource);
+	CppUnit_addTest(pSuite, ReadAheadStreamTest, testEarlyDestruction);
+
+	return pSuite;
+}
@@ -0,0 +1,40 @@
+//
+// ReadAheadStreamTest.h
+//
+// Definition of the ReadAheadStreamTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ReadAheadStreamTest_INCLUDED
+#define ReadAheadStreamTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ReadAheadStreamTest: public CppUnit::TestCase
+{
+public:
+	ReadAheadStreamTest(const std::string& name);
+	~ReadAheadStreamTest();
+
+	void testReadAhead();
+	void testInflatingSource();
+	void testEarlyDestruction();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // ReadAheadStreamTest_INCLUDED
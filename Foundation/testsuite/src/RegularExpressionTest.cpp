@@ -263,6 +263,24 @@ void RegularExpressionTest::testError()
 }
 
 
+void RegularExpressionTest::testStudyJIT()
+{
+	RegularExpression re("([a-z]+) ([0-9]+)", RegularExpression::RE_STUDY_JIT);
+	RegularExpression::MatchVec matches;
+	assert (re.match("abc 123", 0, matches) == 3);
+	assert (matches[1].offset == 0 && matches[1].length == 3);
+	assert (matches[2].offset == 4 && matches[2].length == 3);
+	assert (!re.match("123 abc"));
+
+	// repeated construction reuses the cached compiled pattern
+	for (int i = 0; i < 100; ++i)
+	{
+		RegularExpression re2("([a-z]+) ([0-9]+)", RegularExpression::RE_STUDY_JIT);
+		assert (re2.match("abc 123"));
+	}
+}
+
+
 void RegularExpressionTest::setUp()
 {
 }
@@ -292,6 +310,7 @@ CppUnit::Test* RegularExpressionTest::suite()
 	CppUnit_addTest(pSuite, RegularExpressionTest, testSubst3);
 	CppUnit_addTest(pSuite, RegularExpressionTest, testSubst4);
 	CppUnit_addTest(pSuite, RegularExpressionTest, testError);
+	CppUnit_addTest(pSuite, RegularExpressionTest, testStudyJIT);
 
 	return pSuite;
 }
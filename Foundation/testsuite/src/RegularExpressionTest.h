@@ -39,6 +39,7 @@ public:
 	void testSubst3();
 	void testSubst4();
 	void testError();
+	void testStudyJIT();
 
 	void setUp();
 	void tearDown();
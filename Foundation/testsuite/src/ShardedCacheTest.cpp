@@ -0,0 +1,182 @@
+//
+// ShardedCacheTest.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ShardedCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ShardedCache.h"
+#include "Poco/LRUCache.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+
+
+using Poco::ShardedCache;
+using Poco::LRUCache;
+using Poco::SharedPtr;
+using Poco::Thread;
+using Poco::Runnable;
+
+
+namespace
+{
+	typedef ShardedCache<int, std::string, LRUCache<int, std::string> > IntCache;
+
+	class CacheRunnable: public Runnable
+	{
+	public:
+		CacheRunnable(IntCache& cache, int base):
+			_cache(cache),
+			_base(base),
+			_ok(true)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < 10000; ++i)
+			{
+				int key = _base + (i % 100);
+				_cache.add(key, "value");
+				SharedPtr<std::string> ptr = _cache.get(key);
+				if (ptr && *ptr != "value")
+				{
+					_ok = false;
+					return;
+				}
+			}
+		}
+
+		bool ok() const
+		{
+			return _ok;
+		}
+
+	private:
+		IntCache& _cache;
+		int       _base;
+		bool      _ok;
+	};
+}
+
+
+ShardedCacheTest::ShardedCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ShardedCacheTest::~ShardedCacheTest()
+{
+}
+
+
+void ShardedCacheTest::testBasics()
+{
+	IntCache cache(4, 1024);
+	assert (cache.shardCount() == 4);
+	assert (cache.size() == 0);
+
+	cache.add(1, "one");
+	assert (cache.has(1));
+	assert (!cache.has(2));
+	SharedPtr<std::string> ptr = cache.get(1);
+	assert (!ptr.isNull());
+	assert (*ptr == "one");
+	assert (cache.get(2).isNull());
+
+	cache.update(1, "uno");
+	assert (*cache.get(1) == "uno");
+
+	for (int i = 0; i < 100; ++i)
+	{
+		cache.add(i, "x");
+	}
+	assert (cache.size() == 100);
+	assert (cache.getAllKeys().size() == 100);
+
+	cache.remove(1);
+	assert (!cache.has(1));
+	assert (cache.size() == 99);
+
+	cache.clear();
+	assert (cache.size() == 0);
+}
+
+
+void ShardedCacheTest::testCapacityPerShard()
+{
+	// the LRU capacity applies per shard
+	IntCache cache(2, 4);
+	for (int i = 0; i < 100; ++i)
+	{
+		cache.add(i, "x");
+	}
+	assert (cache.size() <= 2*4);
+	assert (cache.size() > 0);
+}
+
+
+void ShardedCacheTest::testAccessEventSuppression()
+{
+	IntCache cache(4, 1024);
+	cache.add(1, "one");
+
+	cache.setAccessEventsEnabled(false);
+	// lookups still work while the Get event is suppressed
+	assert (*cache.get(1) == "one");
+	assert (cache.get(2).isNull());
+	cache.setAccessEventsEnabled(true);
+	assert (*cache.get(1) == "one");
+}
+
+
+void ShardedCacheTest::testConcurrentAccess()
+{
+	IntCache cache(8, 256);
+
+	CacheRunnable r1(cache, 0);
+	CacheRunnable r2(cache, 1000);
+	CacheRunnable r3(cache, 2000);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	t1.start(r1);
+	t2.start(r2);
+	t3.start(r3);
+	t1.join();
+	t2.join();
+	t3.join();
+
+	assert (r1.ok());
+	assert (r2.ok());
+	assert (r3.ok());
+}
+
+
+void ShardedCacheTest::setUp()
+{
+}
+
+
+void ShardedCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ShardedCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ShardedCacheTest");
+
+	CppUnit_addTest(pSuite, ShardedCacheTest, testBasics);
+	CppUnit_addTest(pSuite, ShardedCacheTest, testCapacityPerShard);
+	CppUnit_addTest(pSuite, ShardedCacheTest, testAccessEventSuppression);
+	CppUnit_addTest(pSuite, ShardedCacheTest, testConcurrentAccess);
+
+	return pSuite;
+}
@@ -0,0 +1,41 @@
+//
+// ShardedCacheTest.h
+//
+// Definition of the ShardedCacheTest class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ShardedCacheTest_INCLUDED
+#define ShardedCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ShardedCacheTest: public CppUnit::TestCase
+{
+public:
+	ShardedCacheTest(const std::string& name);
+	~ShardedCacheTest();
+
+	void testBasics();
+	void testCapacityPerShard();
+	void testAccessEventSuppression();
+	void testConcurrentAccess();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // ShardedCacheTest_INCLUDED
@@ -0,0 +1,194 @@
+//
+// SharedMemoryQueueTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "SharedMemoryQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/SharedMemoryQueue.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <cstring>
+
+
+using Poco::SharedMemoryQueue;
+using Poco::Thread;
+using Poco::Runnable;
+
+
+namespace
+{
+	class QueueConsumer: public Runnable
+	{
+	public:
+		QueueConsumer(SharedMemoryQueue& queue, int count):
+			_queue(queue),
+			_count(count),
+			_sum(0)
+		{
+		}
+
+		void run()
+		{
+			char buffer[64];
+			for (int i = 0; i < _count; i++)
+			{
+				std::size_t size = _queue.read(buffer, sizeof(buffer));
+				poco_assert (size == sizeof(int));
+				int value;
+				std::memcpy(&value, buffer, sizeof(int));
+				_sum += value;
+			}
+		}
+
+		long sum() const
+		{
+			return _sum;
+		}
+
+	private:
+		SharedMemoryQueue& _queue;
+		int _count;
+		long _sum;
+	};
+}
+
+
+SharedMemoryQueueTest::SharedMemoryQueueTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+SharedMemoryQueueTest::~SharedMemoryQueueTest()
+{
+}
+
+
+void SharedMemoryQueueTest::testWriteRead()
+{
+	SharedMemoryQueue queue("testWriteRead", 4096);
+	assert (queue.capacity() == 4096);
+
+	queue.write("hello", 5);
+	queue.write("shared memory queue", 19);
+	char buffer[64];
+	std::size_t size = queue.read(buffer, sizeof(buffer));
+	assert (size == 5);
+	assert (std::memcmp(buffer, "hello", 5) == 0);
+	size = queue.read(buffer, sizeof(buffer));
+	assert (size == 19);
+	assert (std::memcmp(buffer, "shared memory queue", 19) == 0);
+
+	// too-small read buffer must not consume the message
+	queue.write("something big", 13);
+	try
+	{
+		queue.read(buffer, 4);
+		fail ("buffer too small - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+	size = queue.read(buffer, sizeof(buffer));
+	assert (size == 13);
+}
+
+
+void SharedMemoryQueueTest::testZeroCopy()
+{
+	SharedMemoryQueue queue("testZeroCopy", 4096);
+
+	std::size_t size;
+	assert (queue.tryBeginRead(size) == 0);
+
+	void* ptr = queue.tryBeginWrite(8);
+	assert (ptr != 0);
+	std::memcpy(ptr, "abcdefgh", 8);
+	queue.commitWrite();
+
+	const void* readPtr = queue.tryBeginRead(size);
+	assert (readPtr != 0);
+	assert (size == 8);
+	assert (std::memcmp(readPtr, "abcdefgh", 8) == 0);
+	queue.endRead();
+	assert (queue.tryBeginRead(size) == 0);
+
+	try
+	{
+		queue.tryBeginWrite(queue.maxMessageSize() + 1);
+		fail ("message too large - must throw");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void SharedMemoryQueueTest::testWrapAround()
+{
+	SharedMemoryQueue queue("testWrapAround", 4096);
+
+	// message sizes that do not divide the capacity force the
+	// ring buffer to wrap at varying offsets
+	char message[100];
+	char buffer[128];
+	for (int i = 0; i < 500; i++)
+	{
+		std::memset(message, 'A' + i % 26, sizeof(message));
+		std::size_t length = 1 + i % sizeof(message);
+		queue.write(message, length);
+		std::size_t size = queue.read(buffer, sizeof(buffer));
+		assert (size == length);
+		assert (std::memcmp(buffer, message, length) == 0);
+	}
+}
+
+
+void SharedMemoryQueueTest::testProducerConsumer()
+{
+	const int count = 10000;
+	SharedMemoryQueue queue("testProducerConsumer", 4096);
+	QueueConsumer consumer(queue, count);
+	Thread thread;
+	thread.start(consumer);
+
+	long expected = 0;
+	for (int i = 0; i < count; i++)
+	{
+		queue.write(&i, sizeof(int));
+		expected += i;
+	}
+	thread.join();
+	assert (consumer.sum() == expected);
+}
+
+
+void SharedMemoryQueueTest::setUp()
+{
+}
+
+
+void SharedMemoryQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* SharedMemoryQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SharedMemoryQueueTest");
+
+#if !defined(POCO_NO_SHAREDMEMORY)
+	CppUnit_addTest(pSuite, SharedMemoryQueueTest, testWriteRead);
+	CppUnit_addTest(pSuite, SharedMemoryQueueTest, testZeroCopy);
+	CppUnit_addTest(pSuite, SharedMemoryQueueTest, testWrapAround);
+	CppUnit_addTest(pSuite, SharedMemoryQueueTest, testProducerConsumer);
+#endif
+	return pSuite;
+}
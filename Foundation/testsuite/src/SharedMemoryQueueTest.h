@@ -0,0 +1,39 @@
+//
+// SharedMemoryQueueTest.h
+//
+// Definition of the SharedMemoryQueueTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SharedMemoryQueueTest_INCLUDED
+#define SharedMemoryQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class SharedMemoryQueueTest: public CppUnit::TestCase
+{
+public:
+	SharedMemoryQueueTest(const std::string& name);
+	~SharedMemoryQueueTest();
+
+	void testWriteRead();
+	void testZeroCopy();
+	void testWrapAround();
+	void testProducerConsumer();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // SharedMemoryQueueTest_INCLUDED
@@ -38,6 +38,28 @@ void SharedMemoryTest::testCreate()
 }
 
 
+void SharedMemoryTest::testCreateWithOptions()
+{
+	// SM_HUGE_PAGES falls back to transparent huge pages (or normal
+	// pages) when no huge pages are reserved, so creation must
+	// always succeed
+	SharedMemory mem("hiOpts", 4096, SharedMemory::AM_WRITE, SharedMemory::SM_HUGE_PAGES);
+	assert (mem.end() - mem.begin() == 4096);
+	mem.begin()[0] = 'A';
+	mem.end()[-1] = 'Z';
+
+	try
+	{
+		SharedMemory locked("hiLocked", 4096, SharedMemory::AM_WRITE, SharedMemory::SM_LOCK);
+		locked.begin()[0] = 'A';
+	}
+	catch (Poco::SystemException&)
+	{
+		// locking may be refused due to RLIMIT_MEMLOCK
+	}
+}
+
+
 void SharedMemoryTest::testCreateFromFile()
 {
 	Poco::Path p = findDataFile("testdata.txt");
@@ -89,6 +111,7 @@ CppUnit::Test* SharedMemoryTest::suite()
 #if !defined(POCO_NO_SHAREDMEMORY)
 	CppUnit_addTest(pSuite, SharedMemoryTest, testCreate);
 	CppUnit_addTest(pSuite, SharedMemoryTest, testCreateFromFile);
+	CppUnit_addTest(pSuite, SharedMemoryTest, testCreateWithOptions);
 #endif
 	return pSuite;
 }
@@ -27,6 +27,7 @@ public:
 
 	void testCreate();
 	void testCreateFromFile();
+	void testCreateWithOptions();
 
 	void setUp();
 	void tearDown();
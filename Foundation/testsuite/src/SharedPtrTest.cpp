@@ -158,6 +158,54 @@ void SharedPtrTest::testSharedPtr()
 }
 
 
+void SharedPtrTest::testMove()
+{
+	SharedPtr<TestObject> ptr1 = new TestObject("one");
+	assert (ptr1.referenceCount() == 1);
+	SharedPtr<TestObject> ptr2 = ptr1;
+	assert (ptr1.referenceCount() == 2);
+
+	SharedPtr<TestObject> ptr3(std::move(ptr2));
+	assert (ptr1.referenceCount() == 2);
+	assert (ptr2.isNull());
+	assert (ptr2.referenceCount() == 0);
+	assert (ptr3 == ptr1);
+
+	ptr2 = std::move(ptr3);
+	assert (ptr1.referenceCount() == 2);
+	assert (ptr3.isNull());
+	assert (ptr2 == ptr1);
+
+	ptr1 = 0;
+	ptr2 = 0;
+	assert (TestObject::count() == 0);
+}
+
+
+void SharedPtrTest::testMake()
+{
+	{
+		SharedPtr<TestObject> ptr1 = SharedPtr<TestObject>::make("one");
+		assert (TestObject::count() == 1);
+		assert (ptr1->data() == "one");
+		assert (ptr1.referenceCount() == 1);
+
+		SharedPtr<TestObject> ptr2 = ptr1;
+		assert (ptr1.referenceCount() == 2);
+		ptr2 = 0;
+		assert (ptr1.referenceCount() == 1);
+	}
+	assert (TestObject::count() == 0);
+
+	{
+		SharedPtr<DerivedObject> ptr1 = SharedPtr<DerivedObject>::make("test", 666);
+		assert (TestObject::count() == 1);
+		assert (ptr1->number() == 666);
+	}
+	assert (TestObject::count() == 0);
+}
+
+
 void SharedPtrTest::testImplicitCast()
 {
 	{
@@ -210,6 +258,8 @@ CppUnit::Test* SharedPtrTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SharedPtrTest");
 
 	CppUnit_addTest(pSuite, SharedPtrTest, testSharedPtr);
+	CppUnit_addTest(pSuite, SharedPtrTest, testMove);
+	CppUnit_addTest(pSuite, SharedPtrTest, testMake);
 	CppUnit_addTest(pSuite, SharedPtrTest, testImplicitCast);
 	CppUnit_addTest(pSuite, SharedPtrTest, testExplicitCast);
 
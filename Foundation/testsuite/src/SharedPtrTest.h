@@ -25,6 +25,8 @@ public:
 	~SharedPtrTest();
 
 	void testSharedPtr();
+	void testMove();
+	void testMake();
 
 	void testImplicitCast();
 	void testExplicitCast();
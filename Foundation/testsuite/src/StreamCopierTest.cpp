@@ -12,6 +12,8 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/FileStream.h"
+#include "Poco/TemporaryFile.h"
 #include <sstream>
 
 
@@ -160,6 +162,49 @@ void StreamCopierTest::testCopyToString64()
 #endif
 
 
+void StreamCopierTest::testCopyFileToFile()
+{
+	Poco::TemporaryFile srcFile;
+	Poco::TemporaryFile dstFile;
+
+	std::string src;
+	for (int i = 0; i < 100000; ++i) src += char('A' + i % 26);
+	{
+		Poco::FileOutputStream ostr(srcFile.path());
+		ostr.write(src.data(), (std::streamsize) src.size());
+	}
+	{
+		Poco::FileInputStream istr(srcFile.path());
+		Poco::FileOutputStream ostr(dstFile.path());
+		std::streamsize n = StreamCopier::copyStream(istr, ostr);
+		assert (n == src.size());
+	}
+	{
+		Poco::FileInputStream istr(dstFile.path());
+		std::ostringstream ostr;
+		StreamCopier::copyStream(istr, ostr);
+		assert (ostr.str() == src);
+	}
+
+	// data already read from the source stream must not be copied again
+	{
+		Poco::FileInputStream istr(srcFile.path());
+		char prefix[26];
+		istr.read(prefix, sizeof(prefix));
+		assert (istr.gcount() == sizeof(prefix));
+		Poco::FileOutputStream ostr(dstFile.path());
+		std::streamsize n = StreamCopier::copyStream(istr, ostr);
+		assert (n == src.size() - sizeof(prefix));
+	}
+	{
+		Poco::FileInputStream istr(dstFile.path());
+		std::ostringstream ostr;
+		StreamCopier::copyStream(istr, ostr);
+		assert (ostr.str() == src.substr(26));
+	}
+}
+
+
 void StreamCopierTest::setUp()
 {
 }
@@ -177,6 +222,7 @@ CppUnit::Test* StreamCopierTest::suite()
 	CppUnit_addTest(pSuite, StreamCopierTest, testBufferedCopy);
 	CppUnit_addTest(pSuite, StreamCopierTest, testUnbufferedCopy);
 	CppUnit_addTest(pSuite, StreamCopierTest, testCopyToString);
+	CppUnit_addTest(pSuite, StreamCopierTest, testCopyFileToFile);
 
 #if defined(POCO_HAVE_INT64)
 	CppUnit_addTest(pSuite, StreamCopierTest, testBufferedCopy64);
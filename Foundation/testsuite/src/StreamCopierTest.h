@@ -27,6 +27,7 @@ public:
 	void testBufferedCopy();
 	void testUnbufferedCopy();
 	void testCopyToString();
+	void testCopyFileToFile();
 #if defined(POCO_HAVE_INT64)
 	void testBufferedCopy64();
 	void testUnbufferedCopy64();
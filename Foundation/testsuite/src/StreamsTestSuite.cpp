@@ -20,6 +20,7 @@
 #include "BinaryReaderWriterTest.h"
 #include "LineEndingConverterTest.h"
 #include "TeeStreamTest.h"
+#include "ReadAheadStreamTest.h"
 #include "FileStreamTest.h"
 #include "MemoryStreamTest.h"
 #include "FIFOBufferStreamTest.h"
@@ -40,6 +41,7 @@ CppUnit::Test* StreamsTestSuite::suite()
 	pSuite->addTest(BinaryReaderWriterTest::suite());
 	pSuite->addTest(LineEndingConverterTest::suite());
 	pSuite->addTest(TeeStreamTest::suite());
+	pSuite->addTest(ReadAheadStreamTest::suite());
 	pSuite->addTest(FileStreamTest::suite());
 	pSuite->addTest(MemoryStreamTest::suite());
 	pSuite->addTest(FIFOBufferStreamTest::suite());
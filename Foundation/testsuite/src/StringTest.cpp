@@ -286,6 +286,12 @@ void StringTest::testIcompare()
 	assert (icompare(ss1, 2, 2, "bb") < 0);
 	
 	assert (icompare(ss1, 2, "aaa") > 0);
+
+	assert (icompare("Content-Length", 14, "content-length", 14) == 0);
+	assert (icompare("aaa", 3, "bbb", 3) < 0);
+	assert (icompare("bbb", 3, "aaa", 3) > 0);
+	assert (icompare("aaa", 3, "aaaa", 4) < 0);
+	assert (icompare("aaaa", 4, "aaa", 3) > 0);
 }
 
 
@@ -0,0 +1,172 @@
+//
+// StringTokenizerViewTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "StringTokenizerViewTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/StringTokenizerView.h"
+#include "Poco/StringTokenizer.h"
+#include <vector>
+
+
+using Poco::StringTokenizerView;
+using Poco::StringTokenizer;
+
+
+StringTokenizerViewTest::StringTokenizerViewTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+StringTokenizerViewTest::~StringTokenizerViewTest()
+{
+}
+
+
+void StringTokenizerViewTest::testTokenize()
+{
+	std::string str("abc,def,,ghi");
+	StringTokenizerView view(str, ",");
+	StringTokenizerView::Iterator it = view.begin();
+	assert (it != view.end());
+	assert (*it == "abc");
+	++it;
+	assert (*it == "def");
+	++it;
+	assert (it->empty());
+	++it;
+	assert (*it == "ghi");
+	++it;
+	assert (it == view.end());
+
+	std::string empty;
+	StringTokenizerView emptyView(empty, ",");
+	assert (emptyView.begin() == emptyView.end());
+
+	std::string single("abc");
+	StringTokenizerView singleView(single, ",");
+	it = singleView.begin();
+	assert (*it == "abc");
+	++it;
+	assert (it == singleView.end());
+}
+
+
+void StringTokenizerViewTest::testOptions()
+{
+	std::string str(" red , green ,, blue ");
+	StringTokenizerView trimView(str, ",", StringTokenizerView::TOK_TRIM);
+	StringTokenizerView::Iterator it = trimView.begin();
+	assert (*it == "red");
+	++it;
+	assert (*it == "green");
+	++it;
+	assert (it->empty());
+	++it;
+	assert (*it == "blue");
+	++it;
+	assert (it == trimView.end());
+
+	StringTokenizerView bothView(str, ",", StringTokenizerView::TOK_TRIM | StringTokenizerView::TOK_IGNORE_EMPTY);
+	it = bothView.begin();
+	assert (*it == "red");
+	++it;
+	assert (*it == "green");
+	++it;
+	assert (*it == "blue");
+	++it;
+	assert (it == bothView.end());
+
+	std::string onlySeps(";,;");
+	StringTokenizerView ignoreView(onlySeps, ",;", StringTokenizerView::TOK_IGNORE_EMPTY);
+	assert (ignoreView.begin() == ignoreView.end());
+}
+
+
+void StringTokenizerViewTest::testZeroCopy()
+{
+	std::string str("abc,def");
+	StringTokenizerView view(str, ",");
+	StringTokenizerView::Iterator it = view.begin();
+	assert (it->data() == str.data());
+	assert (it->size() == 3);
+	++it;
+	assert (it->data() == str.data() + 4);
+	assert (it->size() == 3);
+}
+
+
+void StringTokenizerViewTest::testStringTokenizerParity()
+{
+	const char* inputs[] =
+	{
+		"",
+		",",
+		",,",
+		"abc",
+		"abc,def",
+		"abc,def,",
+		",abc",
+		" abc , def ",
+		"  ,  ",
+		"a;b,c;",
+		"white; space,  sep ,\t"
+	};
+	const int optionSets[] =
+	{
+		0,
+		StringTokenizer::TOK_TRIM,
+		StringTokenizer::TOK_IGNORE_EMPTY,
+		StringTokenizer::TOK_TRIM | StringTokenizer::TOK_IGNORE_EMPTY
+	};
+
+	for (std::size_t i = 0; i < sizeof(inputs)/sizeof(inputs[0]); i++)
+	{
+		std::string str(inputs[i]);
+		for (std::size_t j = 0; j < sizeof(optionSets)/sizeof(optionSets[0]); j++)
+		{
+			StringTokenizer tokenizer(str, ",;", optionSets[j]);
+			StringTokenizerView view(str, ",;", optionSets[j]);
+			std::vector<std::string> viewTokens;
+			for (StringTokenizerView::Iterator it = view.begin(); it != view.end(); ++it)
+			{
+				viewTokens.push_back(it->toString());
+			}
+			assert (viewTokens.size() == tokenizer.count());
+			for (std::size_t k = 0; k < viewTokens.size(); k++)
+			{
+				assert (viewTokens[k] == tokenizer[k]);
+			}
+		}
+	}
+}
+
+
+void StringTokenizerViewTest::setUp()
+{
+}
+
+
+void StringTokenizerViewTest::tearDown()
+{
+}
+
+
+CppUnit::Test* StringTokenizerViewTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("StringTokenizerViewTest");
+
+	CppUnit_addTest(pSuite, StringTokenizerViewTest, testTokenize);
+	CppUnit_addTest(pSuite, StringTokenizerViewTest, testOptions);
+	CppUnit_addTest(pSuite, StringTokenizerViewTest, testZeroCopy);
+	CppUnit_addTest(pSuite, StringTokenizerViewTest, testStringTokenizerParity);
+
+	return pSuite;
+}
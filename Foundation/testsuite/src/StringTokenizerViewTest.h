@@ -0,0 +1,39 @@
+//
+// StringTokenizerViewTest.h
+//
+// Definition of the StringTokenizerViewTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef StringTokenizerViewTest_INCLUDED
+#define StringTokenizerViewTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class StringTokenizerViewTest: public CppUnit::TestCase
+{
+public:
+	StringTokenizerViewTest(const std::string& name);
+	~StringTokenizerViewTest();
+
+	void testTokenize();
+	void testOptions();
+	void testZeroCopy();
+	void testStringTokenizerParity();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // StringTokenizerViewTest_INCLUDED
@@ -475,6 +475,31 @@ void TaskManagerTest::testCustomThreadPool()
 	tp.joinAll();
 }
 
+void TaskManagerTest::testProgressCoalescing()
+{
+	TaskManager tm;
+	TaskObserver to;
+	tm.addObserver(Observer<TaskObserver, TaskProgressNotification>(to, &TaskObserver::taskProgress));
+	tm.setProgressCoalescingInterval(20);
+	assert (tm.getProgressCoalescingInterval() == 20);
+
+	AutoPtr<TestTask> pTT = new TestTask;
+	tm.start(pTT.duplicate());
+	pTT->cont();
+	while (pTT->progress() != 0.5) Thread::sleep(50);
+	pTT->cont();
+	while (pTT->progress() != 1.0) Thread::sleep(50);
+	pTT->cont();
+	while (pTT->state() != Task::TASK_FINISHED) Thread::sleep(50);
+	while (to.progress() != 1.0) Thread::sleep(50);
+	assert (to.progress() == 1.0);
+
+	tm.setProgressCoalescingInterval(0);
+	assert (tm.getProgressCoalescingInterval() == 0);
+	tm.joinAll();
+}
+
+
 void TaskManagerTest::setUp()
 {
 }
@@ -495,6 +520,7 @@ CppUnit::Test* TaskManagerTest::suite()
 	CppUnit_addTest(pSuite, TaskManagerTest, testMultiTasks);
 	CppUnit_addTest(pSuite, TaskManagerTest, testCustom);
 	CppUnit_addTest(pSuite, TaskManagerTest, testCustomThreadPool);
+	CppUnit_addTest(pSuite, TaskManagerTest, testProgressCoalescing);
 
 	return pSuite;
 }
@@ -36,6 +36,7 @@ public:
 	void testCustom();
 	void testMultiTasks();
 	void testCustomThreadPool();
+	void testProgressCoalescing();
 
 	void setUp();
 	void tearDown();
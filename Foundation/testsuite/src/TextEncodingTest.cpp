@@ -91,6 +91,22 @@ void TextEncodingTest::testTextEncoding()
 }
 
 
+void TextEncodingTest::testUTF8IsValid()
+{
+	assert (UTF8Encoding::isValid("", 0));
+	assert (UTF8Encoding::isValid("plain ascii text, somewhat longer than sixteen bytes", 52));
+	assert (UTF8Encoding::isValid("a\xC3\xA9b", 4));
+	assert (UTF8Encoding::isValid("\xE2\x82\xAC", 3));
+	assert (UTF8Encoding::isValid("\xF0\x9F\x98\x80", 4));
+	assert (!UTF8Encoding::isValid("\x80", 1));             // stray continuation byte
+	assert (!UTF8Encoding::isValid("\xC0\xAF", 2));         // overlong encoding
+	assert (!UTF8Encoding::isValid("\xED\xA0\x80", 3));     // UTF-16 surrogate
+	assert (!UTF8Encoding::isValid("\xF4\x90\x80\x80", 4)); // beyond U+10FFFF
+	assert (!UTF8Encoding::isValid("\xC3", 1));             // truncated sequence
+	assert (!UTF8Encoding::isValid("abcdefghijklmnopqrstuvwxyz\xFFzyx", 30));
+}
+
+
 void TextEncodingTest::setUp()
 {
 }
@@ -106,6 +122,7 @@ CppUnit::Test* TextEncodingTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TextEncodingTest");
 
 	CppUnit_addTest(pSuite, TextEncodingTest, testTextEncoding);
+	CppUnit_addTest(pSuite, TextEncodingTest, testUTF8IsValid);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~TextEncodingTest();
 
 	void testTextEncoding();
+	void testUTF8IsValid();
 
 	void setUp();
 	void tearDown();
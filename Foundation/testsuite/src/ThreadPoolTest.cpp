@@ -128,6 +128,40 @@ void ThreadPoolTest::testThreadPool()
 }
 
 
+void ThreadPoolTest::testWorkStealing()
+{
+	ThreadPool pool(2, 8, 60, POCO_THREAD_STACK_SIZE, ThreadPool::SCHEDULING_WORK_STEALING);
+
+	assert (pool.getSchedulingPolicy() == ThreadPool::SCHEDULING_WORK_STEALING);
+	assert (pool.allocated() == 2);
+	assert (pool.capacity() == 8);
+
+	RunnableAdapter<ThreadPoolTest> ra(*this, &ThreadPoolTest::countNoWait);
+	const int TASKS = 64;
+	for (int i = 0; i < TASKS; ++i)
+	{
+		pool.start(ra);
+	}
+	pool.joinAll();
+
+	assert (_count == TASKS*10000);
+	assert (pool.allocated() <= 8);
+	assert (pool.used() == 0);
+
+	// the pool must be reusable after joinAll()
+	_count = 0;
+	for (int i = 0; i < TASKS; ++i)
+	{
+		pool.start(ra);
+	}
+	pool.joinAll();
+
+	assert (_count == TASKS*10000);
+
+	pool.stopAll();
+}
+
+
 void ThreadPoolTest::setUp()
 {
 	_event.reset();
@@ -152,11 +186,23 @@ void ThreadPoolTest::count()
 }
 
 
+void ThreadPoolTest::countNoWait()
+{
+	for (int i = 0; i < 10000; ++i)
+	{
+		_mutex.lock();
+		++_count;
+		_mutex.unlock();
+	}
+}
+
+
 CppUnit::Test* ThreadPoolTest::suite()
 {
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ThreadPoolTest");
 
 	CppUnit_addTest(pSuite, ThreadPoolTest, testThreadPool);
+	CppUnit_addTest(pSuite, ThreadPoolTest, testWorkStealing);
 
 	return pSuite;
 }
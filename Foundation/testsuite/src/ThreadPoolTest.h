@@ -27,6 +27,7 @@ public:
 	~ThreadPoolTest();
 
 	void testThreadPool();
+	void testWorkStealing();
 
 	void setUp();
 	void tearDown();
@@ -35,6 +36,7 @@ public:
 
 protected:
 	void count();
+	void countNoWait();
 
 private:
 	Poco::FastMutex _mutex;
@@ -0,0 +1,121 @@
+//
+// ThrottleChannelTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ThrottleChannelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ThrottleChannel.h"
+#include "Poco/Message.h"
+#include "Poco/Thread.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/AutoPtr.h"
+#include "TestChannel.h"
+
+
+using Poco::ThrottleChannel;
+using Poco::Message;
+using Poco::Thread;
+using Poco::NumberFormatter;
+using Poco::AutoPtr;
+
+
+ThrottleChannelTest::ThrottleChannelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ThrottleChannelTest::~ThrottleChannelTest()
+{
+}
+
+
+void ThrottleChannelTest::testSuppress()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<ThrottleChannel> pThrottle = new ThrottleChannel(pChannel);
+
+	Message msg("source", "a message", Message::PRIO_ERROR);
+	for (int i = 0; i < 10; ++i)
+	{
+		pThrottle->log(msg);
+	}
+	assert (pChannel->list().size() == 1);
+
+	pThrottle->log(Message("source", "another message", Message::PRIO_ERROR));
+	assert (pChannel->list().size() == 2);
+
+	pThrottle->log(Message("source", "a message", Message::PRIO_WARNING));
+	assert (pChannel->list().size() == 3);
+}
+
+
+void ThrottleChannelTest::testSummary()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<ThrottleChannel> pThrottle = new ThrottleChannel(pChannel);
+	pThrottle->setProperty("window", "100");
+
+	Message msg("source", "a message", Message::PRIO_ERROR);
+	for (int i = 0; i < 4; ++i)
+	{
+		pThrottle->log(msg);
+	}
+	assert (pChannel->list().size() == 1);
+
+	Thread::sleep(200);
+	pThrottle->log(msg);
+	assert (pChannel->list().size() == 3);
+	TestChannel::MsgList::const_iterator it = pChannel->list().begin();
+	++it;
+	assert (it->getText() == "last message repeated 3 times");
+	assert (it->getSource() == "source");
+	assert (it->getPriority() == Message::PRIO_ERROR);
+
+	pThrottle->log(msg);
+	pThrottle->close();
+	assert (pChannel->getLastMessage().getText() == "last message repeated 1 time");
+}
+
+
+void ThrottleChannelTest::testSample()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<ThrottleChannel> pThrottle = new ThrottleChannel(pChannel);
+	pThrottle->setProperty("sampleRate", "0.5");
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		pThrottle->log(Message("source", "message " + NumberFormatter::format(i), Message::PRIO_INFORMATION));
+	}
+	assert (pChannel->list().size() > 250);
+	assert (pChannel->list().size() < 750);
+}
+
+
+void ThrottleChannelTest::setUp()
+{
+}
+
+
+void ThrottleChannelTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ThrottleChannelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ThrottleChannelTest");
+
+	CppUnit_addTest(pSuite, ThrottleChannelTest, testSuppress);
+	CppUnit_addTest(pSuite, ThrottleChannelTest, testSummary);
+	CppUnit_addTest(pSuite, ThrottleChannelTest, testSample);
+
+	return pSuite;
+}
@@ -0,0 +1,38 @@
+//
+// ThrottleChannelTest.h
+//
+// Definition of the ThrottleChannelTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ThrottleChannelTest_INCLUDED
+#define ThrottleChannelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ThrottleChannelTest: public CppUnit::TestCase
+{
+public:
+	ThrottleChannelTest(const std::string& name);
+	~ThrottleChannelTest();
+
+	void testSuppress();
+	void testSummary();
+	void testSample();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ThrottleChannelTest_INCLUDED
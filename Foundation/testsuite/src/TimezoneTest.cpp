@@ -12,6 +12,7 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/Timezone.h"
+#include "Poco/Timestamp.h"
 #include <iostream>
 
 
@@ -41,6 +42,21 @@ void TimezoneTest::testTimezone()
 }
 
 
+void TimezoneTest::testTZD()
+{
+	int tzd = Timezone::tzd();
+	assert (tzd == Timezone::utcOffset() + Timezone::dst());
+
+	Poco::Timestamp now;
+	assert (Timezone::tzd(now) == tzd);
+
+	// the cached differential must match a freshly computed one
+	Timezone::invalidateCache();
+	assert (Timezone::tzd(now) == tzd);
+	assert (Timezone::tzd(now) == tzd);
+}
+
+
 void TimezoneTest::setUp()
 {
 }
@@ -56,6 +72,7 @@ CppUnit::Test* TimezoneTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TimezoneTest");
 
 	CppUnit_addTest(pSuite, TimezoneTest, testTimezone);
+	CppUnit_addTest(pSuite, TimezoneTest, testTZD);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~TimezoneTest();
 
 	void testTimezone();
+	void testTZD();
 
 	void setUp();
 	void tearDown();
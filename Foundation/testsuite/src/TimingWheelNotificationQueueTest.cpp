@@ -0,0 +1,148 @@
+//
+// TimingWheelNotificationQueueTest.cpp
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "TimingWheelNotificationQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/TimingWheelNotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/Thread.h"
+#include "Poco/Clock.h"
+
+
+using Poco::TimingWheelNotificationQueue;
+using Poco::Notification;
+using Poco::Clock;
+using Poco::Thread;
+
+
+TimingWheelNotificationQueueTest::TimingWheelNotificationQueueTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+TimingWheelNotificationQueueTest::~TimingWheelNotificationQueueTest()
+{
+}
+
+
+void TimingWheelNotificationQueueTest::testDequeue()
+{
+	TimingWheelNotificationQueue queue;
+	assert (queue.empty());
+	assert (queue.size() == 0);
+	Notification* pNf = queue.dequeueNotification();
+	assertNullPtr(pNf);
+	queue.enqueueNotification(new Notification, Clock());
+	assert (!queue.empty());
+	assert (queue.size() == 1);
+	Thread::sleep(5); // tick granularity is one millisecond
+	pNf = queue.dequeueNotification();
+	assertNotNullPtr(pNf);
+	assert (queue.empty());
+	assert (queue.size() == 0);
+	pNf->release();
+
+	Clock ts1;
+	ts1 += 200000;
+	queue.enqueueNotification(new Notification, ts1);
+	assert (!queue.empty());
+	assert (queue.size() == 1);
+	pNf = queue.dequeueNotification();
+	assertNullPtr(pNf);
+	assert (queue.size() == 1);
+}
+
+
+void TimingWheelNotificationQueueTest::testWaitDequeue()
+{
+	TimingWheelNotificationQueue queue;
+	Clock ts;
+	ts += 100000;
+	queue.enqueueNotification(new Notification, ts);
+	Notification* pNf = queue.waitDequeueNotification(500);
+	assertNotNullPtr(pNf);
+	Clock now;
+	assert (now >= ts);
+	pNf->release();
+
+	pNf = queue.waitDequeueNotification(50);
+	assertNullPtr(pNf);
+}
+
+
+void TimingWheelNotificationQueueTest::testCancelByOwner()
+{
+	TimingWheelNotificationQueue queue;
+	int owner1 = 0;
+	int owner2 = 0;
+	Clock ts;
+	ts += 60000000;
+	for (int i = 0; i < 100; i++)
+	{
+		queue.enqueueNotification(new Notification, ts, &owner1);
+		queue.enqueueNotification(new Notification, ts, &owner2);
+	}
+	assert (queue.size() == 200);
+	assert (queue.cancelNotifications(&owner1) == 100);
+	assert (queue.size() == 100);
+	assert (queue.cancelNotifications(&owner1) == 0);
+	assert (queue.cancelNotifications(&owner2) == 100);
+	assert (queue.empty());
+}
+
+
+void TimingWheelNotificationQueueTest::testManyTimers()
+{
+	TimingWheelNotificationQueue queue;
+	const int n = 10000;
+	for (int i = 0; i < n; i++)
+	{
+		Clock ts;
+		ts += (i % 50)*1000;
+		queue.enqueueNotification(new Notification, ts);
+	}
+	assert (queue.size() == n);
+	int count = 0;
+	std::vector<Notification::Ptr> batch;
+	while (count < n)
+	{
+		Notification::Ptr pNf = queue.waitDequeueNotification(1000);
+		assert (!pNf.isNull());
+		++count;
+		batch.clear();
+		count += queue.dequeueBatch(batch, n);
+	}
+	assert (count == n);
+	assert (queue.empty());
+}
+
+
+void TimingWheelNotificationQueueTest::setUp()
+{
+}
+
+
+void TimingWheelNotificationQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* TimingWheelNotificationQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TimingWheelNotificationQueueTest");
+
+	CppUnit_addTest(pSuite, TimingWheelNotificationQueueTest, testDequeue);
+	CppUnit_addTest(pSuite, TimingWheelNotificationQueueTest, testWaitDequeue);
+	CppUnit_addTest(pSuite, TimingWheelNotificationQueueTest, testCancelByOwner);
+	CppUnit_addTest(pSuite, TimingWheelNotificationQueueTest, testManyTimers);
+
+	return pSuite;
+}
@@ -0,0 +1,39 @@
+//
+// TimingWheelNotificationQueueTest.h
+//
+// Definition of the TimingWheelNotificationQueueTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef TimingWheelNotificationQueueTest_INCLUDED
+#define TimingWheelNotificationQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class TimingWheelNotificationQueueTest: public CppUnit::TestCase
+{
+public:
+	TimingWheelNotificationQueueTest(const std::string& name);
+	~TimingWheelNotificationQueueTest();
+
+	void testDequeue();
+	void testWaitDequeue();
+	void testCancelByOwner();
+	void testManyTimers();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // TimingWheelNotificationQueueTest_INCLUDED
@@ -13,6 +13,7 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/URI.h"
 #include "Poco/Path.h"
+#include <utility>
 
 
 using Poco::URI;
@@ -726,6 +727,21 @@ void URITest::testSwap()
 }
 
 
+void URITest::testMove()
+{
+#ifdef POCO_URI_HAVE_RVALUE_REFS
+	URI uri1("http://www.appinf.com/search.cgi?keyword=test#result");
+	URI uri2(std::move(uri1));
+	assert (uri2.toString() == "http://www.appinf.com/search.cgi?keyword=test#result");
+	assert (uri1.empty());
+
+	uri1 = std::move(uri2);
+	assert (uri1.toString() == "http://www.appinf.com/search.cgi?keyword=test#result");
+	assert (uri2.empty());
+#endif
+}
+
+
 void URITest::testOther()
 {
 	// The search string is "hello%world"; google happens to ignore the '%'
@@ -874,6 +890,7 @@ CppUnit::Test* URITest::suite()
 	CppUnit_addTest(pSuite, URITest, testNormalize);
 	CppUnit_addTest(pSuite, URITest, testResolve);
 	CppUnit_addTest(pSuite, URITest, testSwap);
+	CppUnit_addTest(pSuite, URITest, testMove);
 	CppUnit_addTest(pSuite, URITest, testEncodeDecode);
 	CppUnit_addTest(pSuite, URITest, testOther);
 	CppUnit_addTest(pSuite, URITest, testFromPath);
@@ -31,6 +31,7 @@ public:
 	void testNormalize();
 	void testResolve();
 	void testSwap();
+	void testMove();
 	void testEncodeDecode();
 	void testOther();
 	void testFromPath();
@@ -10,6 +10,7 @@
 
 #include "URITestSuite.h"
 #include "URITest.h"
+#include "URIViewTest.h"
 #include "URIStreamOpenerTest.h"
 
 
@@ -18,6 +19,7 @@ CppUnit::Test* URITestSuite::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("URITestSuite");
 
 	pSuite->addTest(URITest::suite());
+	pSuite->addTest(URIViewTest::suite());
 	pSuite->addTest(URIStreamOpenerTest::suite());
 
 	return pSuite;
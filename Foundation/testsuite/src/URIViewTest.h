@@ -0,0 +1,41 @@
+//
+// URIViewTest.h
+//
+// Definition of the URIViewTest class.
+//
+// Copyright (c) 2004-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef URIViewTest_INCLUDED
+#define URIViewTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class URIViewTest: public CppUnit::TestCase
+{
+public:
+	URIViewTest(const std::string& name);
+	~URIViewTest();
+
+	void testParse();
+	void testZeroCopy();
+	void testDecode();
+	void testPort();
+	void testQueryParameters();
+	void testToURI();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // URIViewTest_INCLUDED
@@ -15,6 +15,7 @@
 #include "Poco/UUID.h"
 #include "Poco/SHA1Engine.h"
 #include <set>
+#include <vector>
 
 
 using Poco::UUIDGenerator;
@@ -61,6 +62,47 @@ void UUIDGeneratorTest::testRandom()
 }
 
 
+void UUIDGeneratorTest::testBulk()
+{
+	UUIDGenerator& gen = UUIDGenerator::defaultGenerator();
+
+	std::vector<UUID> uuids(1000);
+	gen.createBulk(&uuids[0], uuids.size());
+
+	std::set<UUID> unique;
+	for (std::vector<UUID>::const_iterator it = uuids.begin(); it != uuids.end(); ++it)
+	{
+		assert (it->version() == UUID::UUID_TIME_BASED);
+		assert (unique.find(*it) == unique.end());
+		unique.insert(*it);
+	}
+
+	gen.createRandomBulk(&uuids[0], uuids.size());
+	for (std::vector<UUID>::const_iterator it = uuids.begin(); it != uuids.end(); ++it)
+	{
+		assert (it->version() == UUID::UUID_RANDOM);
+		assert (unique.find(*it) == unique.end());
+		unique.insert(*it);
+	}
+}
+
+
+void UUIDGeneratorTest::testThreadLocal()
+{
+	UUIDGenerator& gen1 = UUIDGenerator::threadLocalGenerator();
+	UUIDGenerator& gen2 = UUIDGenerator::threadLocalGenerator();
+	assert (&gen1 == &gen2);
+
+	std::set<UUID> uuids;
+	for (int i = 0; i < 1000; ++i)
+	{
+		UUID uuid = gen1.createOne();
+		assert (uuids.find(uuid) == uuids.end());
+		uuids.insert(uuid);
+	}
+}
+
+
 void UUIDGeneratorTest::testNameBased()
 {
 	UUIDGenerator& gen = UUIDGenerator::defaultGenerator();
@@ -109,6 +151,8 @@ CppUnit::Test* UUIDGeneratorTest::suite()
 	CppUnit_addTest(pSuite, UUIDGeneratorTest, testTimeBased);
 	CppUnit_addTest(pSuite, UUIDGeneratorTest, testRandom);
 	CppUnit_addTest(pSuite, UUIDGeneratorTest, testNameBased);
+	CppUnit_addTest(pSuite, UUIDGeneratorTest, testBulk);
+	CppUnit_addTest(pSuite, UUIDGeneratorTest, testThreadLocal);
 
 	return pSuite;
 }
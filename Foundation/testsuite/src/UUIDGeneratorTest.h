@@ -27,6 +27,8 @@ public:
 	void testTimeBased();
 	void testRandom();
 	void testNameBased();
+	void testBulk();
+	void testThreadLocal();
 	
 	void setUp();
 	void tearDown();
@@ -2851,6 +2851,31 @@ void VarTest::testEmpty()
 }
 
 
+void VarTest::testMove()
+{
+#ifdef POCO_VAR_HAVE_CPP11
+	Var da("test string");
+	Var moved = std::move(da);
+	assert (da.isEmpty());
+	assert (moved.extract<std::string>() == "test string");
+
+	Var assigned;
+	assigned = std::move(moved);
+	assert (moved.isEmpty());
+	assert (assigned.extract<std::string>() == "test string");
+
+	std::vector<Var> vec;
+	vec.push_back(1);
+	vec.push_back(2);
+	Var arr(vec);
+	Var movedArr = std::move(arr);
+	assert (arr.isEmpty());
+	assert (movedArr.size() == 2);
+	assert (movedArr[1] == 2);
+#endif
+}
+
+
 void VarTest::testIterator()
 {
 	Var da;
@@ -2975,6 +3000,7 @@ CppUnit::Test* VarTest::suite()
 	CppUnit_addTest(pSuite, VarTest, testJSONRoundtripStruct);
 	CppUnit_addTest(pSuite, VarTest, testDate);
 	CppUnit_addTest(pSuite, VarTest, testEmpty);
+	CppUnit_addTest(pSuite, VarTest, testMove);
 	CppUnit_addTest(pSuite, VarTest, testIterator);
 
 	return pSuite;
@@ -71,6 +71,7 @@ public:
 	void testJSONDeserializeComplex();
 	void testDate();
 	void testEmpty();
+	void testMove();
 	void testIterator();
 
 
@@ -13,6 +13,7 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/InflatingStream.h"
 #include "Poco/DeflatingStream.h"
+#include "Poco/ParallelDeflatingStream.h"
 #include "Poco/MemoryStream.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Buffer.h"
@@ -25,6 +26,7 @@ using Poco::DeflatingOutputStream;
 using Poco::DeflatingInputStream;
 using Poco::InflatingStreamBuf;
 using Poco::DeflatingStreamBuf;
+using Poco::ParallelDeflatingOutputStream;
 using Poco::StreamCopier;
 
 
@@ -175,6 +177,52 @@ void ZLibTest::testGzip3()
 }
 
 
+void ZLibTest::testParallelDeflate()
+{
+	std::string data;
+	data.reserve(1500000);
+	while (data.size() < 1500000)
+	{
+		data += "abcdefabcdefabcdefabcdefabcdefabcdef";
+		data += static_cast<char>('0' + data.size() % 10);
+	}
+
+	// zlib and gzip framing, block sizes around the data size
+	for (int type = 0; type < 2; ++type)
+	{
+		DeflatingStreamBuf::StreamType dt = type ? DeflatingStreamBuf::STREAM_GZIP : DeflatingStreamBuf::STREAM_ZLIB;
+		InflatingStreamBuf::StreamType it = type ? InflatingStreamBuf::STREAM_GZIP : InflatingStreamBuf::STREAM_ZLIB;
+
+		std::size_t blockSizes[] = {65536, 1048576, 4194304};
+		for (int i = 0; i < 3; ++i)
+		{
+			std::stringstream buffer;
+			ParallelDeflatingOutputStream deflater(buffer, dt, Z_DEFAULT_COMPRESSION, blockSizes[i]);
+			deflater.write(data.data(), (std::streamsize) data.size());
+			deflater.flush();
+			deflater << "trailing";
+			deflater.close();
+
+			InflatingInputStream inflater(buffer, it);
+			std::stringstream inflated;
+			StreamCopier::copyStream(inflater, inflated);
+			assert (inflated.str() == data + "trailing");
+		}
+	}
+
+	// empty stream
+	{
+		std::stringstream buffer;
+		ParallelDeflatingOutputStream deflater(buffer, DeflatingStreamBuf::STREAM_GZIP);
+		deflater.close();
+		InflatingInputStream inflater(buffer, InflatingStreamBuf::STREAM_GZIP);
+		std::stringstream inflated;
+		StreamCopier::copyStream(inflater, inflated);
+		assert (inflated.str().empty());
+	}
+}
+
+
 void ZLibTest::setUp()
 {
 }
@@ -196,6 +244,7 @@ CppUnit::Test* ZLibTest::suite()
 	CppUnit_addTest(pSuite, ZLibTest, testGzip1);
 	CppUnit_addTest(pSuite, ZLibTest, testGzip2);
 	CppUnit_addTest(pSuite, ZLibTest, testGzip3);
+	CppUnit_addTest(pSuite, ZLibTest, testParallelDeflate);
 
 	return pSuite;
 }
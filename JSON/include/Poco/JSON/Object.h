@@ -410,11 +410,7 @@ inline const Dynamic::Var& Object::getValue(ValueMap::const_iterator& it) const
 
 inline const Dynamic::Var& Object::getValue(KeyList::const_iterator& it) const
 {
-	ValueMap::const_iterator itv = _values.find((*it)->first);
-	if (itv != _values.end())
-		return itv->second;
-	else
-		throw Poco::NotFoundException();
+	return (*it)->second;
 }
 
 
@@ -0,0 +1,177 @@
+//
+// PullParser.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  PullParser
+//
+// Definition of the PullParser class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_PullParser_INCLUDED
+#define JSON_PullParser_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/JSONException.h"
+#include <string>
+#include <vector>
+
+
+struct json_stream;
+
+
+namespace Poco {
+namespace JSON {
+
+
+class JSON_API PullParser
+	/// A pull-style JSON parser.
+	///
+	/// In contrast to Parser, which builds a document or drives a
+	/// Handler, PullParser hands out one token at a time on request
+	/// and never allocates per value: string and number tokens are
+	/// exposed as (pointer, length) views into the parser's token
+	/// buffer, valid until the next call to next(). This allows
+	/// skimming very large documents (e.g. memory-mapped JSON-lines
+	/// files) for a few fields without building a DOM or copying
+	/// every string:
+	///
+	///    PullParser parser(data, size);
+	///    PullParser::TokenType token;
+	///    while ((token = parser.next()) != PullParser::TOKEN_DONE)
+	///    {
+	///        if (token == PullParser::TOKEN_KEY && parser.token() == "name")
+	///        {
+	///            // ...
+	///        }
+	///    }
+	///
+	/// The parser does not own the input buffer; the caller must keep
+	/// it alive for the lifetime of the PullParser.
+{
+public:
+	enum TokenType
+	{
+		TOKEN_DONE,         /// end of input reached
+		TOKEN_OBJECT_BEGIN, /// '{'
+		TOKEN_OBJECT_END,   /// '}'
+		TOKEN_ARRAY_BEGIN,  /// '['
+		TOKEN_ARRAY_END,    /// ']'
+		TOKEN_KEY,          /// an object member name
+		TOKEN_STRING,       /// a string value
+		TOKEN_NUMBER,       /// a number value (lexeme available as text)
+		TOKEN_TRUE,         /// the literal true
+		TOKEN_FALSE,        /// the literal false
+		TOKEN_NULL          /// the literal null
+	};
+
+	PullParser(const char* buffer, std::size_t size);
+		/// Creates the PullParser for the given buffer.
+		///
+		/// The buffer is not copied and must remain valid while
+		/// the parser is in use.
+
+	explicit PullParser(const std::string& json);
+		/// Creates the PullParser for the given string.
+		///
+		/// The string is not copied and must remain valid while
+		/// the parser is in use.
+
+	~PullParser();
+		/// Destroys the PullParser.
+
+	TokenType next();
+		/// Advances to the next token and returns its type.
+		///
+		/// Throws a JSONException if the input is not valid JSON.
+
+	const char* data() const;
+		/// Returns a pointer to the text of the current token.
+		///
+		/// For TOKEN_KEY and TOKEN_STRING this is the unescaped
+		/// string content, for TOKEN_NUMBER the number lexeme and
+		/// for the literals their spelling. The pointer is only
+		/// valid until the next call to next().
+
+	std::size_t size() const;
+		/// Returns the length of the current token text.
+
+	std::string token() const;
+		/// Returns a copy of the current token text.
+
+	Poco::Int64 asInteger() const;
+		/// Returns the current TOKEN_NUMBER as a signed integer.
+		///
+		/// Throws a SyntaxException if the token is not an
+		/// integral number.
+
+	double asNumber() const;
+		/// Returns the current TOKEN_NUMBER as a double.
+
+	std::size_t depth() const;
+		/// Returns the current nesting depth.
+
+	std::size_t line() const;
+		/// Returns the current line number in the input, starting at one.
+
+	void reset();
+		/// Resets the document state so that the next call to next()
+		/// parses the following document in the same buffer; used to
+		/// step through a sequence of concatenated documents, e.g. a
+		/// JSON-lines file.
+
+private:
+	PullParser();
+	PullParser(const PullParser&);
+	PullParser& operator = (const PullParser&);
+
+	void afterValue();
+		/// Records that a value has been consumed within the
+		/// enclosing container.
+
+	struct json_stream* _pJSON;
+	std::vector<char>   _containers;
+	bool                _expectKey;
+	const char*         _data;
+	std::size_t         _size;
+};
+
+
+//
+// inlines
+//
+inline const char* PullParser::data() const
+{
+	return _data;
+}
+
+
+inline std::size_t PullParser::size() const
+{
+	return _size;
+}
+
+
+inline std::string PullParser::token() const
+{
+	return std::string(_data, _size);
+}
+
+
+inline std::size_t PullParser::depth() const
+{
+	return _containers.size();
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_PullParser_INCLUDED
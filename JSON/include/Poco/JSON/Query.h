@@ -21,6 +21,7 @@
 #include "Poco/JSON/JSON.h"
 #include "Poco/JSON/Object.h"
 #include "Poco/JSON/Array.h"
+#include <vector>
 
 
 namespace Poco {
@@ -31,6 +32,39 @@ class JSON_API Query
 	/// Class that can be used to search for a value in a JSON object or array.
 {
 public:
+	class JSON_API Path
+		/// A pre-parsed query path.
+		///
+		/// Parsing a dot-separated path with array subscripts into
+		/// its segments is relatively expensive; when the same path
+		/// is evaluated against many documents, compile it once into
+		/// a Path and pass that to find() instead of the string.
+	{
+	public:
+		explicit Path(const std::string& path);
+			/// Creates the Path by parsing the given dot-separated
+			/// path string (e.g. "person.children[0].name").
+
+		const std::string& toString() const;
+			/// Returns the original path string.
+
+	private:
+		Path();
+
+		struct Segment
+		{
+			std::string      name;
+			std::vector<int> indexes;
+		};
+
+		std::vector<Segment> _segments;
+		std::string          _text;
+
+		friend class Query;
+	};
+
+	typedef std::vector<Path> PathVec;
+
 	Query(const Dynamic::Var& source);
 		/// Creates a Query/
 		///
@@ -85,6 +119,23 @@ public:
 		/// the name of the first child. When the value can't be found
 		/// an empty value is returned.
 
+	Dynamic::Var find(const Path& path) const;
+		/// Searches a value using a pre-parsed path.
+		///
+		/// Behaves like find(const std::string&), but does not
+		/// have to parse the path again.
+
+	Object::Ptr findObject(const Path& path) const;
+		/// Searches for an object using a pre-parsed path.
+
+	Array::Ptr findArray(const Path& path) const;
+		/// Searches for an array using a pre-parsed path.
+
+	void findAll(const PathVec& paths, std::vector<Dynamic::Var>& results) const;
+		/// Evaluates all given pre-parsed paths against the source
+		/// document in one call and fills results with one value per
+		/// path, in order. Values that can't be found are empty.
+
 	template<typename T>
 	T findValue(const std::string& path, const T& def) const
 		/// Searches for a value will convert it to the given type.
@@ -119,6 +170,15 @@ private:
 };
 
 
+//
+// inlines
+//
+inline const std::string& Query::Path::toString() const
+{
+	return _text;
+}
+
+
 } } // namespace Poco::JSON
 
 
@@ -23,6 +23,7 @@
 #include "Poco/Path.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/Logger.h"
+#include "Poco/Mutex.h"
 #include <vector>
 #include <map>
 
@@ -67,6 +68,17 @@ public:
 	void setLogger(Logger& logger);
 		/// Sets the logger for the cache.
 
+	std::size_t hits() const;
+		/// Returns the number of getTemplate() calls served
+		/// from the cache.
+
+	std::size_t misses() const;
+		/// Returns the number of getTemplate() calls that had
+		/// to load or reload a template.
+
+	void resetStatistics();
+		/// Resets the hit and miss counters.
+
 private:
 	void setup();
 	Path resolvePath(const Path& path) const;
@@ -75,6 +87,9 @@ private:
 	std::vector<Path>                    _includePaths;
 	std::map<std::string, Template::Ptr> _cache;
 	Logger*                              _pLogger;
+	std::size_t                          _hits;
+	std::size_t                          _misses;
+	mutable Poco::FastMutex              _mutex;
 };
 
 
@@ -99,6 +114,31 @@ inline void TemplateCache::setLogger(Logger& logger)
 }
 
 
+inline std::size_t TemplateCache::hits() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _hits;
+}
+
+
+inline std::size_t TemplateCache::misses() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _misses;
+}
+
+
+inline void TemplateCache::resetStatistics()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_hits = 0;
+	_misses = 0;
+}
+
+
 } } // namespace Poco::JSON
 
 
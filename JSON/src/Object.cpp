@@ -188,14 +188,9 @@ void Object::stringify(std::ostream& out, unsigned int indent, int step) const
 
 const std::string& Object::getKey(KeyList::const_iterator& iter) const
 {
-	ValueMap::const_iterator it = _values.begin();
-	ValueMap::const_iterator end = _values.end();
-	for (; it != end; ++it)
-	{
-		if (it == *iter) return it->first;
-	}
-
-	throw NotFoundException((*iter)->first);
+	// the stored map iterators remain valid for the lifetime of the
+	// entry, so the key can be returned directly
+	return (*iter)->first;
 }
 
 
@@ -203,14 +198,10 @@ void Object::set(const std::string& key, const Dynamic::Var& value)
 {
 	std::pair<ValueMap::iterator, bool> ret = _values.insert(ValueMap::value_type(key, value));
 	if (!ret.second) ret.first->second = value;
-	if (_preserveInsOrder)
+	else if (_preserveInsOrder)
 	{
-		KeyList::iterator it = _keys.begin();
-		KeyList::iterator end = _keys.end();
-		for (; it != end; ++it)
-		{
-			if (key == (*it)->first) return;
-		}
+		// the map insert already determined that the key is new,
+		// so there is no need to scan _keys for a duplicate
 		_keys.push_back(ret.first);
 	}
 	_modified = true;
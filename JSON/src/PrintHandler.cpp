@@ -14,6 +14,7 @@
 
 #include "Poco/JSON/PrintHandler.h"
 #include "Poco/JSON/Stringifier.h"
+#include "Poco/NumberFormatter.h"
 #include <iostream>
 
 
@@ -141,7 +142,7 @@ void PrintHandler::null()
 void PrintHandler::value(int v)
 {
 	arrayValue();
-	_out << v;
+	_out << NumberFormatter::format(v);
 	_objStart = false;
 }
 
@@ -149,7 +150,7 @@ void PrintHandler::value(int v)
 void PrintHandler::value(unsigned v)
 {
 	arrayValue();
-	_out << v;
+	_out << NumberFormatter::format(v);
 	_objStart = false;
 }
 
@@ -158,7 +159,7 @@ void PrintHandler::value(unsigned v)
 void PrintHandler::value(Int64 v)
 {
 	arrayValue();
-	_out << v;
+	_out << NumberFormatter::format(v);
 	_objStart = false;
 }
 
@@ -166,7 +167,7 @@ void PrintHandler::value(Int64 v)
 void PrintHandler::value(UInt64 v)
 {
 	arrayValue();
-	_out << v;
+	_out << NumberFormatter::format(v);
 	_objStart = false;
 }
 #endif
@@ -183,7 +184,7 @@ void PrintHandler::value(const std::string& value)
 void PrintHandler::value(double d)
 {
 	arrayValue();
-	_out << d;
+	_out << NumberFormatter::format(d);
 	_objStart = false;
 }
 
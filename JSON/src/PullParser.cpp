@@ -0,0 +1,155 @@
+//
+// PullParser.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  PullParser
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/PullParser.h"
+#include "Poco/NumberParser.h"
+#include "pdjson.h"
+
+
+typedef struct json_stream json_stream;
+
+
+namespace Poco {
+namespace JSON {
+
+
+PullParser::PullParser(const char* buffer, std::size_t size):
+	_pJSON(new json_stream),
+	_expectKey(false),
+	_data(""),
+	_size(0)
+{
+	json_open_buffer(_pJSON, buffer, size);
+}
+
+
+PullParser::PullParser(const std::string& json):
+	_pJSON(new json_stream),
+	_expectKey(false),
+	_data(""),
+	_size(0)
+{
+	json_open_buffer(_pJSON, json.data(), json.size());
+}
+
+
+PullParser::~PullParser()
+{
+	json_close(_pJSON);
+	delete _pJSON;
+}
+
+
+PullParser::TokenType PullParser::next()
+{
+	std::size_t length = 0;
+
+	_data = "";
+	_size = 0;
+
+	switch (json_next(_pJSON))
+	{
+	case JSON_DONE:
+		return TOKEN_DONE;
+	case JSON_OBJECT:
+		_containers.push_back('O');
+		_expectKey = true;
+		return TOKEN_OBJECT_BEGIN;
+	case JSON_OBJECT_END:
+		_containers.pop_back();
+		afterValue();
+		return TOKEN_OBJECT_END;
+	case JSON_ARRAY:
+		_containers.push_back('A');
+		return TOKEN_ARRAY_BEGIN;
+	case JSON_ARRAY_END:
+		_containers.pop_back();
+		afterValue();
+		return TOKEN_ARRAY_END;
+	case JSON_STRING:
+		_data = json_get_string(_pJSON, &length);
+		_size = length > 0 ? length - 1 : 0; // length includes the terminating zero
+		if (!_containers.empty() && _containers.back() == 'O' && _expectKey)
+		{
+			_expectKey = false;
+			return TOKEN_KEY;
+		}
+		afterValue();
+		return TOKEN_STRING;
+	case JSON_NUMBER:
+		_data = json_get_string(_pJSON, &length);
+		_size = length > 0 ? length - 1 : 0;
+		afterValue();
+		return TOKEN_NUMBER;
+	case JSON_TRUE:
+		_data = "true";
+		_size = 4;
+		afterValue();
+		return TOKEN_TRUE;
+	case JSON_FALSE:
+		_data = "false";
+		_size = 5;
+		afterValue();
+		return TOKEN_FALSE;
+	case JSON_NULL:
+		_data = "null";
+		_size = 4;
+		afterValue();
+		return TOKEN_NULL;
+	case JSON_ERROR:
+	default:
+		{
+			const char* pErr = json_get_error(_pJSON);
+			throw JSONException(pErr ? pErr : "JSON parser error.");
+		}
+	}
+}
+
+
+Poco::Int64 PullParser::asInteger() const
+{
+	return NumberParser::parse64(token());
+}
+
+
+double PullParser::asNumber() const
+{
+	return NumberParser::parseFloat(token());
+}
+
+
+std::size_t PullParser::line() const
+{
+	return json_get_lineno(_pJSON);
+}
+
+
+void PullParser::reset()
+{
+	json_reset(_pJSON);
+	_containers.clear();
+	_expectKey = false;
+	_data = "";
+	_size = 0;
+}
+
+
+void PullParser::afterValue()
+{
+	if (!_containers.empty() && _containers.back() == 'O')
+		_expectKey = true;
+}
+
+
+} } // namespace Poco::JSON
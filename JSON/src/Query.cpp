@@ -14,8 +14,8 @@
 
 #include "Poco/JSON/Query.h"
 #include "Poco/StringTokenizer.h"
-#include "Poco/RegularExpression.h"
 #include "Poco/NumberParser.h"
+#include "Poco/Ascii.h"
 #include <sstream>
 
 
@@ -26,6 +26,53 @@ namespace Poco {
 namespace JSON {
 
 
+Query::Path::Path(const std::string& path):
+	_text(path)
+{
+	StringTokenizer tokenizer(path, ".");
+	for (StringTokenizer::Iterator token = tokenizer.begin(); token != tokenizer.end(); ++token)
+	{
+		Segment segment;
+		std::string::size_type firstOffset = std::string::npos;
+		std::string::size_type pos = 0;
+		while ((pos = token->find('[', pos)) != std::string::npos)
+		{
+			std::string::size_type close = token->find(']', pos + 1);
+			if (close == std::string::npos || close == pos + 1)
+			{
+				++pos;
+				continue;
+			}
+			bool digits = true;
+			for (std::string::size_type i = pos + 1; i < close; ++i)
+			{
+				if (!Ascii::isDigit((*token)[i]))
+				{
+					digits = false;
+					break;
+				}
+			}
+			if (!digits)
+			{
+				++pos;
+				continue;
+			}
+			if (firstOffset == std::string::npos) firstOffset = pos;
+			segment.indexes.push_back(NumberParser::parse(token->substr(pos + 1, close - pos - 1)));
+			pos = close + 1;
+		}
+
+		segment.name = *token;
+		if (firstOffset != std::string::npos)
+		{
+			segment.name = segment.name.substr(0, firstOffset);
+		}
+
+		_segments.push_back(segment);
+	}
+}
+
+
 Query::Query(const Var& source): _source(source)
 {
 	if (!source.isEmpty() &&
@@ -98,56 +145,66 @@ Array& Query::findArray(const std::string& path, Array& arr) const
 }
 
 
+Object::Ptr Query::findObject(const Path& path) const
+{
+	Var result = find(path);
+
+	if (result.type() == typeid(Object::Ptr))
+		return result.extract<Object::Ptr>();
+	else if (result.type() == typeid(Object))
+		return new Object(result.extract<Object>());
+
+	return 0;
+}
+
+
+Array::Ptr Query::findArray(const Path& path) const
+{
+	Var result = find(path);
+
+	if (result.type() == typeid(Array::Ptr))
+		return result.extract<Array::Ptr>();
+	else if (result.type() == typeid(Array))
+		return new Array(result.extract<Array>());
+
+	return 0;
+}
+
+
 Var Query::find(const std::string& path) const
+{
+	return find(Path(path));
+}
+
+
+Var Query::find(const Path& path) const
 {
 	Var result = _source;
-	StringTokenizer tokenizer(path, ".");
-	for (StringTokenizer::Iterator token = tokenizer.begin(); token != tokenizer.end(); token++)
+	std::vector<Path::Segment>::const_iterator segment = path._segments.begin();
+	std::vector<Path::Segment>::const_iterator end = path._segments.end();
+	for (; segment != end; ++segment)
 	{
 		if (!result.isEmpty())
 		{
-			std::vector<int> indexes;
-			RegularExpression::MatchVec matches;
-			int firstOffset = -1;
-			int offset = 0;
-			RegularExpression regex("\\[([0-9]+)\\]");
-			while (regex.match(*token, offset, matches) > 0)
-			{
-				if (firstOffset == -1)
-				{
-					firstOffset = static_cast<int>(matches[0].offset);
-				}
-				std::string num = token->substr(matches[1].offset, matches[1].length);
-				indexes.push_back(NumberParser::parse(num));
-				offset = static_cast<int>(matches[0].offset + matches[0].length);
-			}
-
-			std::string name(*token);
-			if (firstOffset != -1)
-			{
-				name = name.substr(0, firstOffset);
-			}
-
-			if (name.length() > 0)
+			if (segment->name.length() > 0)
 			{
 				if (result.type() == typeid(Object::Ptr))
 				{
 					Object::Ptr o = result.extract<Object::Ptr>();
-					result = o->get(name);
+					result = o->get(segment->name);
 				}
 				else if (result.type() == typeid(Object))
 				{
 					Object o = result.extract<Object>();
-					result = o.get(name);
+					result = o.get(segment->name);
 				}
 				else
 					result.empty();
-
 			}
 
-			if (!result.isEmpty() && !indexes.empty())
+			if (!result.isEmpty() && !segment->indexes.empty())
 			{
-				for (std::vector<int>::iterator it = indexes.begin(); it != indexes.end(); ++it)
+				for (std::vector<int>::const_iterator it = segment->indexes.begin(); it != segment->indexes.end(); ++it)
 				{
 					if (result.type() == typeid(Array::Ptr))
 					{
@@ -169,4 +226,15 @@ Var Query::find(const std::string& path) const
 }
 
 
+void Query::findAll(const PathVec& paths, std::vector<Var>& results) const
+{
+	results.clear();
+	results.reserve(paths.size());
+	for (PathVec::const_iterator it = paths.begin(); it != paths.end(); ++it)
+	{
+		results.push_back(find(*it));
+	}
+}
+
+
 } } // namespace Poco::JSON
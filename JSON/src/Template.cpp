@@ -114,6 +114,8 @@ class EchoPart: public Part
 {
 public:
 	EchoPart(const std::string& query): Part(), _query(query)
+		/// The query path is compiled once here, so that rendering
+		/// does not have to parse it again.
 	{
 	}
 
@@ -133,14 +135,14 @@ public:
 	}
 
 private:
-	std::string _query;
+	Query::Path _query;
 };
 
 
 class LogicQuery
 {
 public:
-	LogicQuery(const std::string& query): _queryString(query)
+	LogicQuery(const std::string& query): _queryPath(query)
 	{
 	}
 
@@ -153,7 +155,7 @@ public:
 		bool logic = false;
 
 		Query query(data);
-		Var value = query.find(_queryString);
+		Var value = query.find(_queryPath);
 
 		if (!value.isEmpty()) // When empty, logic will be false
 		{
@@ -177,7 +179,7 @@ public:
 	}
 
 protected:
-	std::string _queryString;
+	Query::Path _queryPath;
 };
 
 
@@ -195,7 +197,7 @@ public:
 	virtual bool apply(const Var& data) const
 	{
 		Query query(data);
-		Var value = query.find(_queryString);
+		Var value = query.find(_queryPath);
 
 		return !value.isEmpty();
 	}
@@ -295,7 +297,7 @@ public:
 
 private:
 	std::string _name;
-	std::string _query;
+	Query::Path _query;
 };
 
 
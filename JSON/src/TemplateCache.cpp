@@ -23,7 +23,7 @@ namespace JSON {
 TemplateCache* TemplateCache::_pInstance = 0;
 
 
-TemplateCache::TemplateCache(): _pLogger(0)
+TemplateCache::TemplateCache(): _pLogger(0), _hits(0), _misses(0)
 {
 	setup();
 }
@@ -61,9 +61,12 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 
 	Template::Ptr tpl;
 
+	FastMutex::ScopedLock lock(_mutex);
+
 	std::map<std::string, Template::Ptr>::iterator it = _cache.find(templatePathname);
 	if (it == _cache.end())
 	{
+		++_misses;
 		if (templateFile.exists())
 		{
 			if (_pLogger)
@@ -100,6 +103,7 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 		tpl = it->second;
 		if (tpl->parseTime() < templateFile.getLastModified())
 		{
+			++_misses;
 			if (_pLogger)
 			{
 				poco_information_f1(*_pLogger, "Reloading template %s", templatePath.toString());
@@ -120,6 +124,10 @@ Template::Ptr TemplateCache::getTemplate(const Path& path)
 				}
 			}
 		}
+		else
+		{
+			++_hits;
+		}
 	}
 
 	return tpl;
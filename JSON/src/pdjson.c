@@ -192,6 +192,27 @@ static int init_string(json_stream *json)
     return 0;
 }
 
+static int pushchars(json_stream *json, const char *buffer, size_t length)
+{
+    size_t need = json->data.string_fill + length;
+    if (need > json->data.string_size) {
+        size_t size = json->data.string_size;
+        char *string;
+        while (size < need)
+            size *= 2;
+        string = (char *) json->alloc.realloc(json->data.string, size);
+        if (string == NULL) {
+            json_error_s(json, errno);
+            return -1;
+        }
+        json->data.string_size = size;
+        json->data.string = string;
+    }
+    memcpy(json->data.string + json->data.string_fill, buffer, length);
+    json->data.string_fill += length;
+    return 0;
+}
+
 static int encode_utf8(json_stream *json, unsigned long c)
 {
     if (c < 0x80UL) {
@@ -483,13 +504,73 @@ read_utf8(json_stream* json, int next_char)
     return 0;
 }
 
+typedef unsigned long long json_word;
+
+#define JSON_WORD_ONES ((json_word) 0x0101010101010101ULL)
+#define JSON_WORD_HIGH ((json_word) 0x8080808080808080ULL)
+
+/* Returns non-zero if any byte of w is a control character, a quote,
+ * a backslash or has the high bit set, i.e. needs to go through the
+ * byte-wise string loop. */
+static json_word
+word_has_special(json_word w)
+{
+    json_word quotes  = w ^ (JSON_WORD_ONES * 0x22);
+    json_word slashes = w ^ (JSON_WORD_ONES * 0x5c);
+    json_word special = (w - JSON_WORD_ONES * 0x20) & ~w;
+    special |= (quotes - JSON_WORD_ONES) & ~quotes;
+    special |= (slashes - JSON_WORD_ONES) & ~slashes;
+    return (special | w) & JSON_WORD_HIGH;
+}
+
+/* Consumes the longest run of plain string bytes available in a buffer
+ * source, a word at a time, and appends it to the data string in one
+ * piece. Quotes, escapes, control and non-ASCII bytes are left to the
+ * byte-wise loop in read_string(). */
+static int
+read_string_run(json_stream *json)
+{
+    struct json_source *source = &json->source;
+    const char *buffer = source->source.buffer.buffer;
+    size_t end = source->source.buffer.length;
+    size_t start = source->position;
+    size_t pos = start;
+
+    while (pos + sizeof(json_word) <= end) {
+        json_word w;
+        memcpy(&w, buffer + pos, sizeof(w));
+        if (word_has_special(w))
+            break;
+        pos += sizeof(w);
+    }
+
+    while (pos < end) {
+        unsigned char u = (unsigned char) buffer[pos];
+        if (u < 0x20 || u == 0x22 || u == 0x5c || u >= 0x80)
+            break;
+        pos++;
+    }
+
+    if (pos > start) {
+        if (pushchars(json, buffer + start, pos - start) != 0)
+            return -1;
+        source->position = pos;
+    }
+
+    return 0;
+}
+
 static enum json_type
 read_string(json_stream *json)
 {
+    int buffered = json->source.peek == buffer_peek;
     if (init_string(json) != 0)
         return JSON_ERROR;
     while (1) {
-        int c = json->source.get(&json->source);
+        int c;
+        if (buffered && read_string_run(json) != 0)
+            return JSON_ERROR;
+        c = json->source.get(&json->source);
         if (c == EOF) {
             json_error(json, "%s", "unterminated string literal");
             return JSON_ERROR;
@@ -527,6 +608,23 @@ static int
 read_digits(json_stream *json)
 {
     unsigned nread = 0;
+    if (json->source.peek == buffer_peek) {
+        /* consume the whole run of digits from the buffer in one piece
+         * instead of one get()/peek() round trip per digit */
+        struct json_source *source = &json->source;
+        const char *buffer = source->source.buffer.buffer;
+        size_t end = source->source.buffer.length;
+        size_t start = source->position;
+        size_t pos = start;
+        while (pos < end && is_digit((unsigned char) buffer[pos]))
+            pos++;
+        if (pos > start) {
+            if (pushchars(json, buffer + start, pos - start) != 0)
+                return -1;
+            source->position = pos;
+            nread += (unsigned) (pos - start);
+        }
+    }
     while (is_digit(json->source.peek(&json->source))) {
         if (pushchar(json, json->source.get(&json->source)) != 0)
             return -1;
@@ -620,6 +718,18 @@ json_isspace(int c)
 static int next(json_stream *json)
 {
    int c;
+   if (json->source.peek == buffer_peek) {
+       /* skip runs of whitespace directly in the buffer */
+       struct json_source *source = &json->source;
+       const char *buffer = source->source.buffer.buffer;
+       size_t end = source->source.buffer.length;
+       while (source->position < end
+              && json_isspace((unsigned char) buffer[source->position])) {
+           if (buffer[source->position] == '\n')
+               json->lineno++;
+           source->position++;
+       }
+   }
    while (json_isspace(c = json->source.get(&json->source)))
        if (c == '\n')
            json->lineno++;
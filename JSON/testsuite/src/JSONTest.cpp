@@ -1201,6 +1201,24 @@ void JSONTest::testQuery()
 		fail ("must throw");
 	}
 	catch (Poco::InvalidArgumentException&) { }
+
+	Query::Path streetPath("address.street");
+	assert (streetPath.toString() == "address.street");
+	assert (query.find(streetPath).convert<std::string>() == "A Street");
+
+	Query::Path childPath("children[1]");
+	assert (query.find(childPath).convert<std::string>() == "Ellen");
+
+	Query::PathVec paths;
+	paths.push_back(streetPath);
+	paths.push_back(childPath);
+	paths.push_back(Query::Path("no.such.path"));
+	std::vector<Var> values;
+	query.findAll(paths, values);
+	assert (values.size() == 3);
+	assert (values[0].convert<std::string>() == "A Street");
+	assert (values[1].convert<std::string>() == "Ellen");
+	assert (values[2].isEmpty());
 }
 
 
@@ -1360,6 +1378,68 @@ void JSONTest::testPrintHandler()
 }
 
 
+void JSONTest::testPullParser()
+{
+	std::string json = "{ \"name\" : \"Homer\", \"age\" : 38, \"bald\" : true, \"pets\" : [ \"dog\", null ], \"weight\" : 85.5 }";
+	PullParser parser(json);
+	assert (parser.next() == PullParser::TOKEN_OBJECT_BEGIN);
+	assert (parser.depth() == 1);
+	assert (parser.next() == PullParser::TOKEN_KEY);
+	assert (parser.token() == "name");
+	assert (parser.next() == PullParser::TOKEN_STRING);
+	assert (parser.token() == "Homer");
+	assert (parser.next() == PullParser::TOKEN_KEY);
+	assert (parser.token() == "age");
+	assert (parser.next() == PullParser::TOKEN_NUMBER);
+	assert (parser.asInteger() == 38);
+	assert (parser.next() == PullParser::TOKEN_KEY);
+	assert (parser.token() == "bald");
+	assert (parser.next() == PullParser::TOKEN_TRUE);
+	assert (parser.next() == PullParser::TOKEN_KEY);
+	assert (parser.token() == "pets");
+	assert (parser.next() == PullParser::TOKEN_ARRAY_BEGIN);
+	assert (parser.depth() == 2);
+	assert (parser.next() == PullParser::TOKEN_STRING);
+	assert (parser.token() == "dog");
+	assert (parser.next() == PullParser::TOKEN_NULL);
+	assert (parser.next() == PullParser::TOKEN_ARRAY_END);
+	assert (parser.next() == PullParser::TOKEN_KEY);
+	assert (parser.token() == "weight");
+	assert (parser.next() == PullParser::TOKEN_NUMBER);
+	assert (parser.asNumber() == 85.5);
+	assert (parser.next() == PullParser::TOKEN_OBJECT_END);
+	assert (parser.depth() == 0);
+	assert (parser.next() == PullParser::TOKEN_DONE);
+
+	std::string lines = "{\"a\":1}\n{\"a\":2}\n";
+	PullParser lineParser(lines.data(), lines.size());
+	assert (lineParser.next() == PullParser::TOKEN_OBJECT_BEGIN);
+	assert (lineParser.next() == PullParser::TOKEN_KEY);
+	assert (lineParser.next() == PullParser::TOKEN_NUMBER);
+	assert (lineParser.asInteger() == 1);
+	assert (lineParser.next() == PullParser::TOKEN_OBJECT_END);
+	assert (lineParser.next() == PullParser::TOKEN_DONE);
+	lineParser.reset();
+	assert (lineParser.next() == PullParser::TOKEN_OBJECT_BEGIN);
+	assert (lineParser.next() == PullParser::TOKEN_KEY);
+	assert (lineParser.next() == PullParser::TOKEN_NUMBER);
+	assert (lineParser.asInteger() == 2);
+	assert (lineParser.next() == PullParser::TOKEN_OBJECT_END);
+	assert (lineParser.next() == PullParser::TOKEN_DONE);
+
+	try
+	{
+		std::string bad = "{ \"a\" ";
+		PullParser badParser(bad);
+		while (badParser.next() != PullParser::TOKEN_DONE);
+		fail ("invalid JSON must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
 void JSONTest::testStringify()
 {
 	std::ostringstream os;
@@ -2200,6 +2280,7 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testQuery);
 	CppUnit_addTest(pSuite, JSONTest, testComment);
 	CppUnit_addTest(pSuite, JSONTest, testPrintHandler);
+	CppUnit_addTest(pSuite, JSONTest, testPullParser);
 	CppUnit_addTest(pSuite, JSONTest, testStringify);
 	CppUnit_addTest(pSuite, JSONTest, testStringifyPreserveOrder);
 	CppUnit_addTest(pSuite, JSONTest, testValidJanssonFiles);
@@ -23,6 +23,7 @@
 #include "Poco/JSON/Stringifier.h"
 #include "Poco/JSON/ParseHandler.h"
 #include "Poco/JSON/PrintHandler.h"
+#include "Poco/JSON/PullParser.h"
 #include "Poco/JSON/Template.h"
 #include <sstream>
 
@@ -66,6 +67,7 @@ public:
 	void testQuery();
 	void testComment();
 	void testPrintHandler();
+	void testPullParser();
 	void testStringify();
 	void testStringifyPreserveOrder();
 
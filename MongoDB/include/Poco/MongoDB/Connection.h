@@ -23,6 +23,7 @@
 #include "Poco/Mutex.h"
 #include "Poco/MongoDB/RequestMessage.h"
 #include "Poco/MongoDB/ResponseMessage.h"
+#include <vector>
 
 
 namespace Poco {
@@ -140,12 +141,53 @@ public:
 		/// Use this when a response is expected: only a "query" or "getmore"
 		/// request will return a response.
 
+	void sendRequests(std::vector<RequestMessage::Ptr>& requests);
+		/// Sends all requests to the MongoDB server in a single write.
+		///
+		/// Use this to batch one-way write requests (insert, update,
+		/// delete): a batch costs one syscall instead of one per request.
+
+	void sendRequests(std::vector<RequestMessage::Ptr>& requests, ResponseMessage& response);
+		/// Sends all requests to the MongoDB server in a single write and
+		/// receives a single response.
+		///
+		/// The last request must be one that returns a response (typically
+		/// a getLastError command piggybacked onto a batch of writes to
+		/// obtain the write concern result with the same round trip).
+
+	void readResponse(ResponseMessage& response);
+		/// Reads a response for a previously sent request.
+		///
+		/// Use this together with the one-way sendRequest() to pipeline a
+		/// request and read its reply later, as the prefetching Cursor does.
+
+	bool negotiateCompression();
+		/// Negotiates zlib wire compression with the server by sending an
+		/// isMaster handshake advertising the zlib compressor.
+		///
+		/// When the server supports it, all subsequent requests and
+		/// responses on this connection are exchanged as OP_COMPRESSED
+		/// messages. Returns true when compression is enabled.
+
+	void setCompression(bool flag);
+		/// Enables or disables zlib wire compression without negotiating.
+		///
+		/// The server must have been configured with the zlib network
+		/// compressor; use negotiateCompression() when unsure.
+
+	bool isCompressed() const;
+		/// Returns true when wire compression is enabled.
+
 protected:
 	void connect();
 
 private:
+	void writeRequest(RequestMessage& request, std::ostream& ostr);
+		/// Writes the request to the stream, compressed when enabled.
+
 	Poco::Net::SocketAddress _address;
 	Poco::Net::StreamSocket _socket;
+	bool _compressed;
 };
 
 
@@ -158,6 +200,18 @@ inline Net::SocketAddress Connection::address() const
 }
 
 
+inline void Connection::setCompression(bool flag)
+{
+	_compressed = flag;
+}
+
+
+inline bool Connection::isCompressed() const
+{
+	return _compressed;
+}
+
+
 } } // namespace Poco::MongoDB
 
 
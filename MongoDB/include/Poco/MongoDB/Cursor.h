@@ -53,9 +53,30 @@ public:
 	void kill(Connection& connection);
 		/// Kills the cursor and reset it so that it can be reused.
 
+	void setPrefetch(bool prefetch);
+		/// Enables or disables prefetching (disabled by default).
+		///
+		/// With prefetching enabled, next() fires the getMore for the
+		/// following batch before returning the current one, so the server
+		/// builds the next batch while the caller processes the current
+		/// documents instead of alternating between network wait and
+		/// processing.
+		///
+		/// While a prefetched batch is outstanding, no other requests must
+		/// be sent over the connection, and next() or kill() must be called
+		/// with the same connection.
+
+	bool prefetch() const;
+		/// Returns true when prefetching is enabled.
+
+	void setBatchSize(Int32 batchSize);
+		/// Sets the number of documents to return per batch.
+
 private:
 	QueryRequest    _query;
 	ResponseMessage _response;
+	bool            _prefetch;
+	bool            _pending;
 };
 
 
@@ -68,6 +89,24 @@ inline QueryRequest& Cursor::query()
 }
 
 
+inline void Cursor::setPrefetch(bool prefetch)
+{
+	_prefetch = prefetch;
+}
+
+
+inline bool Cursor::prefetch() const
+{
+	return _prefetch;
+}
+
+
+inline void Cursor::setBatchSize(Int32 batchSize)
+{
+	_query.setNumberToReturn(batchSize);
+}
+
+
 } } // namespace Poco::MongoDB
 
 
@@ -102,6 +102,13 @@ public:
 		/// Sends the getLastError command to the database and returns the err element
 		/// from the error document. When err is null, an empty string is returned.
 
+	Document::Ptr sendWriteBatch(Connection& connection, std::vector<RequestMessage::Ptr>& requests) const;
+		/// Sends the given write requests (insert, update, delete) and a
+		/// getLastError command to the server in a single write, so a whole
+		/// batch of writes costs one round trip including the write concern.
+		///
+		/// The document returned is the result of the getLastError call.
+
 	static const std::string AUTH_MONGODB_CR;
 		/// Default authentication mechanism prior to MongoDB 3.0.
 		
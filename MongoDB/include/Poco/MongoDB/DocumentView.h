@@ -0,0 +1,164 @@
+//
+// DocumentView.h
+//
+// Library: MongoDB
+// Package: MongoDB
+// Module:  DocumentView
+//
+// Definition of the DocumentView class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef MongoDB_DocumentView_INCLUDED
+#define MongoDB_DocumentView_INCLUDED
+
+
+#include "Poco/MongoDB/MongoDB.h"
+#include "Poco/MongoDB/Document.h"
+
+
+namespace Poco {
+namespace MongoDB {
+
+
+class MongoDB_API DocumentView
+	/// A read-only view on a raw BSON document buffer.
+	///
+	/// Unlike Document::read(), which materializes every element as a
+	/// heap-allocated Element, a DocumentView only scans the buffer and
+	/// decodes the fields that are actually asked for. Use it when only
+	/// a few fields of a large document are read; use toDocument() when
+	/// the whole document is retained.
+	///
+	/// The view does not copy or own the buffer; the buffer must stay
+	/// alive and unchanged for the lifetime of the view and of any view
+	/// obtained from it with getView().
+	///
+	/// Supported element types for get() are double, Int32, Int64,
+	/// bool and std::string; embedded documents and arrays are accessed
+	/// as sub-views with getView().
+{
+public:
+	DocumentView();
+		/// Creates an empty DocumentView.
+
+	DocumentView(const char* data, std::size_t size);
+		/// Creates a DocumentView for the given BSON buffer.
+		/// The buffer is not copied.
+
+	explicit DocumentView(const std::string& buffer);
+		/// Creates a DocumentView for the given BSON buffer.
+		/// The buffer is not copied.
+
+	bool empty() const;
+		/// Returns true when the view contains no elements.
+
+	bool exists(const std::string& name) const;
+		/// Returns true when the document has an element with the given name.
+
+	template<typename T>
+	T get(const std::string& name) const;
+		/// Returns the element with the given name decoded as the template
+		/// type. When the element is not found, a NotFoundException will be
+		/// thrown. When the element has another type a BadCastException
+		/// will be thrown.
+
+	template<typename T>
+	T get(const std::string& name, const T& def) const;
+		/// Returns the element with the given name decoded as the template
+		/// type. When the element is not found, or has the wrong type, the
+		/// def argument will be returned.
+
+	Int64 getInteger(const std::string& name) const;
+		/// Returns an integer. Useful when MongoDB returns Int32, Int64
+		/// or double for a number (count for example). When the element
+		/// is not found, a Poco::NotFoundException will be thrown.
+
+	DocumentView getView(const std::string& name) const;
+		/// Returns a sub-view for the embedded document or array with the
+		/// given name. When the element is not found, a NotFoundException
+		/// will be thrown.
+
+	bool isType(const std::string& name, unsigned char typeId) const;
+		/// Returns true when the element with the given name has the
+		/// given BSON type id.
+
+	Document::Ptr toDocument() const;
+		/// Materializes the view into a Document. Use this when the
+		/// decoded document outlives the underlying buffer.
+
+	const char* data() const;
+		/// Returns a pointer to the raw BSON buffer.
+
+	std::size_t size() const;
+		/// Returns the size of the raw BSON buffer.
+
+private:
+	bool find(const std::string& name, unsigned char& type, const char*& value, std::size_t& avail) const;
+		/// Scans the buffer for the element with the given name. Returns
+		/// true and the element's type and value location when found.
+
+	static std::size_t valueSize(unsigned char type, const char* value, std::size_t avail);
+		/// Returns the encoded size of a value of the given type, so it
+		/// can be skipped without decoding it.
+
+	const char* _data;
+	std::size_t _size;
+};
+
+
+//
+// inlines
+//
+inline const char* DocumentView::data() const
+{
+	return _data;
+}
+
+
+inline std::size_t DocumentView::size() const
+{
+	return _size;
+}
+
+
+template<>
+double DocumentView::get<double>(const std::string& name) const;
+
+template<>
+Int32 DocumentView::get<Int32>(const std::string& name) const;
+
+template<>
+Int64 DocumentView::get<Int64>(const std::string& name) const;
+
+template<>
+bool DocumentView::get<bool>(const std::string& name) const;
+
+template<>
+std::string DocumentView::get<std::string>(const std::string& name) const;
+
+template<>
+double DocumentView::get<double>(const std::string& name, const double& def) const;
+
+template<>
+Int32 DocumentView::get<Int32>(const std::string& name, const Int32& def) const;
+
+template<>
+Int64 DocumentView::get<Int64>(const std::string& name, const Int64& def) const;
+
+template<>
+bool DocumentView::get<bool>(const std::string& name, const bool& def) const;
+
+template<>
+std::string DocumentView::get<std::string>(const std::string& name, const std::string& def) const;
+
+
+} } // namespace Poco::MongoDB
+
+
+#endif // MongoDB_DocumentView_INCLUDED
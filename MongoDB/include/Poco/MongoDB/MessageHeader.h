@@ -42,7 +42,8 @@ public:
 		OP_QUERY = 2004,
 		OP_GET_MORE = 2005,
 		OP_DELETE = 2006,
-		OP_KILL_CURSORS = 2007
+		OP_KILL_CURSORS = 2007,
+		OP_COMPRESSED = 2012
 	};
 
 	explicit MessageHeader(OpCode);
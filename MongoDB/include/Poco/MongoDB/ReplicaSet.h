@@ -20,6 +20,7 @@
 
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/MongoDB/Connection.h"
+#include "Poco/Mutex.h"
 #include <vector>
 
 
@@ -29,8 +30,37 @@ namespace MongoDB {
 
 class MongoDB_API ReplicaSet
 	/// Class for working with a MongoDB replica set.
+	///
+	/// Besides locating the master (findMaster()), the ReplicaSet keeps a
+	/// cached view of the topology: refresh() probes every node with an
+	/// isMaster command over a pooled per-node connection, learns about
+	/// nodes from the returned hosts list, and tracks a smoothed
+	/// round-trip time per node. findConnection() then routes by read
+	/// preference, so reads can be served by the nearest secondary
+	/// instead of a remote primary.
 {
 public:
+	enum ReadPreference
+	{
+		PRIMARY,
+			/// Read from the primary only.
+
+		PRIMARY_PREFERRED,
+			/// Read from the primary; fall back to the nearest
+			/// secondary when no primary is available.
+
+		SECONDARY,
+			/// Read from the nearest secondary only.
+
+		SECONDARY_PREFERRED,
+			/// Read from the nearest secondary; fall back to the
+			/// primary when no secondary is available.
+
+		NEAREST
+			/// Read from the node with the lowest round-trip time,
+			/// primary or secondary.
+	};
+
 	explicit ReplicaSet(const std::vector<Net::SocketAddress>& addresses);
 		/// Creates the ReplicaSet using the given server addresses.
 
@@ -44,11 +74,60 @@ public:
 		/// Returns the Connection to the master, or null if no master
 		/// instance was found.
 
+	Connection::Ptr findConnection(ReadPreference preference = PRIMARY);
+		/// Returns a pooled connection to a node honoring the given read
+		/// preference, or null when no suitable node is available.
+		///
+		/// The topology cache is built on first use; call refresh()
+		/// periodically to keep member roles and round-trip times
+		/// current. The returned connection is shared: it stays owned by
+		/// the ReplicaSet and must not be used from multiple threads at
+		/// once.
+
+	void refresh();
+		/// Probes all known nodes with an isMaster command, re-measuring
+		/// their round-trip times (kept as an exponentially weighted
+		/// moving average) and updating their roles. Nodes reported in a
+		/// member's hosts list are added to the set; unreachable nodes
+		/// are kept and retried on the next refresh.
+
 protected:
 	Connection::Ptr isMaster(const Net::SocketAddress& host);
 
 private:
+	struct Node
+		/// Cached state of a replica set member.
+	{
+		Net::SocketAddress address;
+		Connection::Ptr connection;
+		bool primary;
+		bool secondary;
+		double rtt; /// smoothed round-trip time in microseconds; 0 = unknown
+	};
+
+	void refreshNodes();
+		/// Probes all nodes; see refresh(). The caller must hold _mutex.
+
+	void probe(Node& node, std::vector<Net::SocketAddress>& discovered);
+		/// Sends an isMaster to the node, updating its role, round-trip
+		/// time and connection. Hosts reported by the node are appended
+		/// to discovered. The caller must hold _mutex.
+
+	void addNode(const Net::SocketAddress& address);
+		/// Adds the address to the node list when not yet known.
+		/// The caller must hold _mutex.
+
+	Node* findPrimary();
+		/// Returns the reachable primary, or 0. The caller must
+		/// hold _mutex.
+
+	Node* selectNearest(bool secondariesOnly);
+		/// Returns the reachable node with the lowest round-trip time,
+		/// or 0. The caller must hold _mutex.
+
 	std::vector<Net::SocketAddress> _addresses;
+	std::vector<Node> _nodes;
+	FastMutex _mutex;
 };
 
 
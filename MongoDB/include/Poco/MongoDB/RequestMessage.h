@@ -20,6 +20,7 @@
 
 #include "Poco/MongoDB/MongoDB.h"
 #include "Poco/MongoDB/Message.h"
+#include "Poco/SharedPtr.h"
 #include <ostream>
 
 
@@ -31,6 +32,8 @@ class MongoDB_API RequestMessage: public Message
 	/// Base class for a request sent to the MongoDB server.
 {
 public:
+	typedef Poco::SharedPtr<RequestMessage> Ptr;
+
 	explicit RequestMessage(MessageHeader::OpCode opcode);
 		/// Creates a RequestMessage using the given opcode.
 
@@ -40,6 +43,10 @@ public:
 	void send(std::ostream& ostr);
 		/// Writes the request to stream.
 
+	void sendCompressed(std::ostream& ostr);
+		/// Writes the request to the stream, wrapped in an OP_COMPRESSED
+		/// message with a zlib-deflated payload.
+
 protected:
 	virtual void buildRequest(BinaryWriter& ss) = 0;
 };
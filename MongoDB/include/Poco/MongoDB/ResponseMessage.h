@@ -36,6 +36,14 @@ public:
 	ResponseMessage();
 		/// Creates an empty ResponseMessage.
 
+	explicit ResponseMessage(bool rawDocuments);
+		/// Creates an empty ResponseMessage.
+		///
+		/// When rawDocuments is true, read() stores the undecoded BSON
+		/// of every returned document in rawDocuments() instead of
+		/// materializing Documents. Wrap the raw buffers in a
+		/// DocumentView to decode fields on demand.
+
 	virtual ~ResponseMessage();
 		/// Destroys the ResponseMessage.
 
@@ -59,13 +67,27 @@ public:
 
 	void read(std::istream& istr);
 		/// Reads the response from the stream.
+		///
+		/// An OP_COMPRESSED response is inflated transparently.
+
+	std::vector<std::string>& rawDocuments();
+		/// Returns the undecoded BSON buffers of the received documents.
+		///
+		/// Only filled when the ResponseMessage was created with
+		/// rawDocuments set to true.
 
 private:
+	void readBody(BinaryReader& reader);
+		/// Reads the reply body (everything after the header) using
+		/// the given reader.
+
 	Int32 _responseFlags;
 	Int64 _cursorID;
 	Int32 _startingFrom;
 	Int32 _numberReturned;
 	Document::Vector _documents;
+	bool _raw;
+	std::vector<std::string> _rawDocuments;
 };
 
 
@@ -96,6 +118,12 @@ inline Document::Vector& ResponseMessage::documents()
 }
 
 
+inline std::vector<std::string>& ResponseMessage::rawDocuments()
+{
+	return _rawDocuments;
+}
+
+
 inline bool ResponseMessage::hasDocuments() const
 {
 	return _documents.size() > 0;
@@ -15,6 +15,7 @@
 #include "Poco/Net/SocketStream.h"
 #include "Poco/MongoDB/Connection.h"
 #include "Poco/MongoDB/Database.h"
+#include "Poco/MongoDB/Array.h"
 #include "Poco/URI.h"
 #include "Poco/Format.h"
 #include "Poco/NumberParser.h"
@@ -53,14 +54,16 @@ Poco::Net::StreamSocket Connection::SocketFactory::createSocket(const std::strin
 
 Connection::Connection():
 	_address(),
-	_socket()
+	_socket(),
+	_compressed(false)
 {
 }
 
 
 Connection::Connection(const std::string& hostAndPort):
 	_address(hostAndPort),
-	_socket()
+	_socket(),
+	_compressed(false)
 {
 	connect();
 }
@@ -68,7 +71,8 @@ Connection::Connection(const std::string& hostAndPort):
 
 Connection::Connection(const std::string& uri, SocketFactory& socketFactory):
 	_address(),
-	_socket()
+	_socket(),
+	_compressed(false)
 {
 	connect(uri, socketFactory);
 }
@@ -76,7 +80,8 @@ Connection::Connection(const std::string& uri, SocketFactory& socketFactory):
 
 Connection::Connection(const std::string& host, int port):
 	_address(host, port),
-	_socket()
+	_socket(),
+	_compressed(false)
 {
 	connect();
 }
@@ -84,7 +89,8 @@ Connection::Connection(const std::string& host, int port):
 
 Connection::Connection(const Poco::Net::SocketAddress& addrs):
 	_address(addrs),
-	_socket()
+	_socket(),
+	_compressed(false)
 {
 	connect();
 }
@@ -92,7 +98,8 @@ Connection::Connection(const Poco::Net::SocketAddress& addrs):
 
 Connection::Connection(const Poco::Net::StreamSocket& socket):
 	_address(socket.peerAddress()),
-	_socket(socket)
+	_socket(socket),
+	_compressed(false)
 {
 }
 
@@ -219,7 +226,7 @@ void Connection::disconnect()
 void Connection::sendRequest(RequestMessage& request)
 {
 	Poco::Net::SocketOutputStream sos(_socket);
-	request.send(sos);
+	writeRequest(request, sos);
 }
 
 
@@ -232,4 +239,73 @@ void Connection::sendRequest(RequestMessage& request, ResponseMessage& response)
 }
 
 
+void Connection::sendRequests(std::vector<RequestMessage::Ptr>& requests)
+{
+	std::stringstream ss;
+	for (std::vector<RequestMessage::Ptr>::iterator it = requests.begin(); it != requests.end(); ++it)
+	{
+		writeRequest(**it, ss);
+	}
+
+	Poco::Net::SocketOutputStream sos(_socket);
+	sos << ss.rdbuf();
+	sos.flush();
+}
+
+
+void Connection::sendRequests(std::vector<RequestMessage::Ptr>& requests, ResponseMessage& response)
+{
+	sendRequests(requests);
+
+	Poco::Net::SocketInputStream sis(_socket);
+	response.read(sis);
+}
+
+
+void Connection::readResponse(ResponseMessage& response)
+{
+	Poco::Net::SocketInputStream sis(_socket);
+	response.read(sis);
+}
+
+
+bool Connection::negotiateCompression()
+{
+	QueryRequest request("admin.$cmd");
+	request.setNumberToReturn(1);
+	request.selector().add("isMaster", 1);
+
+	Array::Ptr compressors = new Array();
+	compressors->add("0", std::string("zlib"));
+	request.selector().add("compression", compressors);
+
+	ResponseMessage response;
+	sendRequest(request, response);
+
+	_compressed = false;
+	if (response.documents().size() > 0)
+	{
+		Array::Ptr agreed = response.documents()[0]->get<Array::Ptr>("compression", new Array());
+		for (std::size_t i = 0; i < agreed->size(); ++i)
+		{
+			if (agreed->get<std::string>(static_cast<int>(i), "") == "zlib")
+			{
+				_compressed = true;
+				break;
+			}
+		}
+	}
+	return _compressed;
+}
+
+
+void Connection::writeRequest(RequestMessage& request, std::ostream& ostr)
+{
+	if (_compressed)
+		request.sendCompressed(ostr);
+	else
+		request.send(ostr);
+}
+
+
 } } // Poco::MongoDB
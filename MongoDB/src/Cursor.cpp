@@ -22,13 +22,17 @@ namespace MongoDB {
 
 
 Cursor::Cursor(const std::string& db, const std::string& collection, QueryRequest::Flags flags):
-	_query(db + '.' + collection, flags)
+	_query(db + '.' + collection, flags),
+	_prefetch(false),
+	_pending(false)
 {
 }
 
 
 Cursor::Cursor(const std::string& fullCollectionName, QueryRequest::Flags flags):
-	_query(fullCollectionName, flags)
+	_query(fullCollectionName, flags),
+	_prefetch(false),
+	_pending(false)
 {
 }
 
@@ -47,7 +51,13 @@ Cursor::~Cursor()
 
 ResponseMessage& Cursor::next(Connection& connection)
 {
-	if (_response.cursorID() == 0)
+	if (_pending)
+	{
+		_response.clear();
+		connection.readResponse(_response);
+		_pending = false;
+	}
+	else if (_response.cursorID() == 0)
 	{
 		connection.sendRequest(_query, _response);
 	}
@@ -58,12 +68,30 @@ ResponseMessage& Cursor::next(Connection& connection)
 		_response.clear();
 		connection.sendRequest(getMore, _response);
 	}
+
+	if (_prefetch && _response.cursorID() != 0)
+	{
+		// Fire the getMore for the following batch already; its reply is
+		// read by the next call to next(), so the server prepares the next
+		// batch while the caller processes the current one.
+		Poco::MongoDB::GetMoreRequest getMore(_query.fullCollectionName(), _response.cursorID());
+		getMore.setNumberToReturn(_query.getNumberToReturn());
+		connection.sendRequest(getMore);
+		_pending = true;
+	}
 	return _response;
 }
 
 
 void Cursor::kill(Connection& connection)
 {
+	if (_pending)
+	{
+		// Drain the prefetched batch so the connection is usable again.
+		_response.clear();
+		connection.readResponse(_response);
+		_pending = false;
+	}
 	if (_response.cursorID() != 0)
 	{
 		KillCursorsRequest killRequest;
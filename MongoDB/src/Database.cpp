@@ -373,6 +373,28 @@ Document::Ptr Database::getLastErrorDoc(Connection& connection) const
 }
 
 
+Document::Ptr Database::sendWriteBatch(Connection& connection, std::vector<RequestMessage::Ptr>& requests) const
+{
+	Poco::SharedPtr<Poco::MongoDB::QueryRequest> getLastError = createQueryRequest("$cmd");
+	getLastError->setNumberToReturn(1);
+	getLastError->selector().add("getLastError", 1);
+
+	std::vector<RequestMessage::Ptr> batch(requests);
+	batch.push_back(getLastError);
+
+	Poco::MongoDB::ResponseMessage response;
+	connection.sendRequests(batch, response);
+
+	Document::Ptr errorDoc;
+	if (response.documents().size() > 0)
+	{
+		errorDoc = response.documents()[0];
+	}
+
+	return errorDoc;
+}
+
+
 std::string Database::getLastError(Connection& connection) const
 {
 	Document::Ptr errorDoc = getLastErrorDoc(connection);
@@ -197,6 +197,31 @@ void Document::write(BinaryWriter& writer)
 	}
 	else
 	{
+		std::ostream& ostr = writer.stream();
+		std::ostream::pos_type lengthPos = ostr.tellp();
+		if (lengthPos != std::ostream::pos_type(-1))
+		{
+			// The target stream is seekable (the usual case: requests are
+			// serialized into a string stream): write the elements in place,
+			// directly after a length placeholder that is patched afterwards.
+			// This avoids a temporary buffer and copy per (nested) document.
+			writer << static_cast<Poco::Int32>(0);
+			for (ElementSet::iterator it = _elements.begin(); it != _elements.end(); ++it)
+			{
+				writer << static_cast<unsigned char>((*it)->type());
+				BSONWriter(writer).writeCString((*it)->name());
+				Element::Ptr element = *it;
+				element->write(writer);
+			}
+			writer << '\0';
+
+			std::ostream::pos_type endPos = ostr.tellp();
+			ostr.seekp(lengthPos);
+			writer << static_cast<Poco::Int32>(endPos - lengthPos);
+			ostr.seekp(endPos);
+			return;
+		}
+
 		std::stringstream sstream;
 		Poco::BinaryWriter tempWriter(sstream);
 		for (ElementSet::iterator it = _elements.begin(); it != _elements.end(); ++it)
@@ -207,7 +232,7 @@ void Document::write(BinaryWriter& writer)
 			element->write(tempWriter);
 		}
 		tempWriter.flush();
-		
+
 		Poco::Int32 len = static_cast<Poco::Int32>(5 + sstream.tellp()); /* 5 = sizeof(len) + 0-byte */
 		writer << len;
 		writer.writeRaw(sstream.str());
@@ -0,0 +1,351 @@
+//
+// DocumentView.cpp
+//
+// Library: MongoDB
+// Package: MongoDB
+// Module:  DocumentView
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/MongoDB/DocumentView.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/Exception.h"
+#include <cstring>
+
+
+namespace Poco {
+namespace MongoDB {
+
+
+namespace
+{
+	Poco::Int32 readInt32(const char* p)
+	{
+		Poco::Int32 value;
+		std::memcpy(&value, p, sizeof(value));
+		return Poco::ByteOrder::fromLittleEndian(value);
+	}
+
+
+	Poco::Int64 readInt64(const char* p)
+	{
+		Poco::Int64 value;
+		std::memcpy(&value, p, sizeof(value));
+		return Poco::ByteOrder::fromLittleEndian(value);
+	}
+
+
+	double readDouble(const char* p)
+	{
+		Poco::Int64 bits = readInt64(p);
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+}
+
+
+DocumentView::DocumentView():
+	_data(0),
+	_size(0)
+{
+}
+
+
+DocumentView::DocumentView(const char* data, std::size_t size):
+	_data(data),
+	_size(size)
+{
+}
+
+
+DocumentView::DocumentView(const std::string& buffer):
+	_data(buffer.data()),
+	_size(buffer.size())
+{
+}
+
+
+bool DocumentView::empty() const
+{
+	return _size <= 5;
+}
+
+
+bool DocumentView::exists(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	return find(name, type, value, avail);
+}
+
+
+Int64 DocumentView::getInteger(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+
+	if (type == ElementTraits<double>::TypeId) return static_cast<Int64>(readDouble(value));
+	if (type == ElementTraits<Int32>::TypeId) return readInt32(value);
+	if (type == ElementTraits<Int64>::TypeId) return readInt64(value);
+	throw Poco::BadCastException("Invalid type mismatch!");
+}
+
+
+DocumentView DocumentView::getView(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+
+	if (type == 0x03 || type == 0x04)
+	{
+		return DocumentView(value, static_cast<std::size_t>(readInt32(value)));
+	}
+	throw Poco::BadCastException("Invalid type mismatch!");
+}
+
+
+bool DocumentView::isType(const std::string& name, unsigned char typeId) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) return false;
+
+	return type == typeId;
+}
+
+
+Document::Ptr DocumentView::toDocument() const
+{
+	Document::Ptr document = new Document();
+	if (_data)
+	{
+		Poco::MemoryInputStream istr(_data, _size);
+		BinaryReader reader(istr, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+		document->read(reader);
+	}
+	return document;
+}
+
+
+bool DocumentView::find(const std::string& name, unsigned char& type, const char*& value, std::size_t& avail) const
+{
+	if (_size < 5) return false;
+
+	const char* p = _data + 4;
+	const char* end = _data + _size - 1;
+
+	while (p < end && *p != '\0')
+	{
+		unsigned char elementType = static_cast<unsigned char>(*p++);
+
+		const char* nameBegin = p;
+		while (p < end && *p != '\0') ++p;
+		if (p >= end) throw Poco::RangeException("Truncated BSON document");
+		std::size_t nameLength = static_cast<std::size_t>(p - nameBegin);
+		++p;
+
+		if (name.size() == nameLength && std::memcmp(name.data(), nameBegin, nameLength) == 0)
+		{
+			type = elementType;
+			value = p;
+			avail = static_cast<std::size_t>(end - p);
+			return true;
+		}
+
+		p += valueSize(elementType, p, static_cast<std::size_t>(end - p));
+	}
+	return false;
+}
+
+
+std::size_t DocumentView::valueSize(unsigned char type, const char* value, std::size_t avail)
+{
+	std::size_t size;
+	switch (type)
+	{
+	case 0x01: // double
+	case 0x09: // UTC datetime
+	case 0x11: // timestamp
+	case 0x12: // int64
+		size = 8;
+		break;
+	case 0x02: // string
+	case 0x0D: // JavaScript code
+		if (avail < 4) throw Poco::RangeException("Truncated BSON document");
+		size = 4 + static_cast<std::size_t>(readInt32(value));
+		break;
+	case 0x03: // embedded document
+	case 0x04: // array
+		if (avail < 4) throw Poco::RangeException("Truncated BSON document");
+		size = static_cast<std::size_t>(readInt32(value));
+		break;
+	case 0x05: // binary
+		if (avail < 4) throw Poco::RangeException("Truncated BSON document");
+		size = 5 + static_cast<std::size_t>(readInt32(value));
+		break;
+	case 0x07: // ObjectId
+		size = 12;
+		break;
+	case 0x08: // boolean
+		size = 1;
+		break;
+	case 0x0A: // null
+		size = 0;
+		break;
+	case 0x0B: // regular expression: two cstrings
+		{
+			size = 0;
+			for (int i = 0; i < 2; ++i)
+			{
+				while (size < avail && value[size] != '\0') ++size;
+				if (size >= avail) throw Poco::RangeException("Truncated BSON document");
+				++size;
+			}
+		}
+		break;
+	case 0x10: // int32
+		size = 4;
+		break;
+	default:
+		throw Poco::NotImplementedException("BSON element contains an unsupported type");
+	}
+	if (size > avail) throw Poco::RangeException("Truncated BSON document");
+	return size;
+}
+
+
+template<>
+double DocumentView::get<double>(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+	if (type != ElementTraits<double>::TypeId) throw Poco::BadCastException("Invalid type mismatch!");
+	return readDouble(value);
+}
+
+
+template<>
+Int32 DocumentView::get<Int32>(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+	if (type != ElementTraits<Int32>::TypeId) throw Poco::BadCastException("Invalid type mismatch!");
+	return readInt32(value);
+}
+
+
+template<>
+Int64 DocumentView::get<Int64>(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+	if (type != ElementTraits<Int64>::TypeId) throw Poco::BadCastException("Invalid type mismatch!");
+	return readInt64(value);
+}
+
+
+template<>
+bool DocumentView::get<bool>(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+	if (type != ElementTraits<bool>::TypeId) throw Poco::BadCastException("Invalid type mismatch!");
+	return *value != '\0';
+}
+
+
+template<>
+std::string DocumentView::get<std::string>(const std::string& name) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail)) throw Poco::NotFoundException(name);
+	if (type != ElementTraits<std::string>::TypeId) throw Poco::BadCastException("Invalid type mismatch!");
+	if (avail < 4) throw Poco::RangeException("Truncated BSON document");
+	std::size_t length = static_cast<std::size_t>(readInt32(value));
+	if (length == 0 || 4 + length > avail) throw Poco::RangeException("Truncated BSON document");
+	return std::string(value + 4, length - 1);
+}
+
+
+template<>
+double DocumentView::get<double>(const std::string& name, const double& def) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail) || type != ElementTraits<double>::TypeId) return def;
+	return readDouble(value);
+}
+
+
+template<>
+Int32 DocumentView::get<Int32>(const std::string& name, const Int32& def) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail) || type != ElementTraits<Int32>::TypeId) return def;
+	return readInt32(value);
+}
+
+
+template<>
+Int64 DocumentView::get<Int64>(const std::string& name, const Int64& def) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail) || type != ElementTraits<Int64>::TypeId) return def;
+	return readInt64(value);
+}
+
+
+template<>
+bool DocumentView::get<bool>(const std::string& name, const bool& def) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail) || type != ElementTraits<bool>::TypeId) return def;
+	return *value != '\0';
+}
+
+
+template<>
+std::string DocumentView::get<std::string>(const std::string& name, const std::string& def) const
+{
+	unsigned char type;
+	const char* value;
+	std::size_t avail;
+	if (!find(name, type, value, avail) || type != ElementTraits<std::string>::TypeId) return def;
+	if (avail < 4) return def;
+	std::size_t length = static_cast<std::size_t>(readInt32(value));
+	if (length == 0 || 4 + length > avail) return def;
+	return std::string(value + 4, length - 1);
+}
+
+
+} } // namespace Poco::MongoDB
@@ -15,6 +15,8 @@
 #include "Poco/MongoDB/ReplicaSet.h"
 #include "Poco/MongoDB/QueryRequest.h"
 #include "Poco/MongoDB/ResponseMessage.h"
+#include "Poco/MongoDB/Array.h"
+#include "Poco/Timestamp.h"
 
 
 namespace Poco {
@@ -49,6 +51,170 @@ Connection::Ptr ReplicaSet::findMaster()
 }
 
 
+Connection::Ptr ReplicaSet::findConnection(ReadPreference preference)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_nodes.empty()) refreshNodes();
+
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+		Node* node = 0;
+		switch (preference)
+		{
+		case PRIMARY:
+			node = findPrimary();
+			break;
+		case PRIMARY_PREFERRED:
+			node = findPrimary();
+			if (!node) node = selectNearest(true);
+			break;
+		case SECONDARY:
+			node = selectNearest(true);
+			break;
+		case SECONDARY_PREFERRED:
+			node = selectNearest(true);
+			if (!node) node = findPrimary();
+			break;
+		case NEAREST:
+			node = selectNearest(false);
+			break;
+		}
+		if (node) return node->connection;
+
+		// The cached topology might be stale (failover, cold cache):
+		// probe once more before giving up.
+		if (attempt == 0) refreshNodes();
+	}
+	return 0;
+}
+
+
+void ReplicaSet::refresh()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	refreshNodes();
+}
+
+
+void ReplicaSet::refreshNodes()
+{
+	if (_nodes.empty())
+	{
+		for (std::vector<Net::SocketAddress>::iterator it = _addresses.begin(); it != _addresses.end(); ++it)
+		{
+			addNode(*it);
+		}
+	}
+
+	std::vector<Net::SocketAddress> discovered;
+	std::size_t known = _nodes.size();
+	for (std::size_t i = 0; i < known; ++i)
+	{
+		probe(_nodes[i], discovered);
+	}
+
+	for (std::vector<Net::SocketAddress>::iterator it = discovered.begin(); it != discovered.end(); ++it)
+	{
+		addNode(*it);
+	}
+
+	std::vector<Net::SocketAddress> ignored;
+	for (std::size_t i = known; i < _nodes.size(); ++i)
+	{
+		probe(_nodes[i], ignored);
+	}
+}
+
+
+void ReplicaSet::probe(Node& node, std::vector<Net::SocketAddress>& discovered)
+{
+	try
+	{
+		if (node.connection.isNull())
+		{
+			node.connection = new Connection();
+			node.connection->connect(node.address);
+		}
+
+		QueryRequest request("admin.$cmd");
+		request.setNumberToReturn(1);
+		request.selector().add("isMaster", 1);
+
+		Poco::Timestamp start;
+		ResponseMessage response;
+		node.connection->sendRequest(request, response);
+		double elapsed = static_cast<double>(start.elapsed());
+
+		node.rtt = node.rtt > 0 ? 0.8*node.rtt + 0.2*elapsed : elapsed;
+
+		node.primary = false;
+		node.secondary = false;
+		if (response.documents().size() > 0)
+		{
+			Document::Ptr doc = response.documents()[0];
+			node.primary = doc->get<bool>("ismaster", false);
+			node.secondary = doc->get<bool>("secondary", false);
+			if (doc->isType<Array::Ptr>("hosts"))
+			{
+				Array::Ptr hosts = doc->get<Array::Ptr>("hosts");
+				for (std::size_t i = 0; i < hosts->size(); ++i)
+				{
+					discovered.push_back(Net::SocketAddress(hosts->get<std::string>(static_cast<int>(i))));
+				}
+			}
+		}
+	}
+	catch (Exception&)
+	{
+		node.connection = 0;
+		node.primary = false;
+		node.secondary = false;
+	}
+}
+
+
+void ReplicaSet::addNode(const Net::SocketAddress& address)
+{
+	for (std::vector<Node>::iterator it = _nodes.begin(); it != _nodes.end(); ++it)
+	{
+		if (it->address == address) return;
+	}
+
+	Node node;
+	node.address = address;
+	node.primary = false;
+	node.secondary = false;
+	node.rtt = 0;
+	_nodes.push_back(node);
+}
+
+
+ReplicaSet::Node* ReplicaSet::findPrimary()
+{
+	for (std::vector<Node>::iterator it = _nodes.begin(); it != _nodes.end(); ++it)
+	{
+		if (it->primary && !it->connection.isNull()) return &(*it);
+	}
+	return 0;
+}
+
+
+ReplicaSet::Node* ReplicaSet::selectNearest(bool secondariesOnly)
+{
+	Node* nearest = 0;
+	for (std::vector<Node>::iterator it = _nodes.begin(); it != _nodes.end(); ++it)
+	{
+		if (it->connection.isNull()) continue;
+		if (secondariesOnly && !it->secondary) continue;
+		if (!secondariesOnly && !it->primary && !it->secondary) continue;
+		if (!nearest || it->rtt < nearest->rtt) nearest = &(*it);
+	}
+	return nearest;
+}
+
+
 Connection::Ptr ReplicaSet::isMaster(const Net::SocketAddress& address)
 {
 	Connection::Ptr conn = new Connection();
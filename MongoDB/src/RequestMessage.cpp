@@ -15,6 +15,7 @@
 #include "Poco/MongoDB/RequestMessage.h"
 #include "Poco/Net/SocketStream.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/DeflatingStream.h"
 
 
 namespace Poco {
@@ -48,4 +49,35 @@ void RequestMessage::send(std::ostream& ostr)
 }
 
 
+void RequestMessage::sendCompressed(std::ostream& ostr)
+{
+	std::stringstream ss;
+	BinaryWriter requestWriter(ss);
+	buildRequest(requestWriter);
+	requestWriter.flush();
+	std::string body = ss.str();
+
+	std::stringstream deflated;
+	DeflatingOutputStream deflater(deflated, DeflatingStreamBuf::STREAM_ZLIB);
+	deflater.write(body.data(), static_cast<std::streamsize>(body.size()));
+	deflater.close();
+	std::string payload = deflated.str();
+
+	// OP_COMPRESSED wraps the original message: its body is the original
+	// opcode, the uncompressed body size, the compressor id and the
+	// deflated body. The original header is dropped.
+	BinaryWriter socketWriter(ostr, BinaryWriter::LITTLE_ENDIAN_BYTE_ORDER);
+	socketWriter << static_cast<Poco::Int32>(MessageHeader::MSG_HEADER_SIZE + 9 + payload.size());
+	socketWriter << _header.getRequestID();
+	socketWriter << static_cast<Poco::Int32>(0);
+	socketWriter << static_cast<Poco::Int32>(MessageHeader::OP_COMPRESSED);
+	socketWriter << static_cast<Poco::Int32>(_header.opCode());
+	socketWriter << static_cast<Poco::Int32>(body.size());
+	socketWriter << static_cast<Poco::UInt8>(2); // zlib
+	socketWriter.writeRaw(payload);
+	socketWriter.flush();
+	ostr.flush();
+}
+
+
 } } // namespace Poco::MongoDB
@@ -14,6 +14,9 @@
 
 #include "Poco/MongoDB/ResponseMessage.h"
 #include "Poco/Net/SocketStream.h"
+#include "Poco/InflatingStream.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/Exception.h"
 
 
 namespace Poco {
@@ -21,11 +24,23 @@ namespace MongoDB {
 
 
 ResponseMessage::ResponseMessage():
-	Message(MessageHeader::OP_REPLY), 
-	_responseFlags(0), 
-	_cursorID(0), 
-	_startingFrom(0), 
-	_numberReturned(0)
+	Message(MessageHeader::OP_REPLY),
+	_responseFlags(0),
+	_cursorID(0),
+	_startingFrom(0),
+	_numberReturned(0),
+	_raw(false)
+{
+}
+
+
+ResponseMessage::ResponseMessage(bool rawDocuments):
+	Message(MessageHeader::OP_REPLY),
+	_responseFlags(0),
+	_cursorID(0),
+	_startingFrom(0),
+	_numberReturned(0),
+	_raw(rawDocuments)
 {
 }
 
@@ -42,6 +57,7 @@ void ResponseMessage::clear()
 	_cursorID = 0;
 	_numberReturned = 0;
 	_documents.clear();
+	_rawDocuments.clear();
 }
 
 
@@ -50,9 +66,41 @@ void ResponseMessage::read(std::istream& istr)
 	clear();
 
 	BinaryReader reader(istr, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
-	
+
 	_header.read(reader);
 
+	if (_header.opCode() == MessageHeader::OP_COMPRESSED)
+	{
+		Int32 originalOpcode;
+		Int32 uncompressedSize;
+		UInt8 compressorId;
+		reader >> originalOpcode;
+		reader >> uncompressedSize;
+		reader >> compressorId;
+
+		std::string payload;
+		reader.readRaw(_header.getMessageLength() - MessageHeader::MSG_HEADER_SIZE - 9, payload);
+
+		std::istringstream payloadStream(payload);
+		if (compressorId == 0) // noop
+		{
+			BinaryReader payloadReader(payloadStream, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+			readBody(payloadReader);
+		}
+		else if (compressorId == 2) // zlib
+		{
+			InflatingInputStream inflater(payloadStream, InflatingStreamBuf::STREAM_ZLIB);
+			BinaryReader payloadReader(inflater, BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+			readBody(payloadReader);
+		}
+		else throw Poco::ProtocolException("unsupported MongoDB compressor id");
+	}
+	else readBody(reader);
+}
+
+
+void ResponseMessage::readBody(BinaryReader& reader)
+{
 	reader >> _responseFlags;
 	reader >> _cursorID;
 	reader >> _startingFrom;
@@ -60,9 +108,24 @@ void ResponseMessage::read(std::istream& istr)
 
 	for (int i = 0; i < _numberReturned; ++i)
 	{
-		Document::Ptr doc = new Document();
-		doc->read(reader);
-		_documents.push_back(doc);
+		if (_raw)
+		{
+			Int32 size;
+			reader >> size;
+
+			std::string raw;
+			reader.readRaw(size - sizeof(Int32), raw);
+
+			Int32 sizeLE = Poco::ByteOrder::toLittleEndian(size);
+			raw.insert(0, reinterpret_cast<const char*>(&sizeLE), sizeof(sizeLE));
+			_rawDocuments.push_back(raw);
+		}
+		else
+		{
+			Document::Ptr doc = new Document();
+			doc->read(reader);
+			_documents.push_back(doc);
+		}
 	}
 }
 
@@ -19,6 +19,7 @@
 #include "Poco/MongoDB/Cursor.h"
 #include "Poco/MongoDB/ObjectId.h"
 #include "Poco/MongoDB/Binary.h"
+#include "Poco/MongoDB/DocumentView.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/UUIDGenerator.h"
 #include "MongoDBTest.h"
@@ -78,6 +79,65 @@ void MongoDBTest::testInsertRequest()
 }
 
 
+void MongoDBTest::testDocumentView()
+{
+	Poco::MongoDB::Document::Ptr player = new Poco::MongoDB::Document();
+	player->add("lastname", std::string("Braem"));
+	player->add("start", 1993);
+	player->add("active", false);
+	player->add("rating", 4.5);
+	player->add("games", Poco::Int64(1000));
+
+	Poco::MongoDB::Document::Ptr address = new Poco::MongoDB::Document();
+	address->add("city", std::string("Brussels"));
+	player->add("address", address);
+
+	std::stringstream ss;
+	Poco::BinaryWriter writer(ss);
+	player->write(writer);
+	writer.flush();
+	std::string buffer = ss.str();
+
+	Poco::MongoDB::DocumentView view(buffer);
+	assert(!view.empty());
+	assert(view.exists("lastname"));
+	assert(!view.exists("firstname"));
+	assert(view.get<std::string>("lastname") == "Braem");
+	assert(view.get<Poco::Int32>("start") == 1993);
+	assert(!view.get<bool>("active"));
+	assert(view.get<double>("rating") == 4.5);
+	assert(view.get<Poco::Int64>("games") == 1000);
+	assert(view.getInteger("start") == 1993);
+	assert(view.get<std::string>("firstname", std::string("unknown")) == "unknown");
+	assert(view.get<Poco::Int32>("lastname", -1) == -1);
+
+	Poco::MongoDB::DocumentView addressView = view.getView("address");
+	assert(addressView.get<std::string>("city") == "Brussels");
+
+	try
+	{
+		view.get<std::string>("nosuchfield");
+		fail("must throw NotFoundException");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+
+	try
+	{
+		view.get<std::string>("start");
+		fail("must throw BadCastException");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+
+	Poco::MongoDB::Document::Ptr materialized = view.toDocument();
+	assert(materialized->get<std::string>("lastname") == "Braem");
+	assert(materialized->get<Poco::Int32>("start") == 1993);
+}
+
+
 void MongoDBTest::testQueryRequest()
 {
 	Poco::MongoDB::QueryRequest request("team.players");
@@ -472,6 +532,7 @@ CppUnit::Test* MongoDBTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("MongoDBTest");
 	CppUnit_addTest(pSuite, MongoDBTest, testBuildInfo);
 	CppUnit_addTest(pSuite, MongoDBTest, testInsertRequest);
+	CppUnit_addTest(pSuite, MongoDBTest, testDocumentView);
 	CppUnit_addTest(pSuite, MongoDBTest, testQueryRequest);
 	CppUnit_addTest(pSuite, MongoDBTest, testDBQueryRequest);
 	CppUnit_addTest(pSuite, MongoDBTest, testCountCommand);
@@ -27,6 +27,7 @@ public:
 	virtual ~MongoDBTest();
 
 	void testInsertRequest();
+	void testDocumentView();
 	void testQueryRequest();
 	void testDBQueryRequest();
 	void testCountCommand();
@@ -0,0 +1,78 @@
+//
+// BenchmarkDriver.cpp
+//
+// Console application entry point for the Net benchmarks.
+//
+// Runs the server-side scenarios against an in-process HTTPServer
+// (or, when a host is given, against a remote BenchmarkServer) and
+// reports requests per second and latency percentiles per scenario.
+//
+// Copyright (c) 2005-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "BenchmarkServer.h"
+#include "LoadGenerator.h"
+#include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include <iostream>
+#include <cstring>
+
+
+int main(int argc, char** argv)
+{
+	std::string host;
+	Poco::UInt16 port = 0;
+	int concurrency = 8;
+	int requests = 1000;
+	int size = 4096;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "-h") == 0 && i + 1 < argc)
+			host = argv[++i];
+		else if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+			port = static_cast<Poco::UInt16>(Poco::NumberParser::parse(argv[++i]));
+		else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+			concurrency = Poco::NumberParser::parse(argv[++i]);
+		else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			requests = Poco::NumberParser::parse(argv[++i]);
+		else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			size = Poco::NumberParser::parse(argv[++i]);
+		else
+		{
+			std::cout << "usage: " << argv[0] << " [-h host -p port] [-c concurrency] [-n requests per worker] [-s response size]" << std::endl;
+			std::cout << "Without -h, the scenarios run against an in-process server." << std::endl;
+			return 1;
+		}
+	}
+
+	try
+	{
+		Poco::SharedPtr<BenchmarkServer> pServer;
+		if (host.empty())
+		{
+			pServer = new BenchmarkServer(concurrency);
+			host = "127.0.0.1";
+			port = pServer->port();
+		}
+
+		std::string sizeQuery("?size=" + Poco::NumberFormatter::format(size));
+		std::string body(size, 'x');
+
+		LoadGenerator generator(host, port, concurrency, requests);
+		generator.run("echo", "/echo", body).print();
+		generator.run("fixed", "/fixed" + sizeQuery).print();
+		generator.run("chunked", "/chunked" + sizeQuery).print();
+		generator.runWebSocket("websocket", "/ws", body).print();
+	}
+	catch (Poco::Exception& exc)
+	{
+		std::cerr << exc.displayText() << std::endl;
+		return 1;
+	}
+	return 0;
+}
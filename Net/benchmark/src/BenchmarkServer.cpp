@@ -0,0 +1,172 @@
+//
+// BenchmarkServer.cpp
+//
+// Copyright (c) 2005-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "BenchmarkServer.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/URI.h"
+#include "Poco/NumberParser.h"
+#include "Poco/StreamCopier.h"
+#include <cstring>
+
+
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::ServerSocket;
+using Poco::Net::WebSocket;
+
+
+namespace
+{
+	int sizeParam(const HTTPServerRequest& request, int deflt)
+	{
+		Poco::URI uri(request.getURI());
+		Poco::URI::QueryParameters params = uri.getQueryParameters();
+		for (Poco::URI::QueryParameters::const_iterator it = params.begin(); it != params.end(); ++it)
+		{
+			if (it->first == "size")
+				return Poco::NumberParser::parse(it->second);
+		}
+		return deflt;
+	}
+
+
+	class EchoHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string body;
+			Poco::StreamCopier::copyToString(request.stream(), body);
+			response.setContentType("application/octet-stream");
+			response.setContentLength(static_cast<int>(body.size()));
+			response.send().write(body.data(), body.size());
+		}
+	};
+
+
+	class FixedLengthHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			int size = sizeParam(request, 4096);
+			response.setContentType("application/octet-stream");
+			response.setContentLength(size);
+			writeBody(response.send(), size);
+		}
+
+		static void writeBody(std::ostream& ostr, int size)
+		{
+			char buffer[1024];
+			std::memset(buffer, 'x', sizeof(buffer));
+			while (size > 0)
+			{
+				int n = size < static_cast<int>(sizeof(buffer)) ? size : static_cast<int>(sizeof(buffer));
+				ostr.write(buffer, n);
+				size -= n;
+			}
+		}
+	};
+
+
+	class ChunkedHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			int size = sizeParam(request, 4096);
+			response.setContentType("application/octet-stream");
+			response.setChunkedTransferEncoding(true);
+			FixedLengthHandler::writeBody(response.send(), size);
+		}
+	};
+
+
+	class WebSocketEchoHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			try
+			{
+				WebSocket ws(request, response);
+				Poco::Buffer<char> buffer(16384);
+				int flags = 0;
+				for (;;)
+				{
+					int n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+					if (n == 0 || (flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE)
+						break;
+					ws.sendFrame(buffer.begin(), n, flags);
+				}
+			}
+			catch (Poco::Net::WebSocketException&)
+			{
+				// handshake failed; response has already been sent
+			}
+		}
+	};
+
+
+	class ScenarioRequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			Poco::URI uri(request.getURI());
+			const std::string& path = uri.getPath();
+			if (path == "/echo")
+				return new EchoHandler;
+			else if (path == "/fixed")
+				return new FixedLengthHandler;
+			else if (path == "/chunked")
+				return new ChunkedHandler;
+			else if (path == "/ws")
+				return new WebSocketEchoHandler;
+			else
+				return 0;
+		}
+	};
+}
+
+
+BenchmarkServer::BenchmarkServer(int maxThreads)
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setMaxThreads(maxThreads);
+	pParams->setMaxQueued(4*maxThreads);
+	pParams->setKeepAlive(true);
+	ServerSocket socket(0);
+	_port = socket.address().port();
+	_pServer = new Poco::Net::HTTPServer(new ScenarioRequestHandlerFactory, socket, pParams);
+	_pServer->start();
+}
+
+
+BenchmarkServer::~BenchmarkServer()
+{
+	try
+	{
+		_pServer->stop();
+	}
+	catch (...)
+	{
+	}
+}
@@ -0,0 +1,62 @@
+//
+// BenchmarkServer.h
+//
+// Definition of the BenchmarkServer class.
+//
+// Copyright (c) 2005-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef BenchmarkServer_INCLUDED
+#define BenchmarkServer_INCLUDED
+
+
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/SharedPtr.h"
+
+
+class BenchmarkServer
+	/// An in-process HTTPServer providing the server-side benchmark
+	/// scenarios:
+	///
+	///   - /echo: echoes the request body back to the client
+	///   - /fixed?size=<n>: sends a fixed-length response of n bytes
+	///   - /chunked?size=<n>: sends n bytes using chunked transfer encoding
+	///   - /ws: a WebSocket endpoint echoing every received frame
+	///
+	/// The server listens on an ephemeral port; use port() to
+	/// find out which one.
+{
+public:
+	BenchmarkServer(int maxThreads);
+		/// Creates and starts the server, using up to maxThreads
+		/// server threads.
+
+	~BenchmarkServer();
+		/// Stops and destroys the server.
+
+	Poco::UInt16 port() const;
+		/// Returns the port the server is listening on.
+
+private:
+	BenchmarkServer(const BenchmarkServer&);
+	BenchmarkServer& operator = (const BenchmarkServer&);
+
+	Poco::SharedPtr<Poco::Net::HTTPServer> _pServer;
+	Poco::UInt16 _port;
+};
+
+
+//
+// inlines
+//
+inline Poco::UInt16 BenchmarkServer::port() const
+{
+	return _port;
+}
+
+
+#endif // BenchmarkServer_INCLUDED
@@ -0,0 +1,316 @@
+//
+// LoadGenerator.cpp
+//
+// Copyright (c) 2005-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "LoadGenerator.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/Exception.h"
+#include "Poco/NullStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/NumberFormatter.h"
+#include <algorithm>
+#include <iostream>
+
+
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::WebSocket;
+using Poco::Thread;
+using Poco::Runnable;
+using Poco::SharedPtr;
+using Poco::Timestamp;
+using Poco::NumberFormatter;
+
+
+namespace
+{
+	class HTTPWorker: public Runnable
+		/// Issues a fixed number of requests over its own keep-alive
+		/// session, recording the latency of every completed request.
+	{
+	public:
+		HTTPWorker(const std::string& host, Poco::UInt16 port, const std::string& path, const std::string& body, int requests, std::vector<Timestamp::TimeDiff>& latencies):
+			_host(host),
+			_port(port),
+			_path(path),
+			_body(body),
+			_requests(requests),
+			_latencies(latencies),
+			_failures(0)
+		{
+			_latencies.reserve(requests);
+		}
+
+		void run()
+		{
+			HTTPClientSession session(_host, _port);
+			session.setKeepAlive(true);
+			for (int i = 0; i < _requests; i++)
+			{
+				try
+				{
+					Timestamp start;
+					HTTPRequest request(_body.empty() ? HTTPRequest::HTTP_GET : HTTPRequest::HTTP_POST, _path, HTTPMessage::HTTP_1_1);
+					request.setKeepAlive(true);
+					if (!_body.empty())
+					{
+						request.setContentLength(static_cast<int>(_body.size()));
+						session.sendRequest(request).write(_body.data(), _body.size());
+					}
+					else
+					{
+						session.sendRequest(request);
+					}
+					HTTPResponse response;
+					std::istream& rs = session.receiveResponse(response);
+					Poco::NullOutputStream null;
+					Poco::StreamCopier::copyStream(rs, null);
+					_latencies.push_back(start.elapsed());
+				}
+				catch (Poco::Exception&)
+				{
+					++_failures;
+					session.reset();
+				}
+			}
+		}
+
+		int failures() const
+		{
+			return _failures;
+		}
+
+	private:
+		std::string _host;
+		Poco::UInt16 _port;
+		std::string _path;
+		std::string _body;
+		int _requests;
+		std::vector<Timestamp::TimeDiff>& _latencies;
+		int _failures;
+	};
+
+
+	class WebSocketWorker: public Runnable
+		/// Performs a fixed number of send/receive round trips over
+		/// its own WebSocket connection.
+	{
+	public:
+		WebSocketWorker(const std::string& host, Poco::UInt16 port, const std::string& path, const std::string& payload, int requests, std::vector<Timestamp::TimeDiff>& latencies):
+			_host(host),
+			_port(port),
+			_path(path),
+			_payload(payload),
+			_requests(requests),
+			_latencies(latencies),
+			_failures(0)
+		{
+			_latencies.reserve(requests);
+		}
+
+		void run()
+		{
+			try
+			{
+				HTTPClientSession session(_host, _port);
+				HTTPRequest request(HTTPRequest::HTTP_GET, _path, HTTPMessage::HTTP_1_1);
+				HTTPResponse response;
+				WebSocket ws(session, request, response);
+				Poco::Buffer<char> buffer(_payload.size() + 16);
+				for (int i = 0; i < _requests; i++)
+				{
+					try
+					{
+						Timestamp start;
+						ws.sendFrame(_payload.data(), static_cast<int>(_payload.size()));
+						int flags = 0;
+						ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+						_latencies.push_back(start.elapsed());
+					}
+					catch (Poco::Exception&)
+					{
+						++_failures;
+					}
+				}
+				ws.shutdown();
+			}
+			catch (Poco::Exception&)
+			{
+				_failures += _requests - static_cast<int>(_latencies.size());
+			}
+		}
+
+		int failures() const
+		{
+			return _failures;
+		}
+
+	private:
+		std::string _host;
+		Poco::UInt16 _port;
+		std::string _path;
+		std::string _payload;
+		int _requests;
+		std::vector<Timestamp::TimeDiff>& _latencies;
+		int _failures;
+	};
+
+
+	Timestamp::TimeDiff percentile(const std::vector<Timestamp::TimeDiff>& sorted, int pct)
+	{
+		if (sorted.empty()) return 0;
+		std::size_t index = (sorted.size()*pct)/100;
+		if (index >= sorted.size()) index = sorted.size() - 1;
+		return sorted[index];
+	}
+}
+
+
+LoadGenerator::Result::Result():
+	requests(0),
+	failures(0),
+	seconds(0),
+	p50(0),
+	p90(0),
+	p99(0),
+	max(0)
+{
+}
+
+
+double LoadGenerator::Result::requestsPerSecond() const
+{
+	return seconds > 0 ? requests/seconds : 0;
+}
+
+
+void LoadGenerator::Result::print() const
+{
+	std::string line(scenario);
+	while (line.size() < 24) line += ' ';
+	line += NumberFormatter::format(requests, 8);
+	line += " req ";
+	line += NumberFormatter::format(static_cast<Poco::Int64>(requestsPerSecond()), 10);
+	line += " req/s   p50 ";
+	line += NumberFormatter::format(static_cast<Poco::Int64>(p50), 6);
+	line += " us   p90 ";
+	line += NumberFormatter::format(static_cast<Poco::Int64>(p90), 6);
+	line += " us   p99 ";
+	line += NumberFormatter::format(static_cast<Poco::Int64>(p99), 6);
+	line += " us   max ";
+	line += NumberFormatter::format(static_cast<Poco::Int64>(max), 6);
+	line += " us";
+	if (failures > 0)
+	{
+		line += "   ";
+		line += NumberFormatter::format(failures);
+		line += " FAILED";
+	}
+	std::cout << line << std::endl;
+}
+
+
+LoadGenerator::LoadGenerator(const std::string& host, Poco::UInt16 port, int concurrency, int requestsPerWorker):
+	_host(host),
+	_port(port),
+	_concurrency(concurrency),
+	_requestsPerWorker(requestsPerWorker)
+{
+}
+
+
+LoadGenerator::Result LoadGenerator::run(const std::string& scenario, const std::string& path, const std::string& body)
+{
+	std::vector<std::vector<Timestamp::TimeDiff> > latencies(_concurrency);
+	std::vector<SharedPtr<HTTPWorker> > workers;
+	std::vector<SharedPtr<Thread> > threads;
+
+	for (int i = 0; i < _concurrency; i++)
+	{
+		workers.push_back(new HTTPWorker(_host, _port, path, body, _requestsPerWorker, latencies[i]));
+		threads.push_back(new Thread);
+	}
+
+	Poco::Stopwatch stopwatch;
+	stopwatch.start();
+	for (int i = 0; i < _concurrency; i++)
+	{
+		threads[i]->start(*workers[i]);
+	}
+	int failures = 0;
+	for (int i = 0; i < _concurrency; i++)
+	{
+		threads[i]->join();
+		failures += workers[i]->failures();
+	}
+	stopwatch.stop();
+
+	return collect(scenario, stopwatch.elapsed()/double(Poco::Stopwatch::resolution()), latencies, failures);
+}
+
+
+LoadGenerator::Result LoadGenerator::runWebSocket(const std::string& scenario, const std::string& path, const std::string& payload)
+{
+	std::vector<std::vector<Timestamp::TimeDiff> > latencies(_concurrency);
+	std::vector<SharedPtr<WebSocketWorker> > workers;
+	std::vector<SharedPtr<Thread> > threads;
+
+	for (int i = 0; i < _concurrency; i++)
+	{
+		workers.push_back(new WebSocketWorker(_host, _port, path, payload, _requestsPerWorker, latencies[i]));
+		threads.push_back(new Thread);
+	}
+
+	Poco::Stopwatch stopwatch;
+	stopwatch.start();
+	for (int i = 0; i < _concurrency; i++)
+	{
+		threads[i]->start(*workers[i]);
+	}
+	int failures = 0;
+	for (int i = 0; i < _concurrency; i++)
+	{
+		threads[i]->join();
+		failures += workers[i]->failures();
+	}
+	stopwatch.stop();
+
+	return collect(scenario, stopwatch.elapsed()/double(Poco::Stopwatch::resolution()), latencies, failures);
+}
+
+
+LoadGenerator::Result LoadGenerator::collect(const std::string& scenario, double seconds, const std::vector<std::vector<Timestamp::TimeDiff> >& latencies, int failures) const
+{
+	std::vector<Timestamp::TimeDiff> all;
+	for (std::vector<std::vector<Timestamp::TimeDiff> >::const_iterator it = latencies.begin(); it != latencies.end(); ++it)
+	{
+		all.insert(all.end(), it->begin(), it->end());
+	}
+	std::sort(all.begin(), all.end());
+
+	Result result;
+	result.scenario = scenario;
+	result.requests = static_cast<int>(all.size());
+	result.failures = failures;
+	result.seconds = seconds;
+	result.p50 = percentile(all, 50);
+	result.p90 = percentile(all, 90);
+	result.p99 = percentile(all, 99);
+	result.max = all.empty() ? 0 : all.back();
+	return result;
+}
@@ -0,0 +1,77 @@
+//
+// LoadGenerator.h
+//
+// Definition of the LoadGenerator class.
+//
+// Copyright (c) 2005-2019, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef LoadGenerator_INCLUDED
+#define LoadGenerator_INCLUDED
+
+
+#include "Poco/Timestamp.h"
+#include <string>
+#include <vector>
+
+
+class LoadGenerator
+	/// A multi-threaded HTTP load generator built on HTTPClientSession.
+	///
+	/// Every worker thread opens its own keep-alive session to the
+	/// server and issues its share of the requests back to back,
+	/// recording the latency of each request. When all workers have
+	/// finished, the individual measurements are merged and reported
+	/// as requests per second and latency percentiles.
+{
+public:
+	struct Result
+		/// The merged outcome of one load-generation run.
+	{
+		Result();
+
+		std::string scenario;
+		int requests;  /// completed requests
+		int failures;  /// failed requests (connection reset etc.)
+		double seconds; /// wall-clock duration of the run
+		Poco::Timestamp::TimeDiff p50; /// median latency [us]
+		Poco::Timestamp::TimeDiff p90; /// 90th percentile latency [us]
+		Poco::Timestamp::TimeDiff p99; /// 99th percentile latency [us]
+		Poco::Timestamp::TimeDiff max; /// maximum latency [us]
+
+		double requestsPerSecond() const;
+		void print() const;
+			/// Prints the result as a single report line.
+	};
+
+	LoadGenerator(const std::string& host, Poco::UInt16 port, int concurrency, int requestsPerWorker);
+		/// Creates the LoadGenerator for the given server, number of
+		/// concurrent workers and number of requests per worker.
+
+	Result run(const std::string& scenario, const std::string& path, const std::string& body = std::string());
+		/// Runs an HTTP scenario: every worker GETs the given path
+		/// (or POSTs the given body to it) requestsPerWorker times
+		/// over a keep-alive session.
+
+	Result runWebSocket(const std::string& scenario, const std::string& path, const std::string& payload);
+		/// Runs a WebSocket scenario: every worker opens a WebSocket
+		/// to the given path and performs requestsPerWorker
+		/// send/receive round trips with the given payload.
+
+protected:
+	Result collect(const std::string& scenario, double seconds, const std::vector<std::vector<Poco::Timestamp::TimeDiff> >& latencies, int failures) const;
+		/// Merges the per-worker latency measurements into a Result.
+
+private:
+	std::string _host;
+	Poco::UInt16 _port;
+	int _concurrency;
+	int _requestsPerWorker;
+};
+
+
+#endif // LoadGenerator_INCLUDED
@@ -0,0 +1,142 @@
+//
+// DNSResolver.h
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSResolver
+//
+// Definition of the DNSResolver class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_DNSResolver_INCLUDED
+#define Net_DNSResolver_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/DNS.h"
+#include "Poco/Net/HostEntry.h"
+#include "Poco/ActiveMethod.h"
+#include "Poco/ActiveResult.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API DNSResolver
+	/// An asynchronous, caching DNS resolver.
+	///
+	/// DNS::hostByName() serializes every lookup behind the
+	/// resolver library and blocks the calling thread until the
+	/// (possibly slow or unreachable) name server has answered.
+	/// A DNSResolver keeps a cache of positive and negative
+	/// lookup results, so that only the first lookup for a given
+	/// host name blocks. Once a cached entry has expired, it is
+	/// refreshed in the background while callers keep getting
+	/// the previous result, so a slow name server no longer
+	/// stalls connecting threads.
+	///
+	/// Since getaddrinfo() does not report record TTLs, positive
+	/// and negative cache lifetimes are fixed and configurable
+	/// (defaulting to 60 and 10 seconds, respectively).
+	///
+	/// Lookups can also be started asynchronously via the
+	/// hostByNameAsync() active method, which immediately
+	/// returns a Poco::ActiveResult<HostEntry>.
+	///
+	/// SocketAddress (and therefore HTTPClientSession and
+	/// everything else connecting by host name) resolves host
+	/// names through defaultResolver().
+{
+public:
+	typedef Poco::ActiveResult<HostEntry> HostEntryResult;
+
+	DNSResolver();
+		/// Creates the DNSResolver.
+
+	~DNSResolver();
+		/// Destroys the DNSResolver.
+
+	Poco::ActiveMethod<HostEntry, std::string, DNSResolver> hostByNameAsync;
+		/// Asynchronously resolves the given host name, updating
+		/// the cache. Returns a Poco::ActiveResult<HostEntry>
+		/// immediately; the lookup is performed on a thread from
+		/// the default thread pool.
+
+	HostEntry hostByName(const std::string& hostname);
+		/// Returns a HostEntry for the given host name.
+		///
+		/// A fresh cached entry is returned without blocking.
+		/// An expired positive entry is returned immediately as
+		/// well, and refreshed in the background. If no usable
+		/// entry is cached, performs a blocking lookup.
+		///
+		/// Throws a HostNotFoundException if the lookup failed,
+		/// also if a cached negative result has not expired yet.
+
+	void clearCache();
+		/// Removes all entries from the cache.
+		///
+		/// Should be called when the system's network
+		/// configuration has changed.
+
+	void setPositiveTimeToLive(long seconds);
+		/// Sets the lifetime of successful lookup results,
+		/// in seconds.
+
+	long getPositiveTimeToLive() const;
+		/// Returns the lifetime of successful lookup results,
+		/// in seconds.
+
+	void setNegativeTimeToLive(long seconds);
+		/// Sets the lifetime of failed lookup results,
+		/// in seconds.
+
+	long getNegativeTimeToLive() const;
+		/// Returns the lifetime of failed lookup results,
+		/// in seconds.
+
+	static DNSResolver& defaultResolver();
+		/// Returns the default DNSResolver, which is used by
+		/// SocketAddress to resolve host names.
+
+protected:
+	HostEntry resolveImpl(const std::string& hostname);
+		/// Performs a blocking lookup via DNS::hostByName()
+		/// and stores the (positive or negative) result in
+		/// the cache.
+
+private:
+	struct CacheEntry
+	{
+		HostEntry       entry;
+		std::string     error;
+		Poco::Timestamp expires;
+		bool            negative;
+		bool            refreshing;
+	};
+	typedef std::map<std::string, CacheEntry> CacheMap;
+
+	DNSResolver(const DNSResolver&);
+	DNSResolver& operator = (const DNSResolver&);
+
+	CacheMap        _cache;
+	long            _positiveTTL;
+	long            _negativeTTL;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_DNSResolver_INCLUDED
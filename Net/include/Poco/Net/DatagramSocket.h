@@ -128,6 +128,29 @@ public:
 		///
 		/// Returns the number of bytes received.
 
+	int sendMany(SocketMsgVec& messages, int flags = 0);
+		/// Sends multiple datagrams with a single sendmmsg()
+		/// system call where available, otherwise with one
+		/// sendTo() call per datagram. Each datagram is sent to
+		/// the address given in its SocketMsg; a default-constructed
+		/// address sends to the connected peer address.
+		///
+		/// Returns the number of datagrams sent.
+
+	int receiveMany(SocketMsgVec& messages, const Poco::Timespan& timeout = Poco::Timespan(), int flags = 0);
+		/// Receives up to messages.size() datagrams with a single
+		/// recvmmsg() system call where available, otherwise with
+		/// one receiveFrom() call per datagram.
+		///
+		/// Blocks until at least one datagram has been received,
+		/// then returns as many datagrams as can be received
+		/// without blocking. If a non-zero timeout is given, waits
+		/// at most that long for the batch to fill, and returns 0
+		/// if no datagram arrives within the timeout.
+		///
+		/// Returns the number of datagrams received; for each,
+		/// the SocketMsg's buffer, size and address are filled in.
+
 	void setBroadcast(bool flag);
 		/// Sets the value of the SO_BROADCAST socket option.
 		///
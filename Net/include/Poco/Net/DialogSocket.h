@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/StreamSocket.h"
 #include <cstdlib>
+#include <vector>
 
 
 namespace Poco {
@@ -48,19 +49,28 @@ class Net_API DialogSocket: public StreamSocket
 	/// DialogSocket's buffering. Use receiveRawBytes() instead.
 {
 public:
-	DialogSocket();
-		/// Creates an unconnected stream socket.
+	enum
+	{
+		RECEIVE_BUFFER_SIZE = 1024,
+		MAX_LINE_LENGTH     = 4096
+	};
+
+	explicit DialogSocket(std::size_t bufferSize = RECEIVE_BUFFER_SIZE);
+		/// Creates an unconnected stream socket with an internal
+		/// receive buffer of the given size.
 		///
 		/// Before sending or receiving data, the socket
 		/// must be connected with a call to connect().
 
-	explicit DialogSocket(const SocketAddress& address);
-		/// Creates a stream socket and connects it to
-		/// the socket specified by address.
+	explicit DialogSocket(const SocketAddress& address, std::size_t bufferSize = RECEIVE_BUFFER_SIZE);
+		/// Creates a stream socket with an internal receive buffer
+		/// of the given size and connects it to the socket specified
+		/// by address.
 
-	DialogSocket(const Socket& socket);
+	DialogSocket(const Socket& socket, std::size_t bufferSize = RECEIVE_BUFFER_SIZE);
 		/// Creates the DialogSocket with the SocketImpl
-		/// from another socket. The SocketImpl must be
+		/// from another socket and an internal receive buffer of the
+		/// given size. The SocketImpl must be
 		/// a StreamSocketImpl, otherwise an InvalidArgumentException
 		/// will be thrown.
 
@@ -108,6 +118,22 @@ public:
 		/// 
 		/// Returns true if a message has been read or false if
 		/// the connection has been closed by the peer.
+
+	bool receiveMessages(std::vector<std::string>& messages);
+		/// Receives a single-line message, terminated by CR-LF, from
+		/// the socket connection, followed by all further complete
+		/// messages held in the internal receive buffer, without
+		/// reading from the socket again.
+		///
+		/// Together with a sufficiently large receive buffer, this
+		/// allows line-oriented bulk data (e.g., a large FTP
+		/// directory listing) to be consumed with a single call per
+		/// network read instead of one call per line.
+		///
+		/// The previous content of messages is discarded.
+		///
+		/// Returns true if at least one message has been read or
+		/// false if the connection has been closed by the peer.
 	
 	int receiveStatusMessage(std::string& message);
 		/// Receives a single-line or multi-line response from
@@ -151,6 +177,9 @@ public:
 		/// Returns the number of bytes read, which may be
 		/// less than requested.
 
+	std::size_t bufferSize() const;
+		/// Returns the size of the internal receive buffer.
+
 	void synch();
 		/// Sends a TELNET SYNCH signal over the connection.
 		///
@@ -194,17 +223,25 @@ protected:
 private:
 	enum
 	{
-		RECEIVE_BUFFER_SIZE = 1024,
-		MAX_LINE_LENGTH     = 4096,
-		EOF_CHAR            = -1
+		EOF_CHAR = -1
 	};
 	
-	char* _pBuffer;
-	char* _pNext;
-	char* _pEnd;
+	char*       _pBuffer;
+	char*       _pNext;
+	char*       _pEnd;
+	std::size_t _bufferSize;
 };
 
 
+//
+// inlines
+//
+inline std::size_t DialogSocket::bufferSize() const
+{
+	return _bufferSize;
+}
+
+
 } } // namespace Poco::Net
 
 
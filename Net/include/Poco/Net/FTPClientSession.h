@@ -197,11 +197,25 @@ public:
 		/// Throws a FTPException in case of a FTP-specific error, or a
 		/// NetException in case of a general network communication failure.
 
-	std::istream& beginDownload(const std::string& path);
+	Poco::UInt64 fileSize(const std::string& path);
+		/// Returns the size of the file given by path, in bytes.
+		///
+		/// Sends a SIZE command with path as argument to the server.
+		///
+		/// Throws a FTPException in case of a FTP-specific error
+		/// (e.g., the server does not support the SIZE command), or a
+		/// NetException in case of a general network communication failure.
+
+	std::istream& beginDownload(const std::string& path, Poco::UInt64 offset = 0);
 		/// Starts downloading the file with the given name.
 		/// After all data has been read from the returned stream,
 		/// endDownload() must be called to finish the download.
 		///
+		/// If offset is greater than zero, a REST command is sent
+		/// before the transfer starts, and the download resumes at
+		/// the given byte offset in the file. Not all servers support
+		/// the REST command.
+		///
 		/// A stream for reading the file's content is returned.
 		/// The stream is valid until endDownload() is called.
 		///
@@ -222,11 +236,16 @@ public:
 		/// Must be called to complete a download initiated with
 		/// beginDownload().
 		
-	std::ostream& beginUpload(const std::string& path);
+	std::ostream& beginUpload(const std::string& path, Poco::UInt64 offset = 0);
 		/// Starts uploading the file with the given name.
 		/// After all data has been written to the returned stream,
 		/// endUpload() must be called to finish the upload.
 		///
+		/// If offset is greater than zero, a REST command is sent
+		/// before the transfer starts, and the uploaded data is
+		/// written to the file starting at the given byte offset.
+		/// Not all servers support the REST command.
+		///
 		/// A stream for reading the file's content is returned.
 		/// The stream is valid until endUpload() is called.
 		///
@@ -247,6 +266,25 @@ public:
 		/// Must be called to complete an upload initiated with
 		/// beginUpload().
 
+	void uploadFile(const std::string& localPath, const std::string& remotePath, Poco::UInt64 offset = 0, Poco::UInt64 count = 0);
+		/// Uploads the contents of the local file given by localPath
+		/// to the file given by remotePath on the server, starting
+		/// at the given byte offset in both files. If count is zero,
+		/// data is sent up to the end of the local file; otherwise,
+		/// exactly count bytes are sent.
+		///
+		/// A REST command is always sent before the STOR command, so
+		/// that the server writes the data in place at the given
+		/// offset instead of truncating the file. The server must
+		/// therefore support the REST command for uploads.
+		///
+		/// On Linux, the file contents are sent directly from the
+		/// file using the sendfile() system call, avoiding the copy
+		/// through a userspace buffer. On other platforms, a
+		/// buffered copy is used.
+		///
+		/// A separate call to endUpload() is not necessary.
+
 	std::istream& beginList(const std::string& path = "", bool extended = false);
 		/// Starts downloading a directory listing.
 		/// After all data has been read from the returned stream,
@@ -323,8 +361,10 @@ protected:
 	static bool isPermanentNegative(int status);
 	std::string extractPath(const std::string& response);
 	StreamSocket establishDataConnection(const std::string& command, const std::string& arg);
-	StreamSocket activeDataConnection(const std::string& command, const std::string& arg);
-	StreamSocket passiveDataConnection(const std::string& command, const std::string& arg);
+	StreamSocket establishDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart);
+	StreamSocket activeDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart);
+	StreamSocket passiveDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart);
+	void sendRestart(Poco::UInt64 offset);
 	void sendPortCommand(const SocketAddress& addr);
 	SocketAddress sendPassiveCommand();
 	bool sendEPRT(const SocketAddress& addr);
@@ -0,0 +1,118 @@
+//
+// FTPSegmentedTransfer.h
+//
+// Library: Net
+// Package: FTP
+// Module:  FTPSegmentedTransfer
+//
+// Definition of the FTPSegmentedTransfer class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_FTPSegmentedTransfer_INCLUDED
+#define Net_FTPSegmentedTransfer_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/FTPClientSession.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API FTPSegmentedTransfer
+	/// Transfers a large file over multiple parallel FTP sessions.
+	///
+	/// The file is split into equally sized segments and every
+	/// segment is transferred over its own control and data
+	/// connection, using the REST command to position the transfer
+	/// at the segment's byte offset. All segments of a download are
+	/// written into the shared local file, which is created with its
+	/// final size before the transfer starts, so the segments can be
+	/// written in place without reassembly. On high-latency links,
+	/// where a single TCP connection cannot fill the available
+	/// bandwidth, this can speed up the transfer considerably.
+	///
+	/// The server must support the SIZE and REST commands; for
+	/// uploads, REST must be supported for STOR transfers.
+	/// Transfers are always done in binary mode.
+{
+public:
+	enum
+	{
+		DEFAULT_SEGMENTS = 4
+	};
+
+	FTPSegmentedTransfer(const std::string& host,
+		Poco::UInt16 port = FTPClientSession::FTP_PORT,
+		const std::string& username = "",
+		const std::string& password = "");
+		/// Creates an FTPSegmentedTransfer for the given server.
+		///
+		/// No connection is made until a transfer is started; every
+		/// transfer opens one FTP session per segment, logging in
+		/// with the given username and password.
+
+	~FTPSegmentedTransfer();
+		/// Destroys the FTPSegmentedTransfer.
+
+	void setSegments(int segments);
+		/// Sets the number of parallel sessions used for a transfer.
+		///
+		/// Throws an InvalidArgumentException if segments is not
+		/// a positive number.
+
+	int getSegments() const;
+		/// Returns the number of parallel sessions used for a transfer.
+
+	Poco::UInt64 download(const std::string& remotePath, const std::string& localPath);
+		/// Downloads the file given by remotePath into the local file
+		/// given by localPath, which is created (or truncated) with
+		/// the size of the remote file before the transfer starts.
+		///
+		/// If a transfer must be restarted after a failure, a single
+		/// segment can be resumed with
+		/// FTPClientSession::beginDownload() and the offset of the
+		/// missing range.
+		///
+		/// Returns the size of the downloaded file.
+
+	void upload(const std::string& localPath, const std::string& remotePath);
+		/// Uploads the local file given by localPath to the file
+		/// given by remotePath on the server.
+		///
+		/// Every segment is sent with
+		/// FTPClientSession::uploadFile(), so on Linux the data is
+		/// sent directly from the file using sendfile().
+
+private:
+	FTPSegmentedTransfer(const FTPSegmentedTransfer&);
+	FTPSegmentedTransfer& operator = (const FTPSegmentedTransfer&);
+
+	std::string  _host;
+	Poco::UInt16 _port;
+	std::string  _username;
+	std::string  _password;
+	int          _segments;
+};
+
+
+//
+// inlines
+//
+inline int FTPSegmentedTransfer::getSegments() const
+{
+	return _segments;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_FTPSegmentedTransfer_INCLUDED
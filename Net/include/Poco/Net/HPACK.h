@@ -0,0 +1,242 @@
+//
+// HPACK.h
+//
+// Library: Net
+// Package: HTTP
+// Module:  HPACK
+//
+// Definition of the HPACKTable, HPACKEncoder and HPACKDecoder classes.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HPACK_INCLUDED
+#define Net_HPACK_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/NameValueCollection.h"
+#include <deque>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HPACKTable
+	/// The HPACK (RFC 7541) index address space, consisting of
+	/// the immutable static table of 61 common header fields and
+	/// a bounded dynamic table of recently seen fields.
+	///
+	/// Indices are one-based, as in the RFC: indices 1 to 61
+	/// address the static table, higher indices address the
+	/// dynamic table, newest entry first.
+	///
+	/// Encoder and decoder each maintain their own HPACKTable;
+	/// the protocol keeps the two in sync.
+{
+public:
+	struct Entry
+	{
+		std::string name;
+		std::string value;
+	};
+
+	enum
+	{
+		STATIC_TABLE_SIZE = 61,
+		ENTRY_OVERHEAD    = 32,   /// per-entry size overhead defined by RFC 7541, section 4.1
+		DEFAULT_MAX_SIZE  = 4096
+	};
+
+	HPACKTable(std::size_t maxSize = DEFAULT_MAX_SIZE);
+		/// Creates the HPACKTable with the given maximum
+		/// dynamic table size in octets.
+
+	~HPACKTable();
+		/// Destroys the HPACKTable.
+
+	const Entry& entry(std::size_t index) const;
+		/// Returns the entry with the given one-based index.
+		///
+		/// Throws a Poco::RangeException if the index does not
+		/// address an existing entry.
+
+	std::size_t find(const std::string& name, const std::string& value, bool& valueMatch) const;
+		/// Returns the lowest index of an entry with the given name,
+		/// preferring an entry that also matches the given value,
+		/// or 0 if the name is not in the table.
+		///
+		/// Sets valueMatch to true if the returned entry matches
+		/// both name and value.
+
+	void add(const std::string& name, const std::string& value);
+		/// Inserts the given field at the head of the dynamic
+		/// table, evicting entries from the tail as necessary
+		/// to stay within the maximum size.
+
+	void setMaxSize(std::size_t maxSize);
+		/// Changes the maximum dynamic table size, evicting
+		/// entries as necessary.
+
+	std::size_t getMaxSize() const;
+		/// Returns the maximum dynamic table size in octets.
+
+	std::size_t dynamicSize() const;
+		/// Returns the current dynamic table size in octets,
+		/// including the per-entry overhead.
+
+	std::size_t dynamicEntries() const;
+		/// Returns the number of entries in the dynamic table.
+
+private:
+	void evict();
+
+	std::deque<Entry> _dynamic;
+	std::size_t       _dynamicSize;
+	std::size_t       _maxSize;
+};
+
+
+class Net_API HPACKEncoder
+	/// Encodes header fields into an HPACK header block
+	/// (RFC 7541), for use by an HTTP/2 framing layer.
+	///
+	/// Fields that match a table entry are written as a single
+	/// index octet; other fields are written as literals and
+	/// entered into the dynamic table so that repetitions across
+	/// header blocks on the same connection compress to one or
+	/// two octets. Field names are written in lowercase, as
+	/// required by HTTP/2.
+	///
+	/// Strings are always written in raw form; Huffman coding
+	/// is optional for an encoder and not used.
+{
+public:
+	HPACKEncoder(std::size_t maxTableSize = HPACKTable::DEFAULT_MAX_SIZE);
+		/// Creates the HPACKEncoder with the given maximum
+		/// dynamic table size.
+
+	~HPACKEncoder();
+		/// Destroys the HPACKEncoder.
+
+	void encode(const NameValueCollection& fields, std::string& block);
+		/// Appends the encoding of the given fields, in order,
+		/// to the given header block.
+
+	void encode(const std::string& name, const std::string& value, std::string& block, bool sensitive = false);
+		/// Appends the encoding of a single field to the given
+		/// header block.
+		///
+		/// If sensitive is true, the field is encoded as
+		/// never-indexed (RFC 7541, section 6.2.3) and not
+		/// entered into the dynamic table; use this for fields
+		/// like Authorization or Cookie whose values must not
+		/// be at risk from compression-based attacks.
+
+	void setMaxTableSize(std::size_t maxTableSize);
+		/// Changes the maximum dynamic table size. The change is
+		/// signalled to the decoder at the start of the next
+		/// header block.
+
+	const HPACKTable& table() const;
+		/// Returns the encoder's index table.
+
+private:
+	HPACKEncoder(const HPACKEncoder&);
+	HPACKEncoder& operator = (const HPACKEncoder&);
+
+	static void appendInteger(std::string& block, unsigned char mask, int prefixBits, std::size_t value);
+	static void appendString(std::string& block, const std::string& str);
+
+	HPACKTable  _table;
+	std::size_t _pendingTableSize;
+	bool        _tableSizeChanged;
+};
+
+
+class Net_API HPACKDecoder
+	/// Decodes an HPACK header block (RFC 7541) into header
+	/// fields, for use by an HTTP/2 framing layer.
+	///
+	/// Huffman-coded string literals are not supported and are
+	/// rejected with a Poco::Net::HTTPException; the HPACKEncoder
+	/// never produces them.
+{
+public:
+	HPACKDecoder(std::size_t maxTableSize = HPACKTable::DEFAULT_MAX_SIZE);
+		/// Creates the HPACKDecoder with the given maximum
+		/// dynamic table size. The peer may lower the limit
+		/// via a dynamic table size update, but not raise it
+		/// beyond the given value.
+
+	~HPACKDecoder();
+		/// Destroys the HPACKDecoder.
+
+	void decode(const char* begin, const char* end, NameValueCollection& fields);
+		/// Decodes the complete header block in [begin, end)
+		/// and adds the decoded fields, in order, to the
+		/// given collection.
+		///
+		/// Throws a Poco::Net::HTTPException if the header block
+		/// is malformed or truncated.
+
+	void decode(const std::string& block, NameValueCollection& fields);
+		/// Decodes the complete header block.
+
+	const HPACKTable& table() const;
+		/// Returns the decoder's index table.
+
+private:
+	HPACKDecoder(const HPACKDecoder&);
+	HPACKDecoder& operator = (const HPACKDecoder&);
+
+	static std::size_t readInteger(const char*& it, const char* end, int prefixBits);
+	static void readString(const char*& it, const char* end, std::string& str);
+
+	HPACKTable  _table;
+	std::size_t _maxTableSize;
+};
+
+
+//
+// inlines
+//
+inline std::size_t HPACKTable::getMaxSize() const
+{
+	return _maxSize;
+}
+
+
+inline std::size_t HPACKTable::dynamicSize() const
+{
+	return _dynamicSize;
+}
+
+
+inline std::size_t HPACKTable::dynamicEntries() const
+{
+	return _dynamic.size();
+}
+
+
+inline const HPACKTable& HPACKEncoder::table() const
+{
+	return _table;
+}
+
+
+inline const HPACKTable& HPACKDecoder::table() const
+{
+	return _table;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HPACK_INCLUDED
@@ -29,18 +29,29 @@ namespace Net {
 
 class Net_API HTTPBufferAllocator
 	/// A BufferAllocator for HTTP streams.
+	///
+	/// Buffers are managed in three size tiers (4, 16 and 64
+	/// Kilobytes); a request is served by the smallest tier
+	/// that fits it, or directly from the heap if it exceeds
+	/// the largest tier. A small per-thread cache in front of
+	/// the shared, mutex-protected memory pools keeps the hot
+	/// allocate/deallocate path free of lock contention.
 {
 public:
 	static char* allocate(std::streamsize size);
+		/// Returns a buffer of at least the given size.
+
 	static void deallocate(char* ptr, std::streamsize size);
+		/// Returns a buffer obtained from allocate() (with the
+		/// same size) to the pool.
 
 	enum
 	{
-		BUFFER_SIZE = 4096
+		BUFFER_SIZE        = 4096,
+		BUFFER_SIZE_SMALL  = 4096,
+		BUFFER_SIZE_MEDIUM = 16384,
+		BUFFER_SIZE_LARGE  = 65536
 	};
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -36,6 +36,14 @@ class HTTPSession;
 class Net_API HTTPChunkedStreamBuf: public HTTPBasicStreamBuf
 	/// This is the streambuf class used for reading and writing
 	/// HTTP message bodies in chunked transfer coding.
+	///
+	/// Outgoing data is coalesced into chunks of up to
+	/// getMaxChunkSize() bytes, each sent to the session with a
+	/// single write, including the chunk size line and trailing
+	/// CRLF. Flushing the stream sends whatever has accumulated
+	/// as one chunk, so chunk sizes adapt to how the stream is
+	/// used: frequent flushes produce small, immediately sent
+	/// chunks, while bulk writes produce large ones.
 {
 public:
 	typedef HTTPBasicStreamBuf::openmode openmode;
@@ -44,14 +52,35 @@ public:
 	~HTTPChunkedStreamBuf();
 	void close();
 
+	void setMaxChunkSize(std::streamsize size);
+		/// Sets the maximum size of an outgoing chunk.
+
+	std::streamsize getMaxChunkSize() const;
+		/// Returns the maximum size of an outgoing chunk.
+
 protected:
 	int readFromDevice(char* buffer, std::streamsize length);
 	int writeToDevice(const char* buffer, std::streamsize length);
+	int sync();
 
 private:
+	void emitChunk(bool last = false);
+		/// Completes the buffered chunk and sends it to the
+		/// session with a single write, followed by the
+		/// terminating null chunk if last is true.
+
+	enum
+	{
+		CHUNK_HEADER_SIZE = 10,
+			/// Space reserved in front of the chunk payload for the
+			/// chunk size line: up to eight hex digits plus CRLF.
+		DEFAULT_MAX_CHUNK_SIZE = 16384
+	};
+
 	HTTPSession&    _session;
 	openmode        _mode;
 	std::streamsize _chunk;
+	std::streamsize _maxChunkSize;
 	std::string     _chunkBuffer;
 };
 
@@ -27,6 +27,11 @@
 
 
 namespace Poco {
+
+
+class URIView;
+
+
 namespace Net {
 
 
@@ -98,6 +103,10 @@ public:
 	HTTPClientSession(const std::string& host, Poco::UInt16 port = HTTPSession::HTTP_PORT);
 		/// Creates a HTTPClientSession using the given host and port.
 
+	explicit HTTPClientSession(const Poco::URIView& uri);
+		/// Creates a HTTPClientSession using the host and port of
+		/// the given URIView, without materializing a URI object.
+
 	HTTPClientSession(const std::string& host, Poco::UInt16 port, const ProxyConfig& proxyConfig);
 		/// Creates a HTTPClientSession using the given host, port and proxy configuration.
 
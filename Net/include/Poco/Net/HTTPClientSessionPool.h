@@ -0,0 +1,253 @@
+//
+// HTTPClientSessionPool.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientSessionPool
+//
+// Definition of the HTTPClientSessionPool class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPClientSessionPool_INCLUDED
+#define Net_HTTPClientSessionPool_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/ActiveMethod.h"
+#include "Poco/ActiveResult.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include "Poco/URI.h"
+#include <map>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTPExchange
+	/// Bundles an outbound HTTP request together with its body and,
+	/// after completion, the response and the response body.
+	///
+	/// HTTPExchange objects are passed to
+	/// HTTPClientSessionPool::sendRequestAsync(), which fills in the
+	/// response part.
+{
+public:
+	typedef Poco::SharedPtr<HTTPExchange> Ptr;
+
+	HTTPExchange(const Poco::URI& uri, const std::string& method = HTTPRequest::HTTP_GET);
+		/// Creates the HTTPExchange for the given URI and method.
+		///
+		/// The request's URI is set to the path and query of the
+		/// given URI.
+
+	~HTTPExchange();
+		/// Destroys the HTTPExchange.
+
+	const Poco::URI& uri() const;
+		/// Returns the URI the request is sent to.
+
+	HTTPRequest& request();
+		/// Returns the request, for setting additional headers.
+
+	std::string& requestBody();
+		/// Returns the request body, which can be filled in
+		/// before the exchange is started.
+
+	HTTPResponse& response();
+		/// Returns the response. Only valid after the
+		/// exchange has completed.
+
+	std::string& responseBody();
+		/// Returns the response body. Only valid after the
+		/// exchange has completed.
+
+private:
+	HTTPExchange();
+	HTTPExchange(const HTTPExchange&);
+	HTTPExchange& operator = (const HTTPExchange&);
+
+	Poco::URI    _uri;
+	HTTPRequest  _request;
+	std::string  _requestBody;
+	HTTPResponse _response;
+	std::string  _responseBody;
+};
+
+
+class Net_API HTTPClientSessionPool
+	/// A pool of HTTPClientSession objects, indexed by scheme,
+	/// host and port.
+	///
+	/// Every HTTPClientSession owns exactly one socket, so creating
+	/// a session per outbound request pays the TCP (and, for https,
+	/// TLS) connection setup every time. The pool keeps persistent
+	/// sessions alive between requests: acquire() returns a pooled
+	/// keep-alive session for the target if one is available, and
+	/// release() returns a session to the pool after the response
+	/// has been received. Sessions that have been idle for longer
+	/// than the maximum idle time are closed.
+	///
+	/// Sessions for https URIs are created through the
+	/// HTTPSessionFactory, so the HTTPS session instantiator from
+	/// the NetSSL library must have been registered.
+	///
+	/// A complete request/response exchange can also be performed
+	/// asynchronously via the sendRequestAsync() active method,
+	/// which runs the exchange on a thread from the default thread
+	/// pool and immediately returns a Poco::ActiveResult, allowing
+	/// a single thread to keep many outbound requests in flight.
+{
+public:
+	typedef Poco::SharedPtr<HTTPClientSession> SessionPtr;
+
+	HTTPClientSessionPool(int maxSessionsPerHost = DEFAULT_MAX_SESSIONS_PER_HOST, long maxIdleTime = DEFAULT_MAX_IDLE_TIME);
+		/// Creates the HTTPClientSessionPool, keeping at most
+		/// maxSessionsPerHost idle sessions per target, each for
+		/// at most maxIdleTime seconds.
+
+	~HTTPClientSessionPool();
+		/// Destroys the HTTPClientSessionPool and closes all
+		/// pooled sessions.
+
+	Poco::ActiveMethod<HTTPExchange::Ptr, HTTPExchange::Ptr, HTTPClientSessionPool> sendRequestAsync;
+		/// Asynchronously performs the complete exchange: sends the
+		/// request with its body over a pooled session, receives the
+		/// response and the response body, and returns the session
+		/// to the pool.
+		///
+		/// Returns a Poco::ActiveResult<HTTPExchange::Ptr>
+		/// immediately; the result yields the given exchange with
+		/// the response filled in, or carries the exception if the
+		/// exchange failed.
+
+	SessionPtr acquire(const Poco::URI& uri);
+		/// Returns a session for the given URI, reusing a pooled
+		/// keep-alive session if one is available, or creating a
+		/// new one otherwise.
+		///
+		/// Throws a Poco::UnknownURISchemeException if the URI
+		/// scheme is neither http nor handled by the
+		/// HTTPSessionFactory.
+
+	void release(SessionPtr pSession);
+		/// Returns the given session to the pool.
+		///
+		/// Sessions that are no longer connected, do not have the
+		/// keep-alive flag set, or exceed the per-target limit are
+		/// closed instead.
+
+	void closeIdle();
+		/// Closes all pooled sessions that have been idle for
+		/// longer than the maximum idle time. Also performed
+		/// on every acquire().
+
+	void clear();
+		/// Closes all pooled sessions.
+
+	int getMaxSessionsPerHost() const;
+		/// Returns the maximum number of idle sessions kept
+		/// per target.
+
+	long getMaxIdleTime() const;
+		/// Returns the maximum session idle time in seconds.
+
+	static HTTPClientSessionPool& defaultPool();
+		/// Returns the default HTTPClientSessionPool.
+
+	enum
+	{
+		DEFAULT_MAX_SESSIONS_PER_HOST = 8,
+		DEFAULT_MAX_IDLE_TIME = 60
+	};
+
+protected:
+	HTTPExchange::Ptr exchangeImpl(const HTTPExchange::Ptr& pExchange);
+		/// Performs the complete exchange on a pooled session.
+
+private:
+	struct PooledSession
+	{
+		SessionPtr      pSession;
+		Poco::Timestamp idleSince;
+	};
+	typedef std::vector<PooledSession> SessionVec;
+	typedef std::map<std::string, SessionVec> SessionMap;
+
+	HTTPClientSessionPool(const HTTPClientSessionPool&);
+	HTTPClientSessionPool& operator = (const HTTPClientSessionPool&);
+
+	void closeIdleImpl();
+		/// Evicts idle sessions; must be called with the mutex held.
+
+	static std::string keyFor(const std::string& scheme, const std::string& host, Poco::UInt16 port);
+		/// Returns the pool key for the given target.
+
+	SessionMap      _pool;
+	int             _maxSessionsPerHost;
+	long            _maxIdleTime;
+	Poco::FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline const Poco::URI& HTTPExchange::uri() const
+{
+	return _uri;
+}
+
+
+inline HTTPRequest& HTTPExchange::request()
+{
+	return _request;
+}
+
+
+inline std::string& HTTPExchange::requestBody()
+{
+	return _requestBody;
+}
+
+
+inline HTTPResponse& HTTPExchange::response()
+{
+	return _response;
+}
+
+
+inline std::string& HTTPExchange::responseBody()
+{
+	return _responseBody;
+}
+
+
+inline int HTTPClientSessionPool::getMaxSessionsPerHost() const
+{
+	return _maxSessionsPerHost;
+}
+
+
+inline long HTTPClientSessionPool::getMaxIdleTime() const
+{
+	return _maxIdleTime;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPClientSessionPool_INCLUDED
@@ -0,0 +1,142 @@
+//
+// HTTPFileCache.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPFileCache
+//
+// Definition of the HTTPFileCache class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPFileCache_INCLUDED
+#define Net_HTTPFileCache_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Mutex.h"
+#include <list>
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPServerRequest;
+class HTTPServerResponse;
+
+
+class Net_API HTTPFileCache
+	/// An in-process cache of memory-mapped static files for
+	/// HTTP request handlers.
+	///
+	/// Serving a file through HTTPServerResponse::sendFile()
+	/// opens, reads and closes the file for every request. The
+	/// cache memory-maps hot files once and serves subsequent
+	/// requests from the mapping, with precomputed ETag and
+	/// Last-Modified header values; conditional requests
+	/// (If-None-Match, If-Modified-Since) are answered with
+	/// 304 Not Modified without touching the file data.
+	///
+	/// The cache is bounded by total mapped bytes, with
+	/// least-recently-used eviction. Files larger than the
+	/// per-file limit bypass the cache and are delegated to
+	/// HTTPServerResponse::sendFile(), which uses the kernel's
+	/// zero-copy file send on plain connections. A cached
+	/// file's modification time and size are checked on every
+	/// request, so an updated file replaces its stale mapping.
+	///
+	/// All members are thread-safe; one HTTPFileCache is meant
+	/// to be shared by all request handler instances.
+{
+public:
+	HTTPFileCache(std::size_t maxSize = DEFAULT_MAX_SIZE, std::size_t maxFileSize = DEFAULT_MAX_FILE_SIZE);
+		/// Creates the HTTPFileCache, caching at most maxSize
+		/// bytes in total and only files no larger than
+		/// maxFileSize bytes.
+
+	~HTTPFileCache();
+		/// Destroys the HTTPFileCache and unmaps all files.
+
+	void send(HTTPServerRequest& request, HTTPServerResponse& response, const std::string& path, const std::string& mediaType);
+		/// Sends the given file as response to the given request.
+		///
+		/// Answers conditional requests with 304 Not Modified if
+		/// the client's cached copy is still fresh, serves cached
+		/// files from their mapping, and falls back to
+		/// HTTPServerResponse::sendFile() for files too large to
+		/// cache.
+		///
+		/// Throws a Poco::OpenFileException if the file cannot
+		/// be opened.
+
+	std::size_t size() const;
+		/// Returns the total number of cached bytes.
+
+	std::size_t cachedFiles() const;
+		/// Returns the number of cached files.
+
+	void clear();
+		/// Unmaps all cached files.
+
+	enum
+	{
+		DEFAULT_MAX_SIZE      = 64*1024*1024,
+		DEFAULT_MAX_FILE_SIZE = 1024*1024
+	};
+
+private:
+	struct Entry
+	{
+		Poco::SharedMemory mapping;
+		const char*        data;
+		std::size_t        size;
+		std::string        etag;
+		std::string        lastModifiedField;
+		Poco::Timestamp    lastModified;
+	};
+	typedef Poco::SharedPtr<Entry> EntryPtr;
+	typedef std::list<std::string> LRUList;
+
+	struct CacheSlot
+	{
+		EntryPtr          pEntry;
+		LRUList::iterator lruIt;
+	};
+	typedef std::map<std::string, CacheSlot> CacheMap;
+
+	HTTPFileCache(const HTTPFileCache&);
+	HTTPFileCache& operator = (const HTTPFileCache&);
+
+	EntryPtr get(const std::string& path);
+		/// Returns a fresh entry for the given file, mapping or
+		/// remapping it as needed, or null if the file exceeds
+		/// the per-file limit.
+
+	void evict();
+		/// Evicts least-recently-used entries until the total
+		/// size is within bounds; must be called with the
+		/// mutex held.
+
+	std::size_t _maxSize;
+	std::size_t _maxFileSize;
+	std::size_t _size;
+	CacheMap    _cache;
+	LRUList     _lru;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPFileCache_INCLUDED
@@ -0,0 +1,79 @@
+//
+// HTTPHeaderParser.h
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPHeaderParser
+//
+// Definition of the HTTPHeaderParser class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPHeaderParser_INCLUDED
+#define Net_HTTPHeaderParser_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPSession;
+class HTTPRequest;
+
+
+class Net_API HTTPHeaderParser
+	/// HTTPHeaderParser parses a HTTP request header directly
+	/// from the receive buffer of a HTTPSession.
+	///
+	/// HTTPRequest::read() and MessageHeader::read() consume their
+	/// input one character at a time through the std::istream
+	/// interface, which costs a virtual streambuf call per
+	/// character. If the complete header is already available in
+	/// the session's receive buffer (the common case for requests
+	/// arriving over a LAN), HTTPHeaderParser scans the buffered
+	/// bytes in a single pass instead, locating line and token
+	/// delimiters a machine word at a time.
+	///
+	/// The parser enforces the same size limits and follows the
+	/// same lenient parsing rules (ignoring malformed header
+	/// lines, supporting folded field values) as the stream-based
+	/// implementations. If the header extends beyond the buffered
+	/// data, nothing is consumed and the caller must fall back to
+	/// stream-based parsing, which can read across buffer refills.
+{
+public:
+	static bool parse(HTTPSession& session, HTTPRequest& request);
+		/// Attempts to parse a complete HTTP request header (request
+		/// line, header fields and terminating empty line) from the
+		/// session's receive buffer into the given HTTPRequest.
+		///
+		/// If the buffer is empty, it is refilled from the socket
+		/// first.
+		///
+		/// Returns true if the header has been parsed and consumed
+		/// from the buffer. Returns false, consuming nothing, if the
+		/// buffered data does not contain a complete header; the
+		/// caller must then parse via HTTPRequest::read().
+		///
+		/// Throws a MessageException if the buffered header violates
+		/// the size limits defined by HTTPRequest and MessageHeader.
+
+private:
+	HTTPHeaderParser();
+	HTTPHeaderParser(const HTTPHeaderParser&);
+	HTTPHeaderParser& operator = (const HTTPHeaderParser&);
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPHeaderParser_INCLUDED
@@ -23,6 +23,11 @@
 
 
 namespace Poco {
+
+
+class URIView;
+
+
 namespace Net {
 
 
@@ -49,6 +54,11 @@ public:
 	HTTPRequest(const std::string& method, const std::string& uri, const std::string& version);
 		/// Creates a HTTP request with the given method, URI and version.
 
+	HTTPRequest(const std::string& method, const Poco::URIView& uri);
+		/// Creates a HTTP/1.0 request with the given method; the
+		/// request URI is taken from the path and query of the given
+		/// URIView (see setURI()).
+
 	virtual ~HTTPRequest();
 		/// Destroys the HTTPRequest.
 
@@ -60,7 +70,13 @@ public:
 
 	void setURI(const std::string& uri);
 		/// Sets the request URI.
-		
+
+	void setURI(const Poco::URIView& uri);
+		/// Sets the request URI to the path and query of the given
+		/// URIView, without copying or decoding any other part of
+		/// the viewed URI. If the view's path is empty, the request
+		/// URI is set to "/".
+
 	const std::string& getURI() const;
 		/// Returns the request URI.
 		
@@ -182,6 +182,12 @@ public:
 		/// Writes the HTTP response to the given
 		/// output stream.
 
+	void write(std::string& str) const;
+		/// Appends the HTTP response head (status line,
+		/// headers and delimiting empty line) to the
+		/// given string, so that it can be sent with
+		/// a single write.
+
 	void read(std::istream& istr);
 		/// Reads the HTTP response from the
 		/// given input stream.
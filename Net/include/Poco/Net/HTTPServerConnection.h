@@ -56,6 +56,8 @@ private:
 	HTTPRequestHandlerFactory::Ptr _pFactory;
 	bool _stopped;
 	Poco::FastMutex _mutex;
+
+	friend class HTTPServerConnectionFactory;
 };
 
 
@@ -42,7 +42,15 @@ public:
 	TCPServerConnection* createConnection(const StreamSocket& socket);
 		/// Creates an instance of HTTPServerConnection
 		/// using the given StreamSocket.
-	
+
+	bool supportsReset() const;
+		/// Returns true; HTTPServerConnection objects can be
+		/// recycled across connections.
+
+	void resetConnection(TCPServerConnection* pConnection, const StreamSocket& socket);
+		/// Reinitializes the given HTTPServerConnection for the
+		/// given StreamSocket.
+
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
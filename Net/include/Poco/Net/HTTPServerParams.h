@@ -95,6 +95,19 @@ public:
 		/// during a persistent connection, or 0 if
 		/// unlimited connections are allowed.
 
+	void setBufferSize(std::size_t bufferSize);
+		/// Sets the size of the session receive buffer used
+		/// for HTTP connections (default 4096). Sizes matching
+		/// one of the HTTPBufferAllocator tiers (4, 16 or 64
+		/// Kilobytes) are served from the pooled buffers.
+		///
+		/// A larger buffer reduces the number of receive system
+		/// calls for requests with large headers.
+
+	std::size_t getBufferSize() const;
+		/// Returns the size of the session receive buffer used
+		/// for HTTP connections.
+
 protected:
 	virtual ~HTTPServerParams();
 		/// Destroys the HTTPServerParams.
@@ -106,12 +119,19 @@ private:
 	bool           _keepAlive;
 	int            _maxKeepAliveRequests;
 	Poco::Timespan _keepAliveTimeout;
+	std::size_t    _bufferSize;
 };
 
 
 //
 // inlines
 //
+inline std::size_t HTTPServerParams::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
 inline const std::string& HTTPServerParams::getServerName() const
 {
 	return _serverName;
@@ -50,14 +50,20 @@ public:
 	
 	SocketAddress clientAddress();
 		/// Returns the client's address.
-		
+
 	SocketAddress serverAddress();
 		/// Returns the server's address.
-		
+
+	std::string& headBuffer();
+		/// Returns the scratch buffer used to serialize
+		/// response heads, which is reused for all responses
+		/// sent over the connection.
+
 private:
 	bool           _firstRequest;
 	Poco::Timespan _keepAliveTimeout;
 	int            _maxKeepAliveRequests;
+	std::string    _headBuffer;
 };
 
 
@@ -70,6 +76,12 @@ inline bool HTTPServerSession::canKeepAlive() const
 }
 
 
+inline std::string& HTTPServerSession::headBuffer()
+{
+	return _headBuffer;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -61,6 +61,19 @@ public:
 	Poco::Timespan getTimeout() const;
 		/// Returns the timeout for the HTTP session.
 
+	void setBufferSize(std::size_t bufferSize);
+		/// Sets the size of the session's receive buffer.
+		///
+		/// Must be called before the first request or response
+		/// is read over this session. Sizes matching one of the
+		/// HTTPBufferAllocator tiers (4, 16 or 64 Kilobytes) are
+		/// served from the pooled buffers; other sizes come from
+		/// the heap. Larger buffers reduce the number of receive
+		/// system calls for requests with large headers or bodies.
+
+	std::size_t getBufferSize() const;
+		/// Returns the size of the session's receive buffer.
+
 	bool connected() const;
 		/// Returns true if the underlying socket is connected.
 
@@ -190,6 +203,7 @@ private:
 	
 	StreamSocket     _socket;
 	char*            _pBuffer;
+	std::size_t      _bufferSize;
 	char*            _pCurrent;
 	char*            _pEnd;
 	bool             _keepAlive;
@@ -200,6 +214,7 @@ private:
 	Poco::Any        _data;
 	
 	friend class HTTPStreamBuf;
+	friend class HTTPHeaderParser;
 	friend class HTTPHeaderStreamBuf;
 	friend class HTTPFixedLengthStreamBuf;
 	friend class HTTPChunkedStreamBuf;
@@ -23,6 +23,7 @@
 #include "Poco/Net/ICMPEventArgs.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/BasicEvent.h"
+#include <vector>
 
 
 namespace Poco {
@@ -59,9 +60,28 @@ public:
 	int ping(const std::string& address, int repeat = 1) const;
 		/// Calls ICMPClient::ping(SocketAddress&, int) and
 		/// returns the result.
-		/// 
+		///
 		/// Returns the number of valid replies.
 
+	int sweep(const std::vector<SocketAddress>& targets, int maxInFlight = DEFAULT_SWEEP_WINDOW) const;
+		/// Pings all given addresses concurrently over a single
+		/// socket, with at most maxInFlight unanswered echo requests
+		/// outstanding at any time. Replies are matched to their
+		/// hosts by sequence number, so a sweep of a large address
+		/// range completes in roughly the time of the slowest reply
+		/// per window rather than one timeout per unreachable host.
+		///
+		/// For every target, pingBegin is posted when its request is
+		/// sent, followed by either pingReply or pingError (on
+		/// timeout), and finally pingEnd.
+		///
+		/// Returns the number of hosts that replied.
+
+	enum
+	{
+		DEFAULT_SWEEP_WINDOW = 64
+	};
+
 	static int ping(SocketAddress& address,
 		SocketAddress::Family family,
 		int repeat = 1,
@@ -63,9 +63,15 @@ public:
 		/// Supplied buffer includes IP header, ICMP header and data.
 
 	bool validReplyID(Poco::UInt8* buffer, int length) const;
-		/// Returns true if the extracted id is recognized 
+		/// Returns true if the extracted id is recognized
 		/// (equals the process id).
-		///	
+		///
+		/// Supplied buffer includes IP header, ICMP header and data.
+
+	Poco::UInt16 replySequence(Poco::UInt8* buffer, int length) const;
+		/// Returns the sequence number extracted from the reply
+		/// packet in the supplied buffer.
+		///
 		/// Supplied buffer includes IP header, ICMP header and data.
 
 	std::string errorDescription(Poco::UInt8* buffer, int length);
@@ -65,9 +65,16 @@ public:
 		/// Must be overriden.
 
 	virtual bool validReplyID(unsigned char* buffer, int length) const = 0;
-		/// Returns true if the extracted id is recognized 
+		/// Returns true if the extracted id is recognized
 		/// (i.e. equals the process id).
-		///	
+		///
+		/// Supplied buffer includes IP header, ICMP header and data.
+		/// Must be overriden.
+
+	virtual Poco::UInt16 replySequence(Poco::UInt8* buffer, int length) const = 0;
+		/// Returns the sequence number extracted from the reply
+		/// packet in the supplied buffer.
+		///
 		/// Supplied buffer includes IP header, ICMP header and data.
 		/// Must be overriden.
 
@@ -48,6 +48,16 @@ public:
 		///
 		/// Returns the time elapsed since the originating request was sent.
 
+	int receiveRawFrom(void* buffer, int length, SocketAddress& address, int flags = 0);
+		/// Receives a single raw ICMP packet from the socket, without
+		/// reply validation or timeout handling.
+		/// Stores the address of the sender in address.
+		///
+		/// Returns the number of bytes received.
+
+	ICMPPacket& packet();
+		/// Returns the ICMP packet sent by the socket.
+
 	int dataSize() const;
 		/// Returns the data size in bytes.
 
@@ -76,6 +86,12 @@ inline int ICMPSocketImpl::dataSize() const
 }
 
 
+inline ICMPPacket& ICMPSocketImpl::packet()
+{
+	return _icmpPacket;
+}
+
+
 inline int ICMPSocketImpl::ttl() const
 {
 	return _ttl;
@@ -135,6 +135,12 @@ public:
 		///
 		/// Buffer includes IP header, ICMP header and data.
 
+	Poco::UInt16 replySequence(Poco::UInt8* buffer, int length) const;
+		/// Returns the sequence number extracted from the reply
+		/// packet in the supplied buffer.
+		///
+		/// Buffer includes IP header, ICMP header and data.
+
 	virtual std::string errorDescription(Poco::UInt8* buffer, int length);
 		/// Returns error description string.
 		/// If supplied buffer contains ICMPv4 echo reply packet, an
@@ -162,8 +168,6 @@ private:
 	static const std::string REDIRECT_MESSAGE_CODE[REDIRECT_MESSAGE_LENGTH];
 	static const std::string TIME_EXCEEDED_CODE[TIME_EXCEEDED_LENGTH];
 	static const std::string PARAMETER_PROBLEM_CODE[PARAMETER_PROBLEM_LENGTH];
-
-	Poco::UInt16 _seq;
 };
 
 
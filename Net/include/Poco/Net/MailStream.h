@@ -58,6 +58,11 @@ public:
 protected:
 	int readFromDevice();
 	int writeToDevice(char c);
+	std::streamsize xsputn(const char* s, std::streamsize count);
+		/// Bulk override: dot-stuffs a whole block in one pass
+		/// and forwards it to the output stream with a single
+		/// write, so block transfers (e.g. encoded attachments)
+		/// do not pay a virtual call per character.
 	int readOne();
 
 private:
@@ -67,9 +67,14 @@ public:
 		///
 		/// The format is one name-value pair per line, with
 		/// name and value separated by a colon and lines
-		/// delimited by a carriage return and a linefeed 
+		/// delimited by a carriage return and a linefeed
 		/// character. See RFC 2822 for details.
-		
+
+	void write(std::string& str) const;
+		/// Appends the message header to the given string,
+		/// in the same format as write(std::ostream&), but
+		/// without the per-field stream overhead.
+
 	virtual void read(std::istream& istr);
 		/// Reads the message header from the given input stream.
 		///
@@ -21,9 +21,16 @@
 #include "Poco/Net/Net.h"
 #include "Poco/String.h"
 #include "Poco/ListMap.h"
+#include "Poco/Types.h"
+#include <vector>
 #include <cstddef>
 
 
+#if defined(POCO_ENABLE_CPP11) || (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+	#define POCO_NVC_HAVE_RVALUE_REFS
+#endif
+
+
 namespace Poco {
 namespace Net {
 
@@ -48,12 +55,24 @@ public:
 	NameValueCollection(const NameValueCollection& nvc);
 		/// Creates a NameValueCollection by copying another one.
 
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+	NameValueCollection(NameValueCollection&& nvc);
+		/// Creates a NameValueCollection by moving the name-value
+		/// pairs of another one, leaving the other one empty.
+#endif
+
 	virtual ~NameValueCollection();
 		/// Destroys the NameValueCollection.
 
 	NameValueCollection& operator = (const NameValueCollection& nvc);
 		/// Assigns the name-value pairs of another NameValueCollection to this one.
-		
+
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+	NameValueCollection& operator = (NameValueCollection&& nvc);
+		/// Moves the name-value pairs of another NameValueCollection
+		/// to this one, leaving the other one empty.
+#endif
+
 	void swap(NameValueCollection& nvc);
 		/// Swaps the NameValueCollection with another one.
 		
@@ -62,12 +81,36 @@ public:
 		///
 		/// Throws a NotFoundException if the name-value pair does not exist.
 		
-	void set(const std::string& name, const std::string& value);	
+	void set(const std::string& name, const std::string& value);
 		/// Sets the value of the (first) name-value pair with the given name.
-		
+
+	void set(const char* name, std::size_t length, const std::string& value);
+		/// Sets the value of the (first) name-value pair with the given name,
+		/// given as a pointer and a length, avoiding the construction of a
+		/// temporary name string if the pair already exists.
+
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+	void set(const std::string& name, std::string&& value);
+		/// Sets the value of the (first) name-value pair with the
+		/// given name, taking ownership of the given value string.
+#endif
+
 	void add(const std::string& name, const std::string& value);
 		/// Adds a new name-value pair with the given name and value.
-		
+
+	void add(const char* name, std::size_t length, const std::string& value);
+		/// Adds a new name-value pair with the given name, given as a
+		/// pointer and a length, and the given value.
+		///
+		/// If the name is a standard header name (see findInternedName()),
+		/// the interned name is used and no name string is constructed.
+
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+	void add(const std::string& name, std::string&& value);
+		/// Adds a new name-value pair with the given name, taking
+		/// ownership of the given value string.
+#endif
+
 	const std::string& get(const std::string& name) const;
 		/// Returns the value of the first name-value pair with the given name.
 		///
@@ -77,10 +120,25 @@ public:
 		/// Returns the value of the first name-value pair with the given name.
 		/// If no value with the given name has been found, the defaultValue is returned.
 
+	const std::string& get(const char* name, std::size_t length) const;
+		/// Returns the value of the first name-value pair with the given name,
+		/// given as a pointer and a length.
+		///
+		/// Throws a NotFoundException if the name-value pair does not exist.
+
+	const std::string& get(const char* name, std::size_t length, const std::string& defaultValue) const;
+		/// Returns the value of the first name-value pair with the given name,
+		/// given as a pointer and a length.
+		/// If no value with the given name has been found, the defaultValue is returned.
+
 	bool has(const std::string& name) const;
 		/// Returns true if there is at least one name-value pair
 		/// with the given name.
 
+	bool has(const char* name, std::size_t length) const;
+		/// Returns true if there is at least one name-value pair
+		/// with the given name, given as a pointer and a length.
+
 	ConstIterator find(const std::string& name) const;
 		/// Returns an iterator pointing to the first name-value pair
 		/// with the given name.
@@ -106,8 +164,50 @@ public:
 	void clear();
 		/// Removes all name-value pairs and their values.
 
+	static const std::string* findInternedName(const char* name, std::size_t length);
+		/// Returns a pointer to the interned (canonically capitalized)
+		/// name string if the given name is a standard HTTP/MIME header
+		/// name (Content-Length, Host, etc.), or a null pointer otherwise.
+		///
+		/// A perfect hash over the name's length and a few discriminating
+		/// characters narrows the lookup to at most one candidate, which
+		/// is then verified with a case-insensitive comparison.
+
 private:
+	enum
+	{
+		INDEX_THRESHOLD = 8
+			/// Minimum number of name-value pairs before lookups
+			/// go through the hash index instead of a linear scan.
+	};
+
+	struct IndexEntry
+	{
+		Poco::UInt32 hash;
+		const HeaderMap::ValueType* pPair;
+	};
+	typedef std::vector<IndexEntry> Index;
+
+	const std::string* findValue(const char* name, std::size_t length) const;
+		/// Returns a pointer to the value of the first name-value pair
+		/// with the given name, or a null pointer if there is none.
+		/// Uses the hash index once the collection has grown beyond
+		/// INDEX_THRESHOLD pairs.
+
+	std::string* findValue(const char* name, std::size_t length);
+
+	void buildIndex() const;
+		/// Rebuilds the hash index from the current map contents.
+
+	static Poco::UInt32 hashName(const char* name, std::size_t length);
+		/// Returns a case-insensitive hash of the given name.
+
+	static bool lessHash(const IndexEntry& entry1, const IndexEntry& entry2);
+		/// Orders index entries by hash.
+
 	HeaderMap _map;
+	mutable Index _index;
+	mutable bool  _indexValid;
 };
 
 
@@ -27,6 +27,7 @@
 #include "Poco/Net/IPAddress.h"
 #include "Poco/Mutex.h"
 #include "Poco/Tuple.h"
+#include "Poco/Timespan.h"
 #include <map>
 #include <ostream>
 
@@ -277,9 +278,26 @@ public:
 		/// Otherwise, both interfaces being up and down are returned.
 		///
 		/// If there are multiple addresses bound to one interface,
-		/// they are contained within the NetworkInterface (second) 
+		/// they are contained within the NetworkInterface (second)
 		/// member of the pair.
 
+	static void setCacheTimeout(const Poco::Timespan& timeout);
+		/// Sets the time for which the cached interface snapshot
+		/// used by forName(), forAddress() and forIndex() remains
+		/// valid. The default timeout is one second.
+		///
+		/// Setting a timeout of zero disables caching; every lookup
+		/// then enumerates the system's interfaces, as map() does.
+
+	static Poco::Timespan getCacheTimeout();
+		/// Returns the time for which the cached interface snapshot
+		/// remains valid.
+
+	static void invalidateCache();
+		/// Discards the cached interface snapshot, forcing the next
+		/// lookup to re-enumerate the system's interfaces. Call this
+		/// after the interface configuration is known to have changed.
+
 protected:
 	NetworkInterface(const std::string& name, const std::string& displayName, const std::string& adapterName, const IPAddress& address, unsigned index, MACAddress* pMACAddress = 0);
 		/// Creates the NetworkInterface.
@@ -317,6 +335,11 @@ protected:
 	NetworkInterfaceImpl& impl() { return *_pImpl; };
 
 private:
+	static Map cachedMap();
+		/// Returns a snapshot of all system network interfaces
+		/// (including interfaces being down or without IP address),
+		/// served from the cache while it is valid.
+
 	NetworkInterfaceImpl* _pImpl;
 
 	static Poco::FastMutex _mutex;
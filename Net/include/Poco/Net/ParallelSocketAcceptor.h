@@ -84,6 +84,36 @@ public:
 			ReadableNotification>(*this, &ParallelSocketAcceptor::onAccept));
 	}
 
+	ParallelSocketAcceptor(const SocketAddress& address,
+		unsigned threads = Poco::Environment::processorCount(),
+		int backlog = 64):
+		_pReactor(0),
+		_threads(threads),
+		_next(0)
+		/// Creates a ParallelSocketAcceptor with one listening socket
+		/// per reactor thread, all bound to the given address with the
+		/// SO_REUSEPORT option set, so that the kernel distributes
+		/// incoming connections across the per-socket accept queues
+		/// instead of funnelling them through a single queue.
+		///
+		/// Each listening socket's accept events are handled by its
+		/// own reactor thread. On platforms without SO_REUSEPORT
+		/// support, binding will fail for all but the first socket.
+	{
+		init();
+		for (unsigned i = 0; i < _threads; ++i)
+		{
+			ServerSocket ss;
+			ss.bind(address, true, true);
+			ss.listen(backlog);
+			if (i == 0) _socket = ss;
+			_sockets.push_back(ss);
+			_reactors[i]->addEventHandler(ss,
+				Poco::Observer<ParallelSocketAcceptor,
+				ReadableNotification>(*this, &ParallelSocketAcceptor::onAccept));
+		}
+	}
+
 	virtual ~ParallelSocketAcceptor()
 		/// Destroys the ParallelSocketAcceptor.
 	{
@@ -95,6 +125,12 @@ public:
 					Poco::Observer<ParallelSocketAcceptor,
 					ReadableNotification>(*this, &ParallelSocketAcceptor::onAccept));
 			}
+			for (std::size_t i = 0; i < _sockets.size(); ++i)
+			{
+				_reactors[i]->removeEventHandler(_sockets[i],
+					Poco::Observer<ParallelSocketAcceptor,
+					ReadableNotification>(*this, &ParallelSocketAcceptor::onAccept));
+			}
 		}
 		catch (...)
 		{
@@ -150,12 +186,19 @@ public:
 	}
 	
 	void onAccept(ReadableNotification* pNotification)
-		/// Accepts connection and creates event handler.
+		/// Accepts connections and creates their event handlers,
+		/// draining the accept queue of the socket that became
+		/// readable before returning to the reactor.
 	{
+		ServerSocket socket(pNotification->socket());
 		pNotification->release();
-		StreamSocket sock = _socket.acceptConnection();
-		_pReactor->wakeUp();
-		createServiceHandler(sock);
+		do
+		{
+			StreamSocket sock = socket.acceptConnection();
+			if (_pReactor) _pReactor->wakeUp();
+			createServiceHandler(sock);
+		}
+		while (socket.poll(0, Socket::SELECT_READ));
 	}
 
 protected:
@@ -220,6 +263,7 @@ private:
 	ParallelSocketAcceptor& operator = (const ParallelSocketAcceptor&);
 
 	ServerSocket   _socket;
+	std::vector<ServerSocket> _sockets;
 	SocketReactor* _pReactor;
 	unsigned       _threads;
 	ReactorVec     _reactors;
@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Socket.h"
 #include <map>
+#include <vector>
 
 
 namespace Poco {
@@ -46,6 +47,27 @@ public:
 
 	typedef std::map<Poco::Net::Socket, int> SocketModeMap;
 
+	struct SocketEvent
+		/// The result of polling a single socket: the socket
+		/// and the OR'd modes of the events that occurred on it.
+	{
+		SocketEvent():
+			mode(0)
+		{
+		}
+
+		SocketEvent(const Socket& s, int m):
+			socket(s),
+			mode(m)
+		{
+		}
+
+		Socket socket;
+		int    mode;
+	};
+
+	typedef std::vector<SocketEvent> SocketEventVec;
+
 	PollSet();
 		/// Creates an empty PollSet.
 
@@ -72,6 +94,16 @@ public:
 		/// Returns a PollMap containing the sockets that have had
 		/// their state changed.
 
+	std::size_t poll(const Poco::Timespan& timeout, SocketEventVec& events);
+		/// Waits until the state of at least one of the PollSet's sockets
+		/// changes accordingly to its mode, or the timeout expires.
+		/// Clears the given vector and fills it with the sockets that
+		/// have had their state changed. Returns the number of events.
+		///
+		/// Unlike the map-returning overload, this one performs no
+		/// allocations once the vector's capacity has been reached,
+		/// so it is the preferred form for tight polling loops.
+
 private:
 	PollSetImpl* _pImpl;
 
@@ -132,6 +132,34 @@ public:
 		/// is copied without any checking. Only the completion status is checked and,
 		/// if not valid, SMTPExcpetion is thrown.
 
+	int sendMessages(const std::vector<const MailMessage*>& messages);
+		/// Sends all given mail messages over the single open connection.
+		/// The envelope commands of every message are pipelined if the
+		/// server supports ESMTP PIPELINING (RFC 2920).
+		///
+		/// If a message is rejected by the server, a RSET command is sent
+		/// and delivery continues with the next message.
+		///
+		/// Returns the number of messages accepted by the server.
+
+	void reset();
+		/// Aborts the current mail transaction by sending a RSET command.
+		///
+		/// Can be used to recover a session for further messages after
+		/// a message has been rejected by the server.
+		///
+		/// Throws a SMTPException in case of a SMTP-specific error, or a
+		/// NetException in case of a general network communication failure.
+
+	bool supportsPipelining() const;
+		/// Returns true if the server has announced support for ESMTP
+		/// command pipelining (RFC 2920) in its EHLO response.
+		///
+		/// When pipelining is supported, the MAIL FROM and RCPT TO
+		/// commands of a message are sent in a single batch and their
+		/// responses are collected afterwards, saving one network
+		/// round trip per envelope command.
+
 	int sendCommand(const std::string& command, std::string& response);
 		/// Sends the given command verbatim to the server
 		/// and waits for a response.
@@ -188,10 +216,12 @@ protected:
 
 private:
 	void sendCommands(const MailMessage& message, const Recipients* pRecipients = 0);
+	void sendEnvelope(const std::string& from, const Recipients& recipients);
 	void transportMessage(const MailMessage& message);
 
 	DialogSocket _socket;
 	bool         _isOpen;
+	bool         _pipelining;
 };
 
 
@@ -228,6 +258,12 @@ inline DialogSocket& SMTPClientSession::socket()
 }
 
 
+inline bool SMTPClientSession::supportsPipelining() const
+{
+	return _pipelining;
+}
+
+
 } } // namespace Poco::Net
 
 
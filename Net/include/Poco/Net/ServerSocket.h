@@ -207,6 +207,25 @@ public:
 		///
 		/// The client socket's address is returned in clientAddr.
 
+	virtual StreamSocket acceptConnection(SocketAddress& clientAddr, bool nonBlocking);
+		/// Get the next completed connection from the
+		/// socket's completed connection queue.
+		///
+		/// If the queue is empty, waits until a connection
+		/// request completes.
+		///
+		/// If nonBlocking is true, the accepted socket is put
+		/// into non-blocking mode; on Linux this is done
+		/// atomically using accept4() with SOCK_NONBLOCK,
+		/// saving the extra fcntl() system call. This is
+		/// useful for event-driven servers, which must put
+		/// every accepted socket into non-blocking mode anyway.
+		///
+		/// Returns a new TCP socket for the connection
+		/// with the client.
+		///
+		/// The client socket's address is returned in clientAddr.
+
 	virtual StreamSocket acceptConnection();
 		/// Gets the next completed connection from the
 		/// socket's completed connection queue.
@@ -284,6 +284,11 @@ public:
 	static bool supportsIPv6();
 		/// Returns true if the system supports IPv6.
 
+	static SocketBuf makeBuffer(void* buffer, std::size_t length);
+		/// Creates and returns a SocketBuf referring to the given
+		/// memory region, for use with the scatter/gather
+		/// (vectored) sendBytes() and receiveBytes() overloads.
+
 	void init(int af);
 		/// Creates the underlying system socket for the given
 		/// address family.
@@ -132,6 +132,7 @@
 	#include <errno.h>
 	#include <sys/types.h>
 	#include <sys/socket.h>
+	#include <sys/uio.h>
 	#include <sys/un.h>
 	#include <fcntl.h>
 	#if POCO_OS != POCO_OS_HPUX
@@ -347,10 +348,24 @@
 #endif
 
 
+#include <vector>
+
+
 namespace Poco {
 namespace Net {
 
 
+#if defined(POCO_OS_FAMILY_WINDOWS)
+typedef WSABUF SocketBuf;
+#else
+typedef struct iovec SocketBuf;
+#endif
+typedef std::vector<SocketBuf> SocketBufVec;
+	/// A vector of buffers for scatter/gather (vectored) socket I/O.
+	/// Use Socket::makeBuffer() to create the buffer entries in a
+	/// platform-independent way.
+
+
 struct AddressFamily
 	/// AddressFamily::Family replaces the previously used IPAddress::Family
 	/// enumeration and is now used for IPAddress::Family and SocketAddress::Family.
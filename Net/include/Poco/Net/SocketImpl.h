@@ -26,9 +26,40 @@
 
 
 namespace Poco {
+
+
+class FileInputStream;
+
+
 namespace Net {
 
 
+struct Net_API SocketMsg
+	/// A single datagram in a batched sendMany()/receiveMany()
+	/// call (see DatagramSocket).
+{
+	SocketMsg();
+		/// Creates an empty SocketMsg.
+
+	SocketMsg(void* buffer, std::size_t length);
+		/// Creates a SocketMsg with the given payload buffer.
+
+	SocketMsg(void* buffer, std::size_t length, const SocketAddress& addr);
+		/// Creates a SocketMsg with the given payload buffer
+		/// and destination address.
+
+	void* data() const;
+		/// Returns the payload buffer pointer.
+
+	SocketBuf     buf;     /// payload buffer
+	SocketAddress address; /// destination (sendMany) or source (receiveMany)
+	int           size;    /// payload bytes sent or received
+};
+
+
+typedef std::vector<SocketMsg> SocketMsgVec;
+
+
 class Net_API SocketImpl: public Poco::RefCountedObject
 	/// This class encapsulates the Berkeley sockets API.
 	///
@@ -45,6 +76,14 @@ public:
 		SELECT_ERROR = 4
 	};
 
+	enum IOStatus
+	{
+		IO_OK = 0,     /// operation completed (possibly partially)
+		IO_WOULD_BLOCK,/// operation would block on a nonblocking socket
+		IO_TIMEOUT,    /// operation timed out on a blocking socket
+		IO_ERROR       /// operation failed
+	};
+
 	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr);
 		/// Get the next completed connection from the
 		/// socket's completed connection queue.
@@ -57,6 +96,21 @@ public:
 		///
 		/// The client socket's address is returned in clientAddr.
 
+	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr, bool nonBlocking);
+		/// Get the next completed connection from the
+		/// socket's completed connection queue.
+		///
+		/// If the queue is empty, waits until a connection
+		/// request completes.
+		///
+		/// If nonBlocking is true, the accepted socket is put
+		/// into non-blocking mode; on Linux this is done
+		/// atomically using accept4() with SOCK_NONBLOCK,
+		/// saving the extra fcntl() system call.
+		///
+		/// Returns a new TCP socket for the connection
+		/// with the client.
+
 	virtual void connect(const SocketAddress& address);
 		/// Initializes the socket and establishes a connection to
 		/// the TCP server at the given address.
@@ -167,6 +221,14 @@ public:
 		/// Certain socket implementations may also return a negative
 		/// value denoting a certain condition.
 
+	virtual int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Sends the contents of the given buffers through the
+		/// socket with a single system call (scatter/gather I/O,
+		/// using sendmsg() or WSASend()).
+		///
+		/// Returns the total number of bytes sent, which may be
+		/// less than the number of bytes specified.
+
 	virtual int receiveBytes(void* buffer, int length, int flags = 0);
 		/// Receives data from the socket and stores it
 		/// in buffer. Up to length bytes are received.
@@ -176,6 +238,60 @@ public:
 		/// Certain socket implementations may also return a negative
 		/// value denoting a certain condition.
 
+	virtual int receiveBytes(SocketBufVec& buffers, int flags = 0);
+		/// Receives data from the socket and stores it in the given
+		/// buffers, filled in order, with a single system call
+		/// (scatter/gather I/O, using recvmsg() or WSARecv()).
+		///
+		/// Returns the total number of bytes received.
+
+	virtual IOStatus trySendBytes(const void* buffer, int length, int& bytesSent, int flags = 0) noexcept;
+		/// Sends the contents of the given buffer through the socket,
+		/// like sendBytes(), but reports would-block, timeout and
+		/// error conditions through the returned status instead of
+		/// throwing exceptions. The number of bytes sent, which may
+		/// be less than the number of bytes specified, is returned
+		/// in bytesSent.
+		///
+		/// Intended for hot nonblocking I/O loops (e.g., reactor
+		/// event handlers), where a would-block condition is an
+		/// expected outcome and the cost of constructing and
+		/// throwing an exception for it matters.
+
+	virtual IOStatus tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags = 0) noexcept;
+		/// Receives data from the socket and stores it in buffer,
+		/// like receiveBytes(), but reports would-block, timeout and
+		/// error conditions through the returned status instead of
+		/// throwing exceptions. The number of bytes received is
+		/// returned in bytesReceived; a graceful shutdown of the
+		/// connection by the peer is reported as IO_OK with
+		/// bytesReceived == 0.
+
+	virtual IOStatus tryConnect(const SocketAddress& address) noexcept;
+		/// Initializes the socket, puts it into nonblocking mode and
+		/// initiates a connection to the TCP server at the given
+		/// address, like connectNB(), but reports a connection in
+		/// progress as IO_WOULD_BLOCK and failures as IO_ERROR
+		/// instead of throwing exceptions. Once the socket becomes
+		/// writable, the outcome of the connection attempt can be
+		/// obtained from socketError().
+
+	virtual Poco::Int64 sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset = 0, Poco::Int64 count = 0);
+		/// Sends count bytes of the given file through the socket,
+		/// starting at the given file offset. If count is 0, sends
+		/// everything from offset up to the end of the file.
+		///
+		/// Uses the operating system's zero-copy facility where
+		/// available (sendfile() on Linux and macOS, TransmitFile()
+		/// on Windows); elsewhere the file content is copied through
+		/// an intermediate buffer.
+		///
+		/// Layered socket implementations that transform the byte
+		/// stream (SecureStreamSocketImpl, WebSocketImpl) do not
+		/// support sendFile() and throw a Poco::InvalidAccessException.
+		///
+		/// Returns the number of bytes sent.
+
 	virtual int sendTo(const void* buffer, int length, const SocketAddress& address, int flags = 0);
 		/// Sends the contents of the given buffer through
 		/// the socket to the given address.
@@ -190,6 +306,35 @@ public:
 		///
 		/// Returns the number of bytes received.
 
+	virtual int sendMany(SocketMsgVec& messages, int flags = 0);
+		/// Sends multiple datagrams with a single sendmmsg() system
+		/// call where available, otherwise with one sendTo() call
+		/// per datagram. Each datagram is sent to the address given
+		/// in its SocketMsg; a default-constructed address sends to
+		/// the connected peer address.
+		///
+		/// On return, the size member of every sent SocketMsg
+		/// contains the number of payload bytes sent.
+		///
+		/// Returns the number of datagrams sent.
+
+	virtual int receiveMany(SocketMsgVec& messages, const Poco::Timespan& timeout = Poco::Timespan(), int flags = 0);
+		/// Receives up to messages.size() datagrams with a single
+		/// recvmmsg() system call where available, otherwise with
+		/// one receiveFrom() call per datagram.
+		///
+		/// Blocks until at least one datagram has been received,
+		/// then returns as many datagrams as can be received
+		/// without blocking. If a non-zero timeout is given, waits
+		/// at most that long for the batch to fill, and returns 0
+		/// if no datagram arrives within the timeout.
+		///
+		/// For every received datagram, the buffer referenced by
+		/// its SocketMsg is filled in, size is set to the number of
+		/// payload bytes and address to the sender's address.
+		///
+		/// Returns the number of datagrams received.
+
 	virtual void sendUrgent(unsigned char data);
 		/// Sends one byte of urgent data through
 		/// the socket.
@@ -466,6 +611,56 @@ private:
 //
 // inlines
 //
+inline SocketMsg::SocketMsg():
+	size(0)
+{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	buf.buf = 0;
+	buf.len = 0;
+#else
+	buf.iov_base = 0;
+	buf.iov_len  = 0;
+#endif
+}
+
+
+inline SocketMsg::SocketMsg(void* buffer, std::size_t length):
+	size(0)
+{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	buf.buf = reinterpret_cast<char*>(buffer);
+	buf.len = static_cast<ULONG>(length);
+#else
+	buf.iov_base = buffer;
+	buf.iov_len  = length;
+#endif
+}
+
+
+inline SocketMsg::SocketMsg(void* buffer, std::size_t length, const SocketAddress& addr):
+	address(addr),
+	size(0)
+{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	buf.buf = reinterpret_cast<char*>(buffer);
+	buf.len = static_cast<ULONG>(length);
+#else
+	buf.iov_base = buffer;
+	buf.iov_len  = length;
+#endif
+}
+
+
+inline void* SocketMsg::data() const
+{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	return buf.buf;
+#else
+	return buf.iov_base;
+#endif
+}
+
+
 inline poco_socket_t SocketImpl::sockfd() const
 {
 	return _sockfd;
@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
+#include "Poco/Net/PollSet.h"
 #include "Poco/Runnable.h"
 #include "Poco/Timespan.h"
 #include "Poco/Observer.h"
@@ -69,7 +70,11 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// as argument.
 	///
 	/// Once started, the SocketReactor waits for events
-	/// on the registered sockets, using Socket::select().
+	/// on the registered sockets, using a PollSet (which is
+	/// implemented with epoll on Linux and poll on other
+	/// platforms, where available). Only sockets that actually
+	/// have an event pending are visited, so a reactor scales
+	/// to a large number of mostly idle connections.
 	/// If an event is detected, the corresponding event handler
 	/// is invoked. There are five event types (and corresponding
 	/// notification classes) defined: ReadableNotification, WritableNotification,
@@ -208,6 +213,19 @@ private:
 
 	void dispatch(NotifierPtr& pNotifier, SocketNotification* pNotification);
 
+	NotifierPtr getNotifier(const Socket& socket, bool makeNew = false);
+		/// Returns the notifier for the given socket, creating
+		/// and registering it if makeNew is true and the socket
+		/// has no notifier yet.
+
+	bool hasSocketHandlers();
+		/// Returns true if at least one registered notifier
+		/// accepts readable, writable or error notifications.
+
+	int pollMode(NotifierPtr& pNotifier);
+		/// Returns the PollSet mode matching the notifications
+		/// accepted by the given notifier.
+
 	enum
 	{
 		DEFAULT_TIMEOUT = 250000
@@ -216,6 +234,7 @@ private:
 	bool            _stop;
 	Poco::Timespan  _timeout;
 	EventHandlerMap _handlers;
+	PollSet         _pollSet;
 	NotificationPtr _pReadableNotification;
 	NotificationPtr _pWritableNotification;
 	NotificationPtr _pErrorNotification;
@@ -36,29 +36,51 @@ class Net_API SocketStreamBuf: public Poco::BufferedBidirectionalStreamBuf
 	/// This is the streambuf class used for reading from and writing to a socket.
 {
 public:
-	SocketStreamBuf(const Socket& socket);
-		/// Creates a SocketStreamBuf with the given socket.
+	enum
+	{
+		STREAM_BUFFER_SIZE = 1024
+	};
+
+	SocketStreamBuf(const Socket& socket, std::streamsize bufferSize = STREAM_BUFFER_SIZE);
+		/// Creates a SocketStreamBuf with the given socket and
+		/// internal buffer size.
 		///
 		/// The socket's SocketImpl must be a StreamSocketImpl,
 		/// otherwise an InvalidArgumentException is thrown.
 
 	~SocketStreamBuf();
 		/// Destroys the SocketStreamBuf.
-		
+
 	StreamSocketImpl* socketImpl() const;
 		/// Returns the internal SocketImpl.
-	
+
+	void cork();
+		/// Holds back partial frames until uncork() is called,
+		/// so that consecutive small writes do not produce
+		/// sub-MSS packets.
+		///
+		/// On Linux, this sets the TCP_CORK socket option. On
+		/// other platforms, the Nagle algorithm is enabled
+		/// instead.
+
+	void uncork();
+		/// Flushes the internal buffer and releases any frames
+		/// held back by cork().
+
+	bool corked() const;
+		/// Returns true iff cork() has been called and not yet
+		/// been followed by uncork().
+
 protected:
 	int readFromDevice(char* buffer, std::streamsize length);
 	int writeToDevice(const char* buffer, std::streamsize length);
+	std::streamsize xsputn(const char* s, std::streamsize count);
 
 private:
-	enum 
-	{
-		STREAM_BUFFER_SIZE = 1024
-	};
-
 	StreamSocketImpl* _pImpl;
+	std::streamsize   _bufferSize;
+	bool _corked;
+	bool _noDelay;
 };
 
 
@@ -70,26 +92,36 @@ class Net_API SocketIOS: public virtual std::ios
 	/// order of the stream buffer and base classes.
 {
 public:
-	SocketIOS(const Socket& socket);
-		/// Creates the SocketIOS with the given socket.
+	SocketIOS(const Socket& socket, std::streamsize bufferSize = SocketStreamBuf::STREAM_BUFFER_SIZE);
+		/// Creates the SocketIOS with the given socket and
+		/// internal buffer size.
 		///
 		/// The socket's SocketImpl must be a StreamSocketImpl,
 		/// otherwise an InvalidArgumentException is thrown.
-		
+
 	~SocketIOS();
 		/// Destroys the SocketIOS.
 		///
 		/// Flushes the buffer, but does not close the socket.
-		
+
 	SocketStreamBuf* rdbuf();
 		/// Returns a pointer to the internal SocketStreamBuf.
-		
+
 	void close();
 		/// Flushes the stream and closes the socket.
-		
+
 	StreamSocket socket() const;
 		/// Returns the underlying socket.
 
+	void cork();
+		/// Holds back partial frames until uncork() is called.
+		///
+		/// See SocketStreamBuf::cork().
+
+	void uncork();
+		/// Flushes the stream and releases any frames held
+		/// back by cork().
+
 protected:
 	SocketStreamBuf _buf;
 };
@@ -99,8 +131,9 @@ class Net_API SocketOutputStream: public SocketIOS, public std::ostream
 	/// An output stream for writing to a socket.
 {
 public:
-	explicit SocketOutputStream(const Socket& socket);
-		/// Creates the SocketOutputStream with the given socket.
+	explicit SocketOutputStream(const Socket& socket, std::streamsize bufferSize = SocketStreamBuf::STREAM_BUFFER_SIZE);
+		/// Creates the SocketOutputStream with the given socket
+		/// and internal buffer size.
 		///
 		/// The socket's SocketImpl must be a StreamSocketImpl,
 		/// otherwise an InvalidArgumentException is thrown.
@@ -125,8 +158,9 @@ class Net_API SocketInputStream: public SocketIOS, public std::istream
 	/// istream with formatted reads.
 {
 public:
-	explicit SocketInputStream(const Socket& socket);
-		/// Creates the SocketInputStream with the given socket.
+	explicit SocketInputStream(const Socket& socket, std::streamsize bufferSize = SocketStreamBuf::STREAM_BUFFER_SIZE);
+		/// Creates the SocketInputStream with the given socket
+		/// and internal buffer size.
 		///
 		/// The socket's SocketImpl must be a StreamSocketImpl,
 		/// otherwise an InvalidArgumentException is thrown.
@@ -149,8 +183,9 @@ class Net_API SocketStream: public SocketIOS, public std::iostream
 	/// istream with formatted reads.
 {
 public:
-	explicit SocketStream(const Socket& socket);
-		/// Creates the SocketStream with the given socket.
+	explicit SocketStream(const Socket& socket, std::streamsize bufferSize = SocketStreamBuf::STREAM_BUFFER_SIZE);
+		/// Creates the SocketStream with the given socket and
+		/// internal buffer size.
 		///
 		/// The socket's SocketImpl must be a StreamSocketImpl,
 		/// otherwise an InvalidArgumentException is thrown.
@@ -171,6 +206,12 @@ inline StreamSocketImpl* SocketStreamBuf::socketImpl() const
 }
 
 
+inline bool SocketStreamBuf::corked() const
+{
+	return _corked;
+}
+
+
 } } // namespace Poco::Net
 
 
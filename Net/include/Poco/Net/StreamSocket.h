@@ -24,6 +24,11 @@
 
 
 namespace Poco {
+
+
+class FileInputStream;
+
+
 namespace Net {
 
 
@@ -107,6 +112,13 @@ public:
 		/// Certain socket implementations may also return a negative
 		/// value denoting a certain condition.
 
+	int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Sends the contents of the given buffers through the
+		/// socket with a single system call (scatter/gather I/O).
+		///
+		/// Returns the total number of bytes sent, which may be
+		/// less than the number of bytes specified.
+
 	int sendBytes(Poco::FIFOBuffer& buffer);
 		/// Sends the contents of the given buffer through
 		/// the socket. FIFOBuffer has writable/readable transition
@@ -132,6 +144,56 @@ public:
 		/// been set and nothing is received within that interval.
 		/// Throws a NetException (or a subclass) in case of other errors.
 
+	int receiveBytes(SocketBufVec& buffers, int flags = 0);
+		/// Receives data from the socket and stores it in the
+		/// given buffers, filled in order, with a single system
+		/// call (scatter/gather I/O).
+		///
+		/// Returns the total number of bytes received.
+
+	SocketImpl::IOStatus trySendBytes(const void* buffer, int length, int& bytesSent, int flags = 0) noexcept;
+		/// Sends the contents of the given buffer through the socket,
+		/// like sendBytes(), but reports would-block, timeout and
+		/// error conditions through the returned status instead of
+		/// throwing exceptions. The number of bytes sent is returned
+		/// in bytesSent.
+		///
+		/// Intended for hot nonblocking I/O loops (e.g., reactor
+		/// event handlers), where a would-block condition is an
+		/// expected outcome.
+
+	SocketImpl::IOStatus tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags = 0) noexcept;
+		/// Receives data from the socket and stores it in buffer,
+		/// like receiveBytes(), but reports would-block, timeout and
+		/// error conditions through the returned status instead of
+		/// throwing exceptions. The number of bytes received is
+		/// returned in bytesReceived; a graceful shutdown of the
+		/// connection by the peer is reported as IO_OK with
+		/// bytesReceived == 0.
+
+	SocketImpl::IOStatus tryConnect(const SocketAddress& address) noexcept;
+		/// Initializes the socket, puts it into nonblocking mode and
+		/// initiates a connection to the TCP server at the given
+		/// address, like connectNB(), but reports a connection in
+		/// progress as IO_WOULD_BLOCK and failures as IO_ERROR
+		/// instead of throwing exceptions. Once the socket becomes
+		/// writable, the outcome of the connection attempt can be
+		/// obtained from impl()->socketError().
+
+	Poco::Int64 sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset = 0, Poco::Int64 count = 0);
+		/// Sends count bytes of the given file through the socket,
+		/// starting at the given file offset. If count is 0, sends
+		/// everything from offset up to the end of the file.
+		///
+		/// Uses the operating system's zero-copy facility where
+		/// available.
+		///
+		/// Not supported by sockets that transform the byte stream
+		/// (SecureStreamSocket, WebSocket); these throw a
+		/// Poco::InvalidAccessException.
+		///
+		/// Returns the number of bytes sent.
+
 	int receiveBytes(Poco::FIFOBuffer& buffer);
 		/// Receives data from the socket and stores it
 		/// in buffer. Up to length bytes are received. FIFOBuffer has 
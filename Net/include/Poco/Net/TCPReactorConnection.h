@@ -0,0 +1,135 @@
+//
+// TCPReactorConnection.h
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorConnection
+//
+// Definition of the TCPReactorConnection class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_TCPReactorConnection_INCLUDED
+#define Net_TCPReactorConnection_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/AutoPtr.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API TCPReactorConnection
+	/// The abstract base class for event-driven connections
+	/// served by a TCPReactorServer.
+	///
+	/// Unlike TCPServerConnection, which occupies a worker thread
+	/// for its entire lifetime, a TCPReactorConnection is driven
+	/// by callbacks from a SocketReactor that is shared by many
+	/// connections. The socket is put into non-blocking mode;
+	/// onReadable() and onWritable() must therefore never block
+	/// and should transfer only as much data as the socket can
+	/// handle without blocking.
+	///
+	/// Subclasses must override onReadable(), which is called
+	/// whenever data can be read from the socket. A subclass that
+	/// needs to write more data than the socket accepts at once
+	/// calls setWantWrite(true) and completes the write in
+	/// onWritable() callbacks.
+	///
+	/// A connection deletes itself by calling close(), which
+	/// a subclass should also call when the peer has shut down
+	/// the connection (receiveBytes() returning 0).
+{
+public:
+	TCPReactorConnection(const StreamSocket& socket, SocketReactor& reactor);
+		/// Creates the TCPReactorConnection, puts the socket into
+		/// non-blocking mode and registers the connection's event
+		/// handlers with the given SocketReactor.
+
+	StreamSocket& socket();
+		/// Returns a reference to the connection's socket.
+
+	SocketReactor& reactor();
+		/// Returns a reference to the connection's SocketReactor.
+
+protected:
+	virtual ~TCPReactorConnection();
+		/// Destroys the TCPReactorConnection and unregisters its
+		/// event handlers.
+		///
+		/// Connections delete themselves via close(); therefore
+		/// the destructor is protected.
+
+	virtual void onReadable() = 0;
+		/// Called by the reactor whenever data can be read from
+		/// the socket. Must not block.
+
+	virtual void onWritable();
+		/// Called by the reactor whenever data can be written to
+		/// the socket and setWantWrite(true) has been called.
+		/// Must not block.
+		///
+		/// The default implementation does nothing.
+
+	virtual void onError();
+		/// Called by the reactor when an error has been reported
+		/// for the socket.
+		///
+		/// The default implementation calls close().
+
+	void setWantWrite(bool flag);
+		/// Enables or disables onWritable() callbacks.
+		///
+		/// Writability callbacks are disabled by default, since a
+		/// mostly idle socket is almost always writable and would
+		/// otherwise busy-loop the reactor.
+
+	void close();
+		/// Unregisters the connection's event handlers, closes the
+		/// socket and deletes the connection.
+
+private:
+	void onReadableNf(const Poco::AutoPtr<ReadableNotification>& pNf);
+	void onWritableNf(const Poco::AutoPtr<WritableNotification>& pNf);
+	void onErrorNf(const Poco::AutoPtr<ErrorNotification>& pNf);
+
+	TCPReactorConnection();
+	TCPReactorConnection(const TCPReactorConnection&);
+	TCPReactorConnection& operator = (const TCPReactorConnection&);
+
+	StreamSocket   _socket;
+	SocketReactor& _reactor;
+	bool           _wantWrite;
+};
+
+
+//
+// inlines
+//
+inline StreamSocket& TCPReactorConnection::socket()
+{
+	return _socket;
+}
+
+
+inline SocketReactor& TCPReactorConnection::reactor()
+{
+	return _reactor;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_TCPReactorConnection_INCLUDED
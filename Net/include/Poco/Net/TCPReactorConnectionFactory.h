@@ -0,0 +1,89 @@
+//
+// TCPReactorConnectionFactory.h
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorConnectionFactory
+//
+// Definition of the TCPReactorConnectionFactory class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_TCPReactorConnectionFactory_INCLUDED
+#define Net_TCPReactorConnectionFactory_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/TCPReactorConnection.h"
+#include "Poco/SharedPtr.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API TCPReactorConnectionFactory
+	/// A factory for TCPReactorConnection objects.
+	///
+	/// The TCPReactorServer class uses a TCPReactorConnectionFactory
+	/// to create a connection object for each new connection
+	/// it accepts.
+	///
+	/// Subclasses must override the createConnection()
+	/// method.
+	///
+	/// The TCPReactorConnectionFactoryImpl template class
+	/// can be used to automatically instantiate a
+	/// TCPReactorConnectionFactory for a given subclass
+	/// of TCPReactorConnection.
+{
+public:
+	typedef Poco::SharedPtr<TCPReactorConnectionFactory> Ptr;
+
+	virtual ~TCPReactorConnectionFactory();
+		/// Destroys the TCPReactorConnectionFactory.
+
+	virtual TCPReactorConnection* createConnection(const StreamSocket& socket, SocketReactor& reactor) = 0;
+		/// Creates an instance of a subclass of TCPReactorConnection,
+		/// using the given StreamSocket and SocketReactor.
+
+protected:
+	TCPReactorConnectionFactory();
+		/// Creates the TCPReactorConnectionFactory.
+
+private:
+	TCPReactorConnectionFactory(const TCPReactorConnectionFactory&);
+	TCPReactorConnectionFactory& operator = (const TCPReactorConnectionFactory&);
+};
+
+
+template <class S>
+class TCPReactorConnectionFactoryImpl: public TCPReactorConnectionFactory
+	/// This template provides a basic implementation of
+	/// TCPReactorConnectionFactory.
+{
+public:
+	TCPReactorConnectionFactoryImpl()
+	{
+	}
+
+	~TCPReactorConnectionFactoryImpl()
+	{
+	}
+
+	TCPReactorConnection* createConnection(const StreamSocket& socket, SocketReactor& reactor)
+	{
+		return new S(socket, reactor);
+	}
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_TCPReactorConnectionFactory_INCLUDED
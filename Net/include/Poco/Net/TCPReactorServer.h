@@ -0,0 +1,120 @@
+//
+// TCPReactorServer.h
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorServer
+//
+// Definition of the TCPReactorServer class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_TCPReactorServer_INCLUDED
+#define Net_TCPReactorServer_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/Net/TCPReactorConnectionFactory.h"
+#include "Poco/Thread.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/AutoPtr.h"
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API TCPReactorServer
+	/// An event-driven TCP server, complementing TCPServer.
+	///
+	/// While TCPServer devotes a pooled thread to every live
+	/// connection, a TCPReactorServer multiplexes all connections
+	/// over a small, fixed number of SocketReactor event threads.
+	/// This allows a process to serve far more concurrent
+	/// connections than it could run threads, provided the
+	/// connection handlers never block.
+	///
+	/// The server accepts incoming connections on its own event
+	/// threads and assigns them to the reactors in round-robin
+	/// fashion. For every accepted connection, a TCPReactorConnection
+	/// object is created using the supplied
+	/// TCPReactorConnectionFactory; from then on the connection is
+	/// driven by onReadable()/onWritable() callbacks from its
+	/// reactor. Handlers that need to perform blocking work should
+	/// use the thread-per-connection TCPServer instead.
+{
+public:
+	TCPReactorServer(TCPReactorConnectionFactory::Ptr pFactory, const ServerSocket& socket, unsigned eventThreads = 1);
+		/// Creates the TCPReactorServer, using the given ServerSocket
+		/// and the given number of event threads.
+		///
+		/// The server takes ownership of the TCPReactorConnectionFactory
+		/// and deletes it when it's no longer needed.
+
+	~TCPReactorServer();
+		/// Destroys the TCPReactorServer and thus all connections
+		/// assigned to its reactors.
+
+	void start();
+		/// Starts the server. A new connection
+		/// is accepted as soon as one is available.
+
+	void stop();
+		/// Stops the server, shutting down all event threads.
+		///
+		/// All connections assigned to the reactors are destroyed.
+		/// No new connections will be accepted.
+
+	Poco::UInt16 port() const;
+		/// Returns the port the server socket listens on.
+
+	const ServerSocket& socket() const;
+		/// Returns the server socket.
+
+protected:
+	void onAccept(const Poco::AutoPtr<ReadableNotification>& pNf);
+		/// Accepts a new connection and creates a
+		/// TCPReactorConnection for it, using the factory.
+
+	SocketReactor& nextReactor();
+		/// Returns the next reactor, in round-robin fashion.
+
+private:
+	TCPReactorServer();
+	TCPReactorServer(const TCPReactorServer&);
+	TCPReactorServer& operator = (const TCPReactorServer&);
+
+	typedef Poco::SharedPtr<SocketReactor> ReactorPtr;
+	typedef Poco::SharedPtr<Poco::Thread>  ThreadPtr;
+
+	TCPReactorConnectionFactory::Ptr _pFactory;
+	ServerSocket             _socket;
+	std::vector<ReactorPtr>  _reactors;
+	std::vector<ThreadPtr>   _threads;
+	std::size_t              _next;
+	bool                     _running;
+};
+
+
+//
+// inlines
+//
+inline const ServerSocket& TCPReactorServer::socket() const
+{
+	return _socket;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_TCPReactorServer_INCLUDED
@@ -60,14 +60,19 @@ protected:
 		/// Calls run() and catches any exceptions that
 		/// might be thrown by run().
 
+	void reset(const StreamSocket& socket);
+		/// Replaces the connection's socket, so that a recycled
+		/// connection object can handle another connection.
+
 private:
 	TCPServerConnection();
 	TCPServerConnection(const TCPServerConnection&);
 	TCPServerConnection& operator = (const TCPServerConnection&);
 	
 	StreamSocket _socket;
-	
+
 	friend class TCPServerDispatcher;
+	friend class TCPServerConnectionFactory;
 };
 
 
@@ -80,6 +85,12 @@ inline StreamSocket& TCPServerConnection::socket()
 }
 
 
+inline void TCPServerConnection::reset(const StreamSocket& socket)
+{
+	_socket = socket;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -52,6 +52,23 @@ public:
 		/// Creates an instance of a subclass of TCPServerConnection,
 		/// using the given StreamSocket.
 
+	virtual bool supportsReset() const;
+		/// Returns true if connection objects created by this factory
+		/// can be reinitialized for another socket with resetConnection(),
+		/// allowing TCPServerDispatcher to recycle them instead of
+		/// creating and destroying one object per accepted connection.
+		///
+		/// The default implementation returns false.
+
+	virtual void resetConnection(TCPServerConnection* pConnection, const StreamSocket& socket);
+		/// Reinitializes a previously used connection object for the
+		/// given socket. Only called by TCPServerDispatcher if
+		/// supportsReset() returns true.
+		///
+		/// The default implementation replaces the connection's socket.
+		/// Factories for connection classes with per-connection state
+		/// must override this method to reset that state as well.
+
 protected:
 	TCPServerConnectionFactory();
 		/// Creates the TCPServerConnectionFactory.
@@ -26,6 +26,9 @@
 #include "Poco/NotificationQueue.h"
 #include "Poco/ThreadPool.h"
 #include "Poco/Mutex.h"
+#include "Poco/StripedCounter.h"
+#include <atomic>
+#include <vector>
 
 
 namespace Poco {
@@ -91,10 +94,13 @@ protected:
 
 	void beginConnection();
 		/// Updates the performance counters.
-		
+
 	void endConnection();
 		/// Updates the performance counters.
 
+	void clearIdleConnections();
+		/// Deletes all recycled connection objects.
+
 private:
 	TCPServerDispatcher();
 	TCPServerDispatcher(const TCPServerDispatcher&);
@@ -103,13 +109,15 @@ private:
 	int _rc;
 	TCPServerParams::Ptr _pParams;
 	int  _currentThreads;
-	int  _totalConnections;
-	int  _currentConnections;
-	int  _maxConcurrentConnections;
-	int  _refusedConnections;
+	Poco::StripedCounter _totalConnections;
+	Poco::StripedCounter _currentConnections;
+	std::atomic<int>     _maxConcurrentConnections;
+	Poco::StripedCounter _refusedConnections;
 	bool _stopped;
 	Poco::NotificationQueue         _queue;
 	TCPServerConnectionFactory::Ptr _pConnectionFactory;
+	bool                            _reuseConnections;
+	std::vector<TCPServerConnection*> _idleConnections;
 	Poco::ThreadPool&               _threadPool;
 	mutable Poco::FastMutex         _mutex;
 };
@@ -0,0 +1,127 @@
+//
+// WebSocketBroadcaster.h
+//
+// Library: Net
+// Package: WebSocket
+// Module:  WebSocketBroadcaster
+//
+// Definition of the WebSocketBroadcaster class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_WebSocketBroadcaster_INCLUDED
+#define Net_WebSocketBroadcaster_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/BasicEvent.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Mutex.h"
+#include <deque>
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API WebSocketBroadcaster
+	/// Fans a single message out to many WebSocket clients.
+	///
+	/// Sending the same message to N clients with sendFrame()
+	/// serializes and copies the frame N times. The broadcaster
+	/// serializes the frame exactly once into a reference-counted
+	/// buffer and enqueues that buffer to a per-client send queue;
+	/// clients whose socket is writable are flushed immediately,
+	/// the rest are flushed from the given SocketReactor as their
+	/// sockets become writable again, so one slow client cannot
+	/// stall a broadcast.
+	///
+	/// A client whose queue exceeds the maximum number of queued
+	/// frames, or whose socket fails, is evicted and reported
+	/// through the clientEvicted event. The event can be fired
+	/// from the broadcasting thread as well as from the reactor
+	/// thread.
+	///
+	/// Only server-side (unmasked) frames are supported.
+{
+public:
+	WebSocketBroadcaster(SocketReactor& reactor, std::size_t maxQueuedFrames = DEFAULT_MAX_QUEUED_FRAMES);
+		/// Creates the WebSocketBroadcaster, using the given
+		/// reactor to flush pending frames to slow clients.
+		///
+		/// The reactor must be run by the caller.
+
+	~WebSocketBroadcaster();
+		/// Destroys the WebSocketBroadcaster. Pending frames
+		/// are discarded; client sockets are not closed.
+
+	void addClient(const WebSocket& webSocket);
+		/// Adds the given WebSocket to the set of clients.
+
+	void removeClient(const WebSocket& webSocket);
+		/// Removes the given WebSocket from the set of clients,
+		/// discarding any frames still queued for it.
+
+	std::size_t clients() const;
+		/// Returns the number of clients.
+
+	void broadcast(const void* buffer, int length, int flags = WebSocket::FRAME_TEXT);
+		/// Serializes the given payload into a frame once and
+		/// queues it to every client.
+
+	Poco::BasicEvent<WebSocket> clientEvicted;
+		/// Fired when a client has been dropped because its send
+		/// queue overflowed or its socket failed.
+
+	enum
+	{
+		DEFAULT_MAX_QUEUED_FRAMES = 64
+	};
+
+private:
+	typedef Poco::SharedPtr<std::string> FramePtr;
+
+	struct Client
+	{
+		Client(const WebSocket& webSocket):
+			ws(webSocket),
+			offset(0),
+			registered(false)
+		{
+		}
+
+		WebSocket            ws;
+		std::deque<FramePtr> queue;
+		std::size_t          offset;     /// bytes of the front frame already sent
+		bool                 registered; /// writable handler registered with the reactor
+	};
+	typedef std::map<poco_socket_t, Client> ClientMap;
+
+	WebSocketBroadcaster(const WebSocketBroadcaster&);
+	WebSocketBroadcaster& operator = (const WebSocketBroadcaster&);
+
+	void onWritable(WritableNotification* pNf);
+	bool flushClient(Client& client);
+		/// Sends queued frames while the socket is writable;
+		/// returns true if the queue has been drained.
+
+	SocketReactor&    _reactor;
+	std::size_t       _maxQueuedFrames;
+	ClientMap         _clients;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_WebSocketBroadcaster_INCLUDED
@@ -49,6 +49,36 @@ public:
 	virtual int receiveBytes(Poco::Buffer<char>& buffer, int flags);
 		/// Receives a WebSocket protocol frame.
 
+	virtual int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Not supported by a WebSocket; scatter/gather I/O
+		/// would bypass frame encoding.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
+	virtual int receiveBytes(SocketBufVec& buffers, int flags = 0);
+		/// Not supported by a WebSocket; scatter/gather I/O
+		/// would bypass frame decoding.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
+	virtual Poco::Int64 sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset = 0, Poco::Int64 count = 0);
+		/// Not supported by a WebSocket; the zero-copy path would
+		/// send the file content unframed.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
+	virtual IOStatus trySendBytes(const void* buffer, int length, int& bytesSent, int flags = 0) noexcept;
+		/// Sends the given bytes through the underlying stream
+		/// socket, without any WebSocket framing (like
+		/// sendRawBytes()), reporting would-block, timeout and error
+		/// conditions through the returned status.
+
+	virtual IOStatus tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags = 0) noexcept;
+		/// Receives raw bytes, consuming any buffered payload data
+		/// first and then reading from the underlying stream socket,
+		/// reporting would-block, timeout and error conditions
+		/// through the returned status.
+
 	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr);
 	virtual void connect(const SocketAddress& address);
 	virtual void connect(const SocketAddress& address, const Poco::Timespan& timeout);
@@ -73,6 +103,25 @@ public:
 	virtual Poco::Timespan getReceiveTimeout();
 
 	// Internal
+	enum
+	{
+		FRAME_FLAG_MASK   = 0x80,
+		MAX_HEADER_LENGTH = 14
+	};
+
+	static int writeFrameHeader(char* header, int payloadLength, int flags, bool useMask, Poco::UInt32 mask);
+		/// Serializes a frame header for the given payload length and
+		/// flags into the given buffer, which must hold at least
+		/// MAX_HEADER_LENGTH bytes, and returns the header length.
+		///
+		/// If useMask is true, the masking key is included in the
+		/// header and the payload must be masked with it.
+
+	int sendRawBytes(const void* buffer, int length);
+		/// Sends already framed bytes over the underlying socket,
+		/// bypassing frame serialization. Used for fan-out of a
+		/// once-serialized frame to many sockets.
+
 	int frameFlags() const;
 		/// Returns the frame flags of the most recently received frame.
 
@@ -90,12 +139,7 @@ public:
 		/// The default is std::numeric_limits<int>::max().
 
 protected:
-	enum
-	{
-		FRAME_FLAG_MASK   = 0x80,
-		MAX_HEADER_LENGTH = 14
-	};
-
+	void sendFrame(const char* header, int headerLength, const char* payload, int payloadLength);
 	int receiveHeader(char mask[4], bool& useMask);
 	int receivePayload(char *buffer, int payloadLength, char mask[4], bool useMask);
 	int receiveNBytes(void* buffer, int bytes);
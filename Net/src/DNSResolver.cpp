@@ -0,0 +1,166 @@
+//
+// DNSResolver.cpp
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSResolver
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/DNSResolver.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/SingletonHolder.h"
+
+
+using Poco::FastMutex;
+using Poco::Timestamp;
+
+
+namespace Poco {
+namespace Net {
+
+
+const long DNS_RESOLVER_DEFAULT_POSITIVE_TTL = 60;
+const long DNS_RESOLVER_DEFAULT_NEGATIVE_TTL = 10;
+
+
+DNSResolver::DNSResolver():
+	hostByNameAsync(this, &DNSResolver::resolveImpl),
+	_positiveTTL(DNS_RESOLVER_DEFAULT_POSITIVE_TTL),
+	_negativeTTL(DNS_RESOLVER_DEFAULT_NEGATIVE_TTL)
+{
+}
+
+
+DNSResolver::~DNSResolver()
+{
+}
+
+
+HostEntry DNSResolver::hostByName(const std::string& hostname)
+{
+	bool refresh = false;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		CacheMap::iterator it = _cache.find(hostname);
+		if (it != _cache.end())
+		{
+			CacheEntry& entry = it->second;
+			if (!entry.expires.isElapsed(0))
+			{
+				if (entry.negative)
+					throw HostNotFoundException(hostname, entry.error);
+				else
+					return entry.entry;
+			}
+			else if (!entry.negative)
+			{
+				// serve the stale entry and refresh it in the background
+				if (!entry.refreshing)
+				{
+					entry.refreshing = true;
+					refresh = true;
+				}
+				if (!refresh) return entry.entry;
+			}
+		}
+	}
+	if (refresh)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		CacheMap::iterator it = _cache.find(hostname);
+		HostEntry stale = it->second.entry;
+		hostByNameAsync(hostname);
+		return stale;
+	}
+	return resolveImpl(hostname);
+}
+
+
+void DNSResolver::clearCache()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_cache.clear();
+}
+
+
+void DNSResolver::setPositiveTimeToLive(long seconds)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_positiveTTL = seconds;
+}
+
+
+long DNSResolver::getPositiveTimeToLive() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _positiveTTL;
+}
+
+
+void DNSResolver::setNegativeTimeToLive(long seconds)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_negativeTTL = seconds;
+}
+
+
+long DNSResolver::getNegativeTimeToLive() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _negativeTTL;
+}
+
+
+namespace
+{
+	static Poco::SingletonHolder<DNSResolver> sh;
+}
+
+
+DNSResolver& DNSResolver::defaultResolver()
+{
+	return *sh.get();
+}
+
+
+HostEntry DNSResolver::resolveImpl(const std::string& hostname)
+{
+	try
+	{
+		HostEntry he = DNS::hostByName(hostname);
+		FastMutex::ScopedLock lock(_mutex);
+		CacheEntry& entry = _cache[hostname];
+		entry.entry = he;
+		entry.error.clear();
+		entry.expires = Timestamp() + Timestamp::TimeDiff(_positiveTTL)*Timestamp::resolution();
+		entry.negative = false;
+		entry.refreshing = false;
+		return he;
+	}
+	catch (Poco::Exception& exc)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		CacheEntry& entry = _cache[hostname];
+		entry.entry = HostEntry();
+		entry.error = exc.displayText();
+		entry.expires = Timestamp() + Timestamp::TimeDiff(_negativeTTL)*Timestamp::resolution();
+		entry.negative = true;
+		entry.refreshing = false;
+		throw;
+	}
+}
+
+
+} } // namespace Poco::Net
@@ -111,4 +111,16 @@ int DatagramSocket::receiveFrom(void* buffer, int length, SocketAddress& address
 }
 
 
+int DatagramSocket::sendMany(SocketMsgVec& messages, int flags)
+{
+	return impl()->sendMany(messages, flags);
+}
+
+
+int DatagramSocket::receiveMany(SocketMsgVec& messages, const Poco::Timespan& timeout, int flags)
+{
+	return impl()->receiveMany(messages, timeout, flags);
+}
+
+
 } } // namespace Poco::Net
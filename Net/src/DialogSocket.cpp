@@ -22,30 +22,33 @@ namespace Poco {
 namespace Net {
 
 
-DialogSocket::DialogSocket():
+DialogSocket::DialogSocket(std::size_t bufferSize):
 	_pBuffer(0),
 	_pNext(0),
-	_pEnd(0)
+	_pEnd(0),
+	_bufferSize(bufferSize)
 {
 	allocBuffer();
 }
 
 
-DialogSocket::DialogSocket(const SocketAddress& address):
+DialogSocket::DialogSocket(const SocketAddress& address, std::size_t bufferSize):
 	StreamSocket(address),
 	_pBuffer(0),
 	_pNext(0),
-	_pEnd(0)
+	_pEnd(0),
+	_bufferSize(bufferSize)
 {
 	allocBuffer();
 }
 
 
-DialogSocket::DialogSocket(const Socket& socket):
+DialogSocket::DialogSocket(const Socket& socket, std::size_t bufferSize):
 	StreamSocket(socket),
 	_pBuffer(0),
 	_pNext(0),
-	_pEnd(0)
+	_pEnd(0),
+	_bufferSize(bufferSize)
 {
 	allocBuffer();
 }
@@ -55,7 +58,8 @@ DialogSocket::DialogSocket(const DialogSocket& socket):
 	StreamSocket(socket),
 	_pBuffer(0),
 	_pNext(0),
-	_pEnd(0)
+	_pEnd(0),
+	_bufferSize(socket._bufferSize)
 {
 	allocBuffer();
 }
@@ -213,11 +217,35 @@ void DialogSocket::sendTelnetCommand(unsigned char command, unsigned char arg)
 }
 
 
+bool DialogSocket::receiveMessages(std::vector<std::string>& messages)
+{
+	messages.clear();
+	std::string message;
+	if (!receiveMessage(message)) return false;
+	messages.push_back(message);
+	// extract all further complete lines already in the buffer,
+	// without going back to the socket
+	while (_pNext != _pEnd)
+	{
+		std::size_t avail = static_cast<std::size_t>(_pEnd - _pNext);
+		const char* lf = static_cast<const char*>(std::memchr(_pNext, '\n', avail));
+		const char* cr = static_cast<const char*>(std::memchr(_pNext, '\r', avail));
+		// a trailing CR is ambiguous - the next call will pick it up
+		// together with the LF
+		if (!lf && !(cr && cr != _pEnd - 1)) break;
+		message.clear();
+		if (!receiveLine(message, MAX_LINE_LENGTH)) break;
+		messages.push_back(message);
+	}
+	return true;
+}
+
+
 void DialogSocket::refill()
 {
 	if (_pNext == _pEnd)
 	{
-		int n = receiveBytes(_pBuffer, RECEIVE_BUFFER_SIZE);
+		int n = receiveBytes(_pBuffer, static_cast<int>(_bufferSize));
 		if (n > 0)
 		{
 			_pNext = _pBuffer;
@@ -229,7 +257,9 @@ void DialogSocket::refill()
 
 void DialogSocket::allocBuffer()
 {
-	_pBuffer = new char [RECEIVE_BUFFER_SIZE];
+	poco_assert (_bufferSize > 0);
+
+	_pBuffer = new char [_bufferSize];
 	_pNext   = _pBuffer;
 	_pEnd    = _pBuffer;
 }
@@ -239,20 +269,25 @@ bool DialogSocket::receiveLine(std::string& line, std::size_t lineLengthLimit)
 {
 	// An old wisdom goes: be strict in what you emit
 	// and generous in what you accept.
-	int ch = get();
-	while (ch != EOF_CHAR && ch != '\r' && ch != '\n')
+	for (;;)
 	{
-		if (lineLengthLimit == 0 || line.size() < lineLengthLimit)
-			line += (char) ch;
-		else
+		refill();
+		if (_pNext == _pEnd) return false;
+		std::size_t avail = static_cast<std::size_t>(_pEnd - _pNext);
+		const char* lf = static_cast<const char*>(std::memchr(_pNext, '\n', avail));
+		const char* cr = static_cast<const char*>(std::memchr(_pNext, '\r', avail));
+		const char* eol = cr && (!lf || cr < lf) ? cr : lf;
+		std::size_t n = eol ? static_cast<std::size_t>(eol - _pNext) : avail;
+		if (lineLengthLimit != 0 && line.size() + n > lineLengthLimit)
 			throw Poco::IOException("Line too long");
-		ch = get();
+		line.append(_pNext, n);
+		_pNext += n;
+		if (!eol) continue;
+		++_pNext;
+		if (*eol == '\r' && peek() == '\n')
+			get();
+		return true;
 	}
-	if (ch == '\r' && peek() == '\n')
-		get();
-	else if (ch == EOF_CHAR)
-		return false;
-	return true;
 }
 
 
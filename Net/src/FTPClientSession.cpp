@@ -18,10 +18,23 @@
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
 #include "Poco/Ascii.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/Buffer.h"
+#include "Poco/String.h"
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+#include "Poco/Error.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+#include <cerrno>
+#endif
 
 
 using Poco::NumberFormatter;
+using Poco::NumberParser;
 
 
 namespace Poco {
@@ -296,14 +309,27 @@ void FTPClientSession::removeDirectory(const std::string& path)
 }
 
 
-std::istream& FTPClientSession::beginDownload(const std::string& path)
+Poco::UInt64 FTPClientSession::fileSize(const std::string& path)
+{
+	std::string response;
+	int status = sendCommand("SIZE", path, response);
+	if (!isPositiveCompletion(status))
+		throw FTPException("Cannot get file size", response, status);
+	Poco::UInt64 size;
+	if (!NumberParser::tryParseUnsigned64(Poco::trim(response.substr(4)), size))
+		throw FTPException("Invalid SIZE response", response, status);
+	return size;
+}
+
+
+std::istream& FTPClientSession::beginDownload(const std::string& path, Poco::UInt64 offset)
 {
 	if (!isOpen())
 		throw FTPException("Connection is closed.");
 
 	delete _pDataStream;
 	_pDataStream = 0;
-	_pDataStream = new SocketStream(establishDataConnection("RETR", path));
+	_pDataStream = new SocketStream(establishDataConnection("RETR", path, offset, offset > 0));
 	return *_pDataStream;
 }
 
@@ -314,14 +340,14 @@ void FTPClientSession::endDownload()
 }
 
 	
-std::ostream& FTPClientSession::beginUpload(const std::string& path)
+std::ostream& FTPClientSession::beginUpload(const std::string& path, Poco::UInt64 offset)
 {
 	if (!isOpen())
 		throw FTPException("Connection is closed.");
 
 	delete _pDataStream;
 	_pDataStream = 0;
-	_pDataStream = new SocketStream(establishDataConnection("STOR", path));
+	_pDataStream = new SocketStream(establishDataConnection("STOR", path, offset, offset > 0));
 	return *_pDataStream;
 }
 
@@ -332,6 +358,67 @@ void FTPClientSession::endUpload()
 }
 
 
+void FTPClientSession::uploadFile(const std::string& localPath, const std::string& remotePath, Poco::UInt64 offset, Poco::UInt64 count)
+{
+	if (!isOpen())
+		throw FTPException("Connection is closed.");
+
+	if (count == 0)
+	{
+		Poco::UInt64 size = Poco::File(localPath).getSize();
+		if (offset < size) count = size - offset;
+	}
+
+	delete _pDataStream;
+	_pDataStream = 0;
+	StreamSocket ss(establishDataConnection("STOR", remotePath, offset, true));
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+	int fd = ::open(localPath.c_str(), O_RDONLY);
+	if (fd == -1) throw Poco::OpenFileException(localPath);
+	off_t fileOffset = static_cast<off_t>(offset);
+	Poco::UInt64 remaining = count;
+	while (remaining > 0)
+	{
+		std::size_t chunk = 0x7ffff000;
+		if (remaining < chunk) chunk = static_cast<std::size_t>(remaining);
+		ssize_t sent = ::sendfile(ss.impl()->sockfd(), fd, &fileOffset, chunk);
+		if (sent < 0)
+		{
+			if (errno == EINTR) continue;
+			int err = errno;
+			::close(fd);
+			throw NetException("sendfile() failed", Poco::Error::getMessage(err));
+		}
+		if (sent == 0) break;
+		remaining -= static_cast<Poco::UInt64>(sent);
+	}
+	::close(fd);
+#else
+	Poco::FileInputStream istr(localPath);
+	istr.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+	SocketStream ostr(ss);
+	Poco::Buffer<char> buffer(8192);
+	Poco::UInt64 remaining = count;
+	while (remaining > 0 && istr.good())
+	{
+		std::streamsize chunk = static_cast<std::streamsize>(buffer.size());
+		if (remaining < static_cast<Poco::UInt64>(chunk)) chunk = static_cast<std::streamsize>(remaining);
+		istr.read(buffer.begin(), chunk);
+		std::streamsize n = istr.gcount();
+		if (n <= 0) break;
+		ostr.write(buffer.begin(), n);
+		remaining -= static_cast<Poco::UInt64>(n);
+	}
+	ostr.flush();
+#endif
+	ss.close();
+	std::string response;
+	int status = _pControlSocket->receiveStatusMessage(response);
+	if (!isPositiveCompletion(status))
+		throw FTPException("Data transfer failed", response, status);
+}
+
+
 std::istream& FTPClientSession::beginList(const std::string& path, bool extended)
 {
 	if (!isOpen())
@@ -410,24 +497,31 @@ std::string FTPClientSession::extractPath(const std::string& response)
 
 
 StreamSocket FTPClientSession::establishDataConnection(const std::string& command, const std::string& arg)
+{
+	return establishDataConnection(command, arg, 0, false);
+}
+
+
+StreamSocket FTPClientSession::establishDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart)
 {
 	if (_passiveMode)
-		return passiveDataConnection(command, arg);
+		return passiveDataConnection(command, arg, offset, restart);
 	else
-		return activeDataConnection(command, arg);
+		return activeDataConnection(command, arg, offset, restart);
 }
 
 
-StreamSocket FTPClientSession::activeDataConnection(const std::string& command, const std::string& arg)
+StreamSocket FTPClientSession::activeDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart)
 {
 	if (!isOpen())
 		throw FTPException("Connection is closed.");
 
 	ServerSocket server(SocketAddress(_pControlSocket->address().host(), 0));
 	sendPortCommand(server.address());
+	if (restart) sendRestart(offset);
 	std::string response;
 	int status = sendCommand(command, arg, response);
-	if (!isPositivePreliminary(status)) 
+	if (!isPositivePreliminary(status))
 		throw FTPException(command + " command failed", response, status);
 	if (server.poll(_timeout, Socket::SELECT_READ))
 		return server.acceptConnection();
@@ -436,18 +530,28 @@ StreamSocket FTPClientSession::activeDataConnection(const std::string& command,
 }
 
 
-StreamSocket FTPClientSession::passiveDataConnection(const std::string& command, const std::string& arg)
+StreamSocket FTPClientSession::passiveDataConnection(const std::string& command, const std::string& arg, Poco::UInt64 offset, bool restart)
 {
 	SocketAddress sa(sendPassiveCommand());
 	StreamSocket sock(sa);
+	if (restart) sendRestart(offset);
 	std::string response;
 	int status = sendCommand(command, arg, response);
-	if (!isPositivePreliminary(status)) 
+	if (!isPositivePreliminary(status))
 		throw FTPException(command + " command failed", response, status);
 	return sock;
 }
 
 
+void FTPClientSession::sendRestart(Poco::UInt64 offset)
+{
+	std::string response;
+	int status = sendCommand("REST", NumberFormatter::format(offset), response);
+	if (!isPositiveIntermediate(status))
+		throw FTPException("REST command failed", response, status);
+}
+
+
 void FTPClientSession::sendPortCommand(const SocketAddress& addr)
 {
 	if (_supports1738)
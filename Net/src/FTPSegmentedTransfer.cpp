@@ -0,0 +1,274 @@
+//
+// FTPSegmentedTransfer.cpp
+//
+// Library: Net
+// Package: FTP
+// Module:  FTPSegmentedTransfer
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/FTPSegmentedTransfer.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Buffer.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/Runnable.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include <vector>
+
+
+using Poco::Thread;
+using Poco::InvalidArgumentException;
+using Poco::UnhandledException;
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	class TransferSegment: public Poco::Runnable
+		/// Transfers one segment of a file over its own FTP session.
+	{
+	public:
+		enum Direction
+		{
+			SEGMENT_DOWNLOAD,
+			SEGMENT_UPLOAD
+		};
+
+		enum
+		{
+			BUFFER_SIZE = 65536
+		};
+
+		TransferSegment(Direction direction,
+			const std::string& host,
+			Poco::UInt16 port,
+			const std::string& username,
+			const std::string& password,
+			const std::string& remotePath,
+			const std::string& localPath,
+			Poco::UInt64 offset,
+			Poco::UInt64 length,
+			bool last):
+			_direction(direction),
+			_host(host),
+			_port(port),
+			_username(username),
+			_password(password),
+			_remotePath(remotePath),
+			_localPath(localPath),
+			_offset(offset),
+			_length(length),
+			_last(last),
+			_pException(0)
+		{
+		}
+
+		~TransferSegment()
+		{
+			delete _pException;
+		}
+
+		void run()
+		{
+			try
+			{
+				transfer();
+			}
+			catch (Poco::Exception& exc)
+			{
+				_pException = exc.clone();
+			}
+			catch (std::exception& exc)
+			{
+				_pException = new UnhandledException(exc.what());
+			}
+			catch (...)
+			{
+				_pException = new UnhandledException();
+			}
+		}
+
+		const Poco::Exception* exception() const
+		{
+			return _pException;
+		}
+
+	protected:
+		void transfer()
+		{
+			FTPClientSession session(_host, _port, _username, _password);
+			if (_direction == SEGMENT_DOWNLOAD)
+				downloadSegment(session);
+			else
+				session.uploadFile(_localPath, _remotePath, _offset, _length);
+			session.close();
+		}
+
+		void downloadSegment(FTPClientSession& session)
+		{
+			std::istream& istr = session.beginDownload(_remotePath, _offset);
+			Poco::FileOutputStream ostr(_localPath, std::ios::in | std::ios::out | std::ios::binary);
+			ostr.seekp(static_cast<std::streamoff>(_offset), std::ios::beg);
+			if (_last)
+			{
+				Poco::StreamCopier::copyStream(istr, ostr);
+				session.endDownload();
+			}
+			else
+			{
+				Poco::Buffer<char> buffer(BUFFER_SIZE);
+				Poco::UInt64 remaining = _length;
+				while (remaining > 0)
+				{
+					std::streamsize chunk = BUFFER_SIZE;
+					if (remaining < static_cast<Poco::UInt64>(chunk)) chunk = static_cast<std::streamsize>(remaining);
+					istr.read(buffer.begin(), chunk);
+					std::streamsize n = istr.gcount();
+					if (n <= 0) throw FTPException("Unexpected end of data", _remotePath);
+					ostr.write(buffer.begin(), n);
+					remaining -= static_cast<Poco::UInt64>(n);
+				}
+				session.abort();
+			}
+		}
+
+	private:
+		Direction        _direction;
+		std::string      _host;
+		Poco::UInt16     _port;
+		std::string      _username;
+		std::string      _password;
+		std::string      _remotePath;
+		std::string      _localPath;
+		Poco::UInt64     _offset;
+		Poco::UInt64     _length;
+		bool             _last;
+		Poco::Exception* _pException;
+	};
+}
+
+
+FTPSegmentedTransfer::FTPSegmentedTransfer(const std::string& host,
+	Poco::UInt16 port,
+	const std::string& username,
+	const std::string& password):
+	_host(host),
+	_port(port),
+	_username(username),
+	_password(password),
+	_segments(DEFAULT_SEGMENTS)
+{
+}
+
+
+FTPSegmentedTransfer::~FTPSegmentedTransfer()
+{
+}
+
+
+void FTPSegmentedTransfer::setSegments(int segments)
+{
+	if (segments <= 0)
+		throw InvalidArgumentException("segments must be a positive number");
+
+	_segments = segments;
+}
+
+
+Poco::UInt64 FTPSegmentedTransfer::download(const std::string& remotePath, const std::string& localPath)
+{
+	FTPClientSession session(_host, _port, _username, _password);
+	Poco::UInt64 size = session.fileSize(remotePath);
+	session.close();
+
+	Poco::File file(localPath);
+	file.createFile();
+	file.setSize(size);
+	if (size == 0) return 0;
+
+	int count = _segments;
+	if (static_cast<Poco::UInt64>(count) > size) count = static_cast<int>(size);
+	Poco::UInt64 segmentSize = size/count;
+
+	std::vector<Poco::SharedPtr<TransferSegment> > workers;
+	std::vector<Poco::SharedPtr<Thread> > threads;
+	Poco::UInt64 offset = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		bool last = (i == count - 1);
+		Poco::UInt64 length = last ? size - offset : segmentSize;
+		workers.push_back(new TransferSegment(TransferSegment::SEGMENT_DOWNLOAD,
+			_host, _port, _username, _password, remotePath, localPath, offset, length, last));
+		offset += length;
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		threads.push_back(new Thread);
+		threads.back()->start(*workers[i]);
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		threads[i]->join();
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		if (workers[i]->exception()) workers[i]->exception()->rethrow();
+	}
+	return size;
+}
+
+
+void FTPSegmentedTransfer::upload(const std::string& localPath, const std::string& remotePath)
+{
+	Poco::UInt64 size = Poco::File(localPath).getSize();
+	if (size == 0)
+	{
+		FTPClientSession session(_host, _port, _username, _password);
+		session.uploadFile(localPath, remotePath);
+		session.close();
+		return;
+	}
+
+	int count = _segments;
+	if (static_cast<Poco::UInt64>(count) > size) count = static_cast<int>(size);
+	Poco::UInt64 segmentSize = size/count;
+
+	std::vector<Poco::SharedPtr<TransferSegment> > workers;
+	std::vector<Poco::SharedPtr<Thread> > threads;
+	Poco::UInt64 offset = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		bool last = (i == count - 1);
+		Poco::UInt64 length = last ? size - offset : segmentSize;
+		workers.push_back(new TransferSegment(TransferSegment::SEGMENT_UPLOAD,
+			_host, _port, _username, _password, remotePath, localPath, offset, length, last));
+		offset += length;
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		threads.push_back(new Thread);
+		threads.back()->start(*workers[i]);
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		threads[i]->join();
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		if (workers[i]->exception()) workers[i]->exception()->rethrow();
+	}
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,422 @@
+//
+// HPACK.cpp
+//
+// Library: Net
+// Package: HTTP
+// Module:  HPACK
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/String.h"
+#include "Poco/Exception.h"
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	struct StaticEntry
+	{
+		const char* name;
+		const char* value;
+	};
+	// RFC 7541, Appendix A
+	const StaticEntry STATIC_TABLE[] =
+	{
+		{ ":authority", "" },
+		{ ":method", "GET" },
+		{ ":method", "POST" },
+		{ ":path", "/" },
+		{ ":path", "/index.html" },
+		{ ":scheme", "http" },
+		{ ":scheme", "https" },
+		{ ":status", "200" },
+		{ ":status", "204" },
+		{ ":status", "206" },
+		{ ":status", "304" },
+		{ ":status", "400" },
+		{ ":status", "404" },
+		{ ":status", "500" },
+		{ "accept-charset", "" },
+		{ "accept-encoding", "gzip, deflate" },
+		{ "accept-language", "" },
+		{ "accept-ranges", "" },
+		{ "accept", "" },
+		{ "access-control-allow-origin", "" },
+		{ "age", "" },
+		{ "allow", "" },
+		{ "authorization", "" },
+		{ "cache-control", "" },
+		{ "content-disposition", "" },
+		{ "content-encoding", "" },
+		{ "content-language", "" },
+		{ "content-length", "" },
+		{ "content-location", "" },
+		{ "content-range", "" },
+		{ "content-type", "" },
+		{ "cookie", "" },
+		{ "date", "" },
+		{ "etag", "" },
+		{ "expect", "" },
+		{ "expires", "" },
+		{ "from", "" },
+		{ "host", "" },
+		{ "if-match", "" },
+		{ "if-modified-since", "" },
+		{ "if-none-match", "" },
+		{ "if-range", "" },
+		{ "if-unmodified-since", "" },
+		{ "last-modified", "" },
+		{ "link", "" },
+		{ "location", "" },
+		{ "max-forwards", "" },
+		{ "proxy-authenticate", "" },
+		{ "proxy-authorization", "" },
+		{ "range", "" },
+		{ "referer", "" },
+		{ "refresh", "" },
+		{ "retry-after", "" },
+		{ "server", "" },
+		{ "set-cookie", "" },
+		{ "strict-transport-security", "" },
+		{ "transfer-encoding", "" },
+		{ "user-agent", "" },
+		{ "vary", "" },
+		{ "via", "" },
+		{ "www-authenticate", "" }
+	};
+
+	std::vector<HPACKTable::Entry> makeStaticEntries()
+	{
+		std::vector<HPACKTable::Entry> entries(HPACKTable::STATIC_TABLE_SIZE);
+		for (std::size_t i = 0; i < HPACKTable::STATIC_TABLE_SIZE; i++)
+		{
+			entries[i].name  = STATIC_TABLE[i].name;
+			entries[i].value = STATIC_TABLE[i].value;
+		}
+		return entries;
+	}
+}
+
+
+//
+// HPACKTable
+//
+
+
+HPACKTable::HPACKTable(std::size_t maxSize):
+	_dynamicSize(0),
+	_maxSize(maxSize)
+{
+}
+
+
+HPACKTable::~HPACKTable()
+{
+}
+
+
+const HPACKTable::Entry& HPACKTable::entry(std::size_t index) const
+{
+	static const std::vector<Entry> staticEntries(makeStaticEntries());
+	if (index == 0)
+		throw Poco::RangeException("invalid HPACK index");
+	if (index <= STATIC_TABLE_SIZE)
+		return staticEntries[index - 1];
+	std::size_t dynIndex = index - STATIC_TABLE_SIZE - 1;
+	if (dynIndex >= _dynamic.size())
+		throw Poco::RangeException("invalid HPACK index");
+	return _dynamic[dynIndex];
+}
+
+
+std::size_t HPACKTable::find(const std::string& name, const std::string& value, bool& valueMatch) const
+{
+	std::size_t nameIndex = 0;
+	for (std::size_t i = 0; i < STATIC_TABLE_SIZE; i++)
+	{
+		if (name == STATIC_TABLE[i].name)
+		{
+			if (value == STATIC_TABLE[i].value)
+			{
+				valueMatch = true;
+				return i + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + 1;
+		}
+	}
+	for (std::size_t i = 0; i < _dynamic.size(); i++)
+	{
+		if (name == _dynamic[i].name)
+		{
+			if (value == _dynamic[i].value)
+			{
+				valueMatch = true;
+				return STATIC_TABLE_SIZE + i + 1;
+			}
+			if (nameIndex == 0) nameIndex = STATIC_TABLE_SIZE + i + 1;
+		}
+	}
+	valueMatch = false;
+	return nameIndex;
+}
+
+
+void HPACKTable::add(const std::string& name, const std::string& value)
+{
+	std::size_t entrySize = name.size() + value.size() + ENTRY_OVERHEAD;
+	if (entrySize > _maxSize)
+	{
+		// an entry larger than the table empties it (RFC 7541, section 4.4)
+		_dynamic.clear();
+		_dynamicSize = 0;
+		return;
+	}
+	Entry e;
+	e.name  = name;
+	e.value = value;
+	_dynamic.push_front(e);
+	_dynamicSize += entrySize;
+	evict();
+}
+
+
+void HPACKTable::setMaxSize(std::size_t maxSize)
+{
+	_maxSize = maxSize;
+	evict();
+}
+
+
+void HPACKTable::evict()
+{
+	while (_dynamicSize > _maxSize)
+	{
+		const Entry& e = _dynamic.back();
+		_dynamicSize -= e.name.size() + e.value.size() + ENTRY_OVERHEAD;
+		_dynamic.pop_back();
+	}
+}
+
+
+//
+// HPACKEncoder
+//
+
+
+HPACKEncoder::HPACKEncoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_pendingTableSize(maxTableSize),
+	_tableSizeChanged(false)
+{
+}
+
+
+HPACKEncoder::~HPACKEncoder()
+{
+}
+
+
+void HPACKEncoder::encode(const NameValueCollection& fields, std::string& block)
+{
+	for (NameValueCollection::ConstIterator it = fields.begin(); it != fields.end(); ++it)
+	{
+		encode(it->first, it->second, block);
+	}
+}
+
+
+void HPACKEncoder::encode(const std::string& name, const std::string& value, std::string& block, bool sensitive)
+{
+	if (_tableSizeChanged)
+	{
+		_table.setMaxSize(_pendingTableSize);
+		appendInteger(block, 0x20, 5, _pendingTableSize);
+		_tableSizeChanged = false;
+	}
+	std::string lowerName(Poco::toLower(name));
+	bool valueMatch;
+	std::size_t index = _table.find(lowerName, value, valueMatch);
+	if (sensitive)
+	{
+		// never-indexed representation: only the name may be referenced
+		appendInteger(block, 0x10, 4, index);
+		if (index == 0)
+			appendString(block, lowerName);
+		appendString(block, value);
+		return;
+	}
+	if (valueMatch)
+	{
+		appendInteger(block, 0x80, 7, index);
+		return;
+	}
+	appendInteger(block, 0x40, 6, index);
+	if (index == 0)
+		appendString(block, lowerName);
+	appendString(block, value);
+	_table.add(lowerName, value);
+}
+
+
+void HPACKEncoder::setMaxTableSize(std::size_t maxTableSize)
+{
+	if (maxTableSize != _table.getMaxSize())
+	{
+		_pendingTableSize = maxTableSize;
+		_tableSizeChanged = true;
+	}
+}
+
+
+void HPACKEncoder::appendInteger(std::string& block, unsigned char mask, int prefixBits, std::size_t value)
+{
+	const std::size_t limit = (static_cast<std::size_t>(1) << prefixBits) - 1;
+	if (value < limit)
+	{
+		block += static_cast<char>(mask | value);
+	}
+	else
+	{
+		block += static_cast<char>(mask | limit);
+		value -= limit;
+		while (value >= 128)
+		{
+			block += static_cast<char>(0x80 | (value & 0x7F));
+			value >>= 7;
+		}
+		block += static_cast<char>(value);
+	}
+}
+
+
+void HPACKEncoder::appendString(std::string& block, const std::string& str)
+{
+	appendInteger(block, 0x00, 7, str.size());
+	block += str;
+}
+
+
+//
+// HPACKDecoder
+//
+
+
+HPACKDecoder::HPACKDecoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_maxTableSize(maxTableSize)
+{
+}
+
+
+HPACKDecoder::~HPACKDecoder()
+{
+}
+
+
+void HPACKDecoder::decode(const char* begin, const char* end, NameValueCollection& fields)
+{
+	const char* it = begin;
+	while (it != end)
+	{
+		unsigned char octet = static_cast<unsigned char>(*it);
+		if (octet & 0x80)
+		{
+			// indexed header field
+			std::size_t index = readInteger(it, end, 7);
+			const HPACKTable::Entry& e = _table.entry(index);
+			fields.add(e.name, e.value);
+		}
+		else if (octet & 0x40)
+		{
+			// literal header field with incremental indexing
+			std::size_t index = readInteger(it, end, 6);
+			std::string name;
+			if (index != 0)
+				name = _table.entry(index).name;
+			else
+				readString(it, end, name);
+			std::string value;
+			readString(it, end, value);
+			fields.add(name, value);
+			_table.add(name, value);
+		}
+		else if (octet & 0x20)
+		{
+			// dynamic table size update
+			std::size_t maxSize = readInteger(it, end, 5);
+			if (maxSize > _maxTableSize)
+				throw HTTPException("HPACK dynamic table size update exceeds limit");
+			_table.setMaxSize(maxSize);
+		}
+		else
+		{
+			// literal header field without indexing or never indexed
+			std::size_t index = readInteger(it, end, 4);
+			std::string name;
+			if (index != 0)
+				name = _table.entry(index).name;
+			else
+				readString(it, end, name);
+			std::string value;
+			readString(it, end, value);
+			fields.add(name, value);
+		}
+	}
+}
+
+
+void HPACKDecoder::decode(const std::string& block, NameValueCollection& fields)
+{
+	decode(block.data(), block.data() + block.size(), fields);
+}
+
+
+std::size_t HPACKDecoder::readInteger(const char*& it, const char* end, int prefixBits)
+{
+	poco_assert_dbg (it != end);
+
+	const std::size_t limit = (static_cast<std::size_t>(1) << prefixBits) - 1;
+	std::size_t value = static_cast<unsigned char>(*it++) & limit;
+	if (value < limit) return value;
+	int shift = 0;
+	for (;;)
+	{
+		if (it == end)
+			throw HTTPException("truncated HPACK integer");
+		if (shift > 28)
+			throw HTTPException("HPACK integer too large");
+		unsigned char octet = static_cast<unsigned char>(*it++);
+		value += static_cast<std::size_t>(octet & 0x7F) << shift;
+		if ((octet & 0x80) == 0) return value;
+		shift += 7;
+	}
+}
+
+
+void HPACKDecoder::readString(const char*& it, const char* end, std::string& str)
+{
+	if (it == end)
+		throw HTTPException("truncated HPACK string");
+	bool huffman = (static_cast<unsigned char>(*it) & 0x80) != 0;
+	std::size_t length = readInteger(it, end, 7);
+	if (huffman)
+		throw HTTPException("Huffman-coded HPACK string not supported");
+	if (length > static_cast<std::size_t>(end - it))
+		throw HTTPException("truncated HPACK string");
+	str.assign(it, length);
+	it += length;
+}
+
+
+} } // namespace Poco::Net
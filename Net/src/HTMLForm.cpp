@@ -28,6 +28,7 @@
 #include "Poco/CountingStream.h"
 #include "Poco/UTF8String.h"
 #include <sstream>
+#include <cstring>
 
 
 using Poco::NullInputStream;
@@ -287,54 +288,129 @@ void HTMLForm::write(std::ostream& ostr)
 }
 
 
-void HTMLForm::readUrl(std::istream& istr)
+namespace
 {
-	static const int eof = std::char_traits<char>::eof();
+	struct HexDecodeTable
+	{
+		signed char value[256];
 
-	int fields = 0;
-	int ch = istr.get();
-	bool isFirst = true;
-	while (ch != eof)
+		HexDecodeTable()
+		{
+			for (int i = 0; i < 256; i++) value[i] = -1;
+			for (int c = '0'; c <= '9'; c++) value[c] = static_cast<signed char>(c - '0');
+			for (int c = 'A'; c <= 'F'; c++) value[c] = static_cast<signed char>(c - 'A' + 10);
+			for (int c = 'a'; c <= 'f'; c++) value[c] = static_cast<signed char>(c - 'a' + 10);
+		}
+	};
+
+
+	const HexDecodeTable hexDecodeTable;
+
+
+	void decodeFormComponent(const char* it, const char* end, std::string& result)
+		/// Decodes a www-form-urlencoded name or value directly from
+		/// the raw buffer: a plus sign becomes a space, %XX is decoded
+		/// via the hex table, and runs without special characters are
+		/// located with memchr and appended as a whole.
 	{
-		if (_fieldLimit > 0 && fields == _fieldLimit)
-			throw HTMLFormException("Too many form fields");
-		std::string name;
-		std::string value;
-		while (ch != eof && ch != '=' && ch != '&')
+		result.reserve(static_cast<std::size_t>(end - it));
+		while (it != end)
 		{
-			if (ch == '+') ch = ' ';
-			if (name.size() < MAX_NAME_LENGTH)
-				name += (char) ch;
+			const char* pct = static_cast<const char*>(std::memchr(it, '%', end - it));
+			const char* runEnd = pct ? pct : end;
+			const char* plus = static_cast<const char*>(std::memchr(it, '+', runEnd - it));
+			const char* stop = plus ? plus : runEnd;
+			result.append(it, stop);
+			it = stop;
+			if (it == end) break;
+			if (*it == '+')
+			{
+				result += ' ';
+				++it;
+			}
 			else
-				throw HTMLFormException("Field name too long");
-			ch = istr.get();
+			{
+				if (end - it < 2) throw Poco::URISyntaxException("URI encoding: no hex digit following percent sign");
+				if (end - it < 3) throw Poco::URISyntaxException("URI encoding: two hex digits must follow percent sign");
+				int hi = hexDecodeTable.value[static_cast<unsigned char>(it[1])];
+				int lo = hexDecodeTable.value[static_cast<unsigned char>(it[2])];
+				if (hi < 0 || lo < 0) throw Poco::URISyntaxException("URI encoding: not a hex digit");
+				result += static_cast<char>(hi*16 + lo);
+				it += 3;
+			}
 		}
-		if (ch == '=')
+	}
+}
+
+
+void HTMLForm::readUrl(std::istream& istr)
+{
+	int fields = 0;
+	bool isFirst = true;
+	std::string buffer;
+	char chunk[8192];
+	bool atEnd = false;
+	while (!atEnd)
+	{
+		istr.read(chunk, sizeof(chunk));
+		std::streamsize n = istr.gcount();
+		buffer.append(chunk, static_cast<std::size_t>(n));
+		atEnd = n < static_cast<std::streamsize>(sizeof(chunk));
+
+		std::size_t begin = 0;
+		for (;;)
 		{
-			ch = istr.get();
-			while (ch != eof && ch != '&')
+			const char* start = buffer.data() + begin;
+			std::size_t remaining = buffer.size() - begin;
+			const char* fieldEnd = static_cast<const char*>(std::memchr(start, '&', remaining));
+			bool haveSeparator = fieldEnd != 0;
+			if (!haveSeparator)
 			{
-				if (ch == '+') ch = ' ';
-				if (value.size() < _valueLengthLimit)
-					value += (char) ch;
-				else
+				if (!atEnd || remaining == 0)
+				{
+					// incomplete field: enforce the limits before
+					// buffering any more data
+					if (remaining > 0)
+					{
+						if (_fieldLimit > 0 && fields == _fieldLimit)
+							throw HTMLFormException("Too many form fields");
+						const char* eq = static_cast<const char*>(std::memchr(start, '=', remaining));
+						std::size_t nameLength = eq ? static_cast<std::size_t>(eq - start) : remaining;
+						if (nameLength > MAX_NAME_LENGTH)
+							throw HTMLFormException("Field name too long");
+						if (eq && remaining - nameLength - 1 > static_cast<std::size_t>(_valueLengthLimit))
+							throw HTMLFormException("Field value too long");
+					}
+					break;
+				}
+				fieldEnd = start + remaining;
+			}
+
+			if (_fieldLimit > 0 && fields == _fieldLimit)
+				throw HTMLFormException("Too many form fields");
+			const char* eq = static_cast<const char*>(std::memchr(start, '=', fieldEnd - start));
+			const char* nameEnd = eq ? eq : fieldEnd;
+			if (nameEnd - start > MAX_NAME_LENGTH)
+				throw HTMLFormException("Field name too long");
+			// remove UTF-8 byte order mark from first name, if present
+			if (isFirst && nameEnd - start >= 3 && std::memcmp(start, "\357\273\277", 3) == 0)
+				start += 3;
+			std::string name;
+			std::string value;
+			decodeFormComponent(start, nameEnd, name);
+			if (eq)
+			{
+				if (fieldEnd - eq - 1 > static_cast<std::ptrdiff_t>(_valueLengthLimit))
 					throw HTMLFormException("Field value too long");
-				ch = istr.get();
+				decodeFormComponent(eq + 1, fieldEnd, value);
 			}
+			add(name, value);
+			++fields;
+			isFirst = false;
+			begin = static_cast<std::size_t>(fieldEnd - buffer.data());
+			if (haveSeparator) ++begin;
 		}
-		// remove UTF-8 byte order mark from first name, if present
-		if (isFirst)
-		{
-			UTF8::removeBOM(name);
-		}
-		std::string decodedName;
-		std::string decodedValue;
-		URI::decode(name, decodedName);
-		URI::decode(value, decodedValue);
-		add(decodedName, decodedValue);
-		++fields;
-		if (ch == '&') ch = istr.get();
-		isFirst = false;
+		buffer.erase(0, begin);
 	}
 }
 
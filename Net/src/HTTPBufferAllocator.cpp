@@ -13,6 +13,8 @@
 
 
 #include "Poco/Net/HTTPBufferAllocator.h"
+#include "Poco/ThreadLocal.h"
+#include <vector>
 
 
 using Poco::MemoryPool;
@@ -22,22 +24,111 @@ namespace Poco {
 namespace Net {
 
 
-MemoryPool HTTPBufferAllocator::_pool(HTTPBufferAllocator::BUFFER_SIZE, 16);
+namespace
+{
+	enum { TIER_COUNT = 3 };
+
+
+	int tierFor(std::streamsize size)
+	{
+		if (size <= HTTPBufferAllocator::BUFFER_SIZE_SMALL)  return 0;
+		if (size <= HTTPBufferAllocator::BUFFER_SIZE_MEDIUM) return 1;
+		if (size <= HTTPBufferAllocator::BUFFER_SIZE_LARGE)  return 2;
+		return -1;
+	}
+
+
+	MemoryPool& poolFor(int tier)
+		/// Returns the shared pool for the given tier.
+		///
+		/// The pools are created on first use and intentionally
+		/// never destroyed: the per-thread caches release their
+		/// buffers during thread-local storage cleanup, which can
+		/// run after static destructors.
+	{
+		static MemoryPool* pools[TIER_COUNT] =
+		{
+			new MemoryPool(HTTPBufferAllocator::BUFFER_SIZE_SMALL, 16),
+			new MemoryPool(HTTPBufferAllocator::BUFFER_SIZE_MEDIUM, 4),
+			new MemoryPool(HTTPBufferAllocator::BUFFER_SIZE_LARGE, 1)
+		};
+		return *pools[tier];
+	}
+
+
+	class ThreadBufferCache
+		/// A small per-thread cache of recently released buffers.
+		/// Buffers still cached when the thread's local storage is
+		/// cleaned up are handed back to the shared pools.
+	{
+	public:
+		enum { MAX_CACHED = 4 };
+
+		~ThreadBufferCache()
+		{
+			for (int tier = 0; tier < TIER_COUNT; ++tier)
+			{
+				for (std::vector<char*>::iterator it = _buffers[tier].begin(); it != _buffers[tier].end(); ++it)
+				{
+					poolFor(tier).release(*it);
+				}
+			}
+		}
+
+		char* get(int tier)
+		{
+			std::vector<char*>& buffers = _buffers[tier];
+			if (!buffers.empty())
+			{
+				char* ptr = buffers.back();
+				buffers.pop_back();
+				return ptr;
+			}
+			return reinterpret_cast<char*>(poolFor(tier).get());
+		}
+
+		bool put(int tier, char* ptr)
+		{
+			std::vector<char*>& buffers = _buffers[tier];
+			if (buffers.size() < MAX_CACHED)
+			{
+				buffers.push_back(ptr);
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		std::vector<char*> _buffers[TIER_COUNT];
+	};
+
+
+	Poco::ThreadLocal<ThreadBufferCache> threadBufferCache;
+}
 
 
 char* HTTPBufferAllocator::allocate(std::streamsize size)
 {
-	poco_assert_dbg (size == BUFFER_SIZE);
-
-	return reinterpret_cast<char*>(_pool.get());
+	int tier = tierFor(size);
+	if (tier >= 0)
+		return threadBufferCache->get(tier);
+	else
+		return new char[static_cast<std::size_t>(size)];
 }
 
 
 void HTTPBufferAllocator::deallocate(char* ptr, std::streamsize size)
 {
-	poco_assert_dbg (size == BUFFER_SIZE);
-
-	_pool.release(ptr);
+	int tier = tierFor(size);
+	if (tier >= 0)
+	{
+		if (!threadBufferCache->put(tier, ptr))
+			poolFor(tier).release(ptr);
+	}
+	else
+	{
+		delete [] ptr;
+	}
 }
 
 
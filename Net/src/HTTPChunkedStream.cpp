@@ -36,7 +36,9 @@ HTTPChunkedStreamBuf::HTTPChunkedStreamBuf(HTTPSession& session, openmode mode):
 	HTTPBasicStreamBuf(HTTPBufferAllocator::BUFFER_SIZE, mode),
 	_session(session),
 	_mode(mode),
-	_chunk(0)
+	_chunk(0),
+	_maxChunkSize(DEFAULT_MAX_CHUNK_SIZE),
+	_chunkBuffer(CHUNK_HEADER_SIZE, '0')
 {
 }
 
@@ -50,12 +52,26 @@ void HTTPChunkedStreamBuf::close()
 {
 	if (_mode & std::ios::out)
 	{
-		sync();
-		_session.write("0\r\n\r\n", 5);
+		HTTPBasicStreamBuf::sync();
+		emitChunk(true);
 	}
 }
 
 
+void HTTPChunkedStreamBuf::setMaxChunkSize(std::streamsize size)
+{
+	poco_assert (size > 0);
+
+	_maxChunkSize = size;
+}
+
+
+std::streamsize HTTPChunkedStreamBuf::getMaxChunkSize() const
+{
+	return _maxChunkSize;
+}
+
+
 int HTTPChunkedStreamBuf::readFromDevice(char* buffer, std::streamsize length)
 {
 	static const int eof = std::char_traits<char>::eof();
@@ -92,16 +108,48 @@ int HTTPChunkedStreamBuf::readFromDevice(char* buffer, std::streamsize length)
 
 int HTTPChunkedStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
 {
-	_chunkBuffer.clear();
-	NumberFormatter::appendHex(_chunkBuffer, length);
-	_chunkBuffer.append("\r\n", 2);
-	_chunkBuffer.append(buffer, static_cast<std::string::size_type>(length));
-	_chunkBuffer.append("\r\n", 2);
-	_session.write(_chunkBuffer.data(), static_cast<std::streamsize>(_chunkBuffer.size()));
+	if (length > 0)
+	{
+		_chunkBuffer.append(buffer, static_cast<std::string::size_type>(length));
+		if (_chunkBuffer.size() - CHUNK_HEADER_SIZE >= static_cast<std::string::size_type>(_maxChunkSize))
+			emitChunk();
+	}
 	return static_cast<int>(length);
 }
 
 
+int HTTPChunkedStreamBuf::sync()
+{
+	int rc = HTTPBasicStreamBuf::sync();
+	if (rc == 0 && (_mode & std::ios::out)) emitChunk();
+	return rc;
+}
+
+
+void HTTPChunkedStreamBuf::emitChunk(bool last)
+{
+	// the chunk payload accumulates after the space reserved for
+	// the size line, so that the complete chunk can be sent with
+	// a single write, starting at the first digit of the size
+	std::string::size_type payload = _chunkBuffer.size() - CHUNK_HEADER_SIZE;
+	std::string::size_type start = CHUNK_HEADER_SIZE;
+	if (payload > 0)
+	{
+		std::string size;
+		NumberFormatter::appendHex(size, payload);
+		start = CHUNK_HEADER_SIZE - 2 - size.length();
+		_chunkBuffer.replace(start, size.length(), size);
+		_chunkBuffer[CHUNK_HEADER_SIZE - 2] = '\r';
+		_chunkBuffer[CHUNK_HEADER_SIZE - 1] = '\n';
+		_chunkBuffer.append("\r\n", 2);
+	}
+	if (last) _chunkBuffer.append("0\r\n\r\n", 5);
+	if (_chunkBuffer.size() > start)
+		_session.write(_chunkBuffer.data() + start, static_cast<std::streamsize>(_chunkBuffer.size() - start));
+	_chunkBuffer.resize(CHUNK_HEADER_SIZE);
+}
+
+
 //
 // HTTPChunkedIOS
 //
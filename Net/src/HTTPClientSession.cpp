@@ -22,6 +22,7 @@
 #include "Poco/Net/HTTPBasicCredentials.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/URIView.h"
 #include "Poco/CountingStream.h"
 #include "Poco/RegularExpression.h"
 #include <sstream>
@@ -115,6 +116,19 @@ HTTPClientSession::HTTPClientSession(const std::string& host, Poco::UInt16 port)
 }
 
 
+HTTPClientSession::HTTPClientSession(const Poco::URIView& uri):
+	_host(uri.host().toString()),
+	_port(uri.portNumber() != 0 ? uri.portNumber() : Poco::UInt16(HTTPSession::HTTP_PORT)),
+	_proxyConfig(_globalProxyConfig),
+	_keepAliveTimeout(DEFAULT_KEEP_ALIVE_TIMEOUT, 0),
+	_reconnect(false),
+	_mustReconnect(false),
+	_expectResponseBody(false),
+	_responseReceived(false)
+{
+}
+
+
 HTTPClientSession::HTTPClientSession(const std::string& host, Poco::UInt16 port, const ProxyConfig& proxyConfig):
 	_host(host),
 	_port(port),
@@ -246,9 +260,11 @@ std::ostream& HTTPClientSession::sendRequest(HTTPRequest& request)
 	try
 	{
 		if (!connected())
+		{
 			_logger.debug("sendRequest: Reconnect Start : " + request.getURI());
 			reconnect();
 			_logger.debug("sendRequest: Reconnect Done : " + request.getURI());
+		}
 		if (!keepAlive)
 			request.setKeepAlive(false);
 		if (!request.has(HTTPRequest::HOST) && !_host.empty())
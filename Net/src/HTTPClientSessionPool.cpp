@@ -0,0 +1,195 @@
+//
+// HTTPClientSessionPool.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientSessionPool
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPClientSessionPool.h"
+#include "Poco/Net/HTTPSessionFactory.h"
+#include "Poco/Net/HTTPMessage.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/SingletonHolder.h"
+#include "Poco/Exception.h"
+
+
+using Poco::FastMutex;
+using Poco::Timestamp;
+
+
+namespace Poco {
+namespace Net {
+
+
+//
+// HTTPExchange
+//
+
+
+HTTPExchange::HTTPExchange(const Poco::URI& uri, const std::string& method):
+	_uri(uri),
+	_request(method, uri.getPathAndQuery().empty() ? std::string("/") : uri.getPathAndQuery(), HTTPMessage::HTTP_1_1)
+{
+}
+
+
+HTTPExchange::~HTTPExchange()
+{
+}
+
+
+//
+// HTTPClientSessionPool
+//
+
+
+HTTPClientSessionPool::HTTPClientSessionPool(int maxSessionsPerHost, long maxIdleTime):
+	sendRequestAsync(this, &HTTPClientSessionPool::exchangeImpl),
+	_maxSessionsPerHost(maxSessionsPerHost),
+	_maxIdleTime(maxIdleTime)
+{
+	poco_assert (maxSessionsPerHost > 0);
+	poco_assert (maxIdleTime > 0);
+}
+
+
+HTTPClientSessionPool::~HTTPClientSessionPool()
+{
+}
+
+
+HTTPClientSessionPool::SessionPtr HTTPClientSessionPool::acquire(const Poco::URI& uri)
+{
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		closeIdleImpl();
+		SessionMap::iterator it = _pool.find(keyFor(uri.getScheme(), uri.getHost(), uri.getPort()));
+		if (it != _pool.end())
+		{
+			SessionVec& sessions = it->second;
+			while (!sessions.empty())
+			{
+				SessionPtr pSession = sessions.back().pSession;
+				sessions.pop_back();
+				if (pSession->connected()) return pSession;
+			}
+		}
+	}
+	HTTPClientSession* pSession;
+	if (HTTPSessionFactory::defaultFactory().supportsProtocol(uri.getScheme()))
+		pSession = HTTPSessionFactory::defaultFactory().createClientSession(uri);
+	else if (uri.getScheme() == "http")
+		pSession = new HTTPClientSession(uri.getHost(), uri.getPort());
+	else
+		throw Poco::UnknownURISchemeException(uri.getScheme());
+	pSession->setKeepAlive(true);
+	return SessionPtr(pSession);
+}
+
+
+void HTTPClientSessionPool::release(SessionPtr pSession)
+{
+	if (pSession.isNull()) return;
+	if (!pSession->connected() || !pSession->getKeepAlive()) return;
+
+	std::string key = keyFor(pSession->socket().secure() ? "https" : "http", pSession->getHost(), pSession->getPort());
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	SessionVec& sessions = _pool[key];
+	if (sessions.size() < static_cast<SessionVec::size_type>(_maxSessionsPerHost))
+	{
+		PooledSession pooled;
+		pooled.pSession = pSession;
+		pooled.idleSince.update();
+		sessions.push_back(pooled);
+	}
+}
+
+
+void HTTPClientSessionPool::closeIdle()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	closeIdleImpl();
+}
+
+
+void HTTPClientSessionPool::clear()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_pool.clear();
+}
+
+
+namespace
+{
+	static Poco::SingletonHolder<HTTPClientSessionPool> sh;
+}
+
+
+HTTPClientSessionPool& HTTPClientSessionPool::defaultPool()
+{
+	return *sh.get();
+}
+
+
+HTTPExchange::Ptr HTTPClientSessionPool::exchangeImpl(const HTTPExchange::Ptr& pExchange)
+{
+	HTTPExchange::Ptr pEx(pExchange);
+	SessionPtr pSession = acquire(pEx->uri());
+	HTTPRequest& request = pEx->request();
+	if (!pEx->requestBody().empty())
+		request.setContentLength(static_cast<std::streamsize>(pEx->requestBody().size()));
+	std::ostream& ostr = pSession->sendRequest(request);
+	ostr.write(pEx->requestBody().data(), static_cast<std::streamsize>(pEx->requestBody().size()));
+	std::istream& istr = pSession->receiveResponse(pEx->response());
+	pEx->responseBody().clear();
+	Poco::StreamCopier::copyToString(istr, pEx->responseBody());
+	release(pSession);
+	return pEx;
+}
+
+
+void HTTPClientSessionPool::closeIdleImpl()
+{
+	for (SessionMap::iterator it = _pool.begin(); it != _pool.end();)
+	{
+		SessionVec& sessions = it->second;
+		for (SessionVec::iterator itSess = sessions.begin(); itSess != sessions.end();)
+		{
+			if (itSess->idleSince.isElapsed(Timestamp::TimeDiff(_maxIdleTime)*Timestamp::resolution()))
+				itSess = sessions.erase(itSess);
+			else
+				++itSess;
+		}
+		if (sessions.empty())
+			_pool.erase(it++);
+		else
+			++it;
+	}
+}
+
+
+std::string HTTPClientSessionPool::keyFor(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	std::string key(scheme);
+	key.append("://");
+	key.append(host);
+	key.append(":");
+	Poco::NumberFormatter::append(key, port);
+	return key;
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,191 @@
+//
+// HTTPFileCache.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPFileCache
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPFileCache.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/File.h"
+#include "Poco/DateTime.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeParser.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+
+
+using Poco::FastMutex;
+using Poco::File;
+using Poco::Timestamp;
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTPFileCache::HTTPFileCache(std::size_t maxSize, std::size_t maxFileSize):
+	_maxSize(maxSize),
+	_maxFileSize(maxFileSize),
+	_size(0)
+{
+	poco_assert (maxFileSize <= maxSize);
+}
+
+
+HTTPFileCache::~HTTPFileCache()
+{
+}
+
+
+void HTTPFileCache::send(HTTPServerRequest& request, HTTPServerResponse& response, const std::string& path, const std::string& mediaType)
+{
+	EntryPtr pEntry = get(path);
+	if (pEntry.isNull())
+	{
+		// too large to cache; sendFile() uses the kernel's
+		// zero-copy path on plain connections
+		response.sendFile(path, mediaType);
+		return;
+	}
+
+	const std::string& ifNoneMatch = request.get("If-None-Match", "");
+	bool notModified = !ifNoneMatch.empty() && ifNoneMatch == pEntry->etag;
+	if (!notModified)
+	{
+		const std::string& ifModifiedSince = request.get("If-Modified-Since", "");
+		if (!ifModifiedSince.empty())
+		{
+			try
+			{
+				int tzd;
+				Poco::DateTime modifiedSince = Poco::DateTimeParser::parse(ifModifiedSince, tzd);
+				// HTTP dates have one-second resolution
+				notModified = pEntry->lastModified.epochTime() <= modifiedSince.timestamp().epochTime();
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	}
+
+	response.set("Last-Modified", pEntry->lastModifiedField);
+	response.set("ETag", pEntry->etag);
+	if (notModified)
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_NOT_MODIFIED);
+		response.setContentLength(0);
+		response.send();
+	}
+	else
+	{
+		response.setContentType(mediaType);
+		response.sendBuffer(pEntry->data, pEntry->size);
+	}
+}
+
+
+std::size_t HTTPFileCache::size() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _size;
+}
+
+
+std::size_t HTTPFileCache::cachedFiles() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _cache.size();
+}
+
+
+void HTTPFileCache::clear()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_cache.clear();
+	_lru.clear();
+	_size = 0;
+}
+
+
+HTTPFileCache::EntryPtr HTTPFileCache::get(const std::string& path)
+{
+	File f(path);
+	File::FileSize fileSize = f.getSize();
+	Timestamp lastModified = f.getLastModified();
+	if (fileSize > _maxFileSize) return EntryPtr();
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	CacheMap::iterator it = _cache.find(path);
+	if (it != _cache.end())
+	{
+		EntryPtr pEntry = it->second.pEntry;
+		if (pEntry->size == static_cast<std::size_t>(fileSize) && pEntry->lastModified == lastModified)
+		{
+			_lru.splice(_lru.begin(), _lru, it->second.lruIt);
+			return pEntry;
+		}
+		// stale: drop the mapping and reload below
+		_size -= pEntry->size;
+		_lru.erase(it->second.lruIt);
+		_cache.erase(it);
+	}
+
+	EntryPtr pEntry = new Entry;
+	if (fileSize > 0)
+	{
+		pEntry->mapping = Poco::SharedMemory(f, Poco::SharedMemory::AM_READ);
+		pEntry->data = pEntry->mapping.begin();
+	}
+	else
+	{
+		pEntry->data = "";
+	}
+	pEntry->size = static_cast<std::size_t>(fileSize);
+	pEntry->lastModified = lastModified;
+	pEntry->lastModifiedField = Poco::DateTimeFormatter::format(lastModified, Poco::DateTimeFormat::HTTP_FORMAT);
+	pEntry->etag.reserve(32);
+	pEntry->etag += '"';
+	Poco::NumberFormatter::appendHex(pEntry->etag, static_cast<Poco::UInt64>(fileSize));
+	pEntry->etag += '-';
+	Poco::NumberFormatter::appendHex(pEntry->etag, static_cast<Poco::UInt64>(lastModified.epochTime()));
+	pEntry->etag += '"';
+
+	CacheSlot slot;
+	slot.pEntry = pEntry;
+	_lru.push_front(path);
+	slot.lruIt = _lru.begin();
+	_cache[path] = slot;
+	_size += pEntry->size;
+	evict();
+	return pEntry;
+}
+
+
+void HTTPFileCache::evict()
+{
+	while (_size > _maxSize && !_lru.empty())
+	{
+		CacheMap::iterator it = _cache.find(_lru.back());
+		poco_assert_dbg (it != _cache.end());
+		_size -= it->second.pEntry->size;
+		_cache.erase(it);
+		_lru.pop_back();
+	}
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,179 @@
+//
+// HTTPHeaderParser.cpp
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPHeaderParser
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPHeaderParser.h"
+#include "Poco/Net/HTTPSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/String.h"
+#include "Poco/Types.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	enum Limits
+		/// Same limits as enforced by the stream-based parsers
+		/// in HTTPRequest and MessageHeader.
+	{
+		MAX_METHOD_LENGTH  = 32,
+		MAX_URI_LENGTH     = 16384,
+		MAX_VERSION_LENGTH = 8,
+		MAX_NAME_LENGTH    = 256,
+		MAX_VALUE_LENGTH   = 8192
+	};
+
+
+	const char* findChar(const char* begin, const char* end, char c)
+		/// Returns a pointer to the first occurrence of c in
+		/// [begin, end), or end if there is none. Scans one
+		/// machine word at a time (SWAR), using the usual
+		/// zero-byte detection trick on the word XORed with
+		/// the broadcast search character.
+	{
+		typedef std::size_t Word;
+		const Word ONES = static_cast<Word>(-1)/0xFF; // 0x0101...01
+		const Word HIGH = ONES << 7;                  // 0x8080...80
+		const Word pattern = ONES*static_cast<unsigned char>(c);
+
+		const char* p = begin;
+		while (p < end && (reinterpret_cast<Poco::UIntPtr>(p) & (sizeof(Word) - 1)) != 0)
+		{
+			if (*p == c) return p;
+			++p;
+		}
+		while (p + sizeof(Word) <= end)
+		{
+			Word w = *reinterpret_cast<const Word*>(p) ^ pattern;
+			if ((w - ONES) & ~w & HIGH) break;
+			p += sizeof(Word);
+		}
+		while (p < end)
+		{
+			if (*p == c) return p;
+			++p;
+		}
+		return end;
+	}
+}
+
+
+bool HTTPHeaderParser::parse(HTTPSession& session, HTTPRequest& request)
+{
+	if (session.buffered() == 0) session.refill();
+	const char* p   = session._pCurrent;
+	const char* end = session._pEnd;
+	if (p == end) return false; // connection closed; let the stream parser report it
+
+	while (p < end && (*p == '\r' || *p == '\n')) ++p;
+
+	// locate the empty line terminating the header;
+	// if it is not completely buffered, consume nothing
+	const char* headerEnd = 0;
+	const char* lineBegin = p;
+	while (lineBegin < end)
+	{
+		const char* eol = findChar(lineBegin, end, '\n');
+		if (eol == end) break;
+		const char* contentEnd = eol;
+		if (contentEnd > lineBegin && contentEnd[-1] == '\r') --contentEnd;
+		if (contentEnd == lineBegin)
+		{
+			headerEnd = eol + 1;
+			break;
+		}
+		lineBegin = eol + 1;
+	}
+	if (!headerEnd) return false;
+
+	// request line
+	const char* eol = findChar(p, headerEnd, '\n');
+	const char* lineEnd = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+	const char* tokenBegin = p;
+	while (p < lineEnd && *p != ' ' && *p != '\t') ++p;
+	if (p == tokenBegin || p == lineEnd || p - tokenBegin > MAX_METHOD_LENGTH)
+		throw MessageException("HTTP request method invalid or too long");
+	std::string method(tokenBegin, p);
+	while (p < lineEnd && (*p == ' ' || *p == '\t')) ++p;
+	tokenBegin = p;
+	while (p < lineEnd && *p != ' ' && *p != '\t') ++p;
+	if (p == tokenBegin || p == lineEnd || p - tokenBegin > MAX_URI_LENGTH)
+		throw MessageException("HTTP request URI invalid or too long");
+	std::string uri(tokenBegin, p);
+	while (p < lineEnd && (*p == ' ' || *p == '\t')) ++p;
+	tokenBegin = p;
+	while (p < lineEnd && *p != ' ' && *p != '\t') ++p;
+	if (p == tokenBegin || p - tokenBegin > MAX_VERSION_LENGTH)
+		throw MessageException("Invalid HTTP version string");
+	std::string version(tokenBegin, p);
+	p = eol + 1;
+
+	// header fields
+	int fields = 0;
+	int fieldLimit = request.getFieldLimit();
+	std::string value;
+	value.reserve(64);
+	while (p < headerEnd)
+	{
+		eol = findChar(p, headerEnd, '\n');
+		lineEnd = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+		if (lineEnd == p) // empty line terminates the header
+		{
+			p = eol + 1;
+			break;
+		}
+		if (fieldLimit > 0 && fields == fieldLimit)
+			throw MessageException("Too many header fields");
+		const char* colon = findChar(p, lineEnd, ':');
+		if (colon - p > MAX_NAME_LENGTH)
+			throw MessageException("Field name too long/no colon found");
+		if (colon == lineEnd) // ignore invalid header lines
+		{
+			p = eol + 1;
+			continue;
+		}
+		const char* nameBegin = p;
+		const char* nameEnd = colon;
+		p = colon + 1;
+		while (p < lineEnd && (*p == ' ' || *p == '\t')) ++p;
+		if (lineEnd - p > MAX_VALUE_LENGTH)
+			throw MessageException("Field value too long/no CRLF found");
+		value.assign(p, lineEnd);
+		p = eol + 1;
+		while (p < headerEnd && (*p == ' ' || *p == '\t')) // folding
+		{
+			eol = findChar(p, headerEnd, '\n');
+			lineEnd = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+			if (value.length() + (lineEnd - p) > MAX_VALUE_LENGTH)
+				throw MessageException("Folded field value too long/no CRLF found");
+			value.append(p, lineEnd);
+			p = eol + 1;
+		}
+		Poco::trimRightInPlace(value);
+		request.add(nameBegin, nameEnd - nameBegin, MessageHeader::decodeWord(value));
+		++fields;
+	}
+
+	session._pCurrent += headerEnd - session._pCurrent;
+	request.setMethod(method);
+	request.setURI(uri);
+	request.setVersion(version);
+	return true;
+}
+
+
+} } // namespace Poco::Net
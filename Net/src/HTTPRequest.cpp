@@ -16,6 +16,7 @@
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/NameValueCollection.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/URIView.h"
 #include "Poco/Ascii.h"
 #include "Poco/String.h"
 
@@ -66,6 +67,13 @@ HTTPRequest::HTTPRequest(const std::string& method, const std::string& uri):
 }
 
 
+HTTPRequest::HTTPRequest(const std::string& method, const Poco::URIView& uri):
+	_method(method)
+{
+	setURI(uri);
+}
+
+
 HTTPRequest::HTTPRequest(const std::string& method, const std::string& uri, const std::string& version):
 	HTTPMessage(version),
 	_method(method),
@@ -91,6 +99,16 @@ void HTTPRequest::setURI(const std::string& uri)
 }
 
 
+void HTTPRequest::setURI(const Poco::URIView& uri)
+{
+	Poco::URIView::Part pathAndQuery = uri.pathAndQuery();
+	if (pathAndQuery.empty())
+		_uri = "/";
+	else
+		_uri = pathAndQuery.toString();
+}
+
+
 void HTTPRequest::setHost(const std::string& host)
 {
 	set(HOST, host);
@@ -22,6 +22,8 @@
 #include "Poco/DateTimeParser.h"
 #include "Poco/Ascii.h"
 #include "Poco/String.h"
+#include "Poco/Mutex.h"
+#include <ctime>
 
 
 using Poco::DateTime;
@@ -176,9 +178,27 @@ void HTTPResponse::setStatusAndReason(HTTPStatus status)
 }
 
 
+namespace
+{
+	Poco::FastMutex formattedDateMutex;
+	std::time_t     formattedDateTime(-1);
+	std::string     formattedDate;
+}
+
+
 void HTTPResponse::setDate(const Poco::Timestamp& dateTime)
 {
-	set(DATE, DateTimeFormatter::format(dateTime, DateTimeFormat::HTTP_FORMAT));
+	// formatting the RFC 1123 date is expensive enough to show up
+	// on busy servers; the formatted value only changes once per
+	// second, so it is cached
+	std::time_t t = dateTime.epochTime();
+	Poco::FastMutex::ScopedLock lock(formattedDateMutex);
+	if (t != formattedDateTime)
+	{
+		formattedDate = DateTimeFormatter::format(dateTime, DateTimeFormat::HTTP_FORMAT);
+		formattedDateTime = t;
+	}
+	set(DATE, formattedDate);
 }
 
 	
@@ -218,6 +238,19 @@ void HTTPResponse::write(std::ostream& ostr) const
 }
 
 
+void HTTPResponse::write(std::string& str) const
+{
+	str.append(getVersion());
+	str.append(" ", 1);
+	NumberFormatter::append(str, static_cast<int>(_status));
+	str.append(" ", 1);
+	str.append(_reason);
+	str.append("\r\n", 2);
+	MessageHeader::write(str);
+	str.append("\r\n", 2);
+}
+
+
 void HTTPResponse::read(std::istream& istr)
 {
 	static const int eof = std::char_traits<char>::eof();
@@ -40,4 +40,19 @@ TCPServerConnection* HTTPServerConnectionFactory::createConnection(const StreamS
 }
 
 
+bool HTTPServerConnectionFactory::supportsReset() const
+{
+	return true;
+}
+
+
+void HTTPServerConnectionFactory::resetConnection(TCPServerConnection* pConnection, const StreamSocket& socket)
+{
+	TCPServerConnectionFactory::resetConnection(pConnection, socket);
+	HTTPServerConnection* pHTTPConnection = static_cast<HTTPServerConnection*>(pConnection);
+	Poco::FastMutex::ScopedLock lock(pHTTPConnection->_mutex);
+	pHTTPConnection->_stopped = false;
+}
+
+
 } } // namespace Poco::Net
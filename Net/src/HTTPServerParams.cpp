@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPBufferAllocator.h"
 
 
 namespace Poco {
@@ -23,7 +24,8 @@ HTTPServerParams::HTTPServerParams():
 	_timeout(60000000),
 	_keepAlive(true),
 	_maxKeepAliveRequests(0),
-	_keepAliveTimeout(15000000)
+	_keepAliveTimeout(15000000),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE)
 {
 }
 
@@ -70,4 +72,10 @@ void HTTPServerParams::setMaxKeepAliveRequests(int maxKeepAliveRequests)
 }
 	
 
+void HTTPServerParams::setBufferSize(std::size_t bufferSize)
+{
+	_bufferSize = bufferSize;
+}
+
+
 } } // namespace Poco::Net
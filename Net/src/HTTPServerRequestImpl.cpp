@@ -15,6 +15,7 @@
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPHeaderParser.h"
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPStream.h"
 #include "Poco/Net/HTTPFixedLengthStream.h"
@@ -39,8 +40,14 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 {
 	response.attachRequest(this);
 
-	HTTPHeaderInputStream hs(session);
-	read(hs);
+	// parse the header directly from the session buffer if it is
+	// completely buffered; otherwise fall back to stream-based
+	// parsing, which can read across buffer refills
+	if (!HTTPHeaderParser::parse(session, *this))
+	{
+		HTTPHeaderInputStream hs(session);
+		read(hs);
+	}
 	
 	// Now that we know socket is still connected, obtain addresses
 	_clientAddress = session.clientAddress();
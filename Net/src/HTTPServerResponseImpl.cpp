@@ -23,7 +23,6 @@
 #include "Poco/Timestamp.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/StreamCopier.h"
-#include "Poco/CountingStream.h"
 #include "Poco/Exception.h"
 #include "Poco/FileStream.h"
 #include "Poco/DateTimeFormatter.h"
@@ -68,38 +67,40 @@ std::ostream& HTTPServerResponseImpl::send()
 {
 	poco_assert (!_pStream);
 
+	// the response head is serialized into the session's scratch
+	// buffer, which also yields its size without a counting pass,
+	// and handed to the stream with a single write
+	std::string& head = _session.headBuffer();
+	head.clear();
+	write(head);
 	if ((_pRequest && _pRequest->getMethod() == HTTPRequest::HTTP_HEAD) ||
 		getStatus() < 200 ||
 		getStatus() == HTTPResponse::HTTP_NO_CONTENT ||
 		getStatus() == HTTPResponse::HTTP_NOT_MODIFIED)
 	{
-		Poco::CountingOutputStream cs;
-		write(cs);
-		_pStream = new HTTPFixedLengthOutputStream(_session, cs.chars());
-		write(*_pStream);
+		_pStream = new HTTPFixedLengthOutputStream(_session, static_cast<std::streamsize>(head.size()));
+		_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 	}
 	else if (getChunkedTransferEncoding())
 	{
 		HTTPHeaderOutputStream hs(_session);
-		write(hs);
+		hs.write(head.data(), static_cast<std::streamsize>(head.size()));
 		_pStream = new HTTPChunkedOutputStream(_session);
 	}
 	else if (hasContentLength())
 	{
-		Poco::CountingOutputStream cs;
-		write(cs);
-#if defined(POCO_HAVE_INT64)	
-		_pStream = new HTTPFixedLengthOutputStream(_session, getContentLength64() + cs.chars());
+#if defined(POCO_HAVE_INT64)
+		_pStream = new HTTPFixedLengthOutputStream(_session, getContentLength64() + static_cast<std::streamsize>(head.size()));
 #else
-		_pStream = new HTTPFixedLengthOutputStream(_session, getContentLength() + cs.chars());
+		_pStream = new HTTPFixedLengthOutputStream(_session, getContentLength() + static_cast<std::streamsize>(head.size()));
 #endif
-		write(*_pStream);
+		_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 	}
 	else
 	{
 		_pStream = new HTTPOutputStream(_session);
 		setKeepAlive(false);
-		write(*_pStream);
+		_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 	}
 	return *_pStream;
 }
@@ -124,11 +125,24 @@ void HTTPServerResponseImpl::sendFile(const std::string& path, const std::string
 	Poco::FileInputStream istr(path);
 	if (istr.good())
 	{
+		std::string& head = _session.headBuffer();
+		head.clear();
+		write(head);
 		_pStream = new HTTPHeaderOutputStream(_session);
-		write(*_pStream);
+		_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 		if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
 		{
-			StreamCopier::copyStream(istr, *_pStream);
+			if (_session.socket().secure())
+			{
+				StreamCopier::copyStream(istr, *_pStream);
+			}
+			else
+			{
+				// plain connection: hand the file to the kernel instead
+				// of copying it through user space
+				_pStream->flush();
+				_session.socket().sendFile(istr, 0, static_cast<Poco::Int64>(length));
+			}
 		}
 	}
 	else throw OpenFileException(path);
@@ -141,9 +155,12 @@ void HTTPServerResponseImpl::sendBuffer(const void* pBuffer, std::size_t length)
 
 	setContentLength(static_cast<int>(length));
 	setChunkedTransferEncoding(false);
-	
+
+	std::string& head = _session.headBuffer();
+	head.clear();
+	write(head);
 	_pStream = new HTTPHeaderOutputStream(_session);
-	write(*_pStream);
+	_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 	if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
 	{
 		_pStream->write(static_cast<const char*>(pBuffer), static_cast<std::streamsize>(length));
@@ -161,8 +178,11 @@ void HTTPServerResponseImpl::redirect(const std::string& uri, HTTPStatus status)
 	setStatusAndReason(status);
 	set("Location", uri);
 
+	std::string& head = _session.headBuffer();
+	head.clear();
+	write(head);
 	_pStream = new HTTPHeaderOutputStream(_session);
-	write(*_pStream);
+	_pStream->write(head.data(), static_cast<std::streamsize>(head.size()));
 }
 
 
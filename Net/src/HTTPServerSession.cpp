@@ -26,6 +26,7 @@ HTTPServerSession::HTTPServerSession(const StreamSocket& socket, HTTPServerParam
 	_maxKeepAliveRequests(pParams->getMaxKeepAliveRequests())
 {
 	setTimeout(pParams->getTimeout());
+	setBufferSize(pParams->getBufferSize());
 	this->socket().setReceiveTimeout(pParams->getTimeout());
 }
 
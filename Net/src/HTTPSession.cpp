@@ -27,6 +27,7 @@ namespace Net {
 
 HTTPSession::HTTPSession():
 	_pBuffer(0),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_pCurrent(0),
 	_pEnd(0),
 	_keepAlive(false),
@@ -41,6 +42,7 @@ HTTPSession::HTTPSession():
 HTTPSession::HTTPSession(const StreamSocket& socket):
 	_socket(socket),
 	_pBuffer(0),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_pCurrent(0),
 	_pEnd(0),
 	_keepAlive(false),
@@ -55,6 +57,7 @@ HTTPSession::HTTPSession(const StreamSocket& socket):
 HTTPSession::HTTPSession(const StreamSocket& socket, bool keepAlive):
 	_socket(socket),
 	_pBuffer(0),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_pCurrent(0),
 	_pEnd(0),
 	_keepAlive(keepAlive),
@@ -70,7 +73,7 @@ HTTPSession::~HTTPSession()
 {
 	try
 	{
-		if (_pBuffer) HTTPBufferAllocator::deallocate(_pBuffer, HTTPBufferAllocator::BUFFER_SIZE);
+		if (_pBuffer) HTTPBufferAllocator::deallocate(_pBuffer, static_cast<std::streamsize>(_bufferSize));
 	}
 	catch (...)
 	{
@@ -87,6 +90,20 @@ HTTPSession::~HTTPSession()
 }
 
 
+void HTTPSession::setBufferSize(std::size_t bufferSize)
+{
+	poco_assert (!_pBuffer);
+
+	_bufferSize = bufferSize;
+}
+
+
+std::size_t HTTPSession::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
 void HTTPSession::setKeepAlive(bool keepAlive)
 {
 	_keepAlive = keepAlive;
@@ -177,10 +194,10 @@ void HTTPSession::refill()
 {
 	if (!_pBuffer)
 	{
-		_pBuffer = HTTPBufferAllocator::allocate(HTTPBufferAllocator::BUFFER_SIZE);
+		_pBuffer = HTTPBufferAllocator::allocate(static_cast<std::streamsize>(_bufferSize));
 	}
 	_pCurrent = _pEnd = _pBuffer;
-	int n = receive(_pBuffer, HTTPBufferAllocator::BUFFER_SIZE);
+	int n = receive(_pBuffer, static_cast<int>(_bufferSize));
 	_pEnd += n;
 }
 
@@ -16,10 +16,15 @@
 #include "Poco/Net/ICMPClient.h"
 #include "Poco/Net/ICMPSocket.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/ICMPSocketImpl.h"
 #include "Poco/Channel.h"
 #include "Poco/Message.h"
 #include "Poco/Exception.h"
+#include "Poco/Buffer.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
 #include <sstream>
+#include <map>
 
 
 using Poco::Channel;
@@ -108,6 +113,104 @@ int ICMPClient::ping(SocketAddress& address, int repeat) const
 }
 
 
+int ICMPClient::sweep(const std::vector<SocketAddress>& targets, int maxInFlight) const
+{
+	if (targets.empty()) return 0;
+	if (maxInFlight <= 0)
+		throw InvalidArgumentException("maxInFlight must be positive");
+
+	ICMPSocket icmpSocket(_family, _dataSize, _ttl, _timeout);
+	ICMPSocketImpl* pImpl = static_cast<ICMPSocketImpl*>(icmpSocket.impl());
+	ICMPPacket& icmpPacket = pImpl->packet();
+	int maxPacketSize = icmpPacket.maxPacketSize();
+	Poco::Buffer<Poco::UInt8> buffer(maxPacketSize);
+	SocketAddress replyAddress;
+
+	std::vector<ICMPEventArgs> hostArgs;
+	hostArgs.reserve(targets.size());
+	for (std::vector<SocketAddress>::const_iterator it = targets.begin(); it != targets.end(); ++it)
+	{
+		hostArgs.push_back(ICMPEventArgs(*it, 1, icmpSocket.dataSize(), icmpSocket.ttl()));
+	}
+
+	typedef std::map<Poco::UInt16, std::pair<std::size_t, Poco::Timestamp> > InFlightMap;
+	InFlightMap inFlight;
+	std::size_t next = 0;
+	int received = 0;
+
+	while (next < targets.size() || !inFlight.empty())
+	{
+		// fill the in-flight window with batched sends
+		while (next < targets.size() && static_cast<int>(inFlight.size()) < maxInFlight)
+		{
+			ICMPEventArgs& eventArgs = hostArgs[next];
+			pingBegin.notify(this, eventArgs);
+			icmpSocket.sendTo(targets[next]);
+			++eventArgs;
+			inFlight[icmpPacket.sequence()] = std::make_pair(next, Poco::Timestamp());
+			++next;
+		}
+
+		// wait for the next reply, but no longer than the
+		// earliest pending timeout
+		Poco::Timestamp now;
+		Poco::Timestamp::TimeDiff wait = _timeout;
+		for (InFlightMap::const_iterator it = inFlight.begin(); it != inFlight.end(); ++it)
+		{
+			Poco::Timestamp::TimeDiff remaining = _timeout - (now - it->second.second);
+			if (remaining < wait) wait = remaining;
+		}
+		if (wait < 0) wait = 0;
+		if (icmpSocket.poll(Poco::Timespan(wait), Socket::SELECT_READ))
+		{
+			try
+			{
+				int n = pImpl->receiveRawFrom(buffer.begin(), maxPacketSize, replyAddress);
+				if (icmpPacket.validReplyID(buffer.begin(), n))
+				{
+					InFlightMap::iterator it = inFlight.find(icmpPacket.replySequence(buffer.begin(), n));
+					if (it != inFlight.end())
+					{
+						ICMPEventArgs& eventArgs = hostArgs[it->second.first];
+						struct timeval then = icmpPacket.time(buffer.begin(), n);
+						struct timeval rnow = icmpPacket.time();
+						int elapsed = (int) ((((rnow.tv_sec * 1000000) + rnow.tv_usec) - ((then.tv_sec * 1000000) + then.tv_usec))/1000);
+						eventArgs.setReplyTime(0, elapsed);
+						pingReply.notify(this, eventArgs);
+						pingEnd.notify(this, eventArgs);
+						++received;
+						inFlight.erase(it);
+					}
+				}
+			}
+			catch (Exception&)
+			{
+				// stray or malformed packets picked up by the
+				// raw socket are ignored
+			}
+		}
+
+		// expire requests whose timeout has elapsed
+		now.update();
+		for (InFlightMap::iterator it = inFlight.begin(); it != inFlight.end();)
+		{
+			if (now - it->second.second >= _timeout)
+			{
+				ICMPEventArgs& eventArgs = hostArgs[it->second.first];
+				std::ostringstream os;
+				os << targets[it->second.first].host().toString() << ": Request timed out.";
+				eventArgs.setError(0, os.str());
+				pingError.notify(this, eventArgs);
+				pingEnd.notify(this, eventArgs);
+				inFlight.erase(it++);
+			}
+			else ++it;
+		}
+	}
+	return received;
+}
+
+
 int ICMPClient::pingIPv4(const std::string& address, int repeat,
 	int dataSize, int ttl, int timeout)
 {
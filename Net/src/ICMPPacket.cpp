@@ -95,6 +95,18 @@ bool ICMPPacket::validReplyID(Poco::UInt8* buffer, int length) const
 }
 
 
+Poco::UInt16 ICMPPacket::sequence() const
+{
+	return _pImpl->sequence();
+}
+
+
+Poco::UInt16 ICMPPacket::replySequence(Poco::UInt8* buffer, int length) const
+{
+	return _pImpl->replySequence(buffer, length);
+}
+
+
 std::string ICMPPacket::errorDescription(Poco::UInt8* buffer, int length)
 {
 	return _pImpl->errorDescription(buffer, length);
@@ -52,6 +52,12 @@ int ICMPSocketImpl::sendTo(const void*, int, const SocketAddress& address, int f
 }
 
 
+int ICMPSocketImpl::receiveRawFrom(void* buffer, int length, SocketAddress& address, int flags)
+{
+	return SocketImpl::receiveFrom(buffer, length, address, flags);
+}
+
+
 int ICMPSocketImpl::receiveFrom(void*, int, SocketAddress& address, int flags)
 {
 	int maxPacketSize = _icmpPacket.maxPacketSize();
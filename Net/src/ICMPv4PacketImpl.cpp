@@ -104,8 +104,7 @@ const std::string ICMPv4PacketImpl::PARAMETER_PROBLEM_CODE[] =
 
 
 ICMPv4PacketImpl::ICMPv4PacketImpl(int dataSize)
-	: ICMPPacketImpl(dataSize),
-	_seq(0)
+	: ICMPPacketImpl(dataSize)
 {
 	initPacket();
 }
@@ -124,13 +123,13 @@ int ICMPv4PacketImpl::packetSize() const
 
 void ICMPv4PacketImpl::initPacket()
 {
-	if (_seq >= MAX_SEQ_VALUE) resetSequence();
+	if (sequence() >= MAX_SEQ_VALUE) resetSequence();
 
 	Header* icp = (Header*) packet(false);
 	icp->type     = ECHO_REQUEST;
 	icp->code     = 0;
 	icp->checksum = 0;
-	icp->seq      = ++_seq;
+	icp->seq      = nextSequence();
 #if defined(POCO_VXWORKS)
 	icp->id       = 0;
 #else
@@ -193,6 +192,14 @@ bool ICMPv4PacketImpl::validReplyID(Poco::UInt8* buffer, int length) const
 }
 
 
+Poco::UInt16 ICMPv4PacketImpl::replySequence(Poco::UInt8* buffer, int length) const
+{
+	Header* icp = header(buffer, length);
+	if (!icp) throw InvalidArgumentException("Invalid packet.");
+	return icp->seq;
+}
+
+
 std::string ICMPv4PacketImpl::errorDescription(unsigned char* buffer, int length)
 {
 	Header *icp = header(buffer, length);
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/MailStream.h"
+#include <cstring>
 
 
 namespace Poco {
@@ -165,6 +166,75 @@ int MailStreamBuf::writeToDevice(char c)
 }
 
 
+std::streamsize MailStreamBuf::xsputn(const char* s, std::streamsize count)
+{
+	if (!_pOstr) return Poco::UnbufferedStreamBuf::xsputn(s, count);
+
+	std::string out;
+	out.reserve(static_cast<std::size_t>(count) + _buffer.size());
+	std::streamsize i = 0;
+	while (i < count)
+	{
+		if (_state == ST_DATA)
+		{
+			// only a CR can leave ST_DATA (_buffer is empty here);
+			// pass the run up to the next CR through unchanged
+			const char* start = s + i;
+			const char* cr = static_cast<const char*>(std::memchr(start, '\r', static_cast<std::size_t>(count - i)));
+			std::streamsize n = cr ? static_cast<std::streamsize>(cr - start) : count - i;
+			if (n > 0)
+			{
+				out.append(start, static_cast<std::size_t>(n));
+				i += n;
+				continue;
+			}
+		}
+		char c = s[i++];
+		switch (c)
+		{
+		case '\r':
+			_state = ST_CR;
+			break;
+		case '\n':
+			if (_state == ST_CR)
+				_state = ST_CR_LF;
+			else
+				_state = ST_DATA;
+			break;
+		case '.':
+			if (_state == ST_CR_LF)
+				_state = ST_CR_LF_DOT;
+			else
+				_state = ST_DATA;
+			break;
+		default:
+			_state = ST_DATA;
+		}
+		if (_state == ST_DATA)
+		{
+			if (!_buffer.empty())
+			{
+				out += _buffer;
+				_buffer.clear();
+			}
+			out += c;
+		}
+		else if (_state == ST_CR_LF_DOT)
+		{
+			// buffer contains one or more CR-LF pairs
+			out += _buffer;
+			out += "..";
+			_state = ST_DATA;
+			_buffer.clear();
+		}
+		else _buffer += c;
+	}
+	if (!out.empty())
+		_pOstr->write(out.data(), (std::streamsize) out.length());
+	return count;
+}
+
+
 MailIOS::MailIOS(std::istream& istr): _buf(istr)
 {
 	poco_ios_init(&_buf);
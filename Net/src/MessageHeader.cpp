@@ -63,6 +63,20 @@ void MessageHeader::write(std::ostream& ostr) const
 }
 
 
+void MessageHeader::write(std::string& str) const
+{
+	NameValueCollection::ConstIterator it = begin();
+	while (it != end())
+	{
+		str.append(it->first);
+		str.append(": ", 2);
+		str.append(it->second);
+		str.append("\r\n", 2);
+		++it;
+	}
+}
+
+
 void MessageHeader::read(std::istream& istr)
 {
 	static const int eof = std::char_traits<char>::eof();
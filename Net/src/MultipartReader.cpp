@@ -16,6 +16,7 @@
 #include "Poco/Net/MessageHeader.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Ascii.h"
+#include <cstring>
 
 
 using Poco::BufferedStreamBuf;
@@ -99,11 +100,69 @@ int MultipartStreamBuf::readFromDevice(char* buffer, std::streamsize length)
 			}
 		}
 	}
-	ch = buf.sgetc();
-	while (ch != eof && ch != '\r' && ch != '\n' && n < length)
+	// Lines that cannot introduce a boundary are copied through in whole
+	// blocks taken from the source's get area and scanned with memchr(),
+	// instead of one sgetc()/sbumpc() pair per character. A newline that
+	// may introduce a boundary line ("--" following, or the block ends
+	// before it can be classified) is pushed back, so that the next call
+	// finds it at the start of a line, where the check above deals with it.
+	// All pushed-back characters come from the current get area, so
+	// sputbackc() is guaranteed to succeed.
+	while (n < length)
 	{
-		*buffer++ = (char) buf.sbumpc(); ++n;
-		ch = buf.sgetc();
+		std::streamsize avail = buf.in_avail();
+		if (avail <= 0)
+		{
+			ch = buf.sgetc();
+			if (ch == eof) break;
+			avail = buf.in_avail();
+			if (avail <= 0)
+			{
+				// unbuffered source: fall back to single characters
+				if (ch == '\r' || ch == '\n') break;
+				*buffer++ = (char) buf.sbumpc(); ++n;
+				continue;
+			}
+		}
+		std::streamsize chunk = avail;
+		if (chunk > length - n) chunk = length - n;
+		chunk = buf.sgetn(buffer, chunk);
+		if (chunk <= 0) break;
+		std::streamsize stop = -1;
+		std::streamsize k = 0;
+		while (k < chunk)
+		{
+			const char* nl = static_cast<const char*>(std::memchr(buffer + k, '\n', static_cast<std::size_t>(chunk - k)));
+			if (!nl) break;
+			std::streamsize pos   = static_cast<std::streamsize>(nl - buffer);
+			std::streamsize first = (pos > 0 && buffer[pos - 1] == '\r') ? pos - 1 : pos;
+			std::streamsize after = pos + 1;
+			if (after >= chunk)
+			{
+				stop = first;
+				break;
+			}
+			if (buffer[after] == '-')
+			{
+				if (after + 1 >= chunk || buffer[after + 1] == '-')
+				{
+					stop = first;
+					break;
+				}
+				k = after + 1;
+			}
+			else k = after;
+		}
+		std::streamsize keep = (stop >= 0) ? stop : chunk;
+		if (stop < 0 && buffer[chunk - 1] == '\r')
+			keep = chunk - 1; // a trailing CR may start a delimiter in the next block
+		for (std::streamsize i = chunk; i > keep; --i)
+		{
+			buf.sputbackc(buffer[i - 1]);
+		}
+		buffer += keep;
+		n += static_cast<int>(keep);
+		if (keep < chunk) break;
 	}
 	return n;
 }
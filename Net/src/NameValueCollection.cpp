@@ -14,6 +14,7 @@
 
 #include "Poco/Net/NameValueCollection.h"
 #include "Poco/Exception.h"
+#include "Poco/Ascii.h"
 #include <algorithm>
 
 
@@ -24,17 +25,77 @@ namespace Poco {
 namespace Net {
 
 
-NameValueCollection::NameValueCollection()
+namespace
+{
+	// interned names of standard HTTP/MIME headers, in their
+	// canonical capitalization
+	const std::string HDR_ACCEPT("Accept");
+	const std::string HDR_ACCEPT_CHARSET("Accept-Charset");
+	const std::string HDR_ACCEPT_ENCODING("Accept-Encoding");
+	const std::string HDR_ACCEPT_LANGUAGE("Accept-Language");
+	const std::string HDR_AUTHORIZATION("Authorization");
+	const std::string HDR_CACHE_CONTROL("Cache-Control");
+	const std::string HDR_CONNECTION("Connection");
+	const std::string HDR_CONTENT_ENCODING("Content-Encoding");
+	const std::string HDR_CONTENT_LENGTH("Content-Length");
+	const std::string HDR_CONTENT_TYPE("Content-Type");
+	const std::string HDR_COOKIE("Cookie");
+	const std::string HDR_DATE("Date");
+	const std::string HDR_ETAG("ETag");
+	const std::string HDR_EXPECT("Expect");
+	const std::string HDR_EXPIRES("Expires");
+	const std::string HDR_HOST("Host");
+	const std::string HDR_KEEP_ALIVE("Keep-Alive");
+	const std::string HDR_LAST_MODIFIED("Last-Modified");
+	const std::string HDR_LOCATION("Location");
+	const std::string HDR_PRAGMA("Pragma");
+	const std::string HDR_RANGE("Range");
+	const std::string HDR_REFERER("Referer");
+	const std::string HDR_SERVER("Server");
+	const std::string HDR_SET_COOKIE("Set-Cookie");
+	const std::string HDR_TRANSFER_ENCODING("Transfer-Encoding");
+	const std::string HDR_UPGRADE("Upgrade");
+	const std::string HDR_USER_AGENT("User-Agent");
+	const std::string HDR_VARY("Vary");
+	const std::string HDR_VIA("Via");
+	const std::string HDR_WWW_AUTHENTICATE("WWW-Authenticate");
+
+
+	inline bool equalsIgnoreCase(const std::string& s, const char* name, std::size_t length)
+	{
+		if (s.length() != length) return false;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			if (Poco::Ascii::toLower(s[i]) != Poco::Ascii::toLower(name[i])) return false;
+		}
+		return true;
+	}
+}
+
+
+NameValueCollection::NameValueCollection():
+	_indexValid(false)
 {
 }
 
 
 NameValueCollection::NameValueCollection(const NameValueCollection& nvc):
-	_map(nvc._map)
+	_map(nvc._map),
+	_indexValid(false)
 {
 }
 
 
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+NameValueCollection::NameValueCollection(NameValueCollection&& nvc):
+	_map(std::move(nvc._map)),
+	_indexValid(false)
+{
+	nvc._indexValid = false;
+}
+#endif
+
+
 NameValueCollection::~NameValueCollection()
 {
 }
@@ -45,48 +106,114 @@ NameValueCollection& NameValueCollection::operator = (const NameValueCollection&
 	if (&nvc != this)
 	{
 		_map = nvc._map;
+		_indexValid = false;
 	}
 	return *this;
 }
 
 
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+NameValueCollection& NameValueCollection::operator = (NameValueCollection&& nvc)
+{
+	if (&nvc != this)
+	{
+		_map = std::move(nvc._map);
+		_indexValid = false;
+		nvc._indexValid = false;
+	}
+	return *this;
+}
+#endif
+
+
 void NameValueCollection::swap(NameValueCollection& nvc)
 {
 	std::swap(_map, nvc._map);
+	std::swap(_index, nvc._index);
+	std::swap(_indexValid, nvc._indexValid);
 }
 
-	
+
 const std::string& NameValueCollection::operator [] (const std::string& name) const
 {
-	ConstIterator it = _map.find(name);
-	if (it != _map.end())
-		return it->second;
+	const std::string* pValue = findValue(name.c_str(), name.length());
+	if (pValue)
+		return *pValue;
 	else
 		throw NotFoundException(name);
 }
 
-	
-void NameValueCollection::set(const std::string& name, const std::string& value)	
+
+void NameValueCollection::set(const std::string& name, const std::string& value)
 {
-	Iterator it = _map.find(name);
-	if (it != _map.end())
-		it->second = value;
+	std::string* pValue = findValue(name.c_str(), name.length());
+	if (pValue)
+		*pValue = value;
 	else
+	{
 		_map.insert(HeaderMap::ValueType(name, value));
+		_indexValid = false;
+	}
+}
+
+
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+void NameValueCollection::set(const std::string& name, std::string&& value)
+{
+	std::string* pValue = findValue(name.c_str(), name.length());
+	if (pValue)
+		*pValue = std::move(value);
+	else
+	{
+		_map.insert(HeaderMap::ValueType(name, std::move(value)));
+		_indexValid = false;
+	}
 }
+#endif
+
+
+void NameValueCollection::set(const char* name, std::size_t length, const std::string& value)
+{
+	std::string* pValue = findValue(name, length);
+	if (pValue)
+		*pValue = value;
+	else
+		add(name, length, value);
+}
+
 
-	
 void NameValueCollection::add(const std::string& name, const std::string& value)
 {
 	_map.insert(HeaderMap::ValueType(name, value));
+	_indexValid = false;
 }
 
-	
+
+#if defined(POCO_NVC_HAVE_RVALUE_REFS)
+void NameValueCollection::add(const std::string& name, std::string&& value)
+{
+	_map.insert(HeaderMap::ValueType(name, std::move(value)));
+	_indexValid = false;
+}
+#endif
+
+
+void NameValueCollection::add(const char* name, std::size_t length, const std::string& value)
+{
+	const std::string* pInterned = findInternedName(name, length);
+	if (pInterned)
+		_map.insert(HeaderMap::ValueType(*pInterned, value));
+	else
+		_map.insert(HeaderMap::ValueType(std::string(name, length), value));
+	_indexValid = false;
+}
+
+
 const std::string& NameValueCollection::get(const std::string& name) const
 {
-	ConstIterator it = _map.find(name);
-	if (it != _map.end())
-		return it->second;
+	const std::string* pValue = findValue(name.c_str(), name.length());
+	if (pValue)
+		return *pValue;
 	else
 		throw NotFoundException(name);
 }
@@ -94,9 +221,29 @@ const std::string& NameValueCollection::get(const std::string& name) const
 
 const std::string& NameValueCollection::get(const std::string& name, const std::string& defaultValue) const
 {
-	ConstIterator it = _map.find(name);
-	if (it != _map.end())
-		return it->second;
+	const std::string* pValue = findValue(name.c_str(), name.length());
+	if (pValue)
+		return *pValue;
+	else
+		return defaultValue;
+}
+
+
+const std::string& NameValueCollection::get(const char* name, std::size_t length) const
+{
+	const std::string* pValue = findValue(name, length);
+	if (pValue)
+		return *pValue;
+	else
+		throw NotFoundException(std::string(name, length));
+}
+
+
+const std::string& NameValueCollection::get(const char* name, std::size_t length, const std::string& defaultValue) const
+{
+	const std::string* pValue = findValue(name, length);
+	if (pValue)
+		return *pValue;
 	else
 		return defaultValue;
 }
@@ -104,7 +251,13 @@ const std::string& NameValueCollection::get(const std::string& name, const std::
 
 bool NameValueCollection::has(const std::string& name) const
 {
-	return _map.find(name) != _map.end();
+	return findValue(name.c_str(), name.length()) != 0;
+}
+
+
+bool NameValueCollection::has(const char* name, std::size_t length) const
+{
+	return findValue(name, length) != 0;
 }
 
 
@@ -113,19 +266,19 @@ NameValueCollection::ConstIterator NameValueCollection::find(const std::string&
 	return _map.find(name);
 }
 
-	
+
 NameValueCollection::ConstIterator NameValueCollection::begin() const
 {
 	return _map.begin();
 }
 
-	
+
 NameValueCollection::ConstIterator NameValueCollection::end() const
 {
 	return _map.end();
 }
 
-	
+
 bool NameValueCollection::empty() const
 {
 	return _map.empty();
@@ -141,12 +294,182 @@ std::size_t NameValueCollection::size() const
 void NameValueCollection::erase(const std::string& name)
 {
 	_map.erase(name);
+	_indexValid = false;
 }
 
 
 void NameValueCollection::clear()
 {
 	_map.clear();
+	_indexValid = false;
+}
+
+
+const std::string* NameValueCollection::findInternedName(const char* name, std::size_t length)
+{
+	// the name's length, its first character and (for length 15) its
+	// eighth character form a perfect hash over the interned names,
+	// leaving at most one candidate to verify
+	const std::string* pCandidate = 0;
+	switch (length)
+	{
+	case 3:
+		pCandidate = &HDR_VIA;
+		break;
+	case 4:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'd': pCandidate = &HDR_DATE; break;
+		case 'e': pCandidate = &HDR_ETAG; break;
+		case 'h': pCandidate = &HDR_HOST; break;
+		case 'v': pCandidate = &HDR_VARY; break;
+		}
+		break;
+	case 5:
+		pCandidate = &HDR_RANGE;
+		break;
+	case 6:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'a': pCandidate = &HDR_ACCEPT; break;
+		case 'c': pCandidate = &HDR_COOKIE; break;
+		case 'e': pCandidate = &HDR_EXPECT; break;
+		case 'p': pCandidate = &HDR_PRAGMA; break;
+		case 's': pCandidate = &HDR_SERVER; break;
+		}
+		break;
+	case 7:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'e': pCandidate = &HDR_EXPIRES; break;
+		case 'r': pCandidate = &HDR_REFERER; break;
+		case 'u': pCandidate = &HDR_UPGRADE; break;
+		}
+		break;
+	case 8:
+		pCandidate = &HDR_LOCATION;
+		break;
+	case 10:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'c': pCandidate = &HDR_CONNECTION; break;
+		case 'k': pCandidate = &HDR_KEEP_ALIVE; break;
+		case 's': pCandidate = &HDR_SET_COOKIE; break;
+		case 'u': pCandidate = &HDR_USER_AGENT; break;
+		}
+		break;
+	case 12:
+		pCandidate = &HDR_CONTENT_TYPE;
+		break;
+	case 13:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'a': pCandidate = &HDR_AUTHORIZATION; break;
+		case 'c': pCandidate = &HDR_CACHE_CONTROL; break;
+		case 'l': pCandidate = &HDR_LAST_MODIFIED; break;
+		}
+		break;
+	case 14:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'a': pCandidate = &HDR_ACCEPT_CHARSET; break;
+		case 'c': pCandidate = &HDR_CONTENT_LENGTH; break;
+		}
+		break;
+	case 15:
+		switch (Poco::Ascii::toLower(name[7]))
+		{
+		case 'e': pCandidate = &HDR_ACCEPT_ENCODING; break;
+		case 'l': pCandidate = &HDR_ACCEPT_LANGUAGE; break;
+		}
+		break;
+	case 16:
+		switch (Poco::Ascii::toLower(name[0]))
+		{
+		case 'c': pCandidate = &HDR_CONTENT_ENCODING; break;
+		case 'w': pCandidate = &HDR_WWW_AUTHENTICATE; break;
+		}
+		break;
+	case 17:
+		pCandidate = &HDR_TRANSFER_ENCODING;
+		break;
+	}
+	if (pCandidate && equalsIgnoreCase(*pCandidate, name, length))
+		return pCandidate;
+	else
+		return 0;
+}
+
+
+const std::string* NameValueCollection::findValue(const char* name, std::size_t length) const
+{
+	if (_map.size() >= INDEX_THRESHOLD)
+	{
+		if (!_indexValid) buildIndex();
+		IndexEntry key;
+		key.hash  = hashName(name, length);
+		key.pPair = 0;
+		Index::const_iterator it = std::lower_bound(_index.begin(), _index.end(), key, lessHash);
+		for (; it != _index.end() && it->hash == key.hash; ++it)
+		{
+			if (equalsIgnoreCase(it->pPair->first, name, length))
+				return &it->pPair->second;
+		}
+	}
+	else
+	{
+		for (ConstIterator it = _map.begin(); it != _map.end(); ++it)
+		{
+			if (equalsIgnoreCase(it->first, name, length))
+				return &it->second;
+		}
+	}
+	return 0;
+}
+
+
+std::string* NameValueCollection::findValue(const char* name, std::size_t length)
+{
+	const NameValueCollection* pThis = this;
+	return const_cast<std::string*>(pThis->findValue(name, length));
+}
+
+
+void NameValueCollection::buildIndex() const
+{
+	_index.clear();
+	_index.reserve(_map.size());
+	for (ConstIterator it = _map.begin(); it != _map.end(); ++it)
+	{
+		IndexEntry entry;
+		entry.hash  = hashName(it->first.c_str(), it->first.length());
+		entry.pPair = &*it;
+		_index.push_back(entry);
+	}
+	// a stable sort keeps entries with equal hashes in insertion
+	// order, so that lookups find the first of multiple pairs
+	// with the same name
+	std::stable_sort(_index.begin(), _index.end(), lessHash);
+	_indexValid = true;
+}
+
+
+bool NameValueCollection::lessHash(const IndexEntry& entry1, const IndexEntry& entry2)
+{
+	return entry1.hash < entry2.hash;
+}
+
+
+Poco::UInt32 NameValueCollection::hashName(const char* name, std::size_t length)
+{
+	// case-insensitive FNV-1a
+	Poco::UInt32 hash = 0x811C9DC5;
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		hash ^= static_cast<unsigned char>(Poco::Ascii::toLower(name[i]));
+		hash *= 0x01000193;
+	}
+	return hash;
 }
 
 
@@ -25,6 +25,7 @@
 #include "Poco/StringTokenizer.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/Format.h"
+#include "Poco/Timestamp.h"
 #if defined(POCO_OS_FAMILY_WINDOWS)
 	#if defined(POCO_WIN32_UTF8)
 		#include "Poco/UnicodeConverter.h"
@@ -794,6 +795,67 @@ bool NetworkInterface::isUp() const
 }
 
 
+namespace
+{
+	FastMutex              cacheMutex;
+	NetworkInterface::Map  cacheMap;
+	Poco::Timestamp        cacheTime;
+	bool                   cacheValid(false);
+	Poco::Timespan         cacheTimeoutValue(1, 0);
+}
+
+
+void NetworkInterface::setCacheTimeout(const Poco::Timespan& timeout)
+{
+	FastMutex::ScopedLock lock(cacheMutex);
+
+	cacheTimeoutValue = timeout;
+	if (timeout == 0)
+	{
+		cacheValid = false;
+		cacheMap.clear();
+	}
+}
+
+
+Poco::Timespan NetworkInterface::getCacheTimeout()
+{
+	FastMutex::ScopedLock lock(cacheMutex);
+
+	return cacheTimeoutValue;
+}
+
+
+void NetworkInterface::invalidateCache()
+{
+	FastMutex::ScopedLock lock(cacheMutex);
+
+	cacheValid = false;
+	cacheMap.clear();
+}
+
+
+NetworkInterface::Map NetworkInterface::cachedMap()
+{
+	{
+		FastMutex::ScopedLock lock(cacheMutex);
+		if (cacheValid && cacheTime.elapsed() <= cacheTimeoutValue.totalMicroseconds())
+			return cacheMap;
+	}
+
+	Map fresh = map(false, false);
+
+	FastMutex::ScopedLock lock(cacheMutex);
+	if (cacheTimeoutValue > 0)
+	{
+		cacheMap = fresh;
+		cacheTime.update();
+		cacheValid = true;
+	}
+	return fresh;
+}
+
+
 NetworkInterface NetworkInterface::forName(const std::string& name, bool requireIPv6)
 {
 	if (requireIPv6) 
@@ -805,7 +867,7 @@ NetworkInterface NetworkInterface::forName(const std::string& name, bool require
 
 NetworkInterface NetworkInterface::forName(const std::string& name, IPVersion ipVersion)
 {
-	Map map = NetworkInterface::map(false, false);
+	Map map = cachedMap();
 	Map::const_iterator it = map.begin();
 	Map::const_iterator end = map.end();
 
@@ -827,7 +889,7 @@ NetworkInterface NetworkInterface::forName(const std::string& name, IPVersion ip
 
 NetworkInterface NetworkInterface::forAddress(const IPAddress& addr)
 {
-	Map map = NetworkInterface::map(true, false);
+	Map map = cachedMap();
 	Map::const_iterator it = map.begin();
 	Map::const_iterator end = map.end();
 
@@ -848,7 +910,7 @@ NetworkInterface NetworkInterface::forIndex(unsigned i)
 {
 	if (i != NetworkInterface::NO_INDEX)
 	{
-		Map map = NetworkInterface::map(false, false);
+		Map map = cachedMap();
 		Map::const_iterator it = map.find(i);
 		if (it != map.end())
 			return it->second;
@@ -141,11 +141,11 @@ public:
 		}
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	std::size_t poll(const Poco::Timespan& timeout, PollSet::SocketEventVec& events)
 	{
-		PollSet::SocketModeMap result;
+		events.clear();
 
-		if (_socketMap.empty()) return result;
+		if (_socketMap.empty()) return 0;
 
 		Poco::Timespan remainingTime(timeout);
 		int rc;
@@ -173,16 +173,18 @@ public:
 			std::map<void*, Socket>::iterator it = _socketMap.find(_events[i].data.ptr);
 			if (it != _socketMap.end())
 			{
+				int mode = 0;
 				if (_events[i].events & EPOLLIN)
-					result[it->second] |= PollSet::POLL_READ;
+					mode |= PollSet::POLL_READ;
 				if (_events[i].events & EPOLLOUT)
-					result[it->second] |= PollSet::POLL_WRITE;
+					mode |= PollSet::POLL_WRITE;
 				if (_events[i].events & EPOLLERR)
-					result[it->second] |= PollSet::POLL_ERROR;
+					mode |= PollSet::POLL_ERROR;
+				if (mode) events.push_back(PollSet::SocketEvent(it->second, mode));
 			}
 		}
 
-		return result;
+		return events.size();
 	}
 
 private:
@@ -250,9 +252,9 @@ public:
 		_pollfds.clear();
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	std::size_t poll(const Poco::Timespan& timeout, PollSet::SocketEventVec& events)
 	{
-		PollSet::SocketModeMap result;
+		events.clear();
 		{
 			Poco::FastMutex::ScopedLock lock(_mutex);
 
@@ -286,7 +288,7 @@ public:
 			_addMap.clear();
 		}
 
-		if (_pollfds.empty()) return result;
+		if (_pollfds.empty()) return 0;
 
 		Poco::Timespan remainingTime(timeout);
 		int rc;
@@ -321,23 +323,25 @@ public:
 					std::map<poco_socket_t, Socket>::const_iterator its = _socketMap.find(it->fd);
 					if (its != _socketMap.end())
 					{
+						int mode = 0;
 						if (it->revents & POLLIN)
-							result[its->second] |= PollSet::POLL_READ;
+							mode |= PollSet::POLL_READ;
 						if (it->revents & POLLOUT)
-							result[its->second] |= PollSet::POLL_WRITE;
+							mode |= PollSet::POLL_WRITE;
 						if (it->revents & POLLERR)
-							result[its->second] |= PollSet::POLL_ERROR;
+							mode |= PollSet::POLL_ERROR;
 #ifdef _WIN32
 						if (it->revents & POLLHUP)
-							result[its->second] |= PollSet::POLL_READ;
+							mode |= PollSet::POLL_READ;
 #endif
+						if (mode) events.push_back(PollSet::SocketEvent(its->second, mode));
 					}
 					it->revents = 0;
 				}
 			}
 		}
 
-		return result;
+		return events.size();
 	}
 
 private:
@@ -386,8 +390,10 @@ public:
 		_map.clear();
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	std::size_t poll(const Poco::Timespan& timeout, PollSet::SocketEventVec& events)
 	{
+		events.clear();
+
 		fd_set fdRead;
 		fd_set fdWrite;
 		fd_set fdExcept;
@@ -423,8 +429,7 @@ public:
 			}
 		}
 
-		PollSet::SocketModeMap result;
-		if (nfd == 0) return result;
+		if (nfd == 0) return 0;
 
 		Poco::Timespan remainingTime(timeout);
 		int rc;
@@ -456,23 +461,25 @@ public:
 				poco_socket_t fd = it->first.impl()->sockfd();
 				if (fd != POCO_INVALID_SOCKET)
 				{
+					int mode = 0;
 					if (FD_ISSET(fd, &fdRead))
 					{
-						result[it->first] |= PollSet::POLL_READ;
+						mode |= PollSet::POLL_READ;
 					}
 					if (FD_ISSET(fd, &fdWrite))
 					{
-						result[it->first] |= PollSet::POLL_WRITE;
+						mode |= PollSet::POLL_WRITE;
 					}
 					if (FD_ISSET(fd, &fdExcept))
 					{
-						result[it->first] |= PollSet::POLL_ERROR;
+						mode |= PollSet::POLL_ERROR;
 					}
+					if (mode) events.push_back(PollSet::SocketEvent(it->first, mode));
 				}
 			}
 		}
 
-		return result;
+		return events.size();
 	}
 
 private:
@@ -522,7 +529,18 @@ void PollSet::clear()
 
 PollSet::SocketModeMap PollSet::poll(const Poco::Timespan& timeout)
 {
-	return _pImpl->poll(timeout);
+	SocketModeMap result;
+	SocketEventVec events;
+	_pImpl->poll(timeout, events);
+	for (SocketEventVec::const_iterator it = events.begin(); it != events.end(); ++it)
+		result[it->socket] |= it->mode;
+	return result;
+}
+
+
+std::size_t PollSet::poll(const Poco::Timespan& timeout, SocketEventVec& events)
+{
+	return _pImpl->poll(timeout, events);
 }
 
 
@@ -84,7 +84,8 @@ public:
 	enum
 	{
 		WAITTIME_MILLISEC = 1000,
-		BUFFER_SIZE = 65536
+		BUFFER_SIZE = 65536,
+		BATCH_SIZE = 16
 	};
 	
 	RemoteUDPListener(Poco::NotificationQueue& queue, Poco::UInt16 port);
@@ -115,7 +116,12 @@ RemoteUDPListener::~RemoteUDPListener()
 
 void RemoteUDPListener::run()
 {
-	Poco::Buffer<char> buffer(BUFFER_SIZE);
+	Poco::Buffer<char> buffer(BUFFER_SIZE*BATCH_SIZE);
+	SocketMsgVec messages(BATCH_SIZE);
+	for (std::size_t i = 0; i < messages.size(); ++i)
+	{
+		messages[i] = SocketMsg(buffer.begin() + i*BUFFER_SIZE, BUFFER_SIZE);
+	}
 	Poco::Timespan waitTime(WAITTIME_MILLISEC* 1000);
 	while (!_stopped)
 	{
@@ -123,11 +129,13 @@ void RemoteUDPListener::run()
 		{
 			if (_socket.poll(waitTime, Socket::SELECT_READ))
 			{
-				Poco::Net::SocketAddress sourceAddress;
-				int n = _socket.receiveFrom(buffer.begin(), BUFFER_SIZE, sourceAddress);
-				if (n > 0)
+				int n = _socket.receiveMany(messages);
+				for (int i = 0; i < n; ++i)
 				{
-					_queue.enqueueNotification(new MessageNotification(buffer.begin(), n, sourceAddress));
+					if (messages[i].size > 0)
+					{
+						_queue.enqueueNotification(new MessageNotification(reinterpret_cast<char*>(messages[i].data()), messages[i].size, messages[i].address));
+					}
 				}
 			}
 		}
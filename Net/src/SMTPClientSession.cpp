@@ -51,14 +51,16 @@ namespace Net {
 
 SMTPClientSession::SMTPClientSession(const StreamSocket& socket):
 	_socket(socket),
-	_isOpen(false)
+	_isOpen(false),
+	_pipelining(false)
 {
 }
 
 
 SMTPClientSession::SMTPClientSession(const std::string& host, Poco::UInt16 port):
 	_socket(SocketAddress(host, port)),
-	_isOpen(false)
+	_isOpen(false),
+	_pipelining(false)
 {
 }
 
@@ -93,6 +95,8 @@ void SMTPClientSession::login(const std::string& hostname, std::string& response
 	int status = sendCommand("EHLO", hostname, response);
 	if (isPermanentNegative(status))
 		status = sendCommand("HELO", hostname, response);
+	else
+		_pipelining = response.find("PIPELINING") != std::string::npos;
 	if (!isPositiveCompletion(status)) throw SMTPException("Login failed", response, status);
 }
 
@@ -320,55 +324,36 @@ void SMTPClientSession::close()
 
 void SMTPClientSession::sendCommands(const MailMessage& message, const Recipients* pRecipients)
 {
-	std::string response;
-	int status = 0;
-	const std::string& fromField = message.getSender();
-	std::string::size_type emailPos = fromField.find('<');
-	if (emailPos == std::string::npos)
-	{
-		std::string sender("<");
-		sender.append(fromField);
-		sender.append(">");
-		status = sendCommand("MAIL FROM:", sender, response);
-	}
-	else
-	{
-		status = sendCommand("MAIL FROM:", fromField.substr(emailPos, fromField.size() - emailPos), response);
-	}
-
-	if (!isPositiveCompletion(status)) throw SMTPException("Cannot send message", response, status);
-	
-	std::ostringstream recipient;
+	Recipients recipients;
 	if (pRecipients)
 	{
-		for (Recipients::const_iterator it = pRecipients->begin(); it != pRecipients->end(); ++it)
-		{
-			recipient << '<' << *it << '>';
-			int status = sendCommand("RCPT TO:", recipient.str(), response);
-			if (!isPositiveCompletion(status)) throw SMTPException(std::string("Recipient rejected: ") + recipient.str(), response, status);
-			recipient.str("");
-		}
+		recipients = *pRecipients;
 	}
 	else
 	{
 		for (MailMessage::Recipients::const_iterator it = message.recipients().begin(); it != message.recipients().end(); ++it)
 		{
-			recipient << '<' << it->getAddress() << '>';
-			int status = sendCommand("RCPT TO:", recipient.str(), response);
-			if (!isPositiveCompletion(status)) throw SMTPException(std::string("Recipient rejected: ") + recipient.str(), response, status);
-			recipient.str("");
+			recipients.push_back(it->getAddress());
 		}
 	}
+	sendEnvelope(message.getSender(), recipients);
 
-	status = sendCommand("DATA", response);
+	std::string response;
+	int status = sendCommand("DATA", response);
 	if (!isPositiveIntermediate(status)) throw SMTPException("Cannot send message data", response, status);
 }
 
 
 void SMTPClientSession::sendAddresses(const std::string& from, const Recipients& recipients)
 {
-	std::string response;
-	int status = 0;
+	sendEnvelope(from, recipients);
+}
+
+
+void SMTPClientSession::sendEnvelope(const std::string& from, const Recipients& recipients)
+{
+	std::vector<std::string> commands;
+	commands.reserve(recipients.size() + 1);
 
 	std::string::size_type emailPos = from.find('<');
 	if (emailPos == std::string::npos)
@@ -376,25 +361,56 @@ void SMTPClientSession::sendAddresses(const std::string& from, const Recipients&
 		std::string sender("<");
 		sender.append(from);
 		sender.append(">");
-		status = sendCommand("MAIL FROM:", sender, response);
+		commands.push_back("MAIL FROM: " + sender);
 	}
 	else
 	{
-		status = sendCommand("MAIL FROM:", from.substr(emailPos, from.size() - emailPos), response);
+		commands.push_back("MAIL FROM: " + from.substr(emailPos, from.size() - emailPos));
 	}
 
-	if (!isPositiveCompletion(status)) throw SMTPException("Cannot send message", response, status);
-	
-	std::ostringstream recipient;
-
 	for (Recipients::const_iterator it = recipients.begin(); it != recipients.end(); ++it)
 	{
+		commands.push_back("RCPT TO: <" + *it + ">");
+	}
 
-		recipient << '<' << *it << '>';
-		int status = sendCommand("RCPT TO:", recipient.str(), response);
-		if (!isPositiveCompletion(status)) throw SMTPException(std::string("Recipient rejected: ") + recipient.str(), response, status);
-		recipient.str("");
+	if (_pipelining)
+	{
+		// send the whole envelope in one batch; the responses are
+		// collected afterwards (RFC 2920), saving a round trip per command
+		for (std::vector<std::string>::const_iterator it = commands.begin(); it != commands.end(); ++it)
+		{
+			_socket.sendMessage(*it);
+		}
 	}
+
+	std::string errorText;
+	std::string errorResponse;
+	int errorStatus = 0;
+	for (std::size_t i = 0; i < commands.size(); ++i)
+	{
+		std::string response;
+		int status;
+		if (_pipelining)
+			status = _socket.receiveStatusMessage(response);
+		else
+			status = sendCommand(commands[i], response);
+		if (!isPositiveCompletion(status))
+		{
+			std::string text;
+			if (i == 0)
+				text = "Cannot send message";
+			else
+				text = std::string("Recipient rejected: ") + commands[i].substr(9);
+			if (!_pipelining) throw SMTPException(text, response, status);
+			if (errorStatus == 0)
+			{
+				errorText     = text;
+				errorResponse = response;
+				errorStatus   = status;
+			}
+		}
+	}
+	if (errorStatus != 0) throw SMTPException(errorText, errorResponse, errorStatus);
 }
 
 
@@ -463,4 +479,32 @@ void SMTPClientSession::sendMessage(std::istream& istr)
 }
 
 
+int SMTPClientSession::sendMessages(const std::vector<const MailMessage*>& messages)
+{
+	int sent = 0;
+	for (std::vector<const MailMessage*>::const_iterator it = messages.begin(); it != messages.end(); ++it)
+	{
+		poco_check_ptr (*it);
+		try
+		{
+			sendMessage(**it);
+			++sent;
+		}
+		catch (SMTPException&)
+		{
+			reset();
+		}
+	}
+	return sent;
+}
+
+
+void SMTPClientSession::reset()
+{
+	std::string response;
+	int status = sendCommand("RSET", response);
+	if (!isPositiveCompletion(status)) throw SMTPException("Cannot reset transaction", response, status);
+}
+
+
 } } // namespace Poco::Net
@@ -148,6 +148,12 @@ StreamSocket ServerSocket::acceptConnection(SocketAddress& clientAddr)
 }
 
 
+StreamSocket ServerSocket::acceptConnection(SocketAddress& clientAddr, bool nonBlocking)
+{
+	return StreamSocket(impl()->acceptConnection(clientAddr, nonBlocking));
+}
+
+
 StreamSocket ServerSocket::acceptConnection()
 {
 	SocketAddress clientAddr;
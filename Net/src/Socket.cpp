@@ -389,4 +389,18 @@ int Socket::select(SocketList& readList, SocketList& writeList, SocketList& exce
 }
 
 
+SocketBuf Socket::makeBuffer(void* buffer, std::size_t length)
+{
+	SocketBuf sb;
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	sb.buf = reinterpret_cast<char*>(buffer);
+	sb.len = static_cast<ULONG>(length);
+#else
+	sb.iov_base = buffer;
+	sb.iov_len  = length;
+#endif
+	return sb;
+}
+
+
 } } // namespace Poco::Net
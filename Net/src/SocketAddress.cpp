@@ -16,6 +16,8 @@
 #include "Poco/Net/IPAddress.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/DNS.h"
+#include "Poco/Net/DNSResolver.h"
+#include "Poco/LRUCache.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/NumberParser.h"
 #include "Poco/BinaryReader.h"
@@ -51,6 +53,18 @@ struct AFLT
 };
 
 
+namespace
+{
+	// A small LRU cache of SocketAddress implementations, keyed by the
+	// "host:port" string they were constructed from. Only addresses with
+	// a numeric host part are cached, so DNS-resolved entries can never
+	// become stale. The implementation objects are immutable and
+	// reference-counted, so cached entries are shared, not copied.
+	typedef Poco::LRUCache<std::string, Poco::AutoPtr<SocketAddressImpl> > AddrStringCache;
+	AddrStringCache addrStringCache(256);
+}
+
+
 //
 // SocketAddress
 //
@@ -266,7 +280,7 @@ void SocketAddress::init(const std::string& hostAddress, Poco::UInt16 portNumber
 	}
 	else
 	{
-		HostEntry he = DNS::hostByName(hostAddress);
+		HostEntry he = DNSResolver::defaultResolver().hostByName(hostAddress);
 		HostEntry::AddressList addresses = he.addresses();
 		if (addresses.size() > 0)
 		{
@@ -291,7 +305,7 @@ void SocketAddress::init(Family fam, const std::string& hostAddress, Poco::UInt1
 	}
 	else
 	{
-		HostEntry he = DNS::hostByName(hostAddress);
+		HostEntry he = DNSResolver::defaultResolver().hostByName(hostAddress);
 		HostEntry::AddressList addresses = he.addresses();
 		if (addresses.size() > 0)
 		{
@@ -351,6 +365,13 @@ void SocketAddress::init(const std::string& hostAndPort)
 {
 	poco_assert (!hostAndPort.empty());
 
+	Poco::SharedPtr<Ptr> pCached = addrStringCache.get(hostAndPort);
+	if (pCached)
+	{
+		_pImpl = *pCached;
+		return;
+	}
+
 	std::string host;
 	std::string port;
 	std::string::const_iterator it  = hostAndPort.begin();
@@ -380,7 +401,17 @@ void SocketAddress::init(const std::string& hostAndPort)
 		while (it != end) port += *it++;
 	}
 	else throw InvalidArgumentException("Missing port number");
-	init(host, resolveService(port));
+	Poco::UInt16 portNumber = resolveService(port);
+	IPAddress ip;
+	if (IPAddress::tryParse(host, ip))
+	{
+		init(ip, portNumber);
+		addrStringCache.add(hostAndPort, _pImpl);
+	}
+	else
+	{
+		init(host, portNumber);
+	}
 }
 
 
@@ -15,6 +15,7 @@
 #include "Poco/Net/SocketImpl.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/StreamSocketImpl.h"
+#include "Poco/FileStream.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Timestamp.h"
 #include <string.h> // FD_SET needs memset on some platforms, so we can't use <cstring>
@@ -48,6 +49,14 @@
 
 #ifdef POCO_OS_FAMILY_WINDOWS
 #include <windows.h>
+#include <mswsock.h>
+#elif POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+#include <sys/sendfile.h>
+#endif
+
+
+#if (POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID) && defined(MSG_WAITFORONE)
+#define POCO_HAVE_MMSG 1
 #endif
 
 
@@ -123,6 +132,39 @@ SocketImpl* SocketImpl::acceptConnection(SocketAddress& clientAddr)
 }
 
 
+SocketImpl* SocketImpl::acceptConnection(SocketAddress& clientAddr, bool nonBlocking)
+{
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+	sockaddr_storage buffer;
+	struct sockaddr* pSA = reinterpret_cast<struct sockaddr*>(&buffer);
+	poco_socklen_t saLen = sizeof(buffer);
+	poco_socket_t sd;
+	do
+	{
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+		sd = ::accept4(_sockfd, pSA, &saLen, nonBlocking ? SOCK_NONBLOCK : 0);
+#else
+		sd = ::accept(_sockfd, pSA, &saLen);
+#endif
+	}
+	while (sd == POCO_INVALID_SOCKET && lastError() == POCO_EINTR);
+	if (sd != POCO_INVALID_SOCKET)
+	{
+		clientAddr = SocketAddress(pSA, saLen);
+		StreamSocketImpl* pImpl = new StreamSocketImpl(sd);
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+		pImpl->_blocking = !nonBlocking;
+#else
+		if (nonBlocking) pImpl->setBlocking(false);
+#endif
+		return pImpl;
+	}
+	error(); // will throw
+	return 0;
+}
+
+
 void SocketImpl::connect(const SocketAddress& address)
 {
 	if (_sockfd == POCO_INVALID_SOCKET)
@@ -329,6 +371,41 @@ int SocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int SocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	if (_isBrokenTimeout)
+	{
+		if (_sndTimeout.totalMicroseconds() != 0)
+		{
+			if (!poll(_sndTimeout, SELECT_WRITE))
+				throw TimeoutException();
+		}
+	}
+
+	int rc;
+	do
+	{
+		if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		DWORD sent = 0;
+		rc = WSASend(_sockfd, const_cast<LPWSABUF>(&buffers[0]),
+			static_cast<DWORD>(buffers.size()), &sent,
+			static_cast<DWORD>(flags), 0, 0);
+		rc = (rc == SOCKET_ERROR) ? -1 : static_cast<int>(sent);
+#else
+		struct msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = const_cast<struct iovec*>(&buffers[0]);
+		msg.msg_iovlen = buffers.size();
+		rc = static_cast<int>(::sendmsg(_sockfd, &msg, flags));
+#endif
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0) error();
+	return rc;
+}
+
+
 int SocketImpl::receiveBytes(void* buffer, int length, int flags)
 {
 	if (_isBrokenTimeout)
@@ -361,6 +438,243 @@ int SocketImpl::receiveBytes(void* buffer, int length, int flags)
 }
 
 
+int SocketImpl::receiveBytes(SocketBufVec& buffers, int flags)
+{
+	if (_isBrokenTimeout)
+	{
+		if (_recvTimeout.totalMicroseconds() != 0)
+		{
+			if (!poll(_recvTimeout, SELECT_READ))
+				throw TimeoutException();
+		}
+	}
+
+	int rc;
+	do
+	{
+		if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		DWORD received = 0;
+		DWORD dwFlags = static_cast<DWORD>(flags);
+		rc = WSARecv(_sockfd, &buffers[0],
+			static_cast<DWORD>(buffers.size()), &received, &dwFlags, 0, 0);
+		rc = (rc == SOCKET_ERROR) ? -1 : static_cast<int>(received);
+#else
+		struct msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &buffers[0];
+		msg.msg_iovlen = buffers.size();
+		rc = static_cast<int>(::recvmsg(_sockfd, &msg, flags));
+#endif
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN && !_blocking)
+			;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			throw TimeoutException(err);
+		else
+			error(err);
+	}
+	return rc;
+}
+
+
+SocketImpl::IOStatus SocketImpl::trySendBytes(const void* buffer, int length, int& bytesSent, int flags) noexcept
+{
+	bytesSent = 0;
+	if (_isBrokenTimeout)
+	{
+		if (_sndTimeout.totalMicroseconds() != 0)
+		{
+			try
+			{
+				if (!poll(_sndTimeout, SELECT_WRITE))
+					return IO_TIMEOUT;
+			}
+			catch (...)
+			{
+				return IO_ERROR;
+			}
+		}
+	}
+
+	int rc;
+	do
+	{
+		if (_sockfd == POCO_INVALID_SOCKET) return IO_ERROR;
+		rc = ::send(_sockfd, reinterpret_cast<const char*>(buffer), length, flags);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN && !_blocking)
+			return IO_WOULD_BLOCK;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			return IO_TIMEOUT;
+		else
+			return IO_ERROR;
+	}
+	bytesSent = rc;
+	return IO_OK;
+}
+
+
+SocketImpl::IOStatus SocketImpl::tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags) noexcept
+{
+	bytesReceived = 0;
+	if (_isBrokenTimeout)
+	{
+		if (_recvTimeout.totalMicroseconds() != 0)
+		{
+			try
+			{
+				if (!poll(_recvTimeout, SELECT_READ))
+					return IO_TIMEOUT;
+			}
+			catch (...)
+			{
+				return IO_ERROR;
+			}
+		}
+	}
+
+	int rc;
+	do
+	{
+		if (_sockfd == POCO_INVALID_SOCKET) return IO_ERROR;
+		rc = ::recv(_sockfd, reinterpret_cast<char*>(buffer), length, flags);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN && !_blocking)
+			return IO_WOULD_BLOCK;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			return IO_TIMEOUT;
+		else
+			return IO_ERROR;
+	}
+	bytesReceived = rc;
+	return IO_OK;
+}
+
+
+SocketImpl::IOStatus SocketImpl::tryConnect(const SocketAddress& address) noexcept
+{
+	try
+	{
+		if (_sockfd == POCO_INVALID_SOCKET)
+		{
+			init(address.af());
+		}
+		setBlocking(false);
+	}
+	catch (...)
+	{
+		return IO_ERROR;
+	}
+#if defined(POCO_VXWORKS)
+	int rc = ::connect(_sockfd, (sockaddr*) address.addr(), address.length());
+#else
+	int rc = ::connect(_sockfd, address.addr(), address.length());
+#endif
+	if (rc != 0)
+	{
+		int err = lastError();
+		if (err == POCO_EINPROGRESS || err == POCO_EWOULDBLOCK)
+			return IO_WOULD_BLOCK;
+		return IO_ERROR;
+	}
+	return IO_OK;
+}
+
+
+Poco::Int64 SocketImpl::sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset, Poco::Int64 count)
+{
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+	if (count == 0)
+	{
+		fileInputStream.seekg(0, std::ios_base::end);
+		count = static_cast<Poco::Int64>(fileInputStream.tellg()) - static_cast<Poco::Int64>(offset);
+		if (count < 0) count = 0;
+	}
+
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	HANDLE hFile = fileInputStream.rdbuf()->nativeHandle();
+	LARGE_INTEGER pos;
+	pos.QuadPart = static_cast<LONGLONG>(offset);
+	if (!SetFilePointerEx(hFile, pos, 0, FILE_BEGIN))
+		throw NetException("sendFile() failed to position file");
+	if (!TransmitFile(_sockfd, hFile, static_cast<DWORD>(count), 0, 0, 0, 0))
+		error();
+	return count;
+#elif POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+	int fd = fileInputStream.rdbuf()->nativeHandle();
+	off_t off = static_cast<off_t>(offset);
+	Poco::Int64 sent = 0;
+	while (sent < count)
+	{
+		ssize_t rc;
+		do
+		{
+			rc = ::sendfile(_sockfd, fd, &off, static_cast<size_t>(count - sent));
+		}
+		while (rc < 0 && lastError() == POCO_EINTR);
+		if (rc < 0) error();
+		if (rc == 0) break;
+		sent += rc;
+	}
+	return sent;
+#elif POCO_OS == POCO_OS_MAC_OS_X
+	int fd = fileInputStream.rdbuf()->nativeHandle();
+	off_t off = static_cast<off_t>(offset);
+	Poco::Int64 sent = 0;
+	while (sent < count)
+	{
+		off_t len = static_cast<off_t>(count - sent);
+		int rc;
+		do
+		{
+			rc = ::sendfile(fd, _sockfd, off, &len, 0, 0);
+		}
+		while (rc < 0 && len == 0 && lastError() == POCO_EINTR);
+		if (rc < 0 && len == 0) error();
+		if (len == 0) break;
+		sent += len;
+		off  += len;
+	}
+	return sent;
+#else
+	fileInputStream.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+	Poco::Int64 sent = 0;
+	char buffer[8192];
+	while (sent < count && fileInputStream.good())
+	{
+		Poco::Int64 toRead = count - sent;
+		if (toRead > static_cast<Poco::Int64>(sizeof(buffer))) toRead = sizeof(buffer);
+		fileInputStream.read(buffer, static_cast<std::streamsize>(toRead));
+		std::streamsize n = fileInputStream.gcount();
+		if (n <= 0) break;
+		const char* p = buffer;
+		while (n > 0)
+		{
+			int rc = sendBytes(p, static_cast<int>(n));
+			p    += rc;
+			n    -= rc;
+			sent += rc;
+		}
+	}
+	return sent;
+#endif
+}
+
+
 int SocketImpl::sendTo(const void* buffer, int length, const SocketAddress& address, int flags)
 {
 	int rc;
@@ -418,6 +732,130 @@ int SocketImpl::receiveFrom(void* buffer, int length, SocketAddress& address, in
 }
 
 
+
+int SocketImpl::sendMany(SocketMsgVec& messages, int flags)
+{
+	if (messages.empty()) return 0;
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+#if defined(POCO_HAVE_MMSG)
+	std::vector<struct mmsghdr> hdrs(messages.size());
+	memset(&hdrs[0], 0, hdrs.size()*sizeof(struct mmsghdr));
+	for (std::size_t i = 0; i < messages.size(); ++i)
+	{
+		hdrs[i].msg_hdr.msg_iov    = &messages[i].buf;
+		hdrs[i].msg_hdr.msg_iovlen = 1;
+		const SocketAddress& addr = messages[i].address;
+		if (addr.port() != 0 || !addr.host().isWildcard())
+		{
+			hdrs[i].msg_hdr.msg_name    = const_cast<struct sockaddr*>(addr.addr());
+			hdrs[i].msg_hdr.msg_namelen = addr.length();
+		}
+	}
+	int rc;
+	do
+	{
+		rc = ::sendmmsg(_sockfd, &hdrs[0], static_cast<unsigned int>(hdrs.size()), flags);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0) error();
+	for (int i = 0; i < rc; ++i)
+	{
+		messages[i].size = static_cast<int>(hdrs[i].msg_len);
+	}
+	return rc;
+#else
+	int sent = 0;
+	for (std::size_t i = 0; i < messages.size(); ++i)
+	{
+		SocketMsg& msg = messages[i];
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		int length = static_cast<int>(msg.buf.len);
+#else
+		int length = static_cast<int>(msg.buf.iov_len);
+#endif
+		if (msg.address.port() != 0 || !msg.address.host().isWildcard())
+			msg.size = sendTo(msg.data(), length, msg.address, flags);
+		else
+			msg.size = sendBytes(msg.data(), length, flags);
+		++sent;
+	}
+	return sent;
+#endif
+}
+
+
+int SocketImpl::receiveMany(SocketMsgVec& messages, const Poco::Timespan& timeout, int flags)
+{
+	if (messages.empty()) return 0;
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+#if defined(POCO_HAVE_MMSG)
+	std::vector<struct mmsghdr> hdrs(messages.size());
+	std::vector<struct sockaddr_storage> addrs(messages.size());
+	memset(&hdrs[0], 0, hdrs.size()*sizeof(struct mmsghdr));
+	for (std::size_t i = 0; i < messages.size(); ++i)
+	{
+		hdrs[i].msg_hdr.msg_iov     = &messages[i].buf;
+		hdrs[i].msg_hdr.msg_iovlen  = 1;
+		hdrs[i].msg_hdr.msg_name    = &addrs[i];
+		hdrs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+	}
+	struct timespec ts;
+	struct timespec* pts = 0;
+	if (timeout != 0)
+	{
+		ts.tv_sec  = timeout.totalSeconds();
+		ts.tv_nsec = timeout.useconds()*1000;
+		pts = &ts;
+	}
+	if (_blocking) flags |= MSG_WAITFORONE;
+	int rc;
+	do
+	{
+		rc = ::recvmmsg(_sockfd, &hdrs[0], static_cast<unsigned int>(hdrs.size()), flags, pts);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (err == POCO_EAGAIN && !_blocking)
+			;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			return 0;
+		else
+			error(err);
+		return 0;
+	}
+	for (int i = 0; i < rc; ++i)
+	{
+		messages[i].size    = static_cast<int>(hdrs[i].msg_len);
+		messages[i].address = SocketAddress(reinterpret_cast<struct sockaddr*>(&addrs[i]), hdrs[i].msg_hdr.msg_namelen);
+	}
+	return rc;
+#else
+	int received = 0;
+	for (std::size_t i = 0; i < messages.size(); ++i)
+	{
+		if (received > 0 || timeout != 0)
+		{
+			Poco::Timespan remaining = (received == 0) ? timeout : Poco::Timespan();
+			if (!poll(remaining, SELECT_READ)) break;
+		}
+		SocketMsg& msg = messages[i];
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		int length = static_cast<int>(msg.buf.len);
+#else
+		int length = static_cast<int>(msg.buf.iov_len);
+#endif
+		msg.size = receiveFrom(msg.data(), length, msg.address, flags);
+		++received;
+	}
+	return received;
+#endif
+}
+
+
 void SocketImpl::sendUrgent(unsigned char data)
 {
 	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
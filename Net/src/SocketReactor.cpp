@@ -66,54 +66,30 @@ void SocketReactor::run()
 {
 	_pThread = Thread::current();
 
-	Socket::SocketList readable;
-	Socket::SocketList writable;
-	Socket::SocketList except;
-	
+	PollSet::SocketEventVec events;
+
 	while (!_stop)
 	{
 		try
 		{
-			readable.clear();
-			writable.clear();
-			except.clear();
-			int nSockets = 0;
-			{
-				FastMutex::ScopedLock lock(_mutex);
-				for (EventHandlerMap::iterator it = _handlers.begin(); it != _handlers.end(); ++it)
-				{
-					if (it->second->accepts(_pReadableNotification))
-					{
-						readable.push_back(it->first);
-						nSockets++;
-					}
-					if (it->second->accepts(_pWritableNotification))
-					{
-						writable.push_back(it->first);
-						nSockets++;
-					}
-					if (it->second->accepts(_pErrorNotification))
-					{
-						except.push_back(it->first);
-						nSockets++;
-					}
-				}
-			}
-			if (nSockets == 0)
+			if (!hasSocketHandlers())
 			{
 				onIdle();
 				Thread::trySleep(static_cast<long>(_timeout.totalMilliseconds()));
 			}
-			else if (Socket::select(readable, writable, except, _timeout))
+			else if (_pollSet.poll(_timeout, events) > 0)
 			{
 				onBusy();
 
-				for (Socket::SocketList::iterator it = readable.begin(); it != readable.end(); ++it)
-					dispatch(*it, _pReadableNotification);
-				for (Socket::SocketList::iterator it = writable.begin(); it != writable.end(); ++it)
-					dispatch(*it, _pWritableNotification);
-				for (Socket::SocketList::iterator it = except.begin(); it != except.end(); ++it)
-					dispatch(*it, _pErrorNotification);
+				for (PollSet::SocketEventVec::iterator it = events.begin(); it != events.end(); ++it)
+				{
+					if (it->mode & PollSet::POLL_READ)
+						dispatch(it->socket, _pReadableNotification);
+					if (it->mode & PollSet::POLL_WRITE)
+						dispatch(it->socket, _pWritableNotification);
+					if (it->mode & PollSet::POLL_ERROR)
+						dispatch(it->socket, _pErrorNotification);
+				}
 			}
 			else onTimeout();
 		}
@@ -160,35 +136,66 @@ const Poco::Timespan& SocketReactor::getTimeout() const
 
 void SocketReactor::addEventHandler(const Socket& socket, const Poco::AbstractObserver& observer)
 {
-	NotifierPtr pNotifier;
-	{
-		FastMutex::ScopedLock lock(_mutex);
-		
-		EventHandlerMap::iterator it = _handlers.find(socket);
-		if (it == _handlers.end())
-		{
-			pNotifier = new SocketNotifier(socket);
-			_handlers[socket] = pNotifier;
-		}
-		else pNotifier = it->second;
-	}
+	NotifierPtr pNotifier = getNotifier(socket, true);
+
 	if (!pNotifier->hasObserver(observer))
 		pNotifier->addObserver(this, observer);
+
+	int mode = pollMode(pNotifier);
+	if (mode) _pollSet.add(socket, mode);
+	wakeUp();
+}
+
+
+int SocketReactor::pollMode(NotifierPtr& pNotifier)
+{
+	int mode = 0;
+	if (pNotifier->accepts(_pReadableNotification)) mode |= PollSet::POLL_READ;
+	if (pNotifier->accepts(_pWritableNotification)) mode |= PollSet::POLL_WRITE;
+	if (pNotifier->accepts(_pErrorNotification))    mode |= PollSet::POLL_ERROR;
+	return mode;
 }
 
 
 bool SocketReactor::hasEventHandler(const Socket& socket, const Poco::AbstractObserver& observer)
 {
-	NotifierPtr pNotifier;
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (pNotifier && pNotifier->hasObserver(observer))
+		return true;
+
+	return false;
+}
+
+
+SocketReactor::NotifierPtr SocketReactor::getNotifier(const Socket& socket, bool makeNew)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	EventHandlerMap::iterator it = _handlers.find(socket);
+	if (it != _handlers.end())
 	{
-		FastMutex::ScopedLock lock(_mutex);
-	
-		EventHandlerMap::iterator it = _handlers.find(socket);
-		if (it != _handlers.end())
-		{
-			if (it->second->hasObserver(observer))
-				return true;
-		}
+		return it->second;
+	}
+	else if (makeNew)
+	{
+		NotifierPtr pNotifier = new SocketNotifier(socket);
+		_handlers[socket] = pNotifier;
+		return pNotifier;
+	}
+
+	return 0;
+}
+
+
+bool SocketReactor::hasSocketHandlers()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	for (EventHandlerMap::iterator it = _handlers.begin(); it != _handlers.end(); ++it)
+	{
+		if (it->second->accepts(_pReadableNotification) ||
+			it->second->accepts(_pWritableNotification) ||
+			it->second->accepts(_pErrorNotification)) return true;
 	}
 
 	return false;
@@ -197,25 +204,36 @@ bool SocketReactor::hasEventHandler(const Socket& socket, const Poco::AbstractOb
 
 void SocketReactor::removeEventHandler(const Socket& socket, const Poco::AbstractObserver& observer)
 {
-	NotifierPtr pNotifier;
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (pNotifier && pNotifier->hasObserver(observer))
 	{
-		FastMutex::ScopedLock lock(_mutex);
-	
-		EventHandlerMap::iterator it = _handlers.find(socket);
-		if (it != _handlers.end())
+		int oldMode = pollMode(pNotifier);
+		if (pNotifier->countObservers() == 1)
 		{
-			pNotifier = it->second;
-			if (pNotifier->hasObserver(observer) && pNotifier->countObservers() == 1)
 			{
-				_handlers.erase(it);
+				FastMutex::ScopedLock lock(_mutex);
+				_handlers.erase(socket);
+			}
+			pNotifier->removeObserver(this, observer);
+			if (oldMode) _pollSet.remove(socket);
+		}
+		else
+		{
+			pNotifier->removeObserver(this, observer);
+			// the poll mode must be kept in sync with the
+			// remaining observers, otherwise a no longer
+			// wanted event would be reported over and over
+			// again, preventing the poll from ever timing out
+			int newMode = pollMode(pNotifier);
+			if (newMode != oldMode)
+			{
+				if (newMode)
+					_pollSet.update(socket, newMode);
+				else if (oldMode)
+					_pollSet.remove(socket);
 			}
 		}
 	}
-	if (pNotifier && pNotifier->hasObserver(observer))
-	{
-		pNotifier->removeObserver(this, observer);
-	}
-
 }
 
 
@@ -244,15 +262,8 @@ void SocketReactor::onBusy()
 
 void SocketReactor::dispatch(const Socket& socket, SocketNotification* pNotification)
 {
-	NotifierPtr pNotifier;
-	{
-		FastMutex::ScopedLock lock(_mutex);
-		EventHandlerMap::iterator it = _handlers.find(socket);
-		if (it != _handlers.end())
-			pNotifier = it->second;
-		else
-			return;
-	}
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (!pNotifier) return;
 	dispatch(pNotifier, pNotification);
 }
 
@@ -30,12 +30,17 @@ namespace Net {
 //
 
 
-SocketStreamBuf::SocketStreamBuf(const Socket& socket): 
-	BufferedBidirectionalStreamBuf(STREAM_BUFFER_SIZE, std::ios::in | std::ios::out),
-	_pImpl(dynamic_cast<StreamSocketImpl*>(socket.impl()))
+SocketStreamBuf::SocketStreamBuf(const Socket& socket, std::streamsize bufferSize):
+	BufferedBidirectionalStreamBuf(bufferSize, std::ios::in | std::ios::out),
+	_pImpl(dynamic_cast<StreamSocketImpl*>(socket.impl())),
+	_bufferSize(bufferSize),
+	_corked(false),
+	_noDelay(false)
 {
+	poco_assert (bufferSize > 0);
+
 	if (_pImpl)
-		_pImpl->duplicate(); 
+		_pImpl->duplicate();
 	else
 		throw InvalidArgumentException("Invalid or null SocketImpl passed to SocketStreamBuf");
 }
@@ -59,13 +64,80 @@ int SocketStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
 }
 
 
+std::streamsize SocketStreamBuf::xsputn(const char* s, std::streamsize count)
+{
+	if (count < _bufferSize || _pImpl->secure())
+		return BufferedBidirectionalStreamBuf::xsputn(s, count);
+
+	// Large write: any buffered data and the payload are sent with a
+	// single gather write, instead of copying the payload piecewise
+	// through the internal buffer.
+	std::streamsize pending = static_cast<std::streamsize>(pptr() - pbase());
+	SocketBufVec sv;
+	if (pending > 0) sv.push_back(Socket::makeBuffer(pbase(), static_cast<std::size_t>(pending)));
+	sv.push_back(Socket::makeBuffer(const_cast<char*>(s), static_cast<std::size_t>(count)));
+	std::streamsize total = pending + count;
+	// SocketImpl's scatter/gather overload is hidden by the
+	// pointer/length overload in StreamSocketImpl
+	std::streamsize sent;
+	try
+	{
+		sent = static_cast<SocketImpl*>(_pImpl)->sendBytes(sv);
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+		// the implementation transforms the byte stream and does not
+		// support scatter/gather I/O (e.g. a WebSocket); write through
+		// the buffer so the payload is properly framed
+		return BufferedBidirectionalStreamBuf::xsputn(s, count);
+	}
+	while (sent >= 0 && sent < total)
+	{
+		if (sent < pending)
+			sent += _pImpl->sendBytes(pbase() + sent, static_cast<int>(pending - sent));
+		else
+			sent += _pImpl->sendBytes(s + (sent - pending), static_cast<int>(total - sent));
+	}
+	if (sent < total) return 0;
+	if (pending > 0) pbump(static_cast<int>(-pending));
+	return count;
+}
+
+
+void SocketStreamBuf::cork()
+{
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+	_pImpl->setOption(IPPROTO_TCP, TCP_CORK, 1);
+#else
+	_noDelay = _pImpl->getNoDelay();
+	if (_noDelay) _pImpl->setNoDelay(false);
+#endif
+	_corked = true;
+}
+
+
+void SocketStreamBuf::uncork()
+{
+	sync();
+#if POCO_OS == POCO_OS_LINUX || POCO_OS == POCO_OS_ANDROID
+	_pImpl->setOption(IPPROTO_TCP, TCP_CORK, 0);
+#else
+	// toggling TCP_NODELAY pushes out any partial frames
+	// held back by the Nagle algorithm
+	_pImpl->setNoDelay(true);
+	if (!_noDelay) _pImpl->setNoDelay(false);
+#endif
+	_corked = false;
+}
+
+
 //
 // SocketIOS
 //
 
 
-SocketIOS::SocketIOS(const Socket& socket):
-	_buf(socket)
+SocketIOS::SocketIOS(const Socket& socket, std::streamsize bufferSize):
+	_buf(socket, bufferSize)
 {
 	poco_ios_init(&_buf);
 }
@@ -102,13 +174,25 @@ StreamSocket SocketIOS::socket() const
 }
 
 
+void SocketIOS::cork()
+{
+	_buf.cork();
+}
+
+
+void SocketIOS::uncork()
+{
+	_buf.uncork();
+}
+
+
 //
 // SocketOutputStream
 //
 
 
-SocketOutputStream::SocketOutputStream(const Socket& socket):
-	SocketIOS(socket),
+SocketOutputStream::SocketOutputStream(const Socket& socket, std::streamsize bufferSize):
+	SocketIOS(socket, bufferSize),
 	std::ostream(&_buf)
 {
 }
@@ -124,8 +208,8 @@ SocketOutputStream::~SocketOutputStream()
 //
 
 
-SocketInputStream::SocketInputStream(const Socket& socket):
-	SocketIOS(socket),
+SocketInputStream::SocketInputStream(const Socket& socket, std::streamsize bufferSize):
+	SocketIOS(socket, bufferSize),
 	std::istream(&_buf)
 {
 }
@@ -141,8 +225,8 @@ SocketInputStream::~SocketInputStream()
 //
 
 
-SocketStream::SocketStream(const Socket& socket):
-	SocketIOS(socket),
+SocketStream::SocketStream(const Socket& socket, std::streamsize bufferSize):
+	SocketIOS(socket, bufferSize),
 	std::iostream(&_buf)
 {
 }
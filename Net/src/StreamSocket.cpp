@@ -115,6 +115,12 @@ int StreamSocket::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int StreamSocket::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	return impl()->sendBytes(buffers, flags);
+}
+
+
 int StreamSocket::sendBytes(FIFOBuffer& fifoBuf)
 {
 	ScopedLock<Mutex> l(fifoBuf.mutex());
@@ -131,6 +137,36 @@ int StreamSocket::receiveBytes(void* buffer, int length, int flags)
 }
 
 
+int StreamSocket::receiveBytes(SocketBufVec& buffers, int flags)
+{
+	return impl()->receiveBytes(buffers, flags);
+}
+
+
+SocketImpl::IOStatus StreamSocket::trySendBytes(const void* buffer, int length, int& bytesSent, int flags) noexcept
+{
+	return impl()->trySendBytes(buffer, length, bytesSent, flags);
+}
+
+
+SocketImpl::IOStatus StreamSocket::tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags) noexcept
+{
+	return impl()->tryReceiveBytes(buffer, length, bytesReceived, flags);
+}
+
+
+SocketImpl::IOStatus StreamSocket::tryConnect(const SocketAddress& address) noexcept
+{
+	return impl()->tryConnect(address);
+}
+
+
+Poco::Int64 StreamSocket::sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset, Poco::Int64 count)
+{
+	return impl()->sendFile(fileInputStream, offset, count);
+}
+
+
 int StreamSocket::receiveBytes(FIFOBuffer& fifoBuf)
 {
 	ScopedLock<Mutex> l(fifoBuf.mutex());
@@ -0,0 +1,101 @@
+//
+// TCPReactorConnection.cpp
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorConnection
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/TCPReactorConnection.h"
+#include "Poco/NObserver.h"
+
+
+using Poco::NObserver;
+using Poco::AutoPtr;
+
+
+namespace Poco {
+namespace Net {
+
+
+TCPReactorConnection::TCPReactorConnection(const StreamSocket& socket, SocketReactor& reactor):
+	_socket(socket),
+	_reactor(reactor),
+	_wantWrite(false)
+{
+	_socket.setBlocking(false);
+	_reactor.addEventHandler(_socket, NObserver<TCPReactorConnection, ReadableNotification>(*this, &TCPReactorConnection::onReadableNf));
+	_reactor.addEventHandler(_socket, NObserver<TCPReactorConnection, ErrorNotification>(*this, &TCPReactorConnection::onErrorNf));
+}
+
+
+TCPReactorConnection::~TCPReactorConnection()
+{
+	try
+	{
+		if (_wantWrite)
+			_reactor.removeEventHandler(_socket, NObserver<TCPReactorConnection, WritableNotification>(*this, &TCPReactorConnection::onWritableNf));
+		_reactor.removeEventHandler(_socket, NObserver<TCPReactorConnection, ErrorNotification>(*this, &TCPReactorConnection::onErrorNf));
+		_reactor.removeEventHandler(_socket, NObserver<TCPReactorConnection, ReadableNotification>(*this, &TCPReactorConnection::onReadableNf));
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void TCPReactorConnection::onWritable()
+{
+}
+
+
+void TCPReactorConnection::onError()
+{
+	close();
+}
+
+
+void TCPReactorConnection::setWantWrite(bool flag)
+{
+	if (flag == _wantWrite) return;
+
+	if (flag)
+		_reactor.addEventHandler(_socket, NObserver<TCPReactorConnection, WritableNotification>(*this, &TCPReactorConnection::onWritableNf));
+	else
+		_reactor.removeEventHandler(_socket, NObserver<TCPReactorConnection, WritableNotification>(*this, &TCPReactorConnection::onWritableNf));
+	_wantWrite = flag;
+}
+
+
+void TCPReactorConnection::close()
+{
+	delete this;
+}
+
+
+void TCPReactorConnection::onReadableNf(const AutoPtr<ReadableNotification>& pNf)
+{
+	onReadable();
+}
+
+
+void TCPReactorConnection::onWritableNf(const AutoPtr<WritableNotification>& pNf)
+{
+	onWritable();
+}
+
+
+void TCPReactorConnection::onErrorNf(const AutoPtr<ErrorNotification>& pNf)
+{
+	onError();
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,32 @@
+//
+// TCPReactorConnectionFactory.cpp
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorConnectionFactory
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/TCPReactorConnectionFactory.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+TCPReactorConnectionFactory::TCPReactorConnectionFactory()
+{
+}
+
+
+TCPReactorConnectionFactory::~TCPReactorConnectionFactory()
+{
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,125 @@
+//
+// TCPReactorServer.cpp
+//
+// Library: Net
+// Package: Reactor
+// Module:  TCPReactorServer
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/TCPReactorServer.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/NObserver.h"
+#include "Poco/ErrorHandler.h"
+
+
+using Poco::NObserver;
+using Poco::AutoPtr;
+using Poco::ErrorHandler;
+
+
+namespace Poco {
+namespace Net {
+
+
+TCPReactorServer::TCPReactorServer(TCPReactorConnectionFactory::Ptr pFactory, const ServerSocket& socket, unsigned eventThreads):
+	_pFactory(pFactory),
+	_socket(socket),
+	_next(0),
+	_running(false)
+{
+	poco_assert (eventThreads > 0);
+
+	for (unsigned i = 0; i < eventThreads; ++i)
+	{
+		_reactors.push_back(new SocketReactor);
+		_threads.push_back(new Poco::Thread);
+	}
+}
+
+
+TCPReactorServer::~TCPReactorServer()
+{
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void TCPReactorServer::start()
+{
+	poco_assert (!_running);
+
+	for (std::size_t i = 0; i < _reactors.size(); ++i)
+	{
+		_threads[i]->start(*_reactors[i]);
+	}
+	_reactors[0]->addEventHandler(_socket, NObserver<TCPReactorServer, ReadableNotification>(*this, &TCPReactorServer::onAccept));
+	_running = true;
+}
+
+
+void TCPReactorServer::stop()
+{
+	if (_running)
+	{
+		_reactors[0]->removeEventHandler(_socket, NObserver<TCPReactorServer, ReadableNotification>(*this, &TCPReactorServer::onAccept));
+		for (std::size_t i = 0; i < _reactors.size(); ++i)
+		{
+			_reactors[i]->stop();
+			_threads[i]->join();
+		}
+		_running = false;
+	}
+}
+
+
+Poco::UInt16 TCPReactorServer::port() const
+{
+	return _socket.address().port();
+}
+
+
+void TCPReactorServer::onAccept(const AutoPtr<ReadableNotification>& pNf)
+{
+	StreamSocket ss = _socket.acceptConnection();
+	try
+	{
+		// the connection registers itself with the reactor
+		// and deletes itself when the connection is closed
+		_pFactory->createConnection(ss, nextReactor());
+	}
+	catch (Poco::Exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		ErrorHandler::handle();
+	}
+}
+
+
+SocketReactor& TCPReactorServer::nextReactor()
+{
+	std::size_t next = _next++;
+	if (_next == _reactors.size()) _next = 0;
+	return *_reactors[next];
+}
+
+
+} } // namespace Poco::Net
@@ -29,4 +29,18 @@ TCPServerConnectionFactory::~TCPServerConnectionFactory()
 }
 
 
+bool TCPServerConnectionFactory::supportsReset() const
+{
+	return false;
+}
+
+
+void TCPServerConnectionFactory::resetConnection(TCPServerConnection* pConnection, const StreamSocket& socket)
+{
+	poco_check_ptr (pConnection);
+
+	pConnection->reset(socket);
+}
+
+
 } } // namespace Poco::Net
@@ -16,6 +16,8 @@
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Notification.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/Clock.h"
+#include "Poco/Metrics.h"
 #include <memory>
 
 
@@ -28,6 +30,16 @@ namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	Poco::Metrics::Histogram& connectionTimeHistogram()
+	{
+		static Poco::Metrics::Histogram& histogram(Poco::Metrics::MetricsRegistry::defaultRegistry().histogram("poco.tcpServer.connectionTime"));
+		return histogram;
+	}
+}
+
+
 class TCPConnectionNotification: public Notification
 {
 public:
@@ -60,10 +72,13 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 	_refusedConnections(0),
 	_stopped(false),
 	_pConnectionFactory(pFactory),
+	_reuseConnections(false),
 	_threadPool(threadPool)
 {
 	poco_check_ptr (pFactory);
 
+	_reuseConnections = pFactory->supportsReset();
+
 	if (!_pParams)
 		_pParams = new TCPServerParams;
 	
@@ -74,6 +89,7 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 
 TCPServerDispatcher::~TCPServerDispatcher()
 {
+	clearIdleConnections();
 }
 
 
@@ -109,14 +125,45 @@ void TCPServerDispatcher::run()
 			if (pCNf)
 			{
 #ifndef POCO_ENABLE_CPP11
-				std::auto_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(pCNf->socket()));
+				std::auto_ptr<TCPServerConnection> pConnection;
 #else
-				std::unique_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(pCNf->socket()));
+				std::unique_ptr<TCPServerConnection> pConnection;
 #endif // POCO_ENABLE_CPP11
+				if (_reuseConnections)
+				{
+					FastMutex::ScopedLock lock(_mutex);
+					if (!_idleConnections.empty())
+					{
+						pConnection.reset(_idleConnections.back());
+						_idleConnections.pop_back();
+					}
+				}
+				if (pConnection.get())
+					_pConnectionFactory->resetConnection(pConnection.get(), pCNf->socket());
+				else
+					pConnection.reset(_pConnectionFactory->createConnection(pCNf->socket()));
 				poco_check_ptr(pConnection.get());
 				beginConnection();
-				pConnection->start();
+				if (Poco::Metrics::MetricsRegistry::enabled())
+				{
+					Poco::Clock start;
+					pConnection->start();
+					connectionTimeHistogram().update(start.elapsed());
+				}
+				else
+				{
+					pConnection->start();
+				}
 				endConnection();
+				if (_reuseConnections)
+				{
+					pConnection->reset(StreamSocket()); // drop the socket reference while idle
+					FastMutex::ScopedLock lock(_mutex);
+					if (!_stopped && static_cast<int>(_idleConnections.size()) < _pParams->getMaxThreads())
+					{
+						_idleConnections.push_back(pConnection.release());
+					}
+				}
 			}
 		}
 	
@@ -159,7 +206,7 @@ void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 	}
 	else
 	{
-		++_refusedConnections;
+		_refusedConnections.increment();
 	}
 }
 
@@ -169,6 +216,7 @@ void TCPServerDispatcher::stop()
 	_stopped = true;
 	_queue.clear();
 	_queue.wakeUpAll();
+	clearIdleConnections();
 }
 
 
@@ -189,25 +237,19 @@ int TCPServerDispatcher::maxThreads() const
 
 int TCPServerDispatcher::totalConnections() const
 {
-	FastMutex::ScopedLock lock(_mutex);
-	
-	return _totalConnections;
+	return static_cast<int>(_totalConnections.value());
 }
 
 
 int TCPServerDispatcher::currentConnections() const
 {
-	FastMutex::ScopedLock lock(_mutex);
-	
-	return _currentConnections;
+	return static_cast<int>(_currentConnections.value());
 }
 
 
 int TCPServerDispatcher::maxConcurrentConnections() const
 {
-	FastMutex::ScopedLock lock(_mutex);
-	
-	return _maxConcurrentConnections;
+	return _maxConcurrentConnections.load();
 }
 
 
@@ -219,28 +261,37 @@ int TCPServerDispatcher::queuedConnections() const
 
 int TCPServerDispatcher::refusedConnections() const
 {
-	FastMutex::ScopedLock lock(_mutex);
-	
-	return _refusedConnections;
+	return static_cast<int>(_refusedConnections.value());
 }
 
 
 void TCPServerDispatcher::beginConnection()
 {
-	FastMutex::ScopedLock lock(_mutex);
-	
-	++_totalConnections;
-	++_currentConnections;
-	if (_currentConnections > _maxConcurrentConnections)
-		_maxConcurrentConnections = _currentConnections;
+	_totalConnections.increment();
+	_currentConnections.increment();
+	int current = static_cast<int>(_currentConnections.value());
+	int max = _maxConcurrentConnections.load();
+	while (current > max && !_maxConcurrentConnections.compare_exchange_weak(max, current));
 }
 
 
 void TCPServerDispatcher::endConnection()
 {
-	FastMutex::ScopedLock lock(_mutex);
+	_currentConnections.decrement();
+}
+
 
-	--_currentConnections;
+void TCPServerDispatcher::clearIdleConnections()
+{
+	std::vector<TCPServerConnection*> idleConnections;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		idleConnections.swap(_idleConnections);
+	}
+	for (std::vector<TCPServerConnection*>::iterator it = idleConnections.begin(); it != idleConnections.end(); ++it)
+	{
+		delete *it;
+	}
 }
 
 
@@ -0,0 +1,188 @@
+//
+// WebSocketBroadcaster.cpp
+//
+// Library: Net
+// Package: WebSocket
+// Module:  WebSocketBroadcaster
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/WebSocketBroadcaster.h"
+#include "Poco/Net/WebSocketImpl.h"
+#include "Poco/Observer.h"
+#include <vector>
+
+
+using Poco::FastMutex;
+using Poco::Observer;
+
+
+namespace Poco {
+namespace Net {
+
+
+WebSocketBroadcaster::WebSocketBroadcaster(SocketReactor& reactor, std::size_t maxQueuedFrames):
+	_reactor(reactor),
+	_maxQueuedFrames(maxQueuedFrames)
+{
+	poco_assert (maxQueuedFrames > 0);
+}
+
+
+WebSocketBroadcaster::~WebSocketBroadcaster()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	for (ClientMap::iterator it = _clients.begin(); it != _clients.end(); ++it)
+	{
+		if (it->second.registered)
+			_reactor.removeEventHandler(it->second.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+	}
+}
+
+
+void WebSocketBroadcaster::addClient(const WebSocket& webSocket)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_clients.insert(ClientMap::value_type(webSocket.impl()->sockfd(), Client(webSocket)));
+}
+
+
+void WebSocketBroadcaster::removeClient(const WebSocket& webSocket)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	ClientMap::iterator it = _clients.find(webSocket.impl()->sockfd());
+	if (it != _clients.end())
+	{
+		if (it->second.registered)
+			_reactor.removeEventHandler(it->second.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+		_clients.erase(it);
+	}
+}
+
+
+std::size_t WebSocketBroadcaster::clients() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _clients.size();
+}
+
+
+void WebSocketBroadcaster::broadcast(const void* buffer, int length, int flags)
+{
+	char header[WebSocketImpl::MAX_HEADER_LENGTH];
+	int headerLength = WebSocketImpl::writeFrameHeader(header, length, flags, false, 0);
+	FramePtr pFrame = new std::string;
+	pFrame->reserve(headerLength + length);
+	pFrame->append(header, headerLength);
+	pFrame->append(static_cast<const char*>(buffer), length);
+
+	std::vector<WebSocket> evicted;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		ClientMap::iterator it = _clients.begin();
+		while (it != _clients.end())
+		{
+			Client& client = it->second;
+			client.queue.push_back(pFrame);
+			bool drop = false;
+			if (client.queue.size() > _maxQueuedFrames)
+			{
+				drop = true;
+			}
+			else if (!client.registered)
+			{
+				try
+				{
+					if (!flushClient(client))
+					{
+						_reactor.addEventHandler(client.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+						client.registered = true;
+					}
+				}
+				catch (...)
+				{
+					drop = true;
+				}
+			}
+			if (drop)
+			{
+				if (client.registered)
+					_reactor.removeEventHandler(client.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+				evicted.push_back(client.ws);
+				_clients.erase(it++);
+			}
+			else ++it;
+		}
+	}
+	for (std::vector<WebSocket>::iterator it = evicted.begin(); it != evicted.end(); ++it)
+	{
+		clientEvicted.notify(this, *it);
+	}
+}
+
+
+void WebSocketBroadcaster::onWritable(WritableNotification* pNf)
+{
+	poco_socket_t sockfd = pNf->socket().impl()->sockfd();
+	pNf->release();
+
+	std::vector<WebSocket> evicted;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		ClientMap::iterator it = _clients.find(sockfd);
+		if (it == _clients.end()) return;
+		Client& client = it->second;
+		try
+		{
+			if (flushClient(client))
+			{
+				_reactor.removeEventHandler(client.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+				client.registered = false;
+			}
+		}
+		catch (...)
+		{
+			_reactor.removeEventHandler(client.ws, Observer<WebSocketBroadcaster, WritableNotification>(*this, &WebSocketBroadcaster::onWritable));
+			evicted.push_back(client.ws);
+			_clients.erase(it);
+		}
+	}
+	for (std::vector<WebSocket>::iterator it = evicted.begin(); it != evicted.end(); ++it)
+	{
+		clientEvicted.notify(this, *it);
+	}
+}
+
+
+bool WebSocketBroadcaster::flushClient(Client& client)
+{
+	while (!client.queue.empty())
+	{
+		if (!client.ws.poll(Poco::Timespan(0), Socket::SELECT_WRITE))
+			return false;
+		const std::string& frame = *client.queue.front();
+		int n = static_cast<WebSocketImpl*>(client.ws.impl())->sendRawBytes(frame.data() + client.offset, static_cast<int>(frame.size() - client.offset));
+		if (n <= 0) return false;
+		client.offset += static_cast<std::size_t>(n);
+		if (client.offset == frame.size())
+		{
+			client.queue.pop_front();
+			client.offset = 0;
+		}
+	}
+	return true;
+}
+
+
+} } // namespace Poco::Net
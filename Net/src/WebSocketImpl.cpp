@@ -16,6 +16,7 @@
 #include "Poco/Net/WebSocketImpl.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/WebSocket.h"
+#include "Poco/Net/Socket.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Buffer.h"
 #include "Poco/BinaryWriter.h"
@@ -30,6 +31,41 @@ namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	void maskPayload(char* dest, const char* src, int length, const char* mask)
+		/// Applies the 4-octet frame mask a machine word at a time
+		/// instead of per byte. The mask pattern has a period of
+		/// four, so replicating it across a word and XOR-ing whole
+		/// words yields the same result as the scalar loop for all
+		/// offsets that are multiples of four; the tail is handled
+		/// per byte. Also works in place (dest == src).
+	{
+		typedef Poco::UIntPtr Word;
+		Poco::UInt32 mask32;
+		std::memcpy(&mask32, mask, 4);
+		Word maskWord = 0;
+		for (unsigned shift = 0; shift < sizeof(Word); shift += 4)
+		{
+			maskWord |= static_cast<Word>(mask32) << shift*8;
+		}
+		int i = 0;
+		while (i + static_cast<int>(sizeof(Word)) <= length)
+		{
+			Word w;
+			std::memcpy(&w, src + i, sizeof(Word));
+			w ^= maskWord;
+			std::memcpy(dest + i, &w, sizeof(Word));
+			i += static_cast<int>(sizeof(Word));
+		}
+		for (; i < length; i++)
+		{
+			dest[i] = src[i] ^ mask[i & 3];
+		}
+	}
+}
+
+
 WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, HTTPSession& session, bool mustMaskPayload):
 	StreamSocketImpl(pStreamSocketImpl->sockfd()),
 	_pStreamSocketImpl(pStreamSocketImpl),
@@ -59,56 +95,100 @@ WebSocketImpl::~WebSocketImpl()
 }
 
 
-int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
+int WebSocketImpl::writeFrameHeader(char* header, int payloadLength, int flags, bool useMask, Poco::UInt32 mask)
 {
-	Poco::Buffer<char> frame(length + MAX_HEADER_LENGTH);
-	Poco::MemoryOutputStream ostr(frame.begin(), frame.size());
+	Poco::MemoryOutputStream ostr(header, MAX_HEADER_LENGTH);
 	Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::NETWORK_BYTE_ORDER);
 
 	if (flags == 0) flags = WebSocket::FRAME_BINARY;
 	flags &= 0xff;
 	writer << static_cast<Poco::UInt8>(flags);
 	Poco::UInt8 lengthByte(0);
-	if (_mustMaskPayload)
+	if (useMask)
 	{
 		lengthByte |= FRAME_FLAG_MASK;
 	}
-	if (length < 126)
+	if (payloadLength < 126)
 	{
-		lengthByte |= static_cast<Poco::UInt8>(length);
+		lengthByte |= static_cast<Poco::UInt8>(payloadLength);
 		writer << lengthByte;
 	}
-	else if (length < 65536)
+	else if (payloadLength < 65536)
 	{
 		lengthByte |= 126;
-		writer << lengthByte << static_cast<Poco::UInt16>(length);
+		writer << lengthByte << static_cast<Poco::UInt16>(payloadLength);
 	}
 	else
 	{
 		lengthByte |= 127;
-		writer << lengthByte << static_cast<Poco::UInt64>(length);
+		writer << lengthByte << static_cast<Poco::UInt64>(payloadLength);
 	}
+	if (useMask)
+	{
+		writer.writeRaw(reinterpret_cast<const char*>(&mask), 4);
+	}
+	return static_cast<int>(ostr.charsWritten());
+}
+
+
+int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
+{
+	char header[MAX_HEADER_LENGTH];
 	if (_mustMaskPayload)
 	{
 		const Poco::UInt32 mask = _rnd.next();
-		const char* m = reinterpret_cast<const char*>(&mask);
-		const char* b = reinterpret_cast<const char*>(buffer);
-		writer.writeRaw(m, 4);
-		char* p = frame.begin() + ostr.charsWritten();
-		for (int i = 0; i < length; i++)
-		{
-			p[i] = b[i] ^ m[i % 4];
-		}
+		int headerLength = writeFrameHeader(header, length, flags, true, mask);
+		Poco::Buffer<char> maskedPayload(length);
+		maskPayload(maskedPayload.begin(), reinterpret_cast<const char*>(buffer), length, reinterpret_cast<const char*>(&mask));
+		sendFrame(header, headerLength, maskedPayload.begin(), length);
 	}
 	else
 	{
-		std::memcpy(frame.begin() + ostr.charsWritten(), buffer, length);
+		int headerLength = writeFrameHeader(header, length, flags, false, 0);
+		sendFrame(header, headerLength, reinterpret_cast<const char*>(buffer), length);
 	}
-	_pStreamSocketImpl->sendBytes(frame.begin(), length + static_cast<int>(ostr.charsWritten()));
 	return length;
 }
 
 
+int WebSocketImpl::sendRawBytes(const void* buffer, int length)
+{
+	return _pStreamSocketImpl->sendBytes(buffer, length);
+}
+
+
+void WebSocketImpl::sendFrame(const char* header, int headerLength, const char* payload, int payloadLength)
+{
+	if (_pStreamSocketImpl->secure())
+	{
+		// a TLS implementation must see the frame through its
+		// own sendBytes(), so it has to be contiguous
+		Poco::Buffer<char> frame(headerLength + payloadLength);
+		std::memcpy(frame.begin(), header, headerLength);
+		std::memcpy(frame.begin() + headerLength, payload, payloadLength);
+		_pStreamSocketImpl->sendBytes(frame.begin(), headerLength + payloadLength);
+		return;
+	}
+	// gather write: the payload is sent from where it is,
+	// without copying it into a frame buffer
+	SocketBufVec sv;
+	sv.push_back(Socket::makeBuffer(const_cast<char*>(header), headerLength));
+	if (payloadLength > 0)
+		sv.push_back(Socket::makeBuffer(const_cast<char*>(payload), payloadLength));
+	int total = headerLength + payloadLength;
+	// the (const void*, int, int) overload in StreamSocketImpl hides
+	// the vectored one inherited from SocketImpl
+	int sent = static_cast<SocketImpl*>(_pStreamSocketImpl)->sendBytes(sv);
+	while (sent >= 0 && sent < total)
+	{
+		if (sent < headerLength)
+			sent += _pStreamSocketImpl->sendBytes(header + sent, headerLength - sent);
+		else
+			sent += _pStreamSocketImpl->sendBytes(payload + (sent - headerLength), total - sent);
+	}
+}
+
+
 int WebSocketImpl::receiveHeader(char mask[4], bool& useMask)
 {
 	char header[MAX_HEADER_LENGTH];
@@ -190,10 +270,7 @@ int WebSocketImpl::receivePayload(char *buffer, int payloadLength, char mask[4],
 
 	if (useMask)
 	{
-		for (int i = 0; i < received; i++)
-		{
-			buffer[i] ^= mask[i % 4];
-		}
+		maskPayload(buffer, buffer, received, mask);
 	}
 	return received;
 }
@@ -225,6 +302,24 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int)
 }
 
 
+int WebSocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	throw Poco::InvalidAccessException("Cannot sendBytes() a SocketBufVec over a WebSocket");
+}
+
+
+int WebSocketImpl::receiveBytes(SocketBufVec& buffers, int flags)
+{
+	throw Poco::InvalidAccessException("Cannot receiveBytes() a SocketBufVec over a WebSocket");
+}
+
+
+Poco::Int64 WebSocketImpl::sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset, Poco::Int64 count)
+{
+	throw Poco::InvalidAccessException("Cannot sendFile() over a WebSocket");
+}
+
+
 int WebSocketImpl::receiveNBytes(void* buffer, int bytes)
 {
 	int received = receiveSomeBytes(reinterpret_cast<char*>(buffer), bytes);
@@ -243,6 +338,27 @@ int WebSocketImpl::receiveNBytes(void* buffer, int bytes)
 }
 
 
+SocketImpl::IOStatus WebSocketImpl::trySendBytes(const void* buffer, int length, int& bytesSent, int flags) noexcept
+{
+	return _pStreamSocketImpl->trySendBytes(buffer, length, bytesSent, flags);
+}
+
+
+SocketImpl::IOStatus WebSocketImpl::tryReceiveBytes(void* buffer, int length, int& bytesReceived, int flags) noexcept
+{
+	int n = static_cast<int>(_buffer.size()) - _bufferOffset;
+	if (n > 0)
+	{
+		if (length < n) n = length;
+		std::memcpy(buffer, _buffer.begin() + _bufferOffset, n);
+		_bufferOffset += n;
+		bytesReceived = n;
+		return IO_OK;
+	}
+	return _pStreamSocketImpl->tryReceiveBytes(buffer, length, bytesReceived, flags);
+}
+
+
 int WebSocketImpl::receiveSomeBytes(char* buffer, int bytes)
 {
 	int n = static_cast<int>(_buffer.size()) - _bufferOffset;
@@ -0,0 +1,105 @@
+//
+// DNSResolverTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "DNSResolverTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/DNSResolver.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Stopwatch.h"
+
+
+using Poco::Net::DNSResolver;
+using Poco::Net::HostEntry;
+using Poco::Net::HostNotFoundException;
+using Poco::Stopwatch;
+
+
+DNSResolverTest::DNSResolverTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+DNSResolverTest::~DNSResolverTest()
+{
+}
+
+
+void DNSResolverTest::testHostByName()
+{
+	DNSResolver resolver;
+	HostEntry he1 = resolver.hostByName("localhost");
+	assert (!he1.addresses().empty());
+	// the second lookup must be served from the cache
+	HostEntry he2 = resolver.hostByName("localhost");
+	assert (he2.addresses() == he1.addresses());
+}
+
+
+void DNSResolverTest::testHostByNameAsync()
+{
+	DNSResolver resolver;
+	DNSResolver::HostEntryResult result = resolver.hostByNameAsync("localhost");
+	result.wait();
+	assert (!result.failed());
+	assert (!result.data().addresses().empty());
+	// the asynchronous lookup must have populated the cache
+	HostEntry he = resolver.hostByName("localhost");
+	assert (he.addresses() == result.data().addresses());
+}
+
+
+void DNSResolverTest::testNegativeCache()
+{
+	DNSResolver resolver;
+	try
+	{
+		resolver.hostByName("nonexistent.invalid");
+		fail("host not found - must throw");
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	// the second lookup must fail from the cache, without
+	// hitting the resolver again
+	Stopwatch sw;
+	sw.start();
+	try
+	{
+		resolver.hostByName("nonexistent.invalid");
+		fail("host not found - must throw");
+	}
+	catch (HostNotFoundException&)
+	{
+	}
+	assert (sw.elapsed() < 100000);
+}
+
+
+void DNSResolverTest::setUp()
+{
+}
+
+
+void DNSResolverTest::tearDown()
+{
+}
+
+
+CppUnit::Test* DNSResolverTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("DNSResolverTest");
+
+	CppUnit_addTest(pSuite, DNSResolverTest, testHostByName);
+	CppUnit_addTest(pSuite, DNSResolverTest, testHostByNameAsync);
+	CppUnit_addTest(pSuite, DNSResolverTest, testNegativeCache);
+
+	return pSuite;
+}
@@ -18,6 +18,7 @@
 #include "Poco/Net/NetException.h"
 #include "Poco/Timespan.h"
 #include "Poco/Stopwatch.h"
+#include <cstring>
 
 
 using Poco::Net::Socket;
@@ -76,6 +77,48 @@ void DatagramSocketTest::testSendToReceiveFrom()
 }
 
 
+void DatagramSocketTest::testSendManyReceiveMany()
+{
+	UDPEchoServer echoServer(SocketAddress("127.0.0.1", 0));
+	DatagramSocket ss(SocketAddress::IPv4);
+	SocketAddress serverAddr("127.0.0.1", echoServer.port());
+	char snd[4][8] = { "one", "two", "three", "four" };
+	Poco::Net::SocketMsgVec sndVec;
+	for (int i = 0; i < 4; ++i)
+	{
+		sndVec.push_back(Poco::Net::SocketMsg(snd[i], std::strlen(snd[i]), serverAddr));
+	}
+	int n = ss.sendMany(sndVec);
+	assert (n == 4);
+	assert (sndVec[2].size == 5);
+	char rcv[4][16];
+	Poco::Net::SocketMsgVec rcvVec;
+	for (int i = 0; i < 4; ++i)
+	{
+		rcvVec.push_back(Poco::Net::SocketMsg(rcv[i], sizeof(rcv[i])));
+	}
+	int received = 0;
+	while (received < 4)
+	{
+		Poco::Net::SocketMsgVec partVec(rcvVec.begin() + received, rcvVec.end());
+		int rc = ss.receiveMany(partVec, Timespan(5, 0));
+		assert (rc > 0);
+		for (int i = 0; i < rc; ++i)
+		{
+			rcvVec[received + i] = partVec[i];
+		}
+		received += rc;
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		assert (rcvVec[i].size == static_cast<int>(std::strlen(snd[i])));
+		assert (std::string(reinterpret_cast<char*>(rcvVec[i].data()), rcvVec[i].size) == snd[i]);
+		assert (rcvVec[i].address.port() == echoServer.port());
+	}
+	ss.close();
+}
+
+
 void DatagramSocketTest::testUnbound()
 {
 	UDPEchoServer echoServer;
@@ -149,6 +192,7 @@ CppUnit::Test* DatagramSocketTest::suite()
 
 	CppUnit_addTest(pSuite, DatagramSocketTest, testEcho);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testSendToReceiveFrom);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSendManyReceiveMany);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testUnbound);
 #if (POCO_OS != POCO_OS_FREE_BSD) // works only with local net bcast and very randomly
 	CppUnit_addTest(pSuite, DatagramSocketTest, testBroadcast);
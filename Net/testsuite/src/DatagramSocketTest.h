@@ -26,6 +26,7 @@ public:
 
 	void testEcho();
 	void testSendToReceiveFrom();
+	void testSendManyReceiveMany();
 	void testUnbound();
 	void testBroadcast();
 
@@ -14,6 +14,7 @@
 #include "EchoServer.h"
 #include "Poco/Net/DialogSocket.h"
 #include "Poco/Net/SocketAddress.h"
+#include "Poco/NumberFormatter.h"
 #include <cstring>
 
 
@@ -90,6 +91,36 @@ void DialogSocketTest::testDialogSocket()
 }
 
 
+void DialogSocketTest::testReceiveMessages()
+{
+	EchoServer echoServer;
+	DialogSocket ds(65536);
+	assert (ds.bufferSize() == 65536);
+	ds.connect(SocketAddress("127.0.0.1", echoServer.port()));
+
+	std::string data;
+	for (int i = 0; i < 1000; ++i)
+	{
+		data += "line ";
+		data += Poco::NumberFormatter::format(i);
+		data += "\r\n";
+	}
+	ds.sendString(data);
+
+	std::vector<std::string> lines;
+	std::vector<std::string> batch;
+	while (lines.size() < 1000 && ds.receiveMessages(batch))
+	{
+		lines.insert(lines.end(), batch.begin(), batch.end());
+	}
+	assert (lines.size() == 1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		assert (lines[i] == "line " + Poco::NumberFormatter::format(i));
+	}
+}
+
+
 void DialogSocketTest::setUp()
 {
 }
@@ -105,6 +136,7 @@ CppUnit::Test* DialogSocketTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("DialogSocketTest");
 
 	CppUnit_addTest(pSuite, DialogSocketTest, testDialogSocket);
+	CppUnit_addTest(pSuite, DialogSocketTest, testReceiveMessages);
 
 	return pSuite;
 }
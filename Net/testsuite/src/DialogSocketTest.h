@@ -25,6 +25,7 @@ public:
 	~DialogSocketTest();
 
 	void testDialogSocket();
+	void testReceiveMessages();
 
 	void setUp();
 	void tearDown();
@@ -13,6 +13,9 @@
 #include "CppUnit/TestSuite.h"
 #include "DialogServer.h"
 #include "Poco/Net/FTPClientSession.h"
+#include "Poco/Net/FTPSegmentedTransfer.h"
+#include "Poco/FileStream.h"
+#include "Poco/TemporaryFile.h"
 #include "Poco/Net/DialogSocket.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Net/NetException.h"
@@ -537,6 +540,151 @@ void FTPClientSessionTest::testUpload()
 }
 
 
+void FTPClientSessionTest::testFileSize()
+{
+	DialogServer server;
+	server.addResponse("220 localhost FTP ready");
+	server.addResponse("331 Password required");
+	server.addResponse("230 Welcome");
+	server.addResponse("200 Type set to I");
+	FTPClientSession session("127.0.0.1", server.port());
+	session.login("user", "password");
+	server.clearCommands();
+
+	server.addResponse("213 12345");
+	assert (session.fileSize("test.txt") == 12345);
+	std::string cmd = server.popCommand();
+	assert (cmd == "SIZE test.txt");
+
+	server.addResponse("550 Could not get file size");
+	try
+	{
+		session.fileSize("test.txt");
+		fail("SIZE rejected - must throw");
+	}
+	catch (FTPException&)
+	{
+	}
+
+	server.addResponse("221 Good Bye");
+	session.close();
+}
+
+
+void FTPClientSessionTest::testDownloadRestart()
+{
+	DialogServer server;
+	server.addResponse("220 localhost FTP ready");
+	server.addResponse("331 Password required");
+	server.addResponse("230 Welcome");
+	server.addResponse("200 Type set to I");
+	FTPClientSession session("127.0.0.1", server.port());
+	session.login("user", "password");
+	server.clearCommands();
+
+	DialogServer dataServer(false);
+	dataServer.addResponse("is some data");
+	std::ostringstream epsv;
+	epsv << "229 Entering Extended Passive Mode (|||" << dataServer.port() << "|)";
+	server.addResponse(epsv.str());
+	server.addResponse("350 Restarting at 5");
+	server.addResponse("150 sending data\r\n226 Transfer complete");
+
+	std::istream& istr = session.beginDownload("test.txt", 5);
+	std::ostringstream dataStr;
+	StreamCopier::copyStream(istr, dataStr);
+	session.endDownload();
+	std::string s(dataStr.str());
+	assert (s == "is some data\r\n");
+
+	std::string cmd = server.popCommand();
+	assert (cmd.substr(0, 4) == "EPSV");
+	cmd = server.popCommand();
+	assert (cmd == "REST 5");
+	cmd = server.popCommand();
+	assert (cmd == "RETR test.txt");
+
+	server.addResponse("221 Good Bye");
+	session.close();
+}
+
+
+void FTPClientSessionTest::testUploadFile()
+{
+	DialogServer server;
+	server.addResponse("220 localhost FTP ready");
+	server.addResponse("331 Password required");
+	server.addResponse("230 Welcome");
+	server.addResponse("200 Type set to I");
+	FTPClientSession session("127.0.0.1", server.port());
+	session.login("user", "password");
+	server.clearCommands();
+
+	Poco::TemporaryFile localFile;
+	Poco::FileOutputStream fos(localFile.path());
+	fos << "This is some data\r\n";
+	fos.close();
+
+	DialogServer dataServer;
+	std::ostringstream epsv;
+	epsv << "229 Entering Extended Passive Mode (|||" << dataServer.port() << "|)";
+	server.addResponse(epsv.str());
+	server.addResponse("350 Restarting at 0");
+	server.addResponse("150 send data\r\n226 Transfer complete");
+
+	session.uploadFile(localFile.path(), "test.txt");
+	std::string s(dataServer.popCommandWait());
+	assert (s == "This is some data");
+
+	std::string cmd = server.popCommand();
+	assert (cmd.substr(0, 4) == "EPSV");
+	cmd = server.popCommand();
+	assert (cmd == "REST 0");
+	cmd = server.popCommand();
+	assert (cmd == "STOR test.txt");
+
+	server.addResponse("221 Good Bye");
+	session.close();
+}
+
+
+void FTPClientSessionTest::testSegmentedDownload()
+{
+	DialogServer server;
+	// probe session (SIZE)
+	server.addResponse("220 localhost FTP ready");
+	server.addResponse("331 Password required");
+	server.addResponse("230 Welcome");
+	server.addResponse("200 Type set to I");
+	server.addResponse("213 19");
+	server.addResponse("221 Good Bye");
+	// segment session (RETR)
+	server.addResponse("220 localhost FTP ready");
+	server.addResponse("331 Password required");
+	server.addResponse("230 Welcome");
+	server.addResponse("200 Type set to I");
+
+	DialogServer dataServer(false);
+	dataServer.addResponse("This is some data");
+	std::ostringstream epsv;
+	epsv << "229 Entering Extended Passive Mode (|||" << dataServer.port() << "|)";
+	server.addResponse(epsv.str());
+	server.addResponse("150 sending data\r\n226 Transfer complete");
+	server.addResponse("221 Good Bye");
+
+	Poco::TemporaryFile localFile;
+	Poco::Net::FTPSegmentedTransfer transfer("127.0.0.1", server.port(), "user", "password");
+	transfer.setSegments(1);
+	assert (transfer.getSegments() == 1);
+	assert (transfer.download("test.txt", localFile.path()) == 19);
+
+	Poco::FileInputStream fis(localFile.path());
+	std::ostringstream dataStr;
+	StreamCopier::copyStream(fis, dataStr);
+	assert (dataStr.str() == "This is some data\r\n");
+}
+
+
 void FTPClientSessionTest::testList()
 {
 	DialogServer server;
@@ -597,6 +745,10 @@ CppUnit::Test* FTPClientSessionTest::suite()
 	CppUnit_addTest(pSuite, FTPClientSessionTest, testDownloadPASV);
 	CppUnit_addTest(pSuite, FTPClientSessionTest, testDownloadEPSV);
 	CppUnit_addTest(pSuite, FTPClientSessionTest, testUpload);
+	CppUnit_addTest(pSuite, FTPClientSessionTest, testFileSize);
+	CppUnit_addTest(pSuite, FTPClientSessionTest, testDownloadRestart);
+	CppUnit_addTest(pSuite, FTPClientSessionTest, testUploadFile);
+	CppUnit_addTest(pSuite, FTPClientSessionTest, testSegmentedDownload);
 	CppUnit_addTest(pSuite, FTPClientSessionTest, testList);
 
 	return pSuite;
@@ -44,6 +44,10 @@ public:
 	void testDownloadPASV();
 	void testDownloadEPSV();
 	void testUpload();
+	void testFileSize();
+	void testDownloadRestart();
+	void testUploadFile();
+	void testSegmentedDownload();
 	void testList();
 	
 	void setUp();
@@ -0,0 +1,292 @@
+//
+// HPACKTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HPACKTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/NameValueCollection.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+
+
+using Poco::Net::HPACKTable;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::NameValueCollection;
+using Poco::Net::HTTPException;
+
+
+namespace
+{
+	std::string hex(const std::string& str)
+	{
+		std::string result;
+		for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+		{
+			Poco::NumberFormatter::appendHex(result, static_cast<unsigned char>(*it), 2);
+		}
+		return result;
+	}
+}
+
+
+HPACKTest::HPACKTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HPACKTest::~HPACKTest()
+{
+}
+
+
+void HPACKTest::testInteger()
+{
+	// a value literal longer than 127 octets requires the
+	// multi-octet integer representation (RFC 7541, section 5.1)
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+	std::string value(300, 'x');
+	std::string block;
+	encoder.encode("X-Long", value, block);
+	// 300 = 127 + 173: length encoded as 7F AD 01
+	assert (block.find("\x7f\xad\x01") != std::string::npos);
+	NameValueCollection fields;
+	decoder.decode(block, fields);
+	assert (fields.get("X-Long") == value);
+}
+
+
+void HPACKTest::testStaticTable()
+{
+	HPACKTable table;
+	assert (table.entry(2).name == ":method");
+	assert (table.entry(2).value == "GET");
+	assert (table.entry(38).name == "host");
+	assert (table.entry(61).name == "www-authenticate");
+
+	bool valueMatch;
+	assert (table.find(":method", "GET", valueMatch) == 2);
+	assert (valueMatch);
+	assert (table.find(":method", "PUT", valueMatch) == 2);
+	assert (!valueMatch);
+	assert (table.find("x-unknown", "", valueMatch) == 0);
+
+	try
+	{
+		table.entry(62);
+		fail("invalid index - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+}
+
+
+void HPACKTest::testRequestExamples()
+{
+	// RFC 7541, Appendix C.3: three requests on one connection,
+	// without Huffman coding
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	NameValueCollection request1;
+	request1.add(":method", "GET");
+	request1.add(":scheme", "http");
+	request1.add(":path", "/");
+	request1.add(":authority", "www.example.com");
+	std::string block;
+	encoder.encode(request1, block);
+	assert (hex(block) == "828684410F7777772E6578616D706C652E636F6D");
+	NameValueCollection decoded1;
+	decoder.decode(block, decoded1);
+	assert (decoded1.size() == 4);
+	assert (decoded1.get(":authority") == "www.example.com");
+	assert (decoder.table().dynamicEntries() == 1);
+	assert (decoder.table().dynamicSize() == 57);
+
+	NameValueCollection request2;
+	request2.add(":method", "GET");
+	request2.add(":scheme", "http");
+	request2.add(":path", "/");
+	request2.add(":authority", "www.example.com");
+	request2.add("cache-control", "no-cache");
+	block.clear();
+	encoder.encode(request2, block);
+	assert (hex(block) == "828684BE58086E6F2D6361636865");
+	NameValueCollection decoded2;
+	decoder.decode(block, decoded2);
+	assert (decoded2.size() == 5);
+	assert (decoded2.get("cache-control") == "no-cache");
+
+	NameValueCollection request3;
+	request3.add(":method", "GET");
+	request3.add(":scheme", "https");
+	request3.add(":path", "/index.html");
+	request3.add(":authority", "www.example.com");
+	request3.add("custom-key", "custom-value");
+	block.clear();
+	encoder.encode(request3, block);
+	assert (hex(block) == "828785BF400A637573746F6D2D6B65790C637573746F6D2D76616C7565");
+	NameValueCollection decoded3;
+	decoder.decode(block, decoded3);
+	assert (decoded3.size() == 5);
+	assert (decoded3.get("custom-key") == "custom-value");
+	assert (decoder.table().dynamicEntries() == 3);
+}
+
+
+void HPACKTest::testRoundTrip()
+{
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	NameValueCollection fields;
+	fields.add(":method", "POST");
+	fields.add(":path", "/submit?q=poco");
+	fields.add("Content-Type", "application/json");
+	fields.add("Content-Length", "1234");
+	fields.add("User-Agent", "poco/1.9.4");
+	fields.add("X-Custom", "some value");
+
+	std::string block1;
+	encoder.encode(fields, block1);
+	NameValueCollection decoded1;
+	decoder.decode(block1, decoded1);
+	assert (decoded1.size() == fields.size());
+	assert (decoded1.get("content-type") == "application/json");
+	assert (decoded1.get("x-custom") == "some value");
+
+	// repeated fields compress to one octet each
+	std::string block2;
+	encoder.encode(fields, block2);
+	assert (block2.size() == fields.size());
+	NameValueCollection decoded2;
+	decoder.decode(block2, decoded2);
+	assert (decoded2.size() == fields.size());
+	assert (decoded2.get("user-agent") == "poco/1.9.4");
+}
+
+
+void HPACKTest::testSensitive()
+{
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	std::string block;
+	encoder.encode("Authorization", "Basic dGVzdDpwd2Q=", block, true);
+	// never-indexed literal with name index 23 (authorization)
+	assert (static_cast<unsigned char>(block[0]) == 0x1F);
+	assert (static_cast<unsigned char>(block[1]) == 0x08);
+	NameValueCollection fields;
+	decoder.decode(block, fields);
+	assert (fields.get("authorization") == "Basic dGVzdDpwd2Q=");
+	// sensitive fields must not enter the dynamic table
+	assert (encoder.table().dynamicEntries() == 0);
+	assert (decoder.table().dynamicEntries() == 0);
+}
+
+
+void HPACKTest::testTableSizeUpdate()
+{
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	encoder.setMaxTableSize(0);
+	std::string block;
+	encoder.encode("X-Custom", "value", block);
+	// the size update is signalled at the start of the block
+	assert (static_cast<unsigned char>(block[0]) == 0x20);
+	NameValueCollection fields;
+	decoder.decode(block, fields);
+	assert (fields.get("x-custom") == "value");
+	assert (encoder.table().dynamicEntries() == 0);
+	assert (decoder.table().dynamicEntries() == 0);
+
+	// an update beyond the decoder's limit must be rejected
+	std::string bad("\x3F\xA1\x3E", 3); // update to 8000 octets
+	try
+	{
+		NameValueCollection dummy;
+		decoder.decode(bad, dummy);
+		fail("table size update beyond limit - must throw");
+	}
+	catch (HTTPException&)
+	{
+	}
+}
+
+
+void HPACKTest::testMalformed()
+{
+	HPACKDecoder decoder;
+	NameValueCollection fields;
+
+	// truncated string literal
+	std::string truncated("\x41\x0F\x77\x77\x77", 5);
+	try
+	{
+		decoder.decode(truncated, fields);
+		fail("truncated block - must throw");
+	}
+	catch (HTTPException&)
+	{
+	}
+
+	// index zero is not a valid indexed field
+	std::string zeroIndex("\x80", 1);
+	try
+	{
+		decoder.decode(zeroIndex, fields);
+		fail("zero index - must throw");
+	}
+	catch (Poco::Exception&)
+	{
+	}
+
+	// Huffman-coded literals are not supported
+	std::string huffman("\x40\x82\xF1\xE3\x01\x61", 6);
+	try
+	{
+		decoder.decode(huffman, fields);
+		fail("Huffman-coded string - must throw");
+	}
+	catch (HTTPException&)
+	{
+	}
+}
+
+
+void HPACKTest::setUp()
+{
+}
+
+
+void HPACKTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HPACKTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HPACKTest");
+
+	CppUnit_addTest(pSuite, HPACKTest, testInteger);
+	CppUnit_addTest(pSuite, HPACKTest, testStaticTable);
+	CppUnit_addTest(pSuite, HPACKTest, testRequestExamples);
+	CppUnit_addTest(pSuite, HPACKTest, testRoundTrip);
+	CppUnit_addTest(pSuite, HPACKTest, testSensitive);
+	CppUnit_addTest(pSuite, HPACKTest, testTableSizeUpdate);
+	CppUnit_addTest(pSuite, HPACKTest, testMalformed);
+
+	return pSuite;
+}
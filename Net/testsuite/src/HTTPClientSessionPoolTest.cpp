@@ -0,0 +1,196 @@
+//
+// HTTPClientSessionPoolTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPClientSessionPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPClientSessionPool.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Thread.h"
+#include "Poco/URI.h"
+#include <istream>
+#include <ostream>
+#include <vector>
+
+
+using Poco::Net::HTTPClientSessionPool;
+using Poco::Net::HTTPExchange;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::ServerSocket;
+using Poco::URI;
+
+
+namespace
+{
+	class EchoBodyRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.setChunkedTransferEncoding(request.getChunkedTransferEncoding());
+			if (request.hasContentLength())
+				response.setContentLength(request.getContentLength());
+			response.setContentType(request.getContentType());
+			std::istream& istr = request.stream();
+			std::ostream& ostr = response.send();
+			Poco::StreamCopier::copyStream(istr, ostr);
+		}
+	};
+
+	class RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new EchoBodyRequestHandler;
+		}
+	};
+}
+
+
+HTTPClientSessionPoolTest::HTTPClientSessionPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPClientSessionPoolTest::~HTTPClientSessionPoolTest()
+{
+}
+
+
+void HTTPClientSessionPoolTest::testAcquireRelease()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1:" + Poco::NumberFormatter::format(svs.address().port()) + "/echoBody");
+	HTTPClientSessionPool pool;
+
+	HTTPClientSessionPool::SessionPtr pSession = pool.acquire(uri);
+	std::string body("pooled session test");
+	HTTPRequest request(HTTPRequest::HTTP_POST, uri.getPathAndQuery());
+	request.setContentLength((int) body.length());
+	pSession->sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	Poco::StreamCopier::copyToString(pSession->receiveResponse(response), rbody);
+	assert (rbody == body);
+	pool.release(pSession);
+
+	// the keep-alive session must be reused for the same target
+	HTTPClientSessionPool::SessionPtr pSession2 = pool.acquire(uri);
+	assert (pSession2.get() == pSession.get());
+	HTTPRequest request2(HTTPRequest::HTTP_POST, uri.getPathAndQuery());
+	request2.setContentLength((int) body.length());
+	pSession2->sendRequest(request2) << body;
+	HTTPResponse response2;
+	std::string rbody2;
+	Poco::StreamCopier::copyToString(pSession2->receiveResponse(response2), rbody2);
+	assert (rbody2 == body);
+	pool.release(pSession2);
+
+	// a different target gets a different session
+	URI uri2("http://localhost:" + Poco::NumberFormatter::format(svs.address().port()) + "/echoBody");
+	HTTPClientSessionPool::SessionPtr pSession3 = pool.acquire(uri2);
+	assert (pSession3.get() != pSession2.get());
+}
+
+
+void HTTPClientSessionPoolTest::testIdleEviction()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1:" + Poco::NumberFormatter::format(svs.address().port()) + "/echoBody");
+	HTTPClientSessionPool pool(4, 1);
+
+	HTTPClientSessionPool::SessionPtr pSession = pool.acquire(uri);
+	std::string body("x");
+	HTTPRequest request(HTTPRequest::HTTP_POST, uri.getPathAndQuery());
+	request.setContentLength((int) body.length());
+	pSession->sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	Poco::StreamCopier::copyToString(pSession->receiveResponse(response), rbody);
+	pool.release(pSession);
+
+	Poco::Thread::sleep(1500);
+	HTTPClientSessionPool::SessionPtr pSession2 = pool.acquire(uri);
+	assert (pSession2.get() != pSession.get());
+}
+
+
+void HTTPClientSessionPoolTest::testSendRequestAsync()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1:" + Poco::NumberFormatter::format(svs.address().port()) + "/echoBody");
+	HTTPClientSessionPool pool;
+
+	std::vector<HTTPExchange::Ptr> exchanges;
+	std::vector<Poco::ActiveResult<HTTPExchange::Ptr> > results;
+	for (int i = 0; i < 4; ++i)
+	{
+		HTTPExchange::Ptr pExchange = new HTTPExchange(uri, HTTPRequest::HTTP_POST);
+		pExchange->requestBody() = "async request " + Poco::NumberFormatter::format(i);
+		exchanges.push_back(pExchange);
+		results.push_back(pool.sendRequestAsync(pExchange));
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		results[i].wait();
+		assert (!results[i].failed());
+		assert (exchanges[i]->response().getStatus() == HTTPResponse::HTTP_OK);
+		assert (exchanges[i]->responseBody() == "async request " + Poco::NumberFormatter::format(i));
+	}
+}
+
+
+void HTTPClientSessionPoolTest::setUp()
+{
+}
+
+
+void HTTPClientSessionPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPClientSessionPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPClientSessionPoolTest");
+
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testAcquireRelease);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testIdleEviction);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testSendRequestAsync);
+
+	return pSuite;
+}
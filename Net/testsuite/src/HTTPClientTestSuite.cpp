@@ -10,6 +10,7 @@
 
 #include "HTTPClientTestSuite.h"
 #include "HTTPClientSessionTest.h"
+#include "HTTPClientSessionPoolTest.h"
 #include "HTTPStreamFactoryTest.h"
 
 
@@ -18,6 +19,7 @@ CppUnit::Test* HTTPClientTestSuite::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPClientTestSuite");
 
 	pSuite->addTest(HTTPClientSessionTest::suite());
+	pSuite->addTest(HTTPClientSessionPoolTest::suite());
 	pSuite->addTest(HTTPStreamFactoryTest::suite());
 
 	return pSuite;
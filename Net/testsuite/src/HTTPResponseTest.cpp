@@ -55,6 +55,22 @@ void HTTPResponseTest::testWrite2()
 }
 
 
+
+void HTTPResponseTest::testWriteToString()
+{
+	HTTPResponse response(HTTPMessage::HTTP_1_1, HTTPResponse::HTTP_MOVED_PERMANENTLY);
+	response.set("Location", "http://www.appinf.com/index.html");
+	response.set("Server", "Poco/1.0");
+	std::string s;
+	response.write(s);
+	assert (s == "HTTP/1.1 301 Moved Permanently\r\nLocation: http://www.appinf.com/index.html\r\nServer: Poco/1.0\r\n\r\n");
+
+	std::ostringstream ostr;
+	response.write(ostr);
+	assert (s == ostr.str());
+}
+
+
 void HTTPResponseTest::testRead1()
 {
 	std::string s("HTTP/1.1 500 Internal Server Error\r\n\r\n");
@@ -217,6 +233,7 @@ CppUnit::Test* HTTPResponseTest::suite()
 
 	CppUnit_addTest(pSuite, HTTPResponseTest, testWrite1);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testWrite2);
+	CppUnit_addTest(pSuite, HTTPResponseTest, testWriteToString);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testRead1);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testRead2);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testRead3);
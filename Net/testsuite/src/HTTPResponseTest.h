@@ -26,6 +26,7 @@ public:
 
 	void testWrite1();
 	void testWrite2();
+	void testWriteToString();
 	void testRead1();
 	void testRead2();
 	void testRead3();
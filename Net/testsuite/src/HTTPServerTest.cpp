@@ -21,7 +21,12 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/HTTPFileCache.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/TemporaryFile.h"
+#include "Poco/FileStream.h"
 #include <sstream>
 
 
@@ -37,6 +42,8 @@ using Poco::Net::HTTPResponse;
 using Poco::Net::HTTPServerResponse;
 using Poco::Net::HTTPMessage;
 using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
 using Poco::StreamCopier;
 
 
@@ -104,6 +111,41 @@ namespace
 		}
 	};
 	
+	class FileCacheRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		FileCacheRequestHandler(Poco::Net::HTTPFileCache& cache, const std::string& path):
+			_cache(cache),
+			_path(path)
+		{
+		}
+
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			_cache.send(request, response, _path, "text/plain");
+		}
+
+	private:
+		Poco::Net::HTTPFileCache& _cache;
+		const std::string& _path;
+	};
+
+	class SendFileRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		SendFileRequestHandler(const std::string& path): _path(path)
+		{
+		}
+
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.sendFile(_path, "text/plain");
+		}
+
+	private:
+		const std::string& _path;
+	};
+
 	class RequestHandlerFactory: public HTTPRequestHandlerFactory
 	{
 	public:
@@ -119,9 +161,27 @@ namespace
 				return new AuthRequestHandler();
 			else if (request.getURI() == "/buffer")
 				return new BufferRequestHandler();
+			else if (request.getURI() == "/file")
+				return new FileCacheRequestHandler(_cache, _filePath);
+			else if (request.getURI() == "/sendfile")
+				return new SendFileRequestHandler(_filePath);
 			else
 				return 0;
 		}
+
+		void setFilePath(const std::string& path)
+		{
+			_filePath = path;
+		}
+
+		Poco::Net::HTTPFileCache& fileCache()
+		{
+			return _cache;
+		}
+
+	private:
+		Poco::Net::HTTPFileCache _cache;
+		std::string _filePath;
 	};
 }
 
@@ -516,6 +576,119 @@ void HTTPServerTest::testBuffer()
 }
 
 
+void HTTPServerTest::testSendFile()
+{
+	Poco::TemporaryFile file;
+	std::string content(100000, 'f');
+	{
+		Poco::FileOutputStream fstr(file.path());
+		fstr << content;
+	}
+	ServerSocket svs(0);
+	RequestHandlerFactory* pFactory = new RequestHandlerFactory;
+	pFactory->setFilePath(file.path());
+	HTTPServer srv(pFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	HTTPRequest request("GET", "/sendfile");
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string rbody;
+	StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+	assert (response.getStatus() == HTTPResponse::HTTP_OK);
+	assert (response.getContentLength() == content.size());
+	assert (response.getContentType() == "text/plain");
+	assert (rbody == content);
+}
+
+
+void HTTPServerTest::testFileCache()
+{
+	Poco::TemporaryFile file;
+	std::string content("cached file content\n");
+	{
+		Poco::FileOutputStream fstr(file.path());
+		fstr << content;
+	}
+	ServerSocket svs(0);
+	RequestHandlerFactory* pFactory = new RequestHandlerFactory;
+	pFactory->setFilePath(file.path());
+	Poco::Net::HTTPFileCache& cache = pFactory->fileCache();
+	HTTPServer srv(pFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	HTTPRequest request("GET", "/file");
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string rbody;
+	StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+	assert (response.getStatus() == HTTPResponse::HTTP_OK);
+	assert (rbody == content);
+	assert (response.has("ETag"));
+	assert (response.has("Last-Modified"));
+	assert (cache.cachedFiles() == 1);
+	assert (cache.size() == content.size());
+	std::string etag = response.get("ETag");
+
+	// second request is served from the mapping
+	HTTPRequest request2("GET", "/file");
+	cs.sendRequest(request2);
+	HTTPResponse response2;
+	rbody.clear();
+	StreamCopier::copyToString(cs.receiveResponse(response2), rbody);
+	assert (rbody == content);
+	assert (cache.cachedFiles() == 1);
+
+	// conditional request with matching ETag
+	HTTPRequest request3("GET", "/file");
+	request3.set("If-None-Match", etag);
+	cs.sendRequest(request3);
+	HTTPResponse response3;
+	rbody.clear();
+	StreamCopier::copyToString(cs.receiveResponse(response3), rbody);
+	assert (response3.getStatus() == HTTPResponse::HTTP_NOT_MODIFIED);
+	assert (rbody.empty());
+}
+
+
+void HTTPServerTest::testHeaderParsing()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string request(
+		"GET /echoHeader HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"X-Folded: part1\r\n"
+		"   part2\r\n"
+		"ignored line without colon\r\n"
+		"X-Trimmed: value   \r\n"
+		"\r\n");
+	ss.sendBytes(request.data(), (int) request.length());
+	std::string response;
+	char buffer[1024];
+	int n = ss.receiveBytes(buffer, sizeof(buffer));
+	while (n > 0)
+	{
+		response.append(buffer, n);
+		n = ss.receiveBytes(buffer, sizeof(buffer));
+	}
+	assert (response.compare(0, 15, "HTTP/1.1 200 OK") == 0);
+	assert (response.find("GET /echoHeader HTTP/1.1") != std::string::npos);
+	assert (response.find("Host: localhost\r\n") != std::string::npos);
+	assert (response.find("X-Folded: part1   part2\r\n") != std::string::npos);
+	assert (response.find("X-Trimmed: value\r\n") != std::string::npos);
+	assert (response.find("ignored") == std::string::npos);
+}
+
+
 void HTTPServerTest::setUp()
 {
 }
@@ -544,6 +717,9 @@ CppUnit::Test* HTTPServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPServerTest, testAuth);
 	CppUnit_addTest(pSuite, HTTPServerTest, testNotImpl);
 	CppUnit_addTest(pSuite, HTTPServerTest, testBuffer);
+	CppUnit_addTest(pSuite, HTTPServerTest, testSendFile);
+	CppUnit_addTest(pSuite, HTTPServerTest, testFileCache);
+	CppUnit_addTest(pSuite, HTTPServerTest, testHeaderParsing);
 
 	return pSuite;
 }
@@ -38,6 +38,9 @@ public:
 	void testAuth();
 	void testNotImpl();
 	void testBuffer();
+	void testSendFile();
+	void testFileCache();
+	void testHeaderParsing();
 
 	void setUp();
 	void tearDown();
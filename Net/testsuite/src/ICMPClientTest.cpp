@@ -93,6 +93,23 @@ void ICMPClientTest::testBigPing()
 }
 
 
+void ICMPClientTest::testSweep()
+{
+	Poco::Net::ICMPClient icmpClient(IPAddress::IPv4);
+
+	registerDelegates(icmpClient);
+
+	std::vector<SocketAddress> targets;
+	targets.push_back(SocketAddress("127.0.0.1", 0));
+	targets.push_back(SocketAddress("127.0.0.2", 0));
+	targets.push_back(SocketAddress("127.0.0.3", 0));
+
+	assert (icmpClient.sweep(targets) == 3);
+
+	unregisterDelegates(icmpClient);
+}
+
+
 void ICMPClientTest::registerDelegates(const ICMPClient& icmpClient)
 {
 	icmpClient.pingBegin += Delegate<ICMPClientTest, ICMPEventArgs>(this, &ICMPClientTest::onBegin);
@@ -171,6 +188,7 @@ CppUnit::Test* ICMPClientTest::suite()
 
 	CppUnit_addTest(pSuite, ICMPClientTest, testPing);
 	CppUnit_addTest(pSuite, ICMPClientTest, testBigPing);
+	CppUnit_addTest(pSuite, ICMPClientTest, testSweep);
 
 	return pSuite;
 }
@@ -28,6 +28,7 @@ public:
 
 	void testPing();
 	void testBigPing();
+	void testSweep();
 
 	void setUp();
 	void tearDown();
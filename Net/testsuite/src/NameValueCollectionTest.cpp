@@ -13,6 +13,8 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Net/NameValueCollection.h"
 #include "Poco/Exception.h"
+#include "Poco/NumberFormatter.h"
+#include <utility>
 
 
 using Poco::Net::NameValueCollection;
@@ -29,6 +31,31 @@ NameValueCollectionTest::~NameValueCollectionTest()
 }
 
 
+void NameValueCollectionTest::testMove()
+{
+#ifdef POCO_NVC_HAVE_RVALUE_REFS
+	NameValueCollection nvc;
+	nvc.add("name1", "value1");
+	nvc.add("name2", "value2");
+
+	NameValueCollection nvc2(std::move(nvc));
+	assert (nvc2.size() == 2);
+	assert (nvc2["name1"] == "value1");
+	assert (nvc2["name2"] == "value2");
+	assert (nvc.empty());
+
+	nvc = std::move(nvc2);
+	assert (nvc.size() == 2);
+	assert (nvc["name1"] == "value1");
+	assert (nvc2.empty());
+
+	std::string value("value3");
+	nvc.set("name3", std::move(value));
+	assert (nvc["name3"] == "value3");
+#endif
+}
+
+
 void NameValueCollectionTest::testNameValueCollection()
 {
 	NameValueCollection nvc;
@@ -106,6 +133,97 @@ void NameValueCollectionTest::testNameValueCollection()
 }
 
 
+void NameValueCollectionTest::testPtrLenOverloads()
+{
+	NameValueCollection nvc;
+
+	nvc.add("content-length", 14, "1234");
+	assert (nvc.size() == 1);
+	assert (nvc.begin()->first == "Content-Length"); // interned canonical name
+	assert (nvc.get("content-length", 14) == "1234");
+	assert (nvc.get("Content-Length") == "1234");
+
+	nvc.add("X-Custom-Header", 15, "custom");
+	assert (nvc.get("x-custom-header", 15) == "custom");
+	assert (nvc.has("X-CUSTOM-HEADER", 15));
+	assert (!nvc.has("X-Custom", 8));
+	assert (nvc.get("X-Custom", 8, "default") == "default");
+
+	nvc.set("Host", 4, "localhost");
+	assert (nvc.get("Host") == "localhost");
+	nvc.set("Host", 4, "127.0.0.1");
+	assert (nvc.get("Host") == "127.0.0.1");
+	assert (nvc.size() == 3);
+
+	try
+	{
+		std::string value = nvc.get("name", 4);
+		fail("not found - must throw");
+	}
+	catch (NotFoundException&)
+	{
+	}
+}
+
+
+void NameValueCollectionTest::testInternedNames()
+{
+	const std::string* pName = NameValueCollection::findInternedName("content-length", 14);
+	assert (pName != 0);
+	assert (*pName == "Content-Length");
+
+	pName = NameValueCollection::findInternedName("HOST", 4);
+	assert (pName != 0);
+	assert (*pName == "Host");
+
+	pName = NameValueCollection::findInternedName("Accept-Encoding", 15);
+	assert (pName != 0);
+	assert (*pName == "Accept-Encoding");
+
+	pName = NameValueCollection::findInternedName("Accept-Language", 15);
+	assert (pName != 0);
+	assert (*pName == "Accept-Language");
+
+	assert (NameValueCollection::findInternedName("X-Custom-Header", 15) == 0);
+	assert (NameValueCollection::findInternedName("Hose", 4) == 0);
+	assert (NameValueCollection::findInternedName("Contant-Length", 14) == 0);
+}
+
+
+void NameValueCollectionTest::testIndexedLookup()
+{
+	NameValueCollection nvc;
+	for (int i = 0; i < 40; ++i)
+	{
+		nvc.add("Name" + Poco::NumberFormatter::format(i), "value" + Poco::NumberFormatter::format(i));
+	}
+	nvc.add("Dup", "first");
+	nvc.add("Dup", "second");
+
+	// well above the indexing threshold
+	assert (nvc.size() == 42);
+	for (int i = 0; i < 40; ++i)
+	{
+		assert (nvc.get("name" + Poco::NumberFormatter::format(i)) == "value" + Poco::NumberFormatter::format(i));
+	}
+	assert (nvc.get("DUP") == "first");
+	assert (!nvc.has("Name40"));
+
+	nvc.set("Name39", "updated");
+	assert (nvc.get("Name39") == "updated");
+
+	nvc.erase("Name0");
+	assert (!nvc.has("Name0"));
+	assert (nvc.get("Name1") == "value1");
+
+	NameValueCollection nvc2(nvc);
+	assert (nvc2.get("Name39") == "updated");
+	nvc2.clear();
+	assert (nvc2.empty());
+	assert (nvc.get("Name39") == "updated");
+}
+
+
 void NameValueCollectionTest::setUp()
 {
 }
@@ -121,6 +239,10 @@ CppUnit::Test* NameValueCollectionTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("NameValueCollectionTest");
 
 	CppUnit_addTest(pSuite, NameValueCollectionTest, testNameValueCollection);
+	CppUnit_addTest(pSuite, NameValueCollectionTest, testMove);
+	CppUnit_addTest(pSuite, NameValueCollectionTest, testPtrLenOverloads);
+	CppUnit_addTest(pSuite, NameValueCollectionTest, testInternedNames);
+	CppUnit_addTest(pSuite, NameValueCollectionTest, testIndexedLookup);
 
 	return pSuite;
 }
@@ -25,6 +25,10 @@ public:
 	~NameValueCollectionTest();
 
 	void testNameValueCollection();
+	void testMove();
+	void testPtrLenOverloads();
+	void testInternedNames();
+	void testIndexedLookup();
 
 	void setUp();
 	void tearDown();
@@ -115,6 +115,46 @@ void PollSetTest::testPoll()
 }
 
 
+void PollSetTest::testPollEvents()
+{
+	EchoServer echoServer;
+	StreamSocket ss;
+
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+
+	PollSet ps;
+	ps.add(ss, PollSet::POLL_READ);
+
+	Timespan timeout(1000000);
+	PollSet::SocketEventVec events;
+
+	// nothing readable
+	assert (ps.poll(timeout, events) == 0);
+	assert (events.empty());
+
+	ss.sendBytes("hello", 5);
+	assert (ps.poll(timeout, events) == 1);
+	assert (events.size() == 1);
+	assert (events[0].socket == ss);
+	assert (events[0].mode == PollSet::POLL_READ);
+
+	char buffer[256];
+	int n = ss.receiveBytes(buffer, sizeof(buffer));
+	assert (n == 5);
+	assert (std::string(buffer, n) == "hello");
+
+	// the vector is cleared and refilled on every call
+	ss.sendBytes("HELLO", 5);
+	assert (ps.poll(timeout, events) == 1);
+	assert (events.size() == 1);
+
+	n = ss.receiveBytes(buffer, sizeof(buffer));
+	assert (n == 5);
+
+	ss.close();
+}
+
+
 void PollSetTest::setUp()
 {
 }
@@ -130,6 +170,7 @@ CppUnit::Test* PollSetTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("PollSetTest");
 
 	CppUnit_addTest(pSuite, PollSetTest, testPoll);
+	CppUnit_addTest(pSuite, PollSetTest, testPollEvents);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~PollSetTest();
 
 	void testPoll();
+	void testPollEvents();
 
 	void setUp();
 	void tearDown();
@@ -305,6 +305,96 @@ void SMTPClientSessionTest::testSendFailed()
 }
 
 
+void SMTPClientSessionTest::testSendPipelined()
+{
+	DialogServer server;
+	server.addResponse("220 localhost SMTP ready");
+	server.addResponse("250-Hello localhost\r\n250 PIPELINING");
+	server.addResponse("250 OK");
+	server.addResponse("250 OK");
+	server.addResponse("354 Send data");
+	server.addResponse("250 OK");
+	server.addResponse("221 Bye");
+	SMTPClientSession session("127.0.0.1", server.port());
+	session.login("localhost");
+	assert (session.supportsPipelining());
+
+	MailMessage message;
+	message.setSender("john.doe@no.where");
+	message.addRecipient(MailRecipient(MailRecipient::PRIMARY_RECIPIENT, "jane.doe@no.where", "Jane Doe"));
+	message.setSubject("Test Message");
+	message.setContent("Hello\r\nblah blah\r\n\r\nJohn\r\n");
+	server.clearCommands();
+	session.sendMessage(message);
+	std::string cmd = server.popCommandWait();
+	assert (cmd == "MAIL FROM: <john.doe@no.where>");
+	cmd = server.popCommandWait();
+	assert (cmd == "RCPT TO: <jane.doe@no.where>");
+	cmd = server.popCommandWait();
+	assert (cmd == "DATA");
+	int i = 0;
+	do
+	{
+		cmd = server.popCommandWait();
+	}
+	while (cmd != "." && ++i < 20);
+	assert (cmd == ".");
+
+	session.close();
+}
+
+
+void SMTPClientSessionTest::testSendMessages()
+{
+	DialogServer server;
+	server.addResponse("220 localhost SMTP ready");
+	server.addResponse("250-Hello localhost\r\n250 PIPELINING");
+	// first message
+	server.addResponse("250 OK");
+	server.addResponse("250 OK");
+	server.addResponse("354 Send data");
+	server.addResponse("250 OK");
+	// second message: recipient rejected, then RSET
+	server.addResponse("250 OK");
+	server.addResponse("550 User unknown");
+	server.addResponse("250 OK");
+	server.addResponse("221 Bye");
+	SMTPClientSession session("127.0.0.1", server.port());
+	session.login("localhost");
+
+	MailMessage message1;
+	message1.setSender("john.doe@no.where");
+	message1.addRecipient(MailRecipient(MailRecipient::PRIMARY_RECIPIENT, "jane.doe@no.where", "Jane Doe"));
+	message1.setSubject("Test Message");
+	message1.setContent("Hello\r\n");
+	MailMessage message2;
+	message2.setSender("john.doe@no.where");
+	message2.addRecipient(MailRecipient(MailRecipient::PRIMARY_RECIPIENT, "walter.foo@no.where", "Walter Foo"));
+	message2.setSubject("Test Message");
+	message2.setContent("Hello\r\n");
+
+	std::vector<const MailMessage*> messages;
+	messages.push_back(&message1);
+	messages.push_back(&message2);
+
+	server.clearCommands();
+	assert (session.sendMessages(messages) == 1);
+
+	bool rsetSeen = false;
+	std::string cmd;
+	int i = 0;
+	do
+	{
+		cmd = server.popCommandWait();
+		if (cmd == "RSET") rsetSeen = true;
+	}
+	while (!rsetSeen && ++i < 30);
+	assert (rsetSeen);
+
+	session.close();
+}
+
+
 void SMTPClientSessionTest::setUp()
 {
 }
@@ -326,6 +416,8 @@ CppUnit::Test* SMTPClientSessionTest::suite()
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendMultiRecipient);
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testMultiSeparateRecipient);
 	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendFailed);
+	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendPipelined);
+	CppUnit_addTest(pSuite, SMTPClientSessionTest, testSendMessages);
 
 	return pSuite;
 }
@@ -31,6 +31,8 @@ public:
 	void testSendMultiRecipient();
 	void testMultiSeparateRecipient();
 	void testSendFailed();
+	void testSendPipelined();
+	void testSendMessages();
 	
 	void setUp();
 	void tearDown();
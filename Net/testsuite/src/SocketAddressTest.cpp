@@ -152,6 +152,24 @@ void SocketAddressTest::testSocketRelationals()
 }
 
 
+void SocketAddressTest::testSocketAddressCache()
+{
+	// repeated construction from the same numeric string is served
+	// from the cache and must yield an identical address
+	SocketAddress sa1("192.168.1.100:8080");
+	SocketAddress sa2("192.168.1.100:8080");
+	assert (sa1 == sa2);
+	assert (sa2.host().toString() == "192.168.1.100");
+	assert (sa2.port() == 8080);
+#if defined(POCO_HAVE_IPv6)
+	SocketAddress sa3("[::1]:8080");
+	SocketAddress sa4("[::1]:8080");
+	assert (sa3 == sa4);
+	assert (sa4.port() == 8080);
+#endif
+}
+
+
 void SocketAddressTest::testSocketAddress6()
 {
 #ifdef POCO_HAVE_IPv6
@@ -211,6 +229,7 @@ CppUnit::Test* SocketAddressTest::suite()
 
 	CppUnit_addTest(pSuite, SocketAddressTest, testSocketAddress);
 	CppUnit_addTest(pSuite, SocketAddressTest, testSocketRelationals);
+	CppUnit_addTest(pSuite, SocketAddressTest, testSocketAddressCache);
 	CppUnit_addTest(pSuite, SocketAddressTest, testSocketAddress6);
 	CppUnit_addTest(pSuite, SocketAddressTest, testSocketAddressUnixLocal);
 
@@ -26,6 +26,7 @@ public:
 
 	void testSocketAddress();
 	void testSocketRelationals();
+	void testSocketAddressCache();
 	void testSocketAddress6();
 	void testSocketAddressUnixLocal();
 
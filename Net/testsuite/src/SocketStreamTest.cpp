@@ -91,6 +91,88 @@ void SocketStreamTest::testLargeStreamEcho()
 }
 
 
+void SocketStreamTest::testBufferSize()
+{
+	const int msgSize = 64000;
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	SocketStream str(ss, 16384);
+	std::string payload;
+	payload.reserve(msgSize);
+	for (int i = 0; i < msgSize; ++i) payload += (char) ('a' + i % 26);
+	str << payload;
+	assert (str.good());
+	str.flush();
+	assert (str.good());
+	ss.shutdownSend();
+
+	std::string received;
+	received.reserve(msgSize);
+	char buffer[4096];
+	while (str.read(buffer, sizeof(buffer)).gcount() > 0)
+		received.append(buffer, (std::string::size_type) str.gcount());
+	assert (received == payload);
+
+	ss.close();
+}
+
+
+void SocketStreamTest::testCork()
+{
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	SocketStream str(ss);
+	assert (!str.rdbuf()->corked());
+	str.cork();
+	assert (str.rdbuf()->corked());
+	str << "hello, ";
+	str.flush();
+	str << "world";
+	str.uncork();
+	assert (!str.rdbuf()->corked());
+	ss.shutdownSend();
+
+	std::string received;
+	char buffer[64];
+	while (str.read(buffer, sizeof(buffer)).gcount() > 0)
+		received.append(buffer, (std::string::size_type) str.gcount());
+	assert (received == "hello, world");
+
+	ss.close();
+}
+
+
+void SocketStreamTest::testGatherWrite()
+{
+	const int msgSize = 16000;
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	SocketStream str(ss);
+	std::string payload;
+	payload.reserve(msgSize);
+	for (int i = 0; i < msgSize; ++i) payload += (char) ('A' + i % 26);
+	// the buffered prefix and the large payload are sent with
+	// a single gather write
+	str << "prefix:";
+	str << payload;
+	assert (str.good());
+	str.flush();
+	assert (str.good());
+	ss.shutdownSend();
+
+	std::string received;
+	char buffer[4096];
+	while (str.read(buffer, sizeof(buffer)).gcount() > 0)
+		received.append(buffer, (std::string::size_type) str.gcount());
+	assert (received == "prefix:" + payload);
+
+	ss.close();
+}
+
+
 void SocketStreamTest::testEOF()
 {
 	StreamSocket ss;
@@ -136,6 +218,9 @@ CppUnit::Test* SocketStreamTest::suite()
 
 	CppUnit_addTest(pSuite, SocketStreamTest, testStreamEcho);
 	CppUnit_addTest(pSuite, SocketStreamTest, testLargeStreamEcho);
+	CppUnit_addTest(pSuite, SocketStreamTest, testBufferSize);
+	CppUnit_addTest(pSuite, SocketStreamTest, testCork);
+	CppUnit_addTest(pSuite, SocketStreamTest, testGatherWrite);
 	CppUnit_addTest(pSuite, SocketStreamTest, testEOF);
 
 	return pSuite;
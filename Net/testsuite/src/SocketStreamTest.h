@@ -26,6 +26,9 @@ public:
 
 	void testStreamEcho();
 	void testLargeStreamEcho();
+	void testBufferSize();
+	void testCork();
+	void testGatherWrite();
 	void testEOF();
 
 	void setUp();
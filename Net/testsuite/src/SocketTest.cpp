@@ -22,10 +22,13 @@
 #include "Poco/FIFOBuffer.h"
 #include "Poco/Delegate.h"
 #include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/TemporaryFile.h"
 #include <iostream>
 
 
 using Poco::Net::Socket;
+using Poco::Net::SocketImpl;
 using Poco::Net::StreamSocket;
 using Poco::Net::ServerSocket;
 using Poco::Net::SocketAddress;
@@ -64,6 +67,71 @@ void SocketTest::testEcho()
 }
 
 
+void SocketTest::testEchoBufVec()
+{
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	char sndHello[6] = "hello";
+	char sndWorld[6] = "world";
+	Poco::Net::SocketBufVec sndVec;
+	sndVec.push_back(Socket::makeBuffer(sndHello, 5));
+	sndVec.push_back(Socket::makeBuffer(sndWorld, 5));
+	int n = ss.sendBytes(sndVec);
+	assert (n == 10);
+	char rcvHello[5];
+	char rcvWorld[5];
+	Poco::Net::SocketBufVec rcvVec;
+	rcvVec.push_back(Socket::makeBuffer(rcvHello, sizeof(rcvHello)));
+	rcvVec.push_back(Socket::makeBuffer(rcvWorld, sizeof(rcvWorld)));
+	n = ss.receiveBytes(rcvVec);
+	assert (n == 10);
+	assert (std::string(rcvHello, 5) == "hello");
+	assert (std::string(rcvWorld, 5) == "world");
+	ss.close();
+}
+
+
+void SocketTest::testSendFile()
+{
+	std::string payload;
+	for (int i = 0; i < 200; ++i) payload += "0123456789";
+	Poco::TemporaryFile file;
+	Poco::FileOutputStream ostr(file.path());
+	ostr << payload;
+	ostr.close();
+
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	Poco::FileInputStream istr(file.path());
+	Poco::Int64 n = ss.sendFile(istr);
+	assert (n == static_cast<Poco::Int64>(payload.size()));
+	std::string received;
+	char buffer[256];
+	while (received.size() < payload.size())
+	{
+		int rc = ss.receiveBytes(buffer, sizeof(buffer));
+		if (rc <= 0) break;
+		received.append(buffer, rc);
+	}
+	assert (received == payload);
+
+	Poco::FileInputStream istr2(file.path());
+	n = ss.sendFile(istr2, 1000, 500);
+	assert (n == 500);
+	received.clear();
+	while (received.size() < 500)
+	{
+		int rc = ss.receiveBytes(buffer, sizeof(buffer));
+		if (rc <= 0) break;
+		received.append(buffer, rc);
+	}
+	assert (received == payload.substr(1000, 500));
+	ss.close();
+}
+
+
 void SocketTest::testPoll()
 {
 	EchoServer echoServer;
@@ -238,6 +306,35 @@ void SocketTest::testNonBlocking()
 }
 
 
+void SocketTest::testTryIO()
+{
+	EchoServer echoServer;
+	StreamSocket ss;
+	SocketImpl::IOStatus st = ss.tryConnect(SocketAddress("127.0.0.1", echoServer.port()));
+	assert (st != SocketImpl::IO_ERROR);
+
+	Timespan timeout(1000000);
+	assert (ss.poll(timeout, Socket::SELECT_WRITE));
+	assert (ss.impl()->socketError() == 0);
+
+	char buffer[256];
+	int transferred = -1;
+	st = ss.tryReceiveBytes(buffer, sizeof(buffer), transferred);
+	assert (st == SocketImpl::IO_WOULD_BLOCK);
+	assert (transferred == 0);
+
+	st = ss.trySendBytes("hello", 5, transferred);
+	assert (st == SocketImpl::IO_OK);
+	assert (transferred == 5);
+
+	assert (ss.poll(timeout, Socket::SELECT_READ));
+	st = ss.tryReceiveBytes(buffer, sizeof(buffer), transferred);
+	assert (st == SocketImpl::IO_OK);
+	assert (transferred == 5);
+	assert (std::string(buffer, transferred) == "hello");
+	ss.close();
+}
+
 
 void SocketTest::testAddress()
 {
@@ -559,6 +656,8 @@ CppUnit::Test* SocketTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SocketTest");
 
 	CppUnit_addTest(pSuite, SocketTest, testEcho);
+	CppUnit_addTest(pSuite, SocketTest, testEchoBufVec);
+	CppUnit_addTest(pSuite, SocketTest, testSendFile);
 	CppUnit_addTest(pSuite, SocketTest, testPoll);
 	CppUnit_addTest(pSuite, SocketTest, testAvailable);
 	CppUnit_addTest(pSuite, SocketTest, testFIFOBuffer);
@@ -566,6 +665,7 @@ CppUnit::Test* SocketTest::suite()
 	CppUnit_addTest(pSuite, SocketTest, testConnectRefused);
 	CppUnit_addTest(pSuite, SocketTest, testConnectRefusedNB);
 	CppUnit_addTest(pSuite, SocketTest, testNonBlocking);
+	CppUnit_addTest(pSuite, SocketTest, testTryIO);
 	CppUnit_addTest(pSuite, SocketTest, testAddress);
 	CppUnit_addTest(pSuite, SocketTest, testAssign);
 	CppUnit_addTest(pSuite, SocketTest, testTimeout);
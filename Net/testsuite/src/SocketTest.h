@@ -25,6 +25,8 @@ public:
 	~SocketTest();
 
 	void testEcho();
+	void testEchoBufVec();
+	void testSendFile();
 	void testPoll();
 	void testAvailable();
 	void testFIFOBuffer();
@@ -32,6 +34,7 @@ public:
 	void testConnectRefused();
 	void testConnectRefusedNB();
 	void testNonBlocking();
+	void testTryIO();
 	void testAddress();
 	void testAssign();
 	void testTimeout();
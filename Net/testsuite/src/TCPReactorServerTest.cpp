@@ -0,0 +1,127 @@
+//
+// TCPReactorServerTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "TCPReactorServerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/TCPReactorServer.h"
+#include "Poco/Net/TCPReactorConnection.h"
+#include "Poco/Net/TCPReactorConnectionFactory.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/ServerSocket.h"
+
+
+using Poco::Net::TCPReactorServer;
+using Poco::Net::TCPReactorConnection;
+using Poco::Net::TCPReactorConnectionFactoryImpl;
+using Poco::Net::SocketReactor;
+using Poco::Net::StreamSocket;
+using Poco::Net::ServerSocket;
+using Poco::Net::SocketAddress;
+
+
+namespace
+{
+	class EchoReactorConnection: public TCPReactorConnection
+	{
+	public:
+		EchoReactorConnection(const StreamSocket& s, SocketReactor& r): TCPReactorConnection(s, r)
+		{
+		}
+
+	protected:
+		void onReadable()
+		{
+			char buffer[256];
+			int n = socket().receiveBytes(buffer, sizeof(buffer));
+			if (n > 0)
+				socket().sendBytes(buffer, n);
+			else
+				close();
+		}
+	};
+}
+
+
+TCPReactorServerTest::TCPReactorServerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+TCPReactorServerTest::~TCPReactorServerTest()
+{
+}
+
+
+void TCPReactorServerTest::testEcho()
+{
+	ServerSocket svs(0);
+	TCPReactorServer srv(new TCPReactorConnectionFactoryImpl<EchoReactorConnection>, svs);
+	srv.start();
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", srv.port()));
+	int n = ss.sendBytes("hello", 5);
+	assert (n == 5);
+	char buffer[256];
+	n = ss.receiveBytes(buffer, sizeof(buffer));
+	assert (n == 5);
+	assert (std::string(buffer, n) == "hello");
+	ss.close();
+	srv.stop();
+}
+
+
+void TCPReactorServerTest::testMultiConnections()
+{
+	ServerSocket svs(0);
+	TCPReactorServer srv(new TCPReactorConnectionFactoryImpl<EchoReactorConnection>, svs, 2);
+	srv.start();
+	enum { CONNECTIONS = 8 };
+	StreamSocket sockets[CONNECTIONS];
+	for (int i = 0; i < CONNECTIONS; ++i)
+	{
+		sockets[i].connect(SocketAddress("127.0.0.1", srv.port()));
+	}
+	char buffer[256];
+	for (int i = 0; i < CONNECTIONS; ++i)
+	{
+		int n = sockets[i].sendBytes("hello", 5);
+		assert (n == 5);
+		n = sockets[i].receiveBytes(buffer, sizeof(buffer));
+		assert (n == 5);
+		assert (std::string(buffer, n) == "hello");
+	}
+	for (int i = 0; i < CONNECTIONS; ++i)
+	{
+		sockets[i].close();
+	}
+	srv.stop();
+}
+
+
+void TCPReactorServerTest::setUp()
+{
+}
+
+
+void TCPReactorServerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* TCPReactorServerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TCPReactorServerTest");
+
+	CppUnit_addTest(pSuite, TCPReactorServerTest, testEcho);
+	CppUnit_addTest(pSuite, TCPReactorServerTest, testMultiConnections);
+
+	return pSuite;
+}
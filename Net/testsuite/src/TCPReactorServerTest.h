@@ -0,0 +1,39 @@
+//
+// TCPReactorServerTest.h
+//
+// Definition of the TCPReactorServerTest class.
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef TCPReactorServerTest_INCLUDED
+#define TCPReactorServerTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class TCPReactorServerTest: public CppUnit::TestCase
+{
+public:
+	TCPReactorServerTest(const std::string& name);
+	~TCPReactorServerTest();
+
+	void testEcho();
+	void testMultiConnections();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // TCPReactorServerTest_INCLUDED
@@ -18,6 +18,7 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Thread.h"
+#include <atomic>
 #include <iostream>
 
 
@@ -70,6 +71,34 @@ namespace
 			return false;
 		}
 	};
+
+	class PooledEchoConnectionFactory: public TCPServerConnectionFactory
+	{
+	public:
+		PooledEchoConnectionFactory():
+			_createdConnections(0)
+		{
+		}
+
+		TCPServerConnection* createConnection(const StreamSocket& socket)
+		{
+			++_createdConnections;
+			return new EchoConnection(socket);
+		}
+
+		bool supportsReset() const
+		{
+			return true;
+		}
+
+		int createdConnections() const
+		{
+			return _createdConnections;
+		}
+
+	private:
+		std::atomic<int> _createdConnections;
+	};
 }
 
 
@@ -277,6 +306,31 @@ void TCPServerTest::testFilter()
 }
 
 
+void TCPServerTest::testConnectionReuse()
+{
+	PooledEchoConnectionFactory* pFactory = new PooledEchoConnectionFactory;
+	TCPServer srv(pFactory);
+	srv.start();
+
+	SocketAddress sa("127.0.0.1", srv.socket().address().port());
+	std::string data("hello, world");
+	for (int i = 0; i < 3; ++i)
+	{
+		StreamSocket ss(sa);
+		ss.sendBytes(data.data(), (int) data.size());
+		char buffer[256];
+		int n = ss.receiveBytes(buffer, sizeof(buffer));
+		assert (n > 0);
+		assert (std::string(buffer, n) == data);
+		ss.close();
+		Thread::sleep(300);
+	}
+	assert (srv.totalConnections() == 3);
+	// the same recycled connection object serves all sequential connections
+	assert (pFactory->createdConnections() == 1);
+}
+
+
 void TCPServerTest::setUp()
 {
 }
@@ -296,6 +350,7 @@ CppUnit::Test* TCPServerTest::suite()
 	CppUnit_addTest(pSuite, TCPServerTest, testMultiConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testThreadCapacity);
 	CppUnit_addTest(pSuite, TCPServerTest, testFilter);
+	CppUnit_addTest(pSuite, TCPServerTest, testConnectionReuse);
 
 	return pSuite;
 }
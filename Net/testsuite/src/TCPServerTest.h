@@ -29,6 +29,7 @@ public:
 	void testMultiConnections();
 	void testThreadCapacity();
 	void testFilter();
+	void testConnectionReuse();
 
 	void setUp();
 	void tearDown();
@@ -22,8 +22,12 @@
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/WebSocketBroadcaster.h"
+#include "Poco/Net/SocketReactor.h"
 #include "Poco/Thread.h"
 #include "Poco/Buffer.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
 
 
 using Poco::Net::HTTPClientSession;
@@ -97,6 +101,57 @@ namespace
 	private:
 		std::size_t _bufSize;
 	};
+
+	class BroadcastRequestHandler: public Poco::Net::HTTPRequestHandler
+	{
+	public:
+		BroadcastRequestHandler(Poco::Net::WebSocketBroadcaster& broadcaster): _broadcaster(broadcaster)
+		{
+		}
+
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			try
+			{
+				WebSocket ws(request, response);
+				_broadcaster.addClient(ws);
+				char buffer[256];
+				int flags;
+				int n;
+				do
+				{
+					n = ws.receiveFrame(buffer, sizeof(buffer), flags);
+				}
+				while (n > 0 && (flags & WebSocket::FRAME_OP_BITMASK) != WebSocket::FRAME_OP_CLOSE);
+				_broadcaster.removeClient(ws);
+			}
+			catch (WebSocketException&)
+			{
+				response.setStatusAndReason(HTTPResponse::HTTP_BAD_REQUEST);
+				response.setContentLength(0);
+				response.send();
+			}
+		}
+
+	private:
+		Poco::Net::WebSocketBroadcaster& _broadcaster;
+	};
+
+	class BroadcastRequestHandlerFactory: public Poco::Net::HTTPRequestHandlerFactory
+	{
+	public:
+		BroadcastRequestHandlerFactory(Poco::Net::WebSocketBroadcaster& broadcaster): _broadcaster(broadcaster)
+		{
+		}
+
+		Poco::Net::HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new BroadcastRequestHandler(_broadcaster);
+		}
+
+	private:
+		Poco::Net::WebSocketBroadcaster& _broadcaster;
+	};
 }
 
 
@@ -266,6 +321,65 @@ void WebSocketTest::testWebSocketLargeInOneFrame()
 }
 
 
+void WebSocketTest::testBroadcast()
+{
+	Poco::Net::SocketReactor reactor;
+	Poco::Thread reactorThread;
+	reactorThread.start(reactor);
+	Poco::Net::WebSocketBroadcaster broadcaster(reactor);
+
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new BroadcastRequestHandlerFactory(broadcaster), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+
+	Poco::Thread::sleep(200);
+
+	std::vector<Poco::SharedPtr<HTTPClientSession> > sessions;
+	std::vector<Poco::SharedPtr<WebSocket> > clients;
+	for (int i = 0; i < 3; i++)
+	{
+		sessions.push_back(new HTTPClientSession("127.0.0.1", ss.address().port()));
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/ws", HTTPRequest::HTTP_1_1);
+		HTTPResponse response;
+		clients.push_back(new WebSocket(*sessions.back(), request, response));
+	}
+
+	int i = 0;
+	while (broadcaster.clients() < 3 && i++ < 100) Poco::Thread::sleep(20);
+	assert (broadcaster.clients() == 3);
+
+	std::string payload("Hello, subscribers!");
+	broadcaster.broadcast(payload.data(), (int) payload.size());
+	broadcaster.broadcast(payload.data(), (int) payload.size(), WebSocket::FRAME_BINARY);
+
+	for (int i = 0; i < 3; i++)
+	{
+		char buffer[256];
+		int flags;
+		int n = clients[i]->receiveFrame(buffer, sizeof(buffer), flags);
+		assert (n == payload.size());
+		assert ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_TEXT);
+		assert (payload.compare(0, payload.size(), buffer, 0, n) == 0);
+		n = clients[i]->receiveFrame(buffer, sizeof(buffer), flags);
+		assert (n == payload.size());
+		assert ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_BINARY);
+		assert (payload.compare(0, payload.size(), buffer, 0, n) == 0);
+	}
+
+	for (int i = 0; i < 3; i++)
+	{
+		clients[i]->shutdown();
+	}
+	i = 0;
+	while (broadcaster.clients() > 0 && i++ < 100) Poco::Thread::sleep(20);
+	assert (broadcaster.clients() == 0);
+
+	server.stop();
+	reactor.stop();
+	reactorThread.join();
+}
+
+
 void WebSocketTest::setUp()
 {
 }
@@ -283,6 +397,7 @@ CppUnit::Test* WebSocketTest::suite()
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocket);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLarge);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLargeInOneFrame);
+	CppUnit_addTest(pSuite, WebSocketTest, testBroadcast);
 
 	return pSuite;
 }
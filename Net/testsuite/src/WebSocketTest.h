@@ -27,6 +27,7 @@ public:
 	void testWebSocket();
 	void testWebSocketLarge();
 	void testWebSocketLargeInOneFrame();
+	void testBroadcast();
 
 	void setUp();
 	void tearDown();
@@ -24,14 +24,20 @@
 #include "Poco/Crypto/RSAKey.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
 #include <openssl/ssl.h>
 #include <cstdlib>
+#include <map>
 
 
 namespace Poco {
 namespace Net {
 
 
+class SharedSessionCache;
+
+
 class NetSSL_API Context: public Poco::RefCountedObject
 	/// This class encapsulates context information for
 	/// an SSL server or client, such as the certificate
@@ -312,6 +318,67 @@ public:
 		///
 		/// This method may only be called on SERVER_USE Context objects.
 
+	void setSharedSessionCache(Poco::AutoPtr<SharedSessionCache> pCache);
+		/// Installs the given shared memory session cache as the
+		/// session cache for this Context, replacing the built-in
+		/// OpenSSL session cache. Sessions become resumable across
+		/// all processes attached to the same cache, and session
+		/// tickets are encrypted with the shared, periodically
+		/// rotated ticket keys.
+		///
+		/// The Context keeps a reference to the cache.
+		///
+		/// This method may only be called on SERVER_USE Context objects.
+
+	Poco::AutoPtr<SharedSessionCache> getSharedSessionCache() const;
+		/// Returns the shared session cache, or a null pointer if
+		/// no shared session cache has been set.
+
+	Poco::UInt64 sessionCacheHits() const;
+		/// Returns the number of successful session resumptions from
+		/// the shared session cache, aggregated over all attached
+		/// processes, or 0 if no shared session cache has been set.
+
+	Poco::UInt64 sessionCacheMisses() const;
+		/// Returns the number of failed session cache lookups,
+		/// aggregated over all attached processes, or 0 if no shared
+		/// session cache has been set.
+
+	void enableVerificationCache(bool flag = true, long ttl = 300);
+		/// Enables or disables caching of peer certificate
+		/// verification results.
+		///
+		/// When enabled, the result of a successful extended peer
+		/// certificate verification is remembered, keyed by the
+		/// fingerprint of the peer's certificate chain and the host
+		/// name, and subsequent connections presenting the identical
+		/// chain skip the verification for up to ttl seconds.
+		/// Failed verifications are never cached.
+		///
+		/// Call flushVerificationCache() to invalidate all cached
+		/// results, e.g. after a certificate revocation list has
+		/// been updated.
+
+	bool verificationCacheEnabled() const;
+		/// Returns true iff caching of peer certificate verification
+		/// results is enabled.
+
+	void flushVerificationCache();
+		/// Removes all cached peer certificate verification results.
+
+	bool isVerifiedPeer(const std::string& fingerprint);
+		/// Returns true if a successful verification result for the
+		/// given chain fingerprint has been cached and has not yet
+		/// expired.
+		///
+		/// Used internally by SecureSocketImpl.
+
+	void rememberVerifiedPeer(const std::string& fingerprint);
+		/// Caches a successful verification result for the given
+		/// chain fingerprint.
+		///
+		/// Used internally by SecureSocketImpl.
+
 	void enableExtendedCertificateVerification(bool flag = true);
 		/// Enable or disable the automatic post-connection
 		/// extended certificate verification.
@@ -342,6 +409,26 @@ public:
 		/// preferences. When called, the SSL/TLS server will choose following its own
 		/// preferences.
 
+	void enableKernelTLS(bool flag = true);
+		/// Enables or disables kernel TLS (kTLS) offload for
+		/// connections created from this Context.
+		///
+		/// When enabled, and both OpenSSL (3.0 or newer) and the
+		/// operating system support it, the record layer keys are
+		/// pushed down to the socket once the handshake has
+		/// completed and the kernel encrypts and decrypts the TLS
+		/// records. This saves a userspace copy per record and
+		/// allows zero-copy primitives such as sendfile() to be
+		/// used on the underlying socket descriptor.
+		///
+		/// Offload is negotiated per connection and depends on the
+		/// selected cipher; whether it is actually active can be
+		/// queried with SecureStreamSocket::kernelTLSSendActive()
+		/// and SecureStreamSocket::kernelTLSReceiveActive().
+		///
+		/// If the OpenSSL library does not support kernel TLS,
+		/// calling this method has no effect.
+
 private:
 	void init(const Params& params);
 		/// Initializes the Context with the given parameters.
@@ -360,6 +447,11 @@ private:
 	VerificationMode _mode;
 	SSL_CTX* _pSSLContext;
 	bool _extendedCertificateVerification;
+	Poco::AutoPtr<SharedSessionCache> _pSharedSessionCache;
+	bool _verificationCacheEnabled;
+	long _verificationCacheTTL;
+	std::map<std::string, Poco::Timestamp> _verificationCache;
+	Poco::FastMutex _verificationCacheMutex;
 };
 
 
@@ -372,6 +464,12 @@ inline Context::Usage Context::usage() const
 }
 
 
+inline bool Context::verificationCacheEnabled() const
+{
+	return _verificationCacheEnabled;
+}
+
+
 inline bool Context::isForServerUse() const
 {
 	return _usage == SERVER_USE
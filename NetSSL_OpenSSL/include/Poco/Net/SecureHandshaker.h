@@ -0,0 +1,139 @@
+//
+// SecureHandshaker.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLSockets
+// Module:  SecureHandshaker
+//
+// Definition of the SecureHandshaker class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SecureHandshaker_INCLUDED
+#define NetSSL_SecureHandshaker_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/Net/SecureStreamSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/BasicEvent.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/Runnable.h"
+#include "Poco/ThreadPool.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SecureHandshaker: public Poco::RefCountedObject, public Poco::Runnable
+	/// Drives the SSL handshake of a nonblocking SecureStreamSocket
+	/// through a SocketReactor.
+	///
+	/// A blocking handshake occupies a server thread for every
+	/// connecting client until the handshake has completed, so a
+	/// surge of TLS connects can saturate a thread pool before a
+	/// single request has been served. The SecureHandshaker instead
+	/// performs the handshake as a sequence of nonblocking steps:
+	/// whenever a handshake step reports that it needs to read or
+	/// write, the handshaker registers for the corresponding socket
+	/// event with the SocketReactor and resumes the handshake from
+	/// the event callback.
+	///
+	/// When the handshake has completed, the peer certificate is
+	/// verified and the handshakeComplete event is fired. If a
+	/// ThreadPool is given, certificate verification is performed
+	/// on the pool instead of the reactor thread, keeping the
+	/// reactor responsive while certificates are checked. If the
+	/// handshake or the verification fails, the handshakeFailed
+	/// event is fired with the error message.
+	///
+	/// To perform a handshake, create a SecureHandshaker for the
+	/// socket, register delegates for the handshakeComplete and
+	/// handshakeFailed events and call start(). Exactly one of the
+	/// two events is fired exactly once; afterwards, the socket can
+	/// be used normally (e.g., handed over to a TCPReactorConnection)
+	/// and the handshaker can be released.
+{
+public:
+	typedef Poco::AutoPtr<SecureHandshaker> Ptr;
+
+	Poco::BasicEvent<SecureStreamSocket> handshakeComplete;
+		/// Fired when the handshake has completed and the peer
+		/// certificate has been verified.
+
+	Poco::BasicEvent<const std::string> handshakeFailed;
+		/// Fired when the handshake or the peer certificate
+		/// verification has failed. The event argument is the
+		/// error message.
+
+	SecureHandshaker(const SecureStreamSocket& socket, SocketReactor& reactor, Poco::ThreadPool* pVerificationPool = 0);
+		/// Creates the SecureHandshaker for the given socket, which
+		/// is put into nonblocking mode.
+		///
+		/// If pVerificationPool is given, peer certificate
+		/// verification is performed on the thread pool rather
+		/// than on the reactor thread.
+
+	void start();
+		/// Performs the first handshake step.
+		///
+		/// Event delegates must be registered before calling
+		/// start(), as the handshake may already complete (or fail)
+		/// within this call.
+
+	SecureStreamSocket& socket();
+		/// Returns a reference to the socket.
+
+protected:
+	~SecureHandshaker();
+		/// Destroys the SecureHandshaker and unregisters its event
+		/// handlers.
+
+	void run();
+		/// Verifies the peer certificate on the verification
+		/// thread pool.
+
+private:
+	void onReadable(const Poco::AutoPtr<ReadableNotification>& pNf);
+	void onWritable(const Poco::AutoPtr<WritableNotification>& pNf);
+	void onError(const Poco::AutoPtr<ErrorNotification>& pNf);
+	void step();
+	void verify();
+	void completed();
+	void failed(const std::string& msg);
+	void wantEvent(int state);
+	void unregister();
+
+	SecureHandshaker();
+	SecureHandshaker(const SecureHandshaker&);
+	SecureHandshaker& operator = (const SecureHandshaker&);
+
+	SecureStreamSocket _socket;
+	SocketReactor&     _reactor;
+	Poco::ThreadPool*  _pVerificationPool;
+	int                _wants;
+	bool               _finished;
+};
+
+
+//
+// inlines
+//
+inline SecureStreamSocket& SecureHandshaker::socket()
+{
+	return _socket;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SecureHandshaker_INCLUDED
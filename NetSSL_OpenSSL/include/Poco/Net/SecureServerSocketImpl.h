@@ -47,6 +47,22 @@ public:
 		/// with the client.
 		///
 		/// The client socket's address is returned in clientAddr.
+
+	SocketImpl* acceptConnection(SocketAddress& clientAddr, bool nonBlocking);
+		/// Get the next completed connection from the
+		/// socket's completed connection queue.
+		///
+		/// If the queue is empty, waits until a connection
+		/// request completes.
+		///
+		/// If nonBlocking is true, the accepted socket is put
+		/// into non-blocking mode after the SSL/TLS session
+		/// has been set up.
+		///
+		/// Returns a new TCP socket for the connection
+		/// with the client.
+		///
+		/// The client socket's address is returned in clientAddr.
 	
 	void connect(const SocketAddress& address);
 		/// Not supported by this kind of socket.
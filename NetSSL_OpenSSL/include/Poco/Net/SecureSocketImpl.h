@@ -179,7 +179,24 @@ public:
 	bool sessionWasReused();
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
-		
+
+	bool kernelTLSSendActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// send direction, i.e. the record layer keys have been
+		/// pushed down to the socket after the handshake and the
+		/// kernel encrypts outgoing records. In that case,
+		/// zero-copy primitives such as sendfile() can be used on
+		/// the socket descriptor.
+		///
+		/// See Context::enableKernelTLS().
+
+	bool kernelTLSReceiveActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// receive direction, i.e. the kernel decrypts incoming
+		/// records.
+		///
+		/// See Context::enableKernelTLS().
+
 protected:
 	void acceptSSL();
 		/// Performs a server-side SSL handshake and certificate verification.
@@ -190,7 +207,12 @@ protected:
 	
 	long verifyPeerCertificateImpl(const std::string& hostName);
 		/// Performs post-connect (or post-accept) peer certificate validation.
-		
+
+	std::string peerChainFingerprint(const std::string& hostName) const;
+		/// Returns a key identifying the peer's certificate chain and the
+		/// given host name, for use with the Context's verification cache.
+		/// Returns an empty string if no fingerprint can be computed.
+
 	static bool isLocalHost(const std::string& hostName);
 		/// Returns true iff the given host name is the local host 
 		/// (either "localhost" or "127.0.0.1").
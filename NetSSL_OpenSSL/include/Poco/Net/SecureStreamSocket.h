@@ -254,7 +254,21 @@ public:
 	bool sessionWasReused();
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
-		
+
+	bool kernelTLSSendActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// send direction, i.e. the kernel encrypts outgoing
+		/// records and zero-copy primitives such as sendfile() can
+		/// be used on the socket descriptor.
+		///
+		/// See Context::enableKernelTLS().
+
+	bool kernelTLSReceiveActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// receive direction.
+		///
+		/// See Context::enableKernelTLS().
+
 	void abort();
 		/// Aborts the SSL connection by closing the underlying
 		/// TCP connection. No orderly SSL shutdown is performed.
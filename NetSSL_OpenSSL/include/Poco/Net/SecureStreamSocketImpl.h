@@ -86,7 +86,26 @@ public:
 		/// in buffer. Up to length bytes are received.
 		///
 		/// Returns the number of bytes received.
-	
+
+	int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Not supported by a SecureStreamSocket; scatter/gather
+		/// I/O would bypass the SSL/TLS layer.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
+	int receiveBytes(SocketBufVec& buffers, int flags = 0);
+		/// Not supported by a SecureStreamSocket; scatter/gather
+		/// I/O would bypass the SSL/TLS layer.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
+	Poco::Int64 sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset = 0, Poco::Int64 count = 0);
+		/// Not supported by a SecureStreamSocket; the zero-copy
+		/// path would send the file content in plaintext, bypassing
+		/// the SSL/TLS layer.
+		///
+		/// Throws a Poco::InvalidAccessException.
+
 	int sendTo(const void* buffer, int length, const SocketAddress& address, int flags = 0);
 		/// Not supported by a SecureStreamSocket.
 		///
@@ -195,7 +214,15 @@ public:
 	bool sessionWasReused();
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
-		
+
+	bool kernelTLSSendActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// send direction (see Context::enableKernelTLS()).
+
+	bool kernelTLSReceiveActive() const;
+		/// Returns true iff kernel TLS offload is active for the
+		/// receive direction (see Context::enableKernelTLS()).
+
 protected:
 	void acceptSSL();
 		/// Performs a SSL server-side handshake.
@@ -263,6 +290,18 @@ inline bool SecureStreamSocketImpl::sessionWasReused()
 }
 
 
+inline bool SecureStreamSocketImpl::kernelTLSSendActive() const
+{
+	return _impl.kernelTLSSendActive();
+}
+
+
+inline bool SecureStreamSocketImpl::kernelTLSReceiveActive() const
+{
+	return _impl.kernelTLSReceiveActive();
+}
+
+
 inline int SecureStreamSocketImpl::lastError()
 {
 	return SocketImpl::lastError();
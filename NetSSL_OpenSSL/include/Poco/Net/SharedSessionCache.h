@@ -0,0 +1,185 @@
+//
+// SharedSessionCache.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SharedSessionCache
+//
+// Definition of the SharedSessionCache class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SharedSessionCache_INCLUDED
+#define NetSSL_SharedSessionCache_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/NamedMutex.h"
+#include "Poco/SharedPtr.h"
+#include <vector>
+#include <openssl/ssl.h>
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SharedSessionCache: public Poco::RefCountedObject
+	/// A TLS server-side session cache kept in shared memory, so
+	/// that multiple worker processes serving the same endpoint can
+	/// resume each other's sessions instead of performing a full
+	/// handshake for every returning client.
+	///
+	/// The cache is a fixed-size hash table of serialized
+	/// SSL_SESSION objects, hashed by session id. Buckets are
+	/// protected by a stripe of named mutexes, so that concurrent
+	/// lookups from different processes do not serialize on a
+	/// single lock. Within a full bucket, the oldest entry is
+	/// evicted. Session expiry is handled by OpenSSL, which stores
+	/// the creation time and timeout inside each serialized session.
+	///
+	/// The cache also holds the session ticket keys (RFC 5077) for
+	/// stateless resumption, shared by all attached processes and
+	/// rotated at a configurable interval. Tickets encrypted with
+	/// the previous key are still accepted after a rotation and
+	/// are transparently renewed.
+	///
+	/// To use the cache, attach it to a server Context with
+	/// Context::setSharedSessionCache(). All processes must use the
+	/// same cache name; the name must be a valid file name, as it
+	/// is also used to create the named mutexes.
+	///
+	/// Cache effectiveness can be monitored with the hits(),
+	/// misses() and stores() counters, which are aggregated over
+	/// all attached processes.
+{
+public:
+	typedef Poco::AutoPtr<SharedSessionCache> Ptr;
+
+	enum
+	{
+		DEFAULT_BUCKETS     = 256,
+		ENTRIES_PER_BUCKET  = 4,
+		MAX_SESSION_SIZE    = 4096,
+		MAX_SESSION_ID_SIZE = 32,
+		LOCK_STRIPES        = 8,
+		DEFAULT_KEY_ROTATION_INTERVAL = 3600
+	};
+
+	explicit SharedSessionCache(const std::string& name, int buckets = DEFAULT_BUCKETS, long keyRotationInterval = DEFAULT_KEY_ROTATION_INTERVAL);
+		/// Creates or attaches to the shared session cache with the
+		/// given name. The first process to create the cache
+		/// initializes it; all other processes must specify the
+		/// same number of buckets.
+		///
+		/// keyRotationInterval is the session ticket key lifetime
+		/// in seconds.
+
+	~SharedSessionCache();
+		/// Destroys the SharedSessionCache. The shared memory
+		/// segment is left behind for other processes.
+
+	void attach(SSL_CTX* pSSLContext);
+		/// Installs the cache as the external session cache of the
+		/// given SSL context and registers the session ticket key
+		/// callback. The internal OpenSSL session cache is
+		/// disabled.
+
+	bool store(SSL_SESSION* pSession);
+		/// Serializes the given session into the cache.
+		///
+		/// Returns true if the session has been stored, or false if
+		/// it is too large for a cache entry.
+
+	SSL_SESSION* find(const unsigned char* pId, int length);
+		/// Looks up the session with the given session id.
+		///
+		/// Returns a deserialized session (which the caller owns),
+		/// or a null pointer if the session is not in the cache.
+
+	void remove(const unsigned char* pId, int length);
+		/// Removes the session with the given session id from
+		/// the cache.
+
+	Poco::UInt64 hits() const;
+		/// Returns the number of successful session lookups,
+		/// aggregated over all attached processes.
+
+	Poco::UInt64 misses() const;
+		/// Returns the number of failed session lookups,
+		/// aggregated over all attached processes.
+
+	Poco::UInt64 stores() const;
+		/// Returns the number of sessions stored, aggregated over
+		/// all attached processes.
+
+	const std::string& name() const;
+		/// Returns the name of the cache.
+
+	struct TicketKey
+		/// A session ticket key (RFC 5077).
+	{
+		unsigned char name[16];
+		unsigned char hmacKey[32];
+		unsigned char aesKey[32];
+	};
+
+	int useTicketKey(unsigned char* pKeyName, TicketKey& key);
+		/// Rotates the ticket keys if the rotation interval has
+		/// expired, then returns the current key for encrypting a
+		/// new ticket. The key name is copied to pKeyName.
+		///
+		/// Returns 1, for use from the ticket key callback.
+
+	int findTicketKey(const unsigned char* pKeyName, TicketKey& key);
+		/// Looks up the ticket key with the given name for
+		/// decrypting a ticket.
+		///
+		/// Returns 1 if it is the current key, 2 if it is the
+		/// previous key (the ticket should be renewed) or 0 if the
+		/// key is unknown.
+
+private:
+	struct Header;
+	struct Entry;
+
+	SharedSessionCache(const SharedSessionCache&);
+	SharedSessionCache& operator = (const SharedSessionCache&);
+
+	static std::size_t segmentSize(int buckets);
+	Header* header() const;
+	Entry* bucket(Poco::UInt32 index) const;
+	Poco::UInt32 bucketIndex(const unsigned char* pId, int length) const;
+	Poco::NamedMutex& mutexFor(Poco::UInt32 bucketIdx);
+	void rotateKeys(Header* pHeader);
+
+	std::string        _name;
+	Poco::UInt32       _buckets;
+	long               _keyRotationInterval;
+	Poco::SharedMemory _memory;
+	std::vector<Poco::SharedPtr<Poco::NamedMutex> > _mutexes;
+	Poco::NamedMutex   _keyMutex;
+};
+
+
+//
+// inlines
+//
+inline const std::string& SharedSessionCache::name() const
+{
+	return _name;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SharedSessionCache_INCLUDED
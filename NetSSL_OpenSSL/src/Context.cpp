@@ -13,12 +13,14 @@
 
 
 #include "Poco/Net/Context.h"
+#include "Poco/Net/SharedSessionCache.h"
 #include "Poco/Net/SSLManager.h"
 #include "Poco/Net/SSLException.h"
 #include "Poco/Net/Utility.h"
 #include "Poco/Crypto/OpenSSLInitializer.h"
 #include "Poco/File.h"
 #include "Poco/Path.h"
+#include "Poco/SingletonHolder.h"
 #include "Poco/Timestamp.h"
 #include <openssl/bio.h>
 #include <openssl/err.h>
@@ -30,6 +32,65 @@ namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	class CAStoreCache
+		/// Caches parsed CA certificate stores by location, so that
+		/// Contexts sharing the same caLocation share one X509_STORE
+		/// instead of re-reading and re-parsing the PEM files for
+		/// every Context construction.
+	{
+	public:
+		CAStoreCache()
+		{
+		}
+
+		~CAStoreCache()
+		{
+			for (StoreMap::iterator it = _stores.begin(); it != _stores.end(); ++it)
+			{
+				X509_STORE_free(it->second);
+			}
+		}
+
+		X509_STORE* get(const std::string& location, bool directory)
+			/// Returns the shared store for the given location, loading
+			/// it on first use, or a null pointer if the location
+			/// cannot be loaded.
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			StoreMap::iterator it = _stores.find(location);
+			if (it != _stores.end()) return it->second;
+
+			X509_STORE* pStore = X509_STORE_new();
+			if (!pStore) return 0;
+			int rc = X509_STORE_load_locations(pStore,
+				directory ? 0 : Poco::Path::transcode(location).c_str(),
+				directory ? Poco::Path::transcode(location).c_str() : 0);
+			if (rc != 1)
+			{
+				X509_STORE_free(pStore);
+				return 0;
+			}
+			_stores[location] = pStore;
+			return pStore;
+		}
+
+		static CAStoreCache& instance()
+		{
+			static Poco::SingletonHolder<CAStoreCache> sh;
+			return *sh.get();
+		}
+
+	private:
+		typedef std::map<std::string, X509_STORE*> StoreMap;
+
+		StoreMap        _stores;
+		Poco::FastMutex _mutex;
+	};
+}
+
+
 Context::Params::Params():
 	verificationMode(VERIFY_RELAXED),
 	verificationDepth(9),
@@ -43,7 +104,9 @@ Context::Context(Usage usage, const Params& params):
 	_usage(usage),
 	_mode(params.verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_verificationCacheEnabled(false),
+	_verificationCacheTTL(300)
 {
 	init(params);
 }
@@ -61,7 +124,9 @@ Context::Context(
 	_usage(usage),
 	_mode(verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_verificationCacheEnabled(false),
+	_verificationCacheTTL(300)
 {
 	Params params;
 	params.privateKeyFile = privateKeyFile;
@@ -85,7 +150,9 @@ Context::Context(
 	_usage(usage),
 	_mode(verificationMode),
 	_pSSLContext(0),
-	_extendedCertificateVerification(true)
+	_extendedCertificateVerification(true),
+	_verificationCacheEnabled(false),
+	_verificationCacheTTL(300)
 {
 	Params params;
 	params.caLocation = caLocation;
@@ -123,10 +190,20 @@ void Context::init(const Params& params)
 		if (!params.caLocation.empty())
 		{
 			Poco::File aFile(params.caLocation);
+#if OPENSSL_VERSION_NUMBER >= 0x10002000L
+			// share one parsed store between all Contexts using the same location
+			X509_STORE* pStore = CAStoreCache::instance().get(params.caLocation, aFile.isDirectory());
+			if (pStore)
+			{
+				SSL_CTX_set1_cert_store(_pSSLContext, pStore);
+				errCode = 1;
+			}
+#else
 			if (aFile.isDirectory())
 				errCode = SSL_CTX_load_verify_locations(_pSSLContext, 0, Poco::Path::transcode(params.caLocation).c_str());
 			else
 				errCode = SSL_CTX_load_verify_locations(_pSSLContext, Poco::Path::transcode(params.caLocation).c_str(), 0);
+#endif
 			if (errCode != 1)
 			{
 				std::string msg = Utility::getLastError();
@@ -319,12 +396,99 @@ void Context::flushSessionCache()
 }
 
 
+void Context::setSharedSessionCache(Poco::AutoPtr<SharedSessionCache> pCache)
+{
+	poco_assert (isForServerUse());
+	poco_check_ptr (pCache.get());
+
+	_pSharedSessionCache = pCache;
+	_pSharedSessionCache->attach(_pSSLContext);
+}
+
+
+Poco::AutoPtr<SharedSessionCache> Context::getSharedSessionCache() const
+{
+	return _pSharedSessionCache;
+}
+
+
+Poco::UInt64 Context::sessionCacheHits() const
+{
+	if (_pSharedSessionCache)
+		return _pSharedSessionCache->hits();
+	else
+		return 0;
+}
+
+
+Poco::UInt64 Context::sessionCacheMisses() const
+{
+	if (_pSharedSessionCache)
+		return _pSharedSessionCache->misses();
+	else
+		return 0;
+}
+
+
+void Context::enableVerificationCache(bool flag, long ttl)
+{
+	poco_assert (ttl > 0);
+
+	Poco::FastMutex::ScopedLock lock(_verificationCacheMutex);
+	_verificationCacheEnabled = flag;
+	_verificationCacheTTL = ttl;
+	if (!flag) _verificationCache.clear();
+}
+
+
+void Context::flushVerificationCache()
+{
+	Poco::FastMutex::ScopedLock lock(_verificationCacheMutex);
+	_verificationCache.clear();
+}
+
+
+bool Context::isVerifiedPeer(const std::string& fingerprint)
+{
+	Poco::FastMutex::ScopedLock lock(_verificationCacheMutex);
+	std::map<std::string, Poco::Timestamp>::iterator it = _verificationCache.find(fingerprint);
+	if (it == _verificationCache.end()) return false;
+	if (it->second.isElapsed(_verificationCacheTTL*Poco::Timestamp::resolution()))
+	{
+		_verificationCache.erase(it);
+		return false;
+	}
+	return true;
+}
+
+
+void Context::rememberVerifiedPeer(const std::string& fingerprint)
+{
+	Poco::FastMutex::ScopedLock lock(_verificationCacheMutex);
+	if (_verificationCacheEnabled)
+	{
+		_verificationCache[fingerprint] = Poco::Timestamp();
+	}
+}
+
+
 void Context::enableExtendedCertificateVerification(bool flag)
 {
 	_extendedCertificateVerification = flag;
 }
 
 
+void Context::enableKernelTLS(bool flag)
+{
+#if defined(SSL_OP_ENABLE_KTLS)
+	if (flag)
+		SSL_CTX_set_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+	else
+		SSL_CTX_clear_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+#endif
+}
+
+
 void Context::disableStatelessSessionResumption()
 {
 #if defined(SSL_OP_NO_TICKET)
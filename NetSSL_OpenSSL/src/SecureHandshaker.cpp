@@ -0,0 +1,203 @@
+//
+// SecureHandshaker.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLSockets
+// Module:  SecureHandshaker
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/SecureHandshaker.h"
+#include "Poco/NObserver.h"
+#include "Poco/Exception.h"
+
+
+using Poco::NObserver;
+
+
+namespace Poco {
+namespace Net {
+
+
+SecureHandshaker::SecureHandshaker(const SecureStreamSocket& socket, SocketReactor& reactor, Poco::ThreadPool* pVerificationPool):
+	_socket(socket),
+	_reactor(reactor),
+	_pVerificationPool(pVerificationPool),
+	_wants(0),
+	_finished(false)
+{
+	_socket.setBlocking(false);
+}
+
+
+SecureHandshaker::~SecureHandshaker()
+{
+	try
+	{
+		unregister();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void SecureHandshaker::start()
+{
+	Ptr guard(this, true);
+	step();
+}
+
+
+void SecureHandshaker::onReadable(const Poco::AutoPtr<ReadableNotification>& pNf)
+{
+	Ptr guard(this, true);
+	step();
+}
+
+
+void SecureHandshaker::onWritable(const Poco::AutoPtr<WritableNotification>& pNf)
+{
+	Ptr guard(this, true);
+	step();
+}
+
+
+void SecureHandshaker::onError(const Poco::AutoPtr<ErrorNotification>& pNf)
+{
+	Ptr guard(this, true);
+	unregister();
+	failed("Socket error during SSL handshake");
+}
+
+
+void SecureHandshaker::step()
+{
+	if (_finished) return;
+
+	try
+	{
+		int rc = _socket.completeHandshake();
+		if (rc == 1)
+		{
+			unregister();
+			if (_pVerificationPool)
+			{
+				duplicate(); // released in run()
+				try
+				{
+					_pVerificationPool->start(*this);
+				}
+				catch (...)
+				{
+					release();
+					throw;
+				}
+			}
+			else
+			{
+				verify();
+			}
+		}
+		else if (rc == SecureStreamSocket::ERR_SSL_WANT_READ)
+		{
+			wantEvent(SecureStreamSocket::ERR_SSL_WANT_READ);
+		}
+		else if (rc == SecureStreamSocket::ERR_SSL_WANT_WRITE)
+		{
+			wantEvent(SecureStreamSocket::ERR_SSL_WANT_WRITE);
+		}
+		else
+		{
+			unregister();
+			failed("Connection closed during SSL handshake");
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		unregister();
+		failed(exc.displayText());
+	}
+}
+
+
+void SecureHandshaker::run()
+{
+	Ptr guard(this); // adopts the reference taken in step()
+	verify();
+}
+
+
+void SecureHandshaker::verify()
+{
+	try
+	{
+		_socket.verifyPeerCertificate();
+	}
+	catch (Poco::Exception& exc)
+	{
+		failed(exc.displayText());
+		return;
+	}
+	completed();
+}
+
+
+void SecureHandshaker::completed()
+{
+	_finished = true;
+	handshakeComplete.notify(this, _socket);
+}
+
+
+void SecureHandshaker::failed(const std::string& msg)
+{
+	if (_finished) return;
+	_finished = true;
+	std::string arg(msg);
+	handshakeFailed.notify(this, arg);
+}
+
+
+void SecureHandshaker::wantEvent(int state)
+{
+	if (_wants == state) return;
+
+	if (_wants == 0)
+	{
+		_reactor.addEventHandler(_socket, NObserver<SecureHandshaker, ErrorNotification>(*this, &SecureHandshaker::onError));
+	}
+	if (_wants == SecureStreamSocket::ERR_SSL_WANT_READ)
+		_reactor.removeEventHandler(_socket, NObserver<SecureHandshaker, ReadableNotification>(*this, &SecureHandshaker::onReadable));
+	else if (_wants == SecureStreamSocket::ERR_SSL_WANT_WRITE)
+		_reactor.removeEventHandler(_socket, NObserver<SecureHandshaker, WritableNotification>(*this, &SecureHandshaker::onWritable));
+
+	if (state == SecureStreamSocket::ERR_SSL_WANT_READ)
+		_reactor.addEventHandler(_socket, NObserver<SecureHandshaker, ReadableNotification>(*this, &SecureHandshaker::onReadable));
+	else if (state == SecureStreamSocket::ERR_SSL_WANT_WRITE)
+		_reactor.addEventHandler(_socket, NObserver<SecureHandshaker, WritableNotification>(*this, &SecureHandshaker::onWritable));
+
+	_wants = state;
+}
+
+
+void SecureHandshaker::unregister()
+{
+	if (_wants == 0) return;
+
+	if (_wants == SecureStreamSocket::ERR_SSL_WANT_READ)
+		_reactor.removeEventHandler(_socket, NObserver<SecureHandshaker, ReadableNotification>(*this, &SecureHandshaker::onReadable));
+	else if (_wants == SecureStreamSocket::ERR_SSL_WANT_WRITE)
+		_reactor.removeEventHandler(_socket, NObserver<SecureHandshaker, WritableNotification>(*this, &SecureHandshaker::onWritable));
+	_reactor.removeEventHandler(_socket, NObserver<SecureHandshaker, ErrorNotification>(*this, &SecureHandshaker::onError));
+	_wants = 0;
+}
+
+
+} } // namespace Poco::Net
@@ -44,6 +44,14 @@ SocketImpl* SecureServerSocketImpl::acceptConnection(SocketAddress& clientAddr)
 }
 
 
+SocketImpl* SecureServerSocketImpl::acceptConnection(SocketAddress& clientAddr, bool nonBlocking)
+{
+	SocketImpl* pImpl = _impl.acceptConnection(clientAddr);
+	if (nonBlocking) pImpl->setBlocking(false);
+	return pImpl;
+}
+
+
 void SecureServerSocketImpl::connect(const SocketAddress& address)
 {
 	throw Poco::InvalidAccessException("Cannot connect() a SecureServerSocket");
@@ -23,10 +23,12 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/DNS.h"
+#include "Poco/DigestEngine.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
 #include "Poco/Format.h"
 #include <openssl/x509v3.h>
+#include <openssl/evp.h>
 #include <openssl/err.h>
 
 
@@ -366,12 +368,49 @@ long SecureSocketImpl::verifyPeerCertificateImpl(const std::string& hostName)
 	if (pCert)
 	{
 		X509Certificate cert(pCert);
+		if (_pContext->verificationCacheEnabled())
+		{
+			std::string fingerprint = peerChainFingerprint(hostName);
+			if (!fingerprint.empty() && _pContext->isVerifiedPeer(fingerprint))
+				return X509_V_OK;
+			long certErr = cert.verify(hostName) ? X509_V_OK : X509_V_ERR_APPLICATION_VERIFICATION;
+			if (certErr == X509_V_OK && !fingerprint.empty())
+				_pContext->rememberVerifiedPeer(fingerprint);
+			return certErr;
+		}
 		return cert.verify(hostName) ? X509_V_OK : X509_V_ERR_APPLICATION_VERIFICATION;
 	}
 	else return X509_V_OK;
 }
 
 
+std::string SecureSocketImpl::peerChainFingerprint(const std::string& hostName) const
+{
+	poco_check_ptr (_pSSL);
+
+	Poco::DigestEngine::Digest fingerprint;
+	unsigned char digest[EVP_MAX_MD_SIZE];
+	unsigned int length = 0;
+
+	X509* pCert = SSL_get_peer_certificate(_pSSL);
+	if (!pCert) return std::string();
+	int rc = X509_digest(pCert, EVP_sha256(), digest, &length);
+	X509_free(pCert);
+	if (rc != 1) return std::string();
+	fingerprint.insert(fingerprint.end(), digest, digest + length);
+
+	STACK_OF(X509)* pChain = SSL_get_peer_cert_chain(_pSSL);
+	for (int i = 0; pChain && i < sk_X509_num(pChain); i++)
+	{
+		if (X509_digest(sk_X509_value(pChain, i), EVP_sha256(), digest, &length) != 1)
+			return std::string();
+		fingerprint.insert(fingerprint.end(), digest, digest + length);
+	}
+
+	return Poco::DigestEngine::digestToHex(fingerprint) + "/" + hostName;
+}
+
+
 bool SecureSocketImpl::isLocalHost(const std::string& hostName)
 {
 	try
@@ -551,4 +590,24 @@ bool SecureSocketImpl::sessionWasReused()
 }
 
 
+bool SecureSocketImpl::kernelTLSSendActive() const
+{
+#if defined(BIO_get_ktls_send)
+	if (_pSSL)
+		return BIO_get_ktls_send(SSL_get_wbio(_pSSL)) != 0;
+#endif
+	return false;
+}
+
+
+bool SecureSocketImpl::kernelTLSReceiveActive() const
+{
+#if defined(BIO_get_ktls_recv)
+	if (_pSSL)
+		return BIO_get_ktls_recv(SSL_get_rbio(_pSSL)) != 0;
+#endif
+	return false;
+}
+
+
 } } // namespace Poco::Net
@@ -278,6 +278,18 @@ bool SecureStreamSocket::sessionWasReused()
 }
 
 
+bool SecureStreamSocket::kernelTLSSendActive() const
+{
+	return static_cast<SecureStreamSocketImpl*>(impl())->kernelTLSSendActive();
+}
+
+
+bool SecureStreamSocket::kernelTLSReceiveActive() const
+{
+	return static_cast<SecureStreamSocketImpl*>(impl())->kernelTLSReceiveActive();
+}
+
+
 void SecureStreamSocket::abort()
 {
 	static_cast<SecureStreamSocketImpl*>(impl())->abort();
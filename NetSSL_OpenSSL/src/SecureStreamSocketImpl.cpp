@@ -121,6 +121,24 @@ int SecureStreamSocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int SecureStreamSocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	throw Poco::InvalidAccessException("Cannot sendBytes() a SocketBufVec over a SecureStreamSocket");
+}
+
+
+int SecureStreamSocketImpl::receiveBytes(SocketBufVec& buffers, int flags)
+{
+	throw Poco::InvalidAccessException("Cannot receiveBytes() a SocketBufVec over a SecureStreamSocket");
+}
+
+
+Poco::Int64 SecureStreamSocketImpl::sendFile(FileInputStream& fileInputStream, Poco::UInt64 offset, Poco::Int64 count)
+{
+	throw Poco::InvalidAccessException("Cannot sendFile() over a SecureStreamSocket");
+}
+
+
 int SecureStreamSocketImpl::receiveBytes(void* buffer, int length, int flags)
 {
 	return _impl.receiveBytes(buffer, length, flags);
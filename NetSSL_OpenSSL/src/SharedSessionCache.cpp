@@ -0,0 +1,438 @@
+//
+// SharedSessionCache.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SharedSessionCache
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/SharedSessionCache.h"
+#include "Poco/Net/SSLException.h"
+#include "Poco/Exception.h"
+#include "Poco/Mutex.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Timestamp.h"
+#include <cstring>
+#include <openssl/rand.h>
+#include <openssl/evp.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
+
+namespace Poco {
+namespace Net {
+
+
+struct SharedSessionCache::Header
+	/// The fixed part at the beginning of the shared memory segment.
+	/// All counters are striped like the bucket mutexes, so that each
+	/// counter is only ever updated under its own stripe mutex.
+{
+	Poco::UInt32 magic;
+	Poco::UInt32 version;
+	Poco::UInt32 buckets;
+	Poco::UInt32 entriesPerBucket;
+	Poco::UInt64 hits[LOCK_STRIPES];
+	Poco::UInt64 misses[LOCK_STRIPES];
+	Poco::UInt64 stores[LOCK_STRIPES];
+	TicketKey    currentKey;
+	TicketKey    previousKey;
+	Poco::Int64  keyCreated;
+	Poco::UInt32 havePreviousKey;
+	Poco::UInt32 reserved;
+};
+
+
+struct SharedSessionCache::Entry
+	/// A single cache slot holding one serialized SSL_SESSION.
+{
+	Poco::UInt32  used;
+	Poco::UInt32  idLength;
+	unsigned char id[MAX_SESSION_ID_SIZE];
+	Poco::UInt32  dataLength;
+	Poco::UInt32  reserved;
+	Poco::Int64   created;
+	unsigned char data[MAX_SESSION_SIZE];
+};
+
+
+namespace
+{
+	const Poco::UInt32 CACHE_MAGIC   = 0x50535343; // "PSSC"
+	const Poco::UInt32 CACHE_VERSION = 1;
+
+
+	int cacheIndex()
+		/// Returns the SSL_CTX ex_data index used to find the cache
+		/// from within the OpenSSL callbacks.
+	{
+		static int index = -1;
+		static Poco::FastMutex mutex;
+		Poco::FastMutex::ScopedLock lock(mutex);
+		if (index == -1)
+			index = SSL_CTX_get_ex_new_index(0, 0, 0, 0, 0);
+		return index;
+	}
+
+
+	SharedSessionCache* cacheFor(SSL_CTX* pSSLContext)
+	{
+		return reinterpret_cast<SharedSessionCache*>(SSL_CTX_get_ex_data(pSSLContext, cacheIndex()));
+	}
+
+
+	int onNewSession(SSL* pSSL, SSL_SESSION* pSession)
+	{
+		SharedSessionCache* pCache = cacheFor(SSL_get_SSL_CTX(pSSL));
+		if (pCache) pCache->store(pSession);
+		return 0; // we did not take a reference to the session
+	}
+
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	SSL_SESSION* onGetSession(SSL* pSSL, const unsigned char* pId, int length, int* pCopy)
+#else
+	SSL_SESSION* onGetSession(SSL* pSSL, unsigned char* pId, int length, int* pCopy)
+#endif
+	{
+		*pCopy = 0; // ownership of the deserialized session passes to OpenSSL
+		SharedSessionCache* pCache = cacheFor(SSL_get_SSL_CTX(pSSL));
+		if (pCache)
+			return pCache->find(pId, length);
+		else
+			return 0;
+	}
+
+
+	void onRemoveSession(SSL_CTX* pSSLContext, SSL_SESSION* pSession)
+	{
+		SharedSessionCache* pCache = cacheFor(pSSLContext);
+		if (pCache)
+		{
+			unsigned int length;
+			const unsigned char* pId = SSL_SESSION_get_id(pSession, &length);
+			pCache->remove(pId, static_cast<int>(length));
+		}
+	}
+
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	int setTicketHMACKey(EVP_MAC_CTX* pHMACContext, const SharedSessionCache::TicketKey& key)
+	{
+		OSSL_PARAM params[3];
+		params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<unsigned char*>(key.hmacKey), sizeof(key.hmacKey));
+		params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0);
+		params[2] = OSSL_PARAM_construct_end();
+		return EVP_MAC_CTX_set_params(pHMACContext, params);
+	}
+
+
+	int onTicketKey(SSL* pSSL, unsigned char* pKeyName, unsigned char* pIV, EVP_CIPHER_CTX* pCipherContext, EVP_MAC_CTX* pHMACContext, int encrypt)
+#else
+	int onTicketKey(SSL* pSSL, unsigned char* pKeyName, unsigned char* pIV, EVP_CIPHER_CTX* pCipherContext, HMAC_CTX* pHMACContext, int encrypt)
+#endif
+	{
+		SharedSessionCache* pCache = cacheFor(SSL_get_SSL_CTX(pSSL));
+		if (!pCache) return -1;
+		SharedSessionCache::TicketKey key;
+		if (encrypt)
+		{
+			pCache->useTicketKey(pKeyName, key);
+			if (RAND_bytes(pIV, EVP_MAX_IV_LENGTH) != 1) return -1;
+			if (EVP_EncryptInit_ex(pCipherContext, EVP_aes_256_cbc(), 0, key.aesKey, pIV) != 1) return -1;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+			if (setTicketHMACKey(pHMACContext, key) != 1) return -1;
+#else
+			if (HMAC_Init_ex(pHMACContext, key.hmacKey, sizeof(key.hmacKey), EVP_sha256(), 0) != 1) return -1;
+#endif
+			return 1;
+		}
+		else
+		{
+			int rc = pCache->findTicketKey(pKeyName, key);
+			if (rc == 0) return 0;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+			if (setTicketHMACKey(pHMACContext, key) != 1) return -1;
+#else
+			if (HMAC_Init_ex(pHMACContext, key.hmacKey, sizeof(key.hmacKey), EVP_sha256(), 0) != 1) return -1;
+#endif
+			if (EVP_DecryptInit_ex(pCipherContext, EVP_aes_256_cbc(), 0, key.aesKey, pIV) != 1) return -1;
+			return rc; // 2 asks OpenSSL to renew the ticket with the current key
+		}
+	}
+}
+
+
+SharedSessionCache::SharedSessionCache(const std::string& name, int buckets, long keyRotationInterval):
+	_name(name),
+	_buckets(static_cast<Poco::UInt32>(buckets)),
+	_keyRotationInterval(keyRotationInterval),
+	_memory(name, segmentSize(buckets), Poco::SharedMemory::AM_WRITE),
+	_keyMutex(name + ".keys")
+{
+	poco_assert (buckets > 0);
+
+	for (int i = 0; i < LOCK_STRIPES; i++)
+	{
+		_mutexes.push_back(new Poco::NamedMutex(name + ".m" + Poco::NumberFormatter::format(i)));
+	}
+
+	Poco::NamedMutex::ScopedLock lock(_keyMutex);
+	Header* pHeader = header();
+	if (pHeader->magic == CACHE_MAGIC)
+	{
+		if (pHeader->version != CACHE_VERSION || pHeader->buckets != _buckets || pHeader->entriesPerBucket != ENTRIES_PER_BUCKET)
+			throw Poco::InvalidArgumentException("shared session cache layout mismatch", name);
+	}
+	else
+	{
+		// first process to attach; the segment is zero-filled on creation
+		std::memset(_memory.begin(), 0, segmentSize(buckets));
+		pHeader->version = CACHE_VERSION;
+		pHeader->buckets = _buckets;
+		pHeader->entriesPerBucket = ENTRIES_PER_BUCKET;
+		rotateKeys(pHeader);
+		pHeader->magic = CACHE_MAGIC;
+	}
+}
+
+
+SharedSessionCache::~SharedSessionCache()
+{
+}
+
+
+void SharedSessionCache::attach(SSL_CTX* pSSLContext)
+{
+	SSL_CTX_set_ex_data(pSSLContext, cacheIndex(), this);
+	SSL_CTX_set_session_cache_mode(pSSLContext, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+	SSL_CTX_sess_set_new_cb(pSSLContext, &onNewSession);
+	SSL_CTX_sess_set_get_cb(pSSLContext, &onGetSession);
+	SSL_CTX_sess_set_remove_cb(pSSLContext, &onRemoveSession);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	if (SSL_CTX_set_tlsext_ticket_key_evp_cb(pSSLContext, &onTicketKey) != 1)
+		throw SSLContextException("Cannot set session ticket key callback");
+#else
+	if (SSL_CTX_set_tlsext_ticket_key_cb(pSSLContext, &onTicketKey) != 1)
+		throw SSLContextException("Cannot set session ticket key callback");
+#endif
+}
+
+
+bool SharedSessionCache::store(SSL_SESSION* pSession)
+{
+	unsigned int idLength;
+	const unsigned char* pId = SSL_SESSION_get_id(pSession, &idLength);
+	if (idLength == 0 || idLength > MAX_SESSION_ID_SIZE) return false;
+
+	int dataLength = i2d_SSL_SESSION(pSession, 0);
+	if (dataLength <= 0 || dataLength > MAX_SESSION_SIZE) return false;
+
+	Poco::UInt32 index = bucketIndex(pId, static_cast<int>(idLength));
+	Poco::NamedMutex::ScopedLock lock(mutexFor(index));
+	Entry* pBucket = bucket(index);
+	Entry* pTarget = 0;
+	for (int i = 0; i < ENTRIES_PER_BUCKET; i++)
+	{
+		Entry* pEntry = pBucket + i;
+		if (pEntry->used && pEntry->idLength == idLength && std::memcmp(pEntry->id, pId, idLength) == 0)
+		{
+			pTarget = pEntry;
+			break;
+		}
+		if (!pEntry->used && !pTarget)
+			pTarget = pEntry;
+	}
+	if (!pTarget)
+	{
+		// bucket full; evict the oldest entry
+		pTarget = pBucket;
+		for (int i = 1; i < ENTRIES_PER_BUCKET; i++)
+		{
+			if (pBucket[i].created < pTarget->created)
+				pTarget = pBucket + i;
+		}
+	}
+
+	unsigned char* pData = pTarget->data;
+	i2d_SSL_SESSION(pSession, &pData);
+	pTarget->idLength = idLength;
+	std::memcpy(pTarget->id, pId, idLength);
+	pTarget->dataLength = static_cast<Poco::UInt32>(dataLength);
+	pTarget->created = Poco::Timestamp().epochTime();
+	pTarget->used = 1;
+	header()->stores[index % LOCK_STRIPES]++;
+	return true;
+}
+
+
+SSL_SESSION* SharedSessionCache::find(const unsigned char* pId, int length)
+{
+	if (length <= 0 || length > MAX_SESSION_ID_SIZE) return 0;
+
+	Poco::UInt32 index = bucketIndex(pId, length);
+	Poco::NamedMutex::ScopedLock lock(mutexFor(index));
+	Entry* pBucket = bucket(index);
+	for (int i = 0; i < ENTRIES_PER_BUCKET; i++)
+	{
+		Entry* pEntry = pBucket + i;
+		if (pEntry->used && pEntry->idLength == static_cast<Poco::UInt32>(length) && std::memcmp(pEntry->id, pId, length) == 0)
+		{
+			const unsigned char* pData = pEntry->data;
+			SSL_SESSION* pSession = d2i_SSL_SESSION(0, &pData, static_cast<long>(pEntry->dataLength));
+			if (pSession)
+			{
+				header()->hits[index % LOCK_STRIPES]++;
+				return pSession;
+			}
+			pEntry->used = 0; // corrupt entry; drop it
+			break;
+		}
+	}
+	header()->misses[index % LOCK_STRIPES]++;
+	return 0;
+}
+
+
+void SharedSessionCache::remove(const unsigned char* pId, int length)
+{
+	if (length <= 0 || length > MAX_SESSION_ID_SIZE) return;
+
+	Poco::UInt32 index = bucketIndex(pId, length);
+	Poco::NamedMutex::ScopedLock lock(mutexFor(index));
+	Entry* pBucket = bucket(index);
+	for (int i = 0; i < ENTRIES_PER_BUCKET; i++)
+	{
+		Entry* pEntry = pBucket + i;
+		if (pEntry->used && pEntry->idLength == static_cast<Poco::UInt32>(length) && std::memcmp(pEntry->id, pId, length) == 0)
+		{
+			pEntry->used = 0;
+			return;
+		}
+	}
+}
+
+
+Poco::UInt64 SharedSessionCache::hits() const
+{
+	// counters are read without locking; the result is approximate
+	Poco::UInt64 total = 0;
+	for (int i = 0; i < LOCK_STRIPES; i++)
+		total += header()->hits[i];
+	return total;
+}
+
+
+Poco::UInt64 SharedSessionCache::misses() const
+{
+	Poco::UInt64 total = 0;
+	for (int i = 0; i < LOCK_STRIPES; i++)
+		total += header()->misses[i];
+	return total;
+}
+
+
+Poco::UInt64 SharedSessionCache::stores() const
+{
+	Poco::UInt64 total = 0;
+	for (int i = 0; i < LOCK_STRIPES; i++)
+		total += header()->stores[i];
+	return total;
+}
+
+
+int SharedSessionCache::useTicketKey(unsigned char* pKeyName, TicketKey& key)
+{
+	Poco::NamedMutex::ScopedLock lock(_keyMutex);
+	Header* pHeader = header();
+	if (Poco::Timestamp().epochTime() - pHeader->keyCreated >= _keyRotationInterval)
+		rotateKeys(pHeader);
+	key = pHeader->currentKey;
+	std::memcpy(pKeyName, key.name, sizeof(key.name));
+	return 1;
+}
+
+
+int SharedSessionCache::findTicketKey(const unsigned char* pKeyName, TicketKey& key)
+{
+	Poco::NamedMutex::ScopedLock lock(_keyMutex);
+	Header* pHeader = header();
+	if (std::memcmp(pKeyName, pHeader->currentKey.name, sizeof(pHeader->currentKey.name)) == 0)
+	{
+		key = pHeader->currentKey;
+		return 1;
+	}
+	if (pHeader->havePreviousKey && std::memcmp(pKeyName, pHeader->previousKey.name, sizeof(pHeader->previousKey.name)) == 0)
+	{
+		key = pHeader->previousKey;
+		return 2;
+	}
+	return 0;
+}
+
+
+std::size_t SharedSessionCache::segmentSize(int buckets)
+{
+	return sizeof(Header) + static_cast<std::size_t>(buckets)*ENTRIES_PER_BUCKET*sizeof(Entry);
+}
+
+
+SharedSessionCache::Header* SharedSessionCache::header() const
+{
+	return reinterpret_cast<Header*>(_memory.begin());
+}
+
+
+SharedSessionCache::Entry* SharedSessionCache::bucket(Poco::UInt32 index) const
+{
+	poco_assert_dbg (index < _buckets);
+
+	Entry* pEntries = reinterpret_cast<Entry*>(reinterpret_cast<char*>(header()) + sizeof(Header));
+	return pEntries + static_cast<std::size_t>(index)*ENTRIES_PER_BUCKET;
+}
+
+
+Poco::UInt32 SharedSessionCache::bucketIndex(const unsigned char* pId, int length) const
+{
+	// FNV-1a
+	Poco::UInt32 hash = 0x811C9DC5;
+	for (int i = 0; i < length; i++)
+	{
+		hash ^= pId[i];
+		hash *= 0x01000193;
+	}
+	return hash % _buckets;
+}
+
+
+Poco::NamedMutex& SharedSessionCache::mutexFor(Poco::UInt32 bucketIdx)
+{
+	return *_mutexes[bucketIdx % LOCK_STRIPES];
+}
+
+
+void SharedSessionCache::rotateKeys(Header* pHeader)
+{
+	pHeader->previousKey = pHeader->currentKey;
+	pHeader->havePreviousKey = pHeader->magic == CACHE_MAGIC ? 1 : 0;
+	if (RAND_bytes(pHeader->currentKey.name, sizeof(pHeader->currentKey.name)) != 1 ||
+	    RAND_bytes(pHeader->currentKey.hmacKey, sizeof(pHeader->currentKey.hmacKey)) != 1 ||
+	    RAND_bytes(pHeader->currentKey.aesKey, sizeof(pHeader->currentKey.aesKey)) != 1)
+	{
+		throw SSLException("Cannot generate session ticket key");
+	}
+	pHeader->keyCreated = Poco::Timestamp().epochTime();
+}
+
+
+} } // namespace Poco::Net
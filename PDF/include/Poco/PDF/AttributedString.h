@@ -47,7 +47,7 @@ public:
 	AttributedString(const std::string& str, Alignment align = ALIGN_LEFT, int style = (int)STYLE_PLAIN);
 	AttributedString& operator=(const std::string&);
 	AttributedString& operator=(const char*);
-	operator const std::string&();
+	operator const std::string&() const;
 
 	void setAttribute(int attr, const Poco::Dynamic::Var& value);
 	Poco::Dynamic::Var getAttribute(int attr);
@@ -80,7 +80,7 @@ inline AttributedString& AttributedString::operator=(const char* content)
 }
 
 
-inline AttributedString::operator const std::string&()
+inline AttributedString::operator const std::string&() const
 {
 	return _content;
 }
@@ -57,7 +57,21 @@ public:
 	FontMapPtr getFonts() const { return _pFontMap; }
 	void draw(Page& page, float x, float y, float width, float height);
 
+	void drawOutline(Page& page, float x, float y, float width, float height);
+		/// Draws only the cell border.
+
+	void drawText(Page& page, float x, float y, float width, float height);
+		/// Writes only the cell text; the caller must have opened a text
+		/// object on the page (see Page::beginText()) and is responsible
+		/// for restoring the font afterwards. Together with drawOutline()
+		/// this allows many cells to share one text object (see Table::draw()).
+
+	bool hasContent() const;
+		/// Returns true if the cell text is not empty.
+
 private:
+	void applyFont(Page& page);
+
 	AttributedString   _content;
 	std::string        _name;
 	unsigned           _outline;
@@ -148,6 +162,12 @@ inline void Cell::setLineWidth(float width)
 }
 
 
+inline bool Cell::hasContent() const
+{
+	return !static_cast<const std::string&>(_content).empty();
+}
+
+
 } } // namespace Poco::PDF
 
 
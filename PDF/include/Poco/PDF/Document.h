@@ -24,6 +24,7 @@
 #include "Poco/PDF/Resource.h"
 #include <deque>
 #include <map>
+#include <ostream>
 
 
 namespace Poco {
@@ -46,6 +47,7 @@ public:
 	typedef std::map<std::string, Font>    FontContainer;
 	typedef std::map<std::string, Encoder> EncoderContainer;
 	typedef std::map<std::string, Image>   ImageContainer;
+	typedef std::map<std::string, std::string> TTFontNameMap;
 
 	enum Info
 	{
@@ -155,6 +157,11 @@ public:
 		/// Resets the current document and creates a new one.
 		/// If resetAll is true, the loaded resources are unloaded
 		/// prior to creating the new document.
+		///
+		/// With resetAll false, fonts and encodings loaded into the
+		/// library (e.g. via loadTTFont()) are kept, so a Document
+		/// object can be reused to generate many documents without
+		/// parsing the font files again for each one.
 
 	void save(const std::string fileName = "");
 		/// Saves the document to the specified file.
@@ -162,6 +169,13 @@ public:
 		/// _fileName is used. If member variable is empty string,
 		/// document is saved to the memory stream.
 
+	void save(std::ostream& ostr);
+		/// Writes the document to the given output stream.
+		///
+		/// The document is copied to the stream in fixed-size chunks
+		/// and the internal stream is released afterwards, so unlike
+		/// data() no buffer for the whole document is allocated.
+
 	const DataPtr data(SizeType& sz);
 		/// Returns the document content as raw data and data size in
 		/// the sz argument.
@@ -220,8 +234,12 @@ public:
 
 	std::string loadTTFont(const std::string& fileName, bool embed, int index = -1);
 		/// Loads true type font from file. Returns font name.
-		/// If the embed parameter is true, the glyph data of the font is embedded, 
+		/// If the embed parameter is true, the glyph data of the font is embedded,
 		/// otherwise only the matrix data is included in PDF file.
+		///
+		/// The returned name is cached, so repeated calls for the same
+		/// file do not parse the font file again. The cache survives
+		/// createNew(false) and is discarded by createNew(true).
 
 	const Image& loadPNGImage(const std::string& fileName);
 		/// Loads the specified PNG image from the file and returns reference to it.
@@ -330,6 +348,7 @@ private:
 	EncoderContainer _encoders;
 	OutlineContainer _outlines;
 	ImageContainer   _images;
+	TTFontNameMap    _ttFontNames;
 
 	friend class Page;
 };
@@ -69,6 +69,30 @@ void Cell::borderAll(bool show)
 
 
 void Cell::draw(Page& page, float x, float y, float width, float height)
+{
+	drawOutline(page, x, y, width, height);
+
+	if (hasContent())
+	{
+		Font originalFont = page.getFont();
+		float originalSize = page.getFontSize();
+		try
+		{
+			page.beginText();
+			drawText(page, x, y, width, height);
+			page.endText();
+		}
+		catch (Poco::Exception&)
+		{
+			page.setFont(originalFont, originalSize);
+			throw;
+		}
+		page.setFont(originalFont, originalSize);
+	}
+}
+
+
+void Cell::drawOutline(Page& page, float x, float y, float width, float height)
 {
 	// uncomment to force showing of the cell outline regardless of settings
 	// _outline = 15;
@@ -83,76 +107,72 @@ void Cell::draw(Page& page, float x, float y, float width, float height)
 		if (_outline & OUTLINE_BOTTOM) page.lineTo(x,       y       );
 		page.stroke();
 	}
+}
 
+
+void Cell::drawText(Page& page, float x, float y, float width, float height)
+{
 	std::string text = _content;
-	if (!text.empty())
+	if (text.empty()) return;
+
+	applyFont(page);
+
+	float tw = page.textWidth(text);
+	// trim text that does not fit
+	while (tw > width && text.size())
 	{
-		Font originalFont = page.getFont();
-		float originalSize = page.getFontSize();
-		try
-		{
-			// font names hard coded here, needs more work on the library level
-			int fontStyle = _content.getAttribute(AttributedString::ATTR_STYLE);
-			float fontSize = _content.getAttribute(AttributedString::ATTR_SIZE);
-			if (fontStyle == AttributedString::STYLE_PLAIN)
-			{
-				if (!_pFontMap)     page.setFont("Helvetica", fontSize);
-				else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_PLAIN], fontSize, _encoding);
-				else                page.setFont((*_pFontMap)[AttributedString::STYLE_PLAIN], fontSize, _encoding);
-			}
-			else if (fontStyle | AttributedString::STYLE_BOLD)
-			{
-				if (!_pFontMap)     page.setFont("Helvetica-Bold", fontSize);
-				else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_BOLD], fontSize, _encoding);
-				else                page.setFont((*_pFontMap)[AttributedString::STYLE_BOLD], fontSize, _encoding);
-			}
-			else if (fontStyle | AttributedString::STYLE_ITALIC)
-			{
-				if (!_pFontMap)     page.setFont("Helvetica-Oblique", fontSize);
-				else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_ITALIC], fontSize, _encoding);
-				else                page.setFont((*_pFontMap)[AttributedString::STYLE_ITALIC], fontSize, _encoding);
-			}
-			else if ((fontStyle & AttributedString::STYLE_BOLD) && (fontStyle & AttributedString::STYLE_ITALIC))
-			{
-				if (!_pFontMap)     page.setFont("Helvetica-BoldOblique", fontSize);
-				else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_BOLD | AttributedString::STYLE_ITALIC], fontSize, _encoding);
-				else                page.setFont((*_pFontMap)[AttributedString::STYLE_BOLD | AttributedString::STYLE_ITALIC], fontSize, _encoding);
-			}
-			else
-			{
-				throw NotFoundException(format("Unknown font style: %d", fontStyle));
-			}
-
-			float tw = page.textWidth(text);
-			// trim text that does not fit
-			while (tw > width && text.size())
-			{
-				text = text.substr(0, text.size() - 1);
-				tw = page.textWidth(text);
-			}
-			float th = page.getFontSize();
-			float yPos = (height <= th) ? y : y + (height - th) / 2;
-			int align = _content.getAttribute(AttributedString::ATTR_ALIGN);
-			switch (align)
-			{
-			case AttributedString::ALIGN_LEFT:
-				page.writeOnce(x + 5, yPos, text); break;
-			case AttributedString::ALIGN_CENTER:
-				page.writeOnce(x + (width - tw) / 2, yPos, text); break;
-				break;
-			case AttributedString::ALIGN_RIGHT:
-				page.writeOnce(x + (width - tw), yPos, text); break;
-				break;
-			default:
-				throw NotFoundException(format("Unknown alignment mode: %d", align));
-			}
-		}
-		catch (Poco::Exception&)
-		{
-			page.setFont(originalFont, originalSize);
-			throw;
-		}
-		page.setFont(originalFont, originalSize);
+		text = text.substr(0, text.size() - 1);
+		tw = page.textWidth(text);
+	}
+	float th = page.getFontSize();
+	float yPos = (height <= th) ? y : y + (height - th) / 2;
+	int align = _content.getAttribute(AttributedString::ATTR_ALIGN);
+	switch (align)
+	{
+	case AttributedString::ALIGN_LEFT:
+		page.write(x + 5, yPos, text); break;
+	case AttributedString::ALIGN_CENTER:
+		page.write(x + (width - tw) / 2, yPos, text); break;
+	case AttributedString::ALIGN_RIGHT:
+		page.write(x + (width - tw), yPos, text); break;
+	default:
+		throw NotFoundException(format("Unknown alignment mode: %d", align));
+	}
+}
+
+
+void Cell::applyFont(Page& page)
+{
+	// font names hard coded here, needs more work on the library level
+	int fontStyle = _content.getAttribute(AttributedString::ATTR_STYLE);
+	float fontSize = _content.getAttribute(AttributedString::ATTR_SIZE);
+	if (fontStyle == AttributedString::STYLE_PLAIN)
+	{
+		if (!_pFontMap)     page.setFont("Helvetica", fontSize);
+		else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_PLAIN], fontSize, _encoding);
+		else                page.setFont((*_pFontMap)[AttributedString::STYLE_PLAIN], fontSize, _encoding);
+	}
+	else if (fontStyle | AttributedString::STYLE_BOLD)
+	{
+		if (!_pFontMap)     page.setFont("Helvetica-Bold", fontSize);
+		else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_BOLD], fontSize, _encoding);
+		else                page.setFont((*_pFontMap)[AttributedString::STYLE_BOLD], fontSize, _encoding);
+	}
+	else if (fontStyle | AttributedString::STYLE_ITALIC)
+	{
+		if (!_pFontMap)     page.setFont("Helvetica-Oblique", fontSize);
+		else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_ITALIC], fontSize, _encoding);
+		else                page.setFont((*_pFontMap)[AttributedString::STYLE_ITALIC], fontSize, _encoding);
+	}
+	else if ((fontStyle & AttributedString::STYLE_BOLD) && (fontStyle & AttributedString::STYLE_ITALIC))
+	{
+		if (!_pFontMap)     page.setFont("Helvetica-BoldOblique", fontSize);
+		else if (_trueType) page.setTTFont((*_pFontMap)[AttributedString::STYLE_BOLD | AttributedString::STYLE_ITALIC], fontSize, _encoding);
+		else                page.setFont((*_pFontMap)[AttributedString::STYLE_BOLD | AttributedString::STYLE_ITALIC], fontSize, _encoding);
+	}
+	else
+	{
+		throw NotFoundException(format("Unknown font style: %d", fontStyle));
 	}
 }
 
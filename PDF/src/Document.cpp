@@ -20,6 +20,7 @@
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/StringTokenizer.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
 #include <utility>
 
 
@@ -85,6 +86,21 @@ void Document::save(const std::string fileName)
 }
 
 
+void Document::save(std::ostream& ostr)
+{
+	size();
+	HPDF_BYTE buffer[8192];
+	for (;;)
+	{
+		SizeType sz = sizeof(buffer);
+		HPDF_STATUS ret = HPDF_ReadFromStream(_pdf, buffer, &sz);
+		if (sz > 0) ostr.write(reinterpret_cast<const char*>(buffer), sz);
+		if (HPDF_OK != ret) break;
+	}
+	HPDF_ResetStream(_pdf);
+}
+
+
 const Document::DataPtr Document::data(SizeType& sz)
 {
 	sz = size();
@@ -168,21 +184,31 @@ std::string Document::loadType1Font(const std::string& afmFileName, const std::s
 
 std::string Document::loadTTFont(const std::string& fileName, bool embed, int index)
 {
+	if (index < -1)
+		throw InvalidArgumentException("Invalid font index.");
+
+	std::string key(fileName);
+	key += embed ? ";1;" : ";0;";
+	key += NumberFormatter::format(index);
+	TTFontNameMap::iterator it = _ttFontNames.find(key);
+	if (_ttFontNames.end() != it) return it->second;
+
+	std::string name;
 	if (-1 == index)
 	{
-		return HPDF_LoadTTFontFromFile(_pdf,
+		name = HPDF_LoadTTFontFromFile(_pdf,
 			fileName.c_str(),
 			embed ? HPDF_TRUE : HPDF_FALSE);
 	}
-	else if (index >= 0)
+	else
 	{
-		return HPDF_LoadTTFontFromFile2(_pdf, 
-			fileName.c_str(), 
-			static_cast<HPDF_UINT>(index), 
+		name = HPDF_LoadTTFontFromFile2(_pdf,
+			fileName.c_str(),
+			static_cast<HPDF_UINT>(index),
 			embed ? HPDF_TRUE : HPDF_FALSE);
 	}
-	else
-		throw InvalidArgumentException("Invalid font index.");
+	_ttFontNames.insert(TTFontNameMap::value_type(key, name));
+	return name;
 }
 
 
@@ -334,14 +360,17 @@ void Document::setPassword(const std::string& ownerPassword, const std::string&
 
 void Document::reset(bool all)
 {
+	// the wrapped handles become invalid with the document,
+	// regardless of whether the library keeps the loaded resources
+	_pages.clear();
+	_fonts.clear();
+	_encoders.clear();
+	_outlines.clear();
+	_images.clear();
 	if (!all) HPDF_FreeDoc(_pdf);
 	else
 	{
-		_pages.clear();
-		_fonts.clear();
-		_encoders.clear();
-		_outlines.clear();
-		_images.clear();
+		_ttFontNames.clear();
 		HPDF_FreeDocAll(_pdf);
 	}
 }
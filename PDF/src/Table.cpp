@@ -66,21 +66,56 @@ void Table::draw(Page& page, float x, float y, float width, float height)
 	{
 		int rows = _cells.size();
 		int cols = _cells[0].size();
+		float h = height / rows;
+		float w = width / cols;
+
+		// first pass: cell outlines (path operations are not allowed
+		// inside a text object)
+		bool hasText = false;
 		int r = 0;
 		for (Cells::iterator it = _cells.begin(); it != _cells.end(); ++it)
 		{
 			TableRow& row(*it);
-			float h = height / rows;
 			int c = 0;
 			for (TableRow::iterator itr = row.begin(); itr != row.end(); ++itr)
 			{
-				Cell& cell(*itr);
-				float w = width / cols;
-				cell.draw(page, x + (w * c), y - (h * r), w, h);
+				itr->drawOutline(page, x + (w * c), y - (h * r), w, h);
+				if (itr->hasContent()) hasText = true;
 				++c;
 			}
 			++r;
 		}
+
+		// second pass: all text runs share a single text object, so the
+		// begin/end overhead is paid once per table instead of once per cell
+		if (hasText)
+		{
+			Font originalFont = page.getFont();
+			float originalSize = page.getFontSize();
+			try
+			{
+				page.beginText();
+				r = 0;
+				for (Cells::iterator it = _cells.begin(); it != _cells.end(); ++it)
+				{
+					TableRow& row(*it);
+					int c = 0;
+					for (TableRow::iterator itr = row.begin(); itr != row.end(); ++itr)
+					{
+						itr->drawText(page, x + (w * c), y - (h * r), w, h);
+						++c;
+					}
+					++r;
+				}
+				page.endText();
+			}
+			catch (Poco::Exception&)
+			{
+				page.setFont(originalFont, originalSize);
+				throw;
+			}
+			page.setFont(originalFont, originalSize);
+		}
 	}
 }
 
@@ -13,6 +13,7 @@
 #include "Poco/Path.h"
 #include "Poco/StringTokenizer.h"
 #include "Poco/String.h"
+#include "Poco/NumberFormatter.h"
 
 
 using Poco::Path;
@@ -258,6 +259,9 @@ void CodeWriter::writeConstructor(std::ostream& ostr)
 
 void CodeWriter::writeHandler(std::ostream& ostr)
 {
+	_literals.clear();
+	_handlerCode = coalesceLiterals(cleanupHandler(_page.handler().str()));
+	writeLiterals(ostr);
 	ostr << "void " << _class << "::handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response)\n";
 	ostr << "{\n";
 	writeResponse(ostr);
@@ -356,10 +360,27 @@ void CodeWriter::writeContent(std::ostream& ostr)
 	if (buffered) compressed = false;
 	if (compressed) chunked = true;
 
-	if (buffered)
+	if (buffered && !chunked && !_literals.empty() && isLiteralsOnly(_handlerCode))
+	{
+		// fully static page: the content length is the sum of the
+		// literal array sizes, known at compile time, and the content
+		// can be written directly without buffering
+		std::string lengthExpr;
+		for (std::vector<std::string>::size_type i = 0; i < _literals.size(); ++i)
+		{
+			if (i > 0) lengthExpr += " + ";
+			lengthExpr += "sizeof(cpspLiteral";
+			lengthExpr += Poco::NumberFormatter::format(i);
+			lengthExpr += ") - 1";
+		}
+		ostr << "\tresponse.setContentLength(static_cast<int>(" << lengthExpr << "));\n";
+		ostr << "\tstd::ostream& responseStream = response.send();\n";
+		ostr << _handlerCode;
+	}
+	else if (buffered)
 	{
 		ostr << "\tstd::stringstream responseStream;\n";
-		ostr << cleanupHandler(_page.handler().str());
+		ostr << _handlerCode;
 		if (!chunked)
 		{
 			ostr << "\tresponse.setContentLength(static_cast<int>(responseStream.tellp()));\n";
@@ -371,13 +392,13 @@ void CodeWriter::writeContent(std::ostream& ostr)
 		ostr << "\tstd::ostream& _responseStream = response.send();\n"
 		     << "\tPoco::DeflatingOutputStream _gzipStream(_responseStream, Poco::DeflatingStreamBuf::STREAM_GZIP, " << compressionLevel << ");\n"
 		     << "\tstd::ostream& responseStream = _compressResponse ? _gzipStream : _responseStream;\n";
-		ostr << cleanupHandler(_page.handler().str());
+		ostr << _handlerCode;
 		ostr << "\tif (_compressResponse) _gzipStream.close();\n";
 	}
 	else
 	{
 		ostr << "\tstd::ostream& responseStream = response.send();\n";
-		ostr << cleanupHandler(_page.handler().str());
+		ostr << _handlerCode;
 	}
 }
 
@@ -399,3 +420,124 @@ std::string CodeWriter::cleanupHandler(std::string handler)
 	return handler;
 }
 
+
+namespace
+{
+	const std::string LITERAL_WRITE_BEGIN("\tresponseStream << \"");
+	const std::string LITERAL_WRITE_END("\";");
+	const std::string ARRAY_WRITE_BEGIN("\tresponseStream.write(cpspLiteral");
+
+
+	bool parseLiteralWrite(const std::string& line, std::string& content)
+		/// Returns true if line writes a single string literal to
+		/// responseStream, with the (escaped) literal text in content.
+	{
+		if (line.size() < LITERAL_WRITE_BEGIN.size() + LITERAL_WRITE_END.size()) return false;
+		if (line.compare(0, LITERAL_WRITE_BEGIN.size(), LITERAL_WRITE_BEGIN) != 0) return false;
+		if (line.compare(line.size() - LITERAL_WRITE_END.size(), LITERAL_WRITE_END.size(), LITERAL_WRITE_END) != 0) return false;
+
+		content.assign(line, LITERAL_WRITE_BEGIN.size(), line.size() - LITERAL_WRITE_BEGIN.size() - LITERAL_WRITE_END.size());
+		// must be one single literal: every quote inside must be escaped
+		bool escaped = false;
+		for (std::string::const_iterator it = content.begin(); it != content.end(); ++it)
+		{
+			if (escaped) escaped = false;
+			else if (*it == '\\') escaped = true;
+			else if (*it == '"') return false;
+		}
+		return !escaped;
+	}
+}
+
+
+std::string CodeWriter::coalesceLiterals(const std::string& handler)
+{
+	// keep merged literals below typical compiler limits for string literals
+	const std::string::size_type maxLiteralLength = 4096;
+
+	std::string result;
+	result.reserve(handler.size());
+	std::string run;
+	std::string content;
+	std::string::size_type pos = 0;
+	while (pos <= handler.size())
+	{
+		std::string::size_type eol = handler.find('\n', pos);
+		if (eol == std::string::npos) eol = handler.size();
+		std::string line(handler, pos, eol - pos);
+		if (parseLiteralWrite(line, content))
+		{
+			if (!run.empty() && run.size() + content.size() > maxLiteralLength)
+			{
+				appendLiteralWrite(result, run);
+			}
+			run += content;
+		}
+		else
+		{
+			appendLiteralWrite(result, run);
+			if (eol < handler.size() || !line.empty())
+			{
+				result += line;
+				result += '\n';
+			}
+		}
+		pos = eol + 1;
+	}
+	appendLiteralWrite(result, run);
+	return result;
+}
+
+
+void CodeWriter::appendLiteralWrite(std::string& result, std::string& run)
+{
+	if (run.empty()) return;
+
+	std::string name("cpspLiteral");
+	name += Poco::NumberFormatter::format(_literals.size());
+	_literals.push_back(run);
+	run.clear();
+
+	result += "\tresponseStream.write(";
+	result += name;
+	result += ", sizeof(";
+	result += name;
+	result += ") - 1);\n";
+}
+
+
+void CodeWriter::writeLiterals(std::ostream& ostr)
+{
+	if (_literals.empty()) return;
+
+	ostr << "namespace\n";
+	ostr << "{\n";
+	for (std::vector<std::string>::size_type i = 0; i < _literals.size(); ++i)
+	{
+		ostr << "\tconst char cpspLiteral" << i << "[] = \"" << _literals[i] << "\";\n";
+	}
+	ostr << "}\n";
+	ostr << "\n\n";
+}
+
+
+bool CodeWriter::isLiteralsOnly(const std::string& handler) const
+{
+	std::string::size_type pos = 0;
+	while (pos < handler.size())
+	{
+		std::string::size_type eol = handler.find('\n', pos);
+		if (eol == std::string::npos) eol = handler.size();
+		std::string line(handler, pos, eol - pos);
+		if (!line.empty() &&
+			line.compare(0, ARRAY_WRITE_BEGIN.size(), ARRAY_WRITE_BEGIN) != 0 &&
+			line.compare(0, 3, "\t//") != 0 &&
+			line.compare(0, 5, "#line") != 0)
+		{
+			return false;
+		}
+		pos = eol + 1;
+	}
+	return true;
+}
+
@@ -14,6 +14,8 @@
 
 #include "Poco/Poco.h"
 #include <ostream>
+#include <string>
+#include <vector>
 
 
 class Page;
@@ -66,6 +68,20 @@ protected:
 	void factoryClass(std::ostream& ostr, const std::string& base);
 	void factoryImpl(std::ostream& ostr, const std::string& arg);
 	std::string cleanupHandler(std::string handler);
+	std::string coalesceLiterals(const std::string& handler);
+		/// Replaces runs of consecutive responseStream << "..." statements
+		/// with a single unformatted write() of a static character array.
+		/// The array contents are collected and later emitted by
+		/// writeLiterals().
+	void appendLiteralWrite(std::string& result, std::string& run);
+		/// Appends a write() statement for the literal run collected so
+		/// far and registers the run for writeLiterals().
+	void writeLiterals(std::ostream& ostr);
+		/// Writes the static character arrays collected by
+		/// coalesceLiterals() ahead of the handler implementation.
+	bool isLiteralsOnly(const std::string& handler) const;
+		/// Returns true if the (coalesced) handler code produces only
+		/// static output, so the content length is known at compile time.
 
 private:
 	CodeWriter();
@@ -74,6 +90,8 @@ private:
 
 	const Page& _page;
 	std::string _class;
+	std::string _handlerCode;
+	std::vector<std::string> _literals;
 };
 
 
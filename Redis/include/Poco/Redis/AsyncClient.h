@@ -0,0 +1,133 @@
+//
+// AsyncClient.h
+//
+// Library: Redis
+// Package: Redis
+// Module:  AsyncClient
+//
+// Definition of the AsyncClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Redis_AsyncClient_INCLUDED
+#define Redis_AsyncClient_INCLUDED
+
+
+#include "Poco/Redis/Redis.h"
+#include "Poco/Redis/Client.h"
+#include "Poco/Activity.h"
+#include "Poco/ActiveResult.h"
+#include "Poco/Semaphore.h"
+#include "Poco/Mutex.h"
+#include <deque>
+
+
+namespace Poco {
+namespace Redis {
+
+
+class Redis_API AsyncClient
+	/// Multiplexes many callers over a single Redis connection.
+	///
+	/// Every execute() writes the command and returns a Reply, a future
+	/// that is resolved by a single reader activity. Because Redis
+	/// answers commands in the order they were sent, the reader matches
+	/// each incoming reply to the oldest outstanding Reply. This way a
+	/// single connection can serve many concurrent callers, where a
+	/// connection pool would need one connection per caller.
+	///
+	///     AsyncClient async(client);
+	///     async.start();
+	///     AsyncClient::Reply reply = async.execute(Command::get("mykey"));
+	///     // ... do other work ...
+	///     reply.wait();
+	///     if (!reply.failed())
+	///     {
+	///         RedisType::Ptr value = reply.data();
+	///     }
+	///
+	/// Error replies from the server are returned as Error elements
+	/// through data(), like Client::sendCommand(). The failed() state of
+	/// a Reply indicates a transport problem (timeout, lost connection).
+	///
+	/// While an AsyncClient is started, no other code must read from or
+	/// write to the underlying Client. Use Client::setReceiveTimeout()
+	/// to bound how long the reader may block on a dead connection.
+{
+public:
+	typedef ActiveResult<RedisType::Ptr> Reply;
+		/// The future returned by execute(). wait() blocks until the
+		/// reply arrived, data() returns it.
+
+	AsyncClient(Client& client);
+		/// Creates the AsyncClient using the given Client.
+
+	virtual ~AsyncClient();
+		/// Destroys the AsyncClient. Stops the reader activity;
+		/// outstanding replies are failed.
+
+	bool isStopped();
+		/// Returns true if the reader activity is not running, false
+		/// when it is.
+
+	void start();
+		/// Starts the activity that reads replies from the Redis server.
+
+	void stop();
+		/// Stops the read activity. Outstanding replies are failed.
+
+	Reply execute(const Array& command);
+		/// Sends the Redis command to the server and returns a Reply
+		/// that is resolved as soon as the server's answer is read.
+		///
+		/// Can be called from multiple threads; commands are written
+		/// and matched to replies in call order.
+
+protected:
+	void runActivity();
+
+private:
+	AsyncClient(const AsyncClient&);
+	AsyncClient& operator = (const AsyncClient&);
+
+	bool dequeue(Reply& reply);
+		/// Removes the oldest outstanding Reply. Returns false when
+		/// none is left.
+
+	void failPending(const Exception& exc);
+		/// Fails all outstanding replies with the given exception.
+
+	Client& _client;
+	Activity<AsyncClient> _activity;
+	std::deque<Reply> _pending;
+	Semaphore _pendingSem;
+	FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+
+
+inline bool AsyncClient::isStopped()
+{
+	return _activity.isStopped();
+}
+
+
+inline void AsyncClient::start()
+{
+	_activity.start();
+}
+
+
+} } // namespace Poco::Redis
+
+
+#endif // Redis_AsyncClient_INCLUDED
@@ -173,8 +173,11 @@ public:
 	}
 
 	Array sendCommands(const std::vector<Array>& commands);
-		/// Sends all commands (pipelining) to the Redis server before
-		/// getting all replies.
+		/// Sends all commands (pipelining) to the Redis server in a
+		/// single write before getting all replies.
+		///
+		/// See also the Pipeline class for incrementally building a
+		/// batch of commands.
 
 	void setReceiveTimeout(const Timespan& timeout);
 		/// Sets a receive timeout.
@@ -195,10 +198,16 @@ private:
 		/// call readReply as many times as you called writeCommand, even when
 		/// an error occurred on a command.
 
+	void writeRaw(const std::string& data);
+		/// Writes already serialized commands to the Redis server in a
+		/// single write and flushes the output buffer. Used by Pipeline.
+
 	Net::SocketAddress _address;
 	Net::StreamSocket _socket;
 	RedisInputStream* _input;
 	RedisOutputStream* _output;
+
+	friend class Pipeline;
 };
 
 
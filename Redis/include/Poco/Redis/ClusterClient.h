@@ -0,0 +1,161 @@
+//
+// ClusterClient.h
+//
+// Library: Redis
+// Package: Redis
+// Module:  ClusterClient
+//
+// Definition of the ClusterClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Redis_ClusterClient_INCLUDED
+#define Redis_ClusterClient_INCLUDED
+
+
+#include "Poco/Redis/Redis.h"
+#include "Poco/Redis/Client.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <vector>
+
+
+namespace Poco {
+namespace Redis {
+
+
+class Redis_API ClusterClient
+	/// Represents a connection to a Redis Cluster.
+	///
+	/// The ClusterClient fetches the cluster's slot map (CLUSTER SLOTS)
+	/// from a seed node and routes every command to the master that
+	/// serves the hash slot of the command's key, maintaining one Client
+	/// connection per node. Commands are built exactly as for Client;
+	/// the key used for routing is the second element of the command
+	/// array, or can be passed explicitly for commands where this does
+	/// not hold.
+	///
+	///     ClusterClient cluster("localhost:7000");
+	///     BulkString bs = cluster.execute<BulkString>(Command::get("mykey"));
+	///
+	/// MOVED redirects update the cached slot map and the command is
+	/// retried on the node the cluster pointed to; ASK redirects are
+	/// followed for the single command without touching the map. Both
+	/// are handled transparently, so a resharding cluster does not fail
+	/// calls that are in flight.
+{
+public:
+	typedef SharedPtr<ClusterClient> Ptr;
+
+	ClusterClient(const std::string& hostAndPort);
+		/// Creates the ClusterClient using the given seed node and
+		/// fetches the slot map from it. The host and port must be
+		/// separated with a colon.
+
+	ClusterClient(const Net::SocketAddress& addrs);
+		/// Creates the ClusterClient using the given seed node and
+		/// fetches the slot map from it.
+
+	virtual ~ClusterClient();
+		/// Destroys the ClusterClient and disconnects from all nodes.
+
+	template<typename T>
+	T execute(const Array& command)
+		/// Routes the command by the key in its second element and
+		/// tries to convert the reply to the given template type.
+		///
+		/// Supported types and error behavior are the same as for
+		/// Client::execute(); redirects are followed transparently.
+	{
+		return execute<T>(command, routingKey(command));
+	}
+
+	template<typename T>
+	T execute(const Array& command, const std::string& key)
+		/// Routes the command by the hash slot of the given key and
+		/// tries to convert the reply to the given template type.
+	{
+		RedisType::Ptr reply = sendCommand(command, key);
+		if (reply->isError())
+		{
+			Type<Error>* error = dynamic_cast<Type<Error>*>(reply.get());
+			throw RedisException(error->value().getMessage());
+		}
+		if (reply->type() == RedisTypeTraits<T>::TypeId)
+		{
+			Type<T>* type = dynamic_cast<Type<T>*>(reply.get());
+			if (type != NULL) return type->value();
+		}
+		throw BadCastException();
+	}
+
+	RedisType::Ptr sendCommand(const Array& command);
+		/// Routes the command by the key in its second element and
+		/// returns the reply. Use this when the type of the reply
+		/// isn't known.
+
+	RedisType::Ptr sendCommand(const Array& command, const std::string& key);
+		/// Routes the command by the hash slot of the given key and
+		/// returns the reply.
+		///
+		/// MOVED and ASK redirects are followed; a RedisException is
+		/// thrown when the cluster keeps redirecting.
+
+	void refreshSlots();
+		/// Fetches the slot map again from one of the known nodes.
+		/// Called automatically after a MOVED redirect.
+
+	std::size_t nodeCount() const;
+		/// Returns the number of nodes for which a connection is kept.
+
+	static UInt16 hashSlot(const std::string& key);
+		/// Returns the cluster hash slot (0 - 16383) for the given key,
+		/// honoring hash tags: when the key contains a non-empty section
+		/// between '{' and '}', only that section is hashed.
+
+private:
+	ClusterClient(const ClusterClient&);
+	ClusterClient& operator = (const ClusterClient&);
+
+	static std::string routingKey(const Array& command);
+		/// Returns the command's second element, the key by which nearly
+		/// all single-key commands are routed.
+
+	Client::Ptr clientFor(const std::string& hostAndPort);
+		/// Returns the connection to the given node, creating it when
+		/// it is not known yet. The caller must hold _mutex.
+
+	std::string nodeForSlot(UInt16 slot);
+		/// Returns host:port of the master serving the given slot.
+
+	void readSlots(Client& client);
+		/// Sends CLUSTER SLOTS to the given node and rebuilds the
+		/// slot map. The caller must hold _mutex.
+
+	struct SlotRange
+	{
+		UInt16 from;
+		UInt16 to;
+		std::string node;
+	};
+
+	std::vector<SlotRange> _slots;
+	std::map<std::string, Client::Ptr> _clients;
+	mutable FastMutex _mutex;
+
+	enum
+	{
+		REDIRECT_LIMIT = 5
+	};
+};
+
+
+} } // namespace Poco::Redis
+
+
+#endif // Redis_ClusterClient_INCLUDED
@@ -0,0 +1,96 @@
+//
+// Pipeline.h
+//
+// Library: Redis
+// Package: Redis
+// Module:  Pipeline
+//
+// Definition of the Pipeline class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Redis_Pipeline_INCLUDED
+#define Redis_Pipeline_INCLUDED
+
+
+#include "Poco/Redis/Redis.h"
+#include "Poco/Redis/Client.h"
+
+
+namespace Poco {
+namespace Redis {
+
+
+class Redis_API Pipeline
+	/// Collects Redis commands and sends them to the server in a single
+	/// write, reading all replies afterwards. This avoids a network round
+	/// trip per command, which matters when many small commands are issued
+	/// in a row.
+	///
+	/// Commands added with add() are serialized immediately into an
+	/// internal buffer; execute() sends the whole buffer at once and
+	/// reads as many replies as commands were added.
+	///
+	///     Pipeline pipeline(client);
+	///     pipeline.add(Command::set("mykey", "value"))
+	///             .add(Command::get("mykey"));
+	///     Array replies = pipeline.execute();
+{
+public:
+	Pipeline(Client& client);
+		/// Creates an empty Pipeline for the given Client.
+		///
+		/// While a Pipeline is pending, no other commands must be
+		/// sent over the Client.
+
+	Pipeline& add(const Array& command);
+		/// Adds a command to the pipeline. The command is serialized
+		/// into the internal buffer; nothing is sent yet.
+		///
+		/// Returns a reference to the Pipeline for chaining.
+
+	std::size_t count() const;
+		/// Returns the number of commands added since the last
+		/// execute() or clear().
+
+	void clear();
+		/// Discards all commands added so far without sending them.
+
+	Array execute();
+		/// Sends all added commands to the server in a single write and
+		/// reads their replies, which are returned in command order.
+		/// Afterwards, the Pipeline is empty and can be reused.
+		///
+		/// Error replies are not thrown, but returned as Error elements
+		/// of the result array.
+
+private:
+	Pipeline(const Pipeline&);
+	Pipeline& operator = (const Pipeline&);
+
+	Client& _client;
+	std::string _buffer;
+	std::size_t _count;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t Pipeline::count() const
+{
+	return _count;
+}
+
+
+} } // namespace Poco::Redis
+
+
+#endif // Redis_Pipeline_INCLUDED
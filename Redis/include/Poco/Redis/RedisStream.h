@@ -41,6 +41,10 @@ public:
 
 	std::string readLine();
 		/// Reads a line from Redis (until \r\n is encountered).
+		///
+		/// Scans the internal buffer in whole blocks for the line
+		/// terminator, appending complete runs at once, instead of
+		/// extracting one character at a time.
 
 protected:
 	int readFromDevice(char* buffer, std::streamsize length);
@@ -49,7 +53,7 @@ protected:
 private:
 	enum
 	{
-		STREAM_BUFFER_SIZE = 1024
+		STREAM_BUFFER_SIZE = 8192
 	};
 
 	Net::StreamSocket& _redis;
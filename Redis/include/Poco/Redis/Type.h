@@ -215,12 +215,12 @@ struct RedisTypeTraits<BulkString>
 
 		if ( length >= 0 )
 		{
-			std::string s;
-			s.resize(length, ' ');
-			input.read(&*s.begin(), length);
-			value.assign(s);
+			value.assign(std::string());
+			std::string& s = value.value();
+			s.resize(length);
+			if ( length > 0 ) input.read(&*s.begin(), length);
 
-			input.getline(); // Read and ignore /r/n
+			input.ignore(2); // Read and ignore /r/n
 		}
 	}
 };
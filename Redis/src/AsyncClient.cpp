@@ -0,0 +1,123 @@
+//
+// AsyncClient.cpp
+//
+// Library: Redis
+// Package: Redis
+// Module:  AsyncClient
+//
+// Implementation of the AsyncClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Redis/AsyncClient.h"
+#include "Poco/Redis/Exception.h"
+
+
+namespace Poco {
+namespace Redis {
+
+
+AsyncClient::AsyncClient(Client& client):
+	_client(client),
+	_activity(this, &AsyncClient::runActivity),
+	_pendingSem(0, 0x7FFFFFFF)
+{
+}
+
+
+AsyncClient::~AsyncClient()
+{
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void AsyncClient::stop()
+{
+	if (!_activity.isStopped())
+	{
+		_activity.stop();
+		_activity.wait();
+	}
+	failPending(RedisException("AsyncClient stopped"));
+}
+
+
+AsyncClient::Reply AsyncClient::execute(const Array& command)
+{
+	Reply reply(new ActiveResultHolder<RedisType::Ptr>());
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	_client.execute<void>(command);
+	_client.flush();
+	_pending.push_back(reply);
+	_pendingSem.set();
+
+	return reply;
+}
+
+
+void AsyncClient::runActivity()
+{
+	while (!_activity.isStopped())
+	{
+		if (!_pendingSem.tryWait(100)) continue;
+
+		Reply pending(new ActiveResultHolder<RedisType::Ptr>());
+		if (!dequeue(pending)) continue;
+
+		try
+		{
+			RedisType::Ptr reply = _client.readReply();
+			pending.data(new RedisType::Ptr(reply));
+			pending.notify();
+		}
+		catch (Exception& e)
+		{
+			pending.error(e);
+			pending.notify();
+			failPending(e);
+			_activity.stop();
+		}
+	}
+}
+
+
+bool AsyncClient::dequeue(Reply& reply)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_pending.empty()) return false;
+	reply = _pending.front();
+	_pending.pop_front();
+	return true;
+}
+
+
+void AsyncClient::failPending(const Exception& exc)
+{
+	std::deque<Reply> pending;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pending.swap(_pending);
+	}
+	for (std::deque<Reply>::iterator it = pending.begin(); it != pending.end(); ++it)
+	{
+		it->error(exc);
+		it->notify();
+	}
+}
+
+
+} } // namespace Poco::Redis
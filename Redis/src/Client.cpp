@@ -162,6 +162,15 @@ void Client::writeCommand(const Array& command, bool doFlush)
 }
 
 
+void Client::writeRaw(const std::string& data)
+{
+	poco_assert(_output);
+
+	_output->write(data.data(), data.length());
+	_output->flush();
+}
+
+
 RedisType::Ptr Client::readReply()
 {
 	poco_assert(_input);
@@ -195,11 +204,14 @@ Array Client::sendCommands(const std::vector<Array>& commands)
 {
 	Array results;
 
+	// Serialize all commands into a single buffer, so that the whole
+	// batch goes out in one write.
+	std::string buffer;
 	for (std::vector<Array>::const_iterator it = commands.begin(); it != commands.end(); ++it)
 	{
-		writeCommand(*it, false);
+		buffer += it->toString();
 	}
-	_output->flush();
+	writeRaw(buffer);
 
 	for (int i = 0; i < commands.size(); ++i)
 	{
@@ -0,0 +1,65 @@
+//
+// Pipeline.cpp
+//
+// Library: Redis
+// Package: Redis
+// Module:  Pipeline
+//
+// Implementation of the Pipeline class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Redis/Pipeline.h"
+
+
+namespace Poco {
+namespace Redis {
+
+
+Pipeline::Pipeline(Client& client):
+	_client(client),
+	_count(0)
+{
+}
+
+
+Pipeline& Pipeline::add(const Array& command)
+{
+	_buffer += command.toString();
+	++_count;
+
+	return *this;
+}
+
+
+void Pipeline::clear()
+{
+	_buffer.clear();
+	_count = 0;
+}
+
+
+Array Pipeline::execute()
+{
+	Array results;
+
+	if (_count > 0)
+	{
+		_client.writeRaw(_buffer);
+		for (std::size_t i = 0; i < _count; ++i)
+		{
+			results.addRedisType(_client.readReply());
+		}
+		clear();
+	}
+
+	return results;
+}
+
+
+} } // namespace Poco::Redis
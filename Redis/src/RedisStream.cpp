@@ -16,6 +16,7 @@
 
 #include "Poco/Redis/RedisStream.h"
 #include <iostream>
+#include <cstring>
 
 
 namespace Poco {
@@ -51,6 +52,34 @@ int RedisStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
 }
 
 
+std::string RedisStreamBuf::readLine()
+{
+	std::string line;
+	for (;;)
+	{
+		char* p = gptr();
+		char* e = egptr();
+		if (p == e)
+		{
+			if (underflow() == std::char_traits<char>::eof()) break;
+			p = gptr();
+			e = egptr();
+		}
+		char* nl = static_cast<char*>(std::memchr(p, '\n', e - p));
+		if (nl)
+		{
+			line.append(p, nl);
+			gbump(static_cast<int>(nl - p) + 1);
+			break;
+		}
+		line.append(p, e);
+		gbump(static_cast<int>(e - p));
+	}
+	if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.end() - 1);
+	return line;
+}
+
+
 //
 // RedisIOS
 //
@@ -123,10 +152,7 @@ RedisInputStream::~RedisInputStream()
 
 std::string RedisInputStream::getline()
 {
-	std::string line;
-	std::getline(*this, line);
-	if ( line.size() > 0 ) line.erase(line.end() - 1);
-	return line;
+	return _buf.readLine();
 }
 
 
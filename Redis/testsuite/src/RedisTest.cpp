@@ -14,6 +14,9 @@
 #include "RedisTest.h"
 #include "Poco/Redis/AsyncReader.h"
 #include "Poco/Redis/Command.h"
+#include "Poco/Redis/Pipeline.h"
+#include "Poco/Redis/AsyncClient.h"
+#include "Poco/Redis/ClusterClient.h"
 #include "Poco/Redis/PoolableConnectionFactory.h"
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
@@ -1580,6 +1583,124 @@ void RedisTest::testPipeliningWithWriteCommand()
 }
 
 
+void RedisTest::testPipeline()
+{
+	if (!_connected)
+	{
+		std::cout << "Not connected, test skipped." << std::endl;
+		return;
+	}
+
+	Pipeline pipeline(_redis);
+
+	Array ping;
+	ping.add("PING");
+
+	pipeline.add(Command::set("pipelinekey", "value"))
+	        .add(Command::get("pipelinekey"))
+	        .add(ping);
+	assert(pipeline.count() == 3);
+
+	Array result = pipeline.execute();
+	assert(pipeline.count() == 0);
+	assert(result.size() == 3);
+
+	try
+	{
+		assert(result.get<std::string>(0).compare("OK") == 0);
+		BulkString value = result.get<BulkString>(1);
+		assert(value.value().compare("value") == 0);
+		assert(result.get<std::string>(2).compare("PONG") == 0);
+	}
+	catch (...)
+	{
+		fail("An exception occurred");
+	}
+
+	// an executed pipeline can be reused
+	pipeline.add(ping);
+	assert(pipeline.count() == 1);
+	result = pipeline.execute();
+	assert(result.size() == 1);
+
+	// clear() discards added commands
+	pipeline.add(ping);
+	pipeline.clear();
+	assert(pipeline.count() == 0);
+	result = pipeline.execute();
+	assert(result.size() == 0);
+
+	delKey("pipelinekey");
+}
+
+
+void RedisTest::testAsyncClient()
+{
+	if (!_connected)
+	{
+		std::cout << "Not connected, test skipped." << std::endl;
+		return;
+	}
+
+	AsyncClient async(_redis);
+	async.start();
+
+	AsyncClient::Reply set = async.execute(Command::set("asynckey", "value"));
+	AsyncClient::Reply get = async.execute(Command::get("asynckey"));
+
+	Array ping;
+	ping.add("PING");
+	AsyncClient::Reply pong = async.execute(ping);
+
+	pong.wait();
+	assert(!pong.failed());
+	assert(!set.failed());
+	assert(!get.failed());
+
+	try
+	{
+		Type<std::string>* ok = dynamic_cast<Type<std::string>*>(set.data().get());
+		assert(ok != NULL);
+		assert(ok->value().compare("OK") == 0);
+
+		Type<BulkString>* value = dynamic_cast<Type<BulkString>*>(get.data().get());
+		assert(value != NULL);
+		assert(value->value().value().compare("value") == 0);
+
+		Type<std::string>* reply = dynamic_cast<Type<std::string>*>(pong.data().get());
+		assert(reply != NULL);
+		assert(reply->value().compare("PONG") == 0);
+	}
+	catch (...)
+	{
+		fail("An exception occurred");
+	}
+
+	async.stop();
+	assert(async.isStopped());
+
+	delKey("asynckey");
+}
+
+
+void RedisTest::testClusterHashSlot()
+{
+	// Known slots from the Redis Cluster specification.
+	assert(ClusterClient::hashSlot("foo") == 12182);
+	assert(ClusterClient::hashSlot("bar") == 5061);
+
+	// Keys with the same hash tag must map to the same slot.
+	assert(ClusterClient::hashSlot("{user1000}.following")
+		== ClusterClient::hashSlot("{user1000}.followers"));
+	assert(ClusterClient::hashSlot("{user1000}.following")
+		== ClusterClient::hashSlot("user1000"));
+
+	// An empty or unterminated hash tag means the whole key is hashed.
+	assert(ClusterClient::hashSlot("{}foo") != ClusterClient::hashSlot("foo"));
+	assert(ClusterClient::hashSlot("foo{bar") != ClusterClient::hashSlot("bar"));
+}
+
+
 class RedisSubscriber
 {
 public:
@@ -2983,6 +3104,9 @@ CppUnit::Test* RedisTest::suite()
 	CppUnit_addTest(pSuite, RedisTest, testPING);
 	CppUnit_addTest(pSuite, RedisTest, testPipeliningWithSendCommands);
 	CppUnit_addTest(pSuite, RedisTest, testPipeliningWithWriteCommand);
+	CppUnit_addTest(pSuite, RedisTest, testPipeline);
+	CppUnit_addTest(pSuite, RedisTest, testAsyncClient);
+	CppUnit_addTest(pSuite, RedisTest, testClusterHashSlot);
 	CppUnit_addTest(pSuite, RedisTest, testPubSub);
 	CppUnit_addTest(pSuite, RedisTest, testSADD);
 	CppUnit_addTest(pSuite, RedisTest, testSCARD);
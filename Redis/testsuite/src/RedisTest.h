@@ -58,6 +58,9 @@ public:
 	void testPING();
 	void testPipeliningWithSendCommands();
 	void testPipeliningWithWriteCommand();
+	void testPipeline();
+	void testAsyncClient();
+	void testClusterHashSlot();
 	void testPubSub();
 	void testSADD();
 	void testSCARD();
@@ -26,6 +26,11 @@
 
 
 namespace Poco {
+
+
+class ThreadPool;
+
+
 namespace SevenZip {
 
 
@@ -90,7 +95,26 @@ public:
 		///
 		/// Progress and errors for single entries will be reported
 		/// via the extracted and failed events.
-		
+
+	void extract(const std::string& destPath, Poco::ThreadPool& pool);
+		/// Extracts the entire archive to the given path, decoding
+		/// independent solid blocks concurrently on the given thread pool.
+		///
+		/// Every worker opens its own handle on the archive file and decodes
+		/// complete solid blocks, so memory use is bounded by the number of
+		/// workers times the largest block size. The calling thread takes
+		/// part in the extraction, so progress is made even when the pool
+		/// is busy. Archives written with many independent blocks (e.g.
+		/// non-solid or LZMA2 multi-block archives) profit the most; a
+		/// single-block solid archive decodes on one thread.
+		///
+		/// Directories will be created as necessary. File attributes
+		/// will not be restored.
+		///
+		/// Progress and errors for single entries will be reported
+		/// via the extracted and failed events, from the thread that
+		/// extracted the entry.
+
 	std::string extract(const ArchiveEntry& entry, const std::string& destPath);
 		/// Extracts a specific entry to the given path.
 		/// 
@@ -23,6 +23,11 @@
 #include "Poco/File.h"
 #include "Poco/Path.h"
 #include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/SharedPtr.h"
+#include <map>
 #include "7z.h"
 #include "7zAlloc.h"
 #include "7zCrc.h"
@@ -37,7 +42,8 @@ class ArchiveImpl
 {
 public:
 	ArchiveImpl(const std::string& path):
-		_path(path)
+		_path(path),
+		_activeTasks(0)
 	{
 		initialize();
 		open();
@@ -76,6 +82,243 @@ public:
 	}
 	
 	std::string extract(const ArchiveEntry& entry, const std::string& destPath)
+	{
+		Poco::UInt32 blockIndex = 0;
+		Byte* pOutBuffer = 0;
+		std::size_t outBufferSize = 0;
+		try
+		{
+			std::string extractedPath = extract(entry, destPath, &_lookStream.s, blockIndex, pOutBuffer, outBufferSize);
+			IAlloc_Free(&_szAlloc, pOutBuffer);
+			return extractedPath;
+		}
+		catch (...)
+		{
+			IAlloc_Free(&_szAlloc, pOutBuffer);
+			throw;
+		}
+	}
+
+	void extractAndNotify(Archive& archive, const ArchiveEntry& entry, const std::string& destPath)
+	{
+		Archive::ExtractedEventArgs extractedArgs;
+		extractedArgs.entry = entry;
+		bool success = true;
+		try
+		{
+			extractedArgs.extractedPath = extract(entry, destPath);
+		}
+		catch (Poco::Exception& exc)
+		{
+			success = false;
+			Archive::FailedEventArgs failedArgs;
+			failedArgs.entry = entry;
+			failedArgs.pException = &exc;
+			archive.failed(&archive, failedArgs);
+		}
+		if (success)
+		{
+			archive.extracted(&archive, extractedArgs);
+		}
+	}
+
+	void extractAll(Archive& archive, const std::string& destPath, Poco::ThreadPool& pool)
+	{
+		// Group the file entries by the solid block (folder) containing
+		// their compressed data. A block must be decoded as a whole, so
+		// it is the unit of parallelism; the parsed archive (_db) is only
+		// read during extraction and can be shared between the workers.
+		FolderWork work;
+		std::map<Poco::UInt32, std::size_t> folderSlots;
+		for (Archive::ConstIterator it = _entries.begin(); it != _entries.end(); ++it)
+		{
+			Poco::UInt32 folderIndex = _db.FileIndexToFolderIndexMap[it->index()];
+			if (it->isFile() && folderIndex != (Poco::UInt32) -1)
+			{
+				std::map<Poco::UInt32, std::size_t>::iterator itSlot = folderSlots.find(folderIndex);
+				if (itSlot == folderSlots.end())
+				{
+					itSlot = folderSlots.insert(std::make_pair(folderIndex, work.folders.size())).first;
+					work.folders.push_back(std::vector<const ArchiveEntry*>());
+				}
+				work.folders[itSlot->second].push_back(&*it);
+				// create the parent directory up front so that the workers
+				// never race on directory creation
+				Poco::File dir(buildExtractedPath(*it, destPath).parent().toString());
+				dir.createDirectories();
+			}
+			else
+			{
+				// directory entries and files without a compressed stream
+				// (e.g. empty files) require no decoding
+				extractAndNotify(archive, *it, destPath);
+			}
+		}
+		if (work.folders.empty()) return;
+
+		{
+			Poco::FastMutex::ScopedLock lock(_taskMutex);
+			_activeTasks = 0;
+			_taskError.clear();
+		}
+
+		int workers = pool.available();
+		if (workers > static_cast<int>(work.folders.size())) workers = static_cast<int>(work.folders.size());
+		std::vector<Poco::SharedPtr<Poco::Runnable> > tasks;
+		for (int i = 1; i < workers; i++)
+		{
+			Poco::SharedPtr<Poco::Runnable> pTask = new ExtractTask(*this, archive, work, destPath);
+			{
+				Poco::FastMutex::ScopedLock lock(_taskMutex);
+				_activeTasks++;
+			}
+			try
+			{
+				pool.start(*pTask);
+				tasks.push_back(pTask);
+			}
+			catch (Poco::NoThreadAvailableException&)
+			{
+				taskFinished();
+				break;
+			}
+		}
+		// the calling thread takes its share of the blocks, so extraction
+		// completes even if the pool cannot spare a single thread
+		{
+			Poco::FastMutex::ScopedLock lock(_taskMutex);
+			_activeTasks++;
+		}
+		ExtractTask ownShare(*this, archive, work, destPath);
+		ownShare.run();
+
+		std::string error;
+		{
+			Poco::FastMutex::ScopedLock lock(_taskMutex);
+			while (_activeTasks > 0) _tasksDone.wait(_taskMutex);
+			error = _taskError;
+		}
+		if (!error.empty()) throw Poco::RuntimeException("parallel extraction failed", error);
+	}
+
+protected:
+	struct FolderWork
+		/// Shared list of solid blocks still to be decoded, each with the
+		/// entries whose data it contains.
+	{
+		FolderWork(): next(0)
+		{
+		}
+
+		Poco::FastMutex mutex;
+		std::size_t next;
+		std::vector<std::vector<const ArchiveEntry*> > folders;
+	};
+
+	class ExtractTask: public Poco::Runnable
+		/// Decodes solid blocks taken from a FolderWork list. Every task
+		/// opens its own handle on the archive file and caches at most one
+		/// decoded block at a time, so memory use is bounded by the number
+		/// of workers times the largest block size.
+	{
+	public:
+		ExtractTask(ArchiveImpl& impl, Archive& archive, FolderWork& work, const std::string& destPath):
+			_impl(impl),
+			_archive(archive),
+			_work(work),
+			_destPath(destPath)
+		{
+		}
+
+		void run()
+		{
+			CFileInStream archiveStream;
+			CLookToRead lookStream;
+			bool fileOpen = false;
+			try
+			{
+				FileInStream_CreateVTable(&archiveStream);
+				LookToRead_CreateVTable(&lookStream, False);
+#if defined(_WIN32) && defined(POCO_WIN32_UTF8)
+				std::wstring wpath;
+				Poco::UnicodeConverter::toUTF16(_impl._path, wpath);
+				if (InFile_OpenW(&archiveStream.file, wpath.c_str()) != SZ_OK)
+				{
+					throw Poco::OpenFileException(_impl._path);
+				}
+#else
+				if (InFile_Open(&archiveStream.file, _impl._path.c_str()) != SZ_OK)
+				{
+					throw Poco::OpenFileException(_impl._path);
+				}
+#endif
+				fileOpen = true;
+				lookStream.realStream = &archiveStream.s;
+				LookToRead_Init(&lookStream);
+
+				for (;;)
+				{
+					const std::vector<const ArchiveEntry*>* pFolder = 0;
+					{
+						Poco::FastMutex::ScopedLock lock(_work.mutex);
+						if (_work.next >= _work.folders.size()) break;
+						pFolder = &_work.folders[_work.next++];
+					}
+					// all entries of a folder share one decoded block, which
+					// stays cached across the inner loop and is released
+					// before the next block is fetched
+					Poco::UInt32 blockIndex = 0;
+					Byte* pOutBuffer = 0;
+					std::size_t outBufferSize = 0;
+					for (std::vector<const ArchiveEntry*>::const_iterator it = pFolder->begin(); it != pFolder->end(); ++it)
+					{
+						Archive::ExtractedEventArgs extractedArgs;
+						extractedArgs.entry = **it;
+						bool success = true;
+						try
+						{
+							extractedArgs.extractedPath = _impl.extract(**it, _destPath, &lookStream.s, blockIndex, pOutBuffer, outBufferSize);
+						}
+						catch (Poco::Exception& exc)
+						{
+							success = false;
+							Archive::FailedEventArgs failedArgs;
+							failedArgs.entry = **it;
+							failedArgs.pException = &exc;
+							_archive.failed(&_archive, failedArgs);
+						}
+						if (success)
+						{
+							_archive.extracted(&_archive, extractedArgs);
+						}
+					}
+					IAlloc_Free(&_szAlloc, pOutBuffer);
+				}
+				File_Close(&archiveStream.file);
+				fileOpen = false;
+			}
+			catch (Poco::Exception& exc)
+			{
+				if (fileOpen) File_Close(&archiveStream.file);
+				_impl.taskFailed(exc.displayText());
+			}
+			catch (...)
+			{
+				if (fileOpen) File_Close(&archiveStream.file);
+				_impl.taskFailed("unknown exception");
+			}
+			_impl.taskFinished();
+		}
+
+	private:
+		ArchiveImpl& _impl;
+		Archive& _archive;
+		FolderWork& _work;
+		std::string _destPath;
+	};
+	friend class ExtractTask;
+
+	Poco::Path buildExtractedPath(const ArchiveEntry& entry, const std::string& destPath)
 	{
 		Poco::Path basePath;
 		if (destPath.empty())
@@ -91,19 +334,25 @@ public:
 		Poco::Path extractedPath(basePath);
 		extractedPath.append(entryPath);
 		extractedPath.makeAbsolute();
-		
+		return extractedPath;
+	}
+
+	std::string extract(const ArchiveEntry& entry, const std::string& destPath, ILookInStream* pStream, Poco::UInt32& blockIndex, Byte*& pOutBuffer, std::size_t& outBufferSize)
+		/// Extracts a single entry, reading from the given stream. The
+		/// decoded block stays cached in pOutBuffer for further entries
+		/// from the same block; the caller releases it with IAlloc_Free().
+	{
+		Poco::Path extractedPath = buildExtractedPath(entry, destPath);
+
 		if (entry.isFile())
-		{	
-			Poco::UInt32 blockIndex = 0;
-			Byte* pOutBuffer = 0;
-			std::size_t outBufferSize = 0;
+		{
 			std::size_t offset = 0;
 			std::size_t extractedSize = 0;
 			int err = SzArEx_Extract(
-				&_db, 
-				&_lookStream.s, 
-				entry.index(), 
-				&blockIndex, 
+				&_db,
+				pStream,
+				entry.index(),
+				&blockIndex,
 				&pOutBuffer,
 				&outBufferSize,
 				&offset,
@@ -112,23 +361,14 @@ public:
 				&_szAllocTemp);
 			if (err == SZ_OK)
 			{
-				try
-				{
-					poco_assert (extractedSize == entry.size());
-				
-					Poco::Path parent = extractedPath.parent();
-					Poco::File dir(parent.toString());
-					dir.createDirectories();
-
-					Poco::FileOutputStream ostr(extractedPath.toString());
-					ostr.write(reinterpret_cast<const char*>(pOutBuffer) + offset, extractedSize);
-					IAlloc_Free(&_szAlloc, pOutBuffer);
-				}
-				catch (...)
-				{
-					IAlloc_Free(&_szAlloc, pOutBuffer);
-					throw;
-				}
+				poco_assert (extractedSize == entry.size());
+
+				Poco::Path parent = extractedPath.parent();
+				Poco::File dir(parent.toString());
+				dir.createDirectories();
+
+				Poco::FileOutputStream ostr(extractedPath.toString());
+				ostr.write(reinterpret_cast<const char*>(pOutBuffer) + offset, extractedSize);
 			}
 			else
 			{
@@ -140,11 +380,23 @@ public:
 			Poco::File dir(extractedPath.toString());
 			dir.createDirectories();
 		}
-		
+
 		return extractedPath.toString();
 	}
-	
-protected:
+
+	void taskFinished()
+	{
+		Poco::FastMutex::ScopedLock lock(_taskMutex);
+		_activeTasks--;
+		_tasksDone.signal();
+	}
+
+	void taskFailed(const std::string& msg)
+	{
+		Poco::FastMutex::ScopedLock lock(_taskMutex);
+		if (_taskError.empty()) _taskError = msg;
+	}
+
 	void initialize()
 	{
 		FileInStream_CreateVTable(&_archiveStream);
@@ -290,6 +542,10 @@ private:
 	CFileInStream _archiveStream;
 	CLookToRead _lookStream;
 	CSzArEx _db;
+	Poco::FastMutex _taskMutex;
+	Poco::Condition _tasksDone;
+	int _activeTasks;
+	std::string _taskError;
 	static ISzAlloc _szAlloc;
 	static ISzAlloc _szAllocTemp;
 	static Poco::FastMutex _initMutex;
@@ -343,28 +599,16 @@ void Archive::extract(const std::string& destPath)
 {
 	for (ConstIterator it = begin(); it != end(); ++it)
 	{
-		ExtractedEventArgs extractedArgs;
-		extractedArgs.entry = *it;
-		bool success = true;
-		try
-		{
-			extractedArgs.extractedPath = _pImpl->extract(*it, destPath);
-		}
-		catch (Poco::Exception& exc)
-		{
-			success = false;
-			FailedEventArgs failedArgs;
-			failedArgs.entry = *it;
-			failedArgs.pException = &exc;
-			failed(this, failedArgs);
-		}
-		if (success)
-		{
-			extracted(this, extractedArgs);
-		}
+		_pImpl->extractAndNotify(*this, *it, destPath);
 	}
 }
 
+
+void Archive::extract(const std::string& destPath, Poco::ThreadPool& pool)
+{
+	_pImpl->extractAll(*this, destPath, pool);
+}
+
 	
 std::string Archive::extract(const ArchiveEntry& entry, const std::string& destPath)
 {
@@ -30,6 +30,9 @@ namespace Poco {
 namespace Util {
 
 
+class ConfigurationSnapshot;
+
+
 class Util_API AbstractConfiguration: public Poco::RefCountedObject
 	/// AbstractConfiguration is an abstract base class for different
 	/// kinds of configuration data, such as INI files, property files,
@@ -298,7 +301,20 @@ public:
 
 	AbstractConfiguration* createView(const std::string& prefix);
 		/// Creates a view (see ConfigurationView) into the configuration.
-	
+
+	ConfigurationSnapshot* createSnapshot() const;
+		/// Creates an immutable, flattened snapshot (see ConfigurationSnapshot)
+		/// of the configuration, containing all properties with references
+		/// to other properties (${<property>}) already expanded.
+		///
+		/// Unlike the getters of AbstractConfiguration, the snapshot's
+		/// getters do not lock a mutex and do not re-run property
+		/// expansion, so they can be called from hot paths at a very
+		/// high rate. The snapshot does not reflect later changes to
+		/// the configuration; use ConfigurationSnapshot::isCurrent()
+		/// or the property change events to find out when a fresh
+		/// snapshot should be created.
+
 	std::string expand(const std::string& value) const;
 		/// Replaces all occurrences of ${<property>} in value with the
 		/// value of the <property>. If <property> does not exist,
@@ -361,6 +377,7 @@ protected:
 private:
 	std::string internalExpand(const std::string& value) const;
 	std::string uncheckedExpand(const std::string& value) const;
+	void flatten(const std::string& key, ConfigurationSnapshot& snapshot) const;
 
 	AbstractConfiguration(const AbstractConfiguration&);
 	AbstractConfiguration& operator = (const AbstractConfiguration&);
@@ -368,10 +385,11 @@ private:
 	mutable int _depth;
 	bool        _eventsEnabled;
 	mutable Poco::Mutex _mutex;
-	
+
 	friend class LayeredConfiguration;
 	friend class ConfigurationView;
 	friend class ConfigurationMapper;
+	friend class ConfigurationSnapshot;
 };
 
 
@@ -24,6 +24,7 @@
 #include "Poco/Util/OptionSet.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Logger.h"
+#include "Poco/Mutex.h"
 #include "Poco/Path.h"
 #include "Poco/Timestamp.h"
 #include "Poco/Timespan.h"
@@ -132,6 +133,19 @@ public:
 		///     Application::instance().addSubsystem(new MySubsystem);
 		/// is okay.
 
+	void addSubsystem(Subsystem* pSubsystem, bool lazy);
+		/// Adds a new subsystem to the application. The
+		/// application immediately takes ownership of it.
+		///
+		/// If lazy is true, the subsystem is not initialized during
+		/// application initialization, but deferred until it is first
+		/// accessed through getSubsystem(). This can be used to keep
+		/// subsystems that are expensive to initialize, but not always
+		/// needed, out of the application's startup time. Lazy
+		/// subsystems still take part in command line option handling
+		/// (defineOptions()), and are uninitialized like all other
+		/// subsystems, provided they have been initialized.
+
 	void init(int argc, char* argv[]);
 		/// Processes the application's command line arguments
 		/// and sets the application's properties (e.g.,
@@ -218,6 +232,10 @@ public:
 		/// Returns a reference to the subsystem of the class
 		/// given as template argument.
 		///
+		/// If the subsystem has been registered for lazy
+		/// initialization (see addSubsystem()) and has not been
+		/// initialized yet, it is initialized before it is returned.
+		///
 		/// Throws a NotFoundException if such a subsystem has
 		/// not been registered.
 
@@ -298,7 +316,14 @@ protected:
 	void initialize(Application& self);
 		/// Initializes the application and all registered subsystems.
 		/// Subsystems are always initialized in the exact same order
-		/// in which they have been registered.
+		/// in which they have been registered. Subsystems registered
+		/// for lazy initialization are skipped; they are initialized
+		/// when first accessed through getSubsystem().
+		///
+		/// The time spent initializing each subsystem is logged with
+		/// debug priority and stored, in milliseconds, in the
+		/// application.initTime.<subsystem name> configuration
+		/// property.
 		///
 		/// Overriding implementations must call the base class implementation.
 
@@ -373,11 +398,17 @@ private:
 	void processOptions();
 	bool findAppConfigFile(const std::string& appName, const std::string& extension, Poco::Path& path) const;
 	bool findAppConfigFile(const Path& basePath, const std::string& appName, const std::string& extension, Poco::Path& path) const;
+	void addConfigurationFile(const Poco::Path& confPath, int priority);
+	void initializeSubsystem(Subsystem& subsystem, Application& self);
+	void ensureSubsystemInitialized(Subsystem* pSubsystem) const;
+	bool isPendingSubsystem(Subsystem* pSubsystem) const;
 
 	typedef Poco::AutoPtr<LayeredConfiguration> ConfigPtr;
 
 	ConfigPtr       _pConfig;
 	SubsystemVec    _subsystems;
+	mutable std::vector<Subsystem*> _pendingSubsystems;
+	mutable Poco::Mutex _subsystemMutex;
 	bool            _initialized;
 	std::string     _command;
 	ArgVec          _argv;
@@ -410,7 +441,11 @@ template <class C> C& Application::getSubsystem() const
 	{
 		const Subsystem* pSS(it->get());
 		const C* pC = dynamic_cast<const C*>(pSS);
-		if (pC) return *const_cast<C*>(pC);
+		if (pC)
+		{
+			ensureSubsystemInitialized(const_cast<Subsystem*>(pSS));
+			return *const_cast<C*>(pC);
+		}
 	}
 	throw Poco::NotFoundException("The subsystem has not been registered", typeid(C).name());
 }
@@ -0,0 +1,195 @@
+//
+// ConfigurationSnapshot.h
+//
+// Library: Util
+// Package: Configuration
+// Module:  ConfigurationSnapshot
+//
+// Definition of the ConfigurationSnapshot class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Util_ConfigurationSnapshot_INCLUDED
+#define Util_ConfigurationSnapshot_INCLUDED
+
+
+#include "Poco/Util/Util.h"
+#include "Poco/Util/AbstractConfiguration.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/AtomicCounter.h"
+#include <map>
+
+
+namespace Poco {
+namespace Util {
+
+
+class Util_API ConfigurationSnapshot: public Poco::RefCountedObject
+	/// An immutable, flattened snapshot of an AbstractConfiguration.
+	///
+	/// A snapshot contains every property of the configuration it was
+	/// created from, with all references to other properties
+	/// (${<property>}) already expanded, stored in a single
+	/// key-to-value map. Since a snapshot never changes once it has
+	/// been created, its getters neither lock a mutex nor re-run
+	/// property expansion and can be called concurrently from any
+	/// number of threads. This makes snapshots suitable for hot paths
+	/// that read configuration properties at a very high rate, where
+	/// the synchronization in AbstractConfiguration's getters would
+	/// become a bottleneck.
+	///
+	/// Snapshots are created with AbstractConfiguration::createSnapshot().
+	/// A snapshot does not reflect changes made to the configuration
+	/// after its creation. The snapshot registers for the
+	/// configuration's property change events; once a property has
+	/// been changed or removed, isCurrent() returns false and a fresh
+	/// snapshot should be created. Note that changes that bypass
+	/// the configuration's events (such as modifying a layer of a
+	/// LayeredConfiguration directly, or reloading an underlying
+	/// file) are not detected by isCurrent().
+	///
+	/// The semantics of the typed getters are the same as for the
+	/// corresponding AbstractConfiguration getters. Properties whose
+	/// expansion would raise a CircularReferenceException are stored
+	/// with their raw, unexpanded value.
+{
+public:
+	typedef Poco::AutoPtr<ConfigurationSnapshot> Ptr;
+	typedef AbstractConfiguration::Keys Keys;
+
+	bool has(const std::string& key) const;
+		/// Returns true iff the property with the given key exists.
+
+	std::string getString(const std::string& key) const;
+		/// Returns the string value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+
+	std::string getString(const std::string& key, const std::string& defaultValue) const;
+		/// If a property with the given key exists, returns the property's string value,
+		/// otherwise returns the given default value.
+
+	int getInt(const std::string& key) const;
+		/// Returns the int value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to an int.
+		/// Numbers starting with 0x are treated as hexadecimal.
+
+	int getInt(const std::string& key, int defaultValue) const;
+		/// If a property with the given key exists, returns the property's int value,
+		/// otherwise returns the given default value.
+
+	unsigned int getUInt(const std::string& key) const;
+		/// Returns the unsigned int value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to an unsigned int.
+		/// Numbers starting with 0x are treated as hexadecimal.
+
+	unsigned int getUInt(const std::string& key, unsigned int defaultValue) const;
+		/// If a property with the given key exists, returns the property's unsigned int
+		/// value, otherwise returns the given default value.
+
+#if defined(POCO_HAVE_INT64)
+
+	Int64 getInt64(const std::string& key) const;
+		/// Returns the Int64 value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to an Int64.
+		/// Numbers starting with 0x are treated as hexadecimal.
+
+	Int64 getInt64(const std::string& key, Int64 defaultValue) const;
+		/// If a property with the given key exists, returns the property's Int64 value,
+		/// otherwise returns the given default value.
+
+	UInt64 getUInt64(const std::string& key) const;
+		/// Returns the UInt64 value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to an UInt64.
+		/// Numbers starting with 0x are treated as hexadecimal.
+
+	UInt64 getUInt64(const std::string& key, UInt64 defaultValue) const;
+		/// If a property with the given key exists, returns the property's UInt64
+		/// value, otherwise returns the given default value.
+
+#endif // defined(POCO_HAVE_INT64)
+
+	double getDouble(const std::string& key) const;
+		/// Returns the double value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to a double.
+
+	double getDouble(const std::string& key, double defaultValue) const;
+		/// If a property with the given key exists, returns the property's double value,
+		/// otherwise returns the given default value.
+
+	bool getBool(const std::string& key) const;
+		/// Returns the boolean value of the property with the given name.
+		/// Throws a NotFoundException if the key does not exist.
+		/// Throws a SyntaxException if the property can not be converted
+		/// to a boolean.
+
+	bool getBool(const std::string& key, bool defaultValue) const;
+		/// If a property with the given key exists, returns the property's boolean value,
+		/// otherwise returns the given default value.
+
+	void keys(Keys& range) const;
+		/// Returns in range the fully qualified names of all properties
+		/// contained in the snapshot.
+
+	bool isCurrent() const;
+		/// Returns true iff no property of the configuration this
+		/// snapshot was created from has been changed or removed
+		/// since the snapshot was created.
+
+protected:
+	ConfigurationSnapshot(AbstractConfiguration* pConfig);
+		/// Creates the ConfigurationSnapshot for the given configuration
+		/// and registers for its property change events.
+
+	~ConfigurationSnapshot();
+		/// Destroys the ConfigurationSnapshot.
+
+	void onPropertyChanged(const void* sender, const AbstractConfiguration::KeyValue& kv);
+	void onPropertyRemoved(const void* sender, const std::string& key);
+
+private:
+	typedef std::map<std::string, std::string> StringMap;
+
+	ConfigurationSnapshot();
+	ConfigurationSnapshot(const ConfigurationSnapshot&);
+	ConfigurationSnapshot& operator = (const ConfigurationSnapshot&);
+
+	const std::string& value(const std::string& key) const;
+		/// Returns a reference to the value of the property with the
+		/// given key. Throws a NotFoundException if the key does not exist.
+
+	Poco::AutoPtr<AbstractConfiguration> _pConfig;
+	StringMap           _map;
+	Poco::AtomicCounter _changes;
+
+	friend class AbstractConfiguration;
+};
+
+
+//
+// inlines
+//
+inline bool ConfigurationSnapshot::isCurrent() const
+{
+	return _changes.value() == 0;
+}
+
+
+} } // namespace Poco::Util
+
+
+#endif // Util_ConfigurationSnapshot_INCLUDED
@@ -27,6 +27,7 @@
 #include "Poco/Util/AbstractConfiguration.h"
 #include "Poco/JSON/Object.h"
 #include <istream>
+#include <map>
 
 
 namespace Poco {
@@ -94,6 +95,22 @@ public:
 		/// Loads an empty object containing only a root object with the given name.
 
 
+	void compile();
+		/// Compiles the configuration into a flat property table and
+		/// discards the underlying JSON object.
+		///
+		/// Every subsequent property lookup is a single map lookup
+		/// instead of a traversal of the JSON object tree, and the
+		/// memory held by the parsed document is released. This is
+		/// useful for large configuration files that are read often
+		/// but never modified.
+		///
+		/// After compiling, the configuration is read-only: setting
+		/// or removing properties, as well as save(), will throw a
+		/// Poco::InvalidAccessException. Calling load() or loadEmpty()
+		/// makes the configuration modifiable again.
+
+
 	void save(std::ostream& ostr, unsigned int indent = 2) const;
 		/// Saves the configuration to the given stream
 
@@ -136,7 +153,18 @@ private:
 	void setValue(const std::string& key, const Poco::DynamicAny& value);
 
 
+	void flatten(const std::string& key, const JSON::Object::Ptr& object);
+
+
+	void flattenValue(const std::string& key, const Poco::DynamicAny& value);
+
+
+	typedef std::map<std::string, std::string> StringMap;
+
+
  	JSON::Object::Ptr _object;
+	StringMap _flat;
+	bool _compiled;
 };
 
 
@@ -21,6 +21,7 @@
 #include "Poco/Util/Util.h"
 #include "Poco/Util/AbstractConfiguration.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/HashMap.h"
 #include <list>
 
 
@@ -45,6 +46,18 @@ class Util_API LayeredConfiguration: public AbstractConfiguration
 	/// with lower priority values coming before higher priority values.
 	///
 	/// If no priority is specified, a priority of 0 is assumed.
+	///
+	/// To avoid walking all layers on every property lookup, the
+	/// LayeredConfiguration maintains a merged hash index over the
+	/// layers, filled lazily as properties (including nonexistent
+	/// ones) are looked up, so that repeated lookups cost a single
+	/// probe regardless of the number of layers. The index registers
+	/// for the property change events of every added configuration
+	/// and discards the affected entry when a property is changed or
+	/// removed, and is discarded entirely when a layer is added or
+	/// removed. Note that changes that bypass a layer's events (such
+	/// as reloading an underlying file with events disabled) are not
+	/// detected.
 {
 public:
 	typedef Poco::AutoPtr<AbstractConfiguration> ConfigPtr;
@@ -165,7 +178,10 @@ protected:
 	int lowest() const;
 	int highest() const;
 	void insert(const ConfigItem& item);
-	
+
+	void onPropertyChanged(const void* sender, const KeyValue& kv);
+	void onPropertyRemoved(const void* sender, const std::string& key);
+
 	~LayeredConfiguration();
 
 private:
@@ -173,8 +189,23 @@ private:
 	LayeredConfiguration& operator = (const LayeredConfiguration&);
 
 	typedef std::list<ConfigItem> ConfigList;
-	
+
+	struct CachedValue
+		/// A merged lookup result; found is false for
+		/// properties that exist in no layer.
+	{
+		std::string value;
+		bool        found;
+	};
+	typedef Poco::HashMap<std::string, CachedValue> ValueCache;
+
+	void subscribe(AbstractConfiguration* pConfig);
+	void unsubscribe(AbstractConfiguration* pConfig);
+	void discardCache();
+
 	ConfigList _configs;
+	mutable ValueCache      _cache;
+	mutable Poco::FastMutex _cacheMutex;
 };
 
 
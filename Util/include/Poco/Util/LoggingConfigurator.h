@@ -119,6 +119,24 @@ public:
 		/// A ConfigurationView can be used to pass only
 		/// a part of a larger configuration.
 
+	void reconfigure(AbstractConfiguration* pConfig);
+		/// Reconfigures the logging subsystem based on the given
+		/// configuration, without losing messages buffered by the
+		/// channels being replaced.
+		///
+		/// The new formatters and channels are created and fully
+		/// configured before any logger is switched over to them.
+		/// The channels being replaced (those registered under a
+		/// name appearing in the configuration, as well as those
+		/// attached to the loggers being reconfigured) are kept
+		/// alive until the loggers have been switched, and are then
+		/// closed, giving channels that buffer messages (such as
+		/// AsyncChannel) the opportunity to flush them. Loggers not
+		/// covered by the configuration are left untouched.
+		///
+		/// This is intended for reloading the logging configuration
+		/// in a running application (e.g., in response to a signal).
+
 private:
 	void configureFormatters(AbstractConfiguration* pConfig);
 	void configureChannels(AbstractConfiguration* pConfig);
@@ -45,13 +45,34 @@ class Util_API Timer: protected Poco::Runnable
 	/// the java.util.Timer class from Java 1.3.
 {
 public:
+	enum QueueType
+	{
+		QUEUE_TIMED = 0,
+			/// Tasks are kept in a Poco::TimedNotificationQueue,
+			/// ordered by timestamp (O(log n) scheduling).
+		QUEUE_TIMING_WHEEL = 1
+			/// Tasks are kept in a Poco::TimingWheelNotificationQueue
+			/// (O(1) scheduling with millisecond granularity);
+			/// recommended for very large numbers of outstanding
+			/// tasks, such as connection timeouts.
+	};
+
 	Timer();
 		/// Creates the Timer.
-	
+
 	explicit Timer(Poco::Thread::Priority priority);
 		/// Creates the Timer, using a timer thread with
 		/// the given priority.
-	
+
+	explicit Timer(QueueType queueType);
+		/// Creates the Timer, using the given schedule
+		/// queue implementation.
+
+	Timer(Poco::Thread::Priority priority, QueueType queueType);
+		/// Creates the Timer, using a timer thread with
+		/// the given priority and the given schedule
+		/// queue implementation.
+
 	~Timer();
 		/// Destroys the Timer, cancelling all pending tasks.
 		
@@ -157,8 +178,10 @@ protected:
 private:
 	Timer(const Timer&);
 	Timer& operator = (const Timer&);
-	
-	Poco::TimedNotificationQueue _queue;
+
+	static Poco::TimedNotificationQueue* createQueue(QueueType queueType);
+
+	Poco::TimedNotificationQueue* _pQueue;
 	Poco::Thread _thread;
 };
 
@@ -30,6 +30,7 @@
 #include "Poco/DOM/DOMWriter.h"
 #include "Poco/SAX/InputSource.h"
 #include <istream>
+#include <map>
 
 
 namespace Poco {
@@ -157,7 +158,29 @@ public:
 	void loadEmpty(const std::string& rootElementName);
 		/// Loads an empty XML document containing only the
 		/// root element with the given name.
-		
+
+	void compile();
+		/// Compiles the configuration into a flat property table and
+		/// discards the underlying XML document.
+		///
+		/// Every subsequent property lookup is a single map lookup
+		/// instead of a DOM traversal, and the memory held by the
+		/// document is released. This is useful for large configuration
+		/// files that are read often but never modified.
+		///
+		/// The table contains the values of all elements without child
+		/// elements, under the keys produced by keys(), as well as all
+		/// attribute values, under <element key>[@<attribute>] keys.
+		/// Values of elements having child elements, the [@<attribute>=<value>]
+		/// predicate syntax and redundant [0] indexes are not supported
+		/// on a compiled configuration.
+		///
+		/// After compiling, the configuration is read-only: setting
+		/// or removing properties, as well as save(), will throw a
+		/// Poco::InvalidAccessException. Calling load() or loadEmpty()
+		/// makes the configuration modifiable again.
+
+
 	void save(const std::string& path) const;
 		/// Writes the XML document containing the configuration data
 		/// to the file given by path.
@@ -193,10 +216,15 @@ private:
 	static Poco::XML::Node* findElement(int index, Poco::XML::Node* pNode, bool create);
 	static Poco::XML::Node* findElement(const std::string& attr, const std::string& value, Poco::XML::Node* pNode);
 	static Poco::XML::Node* findAttribute(const std::string& name, Poco::XML::Node* pNode, bool create);
+	void flatten(const std::string& key, const Poco::XML::Node* pNode);
+
+	typedef std::map<std::string, std::string> StringMap;
 
 	Poco::XML::AutoPtr<Poco::XML::Node>     _pRoot;
 	Poco::XML::AutoPtr<Poco::XML::Document> _pDocument;
 	char _delim;
+	StringMap _flat;
+	bool _compiled;
 };
 
 
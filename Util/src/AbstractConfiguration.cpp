@@ -14,6 +14,7 @@
 
 #include "Poco/Util/AbstractConfiguration.h"
 #include "Poco/Util/ConfigurationView.h"
+#include "Poco/Util/ConfigurationSnapshot.h"
 #include "Poco/Exception.h"
 #include "Poco/NumberParser.h"
 #include "Poco/NumberFormatter.h"
@@ -348,6 +349,52 @@ AbstractConfiguration* AbstractConfiguration::createView(const std::string& pref
 }
 
 
+ConfigurationSnapshot* AbstractConfiguration::createSnapshot() const
+{
+	Mutex::ScopedLock lock(_mutex);
+
+	ConfigurationSnapshot* pSnapshot = new ConfigurationSnapshot(const_cast<AbstractConfiguration*>(this));
+	try
+	{
+		flatten(std::string(), *pSnapshot);
+	}
+	catch (...)
+	{
+		pSnapshot->release();
+		throw;
+	}
+	return pSnapshot;
+}
+
+
+void AbstractConfiguration::flatten(const std::string& key, ConfigurationSnapshot& snapshot) const
+{
+	std::string value;
+	if (!key.empty() && getRaw(key, value))
+	{
+		try
+		{
+			snapshot._map[key] = internalExpand(value);
+		}
+		catch (CircularReferenceException&)
+		{
+			// A circular reference only affects the offending property,
+			// which is stored unexpanded, not the whole snapshot.
+			snapshot._map[key] = value;
+		}
+	}
+	Keys range;
+	enumerate(key, range);
+	for (Keys::const_iterator it = range.begin(); it != range.end(); ++it)
+	{
+		std::string fullKey = key;
+		if (!fullKey.empty()) fullKey += '.';
+		fullKey += *it;
+		flatten(fullKey, snapshot);
+	}
+}
+
+
 namespace
 {
 	class AutoCounter
@@ -30,11 +30,13 @@
 #include "Poco/Environment.h"
 #include "Poco/Exception.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/Stopwatch.h"
 #include "Poco/File.h"
 #include "Poco/Path.h"
 #include "Poco/String.h"
 #include "Poco/ConsoleChannel.h"
 #include "Poco/AutoPtr.h"
+#include <algorithm>
 #if defined(POCO_OS_FAMILY_WINDOWS)
 #include "Poco/UnWindows.h"
 #endif
@@ -127,6 +129,19 @@ void Application::addSubsystem(Subsystem* pSubsystem)
 }
 
 
+void Application::addSubsystem(Subsystem* pSubsystem, bool lazy)
+{
+	poco_check_ptr (pSubsystem);
+
+	_subsystems.push_back(pSubsystem);
+	if (lazy)
+	{
+		Poco::Mutex::ScopedLock lock(_subsystemMutex);
+		_pendingSubsystems.push_back(pSubsystem);
+	}
+}
+
+
 void Application::init(int argc, char* argv[])
 {
 	setArgs(argc, argv);
@@ -180,21 +195,30 @@ const char* Application::name() const
 
 void Application::initialize(Application& self)
 {
+	Poco::Stopwatch total;
+	total.start();
 	for (SubsystemVec::iterator it = _subsystems.begin(); it != _subsystems.end(); ++it)
 	{
-		_pLogger->debug(std::string("Initializing subsystem: ") + (*it)->name());
-		(*it)->initialize(self);
+		if (isPendingSubsystem(it->get()))
+		{
+			_pLogger->debug(std::string("Deferring initialization of lazy subsystem: ") + (*it)->name());
+			continue;
+		}
+		initializeSubsystem(**it, self);
 	}
+	total.stop();
+	_pConfig->setInt("application.initTime", static_cast<int>(total.elapsed()/1000));
 	_initialized = true;
 }
 
-	
+
 void Application::uninitialize()
 {
 	if (_initialized)
 	{
 		for (SubsystemVec::reverse_iterator it = _subsystems.rbegin(); it != _subsystems.rend(); ++it)
 		{
+			if (isPendingSubsystem(it->get())) continue;
 			_pLogger->debug(std::string("Uninitializing subsystem: ") + (*it)->name());
 			(*it)->uninitialize();
 		}
@@ -207,12 +231,51 @@ void Application::reinitialize(Application& self)
 {
 	for (SubsystemVec::iterator it = _subsystems.begin(); it != _subsystems.end(); ++it)
 	{
+		if (isPendingSubsystem(it->get())) continue;
 		_pLogger->debug(std::string("Re-initializing subsystem: ") + (*it)->name());
 		(*it)->reinitialize(self);
 	}
 }
 
 
+void Application::initializeSubsystem(Subsystem& subsystem, Application& self)
+{
+	_pLogger->debug(std::string("Initializing subsystem: ") + subsystem.name());
+	Poco::Stopwatch sw;
+	sw.start();
+	subsystem.initialize(self);
+	sw.stop();
+	int ms = static_cast<int>(sw.elapsed()/1000);
+	_pConfig->setInt(std::string("application.initTime.") + subsystem.name(), ms);
+	_pLogger->debug(std::string("Initialized subsystem ") + subsystem.name() + " in " + NumberFormatter::format(ms) + " ms");
+}
+
+
+void Application::ensureSubsystemInitialized(Subsystem* pSubsystem) const
+{
+	Poco::Mutex::ScopedLock lock(_subsystemMutex);
+
+	std::vector<Subsystem*>::iterator it = std::find(_pendingSubsystems.begin(), _pendingSubsystems.end(), pSubsystem);
+	if (it != _pendingSubsystems.end() && _initialized)
+	{
+		// Remove the subsystem from the pending list before initializing it,
+		// so that a getSubsystem() call from within its initialize() does
+		// not initialize it recursively (_subsystemMutex is recursive).
+		_pendingSubsystems.erase(it);
+		Application& self = *const_cast<Application*>(this);
+		self.initializeSubsystem(*pSubsystem, self);
+	}
+}
+
+
+bool Application::isPendingSubsystem(Subsystem* pSubsystem) const
+{
+	Poco::Mutex::ScopedLock lock(_subsystemMutex);
+
+	return std::find(_pendingSubsystems.begin(), _pendingSubsystems.end(), pSubsystem) != _pendingSubsystems.end();
+}
+
+
 void Application::setUnixOptions(bool flag)
 {
 	_unixOptions = flag;
@@ -227,27 +290,27 @@ int Application::loadConfiguration(int priority)
 	Path confPath;
 	if (findAppConfigFile(appPath.getBaseName(), "properties", confPath))
 	{
-		_pConfig->add(new PropertyFileConfiguration(confPath.toString()), priority, false, false);
+		addConfigurationFile(confPath, priority);
 		++n;
 	}
 #ifndef POCO_UTIL_NO_INIFILECONFIGURATION
 	if (findAppConfigFile(appPath.getBaseName(), "ini", confPath))
 	{
-		_pConfig->add(new IniFileConfiguration(confPath.toString()), priority, false, false);
+		addConfigurationFile(confPath, priority);
 		++n;
 	}
 #endif
 #ifndef POCO_UTIL_NO_JSONCONFIGURATION
 	if (findAppConfigFile(appPath.getBaseName(), "json", confPath))
 	{
-		_pConfig->add(new JSONConfiguration(confPath.toString()), priority, false, false);
+		addConfigurationFile(confPath, priority);
 		++n;
 	}
 #endif
 #ifndef POCO_UTIL_NO_XMLCONFIGURATION
 	if (findAppConfigFile(appPath.getBaseName(), "xml", confPath))
 	{
-		_pConfig->add(new XMLConfiguration(confPath.toString()), priority, false, false);
+		addConfigurationFile(confPath, priority);
 		++n;
 	}
 #endif
@@ -264,44 +327,49 @@ int Application::loadConfiguration(int priority)
 
 void Application::loadConfiguration(const std::string& path, int priority)
 {
-	int n = 0;
 	Path confPath(path);
+	addConfigurationFile(confPath, priority);
+
+	if (!_pConfig->has("application.configDir"))
+	{
+		if (!confPath.isAbsolute())
+			_pConfig->setString("application.configDir", confPath.absolute().parent().toString());
+		else
+			_pConfig->setString("application.configDir", confPath.parent().toString());
+	}
+}
+
+
+void Application::addConfigurationFile(const Poco::Path& confPath, int priority)
+{
 	std::string ext = confPath.getExtension();
+	Poco::Stopwatch sw;
+	sw.start();
 	if (icompare(ext, "properties") == 0)
 	{
 		_pConfig->add(new PropertyFileConfiguration(confPath.toString()), priority, false, false);
-		++n;
 	}
 #ifndef POCO_UTIL_NO_INIFILECONFIGURATION
 	else if (icompare(ext, "ini") == 0)
 	{
 		_pConfig->add(new IniFileConfiguration(confPath.toString()), priority, false, false);
-		++n;
 	}
 #endif
 #ifndef POCO_UTIL_NO_JSONCONFIGURATION
 	else if (icompare(ext, "json") == 0)
 	{
 		_pConfig->add(new JSONConfiguration(confPath.toString()), priority, false, false);
-		++n;
 	}
 #endif
 #ifndef POCO_UTIL_NO_XMLCONFIGURATION
 	else if (icompare(ext, "xml") == 0)
 	{
 		_pConfig->add(new XMLConfiguration(confPath.toString()), priority, false, false);
-		++n;
 	}
 #endif
 	else throw Poco::InvalidArgumentException("Unsupported configuration file type", ext);
-
-	if (n > 0 && !_pConfig->has("application.configDir"))
-	{
-		if (!confPath.isAbsolute())
-			_pConfig->setString("application.configDir", confPath.absolute().parent().toString());
-		else
-			_pConfig->setString("application.configDir", confPath.parent().toString());
-	}
+	sw.stop();
+	_pLogger->debug("Loaded configuration file " + confPath.toString() + " in " + NumberFormatter::format(sw.elapsed()/1000) + " ms");
 }
 
 
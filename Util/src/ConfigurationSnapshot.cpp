@@ -0,0 +1,209 @@
+//
+// ConfigurationSnapshot.cpp
+//
+// Library: Util
+// Package: Configuration
+// Module:  ConfigurationSnapshot
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Util/ConfigurationSnapshot.h"
+#include "Poco/Delegate.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Exception.h"
+
+
+using Poco::NotFoundException;
+
+
+namespace Poco {
+namespace Util {
+
+
+ConfigurationSnapshot::ConfigurationSnapshot(AbstractConfiguration* pConfig):
+	_pConfig(pConfig, true)
+{
+	poco_check_ptr (pConfig);
+
+	_pConfig->propertyChanged += Poco::delegate(this, &ConfigurationSnapshot::onPropertyChanged);
+	_pConfig->propertyRemoved += Poco::delegate(this, &ConfigurationSnapshot::onPropertyRemoved);
+}
+
+
+ConfigurationSnapshot::~ConfigurationSnapshot()
+{
+	try
+	{
+		_pConfig->propertyChanged -= Poco::delegate(this, &ConfigurationSnapshot::onPropertyChanged);
+		_pConfig->propertyRemoved -= Poco::delegate(this, &ConfigurationSnapshot::onPropertyRemoved);
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+bool ConfigurationSnapshot::has(const std::string& key) const
+{
+	return _map.find(key) != _map.end();
+}
+
+
+std::string ConfigurationSnapshot::getString(const std::string& key) const
+{
+	return value(key);
+}
+
+
+std::string ConfigurationSnapshot::getString(const std::string& key, const std::string& defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return it->second;
+	else
+		return defaultValue;
+}
+
+
+int ConfigurationSnapshot::getInt(const std::string& key) const
+{
+	return AbstractConfiguration::parseInt(value(key));
+}
+
+
+int ConfigurationSnapshot::getInt(const std::string& key, int defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return AbstractConfiguration::parseInt(it->second);
+	else
+		return defaultValue;
+}
+
+
+unsigned int ConfigurationSnapshot::getUInt(const std::string& key) const
+{
+	return AbstractConfiguration::parseUInt(value(key));
+}
+
+
+unsigned int ConfigurationSnapshot::getUInt(const std::string& key, unsigned int defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return AbstractConfiguration::parseUInt(it->second);
+	else
+		return defaultValue;
+}
+
+
+#if defined(POCO_HAVE_INT64)
+
+
+Int64 ConfigurationSnapshot::getInt64(const std::string& key) const
+{
+	return AbstractConfiguration::parseInt64(value(key));
+}
+
+
+Int64 ConfigurationSnapshot::getInt64(const std::string& key, Int64 defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return AbstractConfiguration::parseInt64(it->second);
+	else
+		return defaultValue;
+}
+
+
+UInt64 ConfigurationSnapshot::getUInt64(const std::string& key) const
+{
+	return AbstractConfiguration::parseUInt64(value(key));
+}
+
+
+UInt64 ConfigurationSnapshot::getUInt64(const std::string& key, UInt64 defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return AbstractConfiguration::parseUInt64(it->second);
+	else
+		return defaultValue;
+}
+
+
+#endif // defined(POCO_HAVE_INT64)
+
+
+double ConfigurationSnapshot::getDouble(const std::string& key) const
+{
+	return Poco::NumberParser::parseFloat(value(key));
+}
+
+
+double ConfigurationSnapshot::getDouble(const std::string& key, double defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return Poco::NumberParser::parseFloat(it->second);
+	else
+		return defaultValue;
+}
+
+
+bool ConfigurationSnapshot::getBool(const std::string& key) const
+{
+	return AbstractConfiguration::parseBool(value(key));
+}
+
+
+bool ConfigurationSnapshot::getBool(const std::string& key, bool defaultValue) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return AbstractConfiguration::parseBool(it->second);
+	else
+		return defaultValue;
+}
+
+
+void ConfigurationSnapshot::keys(Keys& range) const
+{
+	range.clear();
+	range.reserve(_map.size());
+	for (StringMap::const_iterator it = _map.begin(); it != _map.end(); ++it)
+	{
+		range.push_back(it->first);
+	}
+}
+
+
+void ConfigurationSnapshot::onPropertyChanged(const void* sender, const AbstractConfiguration::KeyValue& kv)
+{
+	++_changes;
+}
+
+
+void ConfigurationSnapshot::onPropertyRemoved(const void* sender, const std::string& key)
+{
+	++_changes;
+}
+
+
+const std::string& ConfigurationSnapshot::value(const std::string& key) const
+{
+	StringMap::const_iterator it = _map.find(key);
+	if (it != _map.end())
+		return it->second;
+	else
+		throw NotFoundException(key);
+}
+
+
+} } // namespace Poco::Util
@@ -24,31 +24,34 @@
 #include "Poco/JSON/Parser.h"
 #include "Poco/JSON/Query.h"
 #include "Poco/RegularExpression.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
+#include "Poco/Exception.h"
+#include <set>
 
 
 namespace Poco {
 namespace Util {
 
 
-JSONConfiguration::JSONConfiguration() : _object(new JSON::Object())
+JSONConfiguration::JSONConfiguration() : _object(new JSON::Object()), _compiled(false)
 {
 }
 
 
-JSONConfiguration::JSONConfiguration(const std::string& path)
+JSONConfiguration::JSONConfiguration(const std::string& path) : _compiled(false)
 {
 	load(path);
 }
 
 
-JSONConfiguration::JSONConfiguration(std::istream& istr)
+JSONConfiguration::JSONConfiguration(std::istream& istr) : _compiled(false)
 {
 	load(istr);
 }
 
 
-JSONConfiguration::JSONConfiguration(const JSON::Object::Ptr& object) : _object(object)
+JSONConfiguration::JSONConfiguration(const JSON::Object::Ptr& object) : _object(object), _compiled(false)
 {
 }
 
@@ -74,6 +77,8 @@ void JSONConfiguration::load(std::istream& istr)
 	{
 		_object = result.extract<JSON::Object::Ptr>();
 	}
+	_flat.clear();
+	_compiled = false;
 }
 
 
@@ -82,11 +87,68 @@ void JSONConfiguration::loadEmpty(const std::string& root)
 	_object = new JSON::Object();
 	JSON::Object::Ptr rootObject = new JSON::Object();
 	_object->set(root, rootObject);
+	_flat.clear();
+	_compiled = false;
+}
+
+
+void JSONConfiguration::compile()
+{
+	_flat.clear();
+	if ( ! _object.isNull() )
+	{
+		flatten(std::string(), _object);
+	}
+	_object = 0;
+	_compiled = true;
+}
+
+
+void JSONConfiguration::flatten(const std::string& key, const JSON::Object::Ptr& object)
+{
+	std::vector<std::string> names;
+	object->getNames(names);
+	for(std::vector<std::string>::const_iterator it = names.begin(); it != names.end(); ++it)
+	{
+		std::string fullKey = key.empty() ? *it : key + '.' + *it;
+		flattenValue(fullKey, object->get(*it));
+	}
+}
+
+
+void JSONConfiguration::flattenValue(const std::string& key, const Poco::DynamicAny& value)
+{
+	if ( value.type() == typeid(JSON::Object::Ptr) )
+	{
+		flatten(key, value.extract<JSON::Object::Ptr>());
+	}
+	else if ( value.type() == typeid(JSON::Array::Ptr) )
+	{
+		JSON::Array::Ptr arr = value.extract<JSON::Array::Ptr>();
+		for(std::size_t i = 0; i < arr->size(); ++i)
+		{
+			flattenValue(key + '[' + NumberFormatter::format(static_cast<int>(i)) + ']', arr->get(static_cast<unsigned int>(i)));
+		}
+	}
+	else if ( ! value.isEmpty() ) // null values are not found in the tree either
+	{
+		_flat[key] = value.convert<std::string>();
+	}
 }
 
 
 bool JSONConfiguration::getRaw(const std::string & key, std::string & value) const
 {
+	if ( _compiled )
+	{
+		StringMap::const_iterator it = _flat.find(key);
+		if ( it != _flat.end() )
+		{
+			value = it->second;
+			return true;
+		}
+		return false;
+	}
 	JSON::Query query(_object);
 	Poco::DynamicAny result = query.find(key);
 	if ( ! result.isEmpty() )
@@ -241,6 +303,7 @@ JSON::Object::Ptr JSONConfiguration::findStart(const std::string& key, std::stri
 
 void JSONConfiguration::setValue(const std::string& key, const Poco::DynamicAny& value)
 {
+	if ( _compiled ) throw Poco::InvalidAccessException("Cannot modify a compiled JSONConfiguration", key);
 
 	std::string sValue;
 	
@@ -333,6 +396,28 @@ void JSONConfiguration::setDouble(const std::string& key, double value)
 
 void JSONConfiguration::enumerate(const std::string& key, Keys& range) const
 {
+	if ( _compiled )
+	{
+		std::string prefix = key;
+		if ( ! prefix.empty() ) prefix += '.';
+		std::set<std::string> seen;
+		for(StringMap::const_iterator it = _flat.begin(); it != _flat.end(); ++it)
+		{
+			const std::string& fullKey = it->first;
+			if ( fullKey.size() > prefix.size() && fullKey.compare(0, prefix.size(), prefix) == 0 )
+			{
+				std::string child = fullKey.substr(prefix.size());
+				std::string::size_type pos = child.find_first_of(".[");
+				if ( pos != std::string::npos ) child.resize(pos);
+				if ( ! child.empty() && seen.find(child) == seen.end() )
+				{
+					range.push_back(child);
+					seen.insert(child);
+				}
+			}
+		}
+		return;
+	}
 	JSON::Query query(_object);
 	Poco::DynamicAny result = query.find(key);
 	if ( result.type() == typeid(JSON::Object::Ptr) )
@@ -345,6 +430,8 @@ void JSONConfiguration::enumerate(const std::string& key, Keys& range) const
 
 void JSONConfiguration::save(std::ostream& ostr, unsigned int indent) const
 {
+	if ( _compiled ) throw Poco::InvalidAccessException("Cannot save a compiled JSONConfiguration");
+
 	_object->stringify(ostr, indent);
 }
 
@@ -352,7 +439,8 @@ void JSONConfiguration::save(std::ostream& ostr, unsigned int indent) const
 void JSONConfiguration::removeRaw(const std::string& key)
 
 {
-	
+	if ( _compiled ) throw Poco::InvalidAccessException("Cannot modify a compiled JSONConfiguration", key);
+
 	std::string lastPart;
 	JSON::Object::Ptr parentObject = findStart(key, lastPart);
 	std::vector<int> indexes;
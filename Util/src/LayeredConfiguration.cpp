@@ -13,6 +13,7 @@
 
 
 #include "Poco/Util/LayeredConfiguration.h"
+#include "Poco/Delegate.h"
 #include "Poco/Exception.h"
 #include <set>
 
@@ -32,6 +33,17 @@ LayeredConfiguration::LayeredConfiguration()
 
 LayeredConfiguration::~LayeredConfiguration()
 {
+	try
+	{
+		for (ConfigList::iterator it = _configs.begin(); it != _configs.end(); ++it)
+		{
+			unsubscribe(it->pConfig);
+		}
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
 }
 
 
@@ -124,8 +136,10 @@ void LayeredConfiguration::add(AbstractConfiguration* pConfig, const std::string
 	ConfigList::iterator it = _configs.begin();
 	while (it != _configs.end() && it->priority < priority)
 		++it;
-		
+
 	_configs.insert(it, item);
+	subscribe(pConfig);
+	discardCache();
 }
 
 
@@ -135,7 +149,9 @@ void LayeredConfiguration::removeConfiguration(AbstractConfiguration* pConfig)
 	{
 		if (it->pConfig == pConfig)
 		{
+			unsubscribe(pConfig);
 			_configs.erase(it);
+			discardCache();
 			break;
 		}
 	}
@@ -157,12 +173,30 @@ LayeredConfiguration::ConfigPtr LayeredConfiguration::find(const std::string& la
 
 bool LayeredConfiguration::getRaw(const std::string& key, std::string& value) const
 {
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+
+	ValueCache::ConstIterator itCached = _cache.find(key);
+	if (itCached != _cache.end())
+	{
+		if (itCached->second.found) value = itCached->second.value;
+		return itCached->second.found;
+	}
+
+	CachedValue cached;
+	cached.found = false;
 	for (ConfigList::const_iterator it = _configs.begin(); it != _configs.end(); ++it)
 	{
-		if (it->pConfig->getRaw(key, value))
-			return true;
+		if (it->pConfig->getRaw(key, cached.value))
+		{
+			cached.found = true;
+			break;
+		}
 	}
-	return false;
+	// Misses are cached as well, since they are the most
+	// expensive case (all layers must be searched).
+	_cache.insert(ValueCache::PairType(key, cached));
+	if (cached.found) value = cached.value;
+	return cached.found;
 }
 
 
@@ -173,6 +207,8 @@ void LayeredConfiguration::setRaw(const std::string& key, const std::string& val
 		if (it->writeable)
 		{
 			it->pConfig->setRaw(key, value);
+			Poco::FastMutex::ScopedLock lock(_cacheMutex);
+			_cache.erase(key);
 			return;
 		}
 	}
@@ -206,6 +242,8 @@ void LayeredConfiguration::removeRaw(const std::string& key)
 		if (it->writeable)
 		{
 			it->pConfig->remove(key);
+			Poco::FastMutex::ScopedLock lock(_cacheMutex);
+			_cache.erase(key);
 			return;
 		}
 	}
@@ -230,4 +268,45 @@ int LayeredConfiguration::highest() const
 }
 
 
+void LayeredConfiguration::onPropertyChanged(const void* sender, const KeyValue& kv)
+{
+	// The merged value for the key may have changed, depending on
+	// the priority of the affected layer; dropping the entry is
+	// always correct and the next lookup recomputes it.
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+
+	_cache.erase(kv.key());
+}
+
+
+void LayeredConfiguration::onPropertyRemoved(const void* sender, const std::string& key)
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+
+	_cache.erase(key);
+}
+
+
+void LayeredConfiguration::subscribe(AbstractConfiguration* pConfig)
+{
+	pConfig->propertyChanged += Poco::delegate(this, &LayeredConfiguration::onPropertyChanged);
+	pConfig->propertyRemoved += Poco::delegate(this, &LayeredConfiguration::onPropertyRemoved);
+}
+
+
+void LayeredConfiguration::unsubscribe(AbstractConfiguration* pConfig)
+{
+	pConfig->propertyChanged -= Poco::delegate(this, &LayeredConfiguration::onPropertyChanged);
+	pConfig->propertyRemoved -= Poco::delegate(this, &LayeredConfiguration::onPropertyRemoved);
+}
+
+
+void LayeredConfiguration::discardCache()
+{
+	Poco::FastMutex::ScopedLock lock(_cacheMutex);
+
+	_cache.clear();
+}
+
+
 } } // namespace Poco::Util
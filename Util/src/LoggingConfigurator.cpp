@@ -22,7 +22,10 @@
 #include "Poco/Logger.h"
 #include "Poco/LoggingRegistry.h"
 #include "Poco/LoggingFactory.h"
+#include "Poco/Exception.h"
 #include <map>
+#include <set>
+#include <vector>
 
 
 using Poco::AutoPtr;
@@ -64,6 +67,61 @@ void LoggingConfigurator::configure(AbstractConfiguration* pConfig)
 }
 
 
+void LoggingConfigurator::reconfigure(AbstractConfiguration* pConfig)
+{
+	poco_check_ptr (pConfig);
+
+	// Collect the channels about to be replaced: those registered under
+	// a name appearing in the new configuration, as well as those
+	// currently attached to the loggers being reconfigured.
+	std::vector<AutoPtr<Channel> > oldChannels;
+	std::set<Channel*> seen;
+
+	AutoPtr<AbstractConfiguration> pChannelsConfig(pConfig->createView("logging.channels"));
+	AbstractConfiguration::Keys names;
+	pChannelsConfig->keys(names);
+	for (AbstractConfiguration::Keys::const_iterator it = names.begin(); it != names.end(); ++it)
+	{
+		try
+		{
+			Channel* pChannel = LoggingRegistry::defaultRegistry().channelForName(*it);
+			if (seen.insert(pChannel).second)
+				oldChannels.push_back(AutoPtr<Channel>(pChannel, true));
+		}
+		catch (Poco::NotFoundException&)
+		{
+		}
+	}
+
+	AutoPtr<AbstractConfiguration> pLoggersConfig(pConfig->createView("logging.loggers"));
+	names.clear();
+	pLoggersConfig->keys(names);
+	for (AbstractConfiguration::Keys::const_iterator it = names.begin(); it != names.end(); ++it)
+	{
+		AutoPtr<AbstractConfiguration> pLoggerConfig(pLoggersConfig->createView(*it));
+		Logger* pLogger = Logger::has(pLoggerConfig->getString("name", ""));
+		if (pLogger)
+		{
+			Channel* pChannel = pLogger->getChannel();
+			if (pChannel && seen.insert(pChannel).second)
+				oldChannels.push_back(AutoPtr<Channel>(pChannel, true));
+		}
+	}
+
+	// configure() creates and fully configures the new formatters and
+	// channels before any logger is switched over to them.
+	configure(pConfig);
+
+	// Close the replaced channels only after the loggers have been
+	// switched, so that channels buffering messages (such as
+	// AsyncChannel) can flush them without new messages arriving.
+	for (std::vector<AutoPtr<Channel> >::iterator it = oldChannels.begin(); it != oldChannels.end(); ++it)
+	{
+		(*it)->close();
+	}
+}
+
+
 void LoggingConfigurator::configureFormatters(AbstractConfiguration* pConfig)
 {
 	AbstractConfiguration::Keys formatters;
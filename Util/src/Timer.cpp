@@ -13,6 +13,7 @@
 
 
 #include "Poco/Util/Timer.h"
+#include "Poco/TimingWheelNotificationQueue.h"
 #include "Poco/Notification.h"
 #include "Poco/ErrorHandler.h"
 #include "Poco/Event.h"
@@ -228,13 +229,30 @@ private:
 };
 
 
-Timer::Timer()
+Timer::Timer():
+	_pQueue(createQueue(QUEUE_TIMED))
 {
 	_thread.start(*this);
 }
 
 
-Timer::Timer(Poco::Thread::Priority priority)
+Timer::Timer(Poco::Thread::Priority priority):
+	_pQueue(createQueue(QUEUE_TIMED))
+{
+	_thread.setPriority(priority);
+	_thread.start(*this);
+}
+
+
+Timer::Timer(QueueType queueType):
+	_pQueue(createQueue(queueType))
+{
+	_thread.start(*this);
+}
+
+
+Timer::Timer(Poco::Thread::Priority priority, QueueType queueType):
+	_pQueue(createQueue(queueType))
 {
 	_thread.setPriority(priority);
 	_thread.start(*this);
@@ -245,20 +263,21 @@ Timer::~Timer()
 {
 	try
 	{
-		_queue.enqueueNotification(new StopNotification(_queue), Poco::Clock(0));
+		_pQueue->enqueueNotification(new StopNotification(*_pQueue), Poco::Clock(0));
 		_thread.join();
 	}
 	catch (...)
 	{
 		poco_unexpected();
 	}
+	delete _pQueue;
 }
 
 
 void Timer::cancel(bool wait)
 {
-	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(_queue);
-	_queue.enqueueNotification(pNf, Poco::Clock(0));
+	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(*_pQueue);
+	_pQueue->enqueueNotification(pNf, Poco::Clock(0));
 	if (wait)
 	{
 		pNf->wait();
@@ -269,14 +288,14 @@ void Timer::cancel(bool wait)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+	_pQueue->enqueueNotification(new TaskNotification(*_pQueue, pTask), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
+	_pQueue->enqueueNotification(new TaskNotification(*_pQueue, pTask), clock);
 }
 
 
@@ -291,14 +310,14 @@ void Timer::schedule(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
+	_pQueue->enqueueNotification(new PeriodicTaskNotification(*_pQueue, pTask, interval), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
+	_pQueue->enqueueNotification(new PeriodicTaskNotification(*_pQueue, pTask, interval), clock);
 }
 
 
@@ -317,14 +336,14 @@ void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Timestamp time, long
 	Poco::Clock clock;
 	Poco::Timestamp::TimeDiff diff = time - tsNow;
 	clock += diff;
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_pQueue->enqueueNotification(new FixedRateTaskNotification(*_pQueue, pTask, interval, clock), clock);
 }
 
 
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_pQueue->enqueueNotification(new FixedRateTaskNotification(*_pQueue, pTask, interval, clock), clock);
 }
 
 
@@ -333,12 +352,21 @@ void Timer::run()
 	bool cont = true;
 	while (cont)
 	{
-		Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(_queue.waitDequeueNotification());
+		Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(_pQueue->waitDequeueNotification());
 		cont = pNf->execute();
 	}
 }
 
 
+Poco::TimedNotificationQueue* Timer::createQueue(QueueType queueType)
+{
+	if (queueType == QUEUE_TIMING_WHEEL)
+		return new Poco::TimingWheelNotificationQueue;
+	else
+		return new Poco::TimedNotificationQueue;
+}
+
+
 void Timer::validateTask(const TimerTask::Ptr& pTask)
 {
 	if (pTask->isCancelled())
@@ -23,6 +23,7 @@
 #include "Poco/DOM/Element.h"
 #include "Poco/DOM/Attr.h"
 #include "Poco/DOM/Text.h"
+#include "Poco/DOM/NamedNodeMap.h"
 #include "Poco/XML/XMLWriter.h"
 #include "Poco/Exception.h"
 #include "Poco/NumberParser.h"
@@ -35,84 +36,96 @@ namespace Util {
 
 
 XMLConfiguration::XMLConfiguration():
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	loadEmpty("config");
 }
 
 
 XMLConfiguration::XMLConfiguration(char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	loadEmpty("config");
 }
 
 
 XMLConfiguration::XMLConfiguration(Poco::XML::InputSource* pInputSource):
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	load(pInputSource);
 }
 
 
 XMLConfiguration::XMLConfiguration(Poco::XML::InputSource* pInputSource, char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	load(pInputSource);
 }
 
 
 XMLConfiguration::XMLConfiguration(std::istream& istr):
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	load(istr);
 }
 
 
 XMLConfiguration::XMLConfiguration(std::istream& istr, char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	load(istr);
 }
 
 
 XMLConfiguration::XMLConfiguration(const std::string& path):
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	load(path);
 }
 
 
 XMLConfiguration::XMLConfiguration(const std::string& path, char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	load(path);
 }
 
 
 XMLConfiguration::XMLConfiguration(const Poco::XML::Document* pDocument):
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	load(pDocument);
 }
 
 
 XMLConfiguration::XMLConfiguration(const Poco::XML::Document* pDocument, char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	load(pDocument);
 }
 
 	
 XMLConfiguration::XMLConfiguration(const Poco::XML::Node* pNode):
-	_delim('.')
+	_delim('.'),
+	_compiled(false)
 {
 	load(pNode);
 }
 
 
 XMLConfiguration::XMLConfiguration(const Poco::XML::Node* pNode, char delim):
-	_delim(delim)
+	_delim(delim),
+	_compiled(false)
 {
 	load(pNode);
 }
@@ -158,9 +171,11 @@ void XMLConfiguration::load(const std::string& path)
 void XMLConfiguration::load(const Poco::XML::Document* pDocument)
 {
 	poco_check_ptr (pDocument);
-	
+
 	_pDocument = Poco::XML::AutoPtr<Poco::XML::Document>(const_cast<Poco::XML::Document*>(pDocument), true);
 	_pRoot     = Poco::XML::AutoPtr<Poco::XML::Node>(pDocument->documentElement(), true);
+	_flat.clear();
+	_compiled  = false;
 }
 
 
@@ -176,6 +191,8 @@ void XMLConfiguration::load(const Poco::XML::Node* pNode)
 	{
 		_pDocument = Poco::XML::AutoPtr<Poco::XML::Document>(pNode->ownerDocument(), true);
 		_pRoot     = Poco::XML::AutoPtr<Poco::XML::Node>(const_cast<Poco::XML::Node*>(pNode), true);
+		_flat.clear();
+		_compiled  = false;
 	}
 }
 
@@ -185,11 +202,64 @@ void XMLConfiguration::loadEmpty(const std::string& rootElementName)
 	_pDocument = new Poco::XML::Document;
 	_pRoot     = _pDocument->createElement(rootElementName);
 	_pDocument->appendChild(_pRoot);
+	_flat.clear();
+	_compiled  = false;
+}
+
+
+void XMLConfiguration::compile()
+{
+	_flat.clear();
+	if (_pRoot)
+	{
+		flatten(std::string(), _pRoot);
+	}
+	_pRoot     = 0;
+	_pDocument = 0;
+	_compiled  = true;
+}
+
+
+void XMLConfiguration::flatten(const std::string& key, const Poco::XML::Node* pNode)
+{
+	using Poco::NumberFormatter;
+
+	if (pNode->hasAttributes())
+	{
+		Poco::XML::AutoPtr<Poco::XML::NamedNodeMap> pAttrs = pNode->attributes();
+		for (unsigned long i = 0; i < pAttrs->length(); i++)
+		{
+			const Poco::XML::Node* pAttr = pAttrs->item(i);
+			_flat[key + "[@" + pAttr->nodeName() + "]"] = pAttr->nodeValue();
+		}
+	}
+	std::multiset<std::string> names;
+	bool hasElements = false;
+	for (const Poco::XML::Node* pChild = pNode->firstChild(); pChild; pChild = pChild->nextSibling())
+	{
+		if (pChild->nodeType() == Poco::XML::Node::ELEMENT_NODE)
+		{
+			hasElements = true;
+			const std::string& nodeName = pChild->nodeName();
+			std::string childKey = key.empty() ? nodeName : key + _delim + nodeName;
+			int n = (int) names.count(nodeName);
+			if (n)
+				childKey += "[" + NumberFormatter::format(n) + "]";
+			names.insert(nodeName);
+			flatten(childKey, pChild);
+		}
+	}
+	if (!hasElements && !key.empty())
+	{
+		_flat[key] = pNode->innerText();
+	}
 }
 
 
 void XMLConfiguration::save(const std::string& path) const
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot save a compiled XMLConfiguration");
+
 	Poco::XML::DOMWriter writer;
 	writer.setNewLine("\n");
 	writer.setOptions(Poco::XML::XMLWriter::PRETTY_PRINT);
@@ -199,6 +269,8 @@ void XMLConfiguration::save(const std::string& path) const
 
 void XMLConfiguration::save(std::ostream& ostr) const
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot save a compiled XMLConfiguration");
+
 	Poco::XML::DOMWriter writer;
 	writer.setNewLine("\n");
 	writer.setOptions(Poco::XML::XMLWriter::PRETTY_PRINT);
@@ -208,18 +280,32 @@ void XMLConfiguration::save(std::ostream& ostr) const
 
 void XMLConfiguration::save(Poco::XML::DOMWriter& writer, const std::string& path) const
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot save a compiled XMLConfiguration");
+
 	writer.writeNode(path, _pDocument);
 }
 
 
 void XMLConfiguration::save(Poco::XML::DOMWriter& writer, std::ostream& ostr) const
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot save a compiled XMLConfiguration");
+
 	writer.writeNode(ostr, _pDocument);
 }
 
 
 bool XMLConfiguration::getRaw(const std::string& key, std::string& value) const
 {
+	if (_compiled)
+	{
+		StringMap::const_iterator it = _flat.find(key);
+		if (it != _flat.end())
+		{
+			value = it->second;
+			return true;
+		}
+		else return false;
+	}
 	const Poco::XML::Node* pNode = findNode(key);
 	if (pNode)
 	{
@@ -232,6 +318,8 @@ bool XMLConfiguration::getRaw(const std::string& key, std::string& value) const
 
 void XMLConfiguration::setRaw(const std::string& key, const std::string& value)
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot modify a compiled XMLConfiguration", key);
+
 	std::string::const_iterator it = key.begin();
 	Poco::XML::Node* pNode = findNode(it, key.end(), _pRoot, true);
 	if (pNode)
@@ -265,7 +353,33 @@ void XMLConfiguration::setRaw(const std::string& key, const std::string& value)
 void XMLConfiguration::enumerate(const std::string& key, Keys& range) const
 {
 	using Poco::NumberFormatter;
-	
+
+	if (_compiled)
+	{
+		std::string prefix = key;
+		if (!prefix.empty()) prefix += _delim;
+		std::set<std::string> seen;
+		for (StringMap::const_iterator it = _flat.begin(); it != _flat.end(); ++it)
+		{
+			const std::string& fullKey = it->first;
+			if (fullKey.size() > prefix.size() && fullKey.compare(0, prefix.size(), prefix) == 0)
+			{
+				std::string child = fullKey.substr(prefix.size());
+				std::string::size_type pos = child.find(_delim);
+				if (pos != std::string::npos) child.resize(pos);
+				// strip an attribute part, so that "elem[@attr]" enumerates as "elem"
+				pos = child.find("[@");
+				if (pos != std::string::npos) child.resize(pos);
+				if (!child.empty() && seen.find(child) == seen.end())
+				{
+					range.push_back(child);
+					seen.insert(child);
+				}
+			}
+		}
+		return;
+	}
+
 	std::multiset<std::string> keys;
 	const Poco::XML::Node* pNode = findNode(key);
 	if (pNode)
@@ -291,6 +405,8 @@ void XMLConfiguration::enumerate(const std::string& key, Keys& range) const
 
 void XMLConfiguration::removeRaw(const std::string& key)
 {
+	if (_compiled) throw Poco::InvalidAccessException("Cannot modify a compiled XMLConfiguration", key);
+
 	Poco::XML::Node* pNode = findNode(key);
 
 	if (pNode)
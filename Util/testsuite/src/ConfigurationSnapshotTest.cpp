@@ -0,0 +1,159 @@
+//
+// ConfigurationSnapshotTest.cpp
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ConfigurationSnapshotTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Util/MapConfiguration.h"
+#include "Poco/Util/LayeredConfiguration.h"
+#include "Poco/Util/ConfigurationSnapshot.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+
+
+using Poco::Util::AbstractConfiguration;
+using Poco::Util::MapConfiguration;
+using Poco::Util::LayeredConfiguration;
+using Poco::Util::ConfigurationSnapshot;
+using Poco::AutoPtr;
+
+
+ConfigurationSnapshotTest::ConfigurationSnapshotTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ConfigurationSnapshotTest::~ConfigurationSnapshotTest()
+{
+}
+
+
+void ConfigurationSnapshotTest::testSnapshot()
+{
+	AutoPtr<MapConfiguration> pConf = new MapConfiguration;
+	pConf->setString("prop1", "foo");
+	pConf->setString("prop2.string1", "bar");
+	pConf->setString("prop2.int1", "42");
+	pConf->setString("prop2.hex", "0x1f");
+	pConf->setString("prop2.double1", "-1.5");
+	pConf->setString("prop2.bool1", "true");
+	pConf->setString("ref1", "${prop1}${prop2.string1}");
+	pConf->setString("ref2", "${ref3}");
+	pConf->setString("ref3", "${ref2}");
+
+	ConfigurationSnapshot::Ptr pSnapshot = pConf->createSnapshot();
+
+	assert (pSnapshot->has("prop1"));
+	assert (pSnapshot->has("prop2.int1"));
+	assert (!pSnapshot->has("prop3"));
+
+	assert (pSnapshot->getString("prop1") == "foo");
+	assert (pSnapshot->getString("prop3", "default") == "default");
+	assert (pSnapshot->getInt("prop2.int1") == 42);
+	assert (pSnapshot->getInt("prop2.hex") == 31);
+	assert (pSnapshot->getInt("prop3", 100) == 100);
+	assert (pSnapshot->getUInt("prop2.int1") == 42);
+#if defined(POCO_HAVE_INT64)
+	assert (pSnapshot->getInt64("prop2.int1") == 42);
+	assert (pSnapshot->getUInt64("prop2.int1") == 42);
+#endif
+	assert (pSnapshot->getDouble("prop2.double1") == -1.5);
+	assert (pSnapshot->getBool("prop2.bool1"));
+	assert (!pSnapshot->getBool("prop3", false));
+
+	// references are expanded at snapshot creation
+	assert (pSnapshot->getString("ref1") == "foobar");
+
+	// circular references are stored unexpanded
+	assert (pSnapshot->getString("ref2") == "${ref3}");
+
+	try
+	{
+		pSnapshot->getString("prop3");
+		fail("nonexistent property - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+
+	ConfigurationSnapshot::Keys keys;
+	pSnapshot->keys(keys);
+	assert (keys.size() == 9);
+	assert (std::find(keys.begin(), keys.end(), "prop1") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop2.string1") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "ref1") != keys.end());
+}
+
+
+void ConfigurationSnapshotTest::testIsCurrent()
+{
+	AutoPtr<MapConfiguration> pConf = new MapConfiguration;
+	pConf->setString("prop1", "foo");
+
+	ConfigurationSnapshot::Ptr pSnapshot = pConf->createSnapshot();
+	assert (pSnapshot->isCurrent());
+
+	pConf->setString("prop1", "bar");
+	assert (!pSnapshot->isCurrent());
+
+	// the snapshot itself is unaffected by the change
+	assert (pSnapshot->getString("prop1") == "foo");
+
+	pSnapshot = pConf->createSnapshot();
+	assert (pSnapshot->isCurrent());
+	assert (pSnapshot->getString("prop1") == "bar");
+
+	pConf->remove("prop1");
+	assert (!pSnapshot->isCurrent());
+}
+
+
+void ConfigurationSnapshotTest::testLayered()
+{
+	AutoPtr<MapConfiguration> pLower = new MapConfiguration;
+	pLower->setString("prop1", "lower");
+	pLower->setString("prop2", "lower");
+
+	AutoPtr<MapConfiguration> pUpper = new MapConfiguration;
+	pUpper->setString("prop1", "upper");
+	pUpper->setString("prop3", "upper");
+
+	AutoPtr<LayeredConfiguration> pLC = new LayeredConfiguration;
+	pLC->add(pUpper, 0);
+	pLC->add(pLower, 1);
+
+	ConfigurationSnapshot::Ptr pSnapshot = pLC->createSnapshot();
+	assert (pSnapshot->getString("prop1") == "upper");
+	assert (pSnapshot->getString("prop2") == "lower");
+	assert (pSnapshot->getString("prop3") == "upper");
+}
+
+
+void ConfigurationSnapshotTest::setUp()
+{
+}
+
+
+void ConfigurationSnapshotTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ConfigurationSnapshotTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ConfigurationSnapshotTest");
+
+	CppUnit_addTest(pSuite, ConfigurationSnapshotTest, testSnapshot);
+	CppUnit_addTest(pSuite, ConfigurationSnapshotTest, testIsCurrent);
+	CppUnit_addTest(pSuite, ConfigurationSnapshotTest, testLayered);
+
+	return pSuite;
+}
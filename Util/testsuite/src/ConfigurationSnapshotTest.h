@@ -0,0 +1,38 @@
+//
+// ConfigurationSnapshotTest.h
+//
+// Definition of the ConfigurationSnapshotTest class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ConfigurationSnapshotTest_INCLUDED
+#define ConfigurationSnapshotTest_INCLUDED
+
+
+#include "Poco/Util/Util.h"
+#include "CppUnit/TestCase.h"
+
+
+class ConfigurationSnapshotTest: public CppUnit::TestCase
+{
+public:
+	ConfigurationSnapshotTest(const std::string& name);
+	virtual ~ConfigurationSnapshotTest();
+
+	void testSnapshot();
+	void testIsCurrent();
+	void testLayered();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ConfigurationSnapshotTest_INCLUDED
@@ -12,6 +12,7 @@
 #include "AbstractConfigurationTest.h"
 #include "ConfigurationViewTest.h"
 #include "ConfigurationMapperTest.h"
+#include "ConfigurationSnapshotTest.h"
 #include "MapConfigurationTest.h"
 #include "LayeredConfigurationTest.h"
 #include "SystemConfigurationTest.h"
@@ -29,6 +30,7 @@ CppUnit::Test* ConfigurationTestSuite::suite()
 
 	pSuite->addTest(ConfigurationViewTest::suite());
 	pSuite->addTest(ConfigurationMapperTest::suite());
+	pSuite->addTest(ConfigurationSnapshotTest::suite());
 	pSuite->addTest(MapConfigurationTest::suite());
 	pSuite->addTest(LayeredConfigurationTest::suite());
 	pSuite->addTest(SystemConfigurationTest::suite());
@@ -13,6 +13,7 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Util/JSONConfiguration.h"
 #include "Poco/JSON/JSONException.h"
+#include <algorithm>
 
 
 using Poco::Util::JSONConfiguration;
@@ -114,6 +115,82 @@ void JSONConfigurationTest::testSetArrayElement()
 }
 
 
+void JSONConfigurationTest::testCompile()
+{
+	JSONConfiguration config;
+
+	std::string json = "{ \"config\" : "
+							" { \"prop1\" : \"value1\", "
+							" \"prop2\" : 10, "
+							" \"prop3\" : [ \"element1\", \"element2\" ], "
+							" \"prop4\" : { \"prop5\" : false, "
+											" \"prop6\" : null } "
+							" }"
+						"}";
+
+	std::istringstream iss(json);
+	config.load(iss);
+	config.compile();
+
+	assert(config.getString("config.prop1") == "value1");
+	assert(config.getInt("config.prop2") == 10);
+	assert(config.getString("config.prop3[1]") == "element2");
+	assert(! config.getBool("config.prop4.prop5"));
+	assert(config.getInt("config.prop7", 5) == 5);
+	assert(! config.hasProperty("config.prop4.prop6"));
+
+	AbstractConfiguration::Keys keys;
+	config.keys("config", keys);
+	assert(keys.size() == 4);
+	assert(std::find(keys.begin(), keys.end(), "prop1") != keys.end());
+	assert(std::find(keys.begin(), keys.end(), "prop2") != keys.end());
+	assert(std::find(keys.begin(), keys.end(), "prop3") != keys.end());
+	assert(std::find(keys.begin(), keys.end(), "prop4") != keys.end());
+
+	try
+	{
+		config.getString("propertyUnknown");
+		fail("No property - must throw");
+	}
+	catch(NotFoundException&)
+	{
+	}
+
+	try
+	{
+		config.setString("config.prop1", "value2");
+		fail("Compiled configuration - must throw");
+	}
+	catch(Poco::InvalidAccessException&)
+	{
+	}
+
+	try
+	{
+		config.remove("config.prop1");
+		fail("Compiled configuration - must throw");
+	}
+	catch(Poco::InvalidAccessException&)
+	{
+	}
+
+	try
+	{
+		std::ostringstream oss;
+		config.save(oss);
+		fail("Compiled configuration - must throw");
+	}
+	catch(Poco::InvalidAccessException&)
+	{
+	}
+
+	// loading makes the configuration modifiable again
+	config.loadEmpty("config");
+	config.setString("config.prop1", "value2");
+	assert(config.getString("config.prop1") == "value2");
+}
+
+
 AbstractConfiguration* JSONConfigurationTest::allocConfiguration() const
 {
 	return new JSONConfiguration;
@@ -137,6 +214,7 @@ CppUnit::Test* JSONConfigurationTest::suite()
 	AbstractConfigurationTest_addTests(pSuite, JSONConfigurationTest);
 	CppUnit_addTest(pSuite, JSONConfigurationTest, testLoad);
 	CppUnit_addTest(pSuite, JSONConfigurationTest, testSetArrayElement);
+	CppUnit_addTest(pSuite, JSONConfigurationTest, testCompile);
 
 	return pSuite;
 }
@@ -26,6 +26,7 @@ public:
 
 	void testLoad();
 	void testSetArrayElement();
+	void testCompile();
 
 	void setUp();
 	void tearDown();
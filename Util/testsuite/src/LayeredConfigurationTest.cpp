@@ -225,6 +225,51 @@ AbstractConfiguration* LayeredConfigurationTest::allocConfiguration() const
 }
 
 
+void LayeredConfigurationTest::testCacheInvalidation()
+{
+	AutoPtr<LayeredConfiguration> pLC = new LayeredConfiguration;
+	AutoPtr<MapConfiguration> pMC1 = new MapConfiguration;
+	AutoPtr<MapConfiguration> pMC2 = new MapConfiguration;
+
+	pMC1->setString("prop1", "value1");
+	pMC2->setString("prop1", "value2");
+	pMC2->setString("prop2", "value3");
+
+	pLC->add(pMC1, 0);
+	pLC->addWriteable(pMC2, 1);
+
+	// populate the merged cache, including a cached miss
+	assert (pLC->getString("prop1") == "value1");
+	assert (pLC->getString("prop2") == "value3");
+	assert (!pLC->hasProperty("prop3"));
+
+	// writes through the LayeredConfiguration invalidate the entry
+	pLC->setString("prop2", "value4");
+	assert (pLC->getString("prop2") == "value4");
+
+	// direct writes to a layer invalidate the entry via its events
+	pMC1->setString("prop1", "value5");
+	assert (pLC->getString("prop1") == "value5");
+
+	// a cached miss is invalidated when the property appears
+	pMC2->setString("prop3", "value6");
+	assert (pLC->getString("prop3") == "value6");
+
+	// removing a property from a layer invalidates the entry
+	pMC1->remove("prop1");
+	assert (pLC->getString("prop1") == "value2");
+
+	// adding or removing a layer discards the cache
+	AutoPtr<MapConfiguration> pMC3 = new MapConfiguration;
+	pMC3->setString("prop1", "value7");
+	pLC->add(pMC3, -1);
+	assert (pLC->getString("prop1") == "value7");
+
+	pLC->removeConfiguration(pMC3);
+	assert (pLC->getString("prop1") == "value2");
+}
+
+
 void LayeredConfigurationTest::setUp()
 {
 }
@@ -246,6 +291,7 @@ CppUnit::Test* LayeredConfigurationTest::suite()
 	CppUnit_addTest(pSuite, LayeredConfigurationTest, testThreeLayers);
 	CppUnit_addTest(pSuite, LayeredConfigurationTest, testRemove);
 	CppUnit_addTest(pSuite, LayeredConfigurationTest, testFind);
+	CppUnit_addTest(pSuite, LayeredConfigurationTest, testCacheInvalidation);
 
 	return pSuite;
 }
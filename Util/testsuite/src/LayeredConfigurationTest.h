@@ -30,6 +30,7 @@ public:
 	void testThreeLayers();
 	void testRemove();
 	void testFind();
+	void testCacheInvalidation();
 
 	void setUp();
 	void tearDown();
@@ -23,6 +23,8 @@
 #include "Poco/FormattingChannel.h"
 #include "Poco/PatternFormatter.h"
 #include "Poco/Logger.h"
+#include "Poco/LoggingFactory.h"
+#include "Poco/Instantiator.h"
 #include "Poco/Message.h"
 #include "Poco/AutoPtr.h"
 #include <sstream>
@@ -38,10 +40,42 @@ using Poco::SplitterChannel;
 using Poco::FormattingChannel;
 using Poco::PatternFormatter;
 using Poco::Logger;
+using Poco::LoggingFactory;
 using Poco::Message;
 using Poco::AutoPtr;
 
 
+namespace
+{
+	class TrackingChannel: public Channel
+		/// A channel that remembers whether it has been closed,
+		/// for testing LoggingConfigurator::reconfigure().
+	{
+	public:
+		TrackingChannel(): _closed(false)
+		{
+		}
+
+		void log(const Message& msg)
+		{
+		}
+
+		void close()
+		{
+			_closed = true;
+		}
+
+		bool closed() const
+		{
+			return _closed;
+		}
+
+	private:
+		bool _closed;
+	};
+}
+
+
 LoggingConfiguratorTest::LoggingConfiguratorTest(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -284,6 +318,42 @@ void LoggingConfiguratorTest::testBadConfiguration4()
 }
 
 
+void LoggingConfiguratorTest::testReconfigure()
+{
+	LoggingFactory::defaultFactory().registerChannelClass("TrackingChannel", new Poco::Instantiator<TrackingChannel, Channel>);
+
+	static const std::string config =
+		"logging.loggers.lr.name = reconfigLogger\n"
+		"logging.loggers.lr.channel = tc\n"
+		"logging.loggers.lr.level = information\n"
+		"logging.channels.tc.class = TrackingChannel\n";
+
+	std::istringstream istr1(config);
+	AutoPtr<PropertyFileConfiguration> pConfig1 = new PropertyFileConfiguration(istr1);
+
+	LoggingConfigurator configurator;
+	configurator.configure(pConfig1);
+
+	Logger& logger = Logger::get("reconfigLogger");
+	AutoPtr<TrackingChannel> pOldChannel(dynamic_cast<TrackingChannel*>(logger.getChannel()), true);
+	assertNotNull (pOldChannel.get());
+	assert (!pOldChannel->closed());
+
+	std::istringstream istr2(config);
+	AutoPtr<PropertyFileConfiguration> pConfig2 = new PropertyFileConfiguration(istr2);
+	configurator.reconfigure(pConfig2);
+
+	// the logger has been switched to a new channel and
+	// the replaced channel has been closed
+	TrackingChannel* pNewChannel = dynamic_cast<TrackingChannel*>(logger.getChannel());
+	assertNotNull (pNewChannel);
+	assert (pNewChannel != pOldChannel.get());
+	assert (!pNewChannel->closed());
+	assert (pOldChannel->closed());
+	assert (LoggingRegistry::defaultRegistry().channelForName("tc") == pNewChannel);
+}
+
+
 void LoggingConfiguratorTest::setUp()
 {
 	LoggingRegistry::defaultRegistry().clear();
@@ -304,6 +374,7 @@ CppUnit::Test* LoggingConfiguratorTest::suite()
 	CppUnit_addTest(pSuite, LoggingConfiguratorTest, testBadConfiguration2);
 	CppUnit_addTest(pSuite, LoggingConfiguratorTest, testBadConfiguration3);
 	CppUnit_addTest(pSuite, LoggingConfiguratorTest, testBadConfiguration4);
+	CppUnit_addTest(pSuite, LoggingConfiguratorTest, testReconfigure);
 
 	return pSuite;
 }
@@ -29,6 +29,7 @@ public:
 	void testBadConfiguration2();
 	void testBadConfiguration3();
 	void testBadConfiguration4();
+	void testReconfigure();
 
 	void setUp();
 	void tearDown();
@@ -300,6 +300,96 @@ void XMLConfigurationTest::testLoadEmpty()
 }
 
 
+void XMLConfigurationTest::testCompile()
+{
+	static const std::string xmlFile =
+		"<config>"
+		"	<prop1>value1</prop1>"
+		"	<prop2>value2</prop2>"
+		"	<prop3>"
+		"		<prop4 attr='value3'/>"
+		"		<prop4 attr='value4'/>"
+		"	</prop3>"
+		"	<prop5 id='1'>value5</prop5>"
+		"	<prop5 id='2'>value6</prop5>"
+		"   <prop6 id='foo'>"
+		"       <prop7>value7</prop7>"
+		"   </prop6>"
+		"</config>";
+
+	std::istringstream istr(xmlFile);
+	AutoPtr<XMLConfiguration> pConf = new XMLConfiguration(istr);
+	pConf->compile();
+
+	assert (pConf->getString("prop1") == "value1");
+	assert (pConf->getString("prop2") == "value2");
+	assert (pConf->getString("prop3.prop4") == "");
+	assert (pConf->getString("prop3.prop4[@attr]") == "value3");
+	assert (pConf->getString("prop3.prop4[1][@attr]") == "value4");
+	assert (pConf->getString("prop5") == "value5");
+	assert (pConf->getString("prop5[1]") == "value6");
+	assert (pConf->getString("prop5[@id]") == "1");
+	assert (pConf->getString("prop6.prop7") == "value7");
+
+	AbstractConfiguration::Keys keys;
+	pConf->keys(keys);
+	assert (keys.size() == 6);
+	assert (std::find(keys.begin(), keys.end(), "prop1") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop2") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop3") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop5") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop5[1]") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop6") != keys.end());
+
+	pConf->keys("prop3", keys);
+	assert (keys.size() == 2);
+	assert (std::find(keys.begin(), keys.end(), "prop4") != keys.end());
+	assert (std::find(keys.begin(), keys.end(), "prop4[1]") != keys.end());
+
+	try
+	{
+		std::string s = pConf->getString("foo");
+		fail("No property - must throw");
+	}
+	catch (NotFoundException&)
+	{
+	}
+
+	try
+	{
+		pConf->setString("prop1", "value2");
+		fail("Compiled configuration - must throw");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+
+	try
+	{
+		pConf->remove("prop1");
+		fail("Compiled configuration - must throw");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+
+	try
+	{
+		std::ostringstream ostr;
+		pConf->save(ostr);
+		fail("Compiled configuration - must throw");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+
+	// loading makes the configuration modifiable again
+	pConf->loadEmpty("config");
+	pConf->setString("prop1", "value2");
+	assert (pConf->getString("prop1") == "value2");
+}
+
+
 void XMLConfigurationTest::setUp()
 {
 }
@@ -322,6 +412,7 @@ CppUnit::Test* XMLConfigurationTest::suite()
 	CppUnit_addTest(pSuite, XMLConfigurationTest, testSaveEmpty);
 	CppUnit_addTest(pSuite, XMLConfigurationTest, testFromScratch);
 	CppUnit_addTest(pSuite, XMLConfigurationTest, testLoadEmpty);
+	CppUnit_addTest(pSuite, XMLConfigurationTest, testCompile);
 
 	return pSuite;
 }
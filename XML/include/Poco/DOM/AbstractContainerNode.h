@@ -69,6 +69,7 @@ private:
 
 	friend class AbstractNode;
 	friend class NodeAppender;
+	friend class Document;
 };
 
 
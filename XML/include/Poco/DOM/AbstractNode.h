@@ -22,6 +22,8 @@
 #include "Poco/DOM/Node.h"
 #include "Poco/DOM/MutationEvent.h"
 #include "Poco/XML/XMLString.h"
+#include <cstddef>
+#include <new>
 
 
 namespace Poco {
@@ -76,6 +78,30 @@ public:
 
 	virtual void autoRelease();
 
+	// Memory management
+	static void* operator new(std::size_t size);
+		/// Allocates the node from the heap.
+		///
+		/// Every node allocation is prefixed with a header
+		/// recording where the memory came from, so that
+		/// operator delete can tell heap nodes and arena
+		/// nodes apart.
+
+	static void* operator new(std::size_t size, Document* pOwnerDocument);
+		/// Allocates the node from the owner document's
+		/// node arena if the document has one (see
+		/// Document::enableArenaAllocation()), otherwise
+		/// from the heap.
+
+	static void operator delete(void* ptr);
+		/// Frees the node's memory if it was allocated from
+		/// the heap; memory allocated from an arena is left
+		/// alone and reclaimed when the arena is destroyed.
+
+	static void operator delete(void* ptr, Document* pOwnerDocument);
+		/// Called if a node constructor throws after placement
+		/// allocation; behaves like operator delete(void*).
+
 protected:
 	AbstractNode(Document* pOwnerDocument);
 	AbstractNode(Document* pOwnerDocument, const AbstractNode& node);
@@ -20,15 +20,23 @@
 
 #include "Poco/XML/XML.h"
 #include "Poco/DOM/NodeList.h"
+#include "Poco/DOM/EventListener.h"
 
 
 namespace Poco {
 namespace XML {
 
 
-class XML_API ChildNodesList: public NodeList
+class XML_API ChildNodesList: public NodeList, protected EventListener
 	// This implementation of NodeList is returned
 	// by Node::getChildNodes().
+	//
+	// To avoid re-walking the sibling chain from the start
+	// on every call, item() caches the last returned node and
+	// its index and resumes the walk from there, which makes
+	// sequential iteration over the list linear instead of
+	// quadratic. The cached cursor is discarded whenever a
+	// DOMSubtreeModified event is received from the parent.
 {
 public:
 	Node* item(unsigned long index) const;
@@ -39,12 +47,17 @@ public:
 protected:
 	ChildNodesList(const Node* pParent);
 	~ChildNodesList();
-	
+
+	// EventListener
+	void handleEvent(Event* evt);
+
 private:
 	ChildNodesList();
 
 	const Node* _pParent;
-	
+	mutable Node* _pCursor;
+	mutable unsigned long _cursorIndex;
+
 	friend class AbstractNode;
 };
 
@@ -46,9 +46,14 @@ class XML_API DOMBuilder: protected DTDHandler, protected ContentHandler, protec
 	/// must be supplied to the DOMBuilder.
 {
 public:
-	DOMBuilder(XMLReader& xmlReader, NamePool* pNamePool = 0);
-		/// Creates a DOMBuilder using the given XMLReader. 
+	DOMBuilder(XMLReader& xmlReader, NamePool* pNamePool = 0, bool arenaAllocation = false);
+		/// Creates a DOMBuilder using the given XMLReader.
 		/// If a NamePool is given, it becomes the Document's NamePool.
+		///
+		/// If arenaAllocation is true, the nodes of documents built
+		/// by the DOMBuilder are allocated from an arena owned by
+		/// the respective document and freed wholesale when the
+		/// document is destroyed (see Document::enableArenaAllocation()).
 
 	virtual ~DOMBuilder();
 		/// Destroys the DOMBuilder.
@@ -103,6 +108,7 @@ private:
 	AbstractNode*          _pPrevious;
 	bool                   _inCDATA;
 	bool                   _namespaces;
+	bool                   _arenaAllocation;
 };
 
 
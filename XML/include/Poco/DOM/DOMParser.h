@@ -70,10 +70,15 @@ public:
 		/// If a feature is not recognized by the DOMParser, it is
 		/// passed on to the underlying XMLReader.
 		///
-		/// The only currently supported feature is
+		/// The features directly supported by the DOMParser are
 		/// http://www.appinf.com/features/no-whitespace-in-element-content
 		/// which, when activated, causes the WhitespaceFilter to
-		/// be used.
+		/// be used, and
+		/// http://www.appinf.com/features/dom-arena-allocation
+		/// which, when activated, causes the nodes of parsed documents
+		/// to be allocated from an arena owned by the document and
+		/// freed wholesale when the document is destroyed
+		/// (see Document::enableArenaAllocation()).
 
 	bool getFeature(const XMLString& name) const;
 		/// Look up the value of a feature.
@@ -100,11 +105,13 @@ public:
 		/// Sets the entity resolver on the underlying SAXParser.
 
 	static const XMLString FEATURE_FILTER_WHITESPACE;
+	static const XMLString FEATURE_ARENA_ALLOCATION;
 	
 private:
 	SAXParser _saxParser;
 	NamePool* _pNamePool;
 	bool      _filterWhitespace;
+	bool      _arenaAllocation;
 };
 
 
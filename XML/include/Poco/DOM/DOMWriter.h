@@ -85,6 +85,17 @@ public:
 		/// Writes the XML for the given node to the file specified in systemId,
 		/// using a standard file output stream (Poco::FileOutputStream).
 
+	std::size_t writeNode(char* pBuffer, std::size_t size, const Node* pNode);
+		/// Writes the XML for the given node into the given contiguous
+		/// buffer (using a Poco::MemoryOutputStream) and returns the
+		/// number of bytes written. No terminating null byte is appended.
+		///
+		/// Serializing into a caller-provided buffer avoids the stream
+		/// and heap overhead of an std::ostringstream when the serialized
+		/// document is subsequently sent over the wire.
+		///
+		/// Throws an XMLException if the buffer is too small.
+
 private:
 	std::string         _encodingName;
 	Poco::TextEncoding* _pTextEncoding;
@@ -22,9 +22,11 @@
 #include "Poco/DOM/AbstractContainerNode.h"
 #include "Poco/DOM/DocumentEvent.h"
 #include "Poco/DOM/Element.h"
+#include "Poco/DOM/EventListener.h"
 #include "Poco/XML/XMLString.h"
 #include "Poco/XML/NamePool.h"
 #include "Poco/AutoReleasePool.h"
+#include <map>
 
 
 namespace Poco {
@@ -44,9 +46,10 @@ class EntityReference;
 class NodeList;
 class Entity;
 class Notation;
+class NodeArena;
 
 
-class XML_API Document: public AbstractContainerNode, public DocumentEvent
+class XML_API Document: public AbstractContainerNode, public DocumentEvent, protected EventListener
 	/// The Document interface represents the entire HTML or XML document. Conceptually, 
 	/// it is the root of the document tree, and provides the primary access to the 
 	/// document's data.
@@ -228,7 +231,47 @@ public:
 
 	Element* getElementByIdNS(const XMLString& elementId, const XMLString& idAttributeURI, const XMLString& idAttributeLocalName) const;
 		/// Returns the first Element whose ID attribute (given in idAttributeURI and idAttributeLocalName)
-		/// has the given elementId. If no such element exists, returns null. 
+		/// has the given elementId. If no such element exists, returns null.
+		///
+		/// This method is an extension to the W3C Document Object Model.
+
+	void enableArenaAllocation();
+		/// Enables arena-based node allocation for this document.
+		///
+		/// All nodes subsequently created through the document's factory
+		/// methods are allocated from a NodeArena owned by the document
+		/// and are freed wholesale when the document is destroyed, which
+		/// avoids one heap allocation and deallocation per node. This
+		/// pays off for parse-inspect-discard workloads on large
+		/// documents (see DOMParser::FEATURE_ARENA_ALLOCATION).
+		///
+		/// Documents built this way should be treated as read-only:
+		/// removing nodes from the tree does not return their memory
+		/// until the document itself is destroyed, and no node may be
+		/// used after its document has been released.
+		///
+		/// Must be called before any nodes are created; has no effect
+		/// on nodes that already exist.
+		///
+		/// This method is an extension to the W3C Document Object Model.
+
+	NodeArena* nodeArena() const;
+		/// Returns the document's node arena, or null if arena
+		/// allocation has not been enabled.
+		///
+		/// This method is an extension to the W3C Document Object Model.
+
+	void enableIdIndex(const XMLString& idAttribute);
+		/// Enables an index over the values of the given ID attribute,
+		/// which speeds up the two argument variant of getElementById()
+		/// from a full tree walk to a map lookup.
+		///
+		/// The index is built lazily on the first call to getElementById()
+		/// whose idAttribute argument matches the one given here and is
+		/// invalidated by DOM mutation events. It is therefore not
+		/// maintained while events are suspended (see suspendEvents());
+		/// in this case the index is rebuilt on the next lookup after
+		/// events have been resumed.
 		///
 		/// This method is an extension to the W3C Document Object Model.
 
@@ -236,15 +279,26 @@ protected:
 	~Document();
 
 	Node* copyNode(bool deep, Document* pOwnerDocument) const;
-	
+
 	DocumentType* getDoctype();
 	void setDoctype(DocumentType* pDoctype);
 
+	// EventListener
+	void handleEvent(Event* evt);
+
 private:
+	typedef std::map<XMLString, Element*> IdMap;
+
+	void buildIdMap() const;
+
 	DocumentType*   _pDocumentType;
 	NamePool*       _pNamePool;
+	NodeArena*      _pArena;
 	AutoReleasePool _autoReleasePool;
 	int             _eventSuspendLevel;
+	XMLString       _idAttribute;
+	mutable IdMap   _idMap;
+	mutable bool    _idMapValid;
 
 	static const XMLString NODE_NAME;
 	
@@ -279,6 +333,12 @@ inline DocumentType* Document::getDoctype()
 }
 
 
+inline NodeArena* Document::nodeArena() const
+{
+	return _pArena;
+}
+
+
 } } // namespace Poco::XML
 
 
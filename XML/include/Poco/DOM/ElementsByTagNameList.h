@@ -20,6 +20,7 @@
 
 #include "Poco/XML/XML.h"
 #include "Poco/DOM/NodeList.h"
+#include "Poco/DOM/EventListener.h"
 #include "Poco/XML/XMLString.h"
 
 
@@ -27,10 +28,17 @@ namespace Poco {
 namespace XML {
 
 
-class XML_API ElementsByTagNameList: public NodeList
+class XML_API ElementsByTagNameList: public NodeList, protected EventListener
 	// This implementation of NodeList is returned
 	// by Document::getElementsByTagName() and
 	// Element::getElementsByTagName().
+	//
+	// To avoid restarting the preorder traversal on every
+	// call, item() caches the last returned element and its
+	// index and resumes the traversal from there, which makes
+	// sequential iteration over the list linear instead of
+	// quadratic. The cached cursor is discarded whenever a
+	// DOMSubtreeModified event is received from the parent.
 {
 public:
 	Node* item(unsigned long index) const;
@@ -43,20 +51,28 @@ protected:
 
 	Node* find(const Node* pParent, unsigned long index) const;
 
+	// EventListener
+	void handleEvent(Event* evt);
+
 	const Node* _pParent;
 	XMLString   _name;
 	mutable unsigned long _count;
-	
+	mutable Node* _pCursor;
+	mutable unsigned long _cursorIndex;
+
 	friend class AbstractContainerNode;
 	friend class Element;
 	friend class Document;
 };
 
 
-class XML_API ElementsByTagNameListNS: public NodeList
+class XML_API ElementsByTagNameListNS: public NodeList, protected EventListener
 	// This implementation of NodeList is returned
 	// by Document::getElementsByTagNameNS() and
 	// Element::getElementsByTagNameNS().
+	//
+	// Like ElementsByTagNameList, item() caches the last
+	// returned element and resumes the traversal from there.
 {
 public:
 	virtual Node* item(unsigned long index) const;
@@ -69,11 +85,16 @@ protected:
 
 	Node* find(const Node* pParent, unsigned long index) const;
 
+	// EventListener
+	void handleEvent(Event* evt);
+
 	const Node* _pParent;
 	XMLString   _localName;
 	XMLString   _namespaceURI;
 	mutable unsigned long _count;
-	
+	mutable Node* _pCursor;
+	mutable unsigned long _cursorIndex;
+
 	friend class AbstractContainerNode;
 	friend class Element;
 	friend class Document;
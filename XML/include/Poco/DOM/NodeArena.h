@@ -0,0 +1,90 @@
+//
+// NodeArena.h
+//
+// Library: XML
+// Package: DOM
+// Module:  DOM
+//
+// Definition of the NodeArena class.
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef DOM_NodeArena_INCLUDED
+#define DOM_NodeArena_INCLUDED
+
+
+#include "Poco/XML/XML.h"
+#include <cstddef>
+
+
+namespace Poco {
+namespace XML {
+
+
+class XML_API NodeArena
+	/// A simple block allocator for DOM nodes.
+	///
+	/// Memory is handed out by advancing a pointer within the
+	/// current block; a new block is allocated from the heap
+	/// whenever the current one is exhausted. Individual
+	/// allocations cannot be returned to the arena — all blocks
+	/// are freed at once when the arena is destroyed.
+	///
+	/// A NodeArena is used by Document to hold the entire node
+	/// tree of a document if arena allocation has been enabled
+	/// (see Document::enableArenaAllocation()).
+{
+public:
+	NodeArena();
+		/// Creates the NodeArena.
+
+	~NodeArena();
+		/// Destroys the NodeArena and frees all blocks.
+
+	void* allocate(std::size_t size);
+		/// Returns a pointer to size bytes of uninitialized,
+		/// suitably aligned memory owned by the arena.
+
+	std::size_t allocated() const;
+		/// Returns the total number of bytes handed out so far.
+
+private:
+	NodeArena(const NodeArena&);
+	NodeArena& operator = (const NodeArena&);
+
+	enum
+	{
+		BLOCK_SIZE = 65536,
+		ALIGNMENT  = 8
+	};
+
+	struct Block
+	{
+		Block* pNext;
+	};
+
+	Block*      _pBlocks;
+	char*       _pCurrent;
+	std::size_t _available;
+	std::size_t _allocated;
+};
+
+
+//
+// inlines
+//
+inline std::size_t NodeArena::allocated() const
+{
+	return _allocated;
+}
+
+
+} } // namespace Poco::XML
+
+
+#endif // DOM_NodeArena_INCLUDED
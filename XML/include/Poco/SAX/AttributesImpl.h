@@ -20,6 +20,7 @@
 
 #include "Poco/XML/XML.h"
 #include "Poco/SAX/Attributes.h"
+#include "Poco/HashMap.h"
 #include <vector>
 
 
@@ -132,6 +133,16 @@ public:
 	void reserve(std::size_t capacity);
 		/// Reserves capacity in the internal vector.
 
+	void resize(std::size_t count);
+		/// Resizes the attribute list to the given number of (empty)
+		/// attributes, reusing existing elements and their string
+		/// capacity. For internal use only.
+		/// The attributes must be filled by the caller.
+
+	Attribute& attribute(std::size_t index);
+		/// Returns a reference to the attribute with the given index.
+		/// For internal use only.
+
 	void setLocalName(int i, const XMLString& localName);
 		/// Sets the local name of an attribute.
 
@@ -155,8 +166,36 @@ protected:
 	Attribute* find(const XMLString& namespaceURI, const XMLString& localName) const;
 
 private:
+	struct NameHash
+	{
+		std::size_t operator () (const XMLString& name) const
+		{
+			std::size_t h = 0;
+			for (XMLString::const_iterator it = name.begin(); it != name.end(); ++it)
+				h = h*31 + static_cast<std::size_t>(*it);
+			return h;
+		}
+	};
+	typedef Poco::HashMap<XMLString, int, NameHash> NameIndexMap;
+
+	enum
+	{
+		HASHED_LOOKUP_THRESHOLD = 8,
+			/// Minimum number of attributes for which a hashed lookup
+			/// index is built; linear scans are faster below.
+
+		AMBIGUOUS_NAME = -2
+			/// Marks a local name mapped to by more than one namespace
+			/// URI; lookups fall back to a linear scan.
+	};
+
+	void buildIndex() const;
+
 	AttributeVec _attributes;
 	Attribute _empty;
+	mutable NameIndexMap _qnameIndex;
+	mutable NameIndexMap _nameIndex;
+	mutable bool _indexDirty;
 };
 
 
@@ -177,11 +216,27 @@ inline AttributesImpl::iterator AttributesImpl::end() const
 
 inline AttributesImpl::Attribute& AttributesImpl::addAttribute()
 {
+	_indexDirty = true;
 	_attributes.push_back(_empty);
 	return _attributes.back();
 }
 
 
+inline void AttributesImpl::resize(std::size_t count)
+{
+	_indexDirty = true;
+	_attributes.resize(count, _empty);
+}
+
+
+inline AttributesImpl::Attribute& AttributesImpl::attribute(std::size_t index)
+{
+	poco_assert (index < _attributes.size());
+	_indexDirty = true;
+	return _attributes[index];
+}
+
+
 inline int AttributesImpl::getLength() const
 {
 	return (int) _attributes.size();
@@ -114,6 +114,7 @@ public:
 	static const FeatureType RECEIVE_ATTRIBUTE_MAP = 0x0004;
 	static const FeatureType RECEIVE_ATTRIBUTES_EVENT = 0x0008;
 	static const FeatureType RECEIVE_NAMESPACE_DECLS = 0x0010;
+	static const FeatureType RECEIVE_CHARACTERS_RAW = 0x0020;
 	static const FeatureType RECEIVE_DEFAULT = RECEIVE_ELEMENTS | RECEIVE_CHARACTERS | RECEIVE_ATTRIBUTE_MAP;
 
 	struct XML_API AttributeValueType
@@ -217,6 +218,27 @@ public:
 	std::string& value();
 	const std::string& value() const;
 	template <typename T> T value() const;
+	const char* valueData() const;
+		/// Returns a pointer to the character data of the current
+		/// EV_CHARACTERS event. Whenever possible, the pointer refers
+		/// directly to the parse buffer, so no per-event copy or
+		/// allocation takes place; otherwise it refers to value().
+		///
+		/// Together with valueSize(), this provides a zero-copy
+		/// alternative to value() for scanning large documents.
+		/// The returned pointer is only valid until the next call
+		/// to next(), nextExpect() or peek().
+		///
+		/// With the RECEIVE_CHARACTERS_RAW feature set, element
+		/// character data that is available as a single contiguous
+		/// region is not copied into value() at all; value() then
+		/// returns an empty string for such events and valueData()
+		/// must be used instead. Character data that cannot be
+		/// delivered as one region (accumulated simple content, or
+		/// an event spanning internal parse buffers) is still copied
+		/// and valueData() falls back to value().
+	std::size_t valueSize() const;
+		/// Returns the size of the character data returned by valueData().
 	Poco::UInt64 line() const;
 	Poco::UInt64 column() const;
 	const std::string& attribute(const std::string& name) const;
@@ -301,6 +323,8 @@ private:
 	std::string _value;
 	const QName* _qualifiedName;
 	std::string* _pvalue;
+	const char* _valueRawData;
+	std::size_t _valueRawSize;
 	Poco::UInt64 _line;
 	Poco::UInt64 _column;
 
@@ -401,6 +425,18 @@ inline const std::string& XMLStreamParser::value() const
 }
 
 
+inline const char* XMLStreamParser::valueData() const
+{
+	return _valueRawData ? _valueRawData : _pvalue->data();
+}
+
+
+inline std::size_t XMLStreamParser::valueSize() const
+{
+	return _valueRawData ? _valueRawSize : _pvalue->size();
+}
+
+
 inline Poco::UInt64 XMLStreamParser::line() const
 {
 	return _line;
@@ -285,9 +285,11 @@ protected:
 	void writeStartElement(const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname, const Attributes& attributes);
 	void writeCanonicalStartElement(const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname, const Attributes& attributes);
 	void writeEndElement(const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname);
+	void writeAttributeValue(const XMLString& value);
 	void writeMarkup(const std::string& str) const;
 	void writeXML(const XMLString& str) const;
 	void writeXML(XMLChar ch) const;
+	void writeXML(const XMLChar* ch, std::size_t length) const;
 	void writeNewLine() const;
 	void writeIndent() const;
 	void writeIndent(int indent) const;
@@ -20,10 +20,24 @@
 #include "Poco/DOM/EventException.h"
 #include "Poco/DOM/DOMImplementation.h"
 #include "Poco/DOM/Attr.h"
+#include "Poco/DOM/NodeArena.h"
 #include "Poco/XML/Name.h"
 #include "Poco/DOM/AutoPtr.h"
 
 
+namespace
+{
+	union AllocHeader
+		// Prefixed to every node allocation; the union keeps the
+		// node following the header suitably aligned.
+	{
+		bool   fromArena;
+		double padding1;
+		void*  padding2;
+	};
+}
+
+
 namespace Poco {
 namespace XML {
 
@@ -32,6 +46,43 @@ const XMLString AbstractNode::NODE_NAME = toXMLString("#node");
 const XMLString AbstractNode::EMPTY_STRING;
 
 
+void* AbstractNode::operator new(std::size_t size)
+{
+	AllocHeader* pHeader = static_cast<AllocHeader*>(::operator new(size + sizeof(AllocHeader)));
+	pHeader->fromArena = false;
+	return pHeader + 1;
+}
+
+
+void* AbstractNode::operator new(std::size_t size, Document* pOwnerDocument)
+{
+	NodeArena* pArena = pOwnerDocument ? pOwnerDocument->nodeArena() : 0;
+	if (pArena)
+	{
+		AllocHeader* pHeader = static_cast<AllocHeader*>(pArena->allocate(size + sizeof(AllocHeader)));
+		pHeader->fromArena = true;
+		return pHeader + 1;
+	}
+	else return operator new(size);
+}
+
+
+void AbstractNode::operator delete(void* ptr)
+{
+	if (ptr)
+	{
+		AllocHeader* pHeader = static_cast<AllocHeader*>(ptr) - 1;
+		if (!pHeader->fromArena) ::operator delete(pHeader);
+	}
+}
+
+
+void AbstractNode::operator delete(void* ptr, Document* pOwnerDocument)
+{
+	operator delete(ptr);
+}
+
+
 AbstractNode::AbstractNode(Document* pOwnerDocument):
 	_pParent(0),
 	_pNext(0),
@@ -19,14 +19,16 @@ namespace Poco {
 namespace XML {
 
 
-AttributesImpl::AttributesImpl()
+AttributesImpl::AttributesImpl():
+	_indexDirty(true)
 {
 	_empty.specified = false;
 	_empty.type = XML_LIT("CDATA");
 }
 
 
-AttributesImpl::AttributesImpl(const Attributes& attributes)
+AttributesImpl::AttributesImpl(const Attributes& attributes):
+	_indexDirty(true)
 {
 	_empty.specified = false;
 	_empty.type = XML_LIT("CDATA");
@@ -36,7 +38,8 @@ AttributesImpl::AttributesImpl(const Attributes& attributes)
 
 AttributesImpl::AttributesImpl(const AttributesImpl& attributes):
 	_attributes(attributes._attributes),
-	_empty(attributes._empty)
+	_empty(attributes._empty),
+	_indexDirty(true)
 {
 }
 
@@ -51,6 +54,7 @@ AttributesImpl& AttributesImpl::operator = (const AttributesImpl& attributes)
 	if (&attributes != this)
 	{
 		_attributes = attributes._attributes;
+		_indexDirty = true;
 	}
 	return *this;
 }
@@ -58,6 +62,13 @@ AttributesImpl& AttributesImpl::operator = (const AttributesImpl& attributes)
 
 int AttributesImpl::getIndex(const XMLString& qname) const
 {
+	if (_attributes.size() >= HASHED_LOOKUP_THRESHOLD)
+	{
+		if (_indexDirty) buildIndex();
+		NameIndexMap::ConstIterator it = _qnameIndex.find(qname);
+		return it != _qnameIndex.end() ? it->second : -1;
+	}
+
 	int i = 0;
 	AttributeVec::const_iterator it;
 	for (it = _attributes.begin(); it != _attributes.end(); ++it)
@@ -71,6 +82,16 @@ int AttributesImpl::getIndex(const XMLString& qname) const
 
 int AttributesImpl::getIndex(const XMLString& namespaceURI, const XMLString& localName) const
 {
+	if (_attributes.size() >= HASHED_LOOKUP_THRESHOLD)
+	{
+		if (_indexDirty) buildIndex();
+		NameIndexMap::ConstIterator it = _nameIndex.find(localName);
+		if (it == _nameIndex.end()) return -1;
+		if (it->second != AMBIGUOUS_NAME)
+			return _attributes[it->second].namespaceURI == namespaceURI ? it->second : -1;
+		// More than one URI maps to this local name; scan.
+	}
+
 	int i = 0;
 	AttributeVec::const_iterator it;
 	for (it = _attributes.begin(); it != _attributes.end(); ++it)
@@ -130,6 +151,7 @@ void AttributesImpl::setAttributes(const Attributes& attributes)
 void AttributesImpl::setAttribute(int i, const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname, const XMLString& type, const XMLString& value)
 {
 	poco_assert (0 <= i && i < static_cast<int>(_attributes.size()));
+	_indexDirty = true;
 	_attributes[i].namespaceURI = namespaceURI;
 	_attributes[i].localName    = localName;
 	_attributes[i].qname        = qname;
@@ -141,6 +163,7 @@ void AttributesImpl::setAttribute(int i, const XMLString& namespaceURI, const XM
 
 void AttributesImpl::addAttribute(const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname, const XMLString& type, const XMLString& value)
 {
+	_indexDirty = true;
 	AttributeVec::iterator it = _attributes.insert(_attributes.end(), Attribute());
 	it->namespaceURI = namespaceURI;
 	it->localName    = localName;
@@ -153,6 +176,7 @@ void AttributesImpl::addAttribute(const XMLString& namespaceURI, const XMLString
 
 void AttributesImpl::addAttribute(const XMLString& namespaceURI, const XMLString& localName, const XMLString& qname, const XMLString& type, const XMLString& value, bool specified)
 {
+	_indexDirty = true;
 	AttributeVec::iterator it = _attributes.insert(_attributes.end(), Attribute());
 	it->namespaceURI = namespaceURI;
 	it->localName    = localName;
@@ -165,6 +189,7 @@ void AttributesImpl::addAttribute(const XMLString& namespaceURI, const XMLString
 
 void AttributesImpl::addAttribute(const XMLChar* namespaceURI, const XMLChar* localName, const XMLChar* qname, const XMLChar* type, const XMLChar* value, bool specified)
 {
+	_indexDirty = true;
 	AttributeVec::iterator it = _attributes.insert(_attributes.end(), Attribute());
 	it->namespaceURI = namespaceURI;
 	it->localName    = localName;
@@ -177,6 +202,7 @@ void AttributesImpl::addAttribute(const XMLChar* namespaceURI, const XMLChar* lo
 
 void AttributesImpl::removeAttribute(int i)
 {
+	_indexDirty = true;
 	int cur = 0;
 	for (AttributeVec::iterator it = _attributes.begin(); it != _attributes.end(); ++it, ++cur)
 	{
@@ -191,6 +217,7 @@ void AttributesImpl::removeAttribute(int i)
 
 void AttributesImpl::removeAttribute(const XMLString& qname)
 {
+	_indexDirty = true;
 	for (AttributeVec::iterator it = _attributes.begin(); it != _attributes.end(); ++it)
 	{
 		if (it->qname == qname)
@@ -204,6 +231,7 @@ void AttributesImpl::removeAttribute(const XMLString& qname)
 
 void AttributesImpl::removeAttribute(const XMLString& namespaceURI, const XMLString& localName)
 {
+	_indexDirty = true;
 	for (AttributeVec::iterator it = _attributes.begin(); it != _attributes.end(); ++it)
 	{
 		if (it->namespaceURI == namespaceURI && it->localName == localName)
@@ -217,6 +245,7 @@ void AttributesImpl::removeAttribute(const XMLString& namespaceURI, const XMLStr
 
 void AttributesImpl::clear()
 {
+	_indexDirty = true;
 	_attributes.clear();
 }
 
@@ -230,6 +259,7 @@ void AttributesImpl::reserve(std::size_t capacity)
 void AttributesImpl::setLocalName(int i, const XMLString& localName)
 {
 	poco_assert (0 <= i && i < static_cast<int>(_attributes.size()));
+	_indexDirty = true;
 	_attributes[i].localName = localName;
 }
 
@@ -237,6 +267,7 @@ void AttributesImpl::setLocalName(int i, const XMLString& localName)
 void AttributesImpl::setQName(int i, const XMLString& qname)
 {
 	poco_assert (0 <= i && i < static_cast<int>(_attributes.size()));
+	_indexDirty = true;
 	_attributes[i].qname = qname;
 }
 
@@ -251,29 +282,40 @@ void AttributesImpl::setType(int i, const XMLString& type)
 void AttributesImpl::setURI(int i, const XMLString& namespaceURI)
 {
 	poco_assert (0 <= i && i < static_cast<int>(_attributes.size()));
+	_indexDirty = true;
 	_attributes[i].namespaceURI = namespaceURI;
 }
 
 
 AttributesImpl::Attribute* AttributesImpl::find(const XMLString& qname) const
 {
-	for (AttributeVec::const_iterator it = _attributes.begin(); it != _attributes.end(); ++it)
-	{
-		if (it->qname == qname) 
-			return const_cast<Attribute*>(&(*it));
-	}
-	return 0;
+	int i = getIndex(qname);
+	return i >= 0 ? const_cast<Attribute*>(&_attributes[i]) : 0;
 }
 
 
 AttributesImpl::Attribute* AttributesImpl::find(const XMLString& namespaceURI, const XMLString& localName) const
 {
-	for (AttributeVec::const_iterator it = _attributes.begin(); it != _attributes.end(); ++it)
+	int i = getIndex(namespaceURI, localName);
+	return i >= 0 ? const_cast<Attribute*>(&_attributes[i]) : 0;
+}
+
+
+void AttributesImpl::buildIndex() const
+{
+	_qnameIndex.clear();
+	_nameIndex.clear();
+	int i = 0;
+	for (AttributeVec::const_iterator it = _attributes.begin(); it != _attributes.end(); ++it, ++i)
 	{
-		if (it->namespaceURI == namespaceURI && it->localName == localName) 
-			return const_cast<Attribute*>(&(*it));
+		// insert() keeps the first entry, preserving the first-match
+		// semantics of the linear scan for duplicate names.
+		_qnameIndex.insert(NameIndexMap::PairType(it->qname, i));
+		std::pair<NameIndexMap::Iterator, bool> n = _nameIndex.insert(NameIndexMap::PairType(it->localName, i));
+		if (!n.second && n.first->second != AMBIGUOUS_NAME && _attributes[n.first->second].namespaceURI != it->namespaceURI)
+			n.first->second = AMBIGUOUS_NAME;
 	}
-	return 0;
+	_indexDirty = false;
 }
 
 
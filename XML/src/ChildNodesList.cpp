@@ -15,6 +15,7 @@
 #include "Poco/DOM/ChildNodesList.h"
 #include "Poco/DOM/Node.h"
 #include "Poco/DOM/Document.h"
+#include "Poco/DOM/MutationEvent.h"
 
 
 namespace Poco {
@@ -22,32 +23,64 @@ namespace XML {
 
 
 ChildNodesList::ChildNodesList(const Node* pParent):
-	_pParent(pParent)
+	_pParent(pParent),
+	_pCursor(0),
+	_cursorIndex(0)
 {
 	poco_check_ptr (pParent);
 
 	_pParent->duplicate();
+	const_cast<Node*>(_pParent)->addEventListener(MutationEvent::DOMSubtreeModified, this, false);
 }
 
 
 ChildNodesList::~ChildNodesList()
 {
+	const_cast<Node*>(_pParent)->removeEventListener(MutationEvent::DOMSubtreeModified, this, false);
 	_pParent->release();
 }
 
 
 Node* ChildNodesList::item(unsigned long index) const
 {
-	unsigned long n = 0;
-	Node* pCur = _pParent->firstChild();
-	while (pCur && n++ < index)
+	unsigned long n;
+	Node* pCur;
+	if (_pCursor && index >= _cursorIndex && _pCursor->parentNode() == _pParent)
+	{
+		// Resume the walk at the node cached by the last call. The
+		// parentNode() check guards against structural changes made
+		// while mutation events were suspended.
+		n    = _cursorIndex;
+		pCur = _pCursor;
+	}
+	else
+	{
+		n    = 0;
+		pCur = _pParent->firstChild();
+	}
+	while (pCur && n < index)
 	{
 		pCur = pCur->nextSibling();
+		++n;
+	}
+	if (pCur)
+	{
+		_pCursor     = pCur;
+		_cursorIndex = n;
 	}
 	return pCur;
 }
 
 
+void ChildNodesList::handleEvent(Event* evt)
+{
+	// The subtree has been modified; the cached cursor may
+	// no longer reflect the correct position in the list.
+	_pCursor     = 0;
+	_cursorIndex = 0;
+}
+
+
 unsigned long ChildNodesList::length() const
 {
 	unsigned long n = 0;
@@ -37,14 +37,15 @@ namespace XML {
 const XMLString DOMBuilder::EMPTY_STRING;
 
 
-DOMBuilder::DOMBuilder(XMLReader& xmlReader, NamePool* pNamePool):
+DOMBuilder::DOMBuilder(XMLReader& xmlReader, NamePool* pNamePool, bool arenaAllocation):
 	_xmlReader(xmlReader),
 	_pNamePool(pNamePool),
 	_pDocument(0),
 	_pParent(0),
 	_pPrevious(0),
 	_inCDATA(false),
-	_namespaces(true)
+	_namespaces(true),
+	_arenaAllocation(arenaAllocation)
 {
 	_xmlReader.setContentHandler(this);
 	_xmlReader.setDTDHandler(this);
@@ -129,6 +130,7 @@ Document* DOMBuilder::parseMemoryNP(const char* xml, std::size_t size)
 void DOMBuilder::setupParse()
 {
 	_pDocument  = new Document(_pNamePool);
+	if (_arenaAllocation) _pDocument->enableArenaAllocation();
 	_pParent    = _pDocument;
 	_pPrevious  = 0;
 	_inCDATA    = false;
@@ -194,7 +196,7 @@ void DOMBuilder::startElement(const XMLString& uri, const XMLString& localName,
 	Attr* pPrevAttr = 0;
 	for (AttributesImpl::iterator it = attrs.begin(); it != attrs.end(); ++it)
 	{
-		AutoPtr<Attr> pAttr = new Attr(_pDocument, 0, it->namespaceURI, it->localName, it->qname, it->value, it->specified);
+		AutoPtr<Attr> pAttr = new (_pDocument) Attr(_pDocument, 0, it->namespaceURI, it->localName, it->qname, it->value, it->specified);
 		pPrevAttr = pElem->addAttributeNodeNP(pPrevAttr, pAttr);
 	}
 	appendNode(pElem);
@@ -270,7 +272,7 @@ void DOMBuilder::skippedEntity(const XMLString& name)
 
 void DOMBuilder::startDTD(const XMLString& name, const XMLString& publicId, const XMLString& systemId)
 {
-	AutoPtr<DocumentType> pDoctype = new DocumentType(_pDocument, name, publicId, systemId);
+	AutoPtr<DocumentType> pDoctype = new (_pDocument) DocumentType(_pDocument, name, publicId, systemId);
 	_pDocument->setDoctype(pDoctype);
 }
 
@@ -24,6 +24,7 @@
 #include "Poco/XML/XMLException.h"
 #include "Poco/Path.h"
 #include "Poco/FileStream.h"
+#include "Poco/MemoryStream.h"
 
 
 namespace Poco {
@@ -98,5 +99,18 @@ void DOMWriter::writeNode(const std::string& systemId, const Node* pNode)
 }
 
 
+std::size_t DOMWriter::writeNode(char* pBuffer, std::size_t size, const Node* pNode)
+{
+	poco_check_ptr (pBuffer);
+
+	Poco::MemoryOutputStream ostr(pBuffer, size);
+	writeNode(ostr, pNode);
+	ostr.flush();
+	if (!ostr.good())
+		throw XMLException("Buffer too small for serialized XML");
+	return static_cast<std::size_t>(ostr.charsWritten());
+}
+
+
 } } // namespace Poco::XML
 
@@ -25,6 +25,7 @@
 #include "Poco/DOM/EntityReference.h"
 #include "Poco/DOM/DOMException.h"
 #include "Poco/DOM/ElementsByTagNameList.h"
+#include "Poco/DOM/NodeArena.h"
 #include "Poco/DOM/Entity.h"
 #include "Poco/DOM/Notation.h"
 #include "Poco/XML/Name.h"
@@ -41,7 +42,9 @@ const XMLString Document::NODE_NAME = toXMLString("#document");
 Document::Document(NamePool* pNamePool): 
 	AbstractContainerNode(0),
 	_pDocumentType(0),
-	_eventSuspendLevel(0)
+	_pArena(0),
+	_eventSuspendLevel(0),
+	_idMapValid(false)
 {
 	if (pNamePool)
 	{
@@ -59,7 +62,9 @@ Document::Document(unsigned long namePoolSize):
 	AbstractContainerNode(0),
 	_pDocumentType(0),
 	_pNamePool(new NamePool(namePoolSize)),
-	_eventSuspendLevel(0)
+	_pArena(0),
+	_eventSuspendLevel(0),
+	_idMapValid(false)
 {
 }
 
@@ -67,7 +72,9 @@ Document::Document(unsigned long namePoolSize):
 Document::Document(DocumentType* pDocumentType, NamePool* pNamePool): 
 	AbstractContainerNode(0),
 	_pDocumentType(pDocumentType),
-	_eventSuspendLevel(0)
+	_pArena(0),
+	_eventSuspendLevel(0),
+	_idMapValid(false)
 {
 	if (pNamePool)
 	{
@@ -90,7 +97,9 @@ Document::Document(DocumentType* pDocumentType, unsigned long namePoolSize):
 	AbstractContainerNode(0),
 	_pDocumentType(pDocumentType),
 	_pNamePool(new NamePool(namePoolSize)),
-	_eventSuspendLevel(0)
+	_pArena(0),
+	_eventSuspendLevel(0),
+	_idMapValid(false)
 {
 	if (_pDocumentType)
 	{
@@ -103,7 +112,34 @@ Document::Document(DocumentType* pDocumentType, unsigned long namePoolSize):
 Document::~Document()
 {
 	if (_pDocumentType) _pDocumentType->release();
+	_pDocumentType = 0;
+	if (_pArena)
+	{
+		// Arena-allocated nodes must be destroyed while the arena still
+		// exists; the AbstractContainerNode destructor and the auto
+		// release pool's destructor would run too late for that.
+		_autoReleasePool.release();
+		AbstractNode* pChild = _pFirstChild;
+		_pFirstChild = 0;
+		while (pChild)
+		{
+			AbstractNode* pDelNode = pChild;
+			pChild = pChild->_pNext;
+			pDelNode->_pNext   = 0;
+			pDelNode->_pParent = 0;
+			pDelNode->release();
+		}
+	}
 	_pNamePool->release();
+	delete _pArena;
+}
+
+
+void Document::enableArenaAllocation()
+{
+	poco_assert (firstChild() == 0);
+
+	if (!_pArena) _pArena = new NodeArena;
 }
 
 
@@ -130,6 +166,9 @@ void Document::resumeEvents()
 	poco_assert_dbg (_eventSuspendLevel > 0);
 
 	--_eventSuspendLevel;
+	// Mutations made while events were suspended have not been seen
+	// by the ID index; force a rebuild on the next lookup.
+	if (_eventSuspendLevel == 0) _idMapValid = false;
 }
 
 
@@ -155,49 +194,49 @@ Element* Document::documentElement() const
 
 Element* Document::createElement(const XMLString& tagName) const
 {
-	return new Element(const_cast<Document*>(this), EMPTY_STRING, EMPTY_STRING, tagName); 
+	return new (const_cast<Document*>(this)) Element(const_cast<Document*>(this), EMPTY_STRING, EMPTY_STRING, tagName); 
 }
 
 
 DocumentFragment* Document::createDocumentFragment() const
 {
-	return new DocumentFragment(const_cast<Document*>(this));
+	return new (const_cast<Document*>(this)) DocumentFragment(const_cast<Document*>(this));
 }
 
 
 Text* Document::createTextNode(const XMLString& data) const
 {
-	return new Text(const_cast<Document*>(this), data);
+	return new (const_cast<Document*>(this)) Text(const_cast<Document*>(this), data);
 }
 
 
 Comment* Document::createComment(const XMLString& data) const
 {
-	return new Comment(const_cast<Document*>(this), data);
+	return new (const_cast<Document*>(this)) Comment(const_cast<Document*>(this), data);
 }
 
 
 CDATASection* Document::createCDATASection(const XMLString& data) const
 {
-	return new CDATASection(const_cast<Document*>(this), data);
+	return new (const_cast<Document*>(this)) CDATASection(const_cast<Document*>(this), data);
 }
 
 
 ProcessingInstruction* Document::createProcessingInstruction(const XMLString& target, const XMLString& data) const
 {
-	return new ProcessingInstruction(const_cast<Document*>(this), target, data);
+	return new (const_cast<Document*>(this)) ProcessingInstruction(const_cast<Document*>(this), target, data);
 }
 
 
 Attr* Document::createAttribute(const XMLString& name) const
 {
-	return new Attr(const_cast<Document*>(this), 0, EMPTY_STRING, EMPTY_STRING, name, EMPTY_STRING);
+	return new (const_cast<Document*>(this)) Attr(const_cast<Document*>(this), 0, EMPTY_STRING, EMPTY_STRING, name, EMPTY_STRING);
 }
 
 
 EntityReference* Document::createEntityReference(const XMLString& name) const
 {
-	return new EntityReference(const_cast<Document*>(this), name);
+	return new (const_cast<Document*>(this)) EntityReference(const_cast<Document*>(this), name);
 }
 
 
@@ -227,13 +266,13 @@ Node* Document::importNode(Node* importedNode, bool deep)
 
 Element* Document::createElementNS(const XMLString& namespaceURI, const XMLString& qualifiedName) const
 {
-	return new Element(const_cast<Document*>(this), namespaceURI, Name::localName(qualifiedName), qualifiedName);
+	return new (const_cast<Document*>(this)) Element(const_cast<Document*>(this), namespaceURI, Name::localName(qualifiedName), qualifiedName);
 }
 
 
 Attr* Document::createAttributeNS(const XMLString& namespaceURI, const XMLString& qualifiedName) const
 {
-	return new Attr(const_cast<Document*>(this), 0, namespaceURI, Name::localName(qualifiedName), qualifiedName, EMPTY_STRING);
+	return new (const_cast<Document*>(this)) Attr(const_cast<Document*>(this), 0, namespaceURI, Name::localName(qualifiedName), qualifiedName, EMPTY_STRING);
 }
 
 
@@ -297,24 +336,82 @@ bool Document::events() const
 
 Entity* Document::createEntity(const XMLString& name, const XMLString& publicId, const XMLString& systemId, const XMLString& notationName) const
 {
-	return new Entity(const_cast<Document*>(this), name, publicId, systemId, notationName);
+	return new (const_cast<Document*>(this)) Entity(const_cast<Document*>(this), name, publicId, systemId, notationName);
 }
 
 
 Notation* Document::createNotation(const XMLString& name, const XMLString& publicId, const XMLString& systemId) const
 {
-	return new Notation(const_cast<Document*>(this), name, publicId, systemId);
+	return new (const_cast<Document*>(this)) Notation(const_cast<Document*>(this), name, publicId, systemId);
 }
 
 
 Element* Document::getElementById(const XMLString& elementId, const XMLString& idAttribute) const
 {
+	if (!_idAttribute.empty() && idAttribute == _idAttribute)
+	{
+		if (!_idMapValid) buildIdMap();
+		IdMap::const_iterator it = _idMap.find(elementId);
+		return it != _idMap.end() ? it->second : 0;
+	}
 	Element* pElem = documentElement();
 	if (pElem) pElem = pElem->getElementById(elementId, idAttribute);
 	return pElem;
 }
 
 
+void Document::enableIdIndex(const XMLString& idAttribute)
+{
+	poco_assert (!idAttribute.empty());
+
+	if (_idAttribute.empty())
+	{
+		addEventListener(MutationEvent::DOMSubtreeModified, this, false);
+		addEventListener(MutationEvent::DOMAttrModified, this, false);
+	}
+	_idAttribute = idAttribute;
+	_idMapValid  = false;
+}
+
+
+void Document::handleEvent(Event* evt)
+{
+	// The document has been modified; the ID index is rebuilt
+	// on the next lookup.
+	_idMapValid = false;
+}
+
+
+void Document::buildIdMap() const
+{
+	_idMap.clear();
+	Node* pCur = documentElement();
+	while (pCur)
+	{
+		if (pCur->nodeType() == Node::ELEMENT_NODE)
+		{
+			Element* pElem = static_cast<Element*>(pCur);
+			if (pElem->hasAttribute(_idAttribute))
+			{
+				// insert() does not overwrite, so the first element
+				// in preorder wins, as with the linear search.
+				_idMap.insert(IdMap::value_type(pElem->getAttribute(_idAttribute), pElem));
+			}
+		}
+		if (pCur->firstChild())
+		{
+			pCur = pCur->firstChild();
+		}
+		else
+		{
+			while (pCur && !pCur->nextSibling()) pCur = pCur->parentNode();
+			if (pCur) pCur = pCur->nextSibling();
+		}
+	}
+	_idMapValid = true;
+}
+
+
 Element* Document::getElementByIdNS(const XMLString& elementId, const XMLString& idAttributeURI, const XMLString& idAttributeLocalName) const
 {
 	Element* pElem = documentElement();
@@ -15,6 +15,7 @@
 #include "Poco/DOM/ElementsByTagNameList.h"
 #include "Poco/DOM/Node.h"
 #include "Poco/DOM/Document.h"
+#include "Poco/DOM/MutationEvent.h"
 #include <climits>
 
 
@@ -22,27 +23,91 @@ namespace Poco {
 namespace XML {
 
 
+namespace
+{
+	static const XMLString asterisk = toXMLString("*");
+
+
+	Node* nextPreorder(const Node* pRoot, Node* pNode)
+		// Returns the successor of pNode in a preorder traversal
+		// of the subtree rooted at pRoot (pRoot itself excluded),
+		// or null if pNode is the last node of the traversal.
+	{
+		if (pNode->firstChild()) return pNode->firstChild();
+		while (pNode && pNode != pRoot)
+		{
+			if (pNode->nextSibling()) return pNode->nextSibling();
+			pNode = pNode->parentNode();
+		}
+		return 0;
+	}
+
+
+	bool inSubtree(const Node* pRoot, const Node* pNode)
+	{
+		while (pNode && pNode != pRoot)
+		{
+			pNode = pNode->parentNode();
+		}
+		return pNode != 0;
+	}
+}
+
+
 ElementsByTagNameList::ElementsByTagNameList(const Node* pParent, const XMLString& name):
 	_pParent(pParent),
 	_name(name),
-	_count(0)
+	_count(0),
+	_pCursor(0),
+	_cursorIndex(0)
 {
 	poco_check_ptr (pParent);
-	
+
 	_pParent->duplicate();
+	const_cast<Node*>(_pParent)->addEventListener(MutationEvent::DOMSubtreeModified, this, false);
 }
 
 
 ElementsByTagNameList::~ElementsByTagNameList()
 {
+	const_cast<Node*>(_pParent)->removeEventListener(MutationEvent::DOMSubtreeModified, this, false);
 	_pParent->release();
 }
 
 
 Node* ElementsByTagNameList::item(unsigned long index) const
 {
-	_count = 0;
-	return find(_pParent, index);
+	unsigned long n;
+	Node* pCur;
+	if (_pCursor && index >= _cursorIndex && inSubtree(_pParent, _pCursor))
+	{
+		// Resume the traversal at the element cached by the last
+		// call. The inSubtree() check guards against structural
+		// changes made while mutation events were suspended.
+		if (index == _cursorIndex) return _pCursor;
+		pCur = nextPreorder(_pParent, _pCursor);
+		n    = _cursorIndex + 1;
+	}
+	else
+	{
+		pCur = _pParent->firstChild();
+		n    = 0;
+	}
+	while (pCur)
+	{
+		if (pCur->nodeType() == Node::ELEMENT_NODE && (_name == asterisk || pCur->nodeName() == _name))
+		{
+			if (n == index)
+			{
+				_pCursor     = pCur;
+				_cursorIndex = index;
+				return pCur;
+			}
+			n++;
+		}
+		pCur = nextPreorder(_pParent, pCur);
+	}
+	return 0;
 }
 
 
@@ -54,9 +119,12 @@ unsigned long ElementsByTagNameList::length() const
 }
 
 
-namespace
+void ElementsByTagNameList::handleEvent(Event* evt)
 {
-	static const XMLString asterisk = toXMLString("*");
+	// The subtree has been modified; the cached cursor may
+	// no longer reflect the correct position in the list.
+	_pCursor     = 0;
+	_cursorIndex = 0;
 }
 
 
@@ -91,25 +159,57 @@ ElementsByTagNameListNS::ElementsByTagNameListNS(const Node* pParent, const XMLS
 	_pParent(pParent),
 	_localName(localName),
 	_namespaceURI(namespaceURI),
-	_count(0)
+	_count(0),
+	_pCursor(0),
+	_cursorIndex(0)
 {
 	poco_check_ptr (pParent);
-	
+
 	_pParent->duplicate();
+	const_cast<Node*>(_pParent)->addEventListener(MutationEvent::DOMSubtreeModified, this, false);
 }
 
 
 
 ElementsByTagNameListNS::~ElementsByTagNameListNS()
 {
+	const_cast<Node*>(_pParent)->removeEventListener(MutationEvent::DOMSubtreeModified, this, false);
 	_pParent->release();
 }
 
 
 Node* ElementsByTagNameListNS::item(unsigned long index) const
 {
-	_count = 0;
-	return find(_pParent, index);
+	unsigned long n;
+	Node* pCur;
+	if (_pCursor && index >= _cursorIndex && inSubtree(_pParent, _pCursor))
+	{
+		// Resume the traversal at the element cached by the last
+		// call (see ElementsByTagNameList::item()).
+		if (index == _cursorIndex) return _pCursor;
+		pCur = nextPreorder(_pParent, _pCursor);
+		n    = _cursorIndex + 1;
+	}
+	else
+	{
+		pCur = _pParent->firstChild();
+		n    = 0;
+	}
+	while (pCur)
+	{
+		if (pCur->nodeType() == Node::ELEMENT_NODE && (_localName == asterisk || pCur->localName() == _localName) && (_namespaceURI == asterisk || pCur->namespaceURI() == _namespaceURI))
+		{
+			if (n == index)
+			{
+				_pCursor     = pCur;
+				_cursorIndex = index;
+				return pCur;
+			}
+			n++;
+		}
+		pCur = nextPreorder(_pParent, pCur);
+	}
+	return 0;
 }
 
 
@@ -121,6 +221,14 @@ unsigned long ElementsByTagNameListNS::length() const
 }
 
 
+void ElementsByTagNameListNS::handleEvent(Event* evt)
+{
+	// See ElementsByTagNameList::handleEvent().
+	_pCursor     = 0;
+	_cursorIndex = 0;
+}
+
+
 Node* ElementsByTagNameListNS::find(const Node* pParent, unsigned long index) const
 {
 	if (!pParent) return 0;
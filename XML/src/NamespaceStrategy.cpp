@@ -42,6 +42,8 @@ void NamespaceStrategy::splitName(const XMLChar* qname, XMLString& uri, XMLStrin
 			return;
 		}
 	}
+	// No namespace: clear the (possibly reused) uri string.
+	uri.assign(XML_LIT(""));
 	localName = qname;
 }
 
@@ -86,13 +88,17 @@ void NoNamespacesStrategy::startElement(const XMLChar* name, const XMLChar** att
 {
 	poco_assert_dbg (name && atts && pContentHandler);
 
-	_attrs.clear();
-	for (int i = 0; *atts; ++i)
+	// Resize instead of clearing and re-adding, so that the attribute
+	// strings keep their buffers across events.
+	std::size_t count = 0;
+	for (const XMLChar** p = atts; *p; p += 2) ++count;
+	_attrs.resize(count);
+	for (std::size_t i = 0; i < count; ++i)
 	{
-		AttributesImpl::Attribute& attr = _attrs.addAttribute();
+		AttributesImpl::Attribute& attr = _attrs.attribute(i);
 		attr.qname.assign(*atts++);
 		attr.value.assign(*atts++);
-		attr.specified = i < specifiedCount;
+		attr.specified = static_cast<int>(i) < specifiedCount;
 	}
 	_name.assign(name);
 	pContentHandler->startElement(NOTHING, NOTHING, _name, _attrs);
@@ -123,15 +129,17 @@ void NoNamespacePrefixesStrategy::startElement(const XMLChar* name, const XMLCha
 {
 	poco_assert_dbg (name && atts && pContentHandler);
 
-	_attrs.clear();
-	for (int i = 0; *atts; ++i)
+	std::size_t count = 0;
+	for (const XMLChar** p = atts; *p; p += 2) ++count;
+	_attrs.resize(count);
+	for (std::size_t i = 0; i < count; ++i)
 	{
 		const XMLChar* attrName  = *atts++;
 		const XMLChar* attrValue = *atts++;
-		AttributesImpl::Attribute& attr = _attrs.addAttribute();
+		AttributesImpl::Attribute& attr = _attrs.attribute(i);
 		splitName(attrName, attr.namespaceURI, attr.localName);
 		attr.value.assign(attrValue);
-		attr.specified = i < specifiedCount;
+		attr.specified = static_cast<int>(i) < specifiedCount;
 	}
 	splitName(name, _uri, _local);
 	pContentHandler->startElement(_uri, _local, NOTHING, _attrs);
@@ -162,17 +170,19 @@ void NamespacePrefixesStrategy::startElement(const XMLChar* name, const XMLChar*
 {
 	poco_assert_dbg (name && atts && pContentHandler);
 
-	_attrs.clear();
-	for (int i = 0; *atts; ++i)
+	std::size_t count = 0;
+	for (const XMLChar** p = atts; *p; p += 2) ++count;
+	_attrs.resize(count);
+	for (std::size_t i = 0; i < count; ++i)
 	{
 		const XMLChar* attrName  = *atts++;
 		const XMLChar* attrValue = *atts++;
-		AttributesImpl::Attribute& attr = _attrs.addAttribute();
+		AttributesImpl::Attribute& attr = _attrs.attribute(i);
 		splitName(attrName, attr.namespaceURI, attr.localName, attr.qname);
 		if (!attr.qname.empty()) attr.qname += ':';
 		attr.qname.append(attr.localName);
 		attr.value.assign(attrValue);
-		attr.specified = i < specifiedCount;
+		attr.specified = static_cast<int>(i) < specifiedCount;
 	}
 	splitName(name, _uri, _local, _qname);
 	if (!_qname.empty()) _qname += ':';
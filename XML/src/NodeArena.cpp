@@ -0,0 +1,67 @@
+//
+// NodeArena.cpp
+//
+// Library: XML
+// Package: DOM
+// Module:  DOM
+//
+// Copyright (c) 2004-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/DOM/NodeArena.h"
+#include <new>
+
+
+namespace Poco {
+namespace XML {
+
+
+NodeArena::NodeArena():
+	_pBlocks(0),
+	_pCurrent(0),
+	_available(0),
+	_allocated(0)
+{
+}
+
+
+NodeArena::~NodeArena()
+{
+	Block* pBlock = _pBlocks;
+	while (pBlock)
+	{
+		Block* pNext = pBlock->pNext;
+		::operator delete(pBlock);
+		pBlock = pNext;
+	}
+}
+
+
+void* NodeArena::allocate(std::size_t size)
+{
+	size = (size + ALIGNMENT - 1) & ~static_cast<std::size_t>(ALIGNMENT - 1);
+	if (size > _available)
+	{
+		// The block header is padded to the alignment boundary so that
+		// the memory following it is suitably aligned as well.
+		const std::size_t header = (sizeof(Block) + ALIGNMENT - 1) & ~static_cast<std::size_t>(ALIGNMENT - 1);
+		std::size_t blockSize = header + (size > static_cast<std::size_t>(BLOCK_SIZE) ? size : static_cast<std::size_t>(BLOCK_SIZE));
+		Block* pBlock = static_cast<Block*>(::operator new(blockSize));
+		pBlock->pNext = _pBlocks;
+		_pBlocks   = pBlock;
+		_pCurrent  = reinterpret_cast<char*>(pBlock) + header;
+		_available = blockSize - header;
+	}
+	void* ptr = _pCurrent;
+	_pCurrent  += size;
+	_available -= size;
+	_allocated += size;
+	return ptr;
+}
+
+
+} } // namespace Poco::XML
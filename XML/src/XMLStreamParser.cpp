@@ -122,6 +122,8 @@ void XMLStreamParser::init()
 
 	_qualifiedName = &_qname;
 	_pvalue = &_value;
+	_valueRawData = 0;
+	_valueRawSize = 0;
 
 	_line = 0;
 	_column = 0;
@@ -439,6 +441,12 @@ XMLStreamParser::EventType XMLStreamParser::nextImpl(bool peek)
 
 XMLStreamParser::EventType XMLStreamParser::nextBody()
 {
+	// Whatever comes next, the raw character data of the previous event
+	// is no longer current (and, once parsing resumes, no longer valid).
+	//
+	_valueRawData = 0;
+	_valueRawSize = 0;
+
 	// See if we have any start namespace declarations we need to return.
 	//
 	if (_startNamespaceIndex < _startNamespace.size())
@@ -877,12 +885,34 @@ void XMLCALL XMLStreamParser::handleCharacters(void* v, const XML_Char* s, int n
 	if (p._accumulateContent || ps.parsing != XML_PARSING)
 	{
 		poco_assert(p._currentEvent == EV_CHARACTERS);
+
+		// This is a followup chunk of the same event; a single
+		// contiguous view is no longer possible, so fall back to
+		// the accumulated copy.
+		//
+		if (p._valueRawData)
+		{
+			if (p._value.empty())
+				p._value.assign(p._valueRawData, p._valueRawSize);
+			p._valueRawData = 0;
+			p._valueRawSize = 0;
+		}
 		p._value.append(s, n);
 	}
 	else
 	{
 		p._currentEvent = EV_CHARACTERS;
-		p._value.assign(s, n);
+
+		// The buffer Expat gave us remains valid while the parser is
+		// suspended, that is, until the next call to next() or peek().
+		//
+		p._valueRawData = s;
+		p._valueRawSize = static_cast<std::size_t>(n);
+
+		if ((p._feature & RECEIVE_CHARACTERS_RAW) == 0 || cont == Content::Simple)
+			p._value.assign(s, n);
+		else
+			p._value.clear();
 
 		p._line = XML_GetCurrentLineNumber(p._parser);
 		p._column = XML_GetCurrentColumnNumber(p._parser);
@@ -316,28 +316,36 @@ void XMLWriter::characters(const XMLChar ch[], int start, int length)
 	_contentWritten = _contentWritten || length > 0;
 	if (_inCDATA)
 	{
-		while (length-- > 0) writeXML(ch[start++]);
+		writeXML(ch + start, length);
 	}
 	else
 	{
-		while (length-- > 0)
+		// Instead of looking at one character at a time, scan for the
+		// next character that needs to be escaped and emit the clean
+		// run before it in one piece.
+		const XMLChar* p = ch + start;
+		const XMLChar* pEnd = p + length;
+		while (p != pEnd)
 		{
-			XMLChar c = ch[start++];
-			switch (c)
+			const XMLChar* run = p;
+			while (p != pEnd)
 			{
-			case '"':  writeMarkup(MARKUP_QUOTENC); break;
-			case '&':  writeMarkup(MARKUP_AMPENC); break;
-			case '<':  writeMarkup(MARKUP_LTENC); break;
-			case '>':  writeMarkup(MARKUP_GTENC); break;
-			default:
-				if (c >= 0 && c < 32)
+				XMLChar c = *p;
+				if (c == '"' || c == '&' || c == '<' || c == '>') break;
+				if (c >= 0 && c < 32 && c != '\t' && c != '\r' && c != '\n') break;
+				++p;
+			}
+			if (p != run) writeXML(run, p - run);
+			if (p != pEnd)
+			{
+				switch (*p++)
 				{
-					if (c == '\t' || c == '\r' || c == '\n')
-						writeXML(c);
-					else
-						throw XMLException("Invalid character token.");
+				case '"':  writeMarkup(MARKUP_QUOTENC); break;
+				case '&':  writeMarkup(MARKUP_AMPENC); break;
+				case '<':  writeMarkup(MARKUP_LTENC); break;
+				case '>':  writeMarkup(MARKUP_GTENC); break;
+				default:   throw XMLException("Invalid character token.");
 				}
-				else writeXML(c);
 			}
 		}
 	}
@@ -457,7 +465,7 @@ void XMLWriter::comment(const XMLChar ch[], int start, int length)
 	if (_unclosedStartTag) closeStartTag();
 	prettyPrint();
 	writeMarkup("<!--");
-	while (length-- > 0) writeXML(ch[start++]);
+	writeXML(ch + start, length);
 	writeMarkup("-->");
 	_contentWritten = false;
 }
@@ -911,25 +919,7 @@ void XMLWriter::writeAttributes(const AttributeMap& attributeMap)
 		}
 		writeXML(it->first);
 		writeMarkup(MARKUP_EQQUOT);
-		for (XMLString::const_iterator itc = it->second.begin(); itc != it->second.end(); ++itc)
-		{
-			XMLChar c = *itc;
-			switch (c)
-			{
-			case '"':  writeMarkup(MARKUP_QUOTENC); break;
-			case '&':  writeMarkup(MARKUP_AMPENC); break;
-			case '<':  writeMarkup(MARKUP_LTENC); break;
-			case '>':  writeMarkup(MARKUP_GTENC); break;
-			case '\t': writeMarkup(MARKUP_TABENC); break;
-			case '\r': writeMarkup(MARKUP_CRENC); break;
-			case '\n': writeMarkup(MARKUP_LFENC); break;
-			default:
-				if (c >= 0 && c < 32)
-					throw XMLException("Invalid character token.");
-				else 
-					writeXML(c);
-			}
-		}
+		writeAttributeValue(it->second);
 		writeMarkup(MARKUP_QUOT);
 	}
 }
@@ -950,10 +940,30 @@ void XMLWriter::writeAttributes(const CanonicalAttributeMap& attributeMap)
 		}
 		writeXML(it->second.first);
 		writeMarkup(MARKUP_EQQUOT);
-		for (XMLString::const_iterator itc = it->second.second.begin(); itc != it->second.second.end(); ++itc)
+		writeAttributeValue(it->second.second);
+		writeMarkup(MARKUP_QUOT);
+	}
+}
+
+
+void XMLWriter::writeAttributeValue(const XMLString& value)
+{
+	const XMLChar* p = value.data();
+	const XMLChar* pEnd = p + value.size();
+	while (p != pEnd)
+	{
+		const XMLChar* run = p;
+		while (p != pEnd)
 		{
-			XMLChar c = *itc;
-			switch (c)
+			XMLChar c = *p;
+			if (c == '"' || c == '&' || c == '<' || c == '>') break;
+			if (c >= 0 && c < 32) break;
+			++p;
+		}
+		if (p != run) writeXML(run, p - run);
+		if (p != pEnd)
+		{
+			switch (*p++)
 			{
 			case '"':  writeMarkup(MARKUP_QUOTENC); break;
 			case '&':  writeMarkup(MARKUP_AMPENC); break;
@@ -962,14 +972,9 @@ void XMLWriter::writeAttributes(const CanonicalAttributeMap& attributeMap)
 			case '\t': writeMarkup(MARKUP_TABENC); break;
 			case '\r': writeMarkup(MARKUP_CRENC); break;
 			case '\n': writeMarkup(MARKUP_LFENC); break;
-			default:
-				if (c >= 0 && c < 32)
-					throw XMLException("Invalid character token.");
-				else 
-					writeXML(c);
+			default:   throw XMLException("Invalid character token.");
 			}
 		}
-		writeMarkup(MARKUP_QUOT);
 	}
 }
 
@@ -997,6 +1002,12 @@ void XMLWriter::writeXML(XMLChar ch) const
 }
 
 
+void XMLWriter::writeXML(const XMLChar* ch, std::size_t length) const
+{
+	_pTextConverter->write((const char*) ch, (int) (length*sizeof(XMLChar)));
+}
+
+
 void XMLWriter::writeName(const XMLString& prefix, const XMLString& localName)
 {
 	if (prefix.empty())
@@ -12,6 +12,7 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/SAX/AttributesImpl.h"
+#include "Poco/NumberFormatter.h"
 
 
 using Poco::XML::AttributesImpl;
@@ -221,6 +222,43 @@ void AttributesImplTest::testCopy()
 }
 
 
+void AttributesImplTest::testHashedLookup()
+{
+	// Enough attributes to cross the hashed lookup threshold.
+	AttributesImpl attrs;
+	for (int i = 0; i < 16; ++i)
+	{
+		std::string n = "a" + Poco::NumberFormatter::format(i);
+		attrs.addAttribute("urn:ns", n, "p:" + n, "CDATA", "v" + Poco::NumberFormatter::format(i));
+	}
+	assert (attrs.getLength() == 16);
+	for (int i = 0; i < 16; ++i)
+	{
+		std::string n = "a" + Poco::NumberFormatter::format(i);
+		assert (attrs.getIndex("p:" + n) == i);
+		assert (attrs.getIndex("urn:ns", n) == i);
+		assert (attrs.getValue("p:" + n) == "v" + Poco::NumberFormatter::format(i));
+		assert (attrs.getValue("urn:ns", n) == "v" + Poco::NumberFormatter::format(i));
+	}
+	assert (attrs.getIndex("p:a16") == -1);
+	assert (attrs.getIndex("urn:other", "a1") == -1);
+
+	// Same local name under two URIs must still resolve correctly.
+	attrs.addAttribute("urn:other", "a1", "q:a1", "CDATA", "other");
+	assert (attrs.getIndex("urn:ns", "a1") == 1);
+	assert (attrs.getIndex("urn:other", "a1") == 16);
+	assert (attrs.getValue("urn:other", "a1") == "other");
+
+	// The index follows modifications.
+	attrs.removeAttribute("urn:ns", "a0");
+	assert (attrs.getIndex("urn:ns", "a0") == -1);
+	assert (attrs.getIndex("urn:ns", "a1") == 0);
+	attrs.setLocalName(0, "b1");
+	assert (attrs.getIndex("urn:ns", "a1") == -1);
+	assert (attrs.getIndex("urn:ns", "b1") == 0);
+}
+
+
 void AttributesImplTest::setUp()
 {
 }
@@ -239,6 +277,7 @@ CppUnit::Test* AttributesImplTest::suite()
 	CppUnit_addTest(pSuite, AttributesImplTest, testNamespaces);
 	CppUnit_addTest(pSuite, AttributesImplTest, testAccessors);
 	CppUnit_addTest(pSuite, AttributesImplTest, testCopy);
+	CppUnit_addTest(pSuite, AttributesImplTest, testHashedLookup);
 
 	return pSuite;
 }
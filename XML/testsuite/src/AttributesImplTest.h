@@ -28,6 +28,7 @@ public:
 	void testNamespaces();
 	void testAccessors();
 	void testCopy();
+	void testHashedLookup();
 
 	void setUp();
 	void tearDown();
@@ -15,6 +15,7 @@
 #include "Poco/DOM/Element.h"
 #include "Poco/DOM/NodeList.h"
 #include "Poco/DOM/AutoPtr.h"
+#include "Poco/NumberFormatter.h"
 
 
 using Poco::XML::Element;
@@ -82,6 +83,48 @@ void ChildNodesTest::testChildNodes()
 }
 
 
+void ChildNodesTest::testChildNodesCursor()
+{
+	AutoPtr<Document> pDoc = new Document;
+	AutoPtr<Element> pRoot = pDoc->createElement("root");
+	pDoc->appendChild(pRoot);
+
+	const unsigned long n = 100;
+	for (unsigned long i = 0; i < n; i++)
+	{
+		AutoPtr<Element> pChild = pDoc->createElement("child" + Poco::NumberFormatter::format(i));
+		pRoot->appendChild(pChild);
+	}
+
+	AutoPtr<NodeList> pNL = pRoot->childNodes();
+	assert (pNL->length() == n);
+
+	// forward iteration resumes the walk from the cached cursor
+	for (unsigned long i = 0; i < n; i++)
+	{
+		assert (pNL->item(i)->nodeName() == "child" + Poco::NumberFormatter::format(i));
+	}
+	assert (pNL->item(n) == 0);
+
+	// repeated and backward accesses
+	assert (pNL->item(50) == pNL->item(50));
+	assert (pNL->item(10)->nodeName() == "child10");
+	assert (pNL->item(0)->nodeName() == "child0");
+
+	// mutations invalidate the cached cursor
+	Node* pChild42 = pNL->item(42);
+	pRoot->removeChild(pChild42);
+	assert (pNL->length() == n - 1);
+	assert (pNL->item(42)->nodeName() == "child43");
+	assert (pNL->item(41)->nodeName() == "child41");
+
+	AutoPtr<Element> pNewChild = pDoc->createElement("newChild");
+	pRoot->insertBefore(pNewChild, pNL->item(0));
+	assert (pNL->item(0) == pNewChild);
+	assert (pNL->item(1)->nodeName() == "child0");
+}
+
+
 void ChildNodesTest::setUp()
 {
 }
@@ -97,6 +140,7 @@ CppUnit::Test* ChildNodesTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ChildNodesTest");
 
 	CppUnit_addTest(pSuite, ChildNodesTest, testChildNodes);
+	CppUnit_addTest(pSuite, ChildNodesTest, testChildNodesCursor);
 
 	return pSuite;
 }
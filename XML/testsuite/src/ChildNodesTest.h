@@ -25,6 +25,7 @@ public:
 	~ChildNodesTest();
 
 	void testChildNodes();
+	void testChildNodesCursor();
 
 	void setUp();
 	void tearDown();
@@ -17,6 +17,9 @@
 #include "Poco/DOM/NodeList.h"
 #include "Poco/DOM/AutoPtr.h"
 #include "Poco/DOM/DOMException.h"
+#include "Poco/DOM/DOMParser.h"
+#include "Poco/DOM/NodeArena.h"
+#include "Poco/DOM/Attr.h"
 
 
 using Poco::XML::Element;
@@ -27,6 +30,9 @@ using Poco::XML::NodeList;
 using Poco::XML::AutoPtr;
 using Poco::XML::XMLString;
 using Poco::XML::DOMException;
+using Poco::XML::DOMParser;
+using Poco::XML::NodeArena;
+using Poco::XML::Attr;
 
 
 DocumentTest::DocumentTest(const std::string& name): CppUnit::TestCase(name)
@@ -220,6 +226,47 @@ void DocumentTest::testElementById()
 }
 
 
+void DocumentTest::testElementByIdIndex()
+{
+	AutoPtr<Document> pDoc = new Document;
+	pDoc->enableIdIndex("id");
+	AutoPtr<Element> pRoot = pDoc->createElement("root");
+	pRoot->setAttribute("id", "0");
+	AutoPtr<Element> pElem1 = pDoc->createElement("elem");
+	pElem1->setAttribute("id", "1");
+	AutoPtr<Element> pElem2 = pDoc->createElement("elem");
+	pElem2->setAttribute("id", "2");
+
+	pElem1->appendChild(pElem2);
+	pRoot->appendChild(pElem1);
+	pDoc->appendChild(pRoot);
+
+	assert (pDoc->getElementById("0", "id") == pRoot);
+	assert (pDoc->getElementById("1", "id") == pElem1);
+	assert (pDoc->getElementById("2", "id") == pElem2);
+	assert (pDoc->getElementById("3", "id") == 0);
+
+	// lookups with a different ID attribute bypass the index
+	assert (pDoc->getElementById("0", "ID") == 0);
+
+	// attribute modifications invalidate the index
+	pElem2->setAttribute("id", "2a");
+	assert (pDoc->getElementById("2", "id") == 0);
+	assert (pDoc->getElementById("2a", "id") == pElem2);
+
+	// structural modifications invalidate the index
+	AutoPtr<Element> pElem3 = pDoc->createElement("elem");
+	pElem3->setAttribute("id", "3");
+	pRoot->appendChild(pElem3);
+	assert (pDoc->getElementById("3", "id") == pElem3);
+
+	pRoot->removeChild(pElem1);
+	assert (pDoc->getElementById("1", "id") == 0);
+	assert (pDoc->getElementById("2a", "id") == 0);
+	assert (pDoc->getElementById("3", "id") == pElem3);
+}
+
+
 void DocumentTest::testElementByIdNS()
 {
 	AutoPtr<Document> pDoc = new Document;
@@ -262,6 +309,42 @@ void DocumentTest::testElementByIdNS()
 }
 
 
+void DocumentTest::testArenaAllocation()
+{
+	{
+		AutoPtr<Document> pDoc = new Document;
+		assert (pDoc->nodeArena() == 0);
+		pDoc->enableArenaAllocation();
+		assert (pDoc->nodeArena() != 0);
+
+		AutoPtr<Element> pRoot = pDoc->createElement("root");
+		AutoPtr<Text> pText = pDoc->createTextNode("text");
+		pRoot->appendChild(pText);
+		pDoc->appendChild(pRoot);
+		assert (pDoc->nodeArena()->allocated() > 0);
+
+		AutoPtr<Attr> pAttr = pDoc->createAttribute("a1");
+		pAttr->setValue("v1");
+		pRoot->setAttributeNode(pAttr);
+
+		assert (pDoc->documentElement() == pRoot);
+		assert (pRoot->innerText() == "text");
+		assert (pRoot->getAttribute("a1") == "v1");
+	}
+
+	DOMParser parser;
+	parser.setFeature(DOMParser::FEATURE_ARENA_ALLOCATION, true);
+	assert (parser.getFeature(DOMParser::FEATURE_ARENA_ALLOCATION));
+	AutoPtr<Document> pDoc = parser.parseString("<!-- comment --><root a1=\"v1\"><![CDATA[cdata]]><elem>text</elem></root>");
+	assert (pDoc->nodeArena() != 0);
+	assert (pDoc->nodeArena()->allocated() > 0);
+	Element* pRoot = pDoc->documentElement();
+	assert (pRoot->tagName() == "root");
+	assert (pRoot->getAttribute("a1") == "v1");
+	assert (pRoot->innerText() == "cdatatext");
+}
+
+
 void DocumentTest::setUp()
 {
 }
@@ -282,7 +365,9 @@ CppUnit::Test* DocumentTest::suite()
 	CppUnit_addTest(pSuite, DocumentTest, testElementsByTagName);
 	CppUnit_addTest(pSuite, DocumentTest, testElementsByTagNameNS);
 	CppUnit_addTest(pSuite, DocumentTest, testElementById);
+	CppUnit_addTest(pSuite, DocumentTest, testElementByIdIndex);
 	CppUnit_addTest(pSuite, DocumentTest, testElementByIdNS);
+	CppUnit_addTest(pSuite, DocumentTest, testArenaAllocation);
 
 	return pSuite;
 }
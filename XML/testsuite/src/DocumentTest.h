@@ -30,7 +30,9 @@ public:
 	void testElementsByTagName();
 	void testElementsByTagNameNS();
 	void testElementById();
+	void testElementByIdIndex();
 	void testElementByIdNS();
+	void testArenaAllocation();
 
 	void setUp();
 	void tearDown();
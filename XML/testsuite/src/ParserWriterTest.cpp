@@ -13,6 +13,7 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/DOM/DOMParser.h"
 #include "Poco/DOM/DOMWriter.h"
+#include "Poco/XML/XMLException.h"
 #include "Poco/DOM/Document.h"
 #include "Poco/DOM/Element.h"
 #include "Poco/DOM/AutoPtr.h"
@@ -104,6 +105,38 @@ void ParserWriterTest::testParseWriteSimple()
 }
 
 
+void ParserWriterTest::testWriteToBuffer()
+{
+	static const std::string simple =
+		"<config>"
+		"<prop1>a &amp; b &lt;&gt; c</prop1>"
+		"<prop2 name=\"x &quot;y&quot;\">value2</prop2>"
+		"</config>";
+
+	std::istringstream istr(simple);
+
+	DOMParser parser;
+	parser.setFeature(XMLReader::FEATURE_NAMESPACE_PREFIXES, false);
+	InputSource source(istr);
+	AutoPtr<Document> pDoc = parser.parse(&source);
+
+	DOMWriter writer;
+	char buffer[256];
+	std::size_t n = writer.writeNode(buffer, sizeof(buffer), pDoc);
+	assert (std::string(buffer, n) == simple);
+
+	char small[16];
+	try
+	{
+		writer.writeNode(small, sizeof(small), pDoc);
+		fail("buffer too small - must throw");
+	}
+	catch (Poco::XML::XMLException&)
+	{
+	}
+}
+
+
 void ParserWriterTest::setUp()
 {
 }
@@ -121,6 +154,7 @@ CppUnit::Test* ParserWriterTest::suite()
 	CppUnit_addTest(pSuite, ParserWriterTest, testParseWriteXHTML);
 	CppUnit_addTest(pSuite, ParserWriterTest, testParseWriteXHTML2);
 	CppUnit_addTest(pSuite, ParserWriterTest, testParseWriteSimple);
+	CppUnit_addTest(pSuite, ParserWriterTest, testWriteToBuffer);
 
 	return pSuite;
 }
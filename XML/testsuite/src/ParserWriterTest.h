@@ -28,6 +28,7 @@ public:
 	void testParseWriteXHTML2();
 	void testParseWriteWSDL();
 	void testParseWriteSimple();
+	void testWriteToBuffer();
 
 	void setUp();
 	void tearDown();
@@ -483,6 +483,79 @@ void XMLStreamParserTest::testParser()
 }
 
 
+void XMLStreamParserTest::testRawCharacters()
+{
+	// Raw character data views.
+	//
+	{
+		std::istringstream is("<root>hello</root>");
+		XMLStreamParser p(is, "test");
+
+		p.nextExpect(XMLStreamParser::EV_START_ELEMENT, "root");
+		assert(p.next() == XMLStreamParser::EV_CHARACTERS);
+		assert(p.value() == "hello");
+		assert(std::string(p.valueData(), p.valueSize()) == "hello");
+		p.nextExpect(XMLStreamParser::EV_END_ELEMENT);
+	}
+
+	// With RECEIVE_CHARACTERS_RAW the data is not copied into value().
+	//
+	{
+		std::istringstream is("<root>hello</root>");
+		XMLStreamParser p(is, "test", XMLStreamParser::RECEIVE_DEFAULT | XMLStreamParser::RECEIVE_CHARACTERS_RAW);
+
+		p.nextExpect(XMLStreamParser::EV_START_ELEMENT, "root");
+		assert(p.next() == XMLStreamParser::EV_CHARACTERS);
+		assert(p.value().empty());
+		assert(std::string(p.valueData(), p.valueSize()) == "hello");
+		p.nextExpect(XMLStreamParser::EV_END_ELEMENT);
+	}
+
+	// Character data interrupted by entity references is delivered
+	// as multiple events; each exposes a contiguous raw view.
+	//
+	{
+		std::istringstream is("<root>one &amp; two</root>");
+		XMLStreamParser p(is, "test", XMLStreamParser::RECEIVE_DEFAULT | XMLStreamParser::RECEIVE_CHARACTERS_RAW);
+
+		p.nextExpect(XMLStreamParser::EV_START_ELEMENT, "root");
+		std::string text;
+		while (p.peek() == XMLStreamParser::EV_CHARACTERS)
+		{
+			p.next();
+			text.append(p.valueData(), p.valueSize());
+		}
+		assert(text == "one & two");
+		p.nextExpect(XMLStreamParser::EV_END_ELEMENT);
+	}
+
+	// Accumulated simple content is always copied.
+	//
+	{
+		std::istringstream is("<root>one &amp; two</root>");
+		XMLStreamParser p(is, "test", XMLStreamParser::RECEIVE_DEFAULT | XMLStreamParser::RECEIVE_CHARACTERS_RAW);
+
+		p.nextExpect(XMLStreamParser::EV_START_ELEMENT, "root");
+		p.content(Content::Simple);
+		assert(p.next() == XMLStreamParser::EV_CHARACTERS);
+		assert(p.value() == "one & two");
+		assert(std::string(p.valueData(), p.valueSize()) == "one & two");
+		p.nextExpect(XMLStreamParser::EV_END_ELEMENT);
+	}
+
+	// Attribute values are always delivered from the copy.
+	//
+	{
+		std::istringstream is("<root a=\"v\"/>");
+		XMLStreamParser p(is, "test", XMLStreamParser::RECEIVE_DEFAULT | XMLStreamParser::RECEIVE_CHARACTERS_RAW);
+
+		p.nextExpect(XMLStreamParser::EV_START_ELEMENT, "root");
+		assert(p.attribute("a") == "v");
+		p.nextExpect(XMLStreamParser::EV_END_ELEMENT);
+	}
+}
+
+
 void XMLStreamParserTest::setUp()
 {
 }
@@ -498,6 +571,7 @@ CppUnit::Test* XMLStreamParserTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("XMLStreamParserTest");
 
 	CppUnit_addTest(pSuite, XMLStreamParserTest, testParser);
+	CppUnit_addTest(pSuite, XMLStreamParserTest, testRawCharacters);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~XMLStreamParserTest();
 
 	void testParser();
+	void testRawCharacters();
 
 	void setUp();
 	void tearDown();
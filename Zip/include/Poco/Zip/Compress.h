@@ -21,12 +21,22 @@
 #include "Poco/Zip/Zip.h"
 #include "Poco/Zip/ZipArchive.h"
 #include "Poco/FIFOEvent.h"
+#include "Poco/Condition.h"
+#include "Poco/Mutex.h"
+#include "Poco/Runnable.h"
+#include "Poco/SharedPtr.h"
 #include <istream>
 #include <ostream>
 #include <set>
+#include <vector>
 
 
 namespace Poco {
+
+
+class ThreadPool;
+
+
 namespace Zip {
 
 
@@ -38,7 +48,11 @@ public:
 
 	Compress(std::ostream& out, bool seekableOut, bool forceZip64 = false);
 		/// seekableOut determines how we write the zip, setting it to true is recommended for local files (smaller zip file),
-		/// if you are compressing directly to a network, you MUST set it to false
+		/// if you are compressing directly to a network, you MUST set it to false.
+		/// With seekableOut set to false, CRC and sizes are written in a data descriptor
+		/// following each entry's data (general purpose bit 3), so the archive is emitted
+		/// strictly sequentially and the output stream is never seeked - entries can be
+		/// streamed directly to a socket without temporary storage.
 		/// If forceZip64 is set true then the file header is allocated with zip64 extension so that it can be updated after the file data is written
 		/// if seekableOut is true in case the compressed or uncompressed size exceeds 32 bits.
 
@@ -70,6 +84,26 @@ public:
 	ZipArchive close();
 		/// Finalizes the ZipArchive, closes it.
 
+	void setParallel(Poco::ThreadPool& pool);
+		/// Compresses files added via the path-based addFile() and via
+		/// addRecursive() on the given thread pool. Each entry is deflated
+		/// into a private buffer (deflating one entry is independent of the
+		/// archive stream) and appended to the Zip file in completion order.
+		/// EDone is fired as usual when an entry has been written, from the
+		/// pool thread that wrote it.
+		///
+		/// When the pool has no idle thread, the entry is compressed on the
+		/// calling thread instead. close() waits for all outstanding entries
+		/// and rethrows the first error that occurred on a pool thread.
+		///
+		/// Call setParallel() before adding the first file; the pool must
+		/// outlive the Compress object.
+
+	void waitForTasks();
+		/// Waits until all entries handed to the thread pool have been
+		/// written to the Zip file (see setParallel()) and throws a
+		/// ZipException when one of them failed. Called by close().
+
 	void setStoreExtensions(const std::set<std::string>& extensions);
 		/// Sets the file extensions for which the CM_STORE compression method
 		/// is used if CM_AUTO is specified in addFile() or addRecursive().
@@ -105,7 +139,21 @@ private:
 	void addFileRaw(std::istream& in, const ZipLocalFileHeader& hdr, const Poco::Path& fileName);
 		/// copys an already compressed ZipEntry from in
 
+	void compressEntryToBuffer(const Poco::Path& file, const Poco::DateTime& lastModifiedAt, const Poco::Path& fileName, ZipCommon::CompressionMethod cm, ZipCommon::CompressionLevel cl);
+		/// Deflates the file into a private buffer and appends the finished
+		/// entry to the Zip file via addFileRaw(). Runs on a pool thread
+		/// when parallel compression is enabled.
+
+	void taskFinished();
+		/// Marks one pool task as done, waking up waitForTasks().
+
+	void taskFailed(const std::string& msg);
+		/// Records the first error that occurred on a pool thread.
+
 private:
+	class EntryTask;
+	friend class EntryTask;
+
 	std::set<std::string>        _storeExtensions;
 	std::ostream&                _out;
 	bool                         _seekableOut;
@@ -116,6 +164,13 @@ private:
 	ZipArchive::DirectoryInfos64 _dirs64;
 	Poco::UInt64				 _offset;
     std::string                  _comment;
+	Poco::ThreadPool*            _pPool;
+	Poco::Mutex                  _outMutex;
+	Poco::FastMutex              _taskMutex;
+	Poco::Condition              _tasksDone;
+	int                          _activeTasks;
+	std::string                  _taskError;
+	std::vector<Poco::SharedPtr<Poco::Runnable> > _tasks;
 
 	friend class Keep;
 	friend class Rename;
@@ -127,6 +182,12 @@ private:
 //
 
 
+inline void Compress::setParallel(Poco::ThreadPool& pool)
+{
+	_pPool = &pool;
+}
+
+
 inline void Compress::setZipComment(const std::string& comment)
 {
 	_comment = comment;
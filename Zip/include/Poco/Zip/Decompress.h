@@ -23,9 +23,17 @@
 #include "Poco/Zip/ZipArchive.h"
 #include "Poco/Path.h"
 #include "Poco/FIFOEvent.h"
+#include "Poco/FileStream.h"
+#include "Poco/Condition.h"
+#include "Poco/Mutex.h"
 
 
 namespace Poco {
+
+
+class ThreadPool;
+
+
 namespace Zip {
 
 
@@ -50,6 +58,16 @@ public:
 		/// If flattenDirs is set to true, the directory structure of the zip file is not recreated. 
 		/// Instead, all files are extracted into one single directory.
 
+	Decompress(const std::string& zipFile, const Poco::Path& outputDir, Poco::ThreadPool& pool, bool flattenDirs = false, bool keepIncompleteFiles = false);
+		/// Creates a Decompress that extracts entries in parallel on the given thread pool.
+		/// Since every entry occupies an independent compressed span in the zip file, each
+		/// worker opens its own handle on zipFile and inflates entries directly at their
+		/// local header offsets. The calling thread takes part in the extraction, so
+		/// decompressAllFiles() makes progress even when the pool is busy.
+		///
+		/// EOk and EError are fired per entry as in serial mode, from the thread that
+		/// extracted the entry. The pool must outlive the Decompress object.
+
 	~Decompress();
 		/// Destroys the Decompress.
 
@@ -64,17 +82,38 @@ public:
 		/// If for a ZipFileInfo no mapping exists, there was an error during decompression and the entry is considered to be corrupt
 
 private:
+	class WorkerTask;
+	friend class WorkerTask;
+
 	Decompress(const Decompress&);
 	Decompress& operator=(const Decompress&);
 
 	void onOk(const void*, std::pair<const ZipLocalFileHeader, const Poco::Path>& val);
 
+	ZipArchive decompressAllFilesParallel();
+		/// Parses the archive structure, then partitions the file entries
+		/// across the thread pool; see the parallel constructor.
+
+	void taskFinished();
+		/// Marks one pool task as done, waking up decompressAllFilesParallel().
+
+	void taskFailed(const std::string& msg);
+		/// Records the first error that occurred on a pool thread.
+
 private:
+	Poco::FileInputStream _inFile;
 	std::istream& _in;
 	Poco::Path    _outDir;
 	bool          _flattenDirs;
 	bool          _keepIncompleteFiles;
 	ZipMapping    _mapping;
+	std::string   _zipPath;
+	Poco::ThreadPool* _pPool;
+	Poco::FastMutex   _mappingMutex;
+	Poco::FastMutex   _taskMutex;
+	Poco::Condition   _tasksDone;
+	int               _activeTasks;
+	std::string       _taskError;
 };
 
 
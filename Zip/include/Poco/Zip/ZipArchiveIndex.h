@@ -0,0 +1,137 @@
+//
+// ZipArchiveIndex.h
+//
+// Library: Zip
+// Package: Zip
+// Module:  ZipArchiveIndex
+//
+// Definition of the ZipArchiveIndex class.
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Zip_ZipArchiveIndex_INCLUDED
+#define Zip_ZipArchiveIndex_INCLUDED
+
+
+#include "Poco/Zip/Zip.h"
+#include "Poco/Zip/ZipFileInfo.h"
+#include "Poco/SharedMemory.h"
+#include <map>
+
+
+namespace Poco {
+namespace Zip {
+
+
+class Zip_API ZipArchiveIndex
+	/// A ZipArchiveIndex provides lazy access to the central directory
+	/// of a Zip file.
+	///
+	/// Unlike ZipArchive, which parses every central directory record into
+	/// a ZipFileInfo at construction, the ZipArchiveIndex memory-maps the
+	/// file, locates the end of central directory record and only builds a
+	/// lightweight file name to record offset index. The full ZipFileInfo
+	/// of an entry is parsed from the mapped directory on first access and
+	/// cached. For archives with a very large number of entries this makes
+	/// opening considerably cheaper when only a few entries are needed.
+{
+public:
+	typedef std::map<std::string, std::streamoff> OffsetIndex;
+
+	ZipArchiveIndex(const std::string& path);
+		/// Memory-maps the given Zip file and indexes its central directory.
+		/// Throws a ZipException if the file is not a Zip archive.
+
+	~ZipArchiveIndex();
+		/// Destroys the ZipArchiveIndex and unmaps the file.
+
+	std::size_t size() const;
+		/// Returns the number of entries in the central directory.
+
+	bool hasEntry(const std::string& fileName) const;
+		/// Returns true when the archive contains an entry with the given
+		/// name (as stored in the Zip file, forward slashes).
+
+	const ZipFileInfo& fileInfo(const std::string& fileName);
+		/// Returns the directory entry for the given name, parsing it from
+		/// the mapped central directory on first access.
+		/// Throws a ZipException when the entry does not exist.
+
+	OffsetIndex::const_iterator begin() const;
+		/// Iterates over the entry names and their central directory offsets.
+
+	OffsetIndex::const_iterator end() const;
+
+	const std::string& getZipComment() const;
+		/// Returns the (optional) Zip comment.
+
+private:
+	typedef std::map<std::string, ZipFileInfo> InfoCache;
+
+	ZipArchiveIndex(const ZipArchiveIndex&);
+	ZipArchiveIndex& operator=(const ZipArchiveIndex&);
+
+	void locateCentralDirectory();
+		/// Finds the end of central directory record (and its Zip64
+		/// variant) and determines offset and size of the directory.
+
+	void buildIndex();
+		/// Walks the mapped central directory once, recording the offset
+		/// of every record.
+
+	Poco::SharedMemory _mapping;
+	const char*        _data;
+	std::size_t        _size;
+	std::streamoff     _dirOffset;
+	Poco::UInt64       _dirSize;
+	Poco::UInt64       _expectedEntries;
+	std::string        _comment;
+	OffsetIndex        _index;
+	InfoCache          _cache;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t ZipArchiveIndex::size() const
+{
+	return _index.size();
+}
+
+
+inline bool ZipArchiveIndex::hasEntry(const std::string& fileName) const
+{
+	return _index.find(fileName) != _index.end();
+}
+
+
+inline ZipArchiveIndex::OffsetIndex::const_iterator ZipArchiveIndex::begin() const
+{
+	return _index.begin();
+}
+
+
+inline ZipArchiveIndex::OffsetIndex::const_iterator ZipArchiveIndex::end() const
+{
+	return _index.end();
+}
+
+
+inline const std::string& ZipArchiveIndex::getZipComment() const
+{
+	return _comment;
+}
+
+
+} } // namespace Poco::Zip
+
+
+#endif // Zip_ZipArchiveIndex_INCLUDED
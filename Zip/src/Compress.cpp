@@ -22,12 +22,59 @@
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
 #include "Poco/String.h"
+#include "Poco/ThreadPool.h"
+#include <sstream>
 
 
 namespace Poco {
 namespace Zip {
 
 
+class Compress::EntryTask: public Poco::Runnable
+	/// Compresses one file on a thread pool thread; see Compress::setParallel().
+{
+public:
+	EntryTask(Compress& compress, const Poco::Path& file, const Poco::DateTime& lastModifiedAt, const Poco::Path& fileName, ZipCommon::CompressionMethod cm, ZipCommon::CompressionLevel cl):
+		_compress(compress),
+		_file(file),
+		_lastModifiedAt(lastModifiedAt),
+		_fileName(fileName),
+		_cm(cm),
+		_cl(cl)
+	{
+	}
+
+	void run()
+	{
+		try
+		{
+			_compress.compressEntryToBuffer(_file, _lastModifiedAt, _fileName, _cm, _cl);
+		}
+		catch (Poco::Exception& exc)
+		{
+			_compress.taskFailed(exc.displayText());
+		}
+		catch (std::exception& exc)
+		{
+			_compress.taskFailed(exc.what());
+		}
+		catch (...)
+		{
+			_compress.taskFailed("unknown exception");
+		}
+		_compress.taskFinished();
+	}
+
+private:
+	Compress&                    _compress;
+	Poco::Path                   _file;
+	Poco::DateTime               _lastModifiedAt;
+	Poco::Path                   _fileName;
+	ZipCommon::CompressionMethod _cm;
+	ZipCommon::CompressionLevel  _cl;
+};
+
+
 Compress::Compress(std::ostream& out, bool seekableOut, bool forceZip64):
 	_out(out),
 	_seekableOut(seekableOut),
@@ -35,7 +82,9 @@ Compress::Compress(std::ostream& out, bool seekableOut, bool forceZip64):
 	_files(),
 	_infos(),
 	_dirs(),
-	_offset(0)
+	_offset(0),
+	_pPool(0),
+	_activeTasks(0)
 {
 	_storeExtensions.insert("gif");
 	_storeExtensions.insert("png");
@@ -81,6 +130,8 @@ void Compress::addEntry(std::istream& in, const Poco::DateTime& lastModifiedAt,
 		cl = ZipCommon::CL_NORMAL;
 	}
 
+	Poco::Mutex::ScopedLock writeLock(_outMutex);
+
 	std::streamoff localHeaderOffset = _offset;
 	ZipLocalFileHeader hdr(fileName, lastModifiedAt, cm, cl, _forceZip64);
 	hdr.setStartPos(localHeaderOffset);
@@ -115,11 +166,17 @@ void Compress::addFileRaw(std::istream& in, const ZipLocalFileHeader& h, const P
 	in.seekg(h.getDataStartPos(), std::ios_base::beg);
 	if (!in.good()) throw Poco::IOException("Failed to seek on input stream");
 
+	Poco::Mutex::ScopedLock writeLock(_outMutex);
+
 	std::streamoff localHeaderOffset = _offset;
 	ZipLocalFileHeader hdr(h);
 	hdr.setFileName(fn, h.isDirectory());
 	hdr.setStartPos(localHeaderOffset);
-	if (hdr.needsZip64())
+	// CRC and sizes are already known for a raw copy, so the final header
+	// (including the Zip64 extra field) can be emitted up front; no
+	// seek-back patch is needed and raw copies work on non-seekable
+	// output streams, too
+	if (hdr.needsZip64() || hdr.hasExtraField())
 		hdr.setZip64Data();
 	//bypass zipoutputstream
 	//write the header directly
@@ -169,15 +226,6 @@ void Compress::addFileRaw(std::istream& in, const ZipLocalFileHeader& h, const P
 			_offset += ZipDataInfo::getFullHeaderSize();
 		}
 	}
-	else
-	{
-		if (hdr.hasExtraField())	 // Update sizes in header extension.
-			hdr.setZip64Data();
-		_out.seekp(hdr.getStartPos(), std::ios_base::beg);
-		std::string header = hdr.createHeader();
-		_out.write(header.c_str(), static_cast<std::streamsize>(header.size()));
-		_out.seekp(0, std::ios_base::end);
-	}
 
 	_files.insert(std::make_pair(fileName.toString(Poco::Path::PATH_UNIX), hdr));
 	if (!_out) throw Poco::IOException("Bad output stream");
@@ -189,6 +237,89 @@ void Compress::addFileRaw(std::istream& in, const ZipLocalFileHeader& h, const P
 }
 
 
+void Compress::compressEntryToBuffer(const Poco::Path& file, const Poco::DateTime& lastModifiedAt, const Poco::Path& fileName, ZipCommon::CompressionMethod cm, ZipCommon::CompressionLevel cl)
+{
+	Poco::FileInputStream in(file.toString());
+
+	if (cm == ZipCommon::CM_AUTO)
+	{
+		std::string ext = Poco::toLower(fileName.getExtension());
+		if (_storeExtensions.find(ext) != _storeExtensions.end())
+		{
+			cm = ZipCommon::CM_STORE;
+			cl = ZipCommon::CL_NORMAL;
+		}
+		else
+		{
+			cm = ZipCommon::CM_DEFLATE;
+		}
+	}
+
+	std::string fn = ZipUtil::validZipEntryFileName(fileName);
+
+	if (!in.good())
+		throw ZipException("Invalid input stream");
+
+	// see addEntry(): empty files must be stored
+	const int eof = std::char_traits<char>::eof();
+	int firstChar = in.get();
+	if (firstChar == eof)
+	{
+		cm = ZipCommon::CM_STORE;
+		cl = ZipCommon::CL_NORMAL;
+	}
+
+	// Deflate into a private buffer with CRC and sizes in a data descriptor
+	// after the payload; deflating is independent of the archive stream, so
+	// multiple entries can be compressed concurrently. The finished entry
+	// is then appended to the archive under the output lock.
+	std::stringstream buffer;
+	ZipLocalFileHeader hdr(fileName, lastModifiedAt, cm, cl, _forceZip64);
+	hdr.setStartPos(0);
+
+	ZipOutputStream zipOut(buffer, hdr, false);
+	if (firstChar != eof)
+	{
+		zipOut.put(static_cast<char>(firstChar));
+		Poco::StreamCopier::copyStream(in, zipOut);
+	}
+	Poco::UInt64 extraDataSize;
+	zipOut.close(extraDataSize);
+
+	addFileRaw(buffer, hdr, fileName);
+}
+
+
+void Compress::taskFinished()
+{
+	Poco::FastMutex::ScopedLock lock(_taskMutex);
+	poco_assert_dbg (_activeTasks > 0);
+	if (--_activeTasks == 0) _tasksDone.broadcast();
+}
+
+
+void Compress::taskFailed(const std::string& msg)
+{
+	Poco::FastMutex::ScopedLock lock(_taskMutex);
+	if (_taskError.empty()) _taskError = msg;
+}
+
+
+void Compress::waitForTasks()
+{
+	std::string error;
+	{
+		Poco::FastMutex::ScopedLock lock(_taskMutex);
+		while (_activeTasks > 0)
+			_tasksDone.wait(_taskMutex);
+		_tasks.clear();
+		error = _taskError;
+		_taskError.clear();
+	}
+	if (!error.empty()) throw ZipException("Parallel compression failed", error);
+}
+
+
 void Compress::addFile(std::istream& in, const Poco::DateTime& lastModifiedAt, const Poco::Path& fileName, ZipCommon::CompressionMethod cm, ZipCommon::CompressionLevel cl)
 {
 	if (!fileName.isFile())
@@ -205,12 +336,37 @@ void Compress::addFile(std::istream& in, const Poco::DateTime& lastModifiedAt, c
 void Compress::addFile(const Poco::Path& file, const Poco::Path& fileName, ZipCommon::CompressionMethod cm, ZipCommon::CompressionLevel cl)
 {
 	Poco::File aFile(file);
-	Poco::FileInputStream in(file.toString());
 	if (fileName.depth() > 1)
 	{
 		Poco::File aParent(file.parent());
 		addDirectory(fileName.parent(), aParent.getLastModified());
 	}
+
+	if (_pPool)
+	{
+		if (!fileName.isFile())
+			throw ZipException("Not a file: "+ fileName.toString());
+
+		Poco::SharedPtr<Poco::Runnable> pTask = new EntryTask(*this, file, aFile.getLastModified(), fileName, cm, cl);
+		{
+			Poco::FastMutex::ScopedLock lock(_taskMutex);
+			++_activeTasks;
+			_tasks.push_back(pTask);
+		}
+		try
+		{
+			_pPool->start(*pTask);
+		}
+		catch (Poco::NoThreadAvailableException&)
+		{
+			// pool exhausted: compress on the calling thread
+			taskFinished();
+			compressEntryToBuffer(file, aFile.getLastModified(), fileName, cm, cl);
+		}
+		return;
+	}
+
+	Poco::FileInputStream in(file.toString());
 	addFile(in, aFile.getLastModified(), fileName, cm, cl);
 }
 
@@ -220,6 +376,8 @@ void Compress::addDirectory(const Poco::Path& entryName, const Poco::DateTime& l
 	if (!entryName.isDirectory())
 		throw ZipException("Not a directory: "+ entryName.toString());
 
+	Poco::Mutex::ScopedLock writeLock(_outMutex); // recursive: parent directories are added while holding the lock
+
 	std::string fileStr = entryName.toString(Poco::Path::PATH_UNIX);
 	if (_files.find(fileStr) != _files.end())
 		return; // ignore duplicate add
@@ -311,6 +469,8 @@ void Compress::addRecursive(const Poco::Path& entry, ZipCommon::CompressionMetho
 
 ZipArchive Compress::close()
 {
+	waitForTasks();
+
 	if (!_dirs.empty() || ! _dirs64.empty())
 		return ZipArchive(_files, _infos, _dirs, _dirs64);
 
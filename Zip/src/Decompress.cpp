@@ -17,25 +17,123 @@
 #include "Poco/Zip/ZipArchive.h"
 #include "Poco/Zip/ZipStream.h"
 #include "Poco/Zip/ZipException.h"
+#include "Poco/Zip/SkipCallback.h"
 #include "Poco/File.h"
 #include "Poco/Exception.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Delegate.h"
 #include "Poco/FileStream.h"
 #include "Poco/Format.h"
+#include "Poco/ThreadPool.h"
+#include <cstring>
+#include <vector>
 
 
 namespace Poco {
 namespace Zip {
 
 
+class Decompress::WorkerTask: public Poco::Runnable
+	/// Extracts entries from a shared work list on a thread pool thread;
+	/// see the parallel Decompress constructor.
+{
+public:
+	struct WorkList
+	{
+		WorkList(): next(0) {}
+
+		Poco::FastMutex                 mutex;
+		std::size_t                     next;
+		std::vector<const ZipFileInfo*> entries;
+	};
+
+	WorkerTask(Decompress& decompress, WorkList& work):
+		_decompress(decompress),
+		_work(work)
+	{
+	}
+
+	void run()
+	{
+		try
+		{
+			Poco::FileInputStream in(_decompress._zipPath);
+			for (;;)
+			{
+				const ZipFileInfo* pInfo = 0;
+				{
+					Poco::FastMutex::ScopedLock lock(_work.mutex);
+					if (_work.next >= _work.entries.size()) break;
+					pInfo = _work.entries[_work.next++];
+				}
+				in.clear();
+				in.seekg(static_cast<std::streamoff>(pInfo->getOffset()), std::ios_base::beg);
+				char header[ZipCommon::HEADER_SIZE];
+				in.read(header, ZipCommon::HEADER_SIZE);
+				if (!in.good() || std::memcmp(header, ZipLocalFileHeader::HEADER, ZipCommon::HEADER_SIZE) != 0)
+					throw ZipException("Bad local file header", pInfo->getFileName());
+				// extracts the entry via Decompress::handleZipEntry, which
+				// fires EOk/EError just like in serial mode
+				ZipLocalFileHeader entry(in, true, _decompress);
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			_decompress.taskFailed(exc.displayText());
+		}
+		catch (std::exception& exc)
+		{
+			_decompress.taskFailed(exc.what());
+		}
+		catch (...)
+		{
+			_decompress.taskFailed("unknown exception");
+		}
+		_decompress.taskFinished();
+	}
+
+private:
+	Decompress& _decompress;
+	WorkList&   _work;
+};
+
+
 Decompress::Decompress(std::istream& in, const Poco::Path& outputDir, bool flattenDirs, bool keepIncompleteFiles):
 	_in(in),
 	_outDir(outputDir),
 	_flattenDirs(flattenDirs),
 	_keepIncompleteFiles(keepIncompleteFiles),
-	_mapping()
+	_mapping(),
+	_zipPath(),
+	_pPool(0),
+	_activeTasks(0)
+{
+	_outDir.makeAbsolute();
+	_outDir.makeDirectory();
+	if (!_in.good()) throw Poco::IOException("Bad input stream");
+	Poco::File tmp(_outDir);
+	if (!tmp.exists())
+	{
+		tmp.createDirectories();
+	}
+	if (!tmp.isDirectory())
+		throw Poco::IOException("Failed to create/open directory: " + _outDir.toString());
+	EOk += Poco::Delegate<Decompress, std::pair<const ZipLocalFileHeader, const Poco::Path> >(this, &Decompress::onOk);
+
+}
+
+
+Decompress::Decompress(const std::string& zipFile, const Poco::Path& outputDir, Poco::ThreadPool& pool, bool flattenDirs, bool keepIncompleteFiles):
+	_in(_inFile),
+	_outDir(outputDir),
+	_flattenDirs(flattenDirs),
+	_keepIncompleteFiles(keepIncompleteFiles),
+	_mapping(),
+	_zipPath(zipFile),
+	_pPool(&pool),
+	_activeTasks(0)
 {
+	_inFile.open(zipFile, std::ios::in);
 	_outDir.makeAbsolute();
 	_outDir.makeDirectory();
 	if (!_in.good()) throw Poco::IOException("Bad input stream");
@@ -67,11 +165,116 @@ Decompress::~Decompress()
 ZipArchive Decompress::decompressAllFiles()
 {
 	poco_assert (_mapping.empty());
+	if (_pPool) return decompressAllFilesParallel();
 	ZipArchive arch(_in, *this);
 	return arch;
 }
 
 
+ZipArchive Decompress::decompressAllFilesParallel()
+{
+	// parse the archive structure without extracting anything
+	SkipCallback skip;
+	ZipArchive arch(_in, skip);
+
+	// handle directory entries and create the parent directories of all
+	// files up front, so that the workers never race on directory creation
+	WorkerTask::WorkList work;
+	for (ZipArchive::FileInfos::const_iterator it = arch.fileInfoBegin(); it != arch.fileInfoEnd(); ++it)
+	{
+		const ZipFileInfo& nfo = it->second;
+		if (nfo.isDirectory())
+		{
+			if (!_flattenDirs)
+			{
+				std::string dirName = nfo.getFileName();
+				if (!ZipCommon::isValidPath(dirName))
+					throw ZipException("Illegal entry name", dirName);
+				Poco::Path dir(_outDir, dirName);
+				dir.makeDirectory();
+				Poco::File aFile(dir);
+				aFile.createDirectories();
+			}
+		}
+		else
+		{
+			if (!_flattenDirs && ZipCommon::isValidPath(nfo.getFileName()))
+			{
+				// invalid names are reported via EError by the worker
+				Poco::Path file(nfo.getFileName());
+				file.makeFile();
+				Poco::Path dest(_outDir, file);
+				dest.makeFile();
+				if (dest.depth() > 0)
+				{
+					Poco::File aParent(dest.parent());
+					aParent.createDirectories();
+				}
+			}
+			work.entries.push_back(&nfo);
+		}
+	}
+
+	int workers = _pPool->available();
+	if (workers > static_cast<int>(work.entries.size())) workers = static_cast<int>(work.entries.size());
+
+	std::vector<Poco::SharedPtr<Poco::Runnable> > tasks;
+	for (int i = 1; i < workers; ++i)
+	{
+		Poco::SharedPtr<Poco::Runnable> pTask = new WorkerTask(*this, work);
+		{
+			Poco::FastMutex::ScopedLock lock(_taskMutex);
+			++_activeTasks;
+		}
+		try
+		{
+			_pPool->start(*pTask);
+			tasks.push_back(pTask);
+		}
+		catch (Poco::NoThreadAvailableException&)
+		{
+			taskFinished();
+			break;
+		}
+	}
+
+	// the calling thread drains the work list, too
+	{
+		Poco::FastMutex::ScopedLock lock(_taskMutex);
+		++_activeTasks;
+	}
+	WorkerTask ownShare(*this, work);
+	ownShare.run();
+
+	std::string error;
+	{
+		Poco::FastMutex::ScopedLock lock(_taskMutex);
+		while (_activeTasks > 0)
+			_tasksDone.wait(_taskMutex);
+		error = _taskError;
+		_taskError.clear();
+	}
+	if (!error.empty()) throw ZipException("Parallel decompression failed", error);
+
+	return arch;
+}
+
+
+void Decompress::taskFinished()
+{
+	Poco::FastMutex::ScopedLock lock(_taskMutex);
+	poco_assert_dbg (_activeTasks > 0);
+	if (--_activeTasks == 0) _tasksDone.broadcast();
+}
+
+
+void Decompress::taskFailed(const std::string& msg)
+{
+	Poco::FastMutex::ScopedLock lock(_taskMutex);
+	if (_taskError.empty()) _taskError = msg;
+}
+
+
 bool Decompress::handleZipEntry(std::istream& zipStream, const ZipLocalFileHeader& hdr)
 {
 	if (hdr.isDirectory())
@@ -180,6 +383,7 @@ bool Decompress::handleZipEntry(std::istream& zipStream, const ZipLocalFileHeade
 
 void Decompress::onOk(const void*, std::pair<const ZipLocalFileHeader, const Poco::Path>& val)
 {
+	Poco::FastMutex::ScopedLock lock(_mappingMutex);
 	_mapping.insert(std::make_pair(val.first.getFileName(), val.second));
 }
 
@@ -0,0 +1,166 @@
+//
+// ZipArchiveIndex.cpp
+//
+// Library: Zip
+// Package: Zip
+// Module:  ZipArchiveIndex
+//
+// Copyright (c) 2007, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier: BSL-1.0
+//
+
+
+#include "Poco/Zip/ZipArchiveIndex.h"
+#include "Poco/Zip/ZipArchiveInfo.h"
+#include "Poco/Zip/ZipUtil.h"
+#include "Poco/Zip/ZipException.h"
+#include "Poco/File.h"
+#include "Poco/MemoryStream.h"
+#include <cstring>
+
+
+namespace Poco {
+namespace Zip {
+
+
+namespace
+{
+	// field positions inside the end of central directory record,
+	// its Zip64 variant and a central directory record
+	enum
+	{
+		EOCD_TOTALENTRIES_POS    = 10,
+		EOCD_DIRSIZE_POS         = 12,
+		EOCD_DIROFFSET_POS       = 16,
+		EOCD_COMMENTLENGTH_POS   = 20,
+		EOCD_SIZE                = 22,
+		EOCD64_TOTALENTRIES_POS  = 32,
+		EOCD64_DIRSIZE_POS       = 40,
+		EOCD64_DIROFFSET_POS     = 48,
+		EOCD64_LOCATOR_OFFSET_POS = 8,
+		EOCD64_LOCATOR_SIZE      = 20,
+		RECORD_FILENAMELENGTH_POS = 28,
+		RECORD_EXTRAFIELDLENGTH_POS = 30,
+		RECORD_COMMENTLENGTH_POS = 32,
+		RECORD_FILENAME_POS      = 46
+	};
+}
+
+
+ZipArchiveIndex::ZipArchiveIndex(const std::string& path):
+	_mapping(Poco::File(path), Poco::SharedMemory::AM_READ),
+	_data(0),
+	_size(static_cast<std::size_t>(Poco::File(path).getSize())),
+	_dirOffset(0),
+	_dirSize(0),
+	_expectedEntries(0)
+{
+	_data = _mapping.begin();
+	locateCentralDirectory();
+	buildIndex();
+}
+
+
+ZipArchiveIndex::~ZipArchiveIndex()
+{
+}
+
+
+const ZipFileInfo& ZipArchiveIndex::fileInfo(const std::string& fileName)
+{
+	InfoCache::const_iterator itCache = _cache.find(fileName);
+	if (itCache != _cache.end())
+		return itCache->second;
+
+	OffsetIndex::const_iterator it = _index.find(fileName);
+	if (it == _index.end())
+		throw ZipException("No entry found", fileName);
+
+	Poco::MemoryInputStream in(_data + it->second, _size - static_cast<std::size_t>(it->second));
+	ZipFileInfo nfo(in, false);
+	return _cache.insert(std::make_pair(fileName, nfo)).first->second;
+}
+
+
+void ZipArchiveIndex::locateCentralDirectory()
+{
+	// the end of central directory record is located in the last
+	// 22 + 64k bytes of the file (the comment follows the fixed part)
+	if (_size < EOCD_SIZE)
+		throw ZipException("Not a Zip archive: too small");
+
+	std::size_t scanStart = _size - EOCD_SIZE;
+	std::size_t scanEnd = EOCD_SIZE + 0xFFFF < _size ? _size - EOCD_SIZE - 0xFFFF : 0;
+	std::streamoff eocdPos = -1;
+	for (std::size_t pos = scanStart; ; --pos)
+	{
+		if (std::memcmp(_data + pos, ZipArchiveInfo::HEADER, ZipCommon::HEADER_SIZE) == 0)
+		{
+			eocdPos = static_cast<std::streamoff>(pos);
+			break;
+		}
+		if (pos == scanEnd) break;
+	}
+	if (eocdPos < 0)
+		throw ZipException("Not a Zip archive: end of central directory not found");
+
+	const char* eocd = _data + eocdPos;
+	_expectedEntries = ZipUtil::get16BitValue(eocd, EOCD_TOTALENTRIES_POS);
+	_dirSize = ZipUtil::get32BitValue(eocd, EOCD_DIRSIZE_POS);
+	_dirOffset = static_cast<std::streamoff>(ZipUtil::get32BitValue(eocd, EOCD_DIROFFSET_POS));
+
+	Poco::UInt16 commentLength = ZipUtil::get16BitValue(eocd, EOCD_COMMENTLENGTH_POS);
+	if (commentLength > 0 && eocdPos + EOCD_SIZE + commentLength <= static_cast<std::streamoff>(_size))
+		_comment.assign(eocd + EOCD_SIZE, commentLength);
+
+	// a Zip64 archive stores the real values in the Zip64 end of central
+	// directory record, located through the locator preceding the EOCD
+	bool needZip64 = _expectedEntries == ZipCommon::ZIP64_MAGIC_SHORT
+		|| _dirSize == ZipCommon::ZIP64_MAGIC
+		|| _dirOffset == static_cast<std::streamoff>(ZipCommon::ZIP64_MAGIC);
+	if (needZip64 && eocdPos >= EOCD64_LOCATOR_SIZE
+		&& std::memcmp(_data + eocdPos - EOCD64_LOCATOR_SIZE, ZipArchiveInfo64::LOCATOR_HEADER, ZipCommon::HEADER_SIZE) == 0)
+	{
+		const char* locator = _data + eocdPos - EOCD64_LOCATOR_SIZE;
+		Poco::UInt64 eocd64Pos = ZipUtil::get64BitValue(locator, EOCD64_LOCATOR_OFFSET_POS);
+		if (eocd64Pos + EOCD64_DIROFFSET_POS + 8 > _size
+			|| std::memcmp(_data + eocd64Pos, ZipArchiveInfo64::HEADER, ZipCommon::HEADER_SIZE) != 0)
+			throw ZipException("Bad Zip64 end of central directory record");
+		const char* eocd64 = _data + eocd64Pos;
+		_expectedEntries = ZipUtil::get64BitValue(eocd64, EOCD64_TOTALENTRIES_POS);
+		_dirSize = ZipUtil::get64BitValue(eocd64, EOCD64_DIRSIZE_POS);
+		_dirOffset = static_cast<std::streamoff>(ZipUtil::get64BitValue(eocd64, EOCD64_DIROFFSET_POS));
+	}
+
+	if (_dirOffset + static_cast<std::streamoff>(_dirSize) > static_cast<std::streamoff>(_size))
+		throw ZipException("Bad central directory: extends beyond end of file");
+}
+
+
+void ZipArchiveIndex::buildIndex()
+{
+	std::streamoff pos = _dirOffset;
+	std::streamoff dirEnd = _dirOffset + static_cast<std::streamoff>(_dirSize);
+	while (pos + RECORD_FILENAME_POS <= dirEnd)
+	{
+		const char* record = _data + pos;
+		if (std::memcmp(record, ZipFileInfo::HEADER, ZipCommon::HEADER_SIZE) != 0)
+			throw ZipException("Bad central directory record");
+		Poco::UInt16 fileNameLength = ZipUtil::get16BitValue(record, RECORD_FILENAMELENGTH_POS);
+		Poco::UInt16 extraFieldLength = ZipUtil::get16BitValue(record, RECORD_EXTRAFIELDLENGTH_POS);
+		Poco::UInt16 commentLength = ZipUtil::get16BitValue(record, RECORD_COMMENTLENGTH_POS);
+		std::streamoff recordSize = RECORD_FILENAME_POS + fileNameLength + extraFieldLength + commentLength;
+		if (pos + recordSize > dirEnd)
+			throw ZipException("Bad central directory record: truncated");
+		std::string fileName(record + RECORD_FILENAME_POS, fileNameLength);
+		_index.insert(std::make_pair(fileName, pos));
+		pos += recordSize;
+	}
+	if (_expectedEntries != _index.size())
+		throw ZipException("Bad central directory: number of entries does not match");
+}
+
+
+} } // namespace Poco::Zip
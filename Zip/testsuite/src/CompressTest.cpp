@@ -12,9 +12,14 @@
 #include "ZipTest.h"
 #include "Poco/Buffer.h"
 #include "Poco/Zip/Compress.h"
+#include "Poco/Zip/Decompress.h"
 #include "Poco/Zip/ZipManipulator.h"
+#include "Poco/Delegate.h"
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/ThreadPool.h"
+#include <sstream>
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include <iostream>
@@ -25,7 +30,7 @@
 using namespace Poco::Zip;
 
 
-CompressTest::CompressTest(const std::string& name): CppUnit::TestCase(name)
+CompressTest::CompressTest(const std::string& name): CppUnit::TestCase(name), _decompressErrors(0)
 {
 }
 
@@ -194,6 +199,146 @@ void CompressTest::testZip64()
 }
 
 
+void CompressTest::testParallelDeflate()
+{
+	typedef std::map<std::string, Poco::UInt64> FileMap;
+	FileMap files;
+	files["par1.bin"] = KB*256;
+	files["par2.bin"] = KB*512+123;
+	files["par3.bin"] = KB*64;
+	files["par4.bin"] = 0;
+
+	for (FileMap::const_iterator it = files.begin(); it != files.end(); it++)
+	{
+		createDataFile(it->first, it->second);
+	}
+
+	std::string zipPath(Poco::Path::temp() + "parallel.zip");
+	Poco::ThreadPool pool(2, 4);
+	{
+		Poco::FileOutputStream out(zipPath, std::ios::trunc);
+		Compress c(out, true);
+		c.setParallel(pool);
+		for (FileMap::const_iterator it = files.begin(); it != files.end(); it++)
+		{
+			c.addFile(it->first, it->first);
+		}
+		ZipArchive a(c.close());
+		for (FileMap::const_iterator it = files.begin(); it != files.end(); it++)
+		{
+			ZipArchive::FileHeaders::const_iterator it2 = a.findHeader(it->first);
+			assert (it2 != a.headerEnd());
+			assert (it2->second.getUncompressedSize() == it->second);
+		}
+	}
+
+	// decompressing verifies the per-entry CRCs and sizes
+	_decompressErrors = 0;
+	Poco::FileInputStream in(zipPath);
+	Decompress dec(in, Poco::Path::temp());
+	dec.EError += Poco::Delegate<CompressTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &CompressTest::onDecompressError);
+	dec.decompressAllFiles();
+	dec.EError -= Poco::Delegate<CompressTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &CompressTest::onDecompressError);
+	assert (_decompressErrors == 0);
+
+	for (FileMap::const_iterator it = files.begin(); it != files.end(); it++)
+	{
+		Poco::File extracted(Poco::Path::temp() + it->first);
+		assert (extracted.exists());
+		assert (extracted.getSize() == it->second);
+		extracted.remove();
+		Poco::File(it->first).remove();
+	}
+}
+
+
+void CompressTest::onDecompressError(const void* pSender, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string>& info)
+{
+	++_decompressErrors;
+}
+
+
+namespace
+{
+	class NonSeekableStreamBuf: public std::streambuf
+		/// Collects all output in a string; any attempt to seek fails,
+		/// like on a socket.
+	{
+	public:
+		const std::string& data() const
+		{
+			return _data;
+		}
+
+	protected:
+		int_type overflow(int_type c)
+		{
+			if (c != traits_type::eof()) _data += traits_type::to_char_type(c);
+			return c;
+		}
+
+		std::streamsize xsputn(const char* s, std::streamsize n)
+		{
+			_data.append(s, static_cast<std::size_t>(n));
+			return n;
+		}
+
+		pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode)
+		{
+			return pos_type(off_type(-1));
+		}
+
+		pos_type seekpos(pos_type, std::ios_base::openmode)
+		{
+			return pos_type(off_type(-1));
+		}
+
+	private:
+		std::string _data;
+	};
+}
+
+
+void CompressTest::testStreamingNoSeek()
+{
+	std::map<std::string, std::string> files;
+	files["streamed1.txt"] = "the first streamed file";
+	files["streamed2.txt"] = std::string(10000, 'x');
+	files["streamed3.txt"] = "";
+
+	NonSeekableStreamBuf buf;
+	std::ostream out(&buf);
+	Compress c(out, false);
+	for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		std::istringstream istr(it->second);
+		c.addFile(istr, Poco::DateTime(), it->first);
+	}
+	ZipArchive a(c.close());
+	assert (out.good()); // a single seek would have put the stream into failed state
+
+	// the streamed archive must decompress cleanly
+	_decompressErrors = 0;
+	std::string extractDir(Poco::Path::temp() + "streamed/");
+	std::istringstream in(buf.data());
+	Decompress dec(in, extractDir);
+	dec.EError += Poco::Delegate<CompressTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &CompressTest::onDecompressError);
+	dec.decompressAllFiles();
+	dec.EError -= Poco::Delegate<CompressTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &CompressTest::onDecompressError);
+	assert (_decompressErrors == 0);
+	assert (dec.mapping().size() == files.size());
+
+	for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		Poco::FileInputStream fis(extractDir + it->first);
+		std::ostringstream content;
+		Poco::StreamCopier::copyStream(fis, content);
+		assert (content.str() == it->second);
+	}
+	Poco::File(extractDir).remove(true);
+}
+
+
 void CompressTest::setUp()
 {
 }
@@ -215,6 +360,8 @@ CppUnit::Test* CompressTest::suite()
 	CppUnit_addTest(pSuite, CompressTest, testManipulatorReplace);
 	CppUnit_addTest(pSuite, CompressTest, testSetZipComment);
 	CppUnit_addTest(pSuite, CompressTest, testZip64);
+	CppUnit_addTest(pSuite, CompressTest, testParallelDeflate);
+	CppUnit_addTest(pSuite, CompressTest, testStreamingNoSeek);
 
 	return pSuite;
 }
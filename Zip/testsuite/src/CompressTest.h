@@ -15,6 +15,7 @@
 
 
 #include "Poco/Zip/Zip.h"
+#include "Poco/Zip/ZipLocalFileHeader.h"
 #include "CppUnit/TestCase.h"
 
 
@@ -35,6 +36,8 @@ public:
 	static const Poco::UInt64 MB = 1024*KB;
 	void createDataFile(const std::string& path, Poco::UInt64 size);
 	void testZip64();
+	void testParallelDeflate();
+	void testStreamingNoSeek();
 
 	void setUp();
 	void tearDown();
@@ -42,6 +45,9 @@ public:
 	static CppUnit::Test* suite();
 
 private:
+	void onDecompressError(const void* pSender, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string>& info);
+
+	int _decompressErrors;
 };
 
 
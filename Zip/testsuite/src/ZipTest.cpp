@@ -14,6 +14,9 @@
 #include "Poco/Zip/ZipArchive.h"
 #include "Poco/Zip/ZipStream.h"
 #include "Poco/Zip/Decompress.h"
+#include "Poco/Zip/Compress.h"
+#include "Poco/Zip/ZipArchiveIndex.h"
+#include "Poco/Zip/ZipException.h"
 #include "Poco/Zip/ZipCommon.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/File.h"
@@ -23,6 +26,8 @@
 #include "Poco/Delegate.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Environment.h"
+#include "Poco/Format.h"
+#include "Poco/ThreadPool.h"
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #undef min
@@ -258,6 +263,102 @@ void ZipTest::testDecompressZip64()
 }
 
 
+void ZipTest::testDecompressParallel()
+{
+	std::string zipPath(Poco::Path::temp() + "parextract.zip");
+	std::map<std::string, std::string> files;
+	for (int i = 0; i < 20; ++i)
+	{
+		std::string name(Poco::format("dir%d/file%d.txt", i % 3, i));
+		std::string content;
+		for (int j = 0; j <= i; ++j)
+			content.append("some repetitive test data for entry " + name + "\n");
+		files[name] = content;
+	}
+	{
+		Poco::FileOutputStream out(zipPath, std::ios::trunc);
+		Compress c(out, true);
+		for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+		{
+			std::istringstream istr(it->second);
+			c.addFile(istr, Poco::DateTime(), it->first);
+		}
+		c.close();
+	}
+
+	std::string extractDir(Poco::Path::temp() + "parextract/");
+	Poco::ThreadPool pool(2, 4);
+	Decompress dec(zipPath, extractDir, pool);
+	dec.EError += Poco::Delegate<ZipTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &ZipTest::onDecompressError);
+	dec.decompressAllFiles();
+	dec.EError -= Poco::Delegate<ZipTest, std::pair<const Poco::Zip::ZipLocalFileHeader, const std::string> >(this, &ZipTest::onDecompressError);
+	assert (_errCnt == 0);
+	assert (dec.mapping().size() == files.size());
+
+	for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		Poco::FileInputStream in(extractDir + it->first);
+		assert (in.good());
+		std::ostringstream content;
+		Poco::StreamCopier::copyStream(in, content);
+		assert (content.str() == it->second);
+	}
+
+	Poco::File(extractDir).remove(true);
+	Poco::File(zipPath).remove();
+}
+
+
+void ZipTest::testArchiveIndex()
+{
+	std::string zipPath(Poco::Path::temp() + "index.zip");
+	std::map<std::string, std::string> files;
+	files["first.txt"] = "some text in the first file";
+	files["dir/second.txt"] = "the second file lives in a directory";
+	files["empty.txt"] = "";
+	{
+		Poco::FileOutputStream out(zipPath, std::ios::trunc);
+		Compress c(out, true);
+		c.setZipComment("indexed");
+		Poco::Path dir("dir/");
+		dir.makeDirectory();
+		c.addDirectory(dir, Poco::DateTime());
+		for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+		{
+			std::istringstream istr(it->second);
+			c.addFile(istr, Poco::DateTime(), it->first);
+		}
+		c.close();
+	}
+
+	Poco::Zip::ZipArchiveIndex index(zipPath);
+	assert (index.size() == 4); // three files plus the dir/ entry
+	assert (index.getZipComment() == "indexed");
+	assert (index.hasEntry("dir/"));
+	assert (!index.hasEntry("missing.txt"));
+	for (std::map<std::string, std::string>::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		assert (index.hasEntry(it->first));
+		const Poco::Zip::ZipFileInfo& nfo = index.fileInfo(it->first);
+		assert (nfo.getFileName() == it->first);
+		assert (nfo.getUncompressedSize() == it->second.size());
+		assert (nfo.isFile());
+	}
+	// second access comes from the cache
+	assert (&index.fileInfo("first.txt") == &index.fileInfo("first.txt"));
+	try
+	{
+		index.fileInfo("missing.txt");
+		failmsg("must throw for unknown entries");
+	}
+	catch (Poco::Zip::ZipException&)
+	{
+	}
+
+	Poco::File(zipPath).remove();
+}
+
+
 void ZipTest::testValidPath()
 {
 	assert (ZipCommon::isValidPath("."));
@@ -326,6 +427,8 @@ CppUnit::Test* ZipTest::suite()
 	CppUnit_addTest(pSuite, ZipTest, testCrcAndSizeAfterData);
 	CppUnit_addTest(pSuite, ZipTest, testCrcAndSizeAfterDataWithArchive);
 	CppUnit_addTest(pSuite, ZipTest, testDecompressZip64);
+	CppUnit_addTest(pSuite, ZipTest, testDecompressParallel);
+	CppUnit_addTest(pSuite, ZipTest, testArchiveIndex);
 	CppUnit_addTest(pSuite, ZipTest, testValidPath);
 
 	return pSuite;
@@ -39,6 +39,8 @@ public:
 	static const Poco::UInt64 MB = 1024*KB;
 	void verifyDataFile(const std::string& path, Poco::UInt64 size);
 	void testDecompressZip64();
+	void testDecompressParallel();
+	void testArchiveIndex();
 	void testValidPath();
 
 	void setUp();